@@ -0,0 +1 @@
+.././etc/scripts/drop_reports.bash
\ No newline at end of file
@@ -0,0 +1 @@
+.././etc/scripts/dump_reports.bash
\ No newline at end of file
@@ -0,0 +1 @@
+.././etc/scripts/extract_game_report_data.py
\ No newline at end of file
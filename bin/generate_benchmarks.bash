@@ -0,0 +1 @@
+.././etc/scripts/generate_benchmarks.bash
\ No newline at end of file
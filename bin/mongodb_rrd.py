@@ -0,0 +1 @@
+.././etc/scripts/mongodb_rrd.py
\ No newline at end of file
@@ -0,0 +1 @@
+.././etc/scripts/rcll_challenge_startup.bash
\ No newline at end of file
@@ -0,0 +1 @@
+.././etc/scripts/restore_reports.bash
\ No newline at end of file
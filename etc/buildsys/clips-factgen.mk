@@ -0,0 +1,42 @@
+#*****************************************************************************
+#          Makefile Build System for Fawkes: CLIPS fact struct generator
+#                            -------------------
+#   Created on Wed Oct 21 15:02:48 2026
+#   Copyright (C) 2026 by agent <agent@local>
+#
+#*****************************************************************************
+#
+#   This program is free software; you can redistribute it and/or modify
+#   it under the terms of the GNU General Public License as published by
+#   the Free Software Foundation; either version 2 of the License, or
+#   (at your option) any later version.
+#
+#*****************************************************************************
+
+ifndef __buildsys_config_mk_
+$(error config.mk must be included before clips-factgen.mk)
+endif
+
+ifndef __buildsys_clips_factgen_mk_
+__buildsys_clips_factgen_mk_ := 1
+
+# Generate C++ structs for the deftemplates in CLIPS_FACTGEN_SOURCES.
+# The generated files are part of the source tree, run "make clips-facts"
+# after changing a deftemplate and commit the result.
+CLIPS_FACTGEN=$(BASEDIR)/etc/clips-factgen/clips-factgen.py
+CLIPS_FACTGEN_BASENAME=facts
+CLIPS_FACTGEN_OUTDIR=$(SRCDIR)
+
+ifeq ($(OBJSSUBMAKE),1)
+.PHONY: clips-facts
+clips-facts: $(CLIPS_FACTGEN_SOURCES)
+	$(SILENT) echo -e "$(INDENT_PRINT)[FactGen] $(PARENTDIR)$(TBOLDGRAY)$(CLIPS_FACTGEN_BASENAME)$(TNORMAL)"
+	$(SILENT)$(CLIPS_FACTGEN) \
+		--namespace $(CLIPS_FACTGEN_NAMESPACE) --basename $(CLIPS_FACTGEN_BASENAME) \
+		--include-prefix $(CLIPS_FACTGEN_INCLUDE_PREFIX) --output-dir $(CLIPS_FACTGEN_OUTDIR) \
+		$(if $(CLIPS_FACTGEN_TEMPLATES),--templates $(CLIPS_FACTGEN_TEMPLATES)) \
+		$(CLIPS_FACTGEN_SOURCES) | \
+		sed -e "s|^$(realpath $(BASEDIR))/\(.*/\)\([^/]\+\)$$|$(INDENT_PRINT)[FactGen] -> \1$(patsubst \\%,\\o%,$(TBOLDGRAY))\2$(patsubst \\%,\\o%,$(TNORMAL))|g"
+endif
+
+endif # __buildsys_clips_factgen_mk_
@@ -0,0 +1,378 @@
+#!/usr/bin/env python3
+
+###########################################################################
+#  clips-factgen.py - Generate C++ structs for CLIPS deftemplates
+#
+#  Copyright  2026  agent <agent@local>
+###########################################################################
+
+#  This program is free software; you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation; either version 2 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU Library General Public License for more details.
+#
+#  Read the full text in the LICENSE.GPL file in the doc directory.
+
+# Parse the deftemplates of CLIPS files and write a header and source
+# file with one struct per template. Each struct is filled from a
+# clips_replica::FactSnapshot in a single pass over the slots by
+# position, C++ code then accesses slots as typed members instead of
+# looking them up by name.
+
+import os
+import re
+import sys
+import argparse
+
+CXX_KEYWORDS = set("""
+alignas alignof and and_eq asm auto bitand bitor bool break case catch char
+char16_t char32_t class compl const constexpr const_cast continue decltype
+default delete do double dynamic_cast else enum explicit export extern false
+float for friend goto if inline int long mutable namespace new noexcept not
+not_eq nullptr operator or or_eq private protected public register
+reinterpret_cast return short signed sizeof static static_assert static_cast
+struct switch template this thread_local throw true try typedef typeid
+typename union unsigned using virtual void volatile wchar_t while xor xor_eq
+""".split())
+
+# C++ types of slots by CLIPS type, single-field and multi-field
+TYPES = {
+	"INTEGER": ("int64_t", "std::vector<int64_t>"),
+	"FLOAT":   ("double", "std::vector<double>"),
+	"NUMBER":  ("double", "std::vector<double>"),
+	"SYMBOL":  ("std::string", "std::vector<std::string>"),
+	"STRING":  ("std::string", "std::vector<std::string>"),
+	"LEXEME":  ("std::string", "std::vector<std::string>"),
+	"BOOL":    ("bool", "std::vector<std::string>"),
+}
+RAW_TYPE = "CLIPS::Values"
+INITIALIZERS = {"int64_t": "0", "double": "0.", "bool": "false"}
+
+
+class ParseError(Exception):
+	pass
+
+
+def tokenize(text, filename):
+	tokens = []
+	i, line, n = 0, 1, len(text)
+	while i < n:
+		c = text[i]
+		if c == '\n':
+			line += 1
+			i += 1
+		elif c.isspace():
+			i += 1
+		elif c == ';':
+			while i < n and text[i] != '\n':
+				i += 1
+		elif c in '()':
+			tokens.append((c, line))
+			i += 1
+		elif c == '"':
+			j = i + 1
+			while j < n and text[j] != '"':
+				if text[j] == '\\':
+					j += 1
+				if j < n and text[j] == '\n':
+					line += 1
+				j += 1
+			if j >= n:
+				raise ParseError("%s:%d: unterminated string" % (filename, line))
+			tokens.append((text[i:j + 1], line))
+			i = j + 1
+		else:
+			j = i
+			while j < n and not text[j].isspace() and text[j] not in '();"':
+				j += 1
+			tokens.append((text[i:j], line))
+			i = j
+	return tokens
+
+
+def parse(tokens, filename):
+	"""Parse tokens into nested lists of atoms."""
+	stack, top = [], []
+	for tok, line in tokens:
+		if tok == '(':
+			stack.append(top)
+			top = []
+		elif tok == ')':
+			if not stack:
+				raise ParseError("%s:%d: unbalanced parenthesis" % (filename, line))
+			parent = stack.pop()
+			parent.append(top)
+			top = parent
+		else:
+			top.append(tok)
+	if stack:
+		raise ParseError("%s: unbalanced parenthesis at end of file" % filename)
+	return top
+
+
+def parse_slot(form, tmpl_name):
+	if len(form) < 2 or not isinstance(form[1], str):
+		raise ParseError("invalid slot in deftemplate %s" % tmpl_name)
+	slot = {
+		"name": form[1],
+		"multi": form[0] in ("multislot", "multifield"),
+		"types": [],
+		"allowed": None,
+	}
+	for attr in form[2:]:
+		if not isinstance(attr, list) or not attr:
+			continue
+		if attr[0] == "type":
+			slot["types"] = [t for t in attr[1:] if isinstance(t, str)]
+		elif attr[0] in ("allowed-values", "allowed-symbols"):
+			slot["allowed"] = [v for v in attr[1:] if isinstance(v, str)]
+	return slot
+
+
+def find_deftemplates(forms, filename):
+	templates = []
+	for form in forms:
+		if not isinstance(form, list) or not form or form[0] != "deftemplate":
+			continue
+		if len(form) < 2 or not isinstance(form[1], str):
+			raise ParseError("%s: deftemplate without name" % filename)
+		name = form[1]
+		if "::" in name:
+			name = name.split("::", 1)[1]
+		slots = []
+		for f in form[2:]:
+			if isinstance(f, list) and f and f[0] in ("slot", "field", "multislot", "multifield"):
+				slots.append(parse_slot(f, name))
+		templates.append({"name": name, "slots": slots, "file": filename})
+	return templates
+
+
+def identifier(name):
+	ident = re.sub(r'[^A-Za-z0-9_]', '_', name)
+	if ident[0].isdigit() or ident in CXX_KEYWORDS:
+		ident += "_"
+	return ident
+
+
+def struct_name(name):
+	return "".join(p[:1].upper() + p[1:] for p in re.split(r'[^A-Za-z0-9]+', name) if p)
+
+
+def cxx_type(slot):
+	types = slot["types"]
+	if len(types) != 1 or types[0] not in TYPES:
+		return RAW_TYPE
+	clips_type = types[0]
+	if clips_type == "SYMBOL" and slot["allowed"] is not None \
+	   and sorted(slot["allowed"]) == ["FALSE", "TRUE"]:
+		clips_type = "BOOL"
+	return TYPES[clips_type][1 if slot["multi"] else 0]
+
+
+def banner(filename, sources):
+	return """/****************************************************************************
+ *  %s - structs for CLIPS deftemplates
+ *  (auto-generated by clips-factgen, do not modify directly)
+ *
+ *  Generated from: %s
+ ****************************************************************************/
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+""" % (filename, ", ".join(sources))
+
+
+def gen_header(templates, namespace, basename, sources):
+	guard = "__%s_%s_H_" % (namespace.upper(), identifier(basename).upper())
+	out = [banner(basename + ".h", sources)]
+	out.append("#ifndef %s\n#define %s\n" % (guard, guard))
+	out.append("#include <clips_replica/fact_changes.h>\n")
+	out.append("#include <cstdint>\n#include <string>\n#include <vector>\n")
+	out.append("namespace %s {\n" % namespace)
+	for t in templates:
+		name = struct_name(t["name"])
+		decls = [("%s" % cxx_type(s), identifier(s["name"]), "slot %s" % s["name"])
+		         for s in t["slots"]]
+		decls = [("static const char *const", "TEMPLATE;", "name of the deftemplate"),
+		         ("static const unsigned int", "NUM_SLOTS = %d;" % len(t["slots"]), "number of slots"),
+		         ("static const char *const", "SLOTS[NUM_SLOTS];" if t["slots"] else "SLOTS[1];",
+		          "names of the slots in deftemplate order")] \
+		        + [(d[0], d[1] + ";", d[2]) for d in decls]
+		out.append("/** Fact of deftemplate %s. */" % t["name"])
+		out.append("struct %s\n{" % name)
+		out.append("\t%s();" % name)
+		out.append("\texplicit %s(const clips_replica::FactSnapshot &fact);" % name)
+		# declarations are aligned per block, like clang-format does
+		for block in (decls[:3], decls[3:]):
+			if not block:
+				continue
+			out.append("")
+			type_width = max(len(d[0]) for d in block)
+			decl_width = max(type_width + 1 + len(d[1]) for d in block)
+			for ctype, member, doc in block:
+				d = ctype.ljust(type_width) + " " + member
+				out.append("\t%s ///< %s" % (d.ljust(decl_width), doc))
+		out.append("};\n")
+	out.append("} // end namespace %s\n" % namespace)
+	out.append("#endif")
+	return "\n".join(out) + "\n"
+
+
+def wrap_initializers(inits):
+	if not inits:
+		return []
+	line = ": " + ", ".join(inits)
+	if len(line) <= 100:
+		return [line]
+	return [(": " if i == 0 else "  ") + init + ("," if i < len(inits) - 1 else "")
+	        for i, init in enumerate(inits)]
+
+
+def gen_source(templates, namespace, basename, include_prefix, sources):
+	out = [banner(basename + ".cpp", sources)]
+	includes = ["%s%s.h" % (include_prefix, basename), "clips_replica/slot_convert.h",
+	            "core/exception.h"]
+	out.append("\n".join("#include <%s>" % i for i in sorted(includes)) + "\n")
+	out.append("namespace %s {\n" % namespace)
+	out.append("""/// @cond INTERNALS
+static const std::vector<CLIPS::Values> &
+slot_values(const clips_replica::FactSnapshot &fact,
+            const char *                       tmpl,
+            const char *const *                slots,
+            unsigned int                       num_slots)
+{
+	if (fact.template_name() != tmpl) {
+		throw fawkes::Exception("Fact %li is a %s, not a %s",
+		                        fact.index(),
+		                        fact.template_name().c_str(),
+		                        tmpl);
+	}
+	const std::vector<std::string> &names = fact.slot_names();
+	if (names.size() != num_slots) {
+		throw fawkes::Exception("Template %s has %zu slots, expected %u, regenerate the structs",
+		                        tmpl,
+		                        names.size(),
+		                        num_slots);
+	}
+	for (unsigned int i = 0; i < num_slots; ++i) {
+		if (names[i] != slots[i]) {
+			throw fawkes::Exception("Slot %u of template %s is %s, expected %s, regenerate the structs",
+			                        i,
+			                        tmpl,
+			                        names[i].c_str(),
+			                        slots[i]);
+		}
+	}
+	return fact.values();
+}
+/// @endcond
+""")
+	for t in templates:
+		name = struct_name(t["name"])
+		out.append("/** @class %s <%s%s.h>" % (name, include_prefix, basename))
+		out.append(" * Fact of deftemplate %s, generated from %s." % (t["name"], os.path.basename(t["file"])))
+		out.append(" */\n")
+		out.append("const char *const %s::TEMPLATE = \"%s\";" % (name, t["name"]))
+		if t["slots"]:
+			out.append("const char *const %s::SLOTS[%s::NUM_SLOTS] = {" % (name, name))
+			for i, s in enumerate(t["slots"]):
+				out.append("  \"%s\"%s" % (s["name"], "," if i < len(t["slots"]) - 1 else "};"))
+		else:
+			out.append("const char *const %s::SLOTS[1] = {nullptr};" % name)
+		out.append("")
+		inits = ["%s(%s)" % (identifier(s["name"]), INITIALIZERS[cxx_type(s)])
+		         for s in t["slots"] if cxx_type(s) in INITIALIZERS]
+		out.append("/** Constructor. */")
+		out.append("%s::%s()" % (name, name))
+		out.extend(wrap_initializers(inits))
+		out.append("{\n}\n")
+		out.append("/** Constructor from a fact.")
+		out.append(" * @param fact snapshot of a %s fact" % t["name"])
+		out.append(" * @exception Exception thrown if the fact is of another template, the slots")
+		out.append(" * do not match the deftemplate the struct was generated from, or a value")
+		out.append(" * cannot be converted")
+		out.append(" */")
+		out.append("%s::%s(const clips_replica::FactSnapshot &fact)" % (name, name))
+		out.append("{")
+		if t["slots"]:
+			out.append("\tconst std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);")
+			for i, s in enumerate(t["slots"]):
+				out.append("\tclips_replica::convert_slot(v[%d], SLOTS[%d], %s);" % (i, i, identifier(s["name"])))
+		else:
+			out.append("\tslot_values(fact, TEMPLATE, SLOTS, 0);")
+		out.append("}\n")
+	out.append("} // end namespace %s" % namespace)
+	return "\n".join(out) + "\n"
+
+
+def write_if_changed(path, content, force):
+	if not force and os.path.exists(path):
+		with open(path) as f:
+			if f.read() == content:
+				return
+	with open(path, "w") as f:
+		f.write(content)
+	print(os.path.realpath(path))
+
+
+def main():
+	parser = argparse.ArgumentParser(description="Generate C++ structs for CLIPS deftemplates.")
+	parser.add_argument("--namespace", required=True, help="C++ namespace of the structs")
+	parser.add_argument("--basename", default="facts", help="base name of the output files")
+	parser.add_argument("--include-prefix", default="", help="path prefix to include the header")
+	parser.add_argument("--output-dir", default=".", help="directory to write the files to")
+	parser.add_argument("--templates", help="comma-separated deftemplates, default all")
+	parser.add_argument("-f", "--force", action="store_true", help="write unchanged files")
+	parser.add_argument("clips_files", nargs="+", help="CLIPS files to read deftemplates from")
+	args = parser.parse_args()
+
+	templates = []
+	try:
+		for filename in args.clips_files:
+			with open(filename) as f:
+				templates += find_deftemplates(parse(tokenize(f.read(), filename), filename), filename)
+	except (OSError, ParseError) as e:
+		print("clips-factgen: %s" % e, file=sys.stderr)
+		sys.exit(1)
+
+	if args.templates:
+		wanted = args.templates.split(",")
+		missing = set(wanted) - set(t["name"] for t in templates)
+		if missing:
+			print("clips-factgen: unknown deftemplates %s" % ", ".join(sorted(missing)), file=sys.stderr)
+			sys.exit(2)
+		templates = [t for t in templates if t["name"] in wanted]
+
+	names = {}
+	for t in templates:
+		s = struct_name(t["name"])
+		if s in names:
+			print("clips-factgen: deftemplates %s and %s both map to struct %s"
+			      % (names[s], t["name"], s), file=sys.stderr)
+			sys.exit(3)
+		names[s] = t["name"]
+
+	sources = [os.path.basename(f) for f in args.clips_files]
+	write_if_changed(os.path.join(args.output_dir, args.basename + ".h"),
+	                 gen_header(templates, args.namespace, args.basename, sources), args.force)
+	write_if_changed(os.path.join(args.output_dir, args.basename + ".cpp"),
+	                 gen_source(templates, args.namespace, args.basename, args.include_prefix,
+	                            sources), args.force)
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,340 @@
+/***************************************************************************
+ *  events.cpp - typed subscribers to fact change events
+ *
+ *  Created: Wed Oct 21 09:52:44 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clips_replica/events.h>
+#include <clips_replica/publisher.h>
+
+#include <cerrno>
+#include <ctime>
+
+namespace clips_replica {
+
+/// @cond INTERNALS
+static bool
+values_equal(const CLIPS::Values &a, const CLIPS::Values &b)
+{
+	if (a.size() != b.size()) {
+		return false;
+	}
+	for (size_t i = 0; i < a.size(); ++i) {
+		if (a[i].type() != b[i].type()) {
+			return false;
+		}
+		switch (a[i].type()) {
+		case CLIPS::TYPE_FLOAT:
+			if (a[i].as_float() != b[i].as_float()) {
+				return false;
+			}
+			break;
+		case CLIPS::TYPE_INTEGER:
+			if (a[i].as_integer() != b[i].as_integer()) {
+				return false;
+			}
+			break;
+		case CLIPS::TYPE_SYMBOL:
+		case CLIPS::TYPE_STRING:
+		case CLIPS::TYPE_INSTANCE_NAME:
+			if (a[i].as_string() != b[i].as_string()) {
+				return false;
+			}
+			break;
+		default:
+			if (a[i].as_address() != b[i].as_address()) {
+				return false;
+			}
+			break;
+		}
+	}
+	return true;
+}
+/// @endcond
+
+/** @class FactEventSubscriber <clips_replica/events.h>
+ * Subscriber processing fact changes as typed events in its own thread.
+ * Observers of the fact base, e.g., to forward updates to clients or to
+ * record the history of machines, would otherwise need rules which match
+ * every fact of interest only to notice that it has changed. Instead, a
+ * subclass states the templates it is interested in and receives the
+ * events on their facts in fact_events().
+ *
+ * The publisher hands each batch to the subscriber in the thread of the
+ * CLIPS environment. The subscriber only appends a reference to the
+ * shared batch to a lock-free ring buffer and wakes up its thread, facts
+ * are neither copied nor filtered while the environment is locked. If the
+ * ring buffer is full, the batch is dropped and the publisher is asked to
+ * send the full fact base again. The subscriber then waits for that
+ * resynchronization, which starts with a CLEAR event, and drops all
+ * batches in between.
+ *
+ * CLIPS 6.3 implements modify as retraction of the old and assertion of a
+ * new fact. For templates added with key slots, a retracted and an
+ * asserted fact of the same batch are paired to a MODIFY event if the
+ * values of all key slots are equal, together with the positions of the
+ * slots that have changed. An empty list of key slots pairs any two facts
+ * of the template, which is meant for templates with a single fact.
+ *
+ * Templates must be added before the subscriber is started. A subclass
+ * must stop the subscriber before it is destroyed, the base class
+ * destructor cannot safely do so while the thread may still call
+ * fact_events().
+ *
+ * A subclass which must act some time after a batch, even if no further
+ * batch arrives, returns the time to wait from timeout_ms() and is then
+ * called on timeout().
+ * @author agent
+ */
+
+/** Constructor.
+ * @param publisher publisher to subscribe to when started
+ * @param capacity number of batches the ring buffer can hold
+ */
+FactEventSubscriber::FactEventSubscriber(FactChangePublisher *publisher, size_t capacity)
+: publisher_(publisher), ring_(capacity), overrun_(false), overruns_(0), running_(false)
+{
+	sem_init(&ready_, 0, 0);
+}
+
+/** Destructor. */
+FactEventSubscriber::~FactEventSubscriber()
+{
+	stop();
+	sem_destroy(&ready_);
+}
+
+/** Receive events on facts of a template.
+ * Modifications are reported as retraction and assertion.
+ * @param tmpl name of the template
+ */
+void
+FactEventSubscriber::add_template(const std::string &tmpl)
+{
+	templates_[tmpl] = TemplateSpec{false, {}};
+}
+
+/** Receive events on facts of a template, pairing modifications.
+ * @param tmpl name of the template
+ * @param key_slots slots identifying a fact across modifications, e.g.,
+ * the name of a machine, empty if the template has a single fact
+ */
+void
+FactEventSubscriber::add_template(const std::string &             tmpl,
+                                  const std::vector<std::string> &key_slots)
+{
+	templates_[tmpl] = TemplateSpec{true, key_slots};
+}
+
+/** Start the thread and subscribe to the publisher.
+ * The first events are a CLEAR and the assertions of all current facts.
+ */
+void
+FactEventSubscriber::start()
+{
+	if (running_) {
+		return;
+	}
+	running_ = true;
+	thread_  = std::thread(&FactEventSubscriber::loop, this);
+	publisher_->subscribe(this);
+}
+
+/** Unsubscribe from the publisher and stop the thread.
+ * Batches queued before are still processed.
+ */
+void
+FactEventSubscriber::stop()
+{
+	if (!running_) {
+		return;
+	}
+	publisher_->unsubscribe(this);
+	running_ = false;
+	sem_post(&ready_);
+	thread_.join();
+	overrun_ = false;
+}
+
+/** Get number of overruns.
+ * @return number of times a batch was dropped because the subscriber
+ * could not keep up
+ */
+uint64_t
+FactEventSubscriber::overruns() const
+{
+	return overruns_;
+}
+
+/** Queue a batch of changes, called by the publisher.
+ * @param batch changes to process
+ */
+void
+FactEventSubscriber::fact_changes(const std::shared_ptr<const FactChangeBatch> &batch)
+{
+	if (overrun_ && (batch->empty() || batch->front().kind != FactChange::CLEAR)) {
+		return;
+	}
+	std::shared_ptr<const FactChangeBatch> item(batch);
+	if (!ring_.push(std::move(item))) {
+		overrun_ = true;
+		overruns_ += 1;
+		publisher_->resync();
+		return;
+	}
+	overrun_ = false;
+	sem_post(&ready_);
+}
+
+/** Get the time to wait for the next batch.
+ * Called in the thread of the subscriber before waiting. The default
+ * implementation waits without a timeout.
+ * @return time in milliseconds after which timeout() is called if no
+ * batch arrives, negative to wait without a timeout
+ */
+long int
+FactEventSubscriber::timeout_ms()
+{
+	return -1;
+}
+
+/** Called if no batch arrived in time.
+ * Called in the thread of the subscriber if no batch arrived within the
+ * time returned by timeout_ms(). The default implementation does nothing.
+ */
+void
+FactEventSubscriber::timeout()
+{
+}
+
+void
+FactEventSubscriber::loop()
+{
+	std::shared_ptr<const FactChangeBatch> batch;
+	while (true) {
+		long int wait_ms = timeout_ms();
+		if (wait_ms < 0) {
+			while (sem_wait(&ready_) != 0 && errno == EINTR) {
+			}
+		} else {
+			struct timespec until;
+			clock_gettime(CLOCK_REALTIME, &until);
+			until.tv_sec += wait_ms / 1000;
+			until.tv_nsec += (wait_ms % 1000) * 1000000L;
+			if (until.tv_nsec >= 1000000000L) {
+				until.tv_sec += 1;
+				until.tv_nsec -= 1000000000L;
+			}
+			int rv;
+			while ((rv = sem_timedwait(&ready_, &until)) != 0 && errno == EINTR) {
+			}
+			if (rv != 0) {
+				timeout();
+				continue;
+			}
+		}
+		while (ring_.pop(batch)) {
+			process(*batch);
+			batch.reset();
+		}
+		if (!running_) {
+			break;
+		}
+	}
+}
+
+bool
+FactEventSubscriber::same_key(const TemplateSpec &spec,
+                              const FactSnapshot &a,
+                              const FactSnapshot &b) const
+{
+	for (const std::string &slot : spec.key_slots) {
+		if (!a.has_slot(slot) || !b.has_slot(slot)
+		    || !values_equal(a.slot_value(slot), b.slot_value(slot))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void
+FactEventSubscriber::process(const FactChangeBatch &batch)
+{
+	std::vector<FactEvent> events;
+	std::vector<FactEvent> retracted;
+	std::vector<FactEvent> asserted;
+
+	// the publisher orders all retractions before the assertions, hence the
+	// old fact of a modification has always been seen when the new arrives
+	for (const FactChange &c : batch) {
+		if (c.kind == FactChange::CLEAR) {
+			events.push_back(FactEvent{FactEvent::CLEAR, c.seq, nullptr, nullptr, {}});
+			continue;
+		}
+		auto t = templates_.find(c.fact->template_name());
+		if (t == templates_.end()) {
+			continue;
+		}
+		if (c.kind == FactChange::RETRACT) {
+			retracted.push_back(FactEvent{FactEvent::RETRACT, c.seq, c.fact, nullptr, {}});
+			continue;
+		}
+
+		FactEvent e{FactEvent::ASSERT, c.seq, c.fact, nullptr, {}};
+		if (t->second.pair) {
+			for (auto r = retracted.begin(); r != retracted.end(); ++r) {
+				if (r->fact->template_name() == t->first && same_key(t->second, *r->fact, *c.fact)) {
+					const std::vector<CLIPS::Values> &old_values = r->fact->values();
+					const std::vector<CLIPS::Values> &new_values = c.fact->values();
+					for (unsigned int i = 0; i < new_values.size(); ++i) {
+						if (i >= old_values.size() || !values_equal(old_values[i], new_values[i])) {
+							e.changed_slots.push_back(i);
+						}
+					}
+					e.kind     = FactEvent::MODIFY;
+					e.old_fact = r->fact;
+					retracted.erase(r);
+					break;
+				}
+			}
+		}
+		asserted.push_back(std::move(e));
+	}
+
+	events.insert(events.end(), retracted.begin(), retracted.end());
+	events.insert(events.end(), asserted.begin(), asserted.end());
+	if (!events.empty()) {
+		fact_events(events);
+	}
+}
+
+} // end namespace clips_replica
@@ -0,0 +1,126 @@
+/***************************************************************************
+ *  events.h - typed subscribers to fact change events
+ *
+ *  Created: Wed Oct 21 09:52:44 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CLIPS_REPLICA_EVENTS_H_
+#define __CLIPS_REPLICA_EVENTS_H_
+
+#include <clips_replica/fact_changes.h>
+#include <clips_replica/ring_buffer.h>
+
+#include <atomic>
+#include <map>
+#include <semaphore.h>
+#include <thread>
+
+namespace clips_replica {
+
+class FactChangePublisher;
+
+/** A change of a fact as seen by a FactEventSubscriber. */
+struct FactEvent
+{
+	/** Kind of event. */
+	typedef enum {
+		ASSERT,  ///< the fact has been asserted
+		RETRACT, ///< the fact has been retracted
+		MODIFY,  ///< the fact has been replaced by one with the same key
+		CLEAR    ///< all facts have been removed, e.g., on reset
+	} Kind;
+
+	Kind     kind; ///< kind of event
+	uint64_t seq;  ///< sequence number of the underlying change
+	/** Asserted, retracted, or for MODIFY the new fact, NULL for CLEAR. */
+	std::shared_ptr<const FactSnapshot> fact;
+	/** Fact replaced by a MODIFY, NULL for all other kinds. */
+	std::shared_ptr<const FactSnapshot> old_fact;
+	/** Positions of the slots whose values differ for MODIFY. */
+	std::vector<unsigned int> changed_slots;
+};
+
+class FactEventSubscriber : public FactChangeSubscriber
+{
+public:
+	FactEventSubscriber(FactChangePublisher *publisher, size_t capacity = 1024);
+	virtual ~FactEventSubscriber();
+
+	void add_template(const std::string &tmpl);
+	void add_template(const std::string &tmpl, const std::vector<std::string> &key_slots);
+
+	void start();
+	void stop();
+
+	uint64_t overruns() const;
+
+	virtual void fact_changes(const std::shared_ptr<const FactChangeBatch> &batch);
+
+protected:
+	/** Receive the events of one batch of changes.
+	 * Called in the thread of the subscriber with the events on the
+	 * templates added to the subscriber, CLEAR first, then retractions,
+	 * then assertions and modifications.
+	 * @param events events to process, never empty
+	 */
+	virtual void fact_events(const std::vector<FactEvent> &events) = 0;
+
+	virtual long int timeout_ms();
+	virtual void     timeout();
+
+private:
+	/// @cond INTERNALS
+	struct TemplateSpec
+	{
+		bool                     pair;
+		std::vector<std::string> key_slots;
+	};
+	/// @endcond
+
+	void loop();
+	void process(const FactChangeBatch &batch);
+	bool same_key(const TemplateSpec &spec, const FactSnapshot &a, const FactSnapshot &b) const;
+
+	FactChangePublisher *               publisher_;
+	std::map<std::string, TemplateSpec> templates_;
+
+	RingBuffer<std::shared_ptr<const FactChangeBatch>> ring_;
+	sem_t                                              ready_;
+	bool                                               overrun_;
+	std::atomic<uint64_t>                              overruns_;
+	std::atomic<bool>                                  running_;
+	std::thread                                        thread_;
+};
+
+} // end namespace clips_replica
+
+#endif
@@ -0,0 +1,233 @@
+/***************************************************************************
+ *  fact_archive.cpp - binary encoding of fact snapshots
+ *
+ *  Created: Thu Oct 22 11:02:09 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clips_replica/fact_archive.h>
+#include <core/exception.h>
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+
+namespace clips_replica {
+
+/// @cond INTERNALS
+static const uint32_t ARCHIVE_VERSION = 1;
+
+template <typename T>
+static void
+put(std::string &data, T value)
+{
+	data.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+static void
+put_string(std::string &data, const std::string &s)
+{
+	put<uint32_t>(data, s.size());
+	data.append(s);
+}
+
+class ArchiveReader
+{
+public:
+	ArchiveReader(const std::string &data) : data_(data), pos_(0)
+	{
+	}
+
+	template <typename T>
+	T
+	get()
+	{
+		T value;
+		memcpy(&value, need(sizeof(T)), sizeof(T));
+		return value;
+	}
+
+	std::string
+	get_string()
+	{
+		uint32_t size = get<uint32_t>();
+		return std::string(need(size), size);
+	}
+
+	bool
+	at_end() const
+	{
+		return pos_ == data_.size();
+	}
+
+private:
+	const char *
+	need(size_t size)
+	{
+		if (size > data_.size() - pos_) {
+			throw fawkes::Exception("Fact archive is truncated at offset %zu", pos_);
+		}
+		const char *p = data_.data() + pos_;
+		pos_ += size;
+		return p;
+	}
+
+	const std::string &data_;
+	size_t             pos_;
+};
+/// @endcond
+
+/** Encode facts.
+ * The encoding stores the templates of the facts once, followed by the
+ * fact indexes and slot values in native byte order. Symbols, strings,
+ * and numbers are kept, addresses cannot be restored and are stored as
+ * nil.
+ * @param facts facts to encode, they are decoded in the same order
+ * @param data upon return contains the encoded facts
+ */
+void
+encode_facts(const std::vector<std::shared_ptr<const FactSnapshot>> &facts, std::string &data)
+{
+	std::map<std::string, uint32_t>                  template_ids;
+	std::vector<std::shared_ptr<const FactSnapshot>> template_facts;
+	for (const auto &f : facts) {
+		if (template_ids.emplace(f->template_name(), template_facts.size()).second) {
+			template_facts.push_back(f);
+		}
+	}
+
+	data.clear();
+	put<uint32_t>(data, ARCHIVE_VERSION);
+	put<uint32_t>(data, template_facts.size());
+	for (const auto &f : template_facts) {
+		put_string(data, f->template_name());
+		put<uint32_t>(data, f->slot_names().size());
+		for (const std::string &s : f->slot_names()) {
+			put_string(data, s);
+			put<uint8_t>(data, f->is_multifield_slot(s));
+		}
+	}
+
+	put<uint32_t>(data, facts.size());
+	for (const auto &f : facts) {
+		put<uint32_t>(data, template_ids[f->template_name()]);
+		put<int64_t>(data, f->index());
+		for (const CLIPS::Values &values : f->values()) {
+			put<uint32_t>(data, values.size());
+			for (const CLIPS::Value &v : values) {
+				switch (v.type()) {
+				case CLIPS::TYPE_FLOAT:
+					put<uint8_t>(data, CLIPS::TYPE_FLOAT);
+					put<double>(data, v.as_float());
+					break;
+				case CLIPS::TYPE_INTEGER:
+					put<uint8_t>(data, CLIPS::TYPE_INTEGER);
+					put<int64_t>(data, v.as_integer());
+					break;
+				case CLIPS::TYPE_SYMBOL:
+				case CLIPS::TYPE_STRING:
+				case CLIPS::TYPE_INSTANCE_NAME:
+					put<uint8_t>(data, v.type());
+					put_string(data, v.as_string());
+					break;
+				default:
+					put<uint8_t>(data, CLIPS::TYPE_SYMBOL);
+					put_string(data, "nil");
+					break;
+				}
+			}
+		}
+	}
+}
+
+/** Decode facts.
+ * @param data facts encoded by encode_facts()
+ * @param facts upon return contains the decoded facts
+ * @exception Exception thrown if the data is truncated or invalid
+ */
+void
+decode_facts(const std::string &data, std::vector<std::shared_ptr<const FactSnapshot>> &facts)
+{
+	ArchiveReader reader(data);
+	uint32_t      version = reader.get<uint32_t>();
+	if (version != ARCHIVE_VERSION) {
+		throw fawkes::Exception("Unsupported fact archive version %u", version);
+	}
+
+	std::vector<std::shared_ptr<const FactTemplate>> templates(reader.get<uint32_t>());
+	for (auto &t : templates) {
+		auto tmpl        = std::make_shared<FactTemplate>();
+		tmpl->name       = reader.get_string();
+		uint32_t n_slots = reader.get<uint32_t>();
+		for (uint32_t i = 0; i < n_slots; ++i) {
+			tmpl->slot_names.push_back(reader.get_string());
+			tmpl->multifield.push_back(reader.get<uint8_t>() != 0);
+		}
+		t = tmpl;
+	}
+
+	uint32_t n_facts = reader.get<uint32_t>();
+	facts.clear();
+	facts.reserve(n_facts);
+	for (uint32_t f = 0; f < n_facts; ++f) {
+		uint32_t template_id = reader.get<uint32_t>();
+		if (template_id >= templates.size()) {
+			throw fawkes::Exception("Invalid template %u in fact archive", template_id);
+		}
+		int64_t                    index = reader.get<int64_t>();
+		std::vector<CLIPS::Values> values(templates[template_id]->slot_names.size());
+		for (CLIPS::Values &slot_values : values) {
+			uint32_t n_values = reader.get<uint32_t>();
+			for (uint32_t i = 0; i < n_values; ++i) {
+				uint8_t type = reader.get<uint8_t>();
+				switch (type) {
+				case CLIPS::TYPE_FLOAT: slot_values.push_back(CLIPS::Value(reader.get<double>())); break;
+				case CLIPS::TYPE_INTEGER:
+					slot_values.push_back(CLIPS::Value((long long int)reader.get<int64_t>()));
+					break;
+				case CLIPS::TYPE_SYMBOL:
+				case CLIPS::TYPE_STRING:
+				case CLIPS::TYPE_INSTANCE_NAME:
+					slot_values.push_back(CLIPS::Value(reader.get_string(), (CLIPS::Type)type));
+					break;
+				default: throw fawkes::Exception("Invalid value type %u in fact archive", type);
+				}
+			}
+		}
+		facts.push_back(
+		  std::make_shared<FactSnapshot>(index, templates[template_id], std::move(values)));
+	}
+	if (!reader.at_end()) {
+		throw fawkes::Exception("Fact archive has trailing data");
+	}
+}
+
+} // end namespace clips_replica
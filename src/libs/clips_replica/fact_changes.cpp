@@ -0,0 +1,217 @@
+/***************************************************************************
+ *  fact_changes.cpp - changes of the facts of a CLIPS environment
+ *
+ *  Created: Tue Oct 20 10:02:11 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clips_replica/fact_changes.h>
+#include <core/exception.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace clips_replica {
+
+/** @class FactSnapshot <clips_replica/fact_changes.h>
+ * Copy of a CLIPS fact.
+ * The snapshot holds the slot values of the fact at the time it was
+ * asserted. Facts cannot change in CLIPS 6.3, modifying a fact retracts
+ * it and asserts a new one, hence a snapshot stays valid for the lifetime
+ * of the fact. It is independent of the environment and may be shared
+ * among threads.
+ * @author agent
+ */
+
+/** Constructor.
+ * @param index fact index
+ * @param tmpl template of the fact
+ * @param values values of the slots, in the order of the template slots
+ */
+FactSnapshot::FactSnapshot(long int                            index,
+                           std::shared_ptr<const FactTemplate> tmpl,
+                           std::vector<CLIPS::Values> &&       values)
+: index_(index), template_(tmpl), values_(std::move(values))
+{
+}
+
+/** Get fact index.
+ * @return fact index
+ */
+long int
+FactSnapshot::index() const
+{
+	return index_;
+}
+
+/** Get name of the template.
+ * @return name of the template of the fact
+ */
+const std::string &
+FactSnapshot::template_name() const
+{
+	return template_->name;
+}
+
+/** Get slot names.
+ * @return names of the slots of the fact
+ */
+const std::vector<std::string> &
+FactSnapshot::slot_names() const
+{
+	return template_->slot_names;
+}
+
+int
+FactSnapshot::slot_position(const std::string &slot) const
+{
+	for (size_t i = 0; i < template_->slot_names.size(); ++i) {
+		if (template_->slot_names[i] == slot) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+/** Check if the fact has a slot.
+ * @param slot name of the slot
+ * @return true if the template of the fact has the slot
+ */
+bool
+FactSnapshot::has_slot(const std::string &slot) const
+{
+	return slot_position(slot) >= 0;
+}
+
+/** Check if a slot is a multi-field slot.
+ * @param slot name of the slot
+ * @return true if the slot is a multi-field slot
+ */
+bool
+FactSnapshot::is_multifield_slot(const std::string &slot) const
+{
+	int pos = slot_position(slot);
+	return pos >= 0 && template_->multifield[pos];
+}
+
+/** Get values of a slot.
+ * @param slot name of the slot
+ * @return values of the slot
+ * @exception Exception thrown if the fact has no such slot
+ */
+const CLIPS::Values &
+FactSnapshot::slot_value(const std::string &slot) const
+{
+	int pos = slot_position(slot);
+	if (pos < 0) {
+		throw fawkes::Exception("Fact %li of template %s has no slot %s",
+		                        index_,
+		                        template_->name.c_str(),
+		                        slot.c_str());
+	}
+	return values_[pos];
+}
+
+/** Get values of all slots.
+ * @return values of the slots, in the order of slot_names()
+ */
+const std::vector<CLIPS::Values> &
+FactSnapshot::values() const
+{
+	return values_;
+}
+
+/// @cond INTERNALS
+static void
+append_value(std::string &s, const CLIPS::Value &v)
+{
+	char tmp[32];
+	switch (v.type()) {
+	case CLIPS::TYPE_FLOAT: {
+		// like CLIPS, always print a decimal point
+		double d = v.as_float();
+		snprintf(tmp, sizeof(tmp), "%.15g", d);
+		s += tmp;
+		if (std::isfinite(d) && !strpbrk(tmp, ".e")) {
+			s += ".0";
+		}
+		break;
+	}
+	case CLIPS::TYPE_INTEGER: s += std::to_string(v.as_integer()); break;
+	case CLIPS::TYPE_STRING: {
+		s += '"';
+		for (char c : v.as_string()) {
+			if (c == '"' || c == '\\') {
+				s += '\\';
+			}
+			s += c;
+		}
+		s += '"';
+		break;
+	}
+	case CLIPS::TYPE_SYMBOL: s += v.as_string(); break;
+	case CLIPS::TYPE_INSTANCE_NAME: s += "[" + v.as_string() + "]"; break;
+	default: s += "<Pointer>"; break;
+	}
+}
+/// @endcond
+
+/** Get the fact as string.
+ * @return fact formatted as printed by CLIPS, e.g., (order (id 1) (active TRUE))
+ */
+std::string
+FactSnapshot::to_string() const
+{
+	std::string s = "(" + template_->name;
+	for (size_t i = 0; i < values_.size(); ++i) {
+		s += " (" + template_->slot_names[i];
+		for (const CLIPS::Value &v : values_[i]) {
+			s += " ";
+			append_value(s, v);
+		}
+		s += ")";
+	}
+	s += ")";
+	return s;
+}
+
+/** @class FactChangeSubscriber <clips_replica/fact_changes.h>
+ * Interface to receive the changes published by a FactChangePublisher.
+ * @author agent
+ */
+
+/** Virtual empty destructor. */
+FactChangeSubscriber::~FactChangeSubscriber()
+{
+}
+
+} // end namespace clips_replica
@@ -0,0 +1,116 @@
+/***************************************************************************
+ *  fact_changes.h - changes of the facts of a CLIPS environment
+ *
+ *  Created: Tue Oct 20 10:02:11 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CLIPS_REPLICA_FACT_CHANGES_H_
+#define __CLIPS_REPLICA_FACT_CHANGES_H_
+
+#include <clipsmm.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace clips_replica {
+
+/** Description of a deftemplate, shared by the snapshots of its facts. */
+struct FactTemplate
+{
+	std::string              name;       ///< name of the template
+	std::vector<std::string> slot_names; ///< names of the slots
+	std::vector<bool>        multifield; ///< true for each multi-field slot
+};
+
+class FactSnapshot
+{
+public:
+	FactSnapshot(long int                            index,
+	             std::shared_ptr<const FactTemplate> tmpl,
+	             std::vector<CLIPS::Values> &&       values);
+
+	long int                        index() const;
+	const std::string &             template_name() const;
+	const std::vector<std::string> &slot_names() const;
+
+	bool                 has_slot(const std::string &slot) const;
+	bool                 is_multifield_slot(const std::string &slot) const;
+	const CLIPS::Values &slot_value(const std::string &slot) const;
+
+	const std::vector<CLIPS::Values> &values() const;
+
+	std::string to_string() const;
+
+private:
+	int slot_position(const std::string &slot) const;
+
+	long int                            index_;
+	std::shared_ptr<const FactTemplate> template_;
+	std::vector<CLIPS::Values>          values_;
+};
+
+/** A change of the fact base. */
+struct FactChange
+{
+	/** Kind of change. */
+	typedef enum {
+		ASSERT,  ///< the fact has been asserted
+		RETRACT, ///< the fact has been retracted
+		CLEAR    ///< all facts have been removed, e.g., on reset
+	} Kind;
+
+	Kind     kind; ///< kind of change
+	uint64_t seq;  ///< sequence number, increasing with every change
+	/** Asserted or retracted fact, NULL for CLEAR. */
+	std::shared_ptr<const FactSnapshot> fact;
+};
+
+/** Changes published at once, in the order they are to be applied. */
+typedef std::vector<FactChange> FactChangeBatch;
+
+class FactChangeSubscriber
+{
+public:
+	virtual ~FactChangeSubscriber();
+
+	/** Receive a batch of changes.
+	 * Called by the publisher in the thread of the CLIPS environment,
+	 * implementations must return quickly and must not block.
+	 * @param batch changes to apply, shared among all subscribers
+	 */
+	virtual void fact_changes(const std::shared_ptr<const FactChangeBatch> &batch) = 0;
+};
+
+} // end namespace clips_replica
+
+#endif
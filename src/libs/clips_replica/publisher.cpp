@@ -0,0 +1,206 @@
+/***************************************************************************
+ *  publisher.cpp - publish the fact changes of a CLIPS environment
+ *
+ *  Created: Tue Oct 20 10:02:11 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clips_replica/publisher.h>
+
+extern "C" {
+#include <clips/clips.h>
+}
+
+namespace clips_replica {
+
+/** @class FactChangePublisher <clips_replica/publisher.h>
+ * Publish the changes of the fact base of a CLIPS environment.
+ * Consumers which only read facts, e.g., to report or visualize the
+ * state, should not lock the environment and thereby delay the rules.
+ * Instead, the publisher determines the facts asserted and retracted
+ * since the last call to publish() and passes them as an ordered batch of
+ * changes to all subscribers. A subscriber, like a FactReplica, maintains
+ * its own view of the facts from the changes in another thread.
+ *
+ * CLIPS 6.3 provides no notification for single facts. Therefore, the
+ * fact list is compared against the facts published last whenever it has
+ * changed. Fact indexes increase with every assertion, so a merge of both
+ * lists by index yields the changes. A modified fact appears as the
+ * retraction of the old and the assertion of a new fact, just like CLIPS
+ * implements it. Within a batch, all retractions come before assertions.
+ *
+ * A new subscriber first receives a CLEAR change followed by assertions of
+ * all facts, the same is sent to all subscribers after the environment
+ * has been reset or cleared. While there are no subscribers, nothing is
+ * published and no facts are copied.
+ * @author agent
+ */
+
+/** Constructor.
+ * @param env CLIPS environment to publish the changes of
+ */
+FactChangePublisher::FactChangePublisher(CLIPS::Environment *env)
+: env_(env), seq_(0), resync_(false)
+{
+	env_->signal_reset().connect(sigc::mem_fun(*this, &FactChangePublisher::reset));
+	env_->signal_clear().connect(sigc::mem_fun(*this, &FactChangePublisher::reset));
+}
+
+/** Destructor. */
+FactChangePublisher::~FactChangePublisher()
+{
+}
+
+/** Add a subscriber.
+ * The subscriber receives the full fact base with the next publish().
+ * @param subscriber subscriber to add, must be unsubscribed before it is
+ * destroyed
+ */
+void
+FactChangePublisher::subscribe(FactChangeSubscriber *subscriber)
+{
+	std::lock_guard<std::mutex> lock(subscribers_mutex_);
+	subscribers_.push_back(subscriber);
+	resync_ = true;
+}
+
+/** Remove a subscriber.
+ * @param subscriber subscriber to remove
+ */
+void
+FactChangePublisher::unsubscribe(FactChangeSubscriber *subscriber)
+{
+	std::lock_guard<std::mutex> lock(subscribers_mutex_);
+	subscribers_.remove(subscriber);
+}
+
+/** Send the full fact base to all subscribers with the next publish().
+ * May be called from any thread, including a subscriber while it is
+ * receiving a batch, e.g., after it had to drop changes.
+ */
+void
+FactChangePublisher::resync()
+{
+	resync_ = true;
+}
+
+void
+FactChangePublisher::reset()
+{
+	templates_.clear();
+	resync_ = true;
+}
+
+std::shared_ptr<const FactSnapshot>
+FactChangePublisher::snapshot(void *f)
+{
+	CLIPS::Fact::pointer     fact = CLIPS::Fact::create(*env_, f);
+	CLIPS::Template::pointer tmpl = fact->get_template();
+
+	std::shared_ptr<const FactTemplate> &fact_template = templates_[tmpl ? tmpl->name() : "implied"];
+	if (!fact_template) {
+		auto t        = std::make_shared<FactTemplate>();
+		t->name       = tmpl ? tmpl->name() : "implied";
+		t->slot_names = fact->slot_names();
+		for (const std::string &s : t->slot_names) {
+			t->multifield.push_back(tmpl ? tmpl->is_multifield_slot(s) : true);
+		}
+		fact_template = t;
+	}
+
+	std::vector<CLIPS::Values> values;
+	values.reserve(fact_template->slot_names.size());
+	for (const std::string &s : fact_template->slot_names) {
+		values.push_back(fact->slot_value(s));
+	}
+	return std::make_shared<FactSnapshot>(fact->index(), fact_template, std::move(values));
+}
+
+/** Publish the changes since the last call.
+ * Must be called from the thread running the environment, while it is
+ * locked, e.g., after each run of the rules.
+ */
+void
+FactChangePublisher::publish()
+{
+	void *env    = env_->cobj();
+	bool  resync = resync_.exchange(false);
+	if (!resync && !EnvGetFactListChanged(env)) {
+		return;
+	}
+	EnvSetFactListChanged(env, FALSE);
+	{
+		std::lock_guard<std::mutex> lock(subscribers_mutex_);
+		if (subscribers_.empty()) {
+			facts_.clear();
+			return;
+		}
+	}
+
+	auto batch = std::make_shared<FactChangeBatch>();
+	if (resync) {
+		batch->push_back(FactChange{FactChange::CLEAR, ++seq_, nullptr});
+		facts_.clear();
+	}
+
+	std::vector<std::shared_ptr<const FactSnapshot>> facts;
+	std::vector<std::shared_ptr<const FactSnapshot>> asserted;
+	facts.reserve(facts_.size());
+	size_t k = 0;
+	for (void *f = EnvGetNextFact(env, NULL); f; f = EnvGetNextFact(env, f)) {
+		long int index = EnvFactIndex(env, f);
+		for (; k < facts_.size() && facts_[k]->index() < index; ++k) {
+			batch->push_back(FactChange{FactChange::RETRACT, ++seq_, facts_[k]});
+		}
+		if (k < facts_.size() && facts_[k]->index() == index) {
+			facts.push_back(facts_[k++]);
+		} else {
+			asserted.push_back(snapshot(f));
+			facts.push_back(asserted.back());
+		}
+	}
+	for (; k < facts_.size(); ++k) {
+		batch->push_back(FactChange{FactChange::RETRACT, ++seq_, facts_[k]});
+	}
+	for (const auto &f : asserted) {
+		batch->push_back(FactChange{FactChange::ASSERT, ++seq_, f});
+	}
+	facts_ = std::move(facts);
+
+	if (!batch->empty()) {
+		std::lock_guard<std::mutex> lock(subscribers_mutex_);
+		for (FactChangeSubscriber *s : subscribers_) {
+			s->fact_changes(batch);
+		}
+	}
+}
+
+} // end namespace clips_replica
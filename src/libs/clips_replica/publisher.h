@@ -0,0 +1,78 @@
+/***************************************************************************
+ *  publisher.h - publish the fact changes of a CLIPS environment
+ *
+ *  Created: Tue Oct 20 10:02:11 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CLIPS_REPLICA_PUBLISHER_H_
+#define __CLIPS_REPLICA_PUBLISHER_H_
+
+#include <clips_replica/fact_changes.h>
+
+#include <atomic>
+#include <clipsmm.h>
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace clips_replica {
+
+class FactChangePublisher : public sigc::trackable
+{
+public:
+	FactChangePublisher(CLIPS::Environment *env);
+	~FactChangePublisher();
+
+	void publish();
+	void resync();
+
+	void subscribe(FactChangeSubscriber *subscriber);
+	void unsubscribe(FactChangeSubscriber *subscriber);
+
+private:
+	void                                reset();
+	std::shared_ptr<const FactSnapshot> snapshot(void *fact);
+
+	CLIPS::Environment *env_;
+
+	uint64_t                                                   seq_;
+	std::atomic<bool>                                          resync_;
+	std::vector<std::shared_ptr<const FactSnapshot>>           facts_;
+	std::map<std::string, std::shared_ptr<const FactTemplate>> templates_;
+
+	std::mutex                        subscribers_mutex_;
+	std::list<FactChangeSubscriber *> subscribers_;
+};
+
+} // end namespace clips_replica
+
+#endif
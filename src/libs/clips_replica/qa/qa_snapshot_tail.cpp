@@ -0,0 +1,129 @@
+/***************************************************************************
+ *  qa_snapshot_tail.cpp - follow the snapshots in a snapshot file
+ *
+ *  Created: Thu Oct 22 15:40:12 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Follow the snapshots written to a snapshot file, like a standby process
+// would, and report the time to read and decode each of them.
+
+#include <clips_replica/fact_archive.h>
+#include <clips_replica/snapshot_file.h>
+#include <core/exception.h>
+#include <utils/system/argparser.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <sys/time.h>
+#include <thread>
+
+using namespace clips_replica;
+using namespace fawkes;
+
+/// @cond QA
+
+typedef std::chrono::steady_clock Clock;
+
+static void
+usage(const char *progname)
+{
+	printf("Usage: %s [-i MS] [-n NUM] [-v] FILE\n"
+	       " -i MS   poll interval, default 100\n"
+	       " -n NUM  exit after NUM snapshots, default 0 to follow forever\n"
+	       " -v      print the facts of each snapshot\n",
+	       progname);
+}
+
+int
+main(int argc, char **argv)
+{
+	ArgumentParser argp(argc, argv, "hi:n:v");
+	if (argp.has_arg("h") || argp.num_items() != 1) {
+		usage(argv[0]);
+		exit(argp.has_arg("h") ? 0 : 1);
+	}
+	unsigned int interval = argp.has_arg("i") ? argp.parse_int("i") : 100;
+	unsigned int num      = argp.has_arg("n") ? argp.parse_int("n") : 0;
+	bool         verbose  = argp.has_arg("v");
+
+	try {
+		SnapshotFile                                     file(argp.items()[0], false);
+		std::string                                      data;
+		std::vector<std::shared_ptr<const FactSnapshot>> facts;
+		uint64_t                                         last_seq = 0;
+		for (unsigned int n = 0; num == 0 || n < num;) {
+			uint64_t          seq;
+			int64_t           stamp_usec;
+			Clock::time_point start = Clock::now();
+			if (file.sequence() == last_seq || !file.read(data, &seq, &stamp_usec)) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+				continue;
+			}
+			decode_facts(data, facts);
+			double read_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+			struct timeval now;
+			gettimeofday(&now, NULL);
+			int64_t age_usec = (int64_t)now.tv_sec * 1000000 + now.tv_usec - stamp_usec;
+
+			std::map<std::string, unsigned int> counts;
+			for (const auto &f : facts) {
+				counts[f->template_name()] += 1;
+			}
+			printf("snapshot %lu: %zu bytes, %zu facts, age %.1f ms, read %.2f ms\n ",
+			       (unsigned long)seq,
+			       data.size(),
+			       facts.size(),
+			       age_usec / 1000.,
+			       read_ms);
+			for (const auto &c : counts) {
+				printf(" %s=%u", c.first.c_str(), c.second);
+			}
+			printf("\n");
+			if (verbose) {
+				for (const auto &f : facts) {
+					printf("  %s\n", f->to_string().c_str());
+				}
+			}
+			last_seq = seq;
+			++n;
+		}
+	} catch (Exception &e) {
+		printf("Failed to read snapshots: %s\n", e.what_no_backtrace());
+		return 1;
+	}
+	return 0;
+}
+
+/// @endcond
@@ -0,0 +1,167 @@
+/***************************************************************************
+ *  replica.cpp - replica of the facts of a CLIPS environment
+ *
+ *  Created: Tue Oct 20 10:02:11 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clips_replica/replica.h>
+
+namespace clips_replica {
+
+/** @class FactReplica <clips_replica/replica.h>
+ * Replica of the fact base of a CLIPS environment.
+ * The replica subscribes to a FactChangePublisher and applies the batches
+ * of changes in its own thread. Readers only lock the replica, never the
+ * environment, and receive the facts as immutable snapshots which remain
+ * valid after the replica has changed. The view lags behind the
+ * environment by at most one run of the rules plus the time to apply the
+ * changes.
+ * @author agent
+ */
+
+/** Constructor. */
+FactReplica::FactReplica() : shutdown_(false), revision_(0)
+{
+	thread_ = std::thread(&FactReplica::loop, this);
+}
+
+/** Destructor.
+ * The replica must have been unsubscribed from the publisher.
+ */
+FactReplica::~FactReplica()
+{
+	{
+		std::lock_guard<std::mutex> lock(queue_mutex_);
+		shutdown_ = true;
+	}
+	queue_cond_.notify_all();
+	thread_.join();
+}
+
+/** Queue a batch of changes to be applied.
+ * @param batch changes to apply
+ */
+void
+FactReplica::fact_changes(const std::shared_ptr<const FactChangeBatch> &batch)
+{
+	{
+		std::lock_guard<std::mutex> lock(queue_mutex_);
+		queue_.push_back(batch);
+	}
+	queue_cond_.notify_one();
+}
+
+void
+FactReplica::loop()
+{
+	std::unique_lock<std::mutex> lock(queue_mutex_);
+	while (true) {
+		queue_cond_.wait(lock, [this] { return shutdown_ || !queue_.empty(); });
+		if (shutdown_) {
+			return;
+		}
+		std::shared_ptr<const FactChangeBatch> batch = queue_.front();
+		queue_.pop_front();
+		lock.unlock();
+		apply(*batch);
+		lock.lock();
+	}
+}
+
+void
+FactReplica::apply(const FactChangeBatch &batch)
+{
+	std::lock_guard<std::mutex> lock(facts_mutex_);
+	for (const FactChange &c : batch) {
+		switch (c.kind) {
+		case FactChange::ASSERT:
+			facts_[c.fact->index()]                              = c.fact;
+			templates_[c.fact->template_name()][c.fact->index()] = c.fact;
+			break;
+		case FactChange::RETRACT:
+			facts_.erase(c.fact->index());
+			templates_[c.fact->template_name()].erase(c.fact->index());
+			break;
+		case FactChange::CLEAR:
+			facts_.clear();
+			templates_.clear();
+			break;
+		}
+		revision_ = c.seq;
+	}
+}
+
+/** Get revision of the replica.
+ * @return sequence number of the last change that has been applied, it
+ * changes whenever the facts change
+ */
+uint64_t
+FactReplica::revision() const
+{
+	return revision_;
+}
+
+/** Get all facts.
+ * @return facts ordered by fact index
+ */
+std::vector<std::shared_ptr<const FactSnapshot>>
+FactReplica::facts()
+{
+	std::lock_guard<std::mutex>                      lock(facts_mutex_);
+	std::vector<std::shared_ptr<const FactSnapshot>> rv;
+	rv.reserve(facts_.size());
+	for (const auto &f : facts_) {
+		rv.push_back(f.second);
+	}
+	return rv;
+}
+
+/** Get facts of a template.
+ * @param tmpl name of the template
+ * @return facts of the template ordered by fact index
+ */
+std::vector<std::shared_ptr<const FactSnapshot>>
+FactReplica::facts(const std::string &tmpl)
+{
+	std::lock_guard<std::mutex>                      lock(facts_mutex_);
+	std::vector<std::shared_ptr<const FactSnapshot>> rv;
+	auto                                             t = templates_.find(tmpl);
+	if (t != templates_.end()) {
+		rv.reserve(t->second.size());
+		for (const auto &f : t->second) {
+			rv.push_back(f.second);
+		}
+	}
+	return rv;
+}
+
+} // end namespace clips_replica
@@ -0,0 +1,84 @@
+/***************************************************************************
+ *  replica.h - replica of the facts of a CLIPS environment
+ *
+ *  Created: Tue Oct 20 10:02:11 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CLIPS_REPLICA_REPLICA_H_
+#define __CLIPS_REPLICA_REPLICA_H_
+
+#include <clips_replica/fact_changes.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace clips_replica {
+
+class FactReplica : public FactChangeSubscriber
+{
+public:
+	FactReplica();
+	virtual ~FactReplica();
+
+	virtual void fact_changes(const std::shared_ptr<const FactChangeBatch> &batch);
+
+	uint64_t revision() const;
+
+	std::vector<std::shared_ptr<const FactSnapshot>> facts();
+	std::vector<std::shared_ptr<const FactSnapshot>> facts(const std::string &tmpl);
+
+private:
+	typedef std::map<long int, std::shared_ptr<const FactSnapshot>> FactMap;
+
+	void loop();
+	void apply(const FactChangeBatch &batch);
+
+	std::mutex                                         queue_mutex_;
+	std::condition_variable                            queue_cond_;
+	std::deque<std::shared_ptr<const FactChangeBatch>> queue_;
+	bool                                               shutdown_;
+
+	std::mutex                     facts_mutex_;
+	FactMap                        facts_;
+	std::map<std::string, FactMap> templates_;
+	std::atomic<uint64_t>          revision_;
+
+	std::thread thread_;
+};
+
+} // end namespace clips_replica
+
+#endif
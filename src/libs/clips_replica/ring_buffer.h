@@ -0,0 +1,133 @@
+/***************************************************************************
+ *  ring_buffer.h - lock-free single producer single consumer queue
+ *
+ *  Created: Wed Oct 21 09:40:18 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CLIPS_REPLICA_RING_BUFFER_H_
+#define __CLIPS_REPLICA_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace clips_replica {
+
+/** Lock-free queue of fixed capacity for one producer and one consumer.
+ * The producer never waits for the consumer, push() fails instead if the
+ * queue is full. Each of push() and pop() must only be called by a single
+ * thread at a time, which may be a different thread for each.
+ */
+template <typename T>
+class RingBuffer
+{
+public:
+	/** Constructor.
+	 * @param capacity minimum number of items the queue can hold, rounded up
+	 * to the next power of two
+	 */
+	explicit RingBuffer(size_t capacity) : head_(0), tail_(0)
+	{
+		size_t size = 2;
+		while (size < capacity) {
+			size *= 2;
+		}
+		slots_.resize(size);
+		mask_ = size - 1;
+	}
+
+	/** Get capacity.
+	 * @return number of items the queue can hold
+	 */
+	size_t
+	capacity() const
+	{
+		return slots_.size();
+	}
+
+	/** Check if the queue is empty.
+	 * Only reliable when called by the consumer.
+	 * @return true if the queue is empty
+	 */
+	bool
+	empty() const
+	{
+		return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+	}
+
+	/** Append an item, called by the producer.
+	 * @param item item to move into the queue
+	 * @return true if the item has been queued, false if the queue is full,
+	 * the item is left untouched in that case
+	 */
+	bool
+	push(T &&item)
+	{
+		size_t tail = tail_.load(std::memory_order_relaxed);
+		if (tail - head_.load(std::memory_order_acquire) == slots_.size()) {
+			return false;
+		}
+		slots_[tail & mask_] = std::move(item);
+		tail_.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** Remove the oldest item, called by the consumer.
+	 * @param item upon return contains the oldest item
+	 * @return true if an item has been removed, false if the queue is empty
+	 */
+	bool
+	pop(T &item)
+	{
+		size_t head = head_.load(std::memory_order_relaxed);
+		if (head == tail_.load(std::memory_order_acquire)) {
+			return false;
+		}
+		item = std::move(slots_[head & mask_]);
+		slots_[head & mask_] = T();
+		head_.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+private:
+	std::vector<T> slots_;
+	size_t         mask_;
+	// producer and consumer each write one index, keep them on separate
+	// cache lines to avoid false sharing
+	alignas(64) std::atomic<size_t> head_;
+	alignas(64) std::atomic<size_t> tail_;
+};
+
+} // end namespace clips_replica
+
+#endif
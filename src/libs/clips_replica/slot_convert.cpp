@@ -0,0 +1,211 @@
+/***************************************************************************
+ *  slot_convert.cpp - convert slot values of fact snapshots
+ *
+ *  Created: Wed Oct 21 14:20:09 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clips_replica/slot_convert.h>
+#include <core/exception.h>
+
+namespace clips_replica {
+
+/// @cond INTERNALS
+static bool
+is_nil(const CLIPS::Value &v)
+{
+	return v.type() == CLIPS::TYPE_SYMBOL && v.as_string() == "nil";
+}
+
+static const CLIPS::Value &
+single_value(const CLIPS::Values &values, const char *slot)
+{
+	if (values.empty()) {
+		throw fawkes::Exception("No value for slot '%s'", slot);
+	}
+	return values[0];
+}
+
+static int64_t
+to_integer(const CLIPS::Value &v, const char *slot)
+{
+	switch (v.type()) {
+	case CLIPS::TYPE_INTEGER: return v.as_integer();
+	case CLIPS::TYPE_FLOAT: return static_cast<int64_t>(v.as_float());
+	default:
+		if (is_nil(v)) {
+			return 0;
+		}
+		throw fawkes::Exception("Value for slot '%s' is not a number", slot);
+	}
+}
+
+static double
+to_float(const CLIPS::Value &v, const char *slot)
+{
+	switch (v.type()) {
+	case CLIPS::TYPE_FLOAT: return v.as_float();
+	case CLIPS::TYPE_INTEGER: return static_cast<double>(v.as_integer());
+	default:
+		if (is_nil(v)) {
+			return 0.;
+		}
+		throw fawkes::Exception("Value for slot '%s' is not a number", slot);
+	}
+}
+
+static std::string
+to_string(const CLIPS::Value &v)
+{
+	switch (v.type()) {
+	case CLIPS::TYPE_FLOAT: return std::to_string(v.as_float());
+	case CLIPS::TYPE_INTEGER: return std::to_string(v.as_integer());
+	case CLIPS::TYPE_SYMBOL:
+	case CLIPS::TYPE_STRING:
+	case CLIPS::TYPE_INSTANCE_NAME: return v.as_string();
+	default: return "CANNOT-REPRESENT";
+	}
+}
+/// @endcond
+
+/** Convert the value of an integer slot.
+ * Floats are truncated, nil yields 0.
+ * @param values values of the slot
+ * @param slot name of the slot, for error messages
+ * @param value upon return contains the converted value
+ * @exception Exception thrown if the slot has no value or is not a number
+ */
+void
+convert_slot(const CLIPS::Values &values, const char *slot, int64_t &value)
+{
+	value = to_integer(single_value(values, slot), slot);
+}
+
+/** Convert the value of a float slot.
+ * Nil yields 0.
+ * @param values values of the slot
+ * @param slot name of the slot, for error messages
+ * @param value upon return contains the converted value
+ * @exception Exception thrown if the slot has no value or is not a number
+ */
+void
+convert_slot(const CLIPS::Values &values, const char *slot, double &value)
+{
+	value = to_float(single_value(values, slot), slot);
+}
+
+/** Convert the value of a boolean slot.
+ * @param values values of the slot
+ * @param slot name of the slot, for error messages
+ * @param value upon return is true if the value is the symbol TRUE
+ * @exception Exception thrown if the slot has no value or is not a symbol
+ */
+void
+convert_slot(const CLIPS::Values &values, const char *slot, bool &value)
+{
+	const CLIPS::Value &v = single_value(values, slot);
+	if (v.type() != CLIPS::TYPE_SYMBOL) {
+		throw fawkes::Exception("Value for slot '%s' is not a boolean", slot);
+	}
+	value = (v.as_string() == "TRUE");
+}
+
+/** Convert the value of a symbol or string slot.
+ * Nil yields the empty string, numbers are formatted.
+ * @param values values of the slot
+ * @param slot name of the slot, for error messages
+ * @param value upon return contains the converted value
+ * @exception Exception thrown if the slot has no value
+ */
+void
+convert_slot(const CLIPS::Values &values, const char *slot, std::string &value)
+{
+	const CLIPS::Value &v = single_value(values, slot);
+	value                 = is_nil(v) ? "" : to_string(v);
+}
+
+/** Convert the values of an integer multi-field slot.
+ * @param values values of the slot
+ * @param slot name of the slot, for error messages
+ * @param value upon return contains the converted values
+ * @exception Exception thrown if a value is not a number
+ */
+void
+convert_slot(const CLIPS::Values &values, const char *slot, std::vector<int64_t> &value)
+{
+	value.resize(values.size());
+	for (size_t i = 0; i < values.size(); ++i) {
+		value[i] = to_integer(values[i], slot);
+	}
+}
+
+/** Convert the values of a float multi-field slot.
+ * @param values values of the slot
+ * @param slot name of the slot, for error messages
+ * @param value upon return contains the converted values
+ * @exception Exception thrown if a value is not a number
+ */
+void
+convert_slot(const CLIPS::Values &values, const char *slot, std::vector<double> &value)
+{
+	value.resize(values.size());
+	for (size_t i = 0; i < values.size(); ++i) {
+		value[i] = to_float(values[i], slot);
+	}
+}
+
+/** Convert the values of a symbol or string multi-field slot.
+ * Numbers are formatted, nil is kept as is.
+ * @param values values of the slot
+ * @param slot name of the slot, for error messages
+ * @param value upon return contains the converted values
+ */
+void
+convert_slot(const CLIPS::Values &values, const char *slot, std::vector<std::string> &value)
+{
+	value.resize(values.size());
+	for (size_t i = 0; i < values.size(); ++i) {
+		value[i] = to_string(values[i]);
+	}
+}
+
+/** Copy the values of a slot without a single type.
+ * @param values values of the slot
+ * @param slot name of the slot, unused
+ * @param value upon return contains a copy of the values
+ */
+void
+convert_slot(const CLIPS::Values &values, const char *slot, CLIPS::Values &value)
+{
+	value = values;
+}
+
+} // end namespace clips_replica
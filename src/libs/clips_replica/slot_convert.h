@@ -0,0 +1,57 @@
+/***************************************************************************
+ *  slot_convert.h - convert slot values of fact snapshots
+ *
+ *  Created: Wed Oct 21 14:20:09 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CLIPS_REPLICA_SLOT_CONVERT_H_
+#define __CLIPS_REPLICA_SLOT_CONVERT_H_
+
+#include <clipsmm.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace clips_replica {
+
+void convert_slot(const CLIPS::Values &values, const char *slot, int64_t &value);
+void convert_slot(const CLIPS::Values &values, const char *slot, double &value);
+void convert_slot(const CLIPS::Values &values, const char *slot, bool &value);
+void convert_slot(const CLIPS::Values &values, const char *slot, std::string &value);
+void convert_slot(const CLIPS::Values &values, const char *slot, std::vector<int64_t> &value);
+void convert_slot(const CLIPS::Values &values, const char *slot, std::vector<double> &value);
+void convert_slot(const CLIPS::Values &values, const char *slot, std::vector<std::string> &value);
+void convert_slot(const CLIPS::Values &values, const char *slot, CLIPS::Values &value);
+
+} // end namespace clips_replica
+
+#endif
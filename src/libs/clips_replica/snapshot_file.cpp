@@ -0,0 +1,406 @@
+/***************************************************************************
+ *  snapshot_file.cpp - double-buffered snapshots in a memory-mapped file
+ *
+ *  Created: Thu Oct 22 10:14:31 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clips_replica/snapshot_file.h>
+#include <core/exception.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace clips_replica {
+
+/// @cond INTERNALS
+static const char   SNAPSHOT_MAGIC[8] = {'R', 'C', 'L', 'L', 'S', 'N', 'A', 'P'};
+static const size_t HEADER_SIZE       = 64;
+static const size_t INITIAL_CAPACITY  = 256 * 1024;
+static const int    SNAPSHOT_VERSION  = 1;
+
+struct SnapshotFile::FileHeader
+{
+	char     magic[8];
+	uint32_t version;
+	uint32_t reserved;
+	uint64_t capacity;
+};
+
+struct SnapshotFile::SlotHeader
+{
+	uint64_t seq; // 0 while the slot is being written
+	uint64_t size;
+	int64_t  stamp_usec;
+	uint32_t crc;
+	uint32_t reserved;
+};
+
+static uint32_t
+crc32(const char *data, size_t size)
+{
+	static const struct Table
+	{
+		uint32_t entries[256];
+		Table()
+		{
+			for (uint32_t i = 0; i < 256; ++i) {
+				uint32_t c = i;
+				for (int k = 0; k < 8; ++k) {
+					c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+				}
+				entries[i] = c;
+			}
+		}
+	} table;
+
+	uint32_t crc = 0xFFFFFFFF;
+	for (size_t i = 0; i < size; ++i) {
+		crc = table.entries[(crc ^ (uint8_t)data[i]) & 0xFF] ^ (crc >> 8);
+	}
+	return crc ^ 0xFFFFFFFF;
+}
+
+static size_t
+file_size(size_t capacity)
+{
+	return HEADER_SIZE + 2 * (HEADER_SIZE + capacity);
+}
+/// @endcond
+
+/** @class SnapshotFile <clips_replica/snapshot_file.h>
+ * Snapshots of a state in a memory-mapped file.
+ * The file holds two slots, each with the latest or the previous
+ * snapshot, a sequence number, a time stamp, and a CRC32 checksum. A new
+ * snapshot is written to the slot of the older one, therefore the newer
+ * snapshot stays intact if the process crashes while writing, and the
+ * file never contains less than one complete snapshot. Writing does not
+ * need any system call as long as the snapshot fits into a slot, the
+ * kernel writes the pages back to disk in the background.
+ *
+ * Another process may open the same file read-only, e.g., a standby
+ * process tailing the snapshots, or a restarted process restoring the
+ * state. A reader verifies the sequence number before and after copying
+ * a slot and its checksum, and falls back to the other slot if the newer
+ * one is being written or has been torn. If a snapshot exceeds the slot
+ * size, the writer creates a file with larger slots and atomically
+ * renames it to the path, a reader then maps the new file on its next
+ * read.
+ *
+ * Snapshots are opaque data for the file. Its header is stored in native
+ * byte order, it is meant to be read on the same host or architecture.
+ * @author agent
+ */
+
+/** Constructor.
+ * A writer creates the file if it does not exist and otherwise continues
+ * the sequence numbers of the snapshots it contains.
+ * @param path path of the snapshot file
+ * @param writable true to write snapshots, false to only read them
+ * @exception Exception thrown if the file cannot be opened or created, or
+ * if it exists but is not a snapshot file
+ */
+SnapshotFile::SnapshotFile(const std::string &path, bool writable)
+: path_(path),
+  writable_(writable),
+  fd_(-1),
+  mem_(NULL),
+  size_(0),
+  capacity_(0),
+  inode_(0),
+  seq_(0)
+{
+	if (!open_file()) {
+		if (!writable_) {
+			throw fawkes::Exception("Cannot open snapshot file %s: %s", path_.c_str(), strerror(errno));
+		}
+		create_file(INITIAL_CAPACITY);
+		if (::rename((path_ + ".tmp").c_str(), path_.c_str()) != 0) {
+			throw fawkes::Exception("Cannot create snapshot file %s: %s", path_.c_str(), strerror(errno));
+		}
+	}
+	seq_ = sequence();
+}
+
+/** Destructor. */
+SnapshotFile::~SnapshotFile()
+{
+	unmap();
+}
+
+/** Get path of the file.
+ * @return path of the file
+ */
+const std::string &
+SnapshotFile::path() const
+{
+	return path_;
+}
+
+/** Get the size of the slots.
+ * @return maximum size of a snapshot before the file is grown
+ */
+size_t
+SnapshotFile::capacity() const
+{
+	return capacity_;
+}
+
+/** Get the sequence number of the latest snapshot.
+ * The snapshot is not verified, the number is meant to cheaply poll for
+ * new snapshots.
+ * @return sequence number of the latest snapshot, 0 if there is none
+ */
+uint64_t
+SnapshotFile::sequence()
+{
+	if (!writable_) {
+		struct stat st;
+		if (::stat(path_.c_str(), &st) == 0 && st.st_ino != inode_) {
+			// replaced by the writer to grow the slots
+			open_file();
+		}
+	}
+	uint64_t s0 = __atomic_load_n(&slot(0)->seq, __ATOMIC_ACQUIRE);
+	uint64_t s1 = __atomic_load_n(&slot(1)->seq, __ATOMIC_ACQUIRE);
+	return std::max(s0, s1);
+}
+
+/** Write a snapshot.
+ * The snapshot replaces the older of the two snapshots in the file.
+ * @param data snapshot to write
+ * @exception Exception thrown if the file is read-only or cannot be grown
+ */
+void
+SnapshotFile::write(const std::string &data)
+{
+	if (!writable_) {
+		throw fawkes::Exception("Snapshot file %s is opened read-only", path_.c_str());
+	}
+
+	bool grown = false;
+	if (data.size() > capacity_) {
+		size_t capacity = capacity_;
+		while (capacity < data.size()) {
+			capacity *= 2;
+		}
+		create_file(capacity);
+		grown = true;
+	}
+
+	uint64_t    seq = seq_ + 1;
+	unsigned    i   = seq % 2;
+	SlotHeader *h   = slot(i);
+	__atomic_store_n(&h->seq, 0, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	memcpy(slot_data(i), data.data(), data.size());
+	h->size       = data.size();
+	h->stamp_usec = (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+	h->crc        = crc32(data.data(), data.size());
+	__atomic_store_n(&h->seq, seq, __ATOMIC_RELEASE);
+	seq_ = seq;
+
+	if (grown) {
+		// the new file only replaces the old one once it holds the snapshot
+		if (::rename((path_ + ".tmp").c_str(), path_.c_str()) != 0) {
+			throw fawkes::Exception("Cannot replace snapshot file %s: %s",
+			                        path_.c_str(),
+			                        strerror(errno));
+		}
+	}
+	msync(mem_, size_, MS_ASYNC);
+}
+
+/** Read the latest complete snapshot.
+ * @param data upon return contains the snapshot
+ * @param seq if not NULL, upon return contains the sequence number of the
+ * snapshot
+ * @param stamp_usec if not NULL, upon return contains the wall-clock time
+ * when the snapshot was written, in microseconds since the epoch
+ * @return true if a snapshot has been read, false if the file contains no
+ * intact snapshot
+ */
+bool
+SnapshotFile::read(std::string &data, uint64_t *seq, int64_t *stamp_usec)
+{
+	// snapshot n is written to slot n % 2
+	unsigned int first = sequence() % 2;
+	for (unsigned int i : {first, 1 - first}) {
+		uint64_t s;
+		int64_t  t;
+		if (read_slot(i, data, s, t)) {
+			if (seq) {
+				*seq = s;
+			}
+			if (stamp_usec) {
+				*stamp_usec = t;
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+bool
+SnapshotFile::read_slot(unsigned int i, std::string &data, uint64_t &seq, int64_t &stamp_usec)
+{
+	SlotHeader *h = slot(i);
+	seq           = __atomic_load_n(&h->seq, __ATOMIC_ACQUIRE);
+	if (seq == 0) {
+		return false;
+	}
+	uint64_t size = h->size;
+	uint32_t crc  = h->crc;
+	stamp_usec    = h->stamp_usec;
+	if (size > capacity_) {
+		return false;
+	}
+	data.assign(slot_data(i), size);
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	if (__atomic_load_n(&h->seq, __ATOMIC_RELAXED) != seq) {
+		// overwritten while copying
+		return false;
+	}
+	return crc32(data.data(), data.size()) == crc;
+}
+
+bool
+SnapshotFile::open_file()
+{
+	int fd = ::open(path_.c_str(), writable_ ? O_RDWR : O_RDONLY);
+	if (fd == -1) {
+		return false;
+	}
+
+	struct stat st;
+	FileHeader  header;
+	if (fstat(fd, &st) != 0 || pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)
+	    || memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0
+	    || header.version != SNAPSHOT_VERSION
+	    || (size_t)st.st_size != file_size(header.capacity)) {
+		::close(fd);
+		throw fawkes::Exception("%s is not a snapshot file", path_.c_str());
+	}
+
+	void *mem = mmap(NULL,
+	                 st.st_size,
+	                 writable_ ? (PROT_READ | PROT_WRITE) : PROT_READ,
+	                 MAP_SHARED,
+	                 fd,
+	                 0);
+	if (mem == MAP_FAILED) {
+		int err = errno;
+		::close(fd);
+		throw fawkes::Exception("Cannot map snapshot file %s: %s", path_.c_str(), strerror(err));
+	}
+
+	unmap();
+	fd_       = fd;
+	mem_      = (char *)mem;
+	size_     = st.st_size;
+	capacity_ = header.capacity;
+	inode_    = st.st_ino;
+	return true;
+}
+
+void
+SnapshotFile::create_file(size_t capacity)
+{
+	std::string tmp_path = path_ + ".tmp";
+	int         fd       = ::open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd == -1) {
+		throw fawkes::Exception("Cannot create snapshot file %s: %s",
+		                        tmp_path.c_str(),
+		                        strerror(errno));
+	}
+	size_t size = file_size(capacity);
+	void * mem  = MAP_FAILED;
+	if (ftruncate(fd, size) == 0) {
+		mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	}
+	struct stat st;
+	if (mem == MAP_FAILED || fstat(fd, &st) != 0) {
+		int err = errno;
+		::close(fd);
+		::unlink(tmp_path.c_str());
+		throw fawkes::Exception("Cannot allocate snapshot file %s: %s",
+		                        tmp_path.c_str(),
+		                        strerror(err));
+	}
+
+	FileHeader *header = (FileHeader *)mem;
+	memcpy(header->magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+	header->version  = SNAPSHOT_VERSION;
+	header->capacity = capacity;
+
+	unmap();
+	fd_       = fd;
+	mem_      = (char *)mem;
+	size_     = size;
+	capacity_ = capacity;
+	inode_    = st.st_ino;
+}
+
+void
+SnapshotFile::unmap()
+{
+	if (mem_) {
+		munmap(mem_, size_);
+		mem_ = NULL;
+	}
+	if (fd_ != -1) {
+		::close(fd_);
+		fd_ = -1;
+	}
+}
+
+SnapshotFile::SlotHeader *
+SnapshotFile::slot(unsigned int i) const
+{
+	return (SlotHeader *)(mem_ + HEADER_SIZE + i * (HEADER_SIZE + capacity_));
+}
+
+char *
+SnapshotFile::slot_data(unsigned int i) const
+{
+	return (char *)slot(i) + HEADER_SIZE;
+}
+
+} // end namespace clips_replica
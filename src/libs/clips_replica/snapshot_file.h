@@ -0,0 +1,84 @@
+/***************************************************************************
+ *  snapshot_file.h - double-buffered snapshots in a memory-mapped file
+ *
+ *  Created: Thu Oct 22 10:14:31 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CLIPS_REPLICA_SNAPSHOT_FILE_H_
+#define __CLIPS_REPLICA_SNAPSHOT_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <sys/types.h>
+
+namespace clips_replica {
+
+class SnapshotFile
+{
+public:
+	SnapshotFile(const std::string &path, bool writable);
+	~SnapshotFile();
+
+	const std::string &path() const;
+	size_t             capacity() const;
+	uint64_t           sequence();
+
+	void write(const std::string &data);
+	bool read(std::string &data, uint64_t *seq = NULL, int64_t *stamp_usec = NULL);
+
+private:
+	/// @cond INTERNALS
+	struct FileHeader;
+	struct SlotHeader;
+	/// @endcond
+
+	bool        open_file();
+	void        create_file(size_t capacity);
+	void        unmap();
+	SlotHeader *slot(unsigned int i) const;
+	char *      slot_data(unsigned int i) const;
+	bool        read_slot(unsigned int i, std::string &data, uint64_t &seq, int64_t &stamp_usec);
+
+	std::string path_;
+	bool        writable_;
+	int         fd_;
+	char *      mem_;
+	size_t      size_;
+	size_t      capacity_;
+	ino_t       inode_;
+	uint64_t    seq_;
+};
+
+} // end namespace clips_replica
+
+#endif
@@ -103,6 +103,8 @@ public:
 	ValueIterator *iterator();
 	ValueIterator *search(const char *path);
 
+	std::shared_ptr<YamlConfigurationNode> query(const char *path) const;
+
 	void lock();
 	bool try_lock();
 	void unlock();
@@ -171,7 +173,6 @@ private:
 	};
 	/// @endcond
 
-	std::shared_ptr<YamlConfigurationNode> query(const char *path) const;
 	void
 	read_meta_doc(YAML::Node &doc, std::queue<LoadQueueEntry> &load_queue, std::string &host_file);
 	std::shared_ptr<YamlConfigurationNode> read_config_doc(const YAML::Node &doc);
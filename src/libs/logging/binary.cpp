@@ -0,0 +1,1134 @@
+
+/***************************************************************************
+ *  binary.cpp - binary ring file logger
+ *
+ *  Created: Mon Oct 19 10:12:41 2026
+ *  Copyright  2026  agent <agent@local>
+ *
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version. A runtime exception applies to
+ *  this software (see LICENSE.GPL_WRE file mentioned below for details).
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL_WRE file in the doc directory.
+ */
+
+#include <core/exception.h>
+#include <core/threading/mutex.h>
+#include <logging/binary.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace llsfrb {
+
+using namespace binlog;
+
+/// @cond INTERNALS
+/** Size of the file header region, the header itself is much smaller. */
+#define BINLOG_HEADER_SIZE 4096
+/** Size of the dictionary of interned format and component strings. */
+#define BINLOG_DICT_SIZE (256 * 1024)
+/** Longer strings are not interned but stored in the record. */
+#define BINLOG_MAX_INTERN_LENGTH 256
+/** Maximum size of the encoded arguments of a single record. */
+#define BINLOG_MAX_ARGS_SIZE (64 * 1024)
+/** Minimum size of the record ring. */
+#define BINLOG_MIN_RING_SIZE (1024 * 1024)
+/** Pointer cache is reset when it grows beyond this many entries. */
+#define BINLOG_MAX_PTR_CACHE 4096
+
+static inline uint64_t
+align8(uint64_t v)
+{
+	return (v + 7) & ~(uint64_t)7;
+}
+
+static inline uint64_t
+align4(uint64_t v)
+{
+	return (v + 3) & ~(uint64_t)3;
+}
+
+/** Size of the record or padding at the given ring position. */
+static inline uint64_t
+record_size_at(const unsigned char *ring, uint64_t ring_size, uint64_t pos)
+{
+	uint64_t off = pos % ring_size;
+	if (ring_size - off < sizeof(RecordHeader)) {
+		return ring_size - off;
+	}
+	uint32_t size;
+	memcpy(&size, ring + off, sizeof(size));
+	return size;
+}
+/// @endcond
+
+/** @class BinaryLogger <logging/binary.h>
+ * Log to a memory-mapped binary ring file.
+ * Instead of formatting each message, the logger stores the time, level,
+ * component, format string and the raw arguments. Format and component
+ * strings are interned in a dictionary at the beginning of the file so
+ * that a record usually only refers to them by ID. Records are written into
+ * a fixed-size ring, the oldest records are overwritten when it is full.
+ * Logging a message thus is mostly a memcpy into the mapped file, it is
+ * neither formatted nor flushed. The kernel writes the pages back
+ * asynchronously.
+ *
+ * Formatting is deferred to readers, see BinaryLogReader and the
+ * rcll-log-decode tool. Format strings with conversions that cannot be
+ * deferred (e.g. %n or %m) are formatted right away and stored as string.
+ *
+ * @author agent
+ */
+
+/** Constructor.
+ * @param filename_pattern the name of the log-file, $time will be replaced by a timestamp
+ * @param ring_size size of the record ring in bytes
+ * @param log_level minimum log level
+ */
+BinaryLogger::BinaryLogger(const char *filename_pattern, size_t ring_size, LogLevel log_level)
+: Logger(log_level)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	struct tm now_s;
+	localtime_r(&now.tv_sec, &now_s);
+	char start_time[80];
+	snprintf(start_time,
+	         sizeof(start_time),
+	         "%04d-%02d-%02d_%02d-%02d-%02d",
+	         1900 + now_s.tm_year,
+	         now_s.tm_mon + 1,
+	         now_s.tm_mday,
+	         now_s.tm_hour,
+	         now_s.tm_min,
+	         now_s.tm_sec);
+
+	std::string pattern(filename_pattern);
+	std::string time_var = "$time";
+	size_t      pos      = pattern.find(time_var);
+	filename_            = pattern;
+	if (pos != std::string::npos) {
+		filename_.replace(pos, time_var.length(), start_time);
+	}
+
+	if (ring_size < BINLOG_MIN_RING_SIZE) {
+		ring_size = BINLOG_MIN_RING_SIZE;
+	}
+	ring_size    = align8(ring_size);
+	mapped_size_ = BINLOG_HEADER_SIZE + BINLOG_DICT_SIZE + ring_size;
+
+	fd_ = open(filename_.c_str(),
+	           O_RDWR | O_CREAT | O_TRUNC,
+	           S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+	if (fd_ == -1) {
+		throw fawkes::Exception(errno, "Failed to open binary log file %s", filename_.c_str());
+	}
+	if (ftruncate(fd_, mapped_size_) == -1) {
+		int err = errno;
+		close(fd_);
+		throw fawkes::Exception(err, "Failed to resize binary log file %s", filename_.c_str());
+	}
+	void *m = mmap(NULL, mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+	if (m == MAP_FAILED) {
+		int err = errno;
+		close(fd_);
+		throw fawkes::Exception(err, "Failed to map binary log file %s", filename_.c_str());
+	}
+	mapped_ = static_cast<unsigned char *>(m);
+	header_ = reinterpret_cast<FileHeader *>(mapped_);
+	dict_   = reinterpret_cast<char *>(mapped_ + BINLOG_HEADER_SIZE);
+	ring_   = mapped_ + BINLOG_HEADER_SIZE + BINLOG_DICT_SIZE;
+
+	memset(header_, 0, sizeof(FileHeader));
+	header_->version     = BINLOG_VERSION;
+	header_->header_size = BINLOG_HEADER_SIZE;
+	header_->dict_offset = BINLOG_HEADER_SIZE;
+	header_->dict_size   = BINLOG_DICT_SIZE;
+	header_->ring_offset = BINLOG_HEADER_SIZE + BINLOG_DICT_SIZE;
+	header_->ring_size   = ring_size;
+	header_->created_sec = now.tv_sec;
+	// the magic is written last, readers reject a partially initialized file
+	memcpy(header_->magic, BINLOG_MAGIC, sizeof(header_->magic));
+
+	mutex_       = new fawkes::Mutex();
+	format_s_id_ = intern("%s");
+	args_.reserve(1024);
+
+	// create a symlink for the latest log if the filename has a time stamp
+	if (pos != std::string::npos) {
+		std::string latest_filename(filename_pattern);
+		latest_filename.replace(pos, time_var.length(), "latest");
+		if (unlink(latest_filename.c_str()) == -1 && errno != ENOENT) {
+			throw fawkes::Exception(errno, "Failed to update symlink at %s", latest_filename.c_str());
+		}
+		if (symlink(filename_.c_str(), latest_filename.c_str()) == -1) {
+			throw fawkes::Exception(errno,
+			                        "Failed ot create symlink from %s to %s",
+			                        filename_.c_str(),
+			                        latest_filename.c_str());
+		}
+	}
+}
+
+/** Destructor. */
+BinaryLogger::~BinaryLogger()
+{
+	msync(mapped_, mapped_size_, MS_ASYNC);
+	munmap(mapped_, mapped_size_);
+	close(fd_);
+	delete mutex_;
+}
+
+/** Get name of the log file.
+ * @return name of the log file with the time stamp filled in
+ */
+const char *
+BinaryLogger::filename() const
+{
+	return filename_.c_str();
+}
+
+/** Check if the logger stores messages without formatting them.
+ * @return true, the arguments are encoded and formatted by the reader
+ */
+bool
+BinaryLogger::defers_formatting() const
+{
+	return true;
+}
+
+/** Get ID of a string in the dictionary.
+ * The string is added if it has not been seen before. Lookups are first
+ * done by pointer, which catches string literals, and verified against
+ * the dictionary since a dynamically allocated format may reuse an address.
+ * Must be called with the mutex held.
+ * @param str string to look up
+ * @return dictionary ID or BINLOG_INLINE_ID if the string cannot be interned
+ */
+uint32_t
+BinaryLogger::intern(const char *str)
+{
+	auto p = ids_by_ptr_.find(str);
+	if (p != ids_by_ptr_.end() && strcmp(dict_ + p->second + sizeof(uint32_t), str) == 0) {
+		return p->second;
+	}
+
+	size_t len = strlen(str);
+	if (len > BINLOG_MAX_INTERN_LENGTH) {
+		return BINLOG_INLINE_ID;
+	}
+	if (ids_by_ptr_.size() >= BINLOG_MAX_PTR_CACHE) {
+		ids_by_ptr_.clear();
+	}
+
+	std::string s(str, len);
+	auto        i = ids_by_str_.find(s);
+	if (i != ids_by_str_.end()) {
+		ids_by_ptr_[str] = i->second;
+		return i->second;
+	}
+
+	uint64_t entry_size = align4(sizeof(uint32_t) + len + 1);
+	if (header_->dict_used + entry_size > header_->dict_size) {
+		return BINLOG_INLINE_ID;
+	}
+	uint32_t id      = header_->dict_used;
+	uint32_t len_u32 = len;
+	memcpy(dict_ + id, &len_u32, sizeof(len_u32));
+	memcpy(dict_ + id + sizeof(len_u32), str, len + 1);
+	__atomic_store_n(&header_->dict_used, header_->dict_used + entry_size, __ATOMIC_RELEASE);
+
+	ids_by_str_[s]   = id;
+	ids_by_ptr_[str] = id;
+	return id;
+}
+
+/** Append a string argument to the argument buffer.
+ * @param str string to append, NULL is stored as "(null)"
+ */
+void
+BinaryLogger::encode_string(const char *str)
+{
+	if (!str)
+		str = "(null)";
+	size_t len   = strlen(str);
+	size_t avail = BINLOG_MAX_ARGS_SIZE - std::min(args_.size(), (size_t)BINLOG_MAX_ARGS_SIZE);
+	if (len + 1 + sizeof(uint32_t) > avail) {
+		len = avail > 1 + sizeof(uint32_t) ? avail - 1 - sizeof(uint32_t) : 0;
+	}
+	uint32_t len_u32 = len;
+	args_.push_back(ARG_STRING);
+	const uint8_t *l = reinterpret_cast<const uint8_t *>(&len_u32);
+	args_.insert(args_.end(), l, l + sizeof(len_u32));
+	args_.insert(args_.end(), str, str + len);
+}
+
+/// @cond INTERNALS
+template <typename T>
+static inline void
+encode_value(std::vector<uint8_t> &args, ArgType type, T value)
+{
+	args.push_back(type);
+	const uint8_t *v = reinterpret_cast<const uint8_t *>(&value);
+	args.insert(args.end(), v, v + sizeof(value));
+}
+
+typedef enum { LEN_NONE, LEN_HH, LEN_H, LEN_L, LEN_LL, LEN_J, LEN_Z, LEN_T, LEN_BIG_L } LengthMod;
+
+static const char *
+parse_length(const char *p, LengthMod &len)
+{
+	len = LEN_NONE;
+	switch (*p) {
+	case 'h':
+		if (p[1] == 'h') {
+			len = LEN_HH;
+			return p + 2;
+		}
+		len = LEN_H;
+		return p + 1;
+	case 'l':
+		if (p[1] == 'l') {
+			len = LEN_LL;
+			return p + 2;
+		}
+		len = LEN_L;
+		return p + 1;
+	case 'q': len = LEN_LL; return p + 1;
+	case 'j': len = LEN_J; return p + 1;
+	case 'z': len = LEN_Z; return p + 1;
+	case 't': len = LEN_T; return p + 1;
+	case 'L': len = LEN_BIG_L; return p + 1;
+	default: return p;
+	}
+}
+
+static inline bool
+is_flag(char c)
+{
+	return c == '-' || c == '+' || c == ' ' || c == '#' || c == '0' || c == '\'';
+}
+/// @endcond
+
+/** Encode the arguments of a format string.
+ * Walks the conversion specifications and stores each argument with its
+ * type so that the reader can format it later.
+ * @param format format string
+ * @param va argument list, consumed
+ * @param num_args upon return the number of encoded arguments
+ * @return false if the format contains a conversion that cannot be
+ * deferred, the argument buffer is then in an undefined state
+ */
+bool
+BinaryLogger::encode_args(const char *format, va_list va, uint32_t &num_args)
+{
+	num_args = 0;
+	for (const char *p = format; *p; ++p) {
+		if (*p != '%')
+			continue;
+		++p;
+		if (*p == '%')
+			continue;
+
+		while (*p && is_flag(*p))
+			++p;
+		if (*p == '*') {
+			encode_value<int64_t>(args_, ARG_INT, va_arg(va, int));
+			++num_args;
+			++p;
+		} else {
+			while (*p >= '0' && *p <= '9')
+				++p;
+		}
+		if (*p == '.') {
+			++p;
+			if (*p == '*') {
+				encode_value<int64_t>(args_, ARG_INT, va_arg(va, int));
+				++num_args;
+				++p;
+			} else {
+				while (*p >= '0' && *p <= '9')
+					++p;
+			}
+		}
+		LengthMod len;
+		p = parse_length(p, len);
+
+		switch (*p) {
+		case 'd':
+		case 'i': {
+			int64_t v;
+			switch (len) {
+			case LEN_HH: v = (signed char)va_arg(va, int); break;
+			case LEN_H: v = (short)va_arg(va, int); break;
+			case LEN_L: v = va_arg(va, long); break;
+			case LEN_LL: v = va_arg(va, long long); break;
+			case LEN_J: v = va_arg(va, intmax_t); break;
+			case LEN_Z: v = va_arg(va, ssize_t); break;
+			case LEN_T: v = va_arg(va, ptrdiff_t); break;
+			default: v = va_arg(va, int); break;
+			}
+			encode_value(args_, ARG_INT, v);
+			break;
+		}
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X': {
+			uint64_t v;
+			switch (len) {
+			case LEN_HH: v = (unsigned char)va_arg(va, unsigned int); break;
+			case LEN_H: v = (unsigned short)va_arg(va, unsigned int); break;
+			case LEN_L: v = va_arg(va, unsigned long); break;
+			case LEN_LL: v = va_arg(va, unsigned long long); break;
+			case LEN_J: v = va_arg(va, uintmax_t); break;
+			case LEN_Z: v = va_arg(va, size_t); break;
+			case LEN_T: v = va_arg(va, ptrdiff_t); break;
+			default: v = va_arg(va, unsigned int); break;
+			}
+			encode_value(args_, ARG_UINT, v);
+			break;
+		}
+		case 'c':
+			if (len != LEN_NONE)
+				return false;
+			encode_value<int64_t>(args_, ARG_INT, va_arg(va, int));
+			break;
+		case 'f':
+		case 'F':
+		case 'e':
+		case 'E':
+		case 'g':
+		case 'G':
+		case 'a':
+		case 'A': {
+			double v = (len == LEN_BIG_L) ? (double)va_arg(va, long double) : va_arg(va, double);
+			encode_value(args_, ARG_DOUBLE, v);
+			break;
+		}
+		case 's':
+			if (len != LEN_NONE)
+				return false;
+			encode_string(va_arg(va, const char *));
+			break;
+		case 'p': encode_value<uint64_t>(args_, ARG_POINTER, (uintptr_t)va_arg(va, void *)); break;
+		default:
+			// %n, %m, wide characters, and broken formats
+			return false;
+		}
+		++num_args;
+	}
+	return true;
+}
+
+/** Make room for a record in the ring.
+ * Advances the tail over the oldest records until size bytes are free.
+ * Must be called with the mutex held.
+ * @param size number of bytes needed
+ */
+void
+BinaryLogger::reserve(uint64_t size)
+{
+	uint64_t ring_size = header_->ring_size;
+	while (header_->head + size - header_->tail > ring_size) {
+		uint64_t rsize = record_size_at(ring_, ring_size, header_->tail);
+		if (rsize >= sizeof(RecordHeader)) {
+			RecordHeader rh;
+			memcpy(&rh, ring_ + header_->tail % ring_size, sizeof(rh));
+			if (!(rh.flags & FLAG_PADDING))
+				header_->overwritten += 1;
+		}
+		header_->tail += rsize;
+	}
+}
+
+/** Append a record to the ring.
+ * The record consists of the given header and the current argument buffer.
+ * Must be called with the mutex held.
+ * @param rh record header, size is filled in
+ */
+void
+BinaryLogger::append(RecordHeader &rh)
+{
+	if (args_.size() > BINLOG_MAX_ARGS_SIZE) {
+		// only possible with many numeric arguments after a truncated string
+		args_.resize(BINLOG_MAX_ARGS_SIZE);
+	}
+
+	uint64_t ring_size = header_->ring_size;
+	uint64_t size      = align8(sizeof(RecordHeader) + args_.size());
+	rh.size            = size;
+
+	uint64_t off = header_->head % ring_size;
+	if (off + size > ring_size) {
+		// records are never split, pad up to the end of the ring
+		uint64_t pad = ring_size - off;
+		reserve(pad);
+		if (pad >= sizeof(RecordHeader)) {
+			RecordHeader ph;
+			memset(&ph, 0, sizeof(ph));
+			ph.size  = pad;
+			ph.flags = FLAG_PADDING;
+			memcpy(ring_ + off, &ph, sizeof(ph));
+		}
+		__atomic_store_n(&header_->head, header_->head + pad, __ATOMIC_RELEASE);
+		off = 0;
+	}
+
+	reserve(size);
+	memcpy(ring_ + off, &rh, sizeof(rh));
+	if (!args_.empty()) {
+		memcpy(ring_ + off + sizeof(rh), &args_[0], args_.size());
+	}
+	__atomic_store_n(&header_->head, header_->head + size, __ATOMIC_RELEASE);
+}
+
+void
+BinaryLogger::write(LogLevel        level,
+                    struct timeval *t,
+                    const char *    component,
+                    const char *    format,
+                    va_list         va)
+{
+	if (log_level > level)
+		return;
+
+	RecordHeader rh;
+	rh.level = level;
+	rh.flags = 0;
+	rh.sec   = t->tv_sec;
+	rh.usec  = t->tv_usec;
+
+	va_list vac;
+	va_copy(vac, va);
+
+	mutex_->lock();
+	args_.clear();
+	rh.component_id = intern(component);
+	if (rh.component_id == BINLOG_INLINE_ID) {
+		rh.flags |= FLAG_INLINE_COMPONENT;
+		encode_string(component);
+	}
+	size_t args_start = args_.size();
+
+	rh.format_id = intern(format);
+	if (rh.format_id == BINLOG_INLINE_ID) {
+		rh.flags |= FLAG_INLINE_FORMAT;
+		encode_string(format);
+	}
+	if (!encode_args(format, vac, rh.num_args)) {
+		// cannot defer formatting, store the formatted message instead
+		char *msg;
+		if (vasprintf(&msg, format, va) == -1) {
+			msg = NULL;
+		}
+		args_.resize(args_start);
+		rh.flags &= ~FLAG_INLINE_FORMAT;
+		rh.format_id = format_s_id_;
+		rh.num_args  = 1;
+		encode_string(msg ? msg : "(failed to format message)");
+		free(msg);
+	}
+	append(rh);
+	mutex_->unlock();
+
+	va_end(vac);
+}
+
+void
+BinaryLogger::write(LogLevel level, struct timeval *t, const char *component, fawkes::Exception &e)
+{
+	if (log_level > level)
+		return;
+
+	RecordHeader rh;
+	rh.level     = level;
+	rh.flags     = FLAG_EXCEPTION;
+	rh.sec       = t->tv_sec;
+	rh.usec      = t->tv_usec;
+	rh.format_id = format_s_id_;
+	rh.num_args  = 1;
+
+	mutex_->lock();
+	rh.component_id = intern(component);
+	for (fawkes::Exception::iterator i = e.begin(); i != e.end(); ++i) {
+		args_.clear();
+		if (rh.component_id == BINLOG_INLINE_ID) {
+			rh.flags |= FLAG_INLINE_COMPONENT;
+			encode_string(component);
+		}
+		encode_string(*i);
+		append(rh);
+	}
+	mutex_->unlock();
+}
+
+void
+BinaryLogger::log_debug(const char *component, const char *format, ...)
+{
+	va_list arg;
+	va_start(arg, format);
+	vlog_debug(component, format, arg);
+	va_end(arg);
+}
+
+void
+BinaryLogger::log_info(const char *component, const char *format, ...)
+{
+	va_list arg;
+	va_start(arg, format);
+	vlog_info(component, format, arg);
+	va_end(arg);
+}
+
+void
+BinaryLogger::log_warn(const char *component, const char *format, ...)
+{
+	va_list arg;
+	va_start(arg, format);
+	vlog_warn(component, format, arg);
+	va_end(arg);
+}
+
+void
+BinaryLogger::log_error(const char *component, const char *format, ...)
+{
+	va_list arg;
+	va_start(arg, format);
+	vlog_error(component, format, arg);
+	va_end(arg);
+}
+
+void
+BinaryLogger::log_debug(const char *component, fawkes::Exception &e)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	write(LL_DEBUG, &now, component, e);
+}
+
+void
+BinaryLogger::log_info(const char *component, fawkes::Exception &e)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	write(LL_INFO, &now, component, e);
+}
+
+void
+BinaryLogger::log_warn(const char *component, fawkes::Exception &e)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	write(LL_WARN, &now, component, e);
+}
+
+void
+BinaryLogger::log_error(const char *component, fawkes::Exception &e)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	write(LL_ERROR, &now, component, e);
+}
+
+void
+BinaryLogger::vlog_debug(const char *component, const char *format, va_list va)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	write(LL_DEBUG, &now, component, format, va);
+}
+
+void
+BinaryLogger::vlog_info(const char *component, const char *format, va_list va)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	write(LL_INFO, &now, component, format, va);
+}
+
+void
+BinaryLogger::vlog_warn(const char *component, const char *format, va_list va)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	write(LL_WARN, &now, component, format, va);
+}
+
+void
+BinaryLogger::vlog_error(const char *component, const char *format, va_list va)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	write(LL_ERROR, &now, component, format, va);
+}
+
+void
+BinaryLogger::tlog_debug(struct timeval *t, const char *component, const char *format, ...)
+{
+	va_list arg;
+	va_start(arg, format);
+	vtlog_debug(t, component, format, arg);
+	va_end(arg);
+}
+
+void
+BinaryLogger::tlog_info(struct timeval *t, const char *component, const char *format, ...)
+{
+	va_list arg;
+	va_start(arg, format);
+	vtlog_info(t, component, format, arg);
+	va_end(arg);
+}
+
+void
+BinaryLogger::tlog_warn(struct timeval *t, const char *component, const char *format, ...)
+{
+	va_list arg;
+	va_start(arg, format);
+	vtlog_warn(t, component, format, arg);
+	va_end(arg);
+}
+
+void
+BinaryLogger::tlog_error(struct timeval *t, const char *component, const char *format, ...)
+{
+	va_list arg;
+	va_start(arg, format);
+	vtlog_error(t, component, format, arg);
+	va_end(arg);
+}
+
+void
+BinaryLogger::tlog_debug(struct timeval *t, const char *component, fawkes::Exception &e)
+{
+	write(LL_DEBUG, t, component, e);
+}
+
+void
+BinaryLogger::tlog_info(struct timeval *t, const char *component, fawkes::Exception &e)
+{
+	write(LL_INFO, t, component, e);
+}
+
+void
+BinaryLogger::tlog_warn(struct timeval *t, const char *component, fawkes::Exception &e)
+{
+	write(LL_WARN, t, component, e);
+}
+
+void
+BinaryLogger::tlog_error(struct timeval *t, const char *component, fawkes::Exception &e)
+{
+	write(LL_ERROR, t, component, e);
+}
+
+void
+BinaryLogger::vtlog_debug(struct timeval *t, const char *component, const char *format, va_list va)
+{
+	write(LL_DEBUG, t, component, format, va);
+}
+
+void
+BinaryLogger::vtlog_info(struct timeval *t, const char *component, const char *format, va_list va)
+{
+	write(LL_INFO, t, component, format, va);
+}
+
+void
+BinaryLogger::vtlog_warn(struct timeval *t, const char *component, const char *format, va_list va)
+{
+	write(LL_WARN, t, component, format, va);
+}
+
+void
+BinaryLogger::vtlog_error(struct timeval *t, const char *component, const char *format, va_list va)
+{
+	write(LL_ERROR, t, component, format, va);
+}
+
+/** @class BinaryLogReader <logging/binary.h>
+ * Reader for binary log files written by BinaryLogger.
+ * The file is read into memory at construction, the records can then be
+ * iterated from the oldest to the newest. Messages are formatted while
+ * reading. A file which is still being written may be read, records which
+ * are overwritten while the file is read are detected as corrupt and end
+ * the iteration.
+ *
+ * @author agent
+ */
+
+/** Constructor.
+ * @param filename binary log file to read
+ */
+BinaryLogReader::BinaryLogReader(const char *filename)
+{
+	int fd = open(filename, O_RDONLY);
+	if (fd == -1) {
+		throw fawkes::Exception(errno, "Failed to open binary log file %s", filename);
+	}
+	struct stat st;
+	if (fstat(fd, &st) == -1) {
+		int err = errno;
+		close(fd);
+		throw fawkes::Exception(err, "Failed to stat binary log file %s", filename);
+	}
+	data_.resize(st.st_size);
+	size_t bytes_read = 0;
+	while (bytes_read < data_.size()) {
+		ssize_t r = read(fd, &data_[bytes_read], data_.size() - bytes_read);
+		if (r <= 0) {
+			int err = errno;
+			close(fd);
+			throw fawkes::Exception(err, "Failed to read binary log file %s", filename);
+		}
+		bytes_read += r;
+	}
+	close(fd);
+
+	if (data_.size() < sizeof(FileHeader)) {
+		throw fawkes::Exception("%s is not a binary log file (too short)", filename);
+	}
+	memcpy(&header_, &data_[0], sizeof(header_));
+	if (memcmp(header_.magic, BINLOG_MAGIC, sizeof(header_.magic)) != 0) {
+		throw fawkes::Exception("%s is not a binary log file (invalid magic)", filename);
+	}
+	if (header_.version != BINLOG_VERSION) {
+		throw fawkes::Exception("%s has unsupported version %u", filename, header_.version);
+	}
+	if (header_.dict_offset + header_.dict_size > data_.size()
+	    || header_.ring_offset + header_.ring_size > data_.size() || header_.ring_size == 0
+	    || header_.dict_used > header_.dict_size) {
+		throw fawkes::Exception("%s is truncated or corrupt", filename);
+	}
+	ring_ = &data_[header_.ring_offset];
+	rewind();
+}
+
+/** Destructor. */
+BinaryLogReader::~BinaryLogReader()
+{
+}
+
+/** Restart iteration at the oldest record. */
+void
+BinaryLogReader::rewind()
+{
+	pos_ = header_.tail;
+}
+
+/** Get number of overwritten records.
+ * @return number of records which have been overwritten by newer ones
+ */
+uint64_t
+BinaryLogReader::overwritten() const
+{
+	return header_.overwritten;
+}
+
+/** Get creation time of the log.
+ * @return time when the log file was created
+ */
+time_t
+BinaryLogReader::created() const
+{
+	return header_.created_sec;
+}
+
+const char *
+BinaryLogReader::dict_string(uint32_t id) const
+{
+	if ((uint64_t)id + sizeof(uint32_t) >= header_.dict_used)
+		return NULL;
+	uint32_t len;
+	memcpy(&len, &data_[header_.dict_offset + id], sizeof(len));
+	if ((uint64_t)id + sizeof(uint32_t) + len >= header_.dict_used)
+		return NULL;
+	return reinterpret_cast<const char *>(&data_[header_.dict_offset + id + sizeof(uint32_t)]);
+}
+
+/// @cond INTERNALS
+class BinaryArgReader
+{
+public:
+	BinaryArgReader(const unsigned char *p, const unsigned char *end) : p_(p), end_(end)
+	{
+	}
+
+	bool
+	read_string(std::string &s)
+	{
+		uint32_t len;
+		if (p_ + 1 + sizeof(len) > end_ || *p_ != ARG_STRING)
+			return false;
+		memcpy(&len, p_ + 1, sizeof(len));
+		p_ += 1 + sizeof(len);
+		if (p_ + len > end_)
+			return false;
+		s.assign(reinterpret_cast<const char *>(p_), len);
+		p_ += len;
+		return true;
+	}
+
+	template <typename T>
+	bool
+	read_value(uint8_t &type, T &v)
+	{
+		if (p_ + 1 + sizeof(v) > end_ || *p_ == ARG_STRING)
+			return false;
+		type = *p_;
+		memcpy(&v, p_ + 1, sizeof(v));
+		p_ += 1 + sizeof(v);
+		return true;
+	}
+
+	bool
+	peek_string() const
+	{
+		return p_ < end_ && *p_ == ARG_STRING;
+	}
+
+private:
+	const unsigned char *p_;
+	const unsigned char *end_;
+};
+
+template <typename T>
+static void
+append_formatted(std::string &out, const std::string &spec, int num_stars, const int *stars, T v)
+{
+	char  buf[256];
+	char *dyn = NULL;
+	int   len;
+	switch (num_stars) {
+	case 0: len = snprintf(buf, sizeof(buf), spec.c_str(), v); break;
+	case 1: len = snprintf(buf, sizeof(buf), spec.c_str(), stars[0], v); break;
+	default: len = snprintf(buf, sizeof(buf), spec.c_str(), stars[0], stars[1], v); break;
+	}
+	if (len < 0)
+		return;
+	if ((size_t)len < sizeof(buf)) {
+		out.append(buf, len);
+		return;
+	}
+	switch (num_stars) {
+	case 0: len = asprintf(&dyn, spec.c_str(), v); break;
+	case 1: len = asprintf(&dyn, spec.c_str(), stars[0], v); break;
+	default: len = asprintf(&dyn, spec.c_str(), stars[0], stars[1], v); break;
+	}
+	if (len >= 0) {
+		out.append(dyn, len);
+		free(dyn);
+	}
+}
+/// @endcond
+
+/** Format a message from its format string and encoded arguments.
+ * Each conversion is formatted individually with the type the argument
+ * was stored with.
+ * @param format format string
+ * @param args start of the encoded arguments
+ * @param end end of the encoded arguments
+ * @param out formatted message, appended to
+ * @return false if the arguments do not match the format
+ */
+bool
+BinaryLogReader::format(const char *         format,
+                        const unsigned char *args,
+                        const unsigned char *end,
+                        std::string &        out)
+{
+	BinaryArgReader ar(args, end);
+
+	for (const char *p = format; *p; ++p) {
+		if (*p != '%') {
+			out += *p;
+			continue;
+		}
+		if (p[1] == '%') {
+			out += '%';
+			++p;
+			continue;
+		}
+
+		std::string spec("%");
+		int         stars[2];
+		int         num_stars = 0;
+		++p;
+		while (*p && is_flag(*p))
+			spec += *p++;
+		for (int i = 0; i < 2; ++i) {
+			if (i == 1) {
+				if (*p != '.')
+					break;
+				spec += *p++;
+			}
+			if (*p == '*') {
+				uint8_t type;
+				int64_t v;
+				if (!ar.read_value(type, v))
+					return false;
+				stars[num_stars++] = v;
+				spec += *p++;
+			} else {
+				while (*p >= '0' && *p <= '9')
+					spec += *p++;
+			}
+		}
+		LengthMod len;
+		p = parse_length(p, len);
+
+		switch (*p) {
+		case 'd':
+		case 'i':
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X': {
+			uint8_t  type;
+			uint64_t v;
+			if (!ar.read_value(type, v))
+				return false;
+			spec += "ll";
+			spec += *p;
+			append_formatted(out, spec, num_stars, stars, (unsigned long long)v);
+			break;
+		}
+		case 'c': {
+			uint8_t type;
+			int64_t v;
+			if (!ar.read_value(type, v))
+				return false;
+			spec += *p;
+			append_formatted(out, spec, num_stars, stars, (int)v);
+			break;
+		}
+		case 'f':
+		case 'F':
+		case 'e':
+		case 'E':
+		case 'g':
+		case 'G':
+		case 'a':
+		case 'A': {
+			uint8_t type;
+			double  v;
+			if (!ar.read_value(type, v))
+				return false;
+			spec += *p;
+			append_formatted(out, spec, num_stars, stars, v);
+			break;
+		}
+		case 's': {
+			std::string s;
+			if (!ar.read_string(s))
+				return false;
+			spec += *p;
+			append_formatted(out, spec, num_stars, stars, s.c_str());
+			break;
+		}
+		case 'p': {
+			uint8_t  type;
+			uint64_t v;
+			if (!ar.read_value(type, v))
+				return false;
+			spec += *p;
+			append_formatted(out, spec, num_stars, stars, (void *)(uintptr_t)v);
+			break;
+		}
+		default: return false;
+		}
+	}
+	return true;
+}
+
+/** Read the next record.
+ * @param entry upon return the decoded record
+ * @return true if a record has been read, false if there are no more
+ * records or the remaining data is corrupt
+ */
+bool
+BinaryLogReader::next(Entry &entry)
+{
+	uint64_t ring_size = header_.ring_size;
+	while (pos_ < header_.head) {
+		uint64_t off = pos_ % ring_size;
+		if (ring_size - off < sizeof(RecordHeader)) {
+			pos_ += ring_size - off;
+			continue;
+		}
+		RecordHeader rh;
+		memcpy(&rh, ring_ + off, sizeof(rh));
+		if (rh.size < sizeof(RecordHeader) || off + rh.size > ring_size || rh.size % 8 != 0) {
+			return false;
+		}
+		pos_ += rh.size;
+		if (rh.flags & FLAG_PADDING)
+			continue;
+
+		const unsigned char *args = ring_ + off + sizeof(RecordHeader);
+		const unsigned char *end  = ring_ + off + rh.size;
+		BinaryArgReader      ar(args, end);
+
+		if (rh.flags & FLAG_INLINE_COMPONENT) {
+			if (!ar.read_string(entry.component))
+				return false;
+			args += 1 + sizeof(uint32_t) + entry.component.size();
+		} else {
+			const char *c = dict_string(rh.component_id);
+			if (!c)
+				return false;
+			entry.component = c;
+		}
+
+		std::string inline_format;
+		const char *format;
+		if (rh.flags & FLAG_INLINE_FORMAT) {
+			if (!ar.read_string(inline_format))
+				return false;
+			args += 1 + sizeof(uint32_t) + inline_format.size();
+			format = inline_format.c_str();
+		} else {
+			format = dict_string(rh.format_id);
+			if (!format)
+				return false;
+		}
+
+		switch (rh.level) {
+		case Logger::LL_DEBUG: entry.level = Logger::LL_DEBUG; break;
+		case Logger::LL_INFO: entry.level = Logger::LL_INFO; break;
+		case Logger::LL_WARN: entry.level = Logger::LL_WARN; break;
+		default: entry.level = Logger::LL_ERROR; break;
+		}
+		entry.time.tv_sec  = rh.sec;
+		entry.time.tv_usec = rh.usec;
+		entry.exception    = (rh.flags & FLAG_EXCEPTION);
+		entry.message.clear();
+		if (!this->format(format, args, end, entry.message)) {
+			entry.message += "<corrupt arguments>";
+		}
+		return true;
+	}
+	return false;
+}
+
+} // end namespace llsfrb
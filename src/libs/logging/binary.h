@@ -0,0 +1,213 @@
+
+/***************************************************************************
+ *  binary.h - binary ring file logger
+ *
+ *  Created: Mon Oct 19 10:12:41 2026
+ *  Copyright  2026  agent <agent@local>
+ *
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version. A runtime exception applies to
+ *  this software (see LICENSE.GPL_WRE file mentioned below for details).
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL_WRE file in the doc directory.
+ */
+
+#ifndef __UTILS_LOGGING_BINARY_H_
+#define __UTILS_LOGGING_BINARY_H_
+
+#include <logging/logger.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fawkes {
+class Mutex;
+}
+
+namespace llsfrb {
+
+/// @cond INTERNALS
+namespace binlog {
+
+/** File magic, first eight bytes of every binary log. */
+#define BINLOG_MAGIC "RCLLBLOG"
+/** Version of the file layout. */
+#define BINLOG_VERSION 1
+/** Format or component ID denoting a string stored in the record itself. */
+#define BINLOG_INLINE_ID 0xffffffff
+
+typedef enum {
+	ARG_INT     = 'i',
+	ARG_UINT    = 'u',
+	ARG_DOUBLE  = 'd',
+	ARG_STRING  = 's',
+	ARG_POINTER = 'p'
+} ArgType;
+
+typedef enum {
+	FLAG_PADDING          = 1 << 0,
+	FLAG_EXCEPTION        = 1 << 1,
+	FLAG_INLINE_COMPONENT = 1 << 2,
+	FLAG_INLINE_FORMAT    = 1 << 3
+} RecordFlags;
+
+// The file consists of the header, a dictionary of interned format and
+// component strings, and the record ring. Positions in the ring are
+// monotonic byte counters, the offset is the position modulo ring_size.
+struct FileHeader
+{
+	char     magic[8];
+	uint32_t version;
+	uint32_t header_size;
+	uint64_t dict_offset;
+	uint64_t dict_size;
+	uint64_t ring_offset;
+	uint64_t ring_size;
+	uint64_t dict_used;
+	uint64_t head;
+	uint64_t tail;
+	uint64_t overwritten;
+	int64_t  created_sec;
+};
+
+// Followed by the encoded arguments, padded to a multiple of eight bytes.
+// Inline strings are stored as leading string arguments, the component
+// first. A string argument is a uint32_t length and the characters.
+struct RecordHeader
+{
+	uint32_t size;
+	uint32_t format_id;
+	uint32_t component_id;
+	uint16_t level;
+	uint16_t flags;
+	int64_t  sec;
+	int32_t  usec;
+	uint32_t num_args;
+};
+
+} // end namespace binlog
+/// @endcond
+
+class BinaryLogger : public Logger
+{
+public:
+	BinaryLogger(const char *filename_pattern,
+	             size_t      ring_size = 16 * 1024 * 1024,
+	             LogLevel    log_level = LL_DEBUG);
+	virtual ~BinaryLogger();
+
+	const char *filename() const;
+
+	virtual bool defers_formatting() const;
+
+	virtual void log_debug(const char *component, const char *format, ...);
+	virtual void log_info(const char *component, const char *format, ...);
+	virtual void log_warn(const char *component, const char *format, ...);
+	virtual void log_error(const char *component, const char *format, ...);
+
+	virtual void vlog_debug(const char *component, const char *format, va_list va);
+	virtual void vlog_info(const char *component, const char *format, va_list va);
+	virtual void vlog_warn(const char *component, const char *format, va_list va);
+	virtual void vlog_error(const char *component, const char *format, va_list va);
+
+	virtual void log_debug(const char *component, fawkes::Exception &e);
+	virtual void log_info(const char *component, fawkes::Exception &e);
+	virtual void log_warn(const char *component, fawkes::Exception &e);
+	virtual void log_error(const char *component, fawkes::Exception &e);
+
+	virtual void tlog_debug(struct timeval *t, const char *component, const char *format, ...);
+	virtual void tlog_info(struct timeval *t, const char *component, const char *format, ...);
+	virtual void tlog_warn(struct timeval *t, const char *component, const char *format, ...);
+	virtual void tlog_error(struct timeval *t, const char *component, const char *format, ...);
+
+	virtual void tlog_debug(struct timeval *t, const char *component, fawkes::Exception &e);
+	virtual void tlog_info(struct timeval *t, const char *component, fawkes::Exception &e);
+	virtual void tlog_warn(struct timeval *t, const char *component, fawkes::Exception &e);
+	virtual void tlog_error(struct timeval *t, const char *component, fawkes::Exception &e);
+
+	virtual void
+	             vtlog_debug(struct timeval *t, const char *component, const char *format, va_list va);
+	virtual void vtlog_info(struct timeval *t, const char *component, const char *format, va_list va);
+	virtual void vtlog_warn(struct timeval *t, const char *component, const char *format, va_list va);
+	virtual void
+	vtlog_error(struct timeval *t, const char *component, const char *format, va_list va);
+
+private:
+	void     write(LogLevel        level,
+	               struct timeval *t,
+	               const char *    component,
+	               const char *    format,
+	               va_list         va);
+	void     write(LogLevel level, struct timeval *t, const char *component, fawkes::Exception &e);
+	uint32_t intern(const char *str);
+	void     append(binlog::RecordHeader &rh);
+	void     reserve(uint64_t size);
+	bool     encode_args(const char *format, va_list va, uint32_t &num_args);
+	void     encode_string(const char *str);
+
+private:
+	std::string          filename_;
+	fawkes::Mutex *      mutex_;
+	int                  fd_;
+	size_t               mapped_size_;
+	unsigned char *      mapped_;
+	binlog::FileHeader * header_;
+	char *               dict_;
+	unsigned char *      ring_;
+	uint32_t             format_s_id_;
+	std::vector<uint8_t> args_;
+
+	std::unordered_map<const char *, uint32_t> ids_by_ptr_;
+	std::unordered_map<std::string, uint32_t>  ids_by_str_;
+};
+
+class BinaryLogReader
+{
+public:
+	/** A decoded log record. */
+	struct Entry
+	{
+		Logger::LogLevel level;     /**< log level */
+		struct timeval   time;      /**< time of the message */
+		bool             exception; /**< true if the message is part of an exception */
+		std::string      component; /**< component that logged the message */
+		std::string      message;   /**< formatted message */
+	};
+
+	BinaryLogReader(const char *filename);
+	~BinaryLogReader();
+
+	bool     next(Entry &entry);
+	void     rewind();
+	uint64_t overwritten() const;
+	time_t   created() const;
+
+private:
+	const char *dict_string(uint32_t id) const;
+	bool        format(const char *         format,
+	                   const unsigned char *args,
+	                   const unsigned char *end,
+	                   std::string &        out);
+
+private:
+	std::vector<unsigned char> data_;
+	binlog::FileHeader         header_;
+	const unsigned char *      ring_;
+	uint64_t                   pos_;
+};
+
+} // end namespace llsfrb
+
+#endif
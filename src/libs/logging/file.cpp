@@ -48,7 +48,8 @@ namespace llsfrb {
  * @param filename_pattern the name of the log-file, $time will be replaced by a timestamp
  * @param log_level minimum log level
  */
-FileLogger::FileLogger(const char *filename_pattern, LogLevel log_level) : Logger(log_level)
+FileLogger::FileLogger(const char *filename_pattern, LogLevel log_level)
+: Logger(log_level), batching_(false)
 {
 	now_s = (struct tm *)malloc(sizeof(struct tm));
 	struct timeval now;
@@ -176,7 +177,9 @@ FileLogger::log_debug(const char *component, fawkes::Exception &e)
 			fprintf(log_file, "%s", *i);
 			fprintf(log_file, "\n");
 		}
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -201,7 +204,9 @@ FileLogger::log_info(const char *component, fawkes::Exception &e)
 			fprintf(log_file, "%s", *i);
 			fprintf(log_file, "\n");
 		}
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -226,7 +231,9 @@ FileLogger::log_warn(const char *component, fawkes::Exception &e)
 			fprintf(log_file, "%s", *i);
 			fprintf(log_file, "\n");
 		}
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -251,7 +258,9 @@ FileLogger::log_error(const char *component, fawkes::Exception &e)
 			fprintf(log_file, "%s", *i);
 			fprintf(log_file, "\n");
 		}
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -274,7 +283,9 @@ FileLogger::vlog_debug(const char *component, const char *format, va_list va)
 		        component);
 		vfprintf(log_file, format, va);
 		fprintf(log_file, "\n");
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -297,7 +308,9 @@ FileLogger::vlog_info(const char *component, const char *format, va_list va)
 		        component);
 		vfprintf(log_file, format, va);
 		fprintf(log_file, "\n");
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -320,7 +333,9 @@ FileLogger::vlog_warn(const char *component, const char *format, va_list va)
 		        component);
 		vfprintf(log_file, format, va);
 		fprintf(log_file, "\n");
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -343,7 +358,9 @@ FileLogger::vlog_error(const char *component, const char *format, va_list va)
 		        component);
 		vfprintf(log_file, format, va);
 		fprintf(log_file, "\n");
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -402,7 +419,9 @@ FileLogger::tlog_debug(struct timeval *t, const char *component, fawkes::Excepti
 			fprintf(log_file, "%s", *i);
 			fprintf(log_file, "\n");
 		}
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -425,7 +444,9 @@ FileLogger::tlog_info(struct timeval *t, const char *component, fawkes::Exceptio
 			fprintf(log_file, "%s", *i);
 			fprintf(log_file, "\n");
 		}
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -448,7 +469,9 @@ FileLogger::tlog_warn(struct timeval *t, const char *component, fawkes::Exceptio
 			fprintf(log_file, "%s", *i);
 			fprintf(log_file, "\n");
 		}
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -471,7 +494,9 @@ FileLogger::tlog_error(struct timeval *t, const char *component, fawkes::Excepti
 			fprintf(log_file, "%s", *i);
 			fprintf(log_file, "\n");
 		}
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -492,7 +517,9 @@ FileLogger::vtlog_debug(struct timeval *t, const char *component, const char *fo
 		        component);
 		vfprintf(log_file, format, va);
 		fprintf(log_file, "\n");
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -513,7 +540,9 @@ FileLogger::vtlog_info(struct timeval *t, const char *component, const char *for
 		        component);
 		vfprintf(log_file, format, va);
 		fprintf(log_file, "\n");
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -534,7 +563,9 @@ FileLogger::vtlog_warn(struct timeval *t, const char *component, const char *for
 		        component);
 		vfprintf(log_file, format, va);
 		fprintf(log_file, "\n");
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
@@ -555,9 +586,32 @@ FileLogger::vtlog_error(struct timeval *t, const char *component, const char *fo
 		        component);
 		vfprintf(log_file, format, va);
 		fprintf(log_file, "\n");
-		fflush(log_file);
+		if (!batching_) {
+			fflush(log_file);
+		}
 		mutex->unlock();
 	}
 }
 
+/** Begin a batch of messages.
+ * While batching, the log file is not flushed after every line.
+ */
+void
+FileLogger::begin_batch()
+{
+	mutex->lock();
+	batching_ = true;
+	mutex->unlock();
+}
+
+/** End a batch of messages and flush the log file. */
+void
+FileLogger::end_batch()
+{
+	mutex->lock();
+	batching_ = false;
+	fflush(log_file);
+	mutex->unlock();
+}
+
 } // end namespace llsfrb
@@ -72,8 +72,12 @@ public:
 	virtual void
 	vtlog_error(struct timeval *t, const char *component, const char *format, va_list va);
 
+	virtual void begin_batch();
+	virtual void end_batch();
+
 private:
 	struct ::tm *now_s;
+	bool         batching_;
 
 	FILE *         log_file;
 	fawkes::Mutex *mutex;
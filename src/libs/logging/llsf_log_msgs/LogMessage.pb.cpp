@@ -0,0 +1,610 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: LogMessage.proto
+
+#include "LogMessage.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_log_msgs {
+PROTOBUF_CONSTEXPR LogMessage::LogMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.component_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ts_sec_)*/int64_t{0}
+  , /*decltype(_impl_.ts_nsec_)*/int64_t{0}
+  , /*decltype(_impl_.log_level_)*/0
+  , /*decltype(_impl_.is_exception_)*/false} {}
+struct LogMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogMessageDefaultTypeInternal() {}
+  union {
+    LogMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogMessageDefaultTypeInternal _LogMessage_default_instance_;
+}  // namespace llsf_log_msgs
+static ::_pb::Metadata file_level_metadata_LogMessage_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_LogMessage_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_LogMessage_2eproto = nullptr;
+
+const uint32_t TableStruct_LogMessage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_log_msgs::LogMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_log_msgs::LogMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_log_msgs::LogMessage, _impl_.ts_sec_),
+  PROTOBUF_FIELD_OFFSET(::llsf_log_msgs::LogMessage, _impl_.ts_nsec_),
+  PROTOBUF_FIELD_OFFSET(::llsf_log_msgs::LogMessage, _impl_.log_level_),
+  PROTOBUF_FIELD_OFFSET(::llsf_log_msgs::LogMessage, _impl_.component_),
+  PROTOBUF_FIELD_OFFSET(::llsf_log_msgs::LogMessage, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::llsf_log_msgs::LogMessage, _impl_.is_exception_),
+  2,
+  3,
+  4,
+  0,
+  1,
+  5,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::llsf_log_msgs::LogMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_log_msgs::_LogMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_LogMessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020LogMessage.proto\022\rllsf_log_msgs\"\234\002\n\nLo"
+  "gMessage\022\016\n\006ts_sec\030\001 \002(\003\022\017\n\007ts_nsec\030\002 \002("
+  "\003\0225\n\tlog_level\030\003 \002(\0162\".llsf_log_msgs.Log"
+  "Message.LogLevel\022\021\n\tcomponent\030\004 \002(\t\022\017\n\007m"
+  "essage\030\005 \002(\t\022\033\n\014is_exception\030\006 \001(\010:\005fals"
+  "e\"&\n\010CompType\022\014\n\007COMP_ID\020\323\017\022\014\n\010MSG_TYPE\020"
+  "\001\"M\n\010LogLevel\022\014\n\010LL_DEBUG\020\000\022\013\n\007LL_INFO\020\001"
+  "\022\013\n\007LL_WARN\020\002\022\014\n\010LL_ERROR\020\004\022\013\n\007LL_NONE\020\010"
+  ;
+static ::_pbi::once_flag descriptor_table_LogMessage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_LogMessage_2eproto = {
+    false, false, 320, descriptor_table_protodef_LogMessage_2eproto,
+    "LogMessage.proto",
+    &descriptor_table_LogMessage_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_LogMessage_2eproto::offsets,
+    file_level_metadata_LogMessage_2eproto, file_level_enum_descriptors_LogMessage_2eproto,
+    file_level_service_descriptors_LogMessage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_LogMessage_2eproto_getter() {
+  return &descriptor_table_LogMessage_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_LogMessage_2eproto(&descriptor_table_LogMessage_2eproto);
+namespace llsf_log_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LogMessage_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_LogMessage_2eproto);
+  return file_level_enum_descriptors_LogMessage_2eproto[0];
+}
+bool LogMessage_CompType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2003:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr LogMessage_CompType LogMessage::COMP_ID;
+constexpr LogMessage_CompType LogMessage::MSG_TYPE;
+constexpr LogMessage_CompType LogMessage::CompType_MIN;
+constexpr LogMessage_CompType LogMessage::CompType_MAX;
+constexpr int LogMessage::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LogMessage_LogLevel_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_LogMessage_2eproto);
+  return file_level_enum_descriptors_LogMessage_2eproto[1];
+}
+bool LogMessage_LogLevel_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 4:
+    case 8:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr LogMessage_LogLevel LogMessage::LL_DEBUG;
+constexpr LogMessage_LogLevel LogMessage::LL_INFO;
+constexpr LogMessage_LogLevel LogMessage::LL_WARN;
+constexpr LogMessage_LogLevel LogMessage::LL_ERROR;
+constexpr LogMessage_LogLevel LogMessage::LL_NONE;
+constexpr LogMessage_LogLevel LogMessage::LogLevel_MIN;
+constexpr LogMessage_LogLevel LogMessage::LogLevel_MAX;
+constexpr int LogMessage::LogLevel_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class LogMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogMessage>()._impl_._has_bits_);
+  static void set_has_ts_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ts_nsec(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_log_level(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_component(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_is_exception(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+LogMessage::LogMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_log_msgs.LogMessage)
+}
+LogMessage::LogMessage(const LogMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.component_){}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.ts_sec_){}
+    , decltype(_impl_.ts_nsec_){}
+    , decltype(_impl_.log_level_){}
+    , decltype(_impl_.is_exception_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.component_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.component_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_component()) {
+    _this->_impl_.component_.Set(from._internal_component(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.ts_sec_, &from._impl_.ts_sec_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_exception_) -
+    reinterpret_cast<char*>(&_impl_.ts_sec_)) + sizeof(_impl_.is_exception_));
+  // @@protoc_insertion_point(copy_constructor:llsf_log_msgs.LogMessage)
+}
+
+inline void LogMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.component_){}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.ts_sec_){int64_t{0}}
+    , decltype(_impl_.ts_nsec_){int64_t{0}}
+    , decltype(_impl_.log_level_){0}
+    , decltype(_impl_.is_exception_){false}
+  };
+  _impl_.component_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.component_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LogMessage::~LogMessage() {
+  // @@protoc_insertion_point(destructor:llsf_log_msgs.LogMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.component_.Destroy();
+  _impl_.message_.Destroy();
+}
+
+void LogMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_log_msgs.LogMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.component_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.message_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000003cu) {
+    ::memset(&_impl_.ts_sec_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.is_exception_) -
+        reinterpret_cast<char*>(&_impl_.ts_sec_)) + sizeof(_impl_.is_exception_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int64 ts_sec = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_ts_sec(&has_bits);
+          _impl_.ts_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 ts_nsec = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_ts_nsec(&has_bits);
+          _impl_.ts_nsec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_log_msgs.LogMessage.LogLevel log_level = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_log_msgs::LogMessage_LogLevel_IsValid(val))) {
+            _internal_set_log_level(static_cast<::llsf_log_msgs::LogMessage_LogLevel>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required string component = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_component();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_log_msgs.LogMessage.component");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string message = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_log_msgs.LogMessage.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_exception = 6 [default = false];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_is_exception(&has_bits);
+          _impl_.is_exception_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_log_msgs.LogMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int64 ts_sec = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_ts_sec(), target);
+  }
+
+  // required int64 ts_nsec = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_ts_nsec(), target);
+  }
+
+  // required .llsf_log_msgs.LogMessage.LogLevel log_level = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_log_level(), target);
+  }
+
+  // required string component = 4;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_component().data(), static_cast<int>(this->_internal_component().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_log_msgs.LogMessage.component");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_component(), target);
+  }
+
+  // required string message = 5;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_log_msgs.LogMessage.message");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_message(), target);
+  }
+
+  // optional bool is_exception = 6 [default = false];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_is_exception(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_log_msgs.LogMessage)
+  return target;
+}
+
+size_t LogMessage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_log_msgs.LogMessage)
+  size_t total_size = 0;
+
+  if (_internal_has_component()) {
+    // required string component = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_component());
+  }
+
+  if (_internal_has_message()) {
+    // required string message = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  if (_internal_has_ts_sec()) {
+    // required int64 ts_sec = 1;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ts_sec());
+  }
+
+  if (_internal_has_ts_nsec()) {
+    // required int64 ts_nsec = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ts_nsec());
+  }
+
+  if (_internal_has_log_level()) {
+    // required .llsf_log_msgs.LogMessage.LogLevel log_level = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_log_level());
+  }
+
+  return total_size;
+}
+size_t LogMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_log_msgs.LogMessage)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required string component = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_component());
+
+    // required string message = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+
+    // required int64 ts_sec = 1;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ts_sec());
+
+    // required int64 ts_nsec = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ts_nsec());
+
+    // required .llsf_log_msgs.LogMessage.LogLevel log_level = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_log_level());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bool is_exception = 6 [default = false];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000020u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogMessage::GetClassData() const { return &_class_data_; }
+
+
+void LogMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogMessage*>(&to_msg);
+  auto& from = static_cast<const LogMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_log_msgs.LogMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_component(from._internal_component());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_message(from._internal_message());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.ts_sec_ = from._impl_.ts_sec_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.ts_nsec_ = from._impl_.ts_nsec_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.log_level_ = from._impl_.log_level_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.is_exception_ = from._impl_.is_exception_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogMessage::CopyFrom(const LogMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_log_msgs.LogMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void LogMessage::InternalSwap(LogMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.component_, lhs_arena,
+      &other->_impl_.component_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogMessage, _impl_.is_exception_)
+      + sizeof(LogMessage::_impl_.is_exception_)
+      - PROTOBUF_FIELD_OFFSET(LogMessage, _impl_.ts_sec_)>(
+          reinterpret_cast<char*>(&_impl_.ts_sec_),
+          reinterpret_cast<char*>(&other->_impl_.ts_sec_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_LogMessage_2eproto_getter, &descriptor_table_LogMessage_2eproto_once,
+      file_level_metadata_LogMessage_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_log_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_log_msgs::LogMessage*
+Arena::CreateMaybeMessage< ::llsf_log_msgs::LogMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_log_msgs::LogMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
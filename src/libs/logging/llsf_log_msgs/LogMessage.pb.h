@@ -0,0 +1,707 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: LogMessage.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_LogMessage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_LogMessage_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_LogMessage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_LogMessage_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_LogMessage_2eproto;
+namespace llsf_log_msgs {
+class LogMessage;
+struct LogMessageDefaultTypeInternal;
+extern LogMessageDefaultTypeInternal _LogMessage_default_instance_;
+}  // namespace llsf_log_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_log_msgs::LogMessage* Arena::CreateMaybeMessage<::llsf_log_msgs::LogMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_log_msgs {
+
+enum LogMessage_CompType : int {
+  LogMessage_CompType_COMP_ID = 2003,
+  LogMessage_CompType_MSG_TYPE = 1
+};
+bool LogMessage_CompType_IsValid(int value);
+constexpr LogMessage_CompType LogMessage_CompType_CompType_MIN = LogMessage_CompType_MSG_TYPE;
+constexpr LogMessage_CompType LogMessage_CompType_CompType_MAX = LogMessage_CompType_COMP_ID;
+constexpr int LogMessage_CompType_CompType_ARRAYSIZE = LogMessage_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LogMessage_CompType_descriptor();
+template<typename T>
+inline const std::string& LogMessage_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, LogMessage_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function LogMessage_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    LogMessage_CompType_descriptor(), enum_t_value);
+}
+inline bool LogMessage_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, LogMessage_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<LogMessage_CompType>(
+    LogMessage_CompType_descriptor(), name, value);
+}
+enum LogMessage_LogLevel : int {
+  LogMessage_LogLevel_LL_DEBUG = 0,
+  LogMessage_LogLevel_LL_INFO = 1,
+  LogMessage_LogLevel_LL_WARN = 2,
+  LogMessage_LogLevel_LL_ERROR = 4,
+  LogMessage_LogLevel_LL_NONE = 8
+};
+bool LogMessage_LogLevel_IsValid(int value);
+constexpr LogMessage_LogLevel LogMessage_LogLevel_LogLevel_MIN = LogMessage_LogLevel_LL_DEBUG;
+constexpr LogMessage_LogLevel LogMessage_LogLevel_LogLevel_MAX = LogMessage_LogLevel_LL_NONE;
+constexpr int LogMessage_LogLevel_LogLevel_ARRAYSIZE = LogMessage_LogLevel_LogLevel_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LogMessage_LogLevel_descriptor();
+template<typename T>
+inline const std::string& LogMessage_LogLevel_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, LogMessage_LogLevel>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function LogMessage_LogLevel_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    LogMessage_LogLevel_descriptor(), enum_t_value);
+}
+inline bool LogMessage_LogLevel_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, LogMessage_LogLevel* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<LogMessage_LogLevel>(
+    LogMessage_LogLevel_descriptor(), name, value);
+}
+// ===================================================================
+
+class LogMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_log_msgs.LogMessage) */ {
+ public:
+  inline LogMessage() : LogMessage(nullptr) {}
+  ~LogMessage() override;
+  explicit PROTOBUF_CONSTEXPR LogMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogMessage(const LogMessage& from);
+  LogMessage(LogMessage&& from) noexcept
+    : LogMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline LogMessage& operator=(const LogMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogMessage& operator=(LogMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogMessage* internal_default_instance() {
+    return reinterpret_cast<const LogMessage*>(
+               &_LogMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(LogMessage& a, LogMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogMessage& from) {
+    LogMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_log_msgs.LogMessage";
+  }
+  protected:
+  explicit LogMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef LogMessage_CompType CompType;
+  static constexpr CompType COMP_ID =
+    LogMessage_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    LogMessage_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return LogMessage_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    LogMessage_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    LogMessage_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    LogMessage_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return LogMessage_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return LogMessage_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return LogMessage_CompType_Parse(name, value);
+  }
+
+  typedef LogMessage_LogLevel LogLevel;
+  static constexpr LogLevel LL_DEBUG =
+    LogMessage_LogLevel_LL_DEBUG;
+  static constexpr LogLevel LL_INFO =
+    LogMessage_LogLevel_LL_INFO;
+  static constexpr LogLevel LL_WARN =
+    LogMessage_LogLevel_LL_WARN;
+  static constexpr LogLevel LL_ERROR =
+    LogMessage_LogLevel_LL_ERROR;
+  static constexpr LogLevel LL_NONE =
+    LogMessage_LogLevel_LL_NONE;
+  static inline bool LogLevel_IsValid(int value) {
+    return LogMessage_LogLevel_IsValid(value);
+  }
+  static constexpr LogLevel LogLevel_MIN =
+    LogMessage_LogLevel_LogLevel_MIN;
+  static constexpr LogLevel LogLevel_MAX =
+    LogMessage_LogLevel_LogLevel_MAX;
+  static constexpr int LogLevel_ARRAYSIZE =
+    LogMessage_LogLevel_LogLevel_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  LogLevel_descriptor() {
+    return LogMessage_LogLevel_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& LogLevel_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, LogLevel>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function LogLevel_Name.");
+    return LogMessage_LogLevel_Name(enum_t_value);
+  }
+  static inline bool LogLevel_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      LogLevel* value) {
+    return LogMessage_LogLevel_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kComponentFieldNumber = 4,
+    kMessageFieldNumber = 5,
+    kTsSecFieldNumber = 1,
+    kTsNsecFieldNumber = 2,
+    kLogLevelFieldNumber = 3,
+    kIsExceptionFieldNumber = 6,
+  };
+  // required string component = 4;
+  bool has_component() const;
+  private:
+  bool _internal_has_component() const;
+  public:
+  void clear_component();
+  const std::string& component() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_component(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_component();
+  PROTOBUF_NODISCARD std::string* release_component();
+  void set_allocated_component(std::string* component);
+  private:
+  const std::string& _internal_component() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_component(const std::string& value);
+  std::string* _internal_mutable_component();
+  public:
+
+  // required string message = 5;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // required int64 ts_sec = 1;
+  bool has_ts_sec() const;
+  private:
+  bool _internal_has_ts_sec() const;
+  public:
+  void clear_ts_sec();
+  int64_t ts_sec() const;
+  void set_ts_sec(int64_t value);
+  private:
+  int64_t _internal_ts_sec() const;
+  void _internal_set_ts_sec(int64_t value);
+  public:
+
+  // required int64 ts_nsec = 2;
+  bool has_ts_nsec() const;
+  private:
+  bool _internal_has_ts_nsec() const;
+  public:
+  void clear_ts_nsec();
+  int64_t ts_nsec() const;
+  void set_ts_nsec(int64_t value);
+  private:
+  int64_t _internal_ts_nsec() const;
+  void _internal_set_ts_nsec(int64_t value);
+  public:
+
+  // required .llsf_log_msgs.LogMessage.LogLevel log_level = 3;
+  bool has_log_level() const;
+  private:
+  bool _internal_has_log_level() const;
+  public:
+  void clear_log_level();
+  ::llsf_log_msgs::LogMessage_LogLevel log_level() const;
+  void set_log_level(::llsf_log_msgs::LogMessage_LogLevel value);
+  private:
+  ::llsf_log_msgs::LogMessage_LogLevel _internal_log_level() const;
+  void _internal_set_log_level(::llsf_log_msgs::LogMessage_LogLevel value);
+  public:
+
+  // optional bool is_exception = 6 [default = false];
+  bool has_is_exception() const;
+  private:
+  bool _internal_has_is_exception() const;
+  public:
+  void clear_is_exception();
+  bool is_exception() const;
+  void set_is_exception(bool value);
+  private:
+  bool _internal_is_exception() const;
+  void _internal_set_is_exception(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_log_msgs.LogMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr component_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int64_t ts_sec_;
+    int64_t ts_nsec_;
+    int log_level_;
+    bool is_exception_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_LogMessage_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LogMessage
+
+// required int64 ts_sec = 1;
+inline bool LogMessage::_internal_has_ts_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool LogMessage::has_ts_sec() const {
+  return _internal_has_ts_sec();
+}
+inline void LogMessage::clear_ts_sec() {
+  _impl_.ts_sec_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int64_t LogMessage::_internal_ts_sec() const {
+  return _impl_.ts_sec_;
+}
+inline int64_t LogMessage::ts_sec() const {
+  // @@protoc_insertion_point(field_get:llsf_log_msgs.LogMessage.ts_sec)
+  return _internal_ts_sec();
+}
+inline void LogMessage::_internal_set_ts_sec(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.ts_sec_ = value;
+}
+inline void LogMessage::set_ts_sec(int64_t value) {
+  _internal_set_ts_sec(value);
+  // @@protoc_insertion_point(field_set:llsf_log_msgs.LogMessage.ts_sec)
+}
+
+// required int64 ts_nsec = 2;
+inline bool LogMessage::_internal_has_ts_nsec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool LogMessage::has_ts_nsec() const {
+  return _internal_has_ts_nsec();
+}
+inline void LogMessage::clear_ts_nsec() {
+  _impl_.ts_nsec_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t LogMessage::_internal_ts_nsec() const {
+  return _impl_.ts_nsec_;
+}
+inline int64_t LogMessage::ts_nsec() const {
+  // @@protoc_insertion_point(field_get:llsf_log_msgs.LogMessage.ts_nsec)
+  return _internal_ts_nsec();
+}
+inline void LogMessage::_internal_set_ts_nsec(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.ts_nsec_ = value;
+}
+inline void LogMessage::set_ts_nsec(int64_t value) {
+  _internal_set_ts_nsec(value);
+  // @@protoc_insertion_point(field_set:llsf_log_msgs.LogMessage.ts_nsec)
+}
+
+// required .llsf_log_msgs.LogMessage.LogLevel log_level = 3;
+inline bool LogMessage::_internal_has_log_level() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool LogMessage::has_log_level() const {
+  return _internal_has_log_level();
+}
+inline void LogMessage::clear_log_level() {
+  _impl_.log_level_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::llsf_log_msgs::LogMessage_LogLevel LogMessage::_internal_log_level() const {
+  return static_cast< ::llsf_log_msgs::LogMessage_LogLevel >(_impl_.log_level_);
+}
+inline ::llsf_log_msgs::LogMessage_LogLevel LogMessage::log_level() const {
+  // @@protoc_insertion_point(field_get:llsf_log_msgs.LogMessage.log_level)
+  return _internal_log_level();
+}
+inline void LogMessage::_internal_set_log_level(::llsf_log_msgs::LogMessage_LogLevel value) {
+  assert(::llsf_log_msgs::LogMessage_LogLevel_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.log_level_ = value;
+}
+inline void LogMessage::set_log_level(::llsf_log_msgs::LogMessage_LogLevel value) {
+  _internal_set_log_level(value);
+  // @@protoc_insertion_point(field_set:llsf_log_msgs.LogMessage.log_level)
+}
+
+// required string component = 4;
+inline bool LogMessage::_internal_has_component() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LogMessage::has_component() const {
+  return _internal_has_component();
+}
+inline void LogMessage::clear_component() {
+  _impl_.component_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& LogMessage::component() const {
+  // @@protoc_insertion_point(field_get:llsf_log_msgs.LogMessage.component)
+  return _internal_component();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogMessage::set_component(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.component_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_log_msgs.LogMessage.component)
+}
+inline std::string* LogMessage::mutable_component() {
+  std::string* _s = _internal_mutable_component();
+  // @@protoc_insertion_point(field_mutable:llsf_log_msgs.LogMessage.component)
+  return _s;
+}
+inline const std::string& LogMessage::_internal_component() const {
+  return _impl_.component_.Get();
+}
+inline void LogMessage::_internal_set_component(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.component_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogMessage::_internal_mutable_component() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.component_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogMessage::release_component() {
+  // @@protoc_insertion_point(field_release:llsf_log_msgs.LogMessage.component)
+  if (!_internal_has_component()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.component_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.component_.IsDefault()) {
+    _impl_.component_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogMessage::set_allocated_component(std::string* component) {
+  if (component != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.component_.SetAllocated(component, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.component_.IsDefault()) {
+    _impl_.component_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_log_msgs.LogMessage.component)
+}
+
+// required string message = 5;
+inline bool LogMessage::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LogMessage::has_message() const {
+  return _internal_has_message();
+}
+inline void LogMessage::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& LogMessage::message() const {
+  // @@protoc_insertion_point(field_get:llsf_log_msgs.LogMessage.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogMessage::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_log_msgs.LogMessage.message)
+}
+inline std::string* LogMessage::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:llsf_log_msgs.LogMessage.message)
+  return _s;
+}
+inline const std::string& LogMessage::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void LogMessage::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogMessage::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogMessage::release_message() {
+  // @@protoc_insertion_point(field_release:llsf_log_msgs.LogMessage.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void LogMessage::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_log_msgs.LogMessage.message)
+}
+
+// optional bool is_exception = 6 [default = false];
+inline bool LogMessage::_internal_has_is_exception() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool LogMessage::has_is_exception() const {
+  return _internal_has_is_exception();
+}
+inline void LogMessage::clear_is_exception() {
+  _impl_.is_exception_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool LogMessage::_internal_is_exception() const {
+  return _impl_.is_exception_;
+}
+inline bool LogMessage::is_exception() const {
+  // @@protoc_insertion_point(field_get:llsf_log_msgs.LogMessage.is_exception)
+  return _internal_is_exception();
+}
+inline void LogMessage::_internal_set_is_exception(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.is_exception_ = value;
+}
+inline void LogMessage::set_is_exception(bool value) {
+  _internal_set_is_exception(value);
+  // @@protoc_insertion_point(field_set:llsf_log_msgs.LogMessage.is_exception)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_log_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_log_msgs::LogMessage_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_log_msgs::LogMessage_CompType>() {
+  return ::llsf_log_msgs::LogMessage_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_log_msgs::LogMessage_LogLevel> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_log_msgs::LogMessage_LogLevel>() {
+  return ::llsf_log_msgs::LogMessage_LogLevel_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_LogMessage_2eproto
@@ -253,6 +253,39 @@ Logger::loglevel()
 	return log_level;
 }
 
+/** Begin a batch of messages.
+ * Called by an asynchronous MultiLogger before it hands a batch of queued
+ * messages to this logger. Loggers may defer expensive per-message work,
+ * like flushing a file, until end_batch() is called. The default
+ * implementation does nothing.
+ */
+void
+Logger::begin_batch()
+{
+}
+
+/** End a batch of messages.
+ * Counterpart to begin_batch(), called after the last message of a batch
+ * has been logged. The default implementation does nothing.
+ */
+void
+Logger::end_batch()
+{
+}
+
+/** Check if the logger stores messages without formatting them.
+ * Such a logger must be cheap to call and thread-safe. An asynchronous
+ * MultiLogger calls it directly with the format and the arguments of a
+ * message instead of queueing the formatted message. The default
+ * implementation returns false.
+ * @return true if messages are formatted only when they are read
+ */
+bool
+Logger::defers_formatting() const
+{
+	return false;
+}
+
 /** Log message for given log level.
  * @param level log level
  * @param component component, used to distuinguish logged messages
@@ -101,6 +101,10 @@ public:
 	virtual void
 	vtlog_error(struct timeval *t, const char *component, const char *format, va_list va) = 0;
 
+	virtual void begin_batch();
+	virtual void end_batch();
+	virtual bool defers_formatting() const;
+
 protected:
 	/** Minimum log level.
    * A logger shall only log output with a level equal or above the given level,
@@ -4,6 +4,7 @@
  *
  *  Created: Mon May 07 16:44:15 2007
  *  Copyright  2006-2007  Tim Niemueller [www.niemueller.de]
+ *             2026  agent <agent@local>
  *
  ****************************************************************************/
 
@@ -27,15 +28,59 @@
 #include <logging/multi.h>
 #include <sys/time.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <time.h>
+#include <vector>
 
 namespace llsfrb {
 
 /// @cond INTERNALS
+/** Maximum number of records handed to the sub-loggers in one batch. */
+#define MULTILOGGER_MAX_BATCH 256
+/** Maximum time the dispatcher sleeps without being notified. */
+#define MULTILOGGER_IDLE_WAIT_MSEC 100
+/** Size of the on-stack buffer for formatting queued messages. */
+#define MULTILOGGER_FORMAT_BUFSIZE 512
+
+struct MultiLoggerRecord
+{
+	Logger::LogLevel                   level;
+	struct timeval                     time;
+	std::string                        component;
+	std::string                        message;
+	std::unique_ptr<fawkes::Exception> exception;
+};
+
+struct MultiLoggerSlot
+{
+	std::atomic<size_t> seq;
+	MultiLoggerRecord   record;
+};
+
 class MultiLoggerData
 {
 public:
 	MultiLoggerData()
+	: async(false),
+	  running(false),
+	  producers(0),
+	  ring_mask(0),
+	  enqueue_pos(0),
+	  dequeue_pos(0),
+	  waiting(false),
+	  lost(0),
+	  lost_reported(0),
+	  debug_counter(0),
+	  debug_sample_rate(1),
+	  min_level(Logger::LL_DEBUG)
 	{
 		mutex = new fawkes::Mutex();
 	}
@@ -50,7 +95,92 @@ public:
 	fawkes::LockList<Logger *>::iterator logit;
 	fawkes::Mutex *                      mutex;
 	fawkes::Thread::CancelState          old_state;
+
+	// asynchronous mode, bounded MPSC ring after D. Vyukov
+	std::atomic<bool>                  async;
+	std::atomic<bool>                  running;
+	std::atomic<unsigned int>          producers;
+	std::unique_ptr<MultiLoggerSlot[]> ring;
+	size_t                             ring_mask;
+	std::atomic<size_t>                enqueue_pos;
+	std::atomic<size_t>                dequeue_pos;
+	std::thread                        dispatcher;
+	std::mutex                         wait_mutex;
+	std::condition_variable            wait_cond;
+	std::atomic<bool>                  waiting;
+	std::atomic<uint64_t>              lost;
+	uint64_t                           lost_reported;
+	std::atomic<unsigned int>          debug_counter;
+	unsigned int                       debug_sample_rate;
+	std::atomic<int>                   min_level;
+
+	// sub-loggers called by the logging thread itself in asynchronous mode
+	std::shared_ptr<const std::vector<Logger *>> direct_loggers;
 };
+
+static MultiLoggerSlot *
+ring_claim(MultiLoggerData *data, Logger::LogLevel level, size_t &pos)
+{
+	pos = data->enqueue_pos.load(std::memory_order_relaxed);
+
+	if (level == Logger::LL_DEBUG && data->debug_sample_rate > 1) {
+		// under pressure only keep every n-th debug message
+		ptrdiff_t fill = (ptrdiff_t)(pos - data->dequeue_pos.load(std::memory_order_relaxed));
+		if (fill >= (ptrdiff_t)((data->ring_mask + 1) / 4 * 3)
+		    && data->debug_counter.fetch_add(1, std::memory_order_relaxed) % data->debug_sample_rate
+		         != 0) {
+			data->lost.fetch_add(1, std::memory_order_relaxed);
+			return NULL;
+		}
+	}
+
+	for (;;) {
+		MultiLoggerSlot *slot = &data->ring[pos & data->ring_mask];
+		size_t           seq  = slot->seq.load(std::memory_order_acquire);
+		ptrdiff_t        diff = (ptrdiff_t)seq - (ptrdiff_t)pos;
+		if (diff == 0) {
+			if (data->enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				return slot;
+			}
+		} else if (diff < 0) {
+			// ring is full, never block the caller
+			data->lost.fetch_add(1, std::memory_order_relaxed);
+			return NULL;
+		} else {
+			pos = data->enqueue_pos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+static void
+ring_publish(MultiLoggerData *data, MultiLoggerSlot *slot, size_t pos)
+{
+	slot->seq.store(pos + 1, std::memory_order_release);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (data->waiting.load(std::memory_order_relaxed)) {
+		std::lock_guard<std::mutex> lock(data->wait_mutex);
+		data->wait_cond.notify_one();
+	}
+}
+
+static void
+format_message(std::string &message, const char *format, va_list va)
+{
+	char    buf[MULTILOGGER_FORMAT_BUFSIZE];
+	va_list vac;
+	va_copy(vac, va);
+	int len = vsnprintf(buf, sizeof(buf), format, vac);
+	va_end(vac);
+	if (len < 0) {
+		message.clear();
+	} else if ((size_t)len < sizeof(buf)) {
+		message.assign(buf, len);
+	} else {
+		message.resize(len + 1);
+		vsnprintf(&message[0], len + 1, format, va);
+		message.resize(len);
+	}
+}
 /// @endcond
 
 /** @class MultiLogger <logging/multi.h>
@@ -67,6 +197,18 @@ public:
  * itself. If you want to take over the loggers without destroying them you
  * have to properly remove them before destroying the multi logger.
  *
+ * By default all sub-loggers are called synchronously from the logging
+ * thread. After enable_async() messages are formatted by the caller, put
+ * into a lock-free ring and handed to the sub-loggers in batches by a
+ * background dispatcher thread. The caller then never waits for a slow
+ * sub-logger. If the ring runs full, messages are dropped instead of
+ * blocking; debug messages are already sampled when the ring is filled to
+ * three quarters. The number of dropped messages is available through
+ * lost_records() and reported to the sub-loggers as a warning.
+ * Sub-loggers which defer formatting, like the BinaryLogger, are still
+ * called by the caller with the format and the arguments, they neither
+ * need the formatted message nor the dispatcher.
+ *
  * @author Tim Niemueller
  */
 
@@ -87,13 +229,17 @@ MultiLogger::MultiLogger(Logger *logger)
 {
 	data = new MultiLoggerData();
 	data->loggers.push_back_locked(logger);
+	update_min_level();
 }
 
 /** Destructor.
  * This will destroy all sub-data->loggers (they are deleted).
+ * Queued messages are handed to the sub-loggers before.
  */
 MultiLogger::~MultiLogger()
 {
+	disable_async();
+
 	data->loggers.lock();
 	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
 		delete (*data->logit);
@@ -116,6 +262,7 @@ MultiLogger::add_logger(Logger *logger)
 	data->loggers.sort();
 	data->loggers.unique();
 	data->loggers.unlock();
+	update_min_level();
 	fawkes::Thread::set_cancel_state(data->old_state);
 	data->mutex->unlock();
 }
@@ -130,6 +277,11 @@ MultiLogger::remove_logger(Logger *logger)
 	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
 
 	data->loggers.remove_locked(logger);
+	update_min_level();
+	// callers may still log to the removed logger directly
+	while (data->producers.load() > 0) {
+		std::this_thread::yield();
+	}
 	fawkes::Thread::set_cancel_state(data->old_state);
 	data->mutex->unlock();
 }
@@ -143,92 +295,320 @@ MultiLogger::set_loglevel(LogLevel level)
 	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
 		(*data->logit)->set_loglevel(level);
 	}
+	update_min_level();
 	fawkes::Thread::set_cancel_state(data->old_state);
 	data->mutex->unlock();
 }
 
+/** Enable asynchronous logging.
+ * Starts the dispatcher thread. From now on log calls only format the
+ * message and queue it, the sub-loggers are called from the dispatcher.
+ * Calling this while already in asynchronous mode has no effect.
+ * @param queue_size number of messages that can be queued, rounded up to
+ * the next power of two
+ * @param debug_sample_rate when the queue is filled to three quarters only
+ * every n-th debug message is queued, 1 to disable sampling
+ */
 void
-MultiLogger::log(LogLevel level, const char *component, const char *format, ...)
+MultiLogger::enable_async(unsigned int queue_size, unsigned int debug_sample_rate)
 {
-	struct timeval now;
-	gettimeofday(&now, NULL);
+	data->mutex->lock();
+	if (data->async.load()) {
+		data->mutex->unlock();
+		return;
+	}
+
+	size_t capacity = 2;
+	while (capacity < queue_size) {
+		capacity <<= 1;
+	}
+	data->ring.reset(new MultiLoggerSlot[capacity]);
+	for (size_t i = 0; i < capacity; ++i) {
+		data->ring[i].seq.store(i, std::memory_order_relaxed);
+	}
+	data->ring_mask         = capacity - 1;
+	data->debug_sample_rate = debug_sample_rate > 0 ? debug_sample_rate : 1;
+	data->enqueue_pos.store(0);
+	data->dequeue_pos.store(0);
+	update_min_level();
+
+	data->running.store(true);
+	data->dispatcher = std::thread(&MultiLogger::dispatch_loop, this);
+	data->async.store(true);
+	data->mutex->unlock();
+}
+
+/** Disable asynchronous logging.
+ * Waits until all queued messages have been handed to the sub-loggers and
+ * stops the dispatcher thread. Subsequent log calls are synchronous again.
+ */
+void
+MultiLogger::disable_async()
+{
+	if (!data->async.exchange(false)) {
+		return;
+	}
+	// wait for callers which have seen the async flag before it was cleared
+	while (data->producers.load() > 0) {
+		std::this_thread::yield();
+	}
+	{
+		std::lock_guard<std::mutex> lock(data->wait_mutex);
+		data->running.store(false);
+		data->wait_cond.notify_one();
+	}
+	data->dispatcher.join();
+	data->ring.reset();
+}
+
+/** Check if asynchronous logging is enabled.
+ * @return true if messages are dispatched by a background thread
+ */
+bool
+MultiLogger::is_async() const
+{
+	return data->async.load();
+}
+
+/** Get number of lost records.
+ * @return number of messages that have been dropped or sampled away
+ * because the queue was (nearly) full
+ */
+uint64_t
+MultiLogger::lost_records() const
+{
+	return data->lost.load(std::memory_order_relaxed);
+}
+
+/** Determine the minimum level of all sub-loggers which get queued messages.
+ * Messages below are not even queued. Also determines the sub-loggers
+ * which are called directly. Must be called with the mutex held.
+ */
+void
+MultiLogger::update_min_level()
+{
+	int  min_level = LL_NONE;
+	auto direct    = std::make_shared<std::vector<Logger *>>();
+	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
+		if ((*data->logit)->defers_formatting()) {
+			direct->push_back(*data->logit);
+		} else if ((*data->logit)->loglevel() < min_level) {
+			min_level = (*data->logit)->loglevel();
+		}
+	}
+	data->min_level.store(min_level, std::memory_order_relaxed);
+	std::shared_ptr<const std::vector<Logger *>> current = std::atomic_load(&data->direct_loggers);
+	if (!current || *current != *direct) {
+		std::atomic_store(&data->direct_loggers,
+		                  std::shared_ptr<const std::vector<Logger *>>(std::move(direct)));
+	}
+}
+
+void
+MultiLogger::vdispatch(LogLevel        level,
+                       struct timeval *t,
+                       const char *    component,
+                       const char *    format,
+                       va_list         va)
+{
+	data->producers.fetch_add(1);
+	if (data->async.load()) {
+		for (Logger *l : *std::atomic_load(&data->direct_loggers)) {
+			va_list vac;
+			va_copy(vac, va);
+			l->vtlog(level, t, component, format, vac);
+			va_end(vac);
+		}
+		size_t           pos;
+		MultiLoggerSlot *slot;
+		if (level >= data->min_level.load(std::memory_order_relaxed)
+		    && (slot = ring_claim(data, level, pos)) != NULL) {
+			slot->record.level     = level;
+			slot->record.time      = *t;
+			slot->record.component = component;
+			format_message(slot->record.message, format, va);
+			ring_publish(data, slot, pos);
+		}
+		data->producers.fetch_sub(1);
+		return;
+	}
+	data->producers.fetch_sub(1);
+
 	data->mutex->lock();
 	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
 
-	va_list va;
-	va_start(va, format);
 	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
 		va_list vac;
 		va_copy(vac, va);
-		(*data->logit)->vtlog(level, &now, component, format, vac);
+		(*data->logit)->vtlog(level, t, component, format, vac);
 		va_end(vac);
 	}
-	va_end(va);
 	fawkes::Thread::set_cancel_state(data->old_state);
 	data->mutex->unlock();
 }
 
 void
-MultiLogger::log_debug(const char *component, const char *format, ...)
+MultiLogger::dispatch(LogLevel          level,
+                      struct timeval *  t,
+                      const char *      component,
+                      fawkes::Exception &e)
 {
-	struct timeval now;
-	gettimeofday(&now, NULL);
+	data->producers.fetch_add(1);
+	if (data->async.load()) {
+		for (Logger *l : *std::atomic_load(&data->direct_loggers)) {
+			l->tlog(level, t, component, e);
+		}
+		size_t           pos;
+		MultiLoggerSlot *slot;
+		if (level >= data->min_level.load(std::memory_order_relaxed)
+		    && (slot = ring_claim(data, level, pos)) != NULL) {
+			slot->record.level     = level;
+			slot->record.time      = *t;
+			slot->record.component = component;
+			slot->record.message.clear();
+			slot->record.exception.reset(new fawkes::Exception(e));
+			ring_publish(data, slot, pos);
+		}
+		data->producers.fetch_sub(1);
+		return;
+	}
+	data->producers.fetch_sub(1);
+
 	data->mutex->lock();
 	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
 
-	va_list va;
-	va_start(va, format);
 	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vlog_debug(component, format, vac);
-		va_end(vac);
+		(*data->logit)->tlog(level, t, component, e);
 	}
-	va_end(va);
 	fawkes::Thread::set_cancel_state(data->old_state);
 	data->mutex->unlock();
 }
 
+/** Dispatcher thread main loop.
+ * Takes batches of records from the ring and hands them to the sub-loggers
+ * until asynchronous mode is disabled and the ring has been drained.
+ */
 void
-MultiLogger::log_info(const char *component, const char *format, ...)
+MultiLogger::dispatch_loop()
+{
+	std::vector<MultiLoggerRecord> batch(MULTILOGGER_MAX_BATCH);
+
+	for (;;) {
+		size_t n   = 0;
+		size_t pos = data->dequeue_pos.load(std::memory_order_relaxed);
+		while (n < batch.size()) {
+			MultiLoggerSlot &slot = data->ring[pos & data->ring_mask];
+			if (slot.seq.load(std::memory_order_acquire) != pos + 1)
+				break;
+			// swap strings so that both sides keep their allocated buffers
+			MultiLoggerRecord &r = batch[n++];
+			r.level              = slot.record.level;
+			r.time               = slot.record.time;
+			r.component.swap(slot.record.component);
+			r.message.swap(slot.record.message);
+			r.exception = std::move(slot.record.exception);
+			slot.seq.store(pos + data->ring_mask + 1, std::memory_order_release);
+			data->dequeue_pos.store(++pos, std::memory_order_relaxed);
+		}
+
+		if (n == 0) {
+			if (!data->running.load())
+				break;
+			std::unique_lock<std::mutex> lock(data->wait_mutex);
+			data->waiting.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			MultiLoggerSlot &slot = data->ring[pos & data->ring_mask];
+			if (slot.seq.load(std::memory_order_acquire) != pos + 1 && data->running.load()) {
+				data->wait_cond.wait_for(lock, std::chrono::milliseconds(MULTILOGGER_IDLE_WAIT_MSEC));
+			}
+			data->waiting.store(false, std::memory_order_relaxed);
+			continue;
+		}
+
+		uint64_t lost = data->lost.load(std::memory_order_relaxed);
+
+		data->mutex->lock();
+		for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
+			Logger *l = *data->logit;
+			if (l->defers_formatting()) {
+				// called directly by the logging thread
+				continue;
+			}
+			// a failing sub-logger must neither stop the dispatcher nor the others
+			try {
+				l->begin_batch();
+				for (size_t i = 0; i < n; ++i) {
+					MultiLoggerRecord &r = batch[i];
+					if (r.exception) {
+						l->tlog(r.level, &r.time, r.component.c_str(), *r.exception);
+					} else {
+						l->tlog(r.level, &r.time, r.component.c_str(), "%s", r.message.c_str());
+					}
+				}
+				if (lost != data->lost_reported) {
+					struct timeval now;
+					gettimeofday(&now, NULL);
+					l->tlog_warn(&now,
+					             "MultiLogger",
+					             "Dropped %llu log messages under load",
+					             (unsigned long long)(lost - data->lost_reported));
+				}
+				l->end_batch();
+			} catch (...) {
+			}
+		}
+		data->lost_reported = lost;
+		update_min_level();
+		data->mutex->unlock();
+
+		for (size_t i = 0; i < n; ++i) {
+			batch[i].exception.reset();
+		}
+	}
+}
+
+void
+MultiLogger::log(LogLevel level, const char *component, const char *format, ...)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
+	va_list va;
+	va_start(va, format);
+	vdispatch(level, &now, component, format, va);
+	va_end(va);
+}
 
+void
+MultiLogger::log_debug(const char *component, const char *format, ...)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
 	va_list va;
 	va_start(va, format);
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vlog_info(component, format, vac);
-		va_end(vac);
-	}
+	vdispatch(LL_DEBUG, &now, component, format, va);
 	va_end(va);
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
 }
 
 void
-MultiLogger::log_warn(const char *component, const char *format, ...)
+MultiLogger::log_info(const char *component, const char *format, ...)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
+	va_list va;
+	va_start(va, format);
+	vdispatch(LL_INFO, &now, component, format, va);
+	va_end(va);
+}
 
+void
+MultiLogger::log_warn(const char *component, const char *format, ...)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
 	va_list va;
 	va_start(va, format);
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vlog_warn(component, format, vac);
-		va_end(vac);
-	}
+	vdispatch(LL_WARN, &now, component, format, va);
 	va_end(va);
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
 }
 
 void
@@ -236,20 +616,10 @@ MultiLogger::log_error(const char *component, const char *format, ...)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
 	va_list va;
 	va_start(va, format);
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vlog_error(component, format, vac);
-		va_end(vac);
-	}
+	vdispatch(LL_ERROR, &now, component, format, va);
 	va_end(va);
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
 }
 
 void
@@ -257,14 +627,7 @@ MultiLogger::log(LogLevel level, const char *component, fawkes::Exception &e)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		(*data->logit)->log(level, component, e);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	dispatch(level, &now, component, e);
 }
 
 void
@@ -272,15 +635,7 @@ MultiLogger::log_debug(const char *component, fawkes::Exception &e)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		(*data->logit)->tlog_debug(&now, component, e);
-	}
-
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	dispatch(LL_DEBUG, &now, component, e);
 }
 
 void
@@ -288,14 +643,7 @@ MultiLogger::log_info(const char *component, fawkes::Exception &e)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		(*data->logit)->tlog_info(&now, component, e);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	dispatch(LL_INFO, &now, component, e);
 }
 
 void
@@ -303,14 +651,7 @@ MultiLogger::log_warn(const char *component, fawkes::Exception &e)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		(*data->logit)->tlog_warn(&now, component, e);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	dispatch(LL_WARN, &now, component, e);
 }
 
 void
@@ -318,14 +659,7 @@ MultiLogger::log_error(const char *component, fawkes::Exception &e)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		(*data->logit)->tlog_error(&now, component, e);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	dispatch(LL_ERROR, &now, component, e);
 }
 
 void
@@ -333,17 +667,7 @@ MultiLogger::vlog(LogLevel level, const char *component, const char *format, va_
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vlog(level, component, format, vac);
-		va_end(vac);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	vdispatch(level, &now, component, format, va);
 }
 
 void
@@ -351,17 +675,7 @@ MultiLogger::vlog_debug(const char *component, const char *format, va_list va)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_debug(&now, component, format, vac);
-		va_end(vac);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	vdispatch(LL_DEBUG, &now, component, format, va);
 }
 
 void
@@ -369,17 +683,7 @@ MultiLogger::vlog_info(const char *component, const char *format, va_list va)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_info(&now, component, format, vac);
-		va_end(vac);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	vdispatch(LL_INFO, &now, component, format, va);
 }
 
 void
@@ -387,17 +691,7 @@ MultiLogger::vlog_warn(const char *component, const char *format, va_list va)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_warn(&now, component, format, vac);
-		va_end(vac);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	vdispatch(LL_WARN, &now, component, format, va);
 }
 
 void
@@ -405,170 +699,82 @@ MultiLogger::vlog_error(const char *component, const char *format, va_list va)
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_error(&now, component, format, vac);
-		va_end(vac);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	vdispatch(LL_ERROR, &now, component, format, va);
 }
 
 void
 MultiLogger::tlog(LogLevel level, struct timeval *t, const char *component, const char *format, ...)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
 	va_list va;
 	va_start(va, format);
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog(level, t, component, format, vac);
-		va_end(vac);
-	}
+	vdispatch(level, t, component, format, va);
 	va_end(va);
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
 }
 
 void
 MultiLogger::tlog_debug(struct timeval *t, const char *component, const char *format, ...)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
 	va_list va;
 	va_start(va, format);
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vlog_debug(component, format, vac);
-		va_end(vac);
-	}
+	vdispatch(LL_DEBUG, t, component, format, va);
 	va_end(va);
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
 }
 
 void
 MultiLogger::tlog_info(struct timeval *t, const char *component, const char *format, ...)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
 	va_list va;
 	va_start(va, format);
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_info(t, component, format, vac);
-		va_end(vac);
-	}
+	vdispatch(LL_INFO, t, component, format, va);
 	va_end(va);
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
 }
 
 void
 MultiLogger::tlog_warn(struct timeval *t, const char *component, const char *format, ...)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
 	va_list va;
 	va_start(va, format);
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_warn(t, component, format, vac);
-		va_end(vac);
-	}
+	vdispatch(LL_WARN, t, component, format, va);
 	va_end(va);
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
 }
 
 void
 MultiLogger::tlog_error(struct timeval *t, const char *component, const char *format, ...)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
 	va_list va;
 	va_start(va, format);
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_error(t, component, format, vac);
-		va_end(vac);
-	}
+	vdispatch(LL_ERROR, t, component, format, va);
 	va_end(va);
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
 }
 
 void
 MultiLogger::tlog(LogLevel level, struct timeval *t, const char *component, fawkes::Exception &e)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		(*data->logit)->tlog(level, t, component, e);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	dispatch(level, t, component, e);
 }
 
 void
 MultiLogger::tlog_debug(struct timeval *t, const char *component, fawkes::Exception &e)
 {
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		(*data->logit)->tlog_error(t, component, e);
-	}
+	dispatch(LL_DEBUG, t, component, e);
 }
 
 void
 MultiLogger::tlog_info(struct timeval *t, const char *component, fawkes::Exception &e)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		(*data->logit)->tlog_error(t, component, e);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	dispatch(LL_INFO, t, component, e);
 }
 
 void
 MultiLogger::tlog_warn(struct timeval *t, const char *component, fawkes::Exception &e)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		(*data->logit)->tlog_error(t, component, e);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	dispatch(LL_WARN, t, component, e);
 }
 
 void
 MultiLogger::tlog_error(struct timeval *t, const char *component, fawkes::Exception &e)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		(*data->logit)->tlog_error(t, component, e);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	dispatch(LL_ERROR, t, component, e);
 }
 
 void
@@ -578,81 +784,31 @@ MultiLogger::vtlog(LogLevel        level,
                    const char *    format,
                    va_list         va)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog(level, t, component, format, vac);
-		va_end(vac);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	vdispatch(level, t, component, format, va);
 }
 
 void
 MultiLogger::vtlog_debug(struct timeval *t, const char *component, const char *format, va_list va)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_debug(t, component, format, vac);
-		va_end(vac);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	vdispatch(LL_DEBUG, t, component, format, va);
 }
 
 void
 MultiLogger::vtlog_info(struct timeval *t, const char *component, const char *format, va_list va)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_info(t, component, format, vac);
-		va_end(vac);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	vdispatch(LL_INFO, t, component, format, va);
 }
 
 void
 MultiLogger::vtlog_warn(struct timeval *t, const char *component, const char *format, va_list va)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_warn(t, component, format, vac);
-		va_end(vac);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	vdispatch(LL_WARN, t, component, format, va);
 }
 
 void
 MultiLogger::vtlog_error(struct timeval *t, const char *component, const char *format, va_list va)
 {
-	data->mutex->lock();
-	fawkes::Thread::set_cancel_state(fawkes::Thread::CANCEL_DISABLED, &(data->old_state));
-
-	for (data->logit = data->loggers.begin(); data->logit != data->loggers.end(); ++data->logit) {
-		va_list vac;
-		va_copy(vac, va);
-		(*data->logit)->vtlog_error(t, component, format, vac);
-		va_end(vac);
-	}
-	fawkes::Thread::set_cancel_state(data->old_state);
-	data->mutex->unlock();
+	vdispatch(LL_ERROR, t, component, format, va);
 }
 
 } // end namespace llsfrb
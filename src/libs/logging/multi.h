@@ -4,6 +4,7 @@
  *
  *  Created: Mon May 07 16:42:23 2007
  *  Copyright  2006-2007  Tim Niemueller [www.niemueller.de]
+ *             2026  agent <agent@local>
  *
  ****************************************************************************/
 
@@ -27,6 +28,8 @@
 #include <logging/logger.h>
 #include <logging/logger_employer.h>
 
+#include <cstdint>
+
 namespace llsfrb {
 
 class MultiLoggerData;
@@ -43,6 +46,11 @@ public:
 
 	virtual void set_loglevel(LogLevel level);
 
+	void     enable_async(unsigned int queue_size = 4096, unsigned int debug_sample_rate = 8);
+	void     disable_async();
+	bool     is_async() const;
+	uint64_t lost_records() const;
+
 	virtual void log(LogLevel level, const char *component, const char *format, ...);
 	virtual void log_debug(const char *component, const char *format, ...);
 	virtual void log_info(const char *component, const char *format, ...);
@@ -83,6 +91,16 @@ public:
 	virtual void
 	vtlog_error(struct timeval *t, const char *component, const char *format, va_list va);
 
+private:
+	void vdispatch(LogLevel        level,
+	               struct timeval *t,
+	               const char *    component,
+	               const char *    format,
+	               va_list         va);
+	void dispatch(LogLevel level, struct timeval *t, const char *component, fawkes::Exception &e);
+	void dispatch_loop();
+	void update_min_level();
+
 private:
 	MultiLoggerData *data;
 };
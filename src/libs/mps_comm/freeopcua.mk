@@ -37,3 +37,12 @@ ifeq ($(HAVE_FREEOPCUA),1)
 else
   WARNING_FREEOPCUA=freeopcua[-devel] not found
 endif
+
+# The server library is only needed for the PLC simulation
+ifeq ($(HAVE_FREEOPCUA),1)
+  HAVE_FREEOPCUA_SERVER= $(if $(shell $(PKGCONFIG) --exists libopcuaserver; echo $${?/1/}),1,0)
+  ifeq ($(HAVE_FREEOPCUA_SERVER),1)
+    CFLAGS_FREEOPCUA_SERVER  = $(CFLAGS_FREEOPCUA) $(shell $(PKGCONFIG) --cflags libopcuaserver)
+    LDFLAGS_FREEOPCUA_SERVER = $(LDFLAGS_FREEOPCUA) $(shell $(PKGCONFIG) --libs libopcuaserver)
+  endif
+endif
@@ -54,6 +54,9 @@ public:
 	virtual void register_busy_callback(std::function<void(bool)>)             = 0;
 	virtual void register_ready_callback(std::function<void(bool)>)            = 0;
 	virtual void register_barcode_callback(std::function<void(unsigned long)>) = 0;
+	// Called with true once the machine is connected and ready to take
+	// commands, and with false when the connection is lost
+	virtual void register_connected_callback(std::function<void(bool)>) = 0;
 	virtual std::string
 	name() const
 	{
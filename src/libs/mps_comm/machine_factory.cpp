@@ -68,24 +68,33 @@ MachineFactory::create_machine(const std::string &name,
 			                        type.c_str(),
 			                        name.c_str());
 		}
-		// Do not connect just now; instead, let it connect in the background.
-		//mps->connect();
+		std::string node_cache_dir =
+		  config_->get_string_or_default("/llsfrb/mps/node-cache-dir", "");
+		if (!node_cache_dir.empty()) {
+			mps->set_node_cache_file(node_cache_dir + "/" + name + ".nodes");
+		}
+		std::string trace_dir = config_->get_string_or_default("/llsfrb/mps/trace-dir", "");
+		if (!trace_dir.empty()) {
+			mps->set_trace_file(trace_dir + "/" + name + ".csv");
+		}
+		// Do not connect just now; the machine connects in the background.
 		return std::move(mps);
 	}
 #endif
 #ifdef HAVE_MOCKUP
 	if (connection_mode == "mockup") {
 		float exec_speed = config_->get_float_or_default("llsfrb/simulation/speedup", 1);
+		std::unique_ptr<MockupMachine> mps;
 		if (type == "BS") {
-			return std::make_unique<MockupBaseStation>(name, exec_speed);
+			mps = std::make_unique<MockupBaseStation>(name, exec_speed);
 		} else if (type == "CS") {
-			return std::make_unique<MockupCapStation>(name, exec_speed);
+			mps = std::make_unique<MockupCapStation>(name, exec_speed);
 		} else if (type == "DS") {
-			return std::make_unique<MockupDeliveryStation>(name, exec_speed);
+			mps = std::make_unique<MockupDeliveryStation>(name, exec_speed);
 		} else if (type == "RS") {
-			return std::make_unique<MockupRingStation>(name, exec_speed);
+			mps = std::make_unique<MockupRingStation>(name, exec_speed);
 		} else if (type == "SS") {
-			return std::make_unique<MockupStorageStation>(name, exec_speed);
+			mps = std::make_unique<MockupStorageStation>(name, exec_speed);
 		} else {
 			throw fawkes::Exception(
 			  "Unexpected machine type '%s' for machine '%s' and connection mode '%s'",
@@ -93,6 +102,12 @@ MachineFactory::create_machine(const std::string &name,
 			  name.c_str(),
 			  connection_mode.c_str());
 		}
+		std::string timing_profile =
+		  config_->get_string_or_default("/llsfrb/mps/mockup-timing-profile", "");
+		if (!timing_profile.empty()) {
+			mps->set_timing_profile(MockupTimingProfile::load(timing_profile));
+		}
+		return std::move(mps);
 	}
 #endif
 	throw fawkes::Exception("Unexpected connection mode '%s' for machine '%s'",
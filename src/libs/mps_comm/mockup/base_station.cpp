@@ -25,21 +25,23 @@
 namespace llsfrb {
 namespace mps_comm {
 MockupBaseStation::MockupBaseStation(const std::string &name, float exec_speed)
-: MockupMachine(name, exec_speed)
+: MockupMachine(name, STATION_BASE, exec_speed)
 {
 }
 
 void
 MockupBaseStation::get_base(llsf_msgs::BaseColor color)
 {
+	unsigned short color_sps = 0;
+	switch (color) {
+	case llsf_msgs::BASE_RED: color_sps = BASE_COLOR_RED; break;
+	case llsf_msgs::BASE_BLACK: color_sps = BASE_COLOR_BLACK; break;
+	case llsf_msgs::BASE_SILVER: color_sps = BASE_COLOR_SILVER; break;
+	default: break;
+	}
 	callback_busy_(true);
-	std::lock_guard<std::mutex> lg(queue_mutex_);
-	queue_.push(std::make_tuple([this] { callback_busy_(false); },
-	                            std::chrono::system_clock::now()
-	                              + std::max(min_operation_duration_,
-	                                         std::chrono::round<std::chrono::milliseconds>(
-	                                           duration_base_dispense_ / exec_speed_))));
-	queue_condition_.notify_one();
+	schedule(step_duration(STATION_BASE + OPERATION_GET_BASE, color_sps, duration_base_dispense_),
+	         [this] { callback_busy_(false); });
 }
 
 } // namespace mps_comm
@@ -26,33 +26,28 @@ namespace llsfrb {
 namespace mps_comm {
 
 MockupCapStation::MockupCapStation(const std::string &name, float exec_speed)
-: MockupMachine(name, exec_speed)
+: MockupMachine(name, STATION_CAP, exec_speed)
 {
 }
 
 void
 MockupCapStation::retrieve_cap()
 {
-	cap_op();
+	cap_op(OPERATION_CAP_RETRIEVE);
 }
 
 void
 MockupCapStation::mount_cap()
 {
-	cap_op();
+	cap_op(OPERATION_CAP_MOUNT);
 }
 
 void
-MockupCapStation::cap_op()
+MockupCapStation::cap_op(unsigned short operation)
 {
 	callback_busy_(true);
-	std::lock_guard<std::mutex> lg(queue_mutex_);
-	queue_.push(std::make_tuple([this] { callback_busy_(false); },
-	                            std::chrono::system_clock::now()
-	                              + std::max(min_operation_duration_,
-	                                         std::chrono::round<std::chrono::milliseconds>(
-	                                           duration_cap_op_ / exec_speed_))));
-	queue_condition_.notify_one();
+	schedule(step_duration(STATION_CAP + OPERATION_CAP_ACTION, operation, duration_cap_op_),
+	         [this] { callback_busy_(false); });
 }
 
 } // namespace mps_comm
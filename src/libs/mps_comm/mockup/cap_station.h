@@ -34,7 +34,7 @@ public:
 	void identify() override{};
 
 private:
-	void cap_op();
+	void cap_op(unsigned short operation);
 };
 
 } // namespace mps_comm
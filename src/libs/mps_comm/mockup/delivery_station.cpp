@@ -28,7 +28,7 @@ namespace llsfrb {
 namespace mps_comm {
 
 MockupDeliveryStation::MockupDeliveryStation(const std::string &name, float exec_speed)
-: MockupMachine(name, exec_speed)
+: MockupMachine(name, STATION_DELIVERY, exec_speed)
 {
 }
 
@@ -37,13 +37,8 @@ MockupDeliveryStation::deliver_product(int slot)
 {
 	assert(slot == 1 || slot == 2 || slot == 3);
 	callback_busy_(true);
-	std::lock_guard<std::mutex> lg(queue_mutex_);
-	queue_.push(std::make_tuple([this] { callback_busy_(false); },
-	                            std::chrono::system_clock::now()
-	                              + std::max(min_operation_duration_,
-	                                         std::chrono::round<std::chrono::milliseconds>(
-	                                           duration_ds_slots[slot - 1] / exec_speed_))));
-	queue_condition_.notify_one();
+	schedule(step_duration(STATION_DELIVERY + OPERATION_DELIVER, slot, duration_ds_slots[slot - 1]),
+	         [this] { callback_busy_(false); });
 }
 
 } // namespace mps_comm
@@ -24,26 +24,39 @@
 
 #include <config/yaml.h>
 
+#include <algorithm>
 #include <chrono>
-#include <thread>
 
 namespace llsfrb {
 namespace mps_comm {
 
-MockupMachine::MockupMachine(const std::string &name, float exec_speed)
-: Machine(name), exec_speed_(exec_speed), shutdown_(false)
+MockupMachine::MockupMachine(const std::string &name, Station station, float exec_speed)
+: Machine(name),
+  station_(station),
+  exec_speed_(exec_speed),
+  timer_queue_(MockupTimerQueue::instance())
 {
-	worker_thread_ = std::thread(&MockupMachine::queue_worker, this);
 }
 
 MockupMachine::~MockupMachine()
 {
-	std::unique_lock<std::mutex> lock(queue_mutex_);
-	shutdown_ = true;
-	lock.unlock();
-	queue_condition_.notify_all();
-	if (worker_thread_.joinable()) {
-		worker_thread_.join();
+	timer_queue_->cancel(this);
+}
+
+void
+MockupMachine::schedule(std::chrono::milliseconds duration, std::function<void()> callback)
+{
+	using std::chrono::milliseconds;
+	using std::chrono::round;
+	if (timer_queue_->virtual_clock()) {
+		// the virtual clock runs in game time, every step takes at least the
+		// minimum duration of game time regardless of the speedup
+		timer_queue_->schedule(std::max(min_operation_duration_, duration), callback, this);
+	} else {
+		timer_queue_->schedule(std::max(min_operation_duration_,
+		                                round<milliseconds>(duration / exec_speed_)),
+		                       callback,
+		                       this);
 	}
 }
 
@@ -66,54 +79,60 @@ MockupMachine::register_barcode_callback(std::function<void(unsigned long)> call
 }
 
 void
-MockupMachine::queue_worker()
+MockupMachine::register_connected_callback(std::function<void(bool)> callback)
+{
+	// a mockup machine is always connected
+	if (callback) {
+		callback(true);
+	}
+}
+
+void
+MockupMachine::set_timing_profile(std::shared_ptr<MockupTimingProfile> profile)
+{
+	timing_profile_ = profile;
+}
+
+std::chrono::milliseconds
+MockupMachine::step_duration(unsigned short            command,
+                             unsigned short            payload1,
+                             std::chrono::milliseconds fallback)
 {
-	std::unique_lock<std::mutex> lock(queue_mutex_);
-	while (!shutdown_) {
-		if (queue_.empty()) {
-			queue_condition_.wait(lock);
-			continue;
-		}
-		auto cmd        = std::get<0>(queue_.front());
-		auto time_point = std::get<1>(queue_.front());
-		queue_.pop();
-		while (!queue_condition_.wait_until(lock, time_point, [&] {
-			return shutdown_ || std::chrono::system_clock::now() >= time_point;
-		})) {}
-		if (!shutdown_) {
-			lock.unlock();
-			cmd();
-			lock.lock();
-		}
+	MockupTimingProfile::Sample sample;
+	if (timing_profile_ && timing_profile_->sample(command, payload1, sample)
+	    && sample.busy_off_ms >= 0) {
+		return std::chrono::milliseconds(sample.busy_off_ms);
 	}
+	return fallback;
 }
 
 void
 MockupMachine::conveyor_move(ConveyorDirection direction, MPSSensor sensor)
 {
 	using std::chrono::milliseconds;
-	using std::chrono::round;
-	using std::chrono::system_clock;
+	milliseconds busy_off  = duration_band_input_to_mid_;
+	milliseconds ready_on  = duration_band_mid_to_output_;
+	milliseconds ready_off = duration_ready_at_output_;
+
+	// the steps of a move are taken from the same trace line
+	MockupTimingProfile::Sample sample;
+	if (timing_profile_
+	    && timing_profile_->sample(COMMAND_MOVE_CONVEYOR + station_, sensor, sample)) {
+		if (sample.busy_off_ms >= 0)
+			busy_off = milliseconds(sample.busy_off_ms);
+		if (sample.ready_on_ms >= 0)
+			ready_on = milliseconds(sample.ready_on_ms);
+		if (sample.ready_off_ms >= 0)
+			ready_off = milliseconds(sample.ready_off_ms);
+	}
+
 	callback_busy_(true);
-	std::lock_guard<std::mutex> lg(queue_mutex_);
-	queue_.push(
-	  std::make_tuple([this] { callback_busy_(false); },
-	                  system_clock::now()
-	                    + std::max(min_operation_duration_,
-	                               round<milliseconds>(duration_band_input_to_mid_ / exec_speed_))));
+	// the timer queue orders by deadline, the steps may be scheduled in any order
+	schedule(busy_off, [this] { callback_busy_(false); });
 	if (sensor == INPUT || sensor == OUTPUT) {
-		queue_.push(std::make_tuple([this] { callback_ready_(true); },
-		                            system_clock::now()
-		                              + std::max(min_operation_duration_,
-		                                         round<milliseconds>(duration_band_mid_to_output_
-		                                                             / exec_speed_))));
-		queue_.push(
-		  std::make_tuple([this] { callback_ready_(false); },
-		                  system_clock::now()
-		                    + std::max(min_operation_duration_,
-		                               round<milliseconds>(duration_ready_at_output_ / exec_speed_))));
+		schedule(ready_on, [this] { callback_ready_(true); });
+		schedule(ready_off, [this] { callback_ready_(false); });
 	}
-	queue_condition_.notify_one();
 }
 } // namespace mps_comm
 } // namespace llsfrb
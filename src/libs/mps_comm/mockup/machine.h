@@ -21,11 +21,13 @@
 #pragma once
 
 #include "../machine.h"
+#include "../opcua/mps_io_mapping.h"
+#include "timer_queue.h"
+#include "timing_profile.h"
 
 #include <chrono>
-#include <condition_variable>
-#include <future>
-#include <queue>
+#include <functional>
+#include <memory>
 
 namespace llsfrb {
 namespace mps_comm {
@@ -33,7 +35,7 @@ namespace mps_comm {
 class MockupMachine : public virtual Machine
 {
 public:
-	MockupMachine(const std::string &name, float exec_speed);
+	MockupMachine(const std::string &name, Station station, float exec_speed);
 	~MockupMachine() override;
 	void         set_light(llsf_msgs::LightColor color,
 	                       llsf_msgs::LightState state = llsf_msgs::ON,
@@ -44,20 +46,26 @@ public:
 	void         register_busy_callback(std::function<void(bool)>) override;
 	void         register_ready_callback(std::function<void(bool)>) override;
 	void         register_barcode_callback(std::function<void(unsigned long)>) override;
+	void         register_connected_callback(std::function<void(bool)>) override;
 	virtual void identify() = 0;
+	// Draw step durations from recorded traces instead of the defaults
+	void         set_timing_profile(std::shared_ptr<MockupTimingProfile> profile);
 
 protected:
-	void                    queue_worker();
-	std::mutex              queue_mutex_;
-	float                   exec_speed_;
-	std::condition_variable queue_condition_;
-	std::queue<std::tuple<std::function<void()>, std::chrono::time_point<std::chrono::system_clock>>>
-	                                   queue_;
-	bool                               shutdown_;
-	std::thread                        worker_thread_;
-	std::function<void(bool)>          callback_busy_;
-	std::function<void(bool)>          callback_ready_;
-	std::function<void(unsigned long)> callback_barcode_;
+	// Run callback once the step of the given duration is done
+	void schedule(std::chrono::milliseconds duration, std::function<void()> callback);
+	// Duration until busy is reset for the given PLC instruction
+	std::chrono::milliseconds step_duration(unsigned short            command,
+	                                        unsigned short            payload1,
+	                                        std::chrono::milliseconds fallback);
+
+	const Station                        station_;
+	float                                exec_speed_;
+	std::shared_ptr<MockupTimerQueue>    timer_queue_;
+	std::shared_ptr<MockupTimingProfile> timing_profile_;
+	std::function<void(bool)>            callback_busy_;
+	std::function<void(bool)>            callback_ready_;
+	std::function<void(unsigned long)>   callback_barcode_;
 };
 
 } // namespace mps_comm
@@ -28,21 +28,16 @@ namespace llsfrb {
 namespace mps_comm {
 
 MockupRingStation::MockupRingStation(const std::string &name, float exec_speed)
-: MockupMachine(name, exec_speed)
+: MockupMachine(name, STATION_RING, exec_speed)
 {
 }
 
 void
-MockupRingStation::mount_ring(unsigned int, llsf_msgs::RingColor)
+MockupRingStation::mount_ring(unsigned int feeder, llsf_msgs::RingColor)
 {
 	callback_busy_(true);
-	std::lock_guard<std::mutex> lg(queue_mutex_);
-	queue_.push(std::make_tuple([this] { callback_busy_(false); },
-	                            std::chrono::system_clock::now()
-	                              + std::max(min_operation_duration_,
-	                                         std::chrono::round<std::chrono::milliseconds>(
-	                                           duration_ring_mount_ / exec_speed_))));
-	queue_condition_.notify_one();
+	schedule(step_duration(STATION_RING + OPERATION_MOUNT_RING, feeder, duration_ring_mount_),
+	         [this] { callback_busy_(false); });
 }
 
 } // namespace mps_comm
@@ -28,20 +28,20 @@ namespace llsfrb {
 namespace mps_comm {
 
 MockupStorageStation::MockupStorageStation(const std::string &name, float exec_speed)
-: MockupMachine(name, exec_speed)
+: MockupMachine(name, STATION_STORAGE, exec_speed)
 {
 }
 
 void
 MockupStorageStation::retrieve(unsigned int shelf, unsigned int slot)
 {
-	storage_op();
+	storage_op(OPERATION_RETRIEVE, shelf);
 }
 
 void
 MockupStorageStation::store(unsigned int shelf, unsigned int slot)
 {
-	storage_op();
+	storage_op(OPERATION_STORE, shelf);
 }
 
 void
@@ -50,20 +50,15 @@ MockupStorageStation::relocate(unsigned int shelf,
                                unsigned int target_shelf,
                                unsigned int target_slot)
 {
-	storage_op();
+	storage_op(OPERATION_RELOCATE, shelf);
 }
 
 void
-MockupStorageStation::storage_op()
+MockupStorageStation::storage_op(unsigned short operation, unsigned int shelf)
 {
 	callback_busy_(true);
-	std::lock_guard<std::mutex> lg(queue_mutex_);
-	queue_.push(std::make_tuple([this] { callback_busy_(false); },
-	                            std::chrono::system_clock::now()
-	                              + std::max(min_operation_duration_,
-	                                         std::chrono::round<std::chrono::milliseconds>(
-	                                           duration_storage_op_ / exec_speed_))));
-	queue_condition_.notify_one();
+	schedule(step_duration(STATION_STORAGE + operation, shelf, duration_storage_op_),
+	         [this] { callback_busy_(false); });
 }
 
 } // namespace mps_comm
@@ -39,7 +39,7 @@ public:
 	void identify() override{};
 
 private:
-	void storage_op();
+	void storage_op(unsigned short operation, unsigned int shelf);
 };
 } // namespace mps_comm
 } // namespace llsfrb
@@ -0,0 +1,191 @@
+/***************************************************************************
+ *  timer_queue.cpp - Shared deadline-ordered timer queue for mockup machines
+ *
+ *  Created: Mon 19 Oct 2026 17:02:13 CEST 17:02
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+#include "timer_queue.h"
+
+#include <algorithm>
+
+namespace llsfrb {
+namespace mps_comm {
+
+MockupTimerQueue::MockupTimerQueue()
+: next_seq_(0),
+  virtual_(false),
+  virtual_now_(Clock::now()),
+  running_(false),
+  running_owner_(nullptr),
+  shutdown_(false)
+{
+	worker_thread_ = std::thread(&MockupTimerQueue::worker, this);
+}
+
+MockupTimerQueue::~MockupTimerQueue()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	shutdown_ = true;
+	lock.unlock();
+	cond_.notify_all();
+	if (worker_thread_.joinable()) {
+		worker_thread_.join();
+	}
+}
+
+std::shared_ptr<MockupTimerQueue>
+MockupTimerQueue::instance()
+{
+	// the queue lives as long as a machine or another user holds it
+	static std::mutex                      instance_mutex;
+	static std::weak_ptr<MockupTimerQueue> instance;
+	std::lock_guard<std::mutex>            lock(instance_mutex);
+	std::shared_ptr<MockupTimerQueue>      queue = instance.lock();
+	if (!queue) {
+		queue    = std::make_shared<MockupTimerQueue>();
+		instance = queue;
+	}
+	return queue;
+}
+
+void
+MockupTimerQueue::schedule(std::chrono::milliseconds delay, Callback callback, const void *owner)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	TimePoint                   now = virtual_ ? virtual_now_ : Clock::now();
+	heap_.push_back(Timer{now + delay, next_seq_++, owner, std::move(callback)});
+	std::push_heap(heap_.begin(), heap_.end(), Later());
+	cond_.notify_all();
+}
+
+void
+MockupTimerQueue::cancel(const void *owner)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	heap_.erase(std::remove_if(heap_.begin(),
+	                           heap_.end(),
+	                           [owner](const Timer &t) { return t.owner == owner; }),
+	            heap_.end());
+	std::make_heap(heap_.begin(), heap_.end(), Later());
+	// a callback may cancel its own owner, do not wait for ourselves
+	cond_.wait(lock, [&] {
+		return !running_ || running_owner_ != owner
+		       || running_thread_ == std::this_thread::get_id();
+	});
+}
+
+void
+MockupTimerQueue::set_virtual_clock(bool enable)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (enable == virtual_) {
+		return;
+	}
+	TimePoint real_now = Clock::now();
+	if (enable) {
+		virtual_now_ = real_now;
+	} else {
+		// keep the remaining time of pending timers
+		for (Timer &t : heap_) {
+			t.deadline = real_now + (t.deadline - virtual_now_);
+		}
+	}
+	virtual_ = enable;
+	cond_.notify_all();
+}
+
+bool
+MockupTimerQueue::virtual_clock() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return virtual_;
+}
+
+void
+MockupTimerQueue::advance(std::chrono::milliseconds duration)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	if (!virtual_) {
+		return;
+	}
+	TimePoint target = virtual_now_ + duration;
+	// callbacks are executed one at a time, the worker may still be running
+	// one that became due before the virtual clock was enabled
+	cond_.wait(lock, [&] { return !running_ || running_thread_ == std::this_thread::get_id(); });
+	while (virtual_ && !heap_.empty() && heap_.front().deadline <= target) {
+		virtual_now_ = std::max(virtual_now_, heap_.front().deadline);
+		run_front(lock);
+	}
+	if (virtual_) {
+		virtual_now_ = std::max(virtual_now_, target);
+	}
+}
+
+MockupTimerQueue::TimePoint
+MockupTimerQueue::now() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return virtual_ ? virtual_now_ : Clock::now();
+}
+
+size_t
+MockupTimerQueue::pending() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return heap_.size();
+}
+
+void
+MockupTimerQueue::run_front(std::unique_lock<std::mutex> &lock)
+{
+	std::pop_heap(heap_.begin(), heap_.end(), Later());
+	Timer timer = std::move(heap_.back());
+	heap_.pop_back();
+	bool            was_running = running_;
+	const void *    prev_owner  = running_owner_;
+	std::thread::id prev_thread = running_thread_;
+	running_                    = true;
+	running_owner_              = timer.owner;
+	running_thread_             = std::this_thread::get_id();
+	lock.unlock();
+	timer.callback();
+	lock.lock();
+	// restore the state of an outer callback which called advance()
+	running_        = was_running;
+	running_owner_  = prev_owner;
+	running_thread_ = prev_thread;
+	cond_.notify_all();
+}
+
+void
+MockupTimerQueue::worker()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	while (!shutdown_) {
+		if (heap_.empty() || virtual_ || running_) {
+			cond_.wait(lock);
+		} else if (Clock::now() < heap_.front().deadline) {
+			// woken up early if a timer with an earlier deadline is scheduled
+			cond_.wait_until(lock, heap_.front().deadline);
+		} else {
+			run_front(lock);
+		}
+	}
+}
+
+} // namespace mps_comm
+} // namespace llsfrb
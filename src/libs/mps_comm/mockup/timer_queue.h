@@ -0,0 +1,104 @@
+/***************************************************************************
+ *  timer_queue.h - Shared deadline-ordered timer queue for mockup machines
+ *
+ *  Created: Mon 19 Oct 2026 17:02:13 CEST 17:02
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace llsfrb {
+namespace mps_comm {
+
+// Timer queue shared by all mockup machines of a process. Callbacks are
+// executed in deadline order by a single thread. With the virtual clock
+// enabled, time only passes by calls to advance(), which then executes the
+// callbacks that became due on the calling thread.
+class MockupTimerQueue
+{
+public:
+	using Clock     = std::chrono::steady_clock;
+	using TimePoint = Clock::time_point;
+	using Callback  = std::function<void()>;
+
+	MockupTimerQueue();
+	~MockupTimerQueue();
+
+	// Get the queue shared by all mockup machines, created on first use
+	static std::shared_ptr<MockupTimerQueue> instance();
+
+	// Run callback after delay; owner identifies the timer for cancel()
+	void schedule(std::chrono::milliseconds delay, Callback callback, const void *owner);
+	// Remove all pending timers of owner and wait for a running one to finish
+	void cancel(const void *owner);
+
+	// Switch between real time and the virtual clock
+	void set_virtual_clock(bool enable);
+	bool virtual_clock() const;
+	// Advance the virtual clock and run all callbacks which became due
+	void advance(std::chrono::milliseconds duration);
+
+	// Current time of the queue, virtual or real
+	TimePoint now() const;
+	// Number of pending timers
+	size_t pending() const;
+
+private:
+	struct Timer
+	{
+		TimePoint   deadline;
+		uint64_t    seq;
+		const void *owner;
+		Callback    callback;
+	};
+	// orders the heap by deadline, timers with equal deadlines run in
+	// the order in which they were scheduled
+	struct Later
+	{
+		bool
+		operator()(const Timer &a, const Timer &b) const
+		{
+			return a.deadline > b.deadline || (a.deadline == b.deadline && a.seq > b.seq);
+		}
+	};
+
+	void worker();
+	void run_front(std::unique_lock<std::mutex> &lock);
+
+	mutable std::mutex      mutex_;
+	std::condition_variable cond_;
+	std::vector<Timer>      heap_;
+	uint64_t                next_seq_;
+	bool                    virtual_;
+	TimePoint               virtual_now_;
+	bool                    running_;
+	const void *            running_owner_;
+	std::thread::id         running_thread_;
+	bool                    shutdown_;
+	std::thread             worker_thread_;
+};
+
+} // namespace mps_comm
+} // namespace llsfrb
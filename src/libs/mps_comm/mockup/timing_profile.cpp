@@ -0,0 +1,162 @@
+/***************************************************************************
+ *  timing_profile.cpp - Recorded step durations for mockup machines
+ *
+ *  Created: Mon 19 Oct 2026 18:11:40 CEST 18:11
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+#include "timing_profile.h"
+
+#include <core/exception.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+
+namespace llsfrb {
+namespace mps_comm {
+
+MockupTimingProfile::MockupTimingProfile() : num_samples_(0), rng_(std::random_device()())
+{
+}
+
+std::shared_ptr<MockupTimingProfile>
+MockupTimingProfile::load(const std::string &path)
+{
+	static std::mutex                                                 profiles_mutex;
+	static std::map<std::string, std::weak_ptr<MockupTimingProfile>> profiles;
+	std::lock_guard<std::mutex>                                       lock(profiles_mutex);
+
+	std::shared_ptr<MockupTimingProfile> profile = profiles[path].lock();
+	if (profile) {
+		return profile;
+	}
+	profile = std::make_shared<MockupTimingProfile>();
+
+	struct stat st;
+	if (stat(path.c_str(), &st) != 0) {
+		throw fawkes::Exception("Cannot access timing profile %s: %s", path.c_str(), strerror(errno));
+	}
+	if (S_ISDIR(st.st_mode)) {
+		DIR *dir = opendir(path.c_str());
+		if (!dir) {
+			throw fawkes::Exception("Cannot open timing profile directory %s: %s",
+			                        path.c_str(),
+			                        strerror(errno));
+		}
+		struct dirent *de;
+		while ((de = readdir(dir)) != nullptr) {
+			size_t len = strlen(de->d_name);
+			if (len > 4 && strcmp(de->d_name + len - 4, ".csv") == 0) {
+				profile->add_file(path + "/" + de->d_name);
+			}
+		}
+		closedir(dir);
+	} else {
+		profile->add_file(path);
+	}
+	profiles[path] = profile;
+	return profile;
+}
+
+size_t
+MockupTimingProfile::add_file(const std::string &filename)
+{
+	FILE *f = fopen(filename.c_str(), "r");
+	if (!f) {
+		throw fawkes::Exception("Cannot open timing trace %s: %s", filename.c_str(), strerror(errno));
+	}
+	std::string data;
+	char        buf[65536];
+	size_t      n;
+	while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+		data.append(buf, n);
+	}
+	fclose(f);
+	return add_trace(data.data(), data.size());
+}
+
+size_t
+MockupTimingProfile::add_trace(const char *data, size_t size)
+{
+	// station,command,payload1,payload2,busy_on_ms,busy_off_ms,ready_on_ms,ready_off_ms
+	// Parsed in place, traces of long events have many thousand lines.
+	size_t      added = 0;
+	const char *p     = data;
+	const char *end   = data + size;
+	while (p < end) {
+		const char *eol = static_cast<const char *>(memchr(p, '\n', end - p));
+		if (!eol) {
+			eol = end;
+		}
+		if (*p != '#' && eol > p) {
+			const char *field = static_cast<const char *>(memchr(p, ',', eol - p));
+			long        values[7];
+			int         num_values = 0;
+			while (field && field < eol && num_values < 7) {
+				char *next;
+				values[num_values] = strtol(field + 1, &next, 10);
+				if (next == field + 1) {
+					break;
+				}
+				++num_values;
+				field = next;
+			}
+			if (num_values == 7) {
+				Sample s{(int32_t)values[3], (int32_t)values[4], (int32_t)values[5], (int32_t)values[6]};
+				by_instruction_[key(values[0], values[1])].push_back(s);
+				by_command_[values[0]].push_back(s);
+				++added;
+			}
+		}
+		p = eol + 1;
+	}
+	num_samples_ += added;
+	return added;
+}
+
+bool
+MockupTimingProfile::sample(uint16_t command, uint16_t payload1, Sample &sample)
+{
+	const std::vector<Sample> *samples = nullptr;
+	auto                       i       = by_instruction_.find(key(command, payload1));
+	if (i != by_instruction_.end()) {
+		samples = &i->second;
+	} else {
+		auto c = by_command_.find(command);
+		if (c == by_command_.end()) {
+			return false;
+		}
+		samples = &c->second;
+	}
+	std::lock_guard<std::mutex>           lock(rng_mutex_);
+	std::uniform_int_distribution<size_t> dist(0, samples->size() - 1);
+	sample = (*samples)[dist(rng_)];
+	return true;
+}
+
+size_t
+MockupTimingProfile::num_samples() const
+{
+	return num_samples_;
+}
+
+} // namespace mps_comm
+} // namespace llsfrb
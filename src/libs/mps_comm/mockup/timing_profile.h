@@ -0,0 +1,83 @@
+/***************************************************************************
+ *  timing_profile.h - Recorded step durations for mockup machines
+ *
+ *  Created: Mon 19 Oct 2026 18:11:40 CEST 18:11
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace llsfrb {
+namespace mps_comm {
+
+// Empirical step durations of the machines, loaded from the traces written
+// by OpcUaMachine. Each trace line describes one instruction by the times
+// from sending it to the busy and ready flanks. Samples are drawn as whole
+// lines, so the durations of the steps of one instruction stay consistent.
+class MockupTimingProfile
+{
+public:
+	// Times in ms after the instruction was sent, negative if not observed
+	struct Sample
+	{
+		int32_t busy_on_ms;
+		int32_t busy_off_ms;
+		int32_t ready_on_ms;
+		int32_t ready_off_ms;
+	};
+
+	MockupTimingProfile();
+
+	// Load a trace file or all *.csv trace files in a directory, shared
+	// between all machines which use the same path
+	static std::shared_ptr<MockupTimingProfile> load(const std::string &path);
+
+	// Add the samples of a trace file, returns the number of samples added
+	size_t add_file(const std::string &filename);
+	// Add samples from trace data in memory
+	size_t add_trace(const char *data, size_t size);
+
+	// Draw a random sample for the instruction; instructions with the same
+	// command but a different payload are used if there is no exact match
+	bool sample(uint16_t command, uint16_t payload1, Sample &sample);
+
+	size_t num_samples() const;
+
+private:
+	static uint32_t
+	key(uint16_t command, uint16_t payload1)
+	{
+		return ((uint32_t)command << 16) | payload1;
+	}
+
+	std::unordered_map<uint32_t, std::vector<Sample>> by_instruction_;
+	std::unordered_map<uint16_t, std::vector<Sample>> by_command_;
+	size_t                                            num_samples_;
+
+	std::mutex   rng_mutex_;
+	std::mt19937 rng_;
+};
+
+} // namespace mps_comm
+} // namespace llsfrb
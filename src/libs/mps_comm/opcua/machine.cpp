@@ -30,14 +30,22 @@
 #	include <spdlog/sinks/stdout_sinks.h>
 #endif
 
+#include <opc/ua/protocol/string_utils.h>
+
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <map>
 #include <pthread.h>
 #include <signal.h>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <sys/stat.h>
 #include <thread>
+#include <unistd.h>
 
 namespace llsfrb {
 #if 0
@@ -48,6 +56,16 @@ namespace mps_comm {
 }
 #endif
 inline const std::chrono::milliseconds opcua_poll_rate_{40};
+// Time to wait for the TCP connection to the PLC before giving up
+inline const std::chrono::milliseconds opcua_connect_timeout_{2000};
+// Bounds of the exponential backoff between connection attempts
+inline const std::chrono::milliseconds opcua_min_backoff_{250};
+inline const std::chrono::milliseconds opcua_max_backoff_{8000};
+// Publishing interval of the subscription of each station
+inline const std::chrono::milliseconds opcua_publishing_interval_{100};
+// Maximum time to wait for the PLC to take an instruction, one publishing
+// interval of the subscription
+inline const std::chrono::milliseconds opcua_ack_timeout_{100};
 
 const std::vector<OpcUtils::MPSRegister>
   OpcUaMachine::SUB_REGISTERS({OpcUtils::MPSRegister::BARCODE_IN,
@@ -55,7 +73,8 @@ const std::vector<OpcUtils::MPSRegister>
                                OpcUtils::MPSRegister::STATUS_BUSY_IN,
                                OpcUtils::MPSRegister::STATUS_ENABLE_IN,
                                OpcUtils::MPSRegister::STATUS_ERROR_IN,
-                               OpcUtils::MPSRegister::STATUS_READY_IN});
+                               OpcUtils::MPSRegister::STATUS_READY_IN,
+                               OpcUtils::MPSRegister::STATUS_ENABLE_BASIC});
 
 OpcUaMachine::OpcUaMachine(Station            machine_type,
                            const std::string &ip,
@@ -68,7 +87,12 @@ OpcUaMachine::OpcUaMachine(Station            machine_type,
   connection_mode_(connection_mode),
   shutdown_(false),
   connected_(false),
-  simulation_(connection_mode == SIMULATION)
+  simulation_(connection_mode == SIMULATION),
+  subscriptions_pending_(false),
+  nodes_resolved_(false),
+  enable_changes_{0, 0},
+  enable_state_{false, false},
+  trace_{false, 0, 0, 0, {}, -1, -1, -1, -1}
 {
 	initLogger(log_path);
 	worker_thread_ = std::thread(&OpcUaMachine::dispatch_command_queue, this);
@@ -81,29 +105,74 @@ OpcUaMachine::dispatch_command_queue()
 	sigemptyset(&signal_set);
 	sigaddset(&signal_set, SIGPIPE);
 	pthread_sigmask(SIG_BLOCK, &signal_set, NULL);
+	if (connection_mode_ == MOCKUP) {
+		return;
+	}
 	std::unique_lock<std::mutex> lock(command_queue_mutex_);
+	std::chrono::milliseconds    backoff = opcua_min_backoff_;
+	bool                         ready   = false;
 	while (!shutdown_) {
-		if (!command_queue_.empty()) {
+		if (!ready) {
+			// connect in the background, queued instructions are kept until the
+			// machine is reachable
+			lock.unlock();
+			ready = reconnect();
+			lock.lock();
+			if (!ready) {
+				logger->warn("Connecting failed, retrying in {} ms", backoff.count());
+				queue_condition_.wait_for(lock, backoff, [&] { return shutdown_; });
+				backoff = std::min(2 * backoff, opcua_max_backoff_);
+				continue;
+			}
+			backoff = opcua_min_backoff_;
+			lock.unlock();
+			notify_connected(true);
+			lock.lock();
+		}
+		if (subscriptions_pending_) {
+			// a callback for a register which is not monitored yet has been set
+			lock.unlock();
+			ready = restoreSubscriptions();
+			lock.lock();
+		} else if (!command_queue_.empty()) {
+			// only this thread pops, the front is stable while unlocked
 			auto instruction = command_queue_.front();
-			command_queue_.pop();
 			lock.unlock();
-			while (!send_instruction(instruction)) {
-				reconnect();
-			};
+			ready = send_instruction(instruction);
 			lock.lock();
+			if (ready) {
+				command_queue_.pop();
+			}
 		} else {
 			if (!queue_condition_.wait_for(lock, std::chrono::seconds(1), [&] {
-				    return !command_queue_.empty();
+				    return !command_queue_.empty() || subscriptions_pending_ || shutdown_;
 			    })) {
 				// there was no instruction in the queue, send heartbeat to ensure the
 				// connection is healthy and reconnect if it is not
 				lock.unlock();
-				while (!send_instruction(std::make_tuple(COMMAND_NOTHING, 0, 0, 1, 0, 0))) {
-					reconnect();
-				}
+				ready = send_instruction(std::make_tuple(COMMAND_NOTHING, 0, 0, 1, 0, 0));
 				lock.lock();
 			}
 		}
+		if (!ready) {
+			lock.unlock();
+			notify_connected(false);
+			lock.lock();
+		}
+	}
+}
+
+void
+OpcUaMachine::notify_connected(bool connected)
+{
+	std::function<void(bool)> callback;
+	{
+		std::lock_guard<std::mutex> lock(command_queue_mutex_);
+		callback = connected_callback_;
+	}
+	logger->info(connected ? "Machine is ready" : "Connection lost");
+	if (callback) {
+		callback(connected);
 	}
 }
 
@@ -117,6 +186,7 @@ OpcUaMachine::enqueue_instruction(unsigned short command,
 {
 	std::lock_guard<std::mutex> lg(command_queue_mutex_);
 	command_queue_.push(std::make_tuple(command, payload1, payload2, timeout, status, error));
+	queue_condition_.notify_one();
 }
 
 bool
@@ -131,49 +201,95 @@ OpcUaMachine::send_instruction(const Instruction &instruction)
 	const unsigned char  error    = std::get<5>(instruction);
 	logger->info(
 	  "Sending instruction {} {} {} {} {} {}", command, payload1, payload2, timeout, status, error);
+	bool         statusBit = (bool)(status & Status::STATUS_BUSY);
+	unsigned int set       = 0;
+	uint64_t     since     = 0;
+	if (!connected_) {
+		return false;
+	}
 	try {
 		OpcUtils::MPSRegister registerOffset;
-		if (command < Station::STATION_BASE)
+		if (command < Station::STATION_BASE) {
 			registerOffset = OpcUtils::MPSRegister::ACTION_ID_BASIC;
-		else
+			set            = 1;
+		} else {
 			registerOffset = OpcUtils::MPSRegister::ACTION_ID_IN;
-
-		bool                  statusBit = (bool)(status & Status::STATUS_BUSY);
-		OpcUtils::MPSRegister reg;
-		reg = registerOffset + OpcUtils::MPSRegister::ACTION_ID_IN;
-		setNodeValue(registerNodes[reg], (uint16_t)command, reg);
-		reg = registerOffset + OpcUtils::MPSRegister::DATA_IN;
-		setNodeValue(registerNodes[reg].GetChildren()[0], (uint16_t)payload1, reg);
-		reg = registerOffset + OpcUtils::MPSRegister::DATA_IN;
-		setNodeValue(registerNodes[reg].GetChildren()[1], (uint16_t)payload2, reg);
-		reg = registerOffset + OpcUtils::MPSRegister::STATUS_ENABLE_IN;
-		setNodeValue(registerNodes[reg], statusBit, reg);
-		reg = registerOffset + OpcUtils::MPSRegister::ERROR_IN;
-		setNodeValue(registerNodes[reg], (uint8_t)error, reg);
+		}
+		const InstructionNodes &nodes = instructionNodes[set];
+
+		// write all registers of the instruction in a single request, the
+		// enable bit last so that the PLC never sees a partial instruction
+		std::vector<OpcUa::WriteValue> writes;
+		auto add_write = [&](const TypedNode &tn, boost::any val, OpcUtils::MPSRegister reg) {
+			OpcUa::Variant var = OpcUtils::getValueWithType(tn.type, val);
+			auto           it  = subscriptions.find(registerOffset + reg);
+			if (it != subscriptions.end() && it->second->mpsValue != nullptr)
+				it->second->mpsValue->setValue(var);
+			OpcUa::WriteValue wv;
+			wv.NodeId      = tn.node.GetId();
+			wv.AttributeId = OpcUa::AttributeId::Value;
+			wv.Value       = OpcUa::DataValue(var);
+			writes.push_back(wv);
+		};
+		add_write(nodes.action_id, (uint16_t)command, OpcUtils::MPSRegister::ACTION_ID_IN);
+		add_write(nodes.data[0], (uint16_t)payload1, OpcUtils::MPSRegister::DATA_IN);
+		add_write(nodes.data[1], (uint16_t)payload2, OpcUtils::MPSRegister::DATA_IN);
+		add_write(nodes.error, (uint8_t)error, OpcUtils::MPSRegister::ERROR_IN);
+		add_write(nodes.enable, statusBit, OpcUtils::MPSRegister::STATUS_ENABLE_IN);
+
+		{
+			std::lock_guard<std::mutex> lock(ack_mutex_);
+			since = enable_changes_[set];
+		}
+		std::vector<OpcUa::StatusCode> codes =
+		  nodes.action_id.node.GetServices()->Attributes()->Write(writes);
+		static const char *write_names[] = {"action id", "data 0", "data 1", "error", "enable"};
+		for (size_t i = 0; i < codes.size() && i < writes.size(); ++i) {
+			if (codes[i] != OpcUa::StatusCode::Good) {
+				throw std::runtime_error(std::string("Writing ") + write_names[i] + " failed with status "
+				                         + std::to_string(static_cast<uint32_t>(codes[i])));
+			}
+		}
 	} catch (std::exception &e) {
 		logger->warn("Error while sending command: {}", e.what());
 		std::this_thread::sleep_for(opcua_poll_rate_);
 		return false;
 	}
-	std::this_thread::sleep_for(opcua_poll_rate_);
+	if (statusBit && command >= Station::STATION_BASE) {
+		trace_instruction(command, payload1, payload2);
+	}
+	if (statusBit && !wait_for_instruction_ack(set, since)) {
+		logger->warn("PLC did not take instruction {} within {} ms",
+		             command,
+		             opcua_ack_timeout_.count());
+	}
 	return true;
 }
 
-void
-OpcUaMachine::reset()
+bool
+OpcUaMachine::wait_for_instruction_ack(unsigned int set, uint64_t since)
 {
-	enqueue_instruction(machine_type_ | Command::COMMAND_RESET);
+	std::unique_lock<std::mutex> lock(ack_mutex_);
+	if (ack_condition_.wait_for(lock, opcua_ack_timeout_, [&] {
+		    return enable_changes_[set] > since && !enable_state_[set];
+	    })) {
+		return true;
+	}
+	lock.unlock();
+	// changes are sampled once per publishing interval, a short enable pulse
+	// does not necessarily cause a notification, so ask the PLC directly
+	try {
+		return !instructionNodes[set].enable.node.GetValue().As<bool>();
+	} catch (std::exception &e) {
+		logger->warn("Failed to read enable bit: {}", e.what());
+		return false;
+	}
 }
 
 void
-OpcUaMachine::connect()
+OpcUaMachine::reset()
 {
-	if (connection_mode_ == MOCKUP) {
-		return;
-	}
-	while (!reconnect()) {
-		std::this_thread::sleep_for(opcua_poll_rate_);
-	}
+	enqueue_instruction(machine_type_ | Command::COMMAND_RESET);
 }
 
 OpcUaMachine::~OpcUaMachine()
@@ -185,7 +301,14 @@ OpcUaMachine::~OpcUaMachine()
 	if (worker_thread_.joinable()) {
 		worker_thread_.join();
 	}
+	printFinalSubscribtions();
+	// closing the session also deletes the subscription on the server
 	disconnect();
+	for (auto &s : subscriptions)
+		delete s.second;
+	subscriptions.clear();
+	std::lock_guard<std::mutex> lock(trace_mutex_);
+	trace_flush();
 }
 
 void
@@ -241,7 +364,19 @@ OpcUaMachine::initLogger(const std::string &log_path)
 bool
 OpcUaMachine::reconnect()
 {
-	disconnect();
+	// the previous session is lost if we get here, do not wait for the server
+	// to close it or to remove the monitored items one by one
+	disconnect(false);
+	std::string node_cache_file;
+	{
+		std::lock_guard<std::mutex> lock(command_queue_mutex_);
+		node_cache_file = node_cache_file_;
+	}
+	// the client blocks for the system TCP timeout on unreachable hosts
+	if (!OpcUtils::probeEndpoint(ip_.c_str(), port_, opcua_connect_timeout_)) {
+		logger->info("{}:{} not reachable within {} ms", ip_, port_, opcua_connect_timeout_.count());
+		return false;
+	}
 	try {
 		OpcUa::EndpointDescription endpoint = OpcUtils::getEndpoint(ip_.c_str(), port_);
 		logger->info("Connecting to: {}", endpoint.EndpointUrl);
@@ -258,14 +393,26 @@ OpcUaMachine::reconnect()
 	}
 
 	try {
-		nodeBasic = OpcUtils::getBasicNode(client.get(), simulation_);
-		nodeIn    = OpcUtils::getInNode(client.get(), simulation_);
-
-		for (int i = 0; i < OpcUtils::MPSRegister::LAST; i++)
-			registerNodes[i] = OpcUtils::getNode(client.get(), (OpcUtils::MPSRegister)i, simulation_);
-		subscribe(SUB_REGISTERS, simulation_);
+		// after an interruption the server is usually the same, resume with
+		// the nodes of the last session; if the batch subscription fails, they
+		// are not valid anymore and are resolved again
+		bool resumed = nodes_resolved_;
+		if (resumed) {
+			logger->info("Resuming session with the nodes of the last session");
+			rebindNodes();
+		} else {
+			resolveNodes(node_cache_file);
+		}
+		if (!restoreSubscriptions()) {
+			if (!resumed)
+				throw std::runtime_error("Subscribing to the registers failed");
+			logger->warn("Resuming the session failed, resolving the nodes again");
+			nodes_resolved_ = false;
+			resolveNodes(node_cache_file);
+			if (!restoreSubscriptions())
+				throw std::runtime_error("Subscribing to the registers failed");
+		}
 		identify();
-		update_callbacks();
 		return true;
 	} catch (const std::exception &exc) {
 		logger->error("Node path error: {} (@{}:{})", exc.what(), __FILE__, __LINE__);
@@ -277,122 +424,319 @@ OpcUaMachine::reconnect()
 }
 
 void
-OpcUaMachine::disconnect()
+OpcUaMachine::resolveNodes(const std::string &node_cache_file)
+{
+	bool cached = !node_cache_file.empty() && loadNodeCache(node_cache_file);
+	try {
+		if (!cached)
+			browseNodes();
+		resolveInstructionNodes();
+	} catch (const std::exception &exc) {
+		if (!cached)
+			throw;
+		logger->warn("Cached nodes are invalid ({}), browsing the server", exc.what());
+		cached = false;
+		browseNodes();
+		resolveInstructionNodes();
+	}
+	if (!cached && !node_cache_file.empty())
+		saveNodeCache(node_cache_file);
+	nodes_resolved_ = true;
+}
+
+void
+OpcUaMachine::rebindNodes()
+{
+	// nodes refer to the services of the client that created them, the ids
+	// and value types are unchanged
+	auto rebind = [this](OpcUa::Node &node) { node = client->GetNode(node.GetId()); };
+	rebind(nodeBasic);
+	rebind(nodeIn);
+	for (int i = 0; i < OpcUtils::MPSRegister::LAST; i++)
+		rebind(registerNodes[i]);
+	for (unsigned int set = 0; set < 2; ++set) {
+		InstructionNodes &nodes = instructionNodes[set];
+		rebind(nodes.action_id.node);
+		rebind(nodes.data[0].node);
+		rebind(nodes.data[1].node);
+		rebind(nodes.enable.node);
+		rebind(nodes.error.node);
+	}
+}
+
+void
+OpcUaMachine::browseNodes()
+{
+	nodeBasic = OpcUtils::getBasicNode(client.get(), simulation_);
+	nodeIn    = OpcUtils::getInNode(client.get(), simulation_);
+
+	for (int i = 0; i < OpcUtils::MPSRegister::LAST; i++)
+		registerNodes[i] = OpcUtils::getNode(client.get(), (OpcUtils::MPSRegister)i, simulation_);
+
+	const OpcUtils::MPSRegister data_regs[2] = {OpcUtils::MPSRegister::DATA_IN,
+	                                            OpcUtils::MPSRegister::DATA_BASIC};
+	for (unsigned int set = 0; set < 2; ++set) {
+		std::vector<OpcUa::Node> data = registerNodes[data_regs[set]].GetChildren();
+		if (data.size() < 2) {
+			throw std::runtime_error("Data register " + OpcUtils::REGISTER_NAMES[data_regs[set]]
+			                         + " has " + std::to_string(data.size()) + " children, expected 2");
+		}
+		instructionNodes[set].data[0].node = data[0];
+		instructionNodes[set].data[1].node = data[1];
+	}
+}
+
+bool
+OpcUaMachine::loadNodeCache(const std::string &path)
+{
+	std::ifstream in(path);
+	if (!in) {
+		return false;
+	}
+	// first line identifies the server, the cache is void if it changed
+	std::string line;
+	if (!std::getline(in, line) || line != node_cache_header()) {
+		logger->info("Ignoring node cache {} of a different server", path);
+		return false;
+	}
+	std::map<std::string, OpcUa::Node> nodes;
+	while (std::getline(in, line)) {
+		size_t tab = line.find('\t');
+		if (tab == std::string::npos)
+			continue;
+		try {
+			nodes[line.substr(0, tab)] = client->GetNode(OpcUa::ToNodeId(line.substr(tab + 1)));
+		} catch (const std::exception &e) {
+			logger->warn("Invalid entry in node cache {}: {}", path, e.what());
+			return false;
+		}
+	}
+	auto get = [&nodes](const std::string &key, OpcUa::Node &node) {
+		auto it = nodes.find(key);
+		if (it == nodes.end())
+			return false;
+		node = it->second;
+		return true;
+	};
+	bool complete = get("basic", nodeBasic) && get("in", nodeIn);
+	for (int i = 0; complete && i < OpcUtils::MPSRegister::LAST; i++)
+		complete = get(OpcUtils::REGISTER_NAMES[i], registerNodes[i]);
+	for (unsigned int set = 0; complete && set < 2; ++set) {
+		for (unsigned int d = 0; complete && d < 2; ++d) {
+			complete = get("data-" + std::to_string(set) + "-" + std::to_string(d),
+			               instructionNodes[set].data[d].node);
+		}
+	}
+	if (!complete) {
+		logger->info("Node cache {} is incomplete", path);
+		return false;
+	}
+	logger->info("Using cached nodes from {}", path);
+	return true;
+}
+
+void
+OpcUaMachine::saveNodeCache(const std::string &path)
+{
+	size_t slash = path.rfind('/');
+	if (slash != std::string::npos && slash > 0) {
+		mkdir(path.substr(0, slash).c_str(), 0755);
+	}
+	// write to a temporary file and rename, a concurrent reader never sees a
+	// partially written cache
+	std::string   tmp_path = path + ".tmp";
+	std::ofstream out(tmp_path, std::ios::trunc);
+	out << node_cache_header() << "\n";
+	out << "basic\t" << OpcUa::ToString(nodeBasic.GetId()) << "\n";
+	out << "in\t" << OpcUa::ToString(nodeIn.GetId()) << "\n";
+	for (int i = 0; i < OpcUtils::MPSRegister::LAST; i++)
+		out << OpcUtils::REGISTER_NAMES[i] << "\t" << OpcUa::ToString(registerNodes[i].GetId()) << "\n";
+	for (unsigned int set = 0; set < 2; ++set) {
+		for (unsigned int d = 0; d < 2; ++d) {
+			out << "data-" << set << "-" << d << "\t"
+			    << OpcUa::ToString(instructionNodes[set].data[d].node.GetId()) << "\n";
+		}
+	}
+	out.close();
+	if (!out || rename(tmp_path.c_str(), path.c_str()) != 0) {
+		logger->warn("Failed to write node cache {}", path);
+		unlink(tmp_path.c_str());
+	}
+}
+
+std::string
+OpcUaMachine::node_cache_header() const
+{
+	return "# " + OpcUtils::getEndpoint(ip_.c_str(), port_).EndpointUrl
+	       + (simulation_ ? " simulation" : " plc");
+}
+
+void
+OpcUaMachine::resolveInstructionNodes()
+{
+	const OpcUtils::MPSRegister offsets[2] = {OpcUtils::MPSRegister::ACTION_ID_IN,
+	                                          OpcUtils::MPSRegister::ACTION_ID_BASIC};
+	for (unsigned int set = 0; set < 2; ++set) {
+		auto resolve = [](const OpcUa::Node &node) {
+			return TypedNode{node, node.GetValue().Type()};
+		};
+		const OpcUtils::MPSRegister offset = offsets[set];
+		InstructionNodes &          nodes  = instructionNodes[set];
+		nodes.action_id = resolve(registerNodes[offset + OpcUtils::MPSRegister::ACTION_ID_IN]);
+		nodes.data[0]   = resolve(nodes.data[0].node);
+		nodes.data[1]   = resolve(nodes.data[1].node);
+		nodes.enable    = resolve(registerNodes[offset + OpcUtils::MPSRegister::STATUS_ENABLE_IN]);
+		nodes.error     = resolve(registerNodes[offset + OpcUtils::MPSRegister::ERROR_IN]);
+	}
+}
+
+void
+OpcUaMachine::disconnect(bool graceful)
 {
 	if (!connected_) {
 		return;
 	}
-	try {
-		cancelAllSubscriptions(true);
-	} catch (std::exception &e) {
-		logger->warn("Error while cancelling subscriptions: {}", e.what());
-	}
-	subscriptions.clear();
+	// the monitored items end with the session, the SubscriptionClients and
+	// their callbacks are kept for the next session
+	dispatcher_.clear();
+	for (auto &s : subscriptions)
+		s.second->subscribed = false;
+	subscription_.reset();
 
-	logger->info("Disconnecting");
 	try {
-		client->Disconnect();
-		logger->info("Disconnected");
-		logger->flush();
-		connected_ = false;
-		client.reset();
-		return;
-	} catch (std::exception &e) {
-		logger->warn("Failed to disconnect: {}", e.what());
-		try {
+		if (graceful) {
+			logger->info("Disconnecting");
+			client->Disconnect();
+			logger->info("Disconnected");
+		} else {
 			logger->info("Aborting the connection");
 			client->Abort();
 			logger->info("Aborted the connection");
-			logger->flush();
-			connected_ = false;
-			client.reset();
-			return;
-		} catch (std::exception &e) {
-			logger->warn("Failed to abort: {}", e.what());
+		}
+	} catch (std::exception &e) {
+		logger->warn("Failed to close the session: {}", e.what());
+		if (graceful) {
 			try {
-				logger->flush();
-				connected_ = false;
-				client.reset();
-				return;
-			} catch (...) {
+				client->Abort();
+			} catch (std::exception &e) {
+				logger->warn("Failed to abort: {}", e.what());
 			}
 		}
 	}
+	logger->flush();
 	connected_ = false;
 	client.reset();
-	return;
 }
 
 void
-OpcUaMachine::subscribeAll(bool simulation)
+OpcUaMachine::subscribeAll()
 {
+	std::vector<OpcUtils::MPSRegister> registers;
 	for (int i = OpcUtils::MPSRegister::ACTION_ID_IN; i < OpcUtils::MPSRegister::LAST; i++)
-		subscribe(static_cast<OpcUtils::MPSRegister>(i), simulation);
+		registers.push_back(static_cast<OpcUtils::MPSRegister>(i));
+	subscribe(registers);
 }
 
 void
-OpcUaMachine::subscribe(std::vector<OpcUtils::MPSRegister> registers, bool simulation)
+OpcUaMachine::subscribe(std::vector<OpcUtils::MPSRegister> registers)
 {
-	for (OpcUtils::MPSRegister reg : registers)
-		subscribe(reg, simulation);
+	std::lock_guard<std::mutex> lock(command_queue_mutex_);
+	requested_registers_.insert(registers.begin(), registers.end());
+	subscriptions_pending_ = true;
+	queue_condition_.notify_one();
+}
+
+void
+OpcUaMachine::subscribe(OpcUtils::MPSRegister reg)
+{
+	subscribe(std::vector<OpcUtils::MPSRegister>{reg});
 }
 
 SubscriptionClient *
-OpcUaMachine::subscribe(OpcUtils::MPSRegister reg, bool simulation)
+OpcUaMachine::subscription_client(OpcUtils::MPSRegister reg)
 {
-	auto it = subscriptions.end();
-	if ((it = subscriptions.find(reg)) != subscriptions.end())
+	auto it = subscriptions.find(reg);
+	if (it != subscriptions.end())
 		return it->second;
-	OpcUa::Node         node = OpcUtils::getNode(client.get(), reg, simulation);
-	SubscriptionClient *sub  = new SubscriptionClient(logger);
-	sub->reg                 = reg;
-	sub->node                = node;
-
-	int response_timeout = 100;
-	sub->subscription    = client->CreateSubscription(response_timeout, *sub);
-	sub->handle          = sub->subscription->SubscribeDataChange(node);
-	logger->info("Subscribed to {} (name: {}, handle: {})",
-	             OpcUtils::REGISTER_NAMES[reg],
-	             node.GetBrowseName().Name,
-	             sub->handle);
+	SubscriptionClient *sub = new SubscriptionClient(logger);
+	sub->reg                = reg;
+	if (reg == OpcUtils::MPSRegister::STATUS_ENABLE_IN
+	    || reg == OpcUtils::MPSRegister::STATUS_ENABLE_BASIC) {
+		const unsigned int set = (reg == OpcUtils::MPSRegister::STATUS_ENABLE_IN) ? 0 : 1;
+		sub->add_callback([this, set](OpcUtils::ReturnValue *ret) {
+			std::lock_guard<std::mutex> lock(ack_mutex_);
+			enable_state_[set] = ret->bool_s;
+			enable_changes_[set] += 1;
+			ack_condition_.notify_all();
+		});
+	}
+	if (reg == OpcUtils::MPSRegister::STATUS_BUSY_IN
+	    || reg == OpcUtils::MPSRegister::STATUS_READY_IN) {
+		sub->add_callback(
+		  [this, reg](OpcUtils::ReturnValue *ret) { trace_flank(reg, ret->bool_s); });
+	}
+	sub->add_callback([this, reg](OpcUtils::ReturnValue *ret) { dispatch_callback(reg, ret); });
 	subscriptions.insert(SubscriptionClient::pair(reg, sub));
 	return sub;
 }
 
-void
-OpcUaMachine::cancelAllSubscriptions(bool log)
+bool
+OpcUaMachine::restoreSubscriptions()
 {
-	if (log)
-		printFinalSubscribtions();
-
-	for (SubscriptionClient::map::iterator it = subscriptions.begin(); it != subscriptions.end();) {
-		OpcUtils::MPSRegister reg = it->first;
-		SubscriptionClient *  sub = it->second;
-		sub->subscription->UnSubscribe(sub->handle);
-		logger->info("Unsubscribed from {} (name: {}, handle: {})",
-		             OpcUtils::REGISTER_NAMES[reg],
-		             sub->node.GetBrowseName().Name,
-		             sub->handle);
-		it = subscriptions.erase(it);
+	std::vector<OpcUtils::MPSRegister> registers(SUB_REGISTERS);
+	{
+		std::lock_guard<std::mutex> lock(command_queue_mutex_);
+		subscriptions_pending_ = false;
+		registers.insert(registers.end(), requested_registers_.begin(), requested_registers_.end());
 	}
-}
-
-SubscriptionClient::map::iterator
-OpcUaMachine::cancelSubscription(OpcUtils::MPSRegister reg, bool log)
-{
-	auto it = subscriptions.find(reg);
-	if (it != subscriptions.end()) {
-		SubscriptionClient *sub = it->second;
-		sub->subscription->UnSubscribe(sub->handle);
-		logger->info("Unsubscribed from {} (name: {}, handle: {})",
-		             OpcUtils::REGISTER_NAMES[reg],
-		             sub->node.GetBrowseName().Name,
-		             sub->handle);
-		if (log)
-			OpcUtils::logReturnValue(getReturnValue(reg), logger, reg);
-		return subscriptions.erase(it);
+	{
+		std::lock_guard<std::mutex> lock(callbacks_mutex_);
+		for (const auto &cb : callbacks_)
+			registers.push_back(cb.first);
 	}
-	return it;
+	for (const auto &s : subscriptions)
+		registers.push_back(s.first);
+
+	// all missing monitored items are created with a single request instead
+	// of one subscription and request per register
+	std::vector<OpcUa::ReadValueId>   items;
+	std::vector<SubscriptionClient *> clients;
+	for (OpcUtils::MPSRegister reg : registers) {
+		SubscriptionClient *sub = subscription_client(reg);
+		if (sub->subscribed || std::find(clients.begin(), clients.end(), sub) != clients.end())
+			continue;
+		sub->node = registerNodes[reg];
+		OpcUa::ReadValueId item;
+		item.NodeId      = sub->node.GetId();
+		item.AttributeId = OpcUa::AttributeId::Value;
+		items.push_back(item);
+		clients.push_back(sub);
+	}
+	if (items.empty())
+		return true;
+	try {
+		if (!subscription_)
+			subscription_ = client->CreateSubscription(opcua_publishing_interval_.count(), dispatcher_);
+		// register the clients first, the initial values arrive with the
+		// first publish response after the request
+		for (SubscriptionClient *sub : clients)
+			dispatcher_.add(sub->node.GetId(), sub);
+		std::vector<uint32_t> handles = subscription_->SubscribeDataChange(items);
+		if (handles.size() != clients.size()) {
+			throw std::runtime_error("Got " + std::to_string(handles.size()) + " handles for "
+			                         + std::to_string(clients.size()) + " monitored items");
+		}
+		for (size_t i = 0; i < clients.size(); ++i) {
+			clients[i]->subscription = subscription_;
+			clients[i]->handle       = handles[i];
+			clients[i]->subscribed   = true;
+		}
+	} catch (std::exception &e) {
+		logger->warn("Failed to subscribe to {} registers: {}", items.size(), e.what());
+		return false;
+	}
+	logger->info("Subscribed to {} registers", items.size());
+	return true;
 }
 
 OpcUtils::ReturnValue *
@@ -425,62 +769,162 @@ OpcUaMachine::printFinalSubscribtions()
 }
 
 void
-OpcUaMachine::register_opc_callback(SubscriptionClient::ReturnValueCallback callback,
-                                    OpcUtils::MPSRegister                   reg)
+OpcUaMachine::set_callback(OpcUtils::MPSRegister                   reg,
+                           SubscriptionClient::ReturnValueCallback callback)
 {
-	logger->info("Registering callback for register {}", reg);
-	SubscriptionClient *sub = subscribe(reg, simulation_);
-	sub->add_callback(callback);
+	bool subscribe = false;
+	{
+		std::lock_guard<std::mutex> lock(callbacks_mutex_);
+		if (callback) {
+			logger->info("Registering callback for register {}", reg);
+			subscribe       = callbacks_.find(reg) == callbacks_.end();
+			callbacks_[reg] = callback;
+		} else {
+			callbacks_.erase(reg);
+		}
+	}
+	if (subscribe) {
+		std::lock_guard<std::mutex> lock(command_queue_mutex_);
+		subscriptions_pending_ = true;
+		queue_condition_.notify_one();
+	}
 }
 
 void
-OpcUaMachine::update_callbacks()
+OpcUaMachine::dispatch_callback(OpcUtils::MPSRegister reg, OpcUtils::ReturnValue *ret)
 {
-	if (!connected_) {
-		return;
-	}
-	for (const auto &cb : callbacks_) {
-		register_opc_callback(cb.second, cb.first);
+	SubscriptionClient::ReturnValueCallback callback;
+	{
+		std::lock_guard<std::mutex> lock(callbacks_mutex_);
+		auto                        it = callbacks_.find(reg);
+		if (it == callbacks_.end())
+			return;
+		callback = it->second;
 	}
+	callback(ret);
 }
 
 void
 OpcUaMachine::register_busy_callback(std::function<void(bool)> callback)
 {
+	SubscriptionClient::ReturnValueCallback cb;
 	if (callback) {
-		callbacks_[OpcUtils::MPSRegister::STATUS_BUSY_IN] = [=](OpcUtils::ReturnValue *ret) {
-			callback(ret->bool_s);
-		};
-	} else {
-		callbacks_.erase(OpcUtils::MPSRegister::STATUS_BUSY_IN);
+		cb = [=](OpcUtils::ReturnValue *ret) { callback(ret->bool_s); };
 	}
-	update_callbacks();
+	set_callback(OpcUtils::MPSRegister::STATUS_BUSY_IN, cb);
 }
 
 void
 OpcUaMachine::register_ready_callback(std::function<void(bool)> callback)
 {
+	SubscriptionClient::ReturnValueCallback cb;
 	if (callback) {
-		callbacks_[OpcUtils::MPSRegister::STATUS_READY_IN] = [=](OpcUtils::ReturnValue *ret) {
-			callback(ret->bool_s);
-		};
-	} else {
-		callbacks_.erase(OpcUtils::MPSRegister::STATUS_READY_IN);
+		cb = [=](OpcUtils::ReturnValue *ret) { callback(ret->bool_s); };
 	}
-	update_callbacks();
+	set_callback(OpcUtils::MPSRegister::STATUS_READY_IN, cb);
 }
 
 void
 OpcUaMachine::register_barcode_callback(std::function<void(unsigned long)> callback)
 {
+	SubscriptionClient::ReturnValueCallback cb;
 	if (callback) {
-		callbacks_[OpcUtils::MPSRegister::BARCODE_IN] = [=](OpcUtils::ReturnValue *ret) {
-			callback(ret->bool_s);
-		};
-	} else {
-		callbacks_.erase(OpcUtils::MPSRegister::BARCODE_IN);
+		cb = [=](OpcUtils::ReturnValue *ret) { callback(ret->bool_s); };
+	}
+	set_callback(OpcUtils::MPSRegister::BARCODE_IN, cb);
+}
+
+void
+OpcUaMachine::register_connected_callback(std::function<void(bool)> callback)
+{
+	std::lock_guard<std::mutex> lock(command_queue_mutex_);
+	connected_callback_ = callback;
+}
+
+void
+OpcUaMachine::set_node_cache_file(const std::string &path)
+{
+	std::lock_guard<std::mutex> lock(command_queue_mutex_);
+	node_cache_file_ = path;
+}
+
+void
+OpcUaMachine::set_trace_file(const std::string &path)
+{
+	std::lock_guard<std::mutex> lock(trace_mutex_);
+	trace_file_ = path;
+}
+
+void
+OpcUaMachine::trace_instruction(unsigned short command,
+                                unsigned short payload1,
+                                unsigned short payload2)
+{
+	std::lock_guard<std::mutex> lock(trace_mutex_);
+	if (trace_file_.empty()) {
+		return;
+	}
+	// instructions without a ready phase end with the next instruction
+	trace_flush();
+	trace_ = TraceRecord{
+	  true, command, payload1, payload2, std::chrono::steady_clock::now(), -1, -1, -1, -1};
+}
+
+void
+OpcUaMachine::trace_flank(OpcUtils::MPSRegister reg, bool value)
+{
+	std::lock_guard<std::mutex> lock(trace_mutex_);
+	if (!trace_.active) {
+		return;
+	}
+	int32_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+	               std::chrono::steady_clock::now() - trace_.sent)
+	               .count();
+	if (reg == OpcUtils::MPSRegister::STATUS_BUSY_IN) {
+		if (value && trace_.busy_on_ms < 0) {
+			trace_.busy_on_ms = ms;
+		} else if (!value && trace_.busy_on_ms >= 0 && trace_.busy_off_ms < 0) {
+			trace_.busy_off_ms = ms;
+		}
+	} else if (value && trace_.ready_on_ms < 0) {
+		trace_.ready_on_ms = ms;
+	} else if (!value && trace_.ready_on_ms >= 0) {
+		// the product has been taken, the instruction is complete
+		trace_.ready_off_ms = ms;
+		trace_flush();
+	}
+}
+
+void
+OpcUaMachine::trace_flush()
+{
+	if (!trace_.active) {
+		return;
+	}
+	trace_.active = false;
+	struct stat st;
+	bool        new_file = stat(trace_file_.c_str(), &st) != 0 || st.st_size == 0;
+	FILE *      f        = fopen(trace_file_.c_str(), "a");
+	if (!f) {
+		logger->warn("Failed to open trace file {}", trace_file_);
+		return;
+	}
+	if (new_file) {
+		fputs("# station,command,payload1,payload2,"
+		      "busy_on_ms,busy_off_ms,ready_on_ms,ready_off_ms\n",
+		      f);
 	}
-	update_callbacks();
+	fprintf(f,
+	        "%s,%u,%u,%u,%d,%d,%d,%d\n",
+	        name().c_str(),
+	        trace_.command,
+	        trace_.payload1,
+	        trace_.payload2,
+	        trace_.busy_on_ms,
+	        trace_.busy_off_ms,
+	        trace_.ready_on_ms,
+	        trace_.ready_off_ms);
+	fclose(f);
 }
 
 void
@@ -27,10 +27,12 @@
 #include "opc_utils.h"
 #include "subscription_client.h"
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <set>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -77,11 +79,17 @@ public:
 	void register_busy_callback(std::function<void(bool)>) override;
 	void register_ready_callback(std::function<void(bool)>) override;
 	void register_barcode_callback(std::function<void(unsigned long)>) override;
+	void register_connected_callback(std::function<void(bool)>) override;
+	// Store the resolved OPC UA NodeIds in the given file and reuse them on
+	// later connects instead of browsing the server; empty to disable
+	void set_node_cache_file(const std::string &path);
+	// Append the times of the busy and ready flanks of each station
+	// instruction to the given CSV file, used as mockup timing profile
+	void set_trace_file(const std::string &path);
 	// Identify: The PLC does not know, which machine it runs. This command tells it the type.
 	virtual void identify();
 
 protected:
-	void connect();
 	void enqueue_instruction(unsigned short command,
 	                         unsigned short payload1 = 0,
 	                         unsigned short payload2 = 0,
@@ -89,38 +97,64 @@ protected:
 	                         unsigned char  status   = 1,
 	                         unsigned char  error    = 0);
 	bool send_instruction(const Instruction &instruction);
+	bool wait_for_instruction_ack(unsigned int set, uint64_t since);
 	void dispatch_command_queue();
-	void update_callbacks();
-	void register_opc_callback(SubscriptionClient::ReturnValueCallback callback,
-	                           OpcUtils::MPSRegister                   reg);
+	// Set or remove the callback for a register, the register is subscribed
+	// by the worker thread, the caller never waits for the server
+	void set_callback(OpcUtils::MPSRegister reg, SubscriptionClient::ReturnValueCallback callback);
+	// Call the callback currently set for a register
+	void dispatch_callback(OpcUtils::MPSRegister reg, OpcUtils::ReturnValue *ret);
 
 	// OPC UA related methods
 	// Connect to OPC UA Server using IP and PORT
 	bool reconnect();
-	// Disconnect from OPC UA Server
-	void disconnect();
+	// Disconnect from OPC UA Server; if not graceful, the session is aborted
+	// without waiting for the server, e.g., after the connection was lost
+	void disconnect(bool graceful = true);
 	// Initialize logger; If log_path is empty, the logs are redirected to
 	// std::cout, else they are saved to the in log_path specified file
 	void initLogger(const std::string &log_path);
 	// Helper function to set OPC UA Node value correctly
 	bool setNodeValue(OpcUa::Node node, boost::any val, OpcUtils::MPSRegister reg);
+	// Resolve all register and instruction nodes from the node cache or by
+	// browsing the server
+	void resolveNodes(const std::string &node_cache_file);
+	// Bind the nodes resolved during an earlier session to the current client
+	void rebindNodes();
+	// Resolve all register nodes by browsing the server
+	void browseNodes();
+	// Read the register nodes from the node cache file, false if there is none
+	bool loadNodeCache(const std::string &path);
+	// Write the register nodes to the node cache file
+	void saveNodeCache(const std::string &path);
+	// First line of the node cache file, identifies the server
+	std::string node_cache_header() const;
+	// Resolve the nodes written by send_instruction and their value types
+	void resolveInstructionNodes();
+	// Notify the connected callback about a change of the connection state
+	void notify_connected(bool connected);
+	// Start the trace record of an instruction sent to the PLC
+	void trace_instruction(unsigned short command, unsigned short payload1, unsigned short payload2);
+	// Record a flank of the busy or ready bit for the current instruction
+	void trace_flank(OpcUtils::MPSRegister reg, bool value);
+	// Append the current trace record to the trace file, trace_mutex_ must be held
+	void trace_flush();
 	// Helper function to get ReturnValue correctly
 	OpcUtils::ReturnValue *getReturnValue(OpcUtils::MPSRegister reg);
 
-	// Subscribe to a specified MPSRegister; If ReturnValue is set, the
-	// SubscriptionClient internal ReturnValue is overridden
-	SubscriptionClient *subscribe(OpcUtils::MPSRegister reg, bool simulation = false);
-	// Subscribe to multiple specified MPSRegisters; If ReturnValues are set, the
-	// SubscriptionClients internal ReturnValues are overridden
-	void subscribe(std::vector<OpcUtils::MPSRegister> registers, bool simulation = false);
-	// Subscribe to all existing MPSRegisters
-	void subscribeAll(bool simulation = false);
-	// Cancel a subscription given a specific MPSRegister; If default argument is
-	// true, final subscription value will be printed before deleting
-	SubscriptionClient::map::iterator cancelSubscription(OpcUtils::MPSRegister reg, bool log = false);
-	// Cancel all existing subscriptions; If default argument is true, final
-	// subscription values will be printed before deleting
-	void cancelAllSubscriptions(bool log = false);
+	// Get the SubscriptionClient of a register, created on first use; it is
+	// kept with its callbacks for the lifetime of the machine
+	SubscriptionClient *subscription_client(OpcUtils::MPSRegister reg);
+	// Subscribe to a specified MPSRegister, done by the worker thread
+	void subscribe(OpcUtils::MPSRegister reg);
+	// Subscribe to multiple specified MPSRegisters, done by the worker thread
+	void subscribe(std::vector<OpcUtils::MPSRegister> registers);
+	// Subscribe to all existing MPSRegisters, done by the worker thread
+	void subscribeAll();
+	// Add all registers with a SubscriptionClient, a callback, requested by
+	// subscribe() or in SUB_REGISTERS which are not monitored yet to the
+	// subscription of the session, in a single request
+	bool restoreSubscriptions();
 	// Print the final subscription values
 	void printFinalSubscribtions();
 
@@ -137,10 +171,48 @@ protected:
 	std::queue<Instruction> command_queue_;
 	std::thread             worker_thread_;
 
-	bool connected_;
-	bool simulation_;
+	// written by the worker thread, read from the threads of the callers
+	std::atomic<bool> connected_;
+	bool              simulation_;
 
+	std::function<void(bool)> connected_callback_;
+	std::string               node_cache_file_;
+
+	// Callbacks set by the users of the machine, read by the SubscriptionClients
+	std::mutex                                                                         callbacks_mutex_;
 	std::unordered_map<OpcUtils::MPSRegister, SubscriptionClient::ReturnValueCallback> callbacks_;
+	// Registers with a new callback or requested by subscribe() wait for the
+	// worker thread to subscribe them
+	bool subscriptions_pending_;
+	// Registers requested by subscribe(), guarded by command_queue_mutex_
+	std::set<OpcUtils::MPSRegister> requested_registers_;
+	// Nodes stay valid while the server is the same, a new session reuses them
+	bool nodes_resolved_;
+
+	// State of the enable bits of the in and basic registers as reported by
+	// DataChange; the PLC clears the bit once it has taken an instruction
+	std::mutex              ack_mutex_;
+	std::condition_variable ack_condition_;
+	uint64_t                enable_changes_[2];
+	bool                    enable_state_[2];
+
+	// Trace record of the last station instruction, times in ms after it
+	// was sent and negative if the flank has not been observed (yet)
+	struct TraceRecord
+	{
+		bool                                  active;
+		unsigned short                        command;
+		unsigned short                        payload1;
+		unsigned short                        payload2;
+		std::chrono::steady_clock::time_point sent;
+		int32_t                               busy_on_ms;
+		int32_t                               busy_off_ms;
+		int32_t                               ready_on_ms;
+		int32_t                               ready_off_ms;
+	};
+	std::mutex  trace_mutex_;
+	std::string trace_file_;
+	TraceRecord trace_;
 
 	// OPC UA related variables
 
@@ -158,8 +230,27 @@ protected:
 	OpcUa::Node nodeIn;
 	// OPC UA Input Register for Basic Jobs
 	OpcUa::Node nodeBasic;
+	// OPC UA Node together with the type of the value it holds
+	struct TypedNode
+	{
+		OpcUa::Node        node;
+		OpcUa::VariantType type;
+	};
+	// OPC UA Nodes written by send_instruction for one register set
+	struct InstructionNodes
+	{
+		TypedNode action_id;
+		TypedNode data[2];
+		TypedNode enable;
+		TypedNode error;
+	};
+	// Nodes for station jobs (index 0) and basic jobs (index 1), resolved on connect
+	InstructionNodes instructionNodes[2];
 	// All subscriptions to MPSRegisters in form map<MPSRegister, Subscription>
 	SubscriptionClient::map subscriptions;
+	// The subscription of the session shared by all monitored registers
+	OpcUa::Subscription::SharedPtr subscription_;
+	SubscriptionDispatcher         dispatcher_;
 };
 
 } // namespace mps_comm
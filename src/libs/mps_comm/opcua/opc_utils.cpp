@@ -21,6 +21,14 @@
 
 #include "opc_utils.h"
 
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+
 namespace llsfrb {
 #if 0
 }
@@ -402,6 +410,37 @@ OpcUtils::getEndpoint(const char *ip, unsigned short port)
 	return endpoint;
 }
 
+bool
+OpcUtils::probeEndpoint(const char *ip, unsigned short port, std::chrono::milliseconds timeout)
+{
+	struct addrinfo hints = {};
+	hints.ai_family       = AF_UNSPEC;
+	hints.ai_socktype     = SOCK_STREAM;
+	struct addrinfo *addrs;
+	if (getaddrinfo(ip, std::to_string(port).c_str(), &hints, &addrs) != 0)
+		return false;
+
+	bool reachable = false;
+	for (struct addrinfo *a = addrs; a != nullptr && !reachable; a = a->ai_next) {
+		int fd = socket(a->ai_family, a->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, a->ai_protocol);
+		if (fd == -1)
+			continue;
+		if (::connect(fd, a->ai_addr, a->ai_addrlen) == 0) {
+			reachable = true;
+		} else if (errno == EINPROGRESS) {
+			struct pollfd pfd = {fd, POLLOUT, 0};
+			if (poll(&pfd, 1, timeout.count()) == 1) {
+				int       err = 0;
+				socklen_t len = sizeof(err);
+				reachable     = getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0;
+			}
+		}
+		close(fd);
+	}
+	freeaddrinfo(addrs);
+	return reachable;
+}
+
 OpcUa::Node
 OpcUtils::getNode(OpcUa::UaClient *client, MPSRegister reg, bool simulation)
 {
@@ -419,7 +458,13 @@ OpcUtils::getNode(OpcUa::UaClient *client, MPSRegister reg, bool simulation)
 OpcUa::Variant
 OpcUtils::getNodeValueWithCorrectType(OpcUa::Node node, boost::any val)
 {
-	switch (node.GetValue().Type()) {
+	return getValueWithType(node.GetValue().Type(), val);
+}
+
+OpcUa::Variant
+OpcUtils::getValueWithType(OpcUa::VariantType type, boost::any val)
+{
+	switch (type) {
 	case OpcUa::VariantType::UINT16: return static_cast<uint16_t>(boost::any_cast<uint16_t>(val));
 	case OpcUa::VariantType::UINT32: return static_cast<uint32_t>(boost::any_cast<uint32_t>(val));
 	case OpcUa::VariantType::UINT64: return static_cast<uint64_t>(boost::any_cast<uint64_t>(val));
@@ -24,6 +24,8 @@
 #include <opc/ua/node.h>
 #include <opc/ua/subscription.h>
 
+#include <chrono>
+
 namespace llsfrb {
 #if 0
 }
@@ -154,10 +156,14 @@ public:
 
 	// Get OPC UA Endpoint given by IP and port
 	static OpcUa::EndpointDescription getEndpoint(const char *ip, unsigned short port);
+	// Check whether a TCP connection to IP and port can be established within timeout
+	static bool probeEndpoint(const char *ip, unsigned short port, std::chrono::milliseconds timeout);
 	// Get OPC UA node using MPSRegister
 	static OpcUa::Node getNode(OpcUa::UaClient *client, MPSRegister reg, bool simulation = false);
 	// Get OPC UA Node value as OPC UA Variant with the needed type
 	static OpcUa::Variant getNodeValueWithCorrectType(OpcUa::Node node, boost::any val);
+	// Get value as OPC UA Variant of the given type
+	static OpcUa::Variant getValueWithType(OpcUa::VariantType type, boost::any val);
 	// Get "basic" OPC UA node
 	static OpcUa::Node getBasicNode(OpcUa::UaClient *client, bool simulation = false);
 	// Get "in" OPC UA node
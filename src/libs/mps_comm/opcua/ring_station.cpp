@@ -56,12 +56,11 @@ OpcUaRingStation::mount_ring(unsigned int feeder, llsf_msgs::RingColor color)
 void
 OpcUaRingStation::register_slide_callback(std::function<void(unsigned int)> callback)
 {
+	SubscriptionClient::ReturnValueCallback cb;
 	if (callback) {
-		callbacks_[OpcUtils::MPSRegister::SLIDECOUNT_IN] = [=](OpcUtils::ReturnValue *ret) {
-			callback(ret->uint16_s);
-		};
+		cb = [=](OpcUtils::ReturnValue *ret) { callback(ret->uint16_s); };
 	}
-	update_callbacks();
+	set_callback(OpcUtils::MPSRegister::SLIDECOUNT_IN, cb);
 }
 
 } // namespace mps_comm
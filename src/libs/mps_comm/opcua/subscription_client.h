@@ -21,6 +21,9 @@
 
 #include "opc_utils.h"
 
+#include <map>
+#include <mutex>
+
 namespace llsfrb {
 #if 0
 }
@@ -41,6 +44,7 @@ public:
 	uint32_t                                                       handle;
 	OpcUtils::MPSRegister                                          reg;
 	OpcUa::Node                                                    node;
+	bool                                                           subscribed = false;
 
 	SubscriptionClient(std::shared_ptr<spdlog::logger> logger_, OpcUtils::ReturnValue *mpsValue_)
 	: mpsValue(mpsValue_), logger(logger_)
@@ -64,6 +68,8 @@ public:
 	}
 
 protected:
+	friend class SubscriptionDispatcher;
+
 	std::shared_ptr<spdlog::logger>  logger;
 	std::vector<ReturnValueCallback> callbacks;
 
@@ -99,5 +105,47 @@ protected:
 		}
 	}
 };
+
+// Handler of a subscription shared by all monitored items of a station, it
+// forwards each data change to the client of the register by node id
+class SubscriptionDispatcher : public OpcUa::SubscriptionHandler
+{
+public:
+	void
+	add(const OpcUa::NodeId &node, SubscriptionClient *client)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		clients_[node] = client;
+	}
+
+	void
+	clear()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		clients_.clear();
+	}
+
+protected:
+	void
+	DataChange(uint32_t              handle,
+	           const OpcUa::Node &   node,
+	           const OpcUa::Variant &val,
+	           OpcUa::AttributeId    attr) override
+	{
+		SubscriptionClient *client = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto                        it = clients_.find(node.GetId());
+			if (it != clients_.end())
+				client = it->second;
+		}
+		if (client != nullptr)
+			client->DataChange(handle, node, val, attr);
+	}
+
+private:
+	std::mutex                                    mutex_;
+	std::map<OpcUa::NodeId, SubscriptionClient *> clients_;
+};
 } // namespace mps_comm
 } // namespace llsfrb
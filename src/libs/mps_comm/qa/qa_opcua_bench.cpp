@@ -0,0 +1,223 @@
+
+/***************************************************************************
+ *  qa_opcua_bench.cpp - OPC UA round-trip benchmark
+ *
+ *  Created: Mon Oct 19 20:21:44 2026
+ *  Copyright  2026  agent <agent@local>
+ *
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+
+// Drive OpcUaMachine instances against rcll-plc-sim (or real PLCs) and
+// measure the time from queueing an instruction until the station reports
+// busy and until it is done again, as well as the rate of data change
+// notifications over all stations. Start the simulator with -c 0 to
+// measure the communication path only.
+
+#include <mps_comm/opcua/base_station.h>
+#include <utils/system/argparser.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace llsfrb::mps_comm;
+using namespace fawkes;
+
+/// @cond QA
+
+typedef std::chrono::steady_clock Clock;
+
+static std::atomic<uint64_t> notifications(0);
+
+struct BenchStation
+{
+	std::unique_ptr<OpcUaBaseStation> mps;
+	std::mutex                        mutex;
+	std::condition_variable           cond;
+	bool                              connected = false;
+	uint64_t                          busy_on   = 0;
+	uint64_t                          busy_off  = 0;
+	std::vector<double>               taken_ms;
+	std::vector<double>               done_ms;
+	unsigned int                      timeouts = 0;
+};
+
+static double
+elapsed_ms(Clock::time_point since)
+{
+	return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+}
+
+static void
+run_station(BenchStation &s, unsigned int count, std::chrono::milliseconds timeout)
+{
+	std::unique_lock<std::mutex> lock(s.mutex);
+	for (unsigned int i = 0; i < count; ++i) {
+		uint64_t          on  = s.busy_on;
+		uint64_t          off = s.busy_off;
+		Clock::time_point t0  = Clock::now();
+		lock.unlock();
+		s.mps->conveyor_move(Machine::FORWARD, Machine::MIDDLE);
+		lock.lock();
+		if (!s.cond.wait_for(lock, timeout, [&] { return s.busy_on > on; })) {
+			++s.timeouts;
+			continue;
+		}
+		s.taken_ms.push_back(elapsed_ms(t0));
+		if (!s.cond.wait_for(lock, timeout, [&] { return s.busy_off > off; })) {
+			++s.timeouts;
+			continue;
+		}
+		s.done_ms.push_back(elapsed_ms(t0));
+	}
+}
+
+static void
+print_stats(const char *what, std::vector<double> v)
+{
+	if (v.empty()) {
+		printf("%-10s no samples\n", what);
+		return;
+	}
+	std::sort(v.begin(), v.end());
+	double sum = 0;
+	for (double d : v) {
+		sum += d;
+	}
+	auto pct = [&v](double p) { return v[std::min(v.size() - 1, (size_t)(p * v.size()))]; };
+	printf("%-10s n=%zu  min %.2f  avg %.2f  p50 %.2f  p95 %.2f  p99 %.2f  max %.2f ms\n",
+	       what,
+	       v.size(),
+	       v.front(),
+	       sum / v.size(),
+	       pct(0.5),
+	       pct(0.95),
+	       pct(0.99),
+	       v.back());
+}
+
+static void
+usage(const char *progname)
+{
+	printf("Usage: %s [-H HOST] [-p PORT] [-n NUM] [-c COUNT] [-s]\n"
+	       " -H HOST   host of the stations, default localhost\n"
+	       " -p PORT   port of the first station, default 4840\n"
+	       " -n NUM    number of stations on consecutive ports, default 7\n"
+	       " -c COUNT  instructions per station, default 100\n"
+	       " -s        use the node layout of connection mode plc_simulation\n",
+	       progname);
+}
+
+int
+main(int argc, char **argv)
+{
+	ArgumentParser argp(argc, argv, "hH:p:n:c:s");
+	if (argp.has_arg("h")) {
+		usage(argv[0]);
+		exit(0);
+	}
+	std::string  host  = argp.has_arg("H") ? argp.arg("H") : "localhost";
+	unsigned int port  = argp.has_arg("p") ? argp.parse_int("p") : 4840;
+	unsigned int num   = argp.has_arg("n") ? argp.parse_int("n") : 7;
+	unsigned int count = argp.has_arg("c") ? argp.parse_int("c") : 100;
+
+	Machine::ConnectionMode mode = argp.has_arg("s") ? Machine::SIMULATION : Machine::PLC;
+
+	std::vector<std::unique_ptr<BenchStation>> stations;
+	Clock::time_point                          t_connect = Clock::now();
+	for (unsigned int i = 0; i < num; ++i) {
+		auto s = std::make_unique<BenchStation>();
+		s->mps = std::make_unique<OpcUaBaseStation>("bench-" + std::to_string(i + 1),
+		                                            host,
+		                                            port + i,
+		                                            "",
+		                                            mode);
+		BenchStation *sp = s.get();
+		s->mps->register_busy_callback([sp](bool busy) {
+			++notifications;
+			std::lock_guard<std::mutex> lock(sp->mutex);
+			++(busy ? sp->busy_on : sp->busy_off);
+			sp->cond.notify_all();
+		});
+		s->mps->register_ready_callback([](bool) { ++notifications; });
+		s->mps->register_connected_callback([sp](bool connected) {
+			std::lock_guard<std::mutex> lock(sp->mutex);
+			sp->connected = connected;
+			sp->cond.notify_all();
+		});
+		stations.push_back(std::move(s));
+	}
+	for (auto &s : stations) {
+		std::unique_lock<std::mutex> lock(s->mutex);
+		if (!s->cond.wait_for(lock, std::chrono::seconds(30), [&] { return s->connected; })) {
+			printf("%s did not connect\n", s->mps->name().c_str());
+			exit(2);
+		}
+	}
+	printf("Connected %u stations in %.1f ms\n", num, elapsed_ms(t_connect));
+
+	notifications = 0;
+	Clock::time_point        t_run = Clock::now();
+	std::vector<std::thread> threads;
+	for (auto &s : stations) {
+		threads.emplace_back(run_station, std::ref(*s), count, std::chrono::milliseconds(5000));
+	}
+	for (auto &t : threads) {
+		t.join();
+	}
+	double run_ms = elapsed_ms(t_run);
+
+	std::vector<double> taken, done;
+	unsigned int        timeouts = 0;
+	for (auto &s : stations) {
+		taken.insert(taken.end(), s->taken_ms.begin(), s->taken_ms.end());
+		done.insert(done.end(), s->done_ms.begin(), s->done_ms.end());
+		timeouts += s->timeouts;
+	}
+	print_stats("taken", taken);
+	print_stats("done", done);
+	printf("%llu notifications in %.1f ms (%.1f/s), %u timeouts\n",
+	       (unsigned long long)notifications.load(),
+	       run_ms,
+	       notifications.load() * 1000. / run_ms,
+	       timeouts);
+
+	stations.clear();
+	return timeouts > 0 ? 1 : 0;
+}
+
+/// @endcond
@@ -43,6 +43,7 @@
 #include <gecode/int.hh>
 #include <gecode/minimodel.hh>
 #include <gecode/search.hh>
+#include <map>
 #include <set>
 #include <vector>
 
@@ -67,6 +68,9 @@
 #define NUM_MPS 7
 #define ALL_MPS BASE, CAP1, CAP2, RING1, RING2, STORAGE, DELIVERY
 
+#define NUM_ANGLES 8
+#define NUM_STATES (NUM_MPS * NUM_ANGLES + 1)
+
 #define TIMEOUT_MS 3000
 
 class MPSPlacingPlacing
@@ -89,379 +93,171 @@ public:
 class MPSPlacing : public Gecode::IntMinimizeSpace
 {
 public:
-	MPSPlacing(int _width, int _height, std::set<int> _machines)
+	MPSPlacing(int                                   _width,
+	           int                                   _height,
+	           std::set<int>                         _machines,
+	           unsigned int                          seed  = time(NULL),
+	           const std::vector<MPSPlacingPlacing> &fixed = std::vector<MPSPlacingPlacing>())
 	{
 		height_   = _height;
 		width_    = _width;
 		machines_ = _machines;
 
-		mps_type_  = Gecode::IntVarArray(*this, (height_ + 2) * (width_ + 2), EMPTY_ROT, NUM_MPS);
-		mps_angle_ = Gecode::IntVarArray(*this, (height_ + 2) * (width_ + 2), EMPTY_ROT, ANGLE_315);
-
-		rg_ = Gecode::Rnd(time(NULL));
-
-		std::vector<int> types({EMPTY_ROT, ALL_MPS});
-		mps_types_ = Gecode::IntArgs(types);
-		mps_count_ = Gecode::IntVarArray(*this, NUM_MPS + 1, EMPTY_ROT, (height_ + 2) * (width_ + 2));
+		const int size = (height_ + 2) * (width_ + 2);
+		mps_type_      = Gecode::IntVarArray(*this, size, EMPTY_ROT, NUM_MPS);
+		mps_angle_     = Gecode::IntVarArray(*this, size, EMPTY_ROT, ANGLE_315);
+
+		rg_ = Gecode::Rnd(seed);
+
+		// The state of a zone combines machine type and angle, 0 is an empty
+		// zone. Restricting the domain of the state to the combinations legal
+		// in a zone replaces the reified rules per zone, type and angle.
+		// Cap and ring stations are subject to the same rules, only their
+		// class is placed and the stations are assigned to the zones of their
+		// class after solving, which removes the symmetric solutions.
+		std::vector<int> state_type(NUM_STATES, EMPTY_ROT);
+		std::vector<int> state_angle(NUM_STATES, EMPTY_ROT);
+		for (int s = 1; s < NUM_STATES; s++) {
+			state_type[s]  = type_of(s);
+			state_angle[s] = angle_of(s);
+		}
+		const Gecode::IntArgs type_table(state_type);
+		const Gecode::IntArgs angle_table(state_angle);
+		std::map<int, int> num_of_class;
+		for (int t : machines_) {
+			num_of_class[type_class(t)] += 1;
+		}
+		std::map<int, int> fixed_state;
+		for (const MPSPlacingPlacing &p : fixed) {
+			if (machines_.find(p.type_) != machines_.end()) {
+				fixed_state[index(p.x_, p.y_)] = state(type_class(p.type_), p.angle_);
+			}
+		}
 
-		// mps_resource are reserved zones needed to operate mps
-		mps_resource_.resize(width_ + 2);
+		std::vector<Gecode::BoolVar>     occupied(size);
+		std::vector<Gecode::BoolVarArgs> reserved(size);
+		Gecode::IntVarArgs               types;
+		Gecode::IntVarArgs               angles;
 		for (int x = 0; x < width_ + 2; x++) {
-			mps_resource_[x].resize(height_ + 2);
 			for (int y = 0; y < height_ + 2; y++) {
-				mps_resource_[x][y] = Gecode::IntVarArray(*this, NUM_MPS, 0, 1);
+				const int i = index(x, y);
+				if (x == 0 || x == width_ + 1 || y == 0 || y == height_ + 1) {
+					Gecode::rel(*this, mps_type_[i], Gecode::IRT_EQ, EMPTY_ROT);
+					Gecode::rel(*this, mps_angle_[i], Gecode::IRT_EQ, EMPTY_ROT);
+					occupied[i] = Gecode::BoolVar(*this, 0, 0);
+					continue;
+				}
+				std::vector<int> legal_states(1, EMPTY_ROT);
+				for (const auto &c : num_of_class) {
+					for (int a = ANGLE_0; a <= ANGLE_315; a++) {
+						if (is_legal(x, y, c.first, a)) {
+							legal_states.push_back(state(c.first, a));
+						}
+					}
+				}
+				Gecode::IntVar zone_state(*this, Gecode::IntSet(legal_states.data(), legal_states.size()));
+				Gecode::element(*this, type_table, zone_state, mps_type_[i]);
+				Gecode::element(*this, angle_table, zone_state, mps_angle_[i]);
+				if (fixed_state.find(i) != fixed_state.end()) {
+					Gecode::rel(*this, zone_state, Gecode::IRT_EQ, fixed_state[i]);
+				}
+				types << mps_type_[i];
+				angles << mps_angle_[i];
+
+				// a machine reserves its own zone and, depending on type and
+				// angle, some of the surrounding ones
+				occupied[i] = Gecode::BoolVar(*this, 0, 1);
+				Gecode::rel(*this, zone_state, Gecode::IRT_NQ, EMPTY_ROT, occupied[i]);
+				reserved[i] << occupied[i];
+				for (int dx = -1; dx <= 1; dx++) {
+					for (int dy = -1; dy <= 1; dy++) {
+						if ((dx == 0 && dy == 0) || is_blocked(x + dx, y + dy)) {
+							continue;
+						}
+						std::vector<int> reserves_zone(NUM_STATES, 0);
+						bool             any = false;
+						for (int s : legal_states) {
+							if (s != EMPTY_ROT && reserves(type_of(s), angle_of(s), dx, dy)) {
+								reserves_zone[s] = 1;
+								any              = true;
+							}
+						}
+						if (any) {
+							Gecode::BoolVar r(*this, 0, 1);
+							Gecode::element(*this, Gecode::IntArgs(reserves_zone), zone_state, r);
+							reserved[index(x + dx, y + dy)] << r;
+						}
+					}
+				}
 			}
 		}
 
-		// counting constraint for number of different machines
-		for (const auto &mps : {ALL_MPS}) {
-			if (machines_.find(mps) != machines_.end()) {
-				Gecode::rel(*this, mps_count_[mps], Gecode::IRT_EQ, 1);
-			} else {
-				Gecode::rel(*this, mps_count_[mps], Gecode::IRT_EQ, 0);
+		// a zone is reserved by at most one machine
+		for (int i = 0; i < size; i++) {
+			if (reserved[i].size() > 1) {
+				Gecode::linear(*this, reserved[i], Gecode::IRT_LQ, 1);
 			}
 		}
 
-		// an EMPTY_ROT zone has no orientation
-		for (int i = 0; i < (height_ + 2) * (width_ + 2); i++) {
-			Gecode::rel(*this, (mps_type_[i] == EMPTY_ROT) >> (mps_angle_[i] == EMPTY_ROT));
-		}
-
-		// placed machine must have an orientation
-		for (int i = 0; i < (height_ + 2) * (width_ + 2); i++) {
-			Gecode::rel(*this, (mps_type_[i] != EMPTY_ROT) >> (mps_angle_[i] != EMPTY_ROT));
-		}
-
-		// mark the border blocked
-		for (int x = 0; x < width_ + 2; x++) {
-			Gecode::rel(*this, mps_type_[index(x, 0)] == EMPTY_ROT);
-			Gecode::rel(*this, mps_resource_[x][0][0] == 1);
-			Gecode::rel(*this, mps_type_[index(x, height_ + 1)] == EMPTY_ROT);
-			Gecode::rel(*this, mps_resource_[x][height_ + 1][0] == 1);
-		}
-		for (int y = 0; y < height_ + 2; y++) {
-			Gecode::rel(*this, mps_type_[index(0, y)] == EMPTY_ROT);
-			Gecode::rel(*this, mps_resource_[0][y][0] == 1);
-			Gecode::rel(*this, mps_type_[index(width_ + 1, y)] == EMPTY_ROT);
-			Gecode::rel(*this, mps_resource_[width_ + 1][y][BASE - 1] == 1);
+		// number of the machines on the field is equal to the defined types
+		for (int c : {BASE, CAP1, STORAGE, DELIVERY}) {
+			Gecode::count(*this, types, c, Gecode::IRT_EQ, num_of_class[c]);
 		}
 
-		// machines where both sides are usable and no additional constraints hold
-		std::vector<int> symmetric_mps;
-		std::vector<int> mps_group = {BASE, STORAGE};
-		std::sort(mps_group.begin(), mps_group.end());
-		set_intersection(mps_group.begin(),
-		                 mps_group.end(),
-		                 machines_.begin(),
-		                 machines_.end(),
-		                 std::back_inserter(symmetric_mps));
-		// machines where the left side of input must not be close to a border
-		std::vector<int> asymmetric_mps;
-		mps_group = {CAP1, CAP2, RING1, RING2};
-		std::sort(mps_group.begin(), mps_group.end());
-		set_intersection(mps_group.begin(),
-		                 mps_group.end(),
-		                 machines_.begin(),
-		                 machines_.end(),
-		                 std::back_inserter(asymmetric_mps));
-		// machines where only the input side is used
-		std::vector<int> input_only_mps;
-		;
-		mps_group = {DELIVERY};
-		std::sort(mps_group.begin(), mps_group.end());
-		set_intersection(mps_group.begin(),
-		                 mps_group.end(),
-		                 machines_.begin(),
-		                 machines_.end(),
-		                 std::back_inserter(input_only_mps));
-
-		// along x border
-		for (int x = 1; x <= width_; x++) {
-			for (int t : symmetric_mps) {
-				Gecode::rel(*this,
-				            (mps_type_[index(x, 1)] == t) >> ((mps_angle_[index(x, 1)] == ANGLE_0)
-				                                              || (mps_angle_[index(x, 1)] == ANGLE_180)));
-				Gecode::rel(*this,
-				            (mps_type_[index(x, height_)] == t)
-				              >> ((mps_angle_[index(x, height_)] == ANGLE_0)
-				                  || (mps_angle_[index(x, height_)] == ANGLE_180)));
-			}
-			for (int t : asymmetric_mps) {
-				Gecode::rel(*this, (mps_type_[index(x, 1)] == t) >> ((mps_angle_[index(x, 1)] == ANGLE_0)));
-				Gecode::rel(*this,
-				            (mps_type_[index(x, height_)] == t)
-				              >> ((mps_angle_[index(x, height_)] == ANGLE_180)));
-			}
-			// machines that only use the input side
-			for (int t : input_only_mps) {
+		// a delivery station in the last row restricts the angle of the
+		// machine in the first row of the same column, as in the previous
+		// formulation of the model
+		if (num_of_class[DELIVERY] > 0) {
+			for (int x = 1; x <= width_; x++) {
 				Gecode::rel(*this,
-				            (mps_type_[index(x, 1)] == t) >> ((mps_angle_[index(x, 1)] != ANGLE_225)
-				                                              && (mps_angle_[index(x, 1)] != ANGLE_270)
-				                                              && (mps_angle_[index(x, 1)] != ANGLE_315)));
-				Gecode::rel(*this,
-				            (mps_type_[index(x, height_)] == t)
+				            (mps_type_[index(x, height_)] == DELIVERY)
 				              >> ((mps_angle_[index(x, 1)] != ANGLE_45)
 				                  && (mps_angle_[index(x, 1)] != ANGLE_90)
 				                  && (mps_angle_[index(x, 1)] != ANGLE_135)));
 			}
 		}
 
-		// special case entry zone wall
-		for (int x = width_ - 1; x <= width_; x++) {
-			for (int t : symmetric_mps) {
-				Gecode::rel(*this,
-				            (mps_type_[index(x, 2)] == t) >> ((mps_angle_[index(x, 1)] == ANGLE_0)
-				                                              || (mps_angle_[index(x, 1)] == ANGLE_180)));
-			}
-			for (int t : asymmetric_mps) {
-				Gecode::rel(*this, (mps_type_[index(x, 2)] == t) >> ((mps_angle_[index(x, 1)] == ANGLE_0)));
-			}
-			for (int t : input_only_mps) {
-				Gecode::rel(*this,
-				            (mps_type_[index(x, 2)] == t) >> ((mps_angle_[index(x, 1)] != ANGLE_225)
-				                                              && (mps_angle_[index(x, 1)] != ANGLE_270)
-				                                              && (mps_angle_[index(x, 1)] != ANGLE_315)));
-			}
-		}
-
-		// along y border
-		for (int y = 1; y <= height_; y++) {
-			// BASE
-			for (int t : symmetric_mps) {
-				Gecode::rel(*this,
-				            (mps_type_[index(1, y)] == t) >> ((mps_angle_[index(1, y)] == ANGLE_90)
-				                                              || (mps_angle_[index(1, y)] == ANGLE_270)));
-				Gecode::rel(*this,
-				            (mps_type_[index(width_, y)] == t)
-				              >> ((mps_angle_[index(width_, y)] == ANGLE_90)
-				                  || (mps_angle_[index(width_, y)] == ANGLE_270)));
-			}
-			for (int t : asymmetric_mps) {
-				// left side is open due to symmetry of field
-				Gecode::rel(*this,
-				            (mps_type_[index(1, y)] == t) >> ((mps_angle_[index(1, y)] == ANGLE_90)
-				                                              || (mps_angle_[index(1, y)] == ANGLE_270)));
-				Gecode::rel(*this,
-				            (mps_type_[index(width_, y)] == t)
-				              >> ((mps_angle_[index(width_, y)] == ANGLE_270)));
-			}
-			for (int t : input_only_mps) {
-				Gecode::rel(*this,
-				            (mps_type_[index(1, y)] == t) >> ((mps_angle_[index(1, y)] != ANGLE_45)
-				                                              && (mps_angle_[index(1, y)] != ANGLE_0)
-				                                              && (mps_angle_[index(1, y)] != ANGLE_315)));
-				Gecode::rel(*this,
-				            (mps_type_[index(width_, y)] == t)
-				              >> ((mps_angle_[index(width_, y)] != ANGLE_135)
-				                  && (mps_angle_[index(width_, y)] != ANGLE_180)
-				                  && (mps_angle_[index(width_, y)] != ANGLE_225)));
-			}
-		}
-		//special case entry wall
-		// no machine with 2 sides can be placed next to the entry wall, hence
-		// only restriction for one-sided machines are needed
-		for (int t : input_only_mps) {
-			Gecode::rel(*this,
-			            (mps_type_[index(width_ - 3, 1)] == t)
-			              >> ((mps_angle_[index(width_ - 3, 1)] != ANGLE_135)
-			                  && (mps_angle_[index(width_ - 3, 1)] != ANGLE_180)
-			                  && (mps_angle_[index(width_ - 3, 1)] != ANGLE_225)));
-		}
-
-		// entry zone is blocked
-		Gecode::rel(*this, mps_resource_[width_][1][0] == 1);
-		Gecode::rel(*this, mps_resource_[width_ - 1][1][0] == 1);
-		Gecode::rel(*this, mps_resource_[width_ - 2][1][0] == 1);
-		Gecode::rel(*this, mps_type_[index(width_, 1)] == EMPTY_ROT);
-		Gecode::rel(*this, mps_type_[index(width_ - 1, 1)] == EMPTY_ROT);
-		Gecode::rel(*this, mps_type_[index(width_ - 2, 1)] == EMPTY_ROT);
-		Gecode::rel(*this, mps_type_[index(width_ - 2, 2)] == EMPTY_ROT);
-
-		// insert blocking constraints
-		for (int x = 1; x <= width_; x++) {
-			for (int y = 1; y <= height_; y++) {
-				for (int t : machines_) {
-					for (int angle : {ANGLE_0,
-					                  ANGLE_45,
-					                  ANGLE_90,
-					                  ANGLE_135,
-					                  ANGLE_180,
-					                  ANGLE_225,
-					                  ANGLE_270,
-					                  ANGLE_315}) {
-						//reserve the station itself
-						Gecode::rel(*this,
-						            ((mps_angle_[index(x, y)] == angle) && (mps_type_[index(x, y)] == t))
-						              >> (mps_resource_[x][y][t - 1] == 1));
-						// reserve top and bottom zones
-						if (angle != ANGLE_0 && angle != ANGLE_180) {
-							if (std::find(input_only_mps.begin(), input_only_mps.end(), t) == input_only_mps.end()
-							    || angle < ANGLE_180) {
-								Gecode::rel(*this,
-								            ((mps_angle_[index(x, y)] == angle) && (mps_type_[index(x, y)] == t))
-								              >> (mps_resource_[x][y - 1][t - 1] == 1));
-							}
-							if (std::find(input_only_mps.begin(), input_only_mps.end(), t) == input_only_mps.end()
-							    || angle > ANGLE_180) {
-								Gecode::rel(*this,
-								            ((mps_angle_[index(x, y)] == angle) && (mps_type_[index(x, y)] == t))
-								              >> (mps_resource_[x][y + 1][t - 1] == 1));
-							}
-						}
-						// reserve left and right zone
-						if (angle != ANGLE_90 && angle != ANGLE_270) {
-							if (std::find(input_only_mps.begin(), input_only_mps.end(), t) == input_only_mps.end()
-							    || angle < ANGLE_90 || angle > 270) {
-								Gecode::rel(*this,
-								            ((mps_angle_[index(x, y)] == angle) && (mps_type_[index(x, y)] == t))
-								              >> (mps_resource_[x - 1][y][t - 1] == 1));
-							}
-							if (std::find(input_only_mps.begin(), input_only_mps.end(), t) == input_only_mps.end()
-							    || (angle > ANGLE_90 && angle < 270)) {
-								Gecode::rel(*this,
-								            ((mps_angle_[index(x, y)] == angle) && (mps_type_[index(x, y)] == t))
-								              >> (mps_resource_[x + 1][y][t - 1] == 1));
-							}
-						}
-					}
-					// reserve top left and bottom right zone
-					for (int angle : {ANGLE_45, ANGLE_225}) {
-						if (std::find(input_only_mps.begin(), input_only_mps.end(), t) == input_only_mps.end()
-						    || angle != ANGLE_225) {
-							Gecode::rel(*this,
-							            ((mps_angle_[index(x, y)] == ANGLE_45) && (mps_type_[index(x, y)] == t))
-							              >> (mps_resource_[x + 1][y + 1][t - 1] == 1));
-						}
-						if (std::find(input_only_mps.begin(), input_only_mps.end(), t) == input_only_mps.end()
-						    || angle != ANGLE_45) {
-							Gecode::rel(*this,
-							            ((mps_angle_[index(x, y)] == ANGLE_45) && (mps_type_[index(x, y)] == t))
-							              >> (mps_resource_[x - 1][y - 1][t - 1] == 1));
-						}
-					}
-					// reserve top right and bottom left zone
-					for (int angle : {ANGLE_135, ANGLE_315}) {
-						if (std::find(input_only_mps.begin(), input_only_mps.end(), t) == input_only_mps.end()
-						    || angle != ANGLE_135) {
-							Gecode::rel(*this,
-							            ((mps_angle_[index(x, y)] == ANGLE_45) && (mps_type_[index(x, y)] == t))
-							              >> (mps_resource_[x - 1][y + 1][t - 1] == 1));
-						}
-						if (std::find(input_only_mps.begin(), input_only_mps.end(), t) == input_only_mps.end()
-						    || angle != ANGLE_315) {
-							Gecode::rel(*this,
-							            ((mps_angle_[index(x, y)] == ANGLE_45) && (mps_type_[index(x, y)] == t))
-							              >> (mps_resource_[x + 1][y - 1][t - 1] == 1));
-						}
-					}
-				}
-			}
-		}
-
 		// prevent more than 2 machines in a line
-
-		//vertical
+		auto at_most_two = [this, &occupied](int x, int y, int dx, int dy) {
+			Gecode::BoolVarArgs line;
+			line << occupied[index(x, y)] << occupied[index(x + dx, y + dy)]
+			     << occupied[index(x + 2 * dx, y + 2 * dy)];
+			Gecode::linear(*this, line, Gecode::IRT_LQ, 2);
+		};
 		for (int x = 1; x <= width_; x++) {
 			for (int y = 1; y <= height_ - 2; y++) {
-				Gecode::rel(*this,
-				            ((mps_type_[index(x, y)] != EMPTY_ROT)
-				             && (mps_type_[index(x, y + 1)] != EMPTY_ROT))
-				              >> (mps_type_[index(x, y + 2)] == EMPTY_ROT));
+				at_most_two(x, y, 0, 1);
 			}
 		}
-
-		//horizontal
 		for (int y = 1; y <= height_; y++) {
 			for (int x = 1; x <= width_ - 2; x++) {
-				Gecode::rel(*this,
-				            ((mps_type_[index(x, y)] != EMPTY_ROT)
-				             && (mps_type_[index(x + 1, y)] != EMPTY_ROT))
-				              >> (mps_type_[index(x + 2, y)] == EMPTY_ROT));
+				at_most_two(x, y, 1, 0);
 			}
 		}
-
-		//diagonal
 		for (int x = 1; x <= width_ - 2; x++) {
 			for (int y = 1; y <= height_ - 2; y++) {
-				Gecode::rel(*this,
-				            ((mps_type_[index(x, y)] != EMPTY_ROT)
-				             && (mps_type_[index(x + 1, y + 1)] != EMPTY_ROT))
-				              >> (mps_type_[index(x + 2, y + 2)] == EMPTY_ROT));
+				at_most_two(x, y, 1, 1);
 			}
 		}
 		for (int x = 3; x <= width_; x++) {
 			for (int y = 1; y <= height_ - 2; y++) {
-				Gecode::rel(*this,
-				            ((mps_type_[index(x, y)] != EMPTY_ROT)
-				             && (mps_type_[index(x - 1, y + 1)] != EMPTY_ROT))
-				              >> (mps_type_[index(x - 2, y + 2)] == EMPTY_ROT));
+				at_most_two(x, y, -1, 1);
 			}
 		}
 
 		// avoid locks in corners
-		Gecode::rel(*this,
-		            (mps_type_[index(2, 1)] != EMPTY_ROT) >> (mps_type_[index(1, 2)] == EMPTY_ROT));
-		Gecode::rel(*this,
-		            (mps_type_[index(1, 2)] != EMPTY_ROT) >> (mps_type_[index(2, 1)] == EMPTY_ROT));
-
-		Gecode::rel(*this,
-		            (mps_type_[index(2, height_)] != EMPTY_ROT)
-		              >> (mps_type_[index(1, height_ - 1)] == EMPTY_ROT));
-		Gecode::rel(*this,
-		            (mps_type_[index(1, height_ - 1)] != EMPTY_ROT)
-		              >> (mps_type_[index(2, height_)] == EMPTY_ROT));
-
-		Gecode::rel(*this,
-		            (mps_type_[index(width_ - 1, height_)] != EMPTY_ROT)
-		              >> (mps_type_[index(width_, height_ - 1)] == EMPTY_ROT));
-		Gecode::rel(*this,
-		            (mps_type_[index(width_, height_ - 1)] != EMPTY_ROT)
-		              >> (mps_type_[index(width_ - 1, height_)] == EMPTY_ROT));
-
-		Gecode::rel(*this,
-		            (mps_type_[index(width_ - 1, 2)] != EMPTY_ROT)
-		              >> (mps_type_[index(width_, 3)] == EMPTY_ROT));
-		Gecode::rel(*this,
-		            (mps_type_[index(width_, 3)] != EMPTY_ROT)
-		              >> (mps_type_[index(width_ - 1, 2)] == EMPTY_ROT));
-
-		Gecode::rel(*this,
-		            (mps_type_[index(1, 1)] != EMPTY_ROT) >> (mps_angle_[index(1, 1)] == ANGLE_135));
-		Gecode::rel(*this,
-		            (mps_type_[index(1, height_)] != EMPTY_ROT)
-		              >> (mps_angle_[index(1, height_)] == ANGLE_315));
-		Gecode::rel(*this,
-		            (mps_type_[index(width_, height_)] != EMPTY_ROT)
-		              >> (mps_angle_[index(width_, height_)] == ANGLE_135));
-		Gecode::rel(*this,
-		            (mps_type_[index(width_, 2)] != EMPTY_ROT)
-		              >> (mps_angle_[index(width_, 2)] == ANGLE_45));
-		Gecode::rel(*this,
-		            (mps_type_[index(width_ - 3, 1)] != EMPTY_ROT)
-		              >> (mps_angle_[index(width_ - 3, 1)] == ANGLE_45));
-
-		// restrict zone usage to max 1
-		for (int x = 0; x < width_ + 2; x++) {
-			for (int y = 0; y < height_ + 2; y++) {
-				Gecode::linear(*this, mps_resource_[x][y], Gecode::IRT_LQ, 1);
-			}
-		}
-
-		// number of the machines on the field is equal to the defined types
-		Gecode::count(*this, mps_type_, mps_count_, mps_types_);
-
-		Gecode::branch(*this, mps_type_, Gecode::INT_VAR_RND(rg_), Gecode::INT_VAL_RND(rg_));
-		Gecode::branch(*this, mps_angle_, Gecode::INT_VAR_RND(rg_), Gecode::INT_VAL_RND(rg_));
-
-		options_.threads = 4;
-
-		stop_ = new Gecode::Search::TimeStop(TIMEOUT_MS);
-
-		options_.stop = stop_;
-
-		search_ = new Gecode::DFS<MPSPlacing>(this, options_);
-
-		solution = NULL;
+		auto not_both = [this, &occupied](int x1, int y1, int x2, int y2) {
+			Gecode::BoolVarArgs pair;
+			pair << occupied[index(x1, y1)] << occupied[index(x2, y2)];
+			Gecode::linear(*this, pair, Gecode::IRT_LQ, 1);
+		};
+		not_both(2, 1, 1, 2);
+		not_both(2, height_, 1, height_ - 1);
+		not_both(width_ - 1, height_, width_, height_ - 1);
+		not_both(width_ - 1, 2, width_, 3);
+
+		Gecode::branch(*this, types, Gecode::INT_VAR_RND(rg_), Gecode::INT_VAL_RND(rg_));
+		Gecode::branch(*this, angles, Gecode::INT_VAR_RND(rg_), Gecode::INT_VAL_RND(rg_));
 	}
 
 #if GECODE_VERSION_NUMBER >= 600200
@@ -476,14 +272,6 @@ public:
 		width_  = s.width_;
 		mps_type_.update(*this, s.mps_type_);
 		mps_angle_.update(*this, s.mps_angle_);
-		mps_count_.update(*this, s.mps_count_);
-		mps_resource_.resize(width_ + 2);
-		for (int x = 0; x < width_ + 2; x++) {
-			mps_resource_[x].resize(height_ + 2);
-			for (int y = 0; y < height_ + 2; y++) {
-				mps_resource_[x][y].update(*this, s.mps_resource_[x][y]);
-			}
-		}
 	};
 #else
 	MPSPlacing(bool share, MPSPlacing &s) : Gecode::IntMinimizeSpace(share, s)
@@ -492,14 +280,6 @@ public:
 		width_  = s.width_;
 		mps_type_.update(*this, share, s.mps_type_);
 		mps_angle_.update(*this, share, s.mps_angle_);
-		mps_count_.update(*this, share, s.mps_count_);
-		mps_resource_.resize(width_ + 2);
-		for (int x = 0; x < width_ + 2; x++) {
-			mps_resource_[x].resize(height_ + 2);
-			for (int y = 0; y < height_ + 2; y++) {
-				mps_resource_[x][y].update(*this, share, s.mps_resource_[x][y]);
-			}
-		}
 	}
 
 	MPSPlacing *
@@ -515,109 +295,203 @@ public:
 		return Gecode::IntVar(0);
 	}
 
-	bool
-	solve()
+	int
+	index(int x, int y) const
 	{
-		bool connected_field = false;
-		while (!connected_field) {
-			if (solution) {
-				delete solution;
-			}
+		return (y * (width_ + 2) + x);
+	}
 
-			stop_->reset();
+	// state of a zone with a machine of type t at angle a
+	static int
+	state(int t, int a)
+	{
+		return (t - 1) * NUM_ANGLES + a;
+	}
 
-			solution = search_->next();
+	static int
+	type_of(int state)
+	{
+		return (state - 1) / NUM_ANGLES + 1;
+	}
 
-			if (!solution) {
-				return false;
+	static int
+	angle_of(int state)
+	{
+		return (state - 1) % NUM_ANGLES + 1;
+	}
+
+	// machines of the same class are subject to the same rules
+	static int
+	type_class(int t)
+	{
+		return (t == CAP2 || t == RING1 || t == RING2) ? CAP1 : t;
+	}
+
+	// walls and the insertion zone must not be reserved
+	bool
+	is_blocked(int x, int y) const
+	{
+		return x <= 0 || x >= width_ + 1 || y <= 0 || y >= height_ + 1
+		       || (y == 1 && x >= width_ - 2);
+	}
+
+	// whether a machine of type t at angle a reserves the zone at offset
+	// (dx, dy); diagonal zones are only reserved at 45 degrees, as in the
+	// previous formulation of the model
+	static bool
+	reserves(int t, int a, int dx, int dy)
+	{
+		if (dx != 0 && dy != 0) {
+			return a == ANGLE_45;
+		}
+		if (t == DELIVERY) {
+			// only the input side is used
+			if (dy == -1) {
+				return a == ANGLE_45 || a == ANGLE_90 || a == ANGLE_135;
+			} else if (dy == 1) {
+				return a == ANGLE_225 || a == ANGLE_270 || a == ANGLE_315;
+			} else if (dx == -1) {
+				return a == ANGLE_0 || a == ANGLE_45;
+			} else {
+				return a == ANGLE_135 || a == ANGLE_180 || a == ANGLE_225 || a == ANGLE_315;
 			}
-			connected_field = is_field_connected();
 		}
-		return true;
+		if (dy != 0) {
+			return a != ANGLE_0 && a != ANGLE_180;
+		}
+		return a != ANGLE_90 && a != ANGLE_270;
 	}
 
-	int
-	index(int x, int y)
+	// whether a machine of type t may be placed at angle a in zone (x, y)
+	bool
+	is_legal(int x, int y, int t, int a) const
 	{
-		return (y * (width_ + 2) + x);
+		// machines where both sides are usable and no additional constraints hold
+		const bool symmetric = (t == BASE || t == STORAGE);
+		// machines where only the input side is used
+		const bool input_only = (t == DELIVERY);
+		// machines where the left side of input must not be close to a border
+		const bool asymmetric = !symmetric && !input_only;
+
+		// insertion zone
+		if ((y == 1 && x >= width_ - 2) || (x == width_ - 2 && y == 2)) {
+			return false;
+		}
+		// reserved zones must not reach into walls or the insertion zone, the
+		// base station is exempt as in the previous formulation
+		for (int dx = -1; t != BASE && dx <= 1; dx++) {
+			for (int dy = -1; dy <= 1; dy++) {
+				if ((dx != 0 || dy != 0) && reserves(t, a, dx, dy) && is_blocked(x + dx, y + dy)) {
+					return false;
+				}
+			}
+		}
+		// along x border
+		if (y == 1) {
+			if ((symmetric && a != ANGLE_0 && a != ANGLE_180) || (asymmetric && a != ANGLE_0)
+			    || (input_only && (a == ANGLE_225 || a == ANGLE_270 || a == ANGLE_315))) {
+				return false;
+			}
+		}
+		if (y == height_) {
+			if ((symmetric && a != ANGLE_0 && a != ANGLE_180) || (asymmetric && a != ANGLE_180)) {
+				return false;
+			}
+		}
+		// special case entry zone wall
+		if (y == 2 && x >= width_ - 1 && !input_only) {
+			return false;
+		}
+		// along y border, left side is open due to symmetry of field
+		if (x == 1) {
+			if ((!input_only && a != ANGLE_90 && a != ANGLE_270)
+			    || (input_only && (a == ANGLE_0 || a == ANGLE_45 || a == ANGLE_315))) {
+				return false;
+			}
+		}
+		if (x == width_) {
+			if ((symmetric && a != ANGLE_90 && a != ANGLE_270) || (asymmetric && a != ANGLE_270)
+			    || (input_only && (a == ANGLE_135 || a == ANGLE_180 || a == ANGLE_225))) {
+				return false;
+			}
+		}
+		// special case entry wall
+		if (x == width_ - 3 && y == 1 && input_only
+		    && (a == ANGLE_135 || a == ANGLE_180 || a == ANGLE_225)) {
+			return false;
+		}
+		// corners
+		if ((x == 1 && y == 1 && a != ANGLE_135) || (x == 1 && y == height_ && a != ANGLE_315)
+		    || (x == width_ && y == height_ && a != ANGLE_135)
+		    || (x == width_ && y == 2 && a != ANGLE_45)
+		    || (x == width_ - 3 && y == 1 && a != ANGLE_45)) {
+			return false;
+		}
+		return true;
 	}
 
+	// check on a solution that all free zones are reachable
 	bool
-	is_field_connected()
+	is_field_connected() const
 	{
 		using namespace boost;
-		if (solution) {
-			// construct grid graph
-			typedef boost::adjacency_list<vecS, vecS, undirectedS> Graph;
-
-			Graph                         G((width_ + 2) * (height_ + 2));
-			std::function<bool(int, int)> is_free_field = [this](int x, int y) {
-				if (solution->mps_type_[index(x, y)].val() != EMPTY_ROT || x == 0 || x == width_ + 1
-				    || y == 0 || y == height_ + 1) {
+		// construct grid graph
+		typedef boost::adjacency_list<vecS, vecS, undirectedS> Graph;
+
+		Graph                         G((width_ + 2) * (height_ + 2));
+		std::function<bool(int, int)> is_free_field = [this](int x, int y) {
+			if (mps_type_[index(x, y)].val() != EMPTY_ROT || x == 0 || x == width_ + 1
+			    || y == 0 || y == height_ + 1) {
+				return false;
+			} else {
+				// exclude the insertion zone
+				if (y == 1 && x > width_ - 3) {
 					return false;
 				} else {
-					// exclude the insertion zone
-					if (y == 1 && x > width_ - 3) {
-						return false;
-					} else {
-						return true;
-					}
+					return true;
 				}
-			};
-			int num_excluded_zones = 0;
-			for (int x = 0; x < width_ + 2; x++) {
-				for (int y = 0; y < height_ + 2; y++) {
-					if (is_free_field(x, y)) {
-						if (is_free_field(x + 1, y)) {
-							add_edge(index(x, y), index(x + 1, y), G);
-						}
-						if (is_free_field(x, y + 1)) {
-							add_edge(index(x, y), index(x, y + 1), G);
-						}
-					} else {
-						num_excluded_zones++;
+			}
+		};
+		int num_excluded_zones = 0;
+		for (int x = 0; x < width_ + 2; x++) {
+			for (int y = 0; y < height_ + 2; y++) {
+				if (is_free_field(x, y)) {
+					if (is_free_field(x + 1, y)) {
+						add_edge(index(x, y), index(x + 1, y), G);
+					}
+					if (is_free_field(x, y + 1)) {
+						add_edge(index(x, y), index(x, y + 1), G);
 					}
+				} else {
+					num_excluded_zones++;
 				}
 			}
-			std::vector<int> component(num_vertices(G));
-			int              num = boost::connected_components(G, &component[0]);
-			return num == num_excluded_zones + 1;
 		}
-		return false;
+		std::vector<int> component(num_vertices(G));
+		int              num = boost::connected_components(G, &component[0]);
+		return num == num_excluded_zones + 1;
 	}
 
-	bool
-	get_solution(std::vector<MPSPlacingPlacing> &result)
+	// get the machine placings of a solution
+	void
+	get_solution(std::vector<MPSPlacingPlacing> &result) const
 	{
-		if (!solution) {
-			return false;
-		}
 		for (int x = 0; x < width_ + 2; x++) {
 			for (int y = 0; y < height_ + 2; y++) {
-				if (solution->mps_type_[index(x, y)].val() != EMPTY_ROT) {
+				if (mps_type_[index(x, y)].val() != EMPTY_ROT) {
 					result.push_back(MPSPlacingPlacing(
-					  x, y, solution->mps_type_[index(x, y)].val(), solution->mps_angle_[index(x, y)].val()));
+					  x, y, mps_type_[index(x, y)].val(), mps_angle_[index(x, y)].val()));
 				}
 			}
 		}
-
-		return true;
 	}
 
 	Gecode::IntVarArray mps_type_;
 	Gecode::IntVarArray mps_angle_;
-	//Gecode::IntVarArray zone_blocked_;
-	std::vector<std::vector<Gecode::IntVarArray>> mps_resource_;
-	Gecode::IntArgs                               mps_types_;
-	Gecode::IntVarArray                           mps_count_;
-	int                                           height_;
-	int                                           width_;
-	std::set<int>                                 machines_;
-	Gecode::DFS<MPSPlacing> *                     search_;
-	MPSPlacing *                                  solution;
-	Gecode::Rnd                                   rg_;
-	Gecode::Search::Options                       options_;
-	Gecode::Search::TimeStop *                    stop_;
+	int                 height_;
+	int                 width_;
+	std::set<int>       machines_;
+	Gecode::Rnd         rg_;
 };
 
 #endif // MPS_PLACING_H
@@ -36,6 +36,8 @@
  */
 
 #include "mps_placing.h"
+#include "mps_placing_pool.h"
+#include "mps_placing_solver.h"
 
 #include <core/threading/mutex_locker.h>
 #include <mps_placing_clips/mps_placing_clips.h>
@@ -65,19 +67,16 @@ MPSPlacingGenerator::MPSPlacingGenerator(CLIPS::Environment *env, fawkes::Mutex
 	machines_              = {BASE, CAP1, CAP2, RING1, RING2, STORAGE, DELIVERY};
 	width_                 = 7;
 	height_                = 8;
+	pool_                  = std::make_unique<MPSPlacingPool>();
+	pool_->prefill(width_, height_, machines_);
 }
 
 /** Destructor. */
 MPSPlacingGenerator::~MPSPlacingGenerator()
 {
-	if (is_generation_running_) {
-		generate_abort();
-	}
-	if (generator_thread_) {
-		generator_thread_->join();
-		generator_thread_.reset();
-	}
+	generate_abort();
 	generator_.reset();
+	pool_.reset();
 	avail_fact_.reset();
 	{
 		fawkes::MutexLocker lock(&clips_mutex_);
@@ -110,6 +109,9 @@ MPSPlacingGenerator::setup_clips()
 	               sigc::mem_fun(*this, &MPSPlacingGenerator::remove_machine))));
 	ADD_FUNCTION("mps-generator-start",
 	             (sigc::slot<void>(sigc::mem_fun(*this, &MPSPlacingGenerator::generate_start))));
+	ADD_FUNCTION("mps-generator-start-incremental",
+	             (sigc::slot<void>(
+	               sigc::mem_fun(*this, &MPSPlacingGenerator::generate_start_incremental))));
 	ADD_FUNCTION("mps-generator-abort",
 	             (sigc::slot<void>(sigc::mem_fun(*this, &MPSPlacingGenerator::generate_abort))));
 	ADD_FUNCTION("mps-generator-running",
@@ -126,7 +128,7 @@ MPSPlacingGenerator::setup_clips()
 void
 MPSPlacingGenerator::generator_thread()
 {
-	is_field_generated_    = generator_->solve();
+	is_field_generated_    = generator_->solve(layout_);
 	is_generation_running_ = false;
 }
 
@@ -136,6 +138,8 @@ MPSPlacingGenerator::set_field(int width, int height)
 	if (width_ > 0 && height > 0) {
 		width_  = width;
 		height_ = height;
+		// the machines have been set before, start generating layouts early
+		pool_->prefill(width_, height_, machines_);
 		return CLIPS::Value("TRUE", CLIPS::TYPE_SYMBOL);
 	} else {
 		return CLIPS::Value("FALSE", CLIPS::TYPE_SYMBOL);
@@ -158,15 +162,42 @@ MPSPlacingGenerator::remove_machine(int machine_index)
 
 void
 MPSPlacingGenerator::generate_start()
+{
+	start(false);
+}
+
+/** Start generating a field that keeps the machines of the last one.
+ * Machines of the last generated field that are still to be placed stay
+ * in their zones, only the others are placed. If there is no room left
+ * for them, the generation fails and a new field must be generated.
+ */
+void
+MPSPlacingGenerator::generate_start_incremental()
+{
+	start(true);
+}
+
+void
+MPSPlacingGenerator::start(bool incremental)
 {
 	if (generator_thread_) {
 		generator_thread_->join();
 		generator_thread_.reset();
 	}
+	std::vector<MPSPlacingPlacing> fixed;
+	if (incremental && is_field_generated_) {
+		fixed.swap(layout_);
+	}
+	is_field_generated_ = false;
+	layout_.clear();
+	if (fixed.empty() && pool_->take(width_, height_, machines_, layout_)) {
+		is_field_generated_ = true;
+		return;
+	}
 	is_generation_running_ = true;
-	is_field_generated_    = false;
 
-	generator_ = std::shared_ptr<MPSPlacing>(new MPSPlacing(width_, height_, machines_));
+	generator_ = std::make_shared<MPSPlacingSolver>(width_, height_, machines_);
+	generator_->set_fixed(fixed);
 	generator_thread_ =
 	  std::shared_ptr<std::thread>(new std::thread(&MPSPlacingGenerator::generator_thread, this));
 }
@@ -174,14 +205,15 @@ MPSPlacingGenerator::generate_start()
 void
 MPSPlacingGenerator::generate_abort()
 {
-	if (0 == pthread_cancel(generator_thread_->native_handle())) {
-		generator_thread_->join();
-		generator_thread_.reset();
-		is_generation_running_ = false;
-		is_field_generated_    = false;
-	} else {
-		// TODO throw?
+	if (!generator_thread_) {
+		return;
 	}
+	// the search engines stop at the next propagation step
+	generator_->cancel();
+	generator_thread_->join();
+	generator_thread_.reset();
+	is_generation_running_ = false;
+	is_field_generated_    = false;
 }
 
 CLIPS::Value
@@ -203,15 +235,9 @@ MPSPlacingGenerator::get_generated_field()
 		return CLIPS::Values(1, CLIPS::Value("INVALID-GENERATION", CLIPS::TYPE_SYMBOL));
 	}
 
-	std::vector<MPSPlacingPlacing> poses;
-	if (!generator_->get_solution(
-	      poses)) { // this should never happen since it is checked in this class
-		return CLIPS::Values(1, CLIPS::Value("INVALID-GENERATION-BUT-WHY", CLIPS::TYPE_SYMBOL));
-	}
-
 	CLIPS::Values machines;
-	machines.reserve(poses.size() * 3);
-	for (MPSPlacingPlacing pose : poses) {
+	machines.reserve(layout_.size() * 3);
+	for (const MPSPlacingPlacing &pose : layout_) {
 		std::string type = "";
 		switch (pose.type_) {
 		case BASE: type = "M-BS"; break;
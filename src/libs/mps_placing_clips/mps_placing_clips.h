@@ -40,20 +40,25 @@
 
 #include <core/threading/mutex.h>
 
+#include <atomic>
 #include <clipsmm.h>
 #include <list>
 #include <map>
 #include <memory>
 #include <set>
 #include <thread>
+#include <vector>
 
-class MPSPlacing;
+class MPSPlacingPlacing;
 
 namespace mps_placing_clips {
 #if 0 /* just to make Emacs auto-indent happy */
 }
 #endif
 
+class MPSPlacingPool;
+class MPSPlacingSolver;
+
 class MPSPlacingGenerator
 {
 public:
@@ -61,6 +66,7 @@ public:
 	~MPSPlacingGenerator();
 
 	void          generate_start();
+	void          generate_start_incremental();
 	void          generate_abort();
 	CLIPS::Value  set_field(int width, int height);
 	CLIPS::Value  add_machine(int machine_index);
@@ -78,11 +84,14 @@ private:
 	int                 height_;
 
 	void generator_thread();
-
-	std::shared_ptr<std::thread> generator_thread_;
-	std::shared_ptr<MPSPlacing>  generator_;
-	bool                         is_generation_running_;
-	bool                         is_field_generated_;
+	void start(bool incremental);
+
+	std::shared_ptr<std::thread>      generator_thread_;
+	std::shared_ptr<MPSPlacingSolver> generator_;
+	std::atomic<bool>                 is_generation_running_;
+	std::atomic<bool>                 is_field_generated_;
+	std::vector<MPSPlacingPlacing>    layout_;
+	std::unique_ptr<MPSPlacingPool>   pool_;
 
 	fawkes::Mutex map_mutex_;
 
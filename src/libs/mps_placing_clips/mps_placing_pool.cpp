@@ -0,0 +1,167 @@
+/***************************************************************************
+ *  mps_placing_pool.cpp - field layouts generated in advance
+ *
+ *  Created: Mon Oct 19 22:48:31 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mps_placing_pool.h"
+
+#include "mps_placing_solver.h"
+
+#include <algorithm>
+
+namespace mps_placing_clips {
+#if 0 /* just to make Emacs auto-indent happy */
+}
+#endif
+
+/** Time a background search may take, in ms. */
+#define POOL_TIMEOUT_MS (10 * TIMEOUT_MS)
+
+/** @class MPSPlacingPool <mps_placing_clips/mps_placing_pool.h>
+ * Field layouts generated in advance.
+ * A background thread keeps a number of valid layouts ready for each field
+ * that has been requested with prefill(), so that a random field can be
+ * handed out without waiting for the solver. The thread uses a single
+ * search engine to not compete with a search running in the foreground.
+ * @author agent
+ */
+
+/** Constructor.
+ * @param layouts_per_field number of layouts to keep ready per field
+ */
+MPSPlacingPool::MPSPlacingPool(unsigned int layouts_per_field)
+: layouts_per_field_(layouts_per_field), shutdown_(false)
+{
+	thread_ = std::thread(&MPSPlacingPool::fill_thread, this);
+}
+
+/** Destructor. */
+MPSPlacingPool::~MPSPlacingPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		shutdown_ = true;
+		if (solver_) {
+			solver_->cancel();
+		}
+	}
+	cond_.notify_all();
+	thread_.join();
+}
+
+/** Keep layouts ready for a field.
+ * @param width width of the field in zones
+ * @param height height of the field in zones
+ * @param machines machine types to place
+ */
+void
+MPSPlacingPool::prefill(int width, int height, const std::set<int> &machines)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	layouts_[Field(width, height, machines)];
+	cond_.notify_all();
+}
+
+/** Take a layout generated in advance.
+ * The field is prefilled if it was not before, the pool is refilled in
+ * the background.
+ * @param width width of the field in zones
+ * @param height height of the field in zones
+ * @param machines machine types to place
+ * @param layout upon success the placings of the machines
+ * @return true if a layout was available, false otherwise
+ */
+bool
+MPSPlacingPool::take(int                             width,
+                     int                             height,
+                     const std::set<int> &           machines,
+                     std::vector<MPSPlacingPlacing> &layout)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto &                      layouts = layouts_[Field(width, height, machines)];
+	cond_.notify_all();
+	if (layouts.empty()) {
+		return false;
+	}
+	layout = std::move(layouts.front());
+	layouts.pop_front();
+	return true;
+}
+
+/** Get number of layouts ready for a field.
+ * @param width width of the field in zones
+ * @param height height of the field in zones
+ * @param machines machine types to place
+ * @return number of layouts that can be taken without waiting
+ */
+size_t
+MPSPlacingPool::available(int width, int height, const std::set<int> &machines)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto                        l = layouts_.find(Field(width, height, machines));
+	return l != layouts_.end() ? l->second.size() : 0;
+}
+
+void
+MPSPlacingPool::fill_thread()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	while (!shutdown_) {
+		auto field = std::find_if(layouts_.begin(), layouts_.end(), [this](const auto &l) {
+			return l.second.size() < layouts_per_field_;
+		});
+		if (field == layouts_.end()) {
+			cond_.wait(lock);
+			continue;
+		}
+		Field f = field->first;
+		solver_ = std::make_shared<MPSPlacingSolver>(
+		  std::get<0>(f), std::get<1>(f), std::get<2>(f), 1, POOL_TIMEOUT_MS);
+		std::shared_ptr<MPSPlacingSolver> solver = solver_;
+		lock.unlock();
+		std::vector<MPSPlacingPlacing> layout;
+		bool                           found = solver->solve(layout);
+		lock.lock();
+		solver_.reset();
+		if (found) {
+			layouts_[f].push_back(std::move(layout));
+		} else if (!shutdown_) {
+			// the field may not have a solution, do not search again before it
+			// is requested again
+			layouts_.erase(f);
+		}
+	}
+}
+
+} // end namespace mps_placing_clips
@@ -0,0 +1,89 @@
+/***************************************************************************
+ *  mps_placing_pool.h - field layouts generated in advance
+ *
+ *  Created: Mon Oct 19 22:48:31 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MPS_PLACING_POOL_H_
+#define __MPS_PLACING_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+class MPSPlacingPlacing;
+
+namespace mps_placing_clips {
+#if 0 /* just to make Emacs auto-indent happy */
+}
+#endif
+
+class MPSPlacingSolver;
+
+class MPSPlacingPool
+{
+public:
+	MPSPlacingPool(unsigned int layouts_per_field = 2);
+	~MPSPlacingPool();
+
+	void prefill(int width, int height, const std::set<int> &machines);
+	bool take(int                             width,
+	          int                             height,
+	          const std::set<int> &           machines,
+	          std::vector<MPSPlacingPlacing> &layout);
+	size_t available(int width, int height, const std::set<int> &machines);
+
+private:
+	typedef std::tuple<int, int, std::set<int>> Field;
+
+	void fill_thread();
+
+	const unsigned int layouts_per_field_;
+
+	std::mutex                                                  mutex_;
+	std::condition_variable                                     cond_;
+	std::map<Field, std::deque<std::vector<MPSPlacingPlacing>>> layouts_;
+	std::shared_ptr<MPSPlacingSolver>                           solver_;
+	bool                                                        shutdown_;
+	std::thread                                                 thread_;
+};
+
+} // namespace mps_placing_clips
+
+#endif
@@ -0,0 +1,264 @@
+/***************************************************************************
+ *  mps_placing_solver.cpp - portfolio search for MPS placings
+ *
+ *  Created: Mon Oct 19 22:14:05 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mps_placing_solver.h"
+
+#include <algorithm>
+#include <random>
+#include <thread>
+
+namespace mps_placing_clips {
+#if 0 /* just to make Emacs auto-indent happy */
+}
+#endif
+
+/** Number of failures after which a restarting worker starts over. */
+#define RESTART_FAIL_LIMIT 200
+
+/** @class MPSPlacingSolver::Stop "mps_placing_solver.h"
+ * Stop object shared by the search engines of a portfolio.
+ * The search stops once a solution has been found by any worker, the
+ * search was cancelled, the deadline has passed or, for restarting
+ * workers, the failure limit of the current run was reached.
+ */
+class MPSPlacingSolver::Stop : public Gecode::Search::Stop
+{
+public:
+	/** Constructor.
+	 * @param solver solver the engine belongs to
+	 * @param fail_limit maximum number of failures, 0 for no limit
+	 */
+	Stop(const MPSPlacingSolver &solver, unsigned long fail_limit)
+	: solver_(solver), fail_limit_(fail_limit)
+	{
+	}
+
+	/** Check whether the search must stop.
+	 * @param s statistics of the engine
+	 * @param o options of the engine
+	 * @return true to stop the search
+	 */
+	virtual bool
+	stop(const Gecode::Search::Statistics &s, const Gecode::Search::Options &o)
+	{
+		return solver_.cancel_ || (fail_limit_ > 0 && s.fail > fail_limit_)
+		       || std::chrono::steady_clock::now() > solver_.deadline_;
+	}
+
+private:
+	const MPSPlacingSolver &solver_;
+	const unsigned long     fail_limit_;
+};
+
+/** @class MPSPlacingSolver <mps_placing_clips/mps_placing_solver.h>
+ * Portfolio search for a random MPS placing.
+ * Several randomized search engines race for the first connected field
+ * layout, each in its own thread with its own seed. The first worker runs
+ * a complete depth-first search, the others restart with a new random
+ * order after a growing number of failures, which cuts off the long tail
+ * of runs stuck in a bad part of the search tree. A solver object is meant
+ * for a single search.
+ * @author agent
+ */
+
+/** Constructor.
+ * @param width width of the field in zones
+ * @param height height of the field in zones
+ * @param machines machine types to place
+ * @param num_workers number of search engines, 0 to use all cores
+ * @param timeout_ms time after which solve() gives up
+ */
+MPSPlacingSolver::MPSPlacingSolver(int                  width,
+                                   int                  height,
+                                   const std::set<int> &machines,
+                                   unsigned int         num_workers,
+                                   unsigned int         timeout_ms)
+: width_(width),
+  height_(height),
+  machines_(machines),
+  num_workers_(num_workers > 0 ? num_workers : std::max(1u, std::thread::hardware_concurrency())),
+  timeout_(timeout_ms),
+  cancel_(false),
+  winner_(-1)
+{
+}
+
+/** Keep machines of an earlier layout.
+ * Only the machines that are not part of the given layout are placed,
+ * e.g., after machines were added. The search fails if the kept machines
+ * do not leave room for the others.
+ * @param fixed placings of the machines to keep, machines which are not
+ * to be placed anymore are ignored
+ */
+void
+MPSPlacingSolver::set_fixed(const std::vector<MPSPlacingPlacing> &fixed)
+{
+	fixed_ = fixed;
+}
+
+/** Search for a field layout.
+ * Blocks until a worker found a layout, all workers failed, the timeout
+ * has passed or cancel() was called.
+ * @param result upon success the placings of the machines
+ * @return true if a layout was found, false otherwise
+ */
+bool
+MPSPlacingSolver::solve(std::vector<MPSPlacingPlacing> &result)
+{
+	deadline_ = std::chrono::steady_clock::now() + timeout_;
+	// draw all seeds at once, workers started in the same second must not
+	// search in the same order
+	std::random_device       rd;
+	std::vector<std::thread> threads;
+	for (unsigned int i = 0; i < num_workers_; ++i) {
+		threads.emplace_back(&MPSPlacingSolver::worker, this, i, rd());
+	}
+	for (auto &t : threads) {
+		t.join();
+	}
+	std::lock_guard<std::mutex> lock(result_mutex_);
+	if (winner_ < 0) {
+		return false;
+	}
+	result = result_;
+	assign_types(result, rd());
+	return true;
+}
+
+/** Cancel a running search.
+ * This can be called from any thread, solve() returns as soon as all
+ * workers noticed the cancellation, which is the case after at most one
+ * propagation step.
+ */
+void
+MPSPlacingSolver::cancel()
+{
+	cancel_ = true;
+}
+
+/** Get number of workers.
+ * @return number of search engines run in parallel
+ */
+unsigned int
+MPSPlacingSolver::num_workers() const
+{
+	return num_workers_;
+}
+
+/** Get worker that found the layout.
+ * @return index of the worker whose layout was returned, -1 if none
+ */
+int
+MPSPlacingSolver::winner() const
+{
+	return winner_;
+}
+
+void
+MPSPlacingSolver::worker(unsigned int id, unsigned int seed)
+{
+	// worker 0 keeps searching the whole tree, so the portfolio is complete
+	unsigned long fail_limit = (id == 0) ? 0 : RESTART_FAIL_LIMIT;
+	while (!cancel_ && std::chrono::steady_clock::now() < deadline_) {
+		MPSPlacing *            model = new MPSPlacing(width_, height_, machines_, seed++, fixed_);
+		Stop                    stop(*this, fail_limit);
+		Gecode::Search::Options options;
+		options.threads = 1;
+		options.stop    = &stop;
+		Gecode::DFS<MPSPlacing> engine(model, options);
+		delete model;
+		if (search(engine, id) || fail_limit == 0 || !engine.stopped()) {
+			return;
+		}
+		fail_limit = fail_limit * 3 / 2;
+	}
+}
+
+bool
+MPSPlacingSolver::search(Gecode::DFS<MPSPlacing> &engine, unsigned int id)
+{
+	while (MPSPlacing *solution = engine.next()) {
+		bool connected = solution->is_field_connected();
+		if (connected) {
+			std::lock_guard<std::mutex> lock(result_mutex_);
+			if (winner_ < 0) {
+				winner_ = id;
+				solution->get_solution(result_);
+			}
+			cancel_ = true;
+		}
+		delete solution;
+		if (connected) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void
+MPSPlacingSolver::assign_types(std::vector<MPSPlacingPlacing> &layout, unsigned int seed) const
+{
+	// the model places the class of cap and ring stations, kept machines
+	// stay in their zone and the others are assigned in random order
+	std::vector<int> types;
+	for (int t : machines_) {
+		if (MPSPlacing::type_class(t) == CAP1) {
+			types.push_back(t);
+		}
+	}
+	std::vector<MPSPlacingPlacing *> unassigned;
+	for (MPSPlacingPlacing &p : layout) {
+		if (p.type_ != CAP1) {
+			continue;
+		}
+		auto f = std::find_if(fixed_.begin(), fixed_.end(), [&p, &types](const MPSPlacingPlacing &f) {
+			return f.x_ == p.x_ && f.y_ == p.y_
+			       && std::find(types.begin(), types.end(), f.type_) != types.end();
+		});
+		if (f != fixed_.end()) {
+			p.type_ = f->type_;
+			types.erase(std::find(types.begin(), types.end(), f->type_));
+		} else {
+			unassigned.push_back(&p);
+		}
+	}
+	std::shuffle(types.begin(), types.end(), std::mt19937(seed));
+	for (size_t i = 0; i < unassigned.size() && i < types.size(); ++i) {
+		unassigned[i]->type_ = types[i];
+	}
+}
+
+} // end namespace mps_placing_clips
@@ -0,0 +1,94 @@
+/***************************************************************************
+ *  mps_placing_solver.h - portfolio search for MPS placings
+ *
+ *  Created: Mon Oct 19 22:14:05 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MPS_PLACING_SOLVER_H_
+#define __MPS_PLACING_SOLVER_H_
+
+#include "mps_placing.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace mps_placing_clips {
+#if 0 /* just to make Emacs auto-indent happy */
+}
+#endif
+
+class MPSPlacingSolver
+{
+public:
+	MPSPlacingSolver(int                  width,
+	                 int                  height,
+	                 const std::set<int> &machines,
+	                 unsigned int         num_workers = 0,
+	                 unsigned int         timeout_ms  = TIMEOUT_MS);
+
+	void set_fixed(const std::vector<MPSPlacingPlacing> &fixed);
+	bool solve(std::vector<MPSPlacingPlacing> &result);
+	void cancel();
+
+	unsigned int num_workers() const;
+	int          winner() const;
+
+private:
+	class Stop;
+
+	void worker(unsigned int id, unsigned int seed);
+	bool search(Gecode::DFS<MPSPlacing> &engine, unsigned int id);
+	void assign_types(std::vector<MPSPlacingPlacing> &layout, unsigned int seed) const;
+
+	const int           width_;
+	const int           height_;
+	const std::set<int> machines_;
+	const unsigned int  num_workers_;
+
+	std::vector<MPSPlacingPlacing> fixed_;
+
+	const std::chrono::milliseconds       timeout_;
+	std::chrono::steady_clock::time_point deadline_;
+	std::atomic<bool>                     cancel_;
+
+	std::mutex                     result_mutex_;
+	int                            winner_;
+	std::vector<MPSPlacingPlacing> result_;
+};
+
+} // namespace mps_placing_clips
+
+#endif
@@ -0,0 +1,193 @@
+/***************************************************************************
+ *  qa_mps_placing_bench.cpp - MPS placing time-to-first-solution benchmark
+ *
+ *  Created: Mon Oct 19 23:10:52 2026
+ *  Copyright  2026  agent <agent@local>
+ *
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Generate random field layouts and report the distribution of the time
+// to the first connected layout, for a single search engine and for the
+// portfolio over all cores, on each of the given field sizes. Optionally,
+// re-place some machines of each layout while keeping the others.
+
+#include <mps_placing_clips/mps_placing_solver.h>
+#include <random>
+#include <utils/system/argparser.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mps_placing_clips;
+using namespace fawkes;
+
+/// @cond QA
+
+typedef std::chrono::steady_clock Clock;
+
+static void
+print_stats(const char *what, std::vector<double> v)
+{
+	if (v.empty()) {
+		printf("%-14s no samples\n", what);
+		return;
+	}
+	std::sort(v.begin(), v.end());
+	double sum = 0;
+	for (double d : v) {
+		sum += d;
+	}
+	auto pct = [&v](double p) { return v[std::min(v.size() - 1, (size_t)(p * v.size()))]; };
+	printf("%-14s n=%zu  min %.1f  avg %.1f  p50 %.1f  p90 %.1f  p99 %.1f  max %.1f ms\n",
+	       what,
+	       v.size(),
+	       v.front(),
+	       sum / v.size(),
+	       pct(0.5),
+	       pct(0.9),
+	       pct(0.99),
+	       v.back());
+}
+
+static std::vector<std::string>
+split(const std::string &s)
+{
+	std::vector<std::string> rv;
+	std::stringstream        ss(s);
+	std::string              item;
+	while (std::getline(ss, item, ',')) {
+		rv.push_back(item);
+	}
+	return rv;
+}
+
+static void
+usage(const char *progname)
+{
+	printf("Usage: %s [-r RUNS] [-f WxH,...] [-j N,...] [-t MS] [-i NUM]\n"
+	       " -r RUNS     layouts to generate per configuration, default 50\n"
+	       " -f WxH,...  field sizes, default 7x8,5x5\n"
+	       " -j N,...    numbers of search engines, default 1 and all cores\n"
+	       " -t MS       timeout per layout, default %u\n"
+	       " -i NUM      also re-place NUM machines of each layout, default 0\n",
+	       progname,
+	       TIMEOUT_MS);
+}
+
+int
+main(int argc, char **argv)
+{
+	ArgumentParser argp(argc, argv, "hr:f:j:t:i:");
+	if (argp.has_arg("h")) {
+		usage(argv[0]);
+		exit(0);
+	}
+	unsigned int runs    = argp.has_arg("r") ? argp.parse_int("r") : 50;
+	unsigned int timeout = argp.has_arg("t") ? argp.parse_int("t") : TIMEOUT_MS;
+	unsigned int replace = argp.has_arg("i") ? argp.parse_int("i") : 0;
+
+	std::vector<std::string>  fields = split(argp.has_arg("f") ? argp.arg("f") : "7x8,5x5");
+	std::vector<unsigned int> workers;
+	if (argp.has_arg("j")) {
+		for (const std::string &j : split(argp.arg("j"))) {
+			workers.push_back(std::stoul(j));
+		}
+	} else {
+		workers = {1, std::max(1u, std::thread::hardware_concurrency())};
+	}
+	const std::set<int> machines = {ALL_MPS};
+
+	std::mt19937 rng(std::random_device{}());
+	unsigned int total_failures = 0;
+	for (const std::string &field : fields) {
+		int width = 0, height = 0;
+		if (sscanf(field.c_str(), "%dx%d", &width, &height) != 2 || width < 4 || height < 3) {
+			printf("Invalid field size %s\n", field.c_str());
+			exit(1);
+		}
+		for (unsigned int num_workers : workers) {
+			std::vector<double> times;
+			std::vector<double> incremental_times;
+			unsigned int        failures             = 0;
+			unsigned int        incremental_failures = 0;
+			unsigned int        restart_winners      = 0;
+			for (unsigned int r = 0; r < runs; ++r) {
+				MPSPlacingSolver               solver(width, height, machines, num_workers, timeout);
+				std::vector<MPSPlacingPlacing> layout;
+				Clock::time_point              start = Clock::now();
+				if (solver.solve(layout)) {
+					times.push_back(
+					  std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+					if (solver.winner() > 0) {
+						++restart_winners;
+					}
+				} else {
+					++failures;
+					continue;
+				}
+				if (replace > 0) {
+					std::shuffle(layout.begin(), layout.end(), rng);
+					layout.erase(layout.end() - std::min<size_t>(replace, layout.size()), layout.end());
+					MPSPlacingSolver               incremental(width, height, machines, num_workers, timeout);
+					std::vector<MPSPlacingPlacing> result;
+					incremental.set_fixed(layout);
+					start = Clock::now();
+					if (incremental.solve(result)) {
+						incremental_times.push_back(
+						  std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+					} else {
+						++incremental_failures;
+					}
+				}
+			}
+			char what[32];
+			snprintf(what, sizeof(what), "%dx%d j=%u", width, height, num_workers);
+			print_stats(what, times);
+			printf("%-14s %u failures, %u found by restarting engines\n", "", failures, restart_winners);
+			total_failures += failures;
+			if (replace > 0) {
+				snprintf(what, sizeof(what), "  re-place %u", replace);
+				print_stats(what, incremental_times);
+				printf("%-14s %u failures, no room left for the machines\n", "", incremental_failures);
+			}
+		}
+	}
+	return total_failures > 0 ? 1 : 0;
+}
+
+/// @endcond
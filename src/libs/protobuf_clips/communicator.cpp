@@ -201,7 +201,7 @@ ClipsProtobufCommunicator::setup_clips()
 void
 ClipsProtobufCommunicator::enable_server(int port)
 {
-	if ((port > 0) && !server_) {
+	if ((port > 0) && !server_ && !offline_) {
 		server_ = new protobuf_comm::ProtobufStreamServer(port, message_register_);
 
 		server_->signal_connected().connect(
@@ -223,6 +223,82 @@ ClipsProtobufCommunicator::disable_server()
 	server_ = NULL;
 }
 
+/** Enable or disable offline operation.
+ * When offline, no sockets are opened. Peers created from CLIPS get an ID
+ * but no network connection, messages broadcast or sent to them are only
+ * passed to the sent signals. The stream server cannot be enabled. Messages
+ * can be passed to CLIPS with inject_peer_message() and
+ * inject_stream_message(). Must be set before CLIPS creates any peer.
+ * @param offline true to operate without network
+ */
+void
+ClipsProtobufCommunicator::set_offline(bool offline)
+{
+	offline_ = offline;
+}
+
+/** Set the source of the receive time of messages.
+ * By default, the receive time is the current system time.
+ * @param time_source function providing the current time, an empty
+ * function to use the system time
+ */
+void
+ClipsProtobufCommunicator::set_time_source(TimeSource time_source)
+{
+	time_source_ = time_source;
+}
+
+/** Pass a message to CLIPS as if it was received by a peer.
+ * @param peer_id ID of the peer that received the message
+ * @param host host the message was sent from
+ * @param port port the message was sent from
+ * @param msg the message, its type must have a CompType enum
+ */
+void
+ClipsProtobufCommunicator::inject_peer_message(long int                                   peer_id,
+                                               const std::string &                        host,
+                                               unsigned short                             port,
+                                               std::shared_ptr<google::protobuf::Message> msg)
+{
+	inject_message(host, port, msg, CT_PEER, peer_id);
+}
+
+/** Pass a message to CLIPS as if it was received from a stream client.
+ * The client is not known as connected client, replies are discarded.
+ * @param host host the message was sent from
+ * @param port port the message was sent from
+ * @param msg the message, its type must have a CompType enum
+ */
+void
+ClipsProtobufCommunicator::inject_stream_message(const std::string &                        host,
+                                                 unsigned short                             port,
+                                                 std::shared_ptr<google::protobuf::Message> msg)
+{
+	inject_message(host, port, msg, CT_SERVER, 0);
+}
+
+void
+ClipsProtobufCommunicator::inject_message(const std::string &                         host,
+                                          unsigned short                              port,
+                                          std::shared_ptr<google::protobuf::Message> &msg,
+                                          ClientType                                  ct,
+                                          long int                                    client_id)
+{
+	const EnumDescriptor *enumdesc = msg->GetDescriptor()->FindEnumTypeByName("CompType");
+	if (!enumdesc) {
+		throw std::logic_error("Message does not have CompType enum");
+	}
+	const EnumValueDescriptor *compdesc = enumdesc->FindValueByName("COMP_ID");
+	const EnumValueDescriptor *msgtdesc = enumdesc->FindValueByName("MSG_TYPE");
+	if (!compdesc || !msgtdesc) {
+		throw std::logic_error("Message CompType enum has no COMP_ID or MSG_TYPE value");
+	}
+
+	fawkes::MutexLocker                    lock(&clips_mutex_);
+	std::pair<std::string, unsigned short> endpoint = std::make_pair(host, port);
+	clips_assert_message(endpoint, compdesc->number(), msgtdesc->number(), msg, ct, client_id);
+}
+
 /** Enable protobuf peer.
  * @param address IP address to send messages to
  * @param send_port UDP port to send messages to
@@ -241,7 +317,12 @@ ClipsProtobufCommunicator::clips_pb_peer_create_local_crypto(std::string address
 	if (recv_port <= 0)
 		recv_port = send_port;
 
-	if (send_port > 0) {
+	if (send_port > 0 && offline_) {
+		fawkes::MutexLocker lock(&map_mutex_);
+		long int            peer_id = ++next_client_id_;
+		offline_peers_.insert(peer_id);
+		return peer_id;
+	} else if (send_port > 0) {
 		protobuf_comm::ProtobufBroadcastPeer *peer = new protobuf_comm::ProtobufBroadcastPeer(
 		  address, send_port, recv_port, message_register_, crypto_key, cipher);
 
@@ -316,6 +397,7 @@ ClipsProtobufCommunicator::clips_pb_peer_destroy(long int peer_id)
 		delete peers_[peer_id];
 		peers_.erase(peer_id);
 	}
+	offline_peers_.erase(peer_id);
 }
 
 /** Setup crypto for peer. 
@@ -707,6 +789,8 @@ ClipsProtobufCommunicator::clips_pb_send(long int client_id, void *msgptr)
 			//printf("***** SENDING via CLIENT\n");
 			peers_[client_id]->send(*m);
 			sig_peer_sent_(client_id, *m);
+		} else if (offline_peers_.find(client_id) != offline_peers_.end()) {
+			sig_peer_sent_(client_id, *m);
 		} else {
 			//printf("Client ID %li is unknown, cannot send message of type %s\n",
 			//     client_id, (*m)->GetTypeName().c_str());
@@ -731,6 +815,10 @@ ClipsProtobufCommunicator::clips_pb_broadcast(long int peer_id, void *msgptr)
 	}
 
 	fawkes::MutexLocker lock(&map_mutex_);
+	if (offline_peers_.find(peer_id) != offline_peers_.end()) {
+		sig_peer_sent_(peer_id, *m);
+		return;
+	}
 	if (peers_.find(peer_id) == peers_.end())
 		return;
 
@@ -873,7 +961,11 @@ ClipsProtobufCommunicator::clips_assert_message(std::pair<std::string, unsigned
 	CLIPS::Template::pointer temp = clips_->get_template("protobuf-msg");
 	if (temp) {
 		struct timeval tv;
-		gettimeofday(&tv, 0);
+		if (time_source_) {
+			time_source_(&tv);
+		} else {
+			gettimeofday(&tv, 0);
+		}
 		void *               ptr  = new std::shared_ptr<google::protobuf::Message>(msg);
 		CLIPS::Fact::pointer fact = CLIPS::Fact::create(*clips_, temp);
 		fact->set_slot("type", msg->GetTypeName());
@@ -40,9 +40,13 @@
 #include <core/threading/mutex.h>
 #include <protobuf_comm/server.h>
 
+#include <sys/time.h>
+
 #include <clipsmm.h>
+#include <functional>
 #include <list>
 #include <map>
+#include <set>
 
 namespace protobuf_comm {
 class ProtobufStreamClient;
@@ -63,9 +67,22 @@ public:
 	                          std::vector<std::string> &proto_path);
 	~ClipsProtobufCommunicator();
 
+	/** Function to get the current time, used as receive time of messages. */
+	typedef std::function<void(struct timeval *)> TimeSource;
+
 	void enable_server(int port);
 	void disable_server();
 
+	void set_offline(bool offline);
+	void set_time_source(TimeSource time_source);
+	void inject_peer_message(long int                                   peer_id,
+	                         const std::string &                        host,
+	                         unsigned short                             port,
+	                         std::shared_ptr<google::protobuf::Message> msg);
+	void inject_stream_message(const std::string &                        host,
+	                           unsigned short                             port,
+	                           std::shared_ptr<google::protobuf::Message> msg);
+
 	/** Get Protobuf server.
    * @return protobuf server */
 	protobuf_comm::ProtobufStreamServer *
@@ -164,6 +181,11 @@ private:
 	                          std::shared_ptr<google::protobuf::Message> &msg,
 	                          ClientType                                  ct,
 	                          long int                                    client_id = 0);
+	void inject_message(const std::string &                         host,
+	                    unsigned short                              port,
+	                    std::shared_ptr<google::protobuf::Message> &msg,
+	                    ClientType                                  ct,
+	                    long int                                    client_id);
 	void handle_server_client_connected(protobuf_comm::ProtobufStreamServer::ClientID client,
 	                                    boost::asio::ip::tcp::endpoint &              endpoint);
 	void handle_server_client_disconnected(protobuf_comm::ProtobufStreamServer::ClientID client,
@@ -218,12 +240,15 @@ private:
 
 	fawkes::Mutex map_mutex_;
 	long int      next_client_id_ = 0;
+	bool          offline_        = false;
+	TimeSource    time_source_;
 
 	std::map<long int, protobuf_comm::ProtobufStreamServer::ClientID>         server_clients_;
 	typedef std::map<protobuf_comm::ProtobufStreamServer::ClientID, long int> RevServerClientMap;
 	RevServerClientMap                                                        rev_server_clients_;
 	std::map<long int, protobuf_comm::ProtobufStreamClient *>                 clients_;
 	std::map<long int, protobuf_comm::ProtobufBroadcastPeer *>                peers_;
+	std::set<long int>                                                        offline_peers_;
 
 	std::map<long int, std::pair<std::string, unsigned short>> client_endpoints_;
 
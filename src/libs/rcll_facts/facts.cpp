@@ -0,0 +1,1162 @@
+/****************************************************************************
+ *  facts.cpp - structs for CLIPS deftemplates
+ *  (auto-generated by clips-factgen, do not modify directly)
+ *
+ *  Generated from: facts.clp
+ ****************************************************************************/
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+#include <clips_replica/slot_convert.h>
+#include <core/exception.h>
+#include <rcll_facts/facts.h>
+
+namespace rcll_facts {
+
+/// @cond INTERNALS
+static const std::vector<CLIPS::Values> &
+slot_values(const clips_replica::FactSnapshot &fact,
+            const char *                       tmpl,
+            const char *const *                slots,
+            unsigned int                       num_slots)
+{
+	if (fact.template_name() != tmpl) {
+		throw fawkes::Exception("Fact %li is a %s, not a %s",
+		                        fact.index(),
+		                        fact.template_name().c_str(),
+		                        tmpl);
+	}
+	const std::vector<std::string> &names = fact.slot_names();
+	if (names.size() != num_slots) {
+		throw fawkes::Exception("Template %s has %zu slots, expected %u, regenerate the structs",
+		                        tmpl,
+		                        names.size(),
+		                        num_slots);
+	}
+	for (unsigned int i = 0; i < num_slots; ++i) {
+		if (names[i] != slots[i]) {
+			throw fawkes::Exception("Slot %u of template %s is %s, expected %s, regenerate the structs",
+			                        i,
+			                        tmpl,
+			                        names[i].c_str(),
+			                        slots[i]);
+		}
+	}
+	return fact.values();
+}
+/// @endcond
+
+/** @class Machine <rcll_facts/facts.h>
+ * Fact of deftemplate machine, generated from facts.clp.
+ */
+
+const char *const Machine::TEMPLATE = "machine";
+const char *const Machine::SLOTS[Machine::NUM_SLOTS] = {
+  "name",
+  "team",
+  "mtype",
+  "actual-lights",
+  "desired-lights",
+  "productions",
+  "state",
+  "prev-state",
+  "task",
+  "mps-busy",
+  "mps-ready",
+  "mps-connected",
+  "proc-time",
+  "proc-start",
+  "down-period",
+  "broken-since",
+  "broken-reason",
+  "pose",
+  "pose-time",
+  "zone",
+  "rotation",
+  "prep-blink-start",
+  "idle-since",
+  "wait-for-product-since",
+  "mps-base-counter",
+  "bases-added",
+  "bases-used",
+  "bs-side",
+  "bs-color",
+  "ds-gate",
+  "ds-last-gate",
+  "ds-order",
+  "ss-operation",
+  "ss-shelf-slot",
+  "ss-wp-description",
+  "rs-ring-color",
+  "rs-ring-colors",
+  "cs-operation",
+  "cs-retrieved"};
+
+/** Constructor. */
+Machine::Machine()
+: productions(0),
+  mps_connected(false),
+  proc_time(0),
+  proc_start(0.),
+  broken_since(0.),
+  rotation(0),
+  prep_blink_start(0.),
+  idle_since(0.),
+  wait_for_product_since(0.),
+  mps_base_counter(0),
+  bases_added(0),
+  bases_used(0),
+  ds_gate(0),
+  ds_last_gate(0),
+  ds_order(0),
+  cs_retrieved(false)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a machine fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+Machine::Machine(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], name);
+	clips_replica::convert_slot(v[1], SLOTS[1], team);
+	clips_replica::convert_slot(v[2], SLOTS[2], mtype);
+	clips_replica::convert_slot(v[3], SLOTS[3], actual_lights);
+	clips_replica::convert_slot(v[4], SLOTS[4], desired_lights);
+	clips_replica::convert_slot(v[5], SLOTS[5], productions);
+	clips_replica::convert_slot(v[6], SLOTS[6], state);
+	clips_replica::convert_slot(v[7], SLOTS[7], prev_state);
+	clips_replica::convert_slot(v[8], SLOTS[8], task);
+	clips_replica::convert_slot(v[9], SLOTS[9], mps_busy);
+	clips_replica::convert_slot(v[10], SLOTS[10], mps_ready);
+	clips_replica::convert_slot(v[11], SLOTS[11], mps_connected);
+	clips_replica::convert_slot(v[12], SLOTS[12], proc_time);
+	clips_replica::convert_slot(v[13], SLOTS[13], proc_start);
+	clips_replica::convert_slot(v[14], SLOTS[14], down_period);
+	clips_replica::convert_slot(v[15], SLOTS[15], broken_since);
+	clips_replica::convert_slot(v[16], SLOTS[16], broken_reason);
+	clips_replica::convert_slot(v[17], SLOTS[17], pose);
+	clips_replica::convert_slot(v[18], SLOTS[18], pose_time);
+	clips_replica::convert_slot(v[19], SLOTS[19], zone);
+	clips_replica::convert_slot(v[20], SLOTS[20], rotation);
+	clips_replica::convert_slot(v[21], SLOTS[21], prep_blink_start);
+	clips_replica::convert_slot(v[22], SLOTS[22], idle_since);
+	clips_replica::convert_slot(v[23], SLOTS[23], wait_for_product_since);
+	clips_replica::convert_slot(v[24], SLOTS[24], mps_base_counter);
+	clips_replica::convert_slot(v[25], SLOTS[25], bases_added);
+	clips_replica::convert_slot(v[26], SLOTS[26], bases_used);
+	clips_replica::convert_slot(v[27], SLOTS[27], bs_side);
+	clips_replica::convert_slot(v[28], SLOTS[28], bs_color);
+	clips_replica::convert_slot(v[29], SLOTS[29], ds_gate);
+	clips_replica::convert_slot(v[30], SLOTS[30], ds_last_gate);
+	clips_replica::convert_slot(v[31], SLOTS[31], ds_order);
+	clips_replica::convert_slot(v[32], SLOTS[32], ss_operation);
+	clips_replica::convert_slot(v[33], SLOTS[33], ss_shelf_slot);
+	clips_replica::convert_slot(v[34], SLOTS[34], ss_wp_description);
+	clips_replica::convert_slot(v[35], SLOTS[35], rs_ring_color);
+	clips_replica::convert_slot(v[36], SLOTS[36], rs_ring_colors);
+	clips_replica::convert_slot(v[37], SLOTS[37], cs_operation);
+	clips_replica::convert_slot(v[38], SLOTS[38], cs_retrieved);
+}
+
+/** @class MachineMpsState <rcll_facts/facts.h>
+ * Fact of deftemplate machine-mps-state, generated from facts.clp.
+ */
+
+const char *const MachineMpsState::TEMPLATE = "machine-mps-state";
+const char *const MachineMpsState::SLOTS[MachineMpsState::NUM_SLOTS] = {
+  "name",
+  "state",
+  "num-bases"};
+
+/** Constructor. */
+MachineMpsState::MachineMpsState()
+: num_bases(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a machine-mps-state fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+MachineMpsState::MachineMpsState(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], name);
+	clips_replica::convert_slot(v[1], SLOTS[1], state);
+	clips_replica::convert_slot(v[2], SLOTS[2], num_bases);
+}
+
+/** @class MpsStatusFeedback <rcll_facts/facts.h>
+ * Fact of deftemplate mps-status-feedback, generated from facts.clp.
+ */
+
+const char *const MpsStatusFeedback::TEMPLATE = "mps-status-feedback";
+const char *const MpsStatusFeedback::SLOTS[MpsStatusFeedback::NUM_SLOTS] = {
+  "machine",
+  "type",
+  "value"};
+
+/** Constructor. */
+MpsStatusFeedback::MpsStatusFeedback()
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a mps-status-feedback fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+MpsStatusFeedback::MpsStatusFeedback(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], machine);
+	clips_replica::convert_slot(v[1], SLOTS[1], type);
+	clips_replica::convert_slot(v[2], SLOTS[2], value);
+}
+
+/** @class MachineSsShelfSlot <rcll_facts/facts.h>
+ * Fact of deftemplate machine-ss-shelf-slot, generated from facts.clp.
+ */
+
+const char *const MachineSsShelfSlot::TEMPLATE = "machine-ss-shelf-slot";
+const char *const MachineSsShelfSlot::SLOTS[MachineSsShelfSlot::NUM_SLOTS] = {
+  "name",
+  "position",
+  "is-filled",
+  "is-accessible",
+  "move-to",
+  "num-payments",
+  "description",
+  "last-payed"};
+
+/** Constructor. */
+MachineSsShelfSlot::MachineSsShelfSlot()
+: is_filled(false), is_accessible(false), num_payments(0), last_payed(0.)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a machine-ss-shelf-slot fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+MachineSsShelfSlot::MachineSsShelfSlot(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], name);
+	clips_replica::convert_slot(v[1], SLOTS[1], position);
+	clips_replica::convert_slot(v[2], SLOTS[2], is_filled);
+	clips_replica::convert_slot(v[3], SLOTS[3], is_accessible);
+	clips_replica::convert_slot(v[4], SLOTS[4], move_to);
+	clips_replica::convert_slot(v[5], SLOTS[5], num_payments);
+	clips_replica::convert_slot(v[6], SLOTS[6], description);
+	clips_replica::convert_slot(v[7], SLOTS[7], last_payed);
+}
+
+/** @class MachineLightCode <rcll_facts/facts.h>
+ * Fact of deftemplate machine-light-code, generated from facts.clp.
+ */
+
+const char *const MachineLightCode::TEMPLATE = "machine-light-code";
+const char *const MachineLightCode::SLOTS[MachineLightCode::NUM_SLOTS] = {
+  "id",
+  "code"};
+
+/** Constructor. */
+MachineLightCode::MachineLightCode()
+: id(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a machine-light-code fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+MachineLightCode::MachineLightCode(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], id);
+	clips_replica::convert_slot(v[1], SLOTS[1], code);
+}
+
+/** @class MachineGeneration <rcll_facts/facts.h>
+ * Fact of deftemplate machine-generation, generated from facts.clp.
+ */
+
+const char *const MachineGeneration::TEMPLATE = "machine-generation";
+const char *const MachineGeneration::SLOTS[MachineGeneration::NUM_SLOTS] = {
+  "state",
+  "generation-state-last-checked"};
+
+/** Constructor. */
+MachineGeneration::MachineGeneration()
+: generation_state_last_checked(0.)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a machine-generation fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+MachineGeneration::MachineGeneration(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], state);
+	clips_replica::convert_slot(v[1], SLOTS[1], generation_state_last_checked);
+}
+
+/** @class MirrorOrientation <rcll_facts/facts.h>
+ * Fact of deftemplate mirror-orientation, generated from facts.clp.
+ */
+
+const char *const MirrorOrientation::TEMPLATE = "mirror-orientation";
+const char *const MirrorOrientation::SLOTS[MirrorOrientation::NUM_SLOTS] = {
+  "cyan",
+  "magenta"};
+
+/** Constructor. */
+MirrorOrientation::MirrorOrientation()
+: cyan(0), magenta(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a mirror-orientation fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+MirrorOrientation::MirrorOrientation(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], cyan);
+	clips_replica::convert_slot(v[1], SLOTS[1], magenta);
+}
+
+/** @class Robot <rcll_facts/facts.h>
+ * Fact of deftemplate robot, generated from facts.clp.
+ */
+
+const char *const Robot::TEMPLATE = "robot";
+const char *const Robot::SLOTS[Robot::NUM_SLOTS] = {
+  "number",
+  "state",
+  "team",
+  "team-color",
+  "name",
+  "host",
+  "port",
+  "last-seen",
+  "warning-sent",
+  "has-pose",
+  "pose",
+  "pose-time",
+  "vision-pose",
+  "vision-pose-time",
+  "maintenance-start-time",
+  "maintenance-cycles",
+  "maintenance-warning-sent"};
+
+/** Constructor. */
+Robot::Robot()
+: number(0),
+  port(0),
+  warning_sent(false),
+  has_pose(false),
+  maintenance_start_time(0.),
+  maintenance_cycles(0),
+  maintenance_warning_sent(false)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a robot fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+Robot::Robot(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], number);
+	clips_replica::convert_slot(v[1], SLOTS[1], state);
+	clips_replica::convert_slot(v[2], SLOTS[2], team);
+	clips_replica::convert_slot(v[3], SLOTS[3], team_color);
+	clips_replica::convert_slot(v[4], SLOTS[4], name);
+	clips_replica::convert_slot(v[5], SLOTS[5], host);
+	clips_replica::convert_slot(v[6], SLOTS[6], port);
+	clips_replica::convert_slot(v[7], SLOTS[7], last_seen);
+	clips_replica::convert_slot(v[8], SLOTS[8], warning_sent);
+	clips_replica::convert_slot(v[9], SLOTS[9], has_pose);
+	clips_replica::convert_slot(v[10], SLOTS[10], pose);
+	clips_replica::convert_slot(v[11], SLOTS[11], pose_time);
+	clips_replica::convert_slot(v[12], SLOTS[12], vision_pose);
+	clips_replica::convert_slot(v[13], SLOTS[13], vision_pose_time);
+	clips_replica::convert_slot(v[14], SLOTS[14], maintenance_start_time);
+	clips_replica::convert_slot(v[15], SLOTS[15], maintenance_cycles);
+	clips_replica::convert_slot(v[16], SLOTS[16], maintenance_warning_sent);
+}
+
+/** @class RobotBeacon <rcll_facts/facts.h>
+ * Fact of deftemplate robot-beacon, generated from facts.clp.
+ */
+
+const char *const RobotBeacon::TEMPLATE = "robot-beacon";
+const char *const RobotBeacon::SLOTS[RobotBeacon::NUM_SLOTS] = {
+  "rcvd-at",
+  "seq",
+  "time",
+  "number",
+  "team-name",
+  "team-color",
+  "peer-name",
+  "host",
+  "port",
+  "has-pose",
+  "pose",
+  "pose-time"};
+
+/** Constructor. */
+RobotBeacon::RobotBeacon()
+: seq(0), number(0), port(0), has_pose(false)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a robot-beacon fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+RobotBeacon::RobotBeacon(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], rcvd_at);
+	clips_replica::convert_slot(v[1], SLOTS[1], seq);
+	clips_replica::convert_slot(v[2], SLOTS[2], time);
+	clips_replica::convert_slot(v[3], SLOTS[3], number);
+	clips_replica::convert_slot(v[4], SLOTS[4], team_name);
+	clips_replica::convert_slot(v[5], SLOTS[5], team_color);
+	clips_replica::convert_slot(v[6], SLOTS[6], peer_name);
+	clips_replica::convert_slot(v[7], SLOTS[7], host);
+	clips_replica::convert_slot(v[8], SLOTS[8], port);
+	clips_replica::convert_slot(v[9], SLOTS[9], has_pose);
+	clips_replica::convert_slot(v[10], SLOTS[10], pose);
+	clips_replica::convert_slot(v[11], SLOTS[11], pose_time);
+}
+
+/** @class Signal <rcll_facts/facts.h>
+ * Fact of deftemplate signal, generated from facts.clp.
+ */
+
+const char *const Signal::TEMPLATE = "signal";
+const char *const Signal::SLOTS[Signal::NUM_SLOTS] = {
+  "type",
+  "time",
+  "seq",
+  "count"};
+
+/** Constructor. */
+Signal::Signal()
+: seq(0), count(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a signal fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+Signal::Signal(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], type);
+	clips_replica::convert_slot(v[1], SLOTS[1], time);
+	clips_replica::convert_slot(v[2], SLOTS[2], seq);
+	clips_replica::convert_slot(v[3], SLOTS[3], count);
+}
+
+/** @class NetworkClient <rcll_facts/facts.h>
+ * Fact of deftemplate network-client, generated from facts.clp.
+ */
+
+const char *const NetworkClient::TEMPLATE = "network-client";
+const char *const NetworkClient::SLOTS[NetworkClient::NUM_SLOTS] = {
+  "id",
+  "host",
+  "port",
+  "is-slave"};
+
+/** Constructor. */
+NetworkClient::NetworkClient()
+: id(0), port(0), is_slave(false)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a network-client fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+NetworkClient::NetworkClient(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], id);
+	clips_replica::convert_slot(v[1], SLOTS[1], host);
+	clips_replica::convert_slot(v[2], SLOTS[2], port);
+	clips_replica::convert_slot(v[3], SLOTS[3], is_slave);
+}
+
+/** @class NetworkPeer <rcll_facts/facts.h>
+ * Fact of deftemplate network-peer, generated from facts.clp.
+ */
+
+const char *const NetworkPeer::TEMPLATE = "network-peer";
+const char *const NetworkPeer::SLOTS[NetworkPeer::NUM_SLOTS] = {
+  "group",
+  "id",
+  "network-prefix"};
+
+/** Constructor. */
+NetworkPeer::NetworkPeer()
+: id(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a network-peer fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+NetworkPeer::NetworkPeer(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], group);
+	clips_replica::convert_slot(v[1], SLOTS[1], id);
+	clips_replica::convert_slot(v[2], SLOTS[2], network_prefix);
+}
+
+/** @class AttentionMessage <rcll_facts/facts.h>
+ * Fact of deftemplate attention-message, generated from facts.clp.
+ */
+
+const char *const AttentionMessage::TEMPLATE = "attention-message";
+const char *const AttentionMessage::SLOTS[AttentionMessage::NUM_SLOTS] = {
+  "team",
+  "text",
+  "time"};
+
+/** Constructor. */
+AttentionMessage::AttentionMessage()
+: time(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a attention-message fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+AttentionMessage::AttentionMessage(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], team);
+	clips_replica::convert_slot(v[1], SLOTS[1], text);
+	clips_replica::convert_slot(v[2], SLOTS[2], time);
+}
+
+/** @class SendMpsPositions <rcll_facts/facts.h>
+ * Fact of deftemplate send-mps-positions, generated from facts.clp.
+ */
+
+const char *const SendMpsPositions::TEMPLATE = "send-mps-positions";
+const char *const SendMpsPositions::SLOTS[SendMpsPositions::NUM_SLOTS] = {
+  "phases"};
+
+/** Constructor. */
+SendMpsPositions::SendMpsPositions()
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a send-mps-positions fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+SendMpsPositions::SendMpsPositions(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], phases);
+}
+
+/** @class Order <rcll_facts/facts.h>
+ * Fact of deftemplate order, generated from facts.clp.
+ */
+
+const char *const Order::TEMPLATE = "order";
+const char *const Order::SLOTS[Order::NUM_SLOTS] = {
+  "id",
+  "complexity",
+  "competitive",
+  "base-color",
+  "ring-colors",
+  "cap-color",
+  "quantity-requested",
+  "quantity-delivered",
+  "start-range",
+  "duration-range",
+  "delivery-period",
+  "delivery-gate",
+  "active",
+  "activate-at",
+  "activation-range",
+  "allow-overtime"};
+
+/** Constructor. */
+Order::Order()
+: id(0),
+  competitive(false),
+  quantity_requested(0),
+  delivery_gate(0),
+  active(false),
+  activate_at(0),
+  allow_overtime(false)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a order fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+Order::Order(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], id);
+	clips_replica::convert_slot(v[1], SLOTS[1], complexity);
+	clips_replica::convert_slot(v[2], SLOTS[2], competitive);
+	clips_replica::convert_slot(v[3], SLOTS[3], base_color);
+	clips_replica::convert_slot(v[4], SLOTS[4], ring_colors);
+	clips_replica::convert_slot(v[5], SLOTS[5], cap_color);
+	clips_replica::convert_slot(v[6], SLOTS[6], quantity_requested);
+	clips_replica::convert_slot(v[7], SLOTS[7], quantity_delivered);
+	clips_replica::convert_slot(v[8], SLOTS[8], start_range);
+	clips_replica::convert_slot(v[9], SLOTS[9], duration_range);
+	clips_replica::convert_slot(v[10], SLOTS[10], delivery_period);
+	clips_replica::convert_slot(v[11], SLOTS[11], delivery_gate);
+	clips_replica::convert_slot(v[12], SLOTS[12], active);
+	clips_replica::convert_slot(v[13], SLOTS[13], activate_at);
+	clips_replica::convert_slot(v[14], SLOTS[14], activation_range);
+	clips_replica::convert_slot(v[15], SLOTS[15], allow_overtime);
+}
+
+/** @class WorkpieceTracking <rcll_facts/facts.h>
+ * Fact of deftemplate workpiece-tracking, generated from facts.clp.
+ */
+
+const char *const WorkpieceTracking::TEMPLATE = "workpiece-tracking";
+const char *const WorkpieceTracking::SLOTS[WorkpieceTracking::NUM_SLOTS] = {
+  "enabled",
+  "fail-safe",
+  "reason",
+  "broadcast"};
+
+/** Constructor. */
+WorkpieceTracking::WorkpieceTracking()
+: enabled(false), fail_safe(false), broadcast(false)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a workpiece-tracking fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+WorkpieceTracking::WorkpieceTracking(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], enabled);
+	clips_replica::convert_slot(v[1], SLOTS[1], fail_safe);
+	clips_replica::convert_slot(v[2], SLOTS[2], reason);
+	clips_replica::convert_slot(v[3], SLOTS[3], broadcast);
+}
+
+/** @class Workpiece <rcll_facts/facts.h>
+ * Fact of deftemplate workpiece, generated from facts.clp.
+ */
+
+const char *const Workpiece::TEMPLATE = "workpiece";
+const char *const Workpiece::SLOTS[Workpiece::NUM_SLOTS] = {
+  "id",
+  "order",
+  "at-machine",
+  "state",
+  "base-color",
+  "ring-colors",
+  "cap-color",
+  "team",
+  "visible"};
+
+/** Constructor. */
+Workpiece::Workpiece()
+: id(0), order(0), visible(0.)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a workpiece fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+Workpiece::Workpiece(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], id);
+	clips_replica::convert_slot(v[1], SLOTS[1], order);
+	clips_replica::convert_slot(v[2], SLOTS[2], at_machine);
+	clips_replica::convert_slot(v[3], SLOTS[3], state);
+	clips_replica::convert_slot(v[4], SLOTS[4], base_color);
+	clips_replica::convert_slot(v[5], SLOTS[5], ring_colors);
+	clips_replica::convert_slot(v[6], SLOTS[6], cap_color);
+	clips_replica::convert_slot(v[7], SLOTS[7], team);
+	clips_replica::convert_slot(v[8], SLOTS[8], visible);
+}
+
+/** @class RingSpec <rcll_facts/facts.h>
+ * Fact of deftemplate ring-spec, generated from facts.clp.
+ */
+
+const char *const RingSpec::TEMPLATE = "ring-spec";
+const char *const RingSpec::SLOTS[RingSpec::NUM_SLOTS] = {
+  "color",
+  "req-bases"};
+
+/** Constructor. */
+RingSpec::RingSpec()
+: req_bases(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a ring-spec fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+RingSpec::RingSpec(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], color);
+	clips_replica::convert_slot(v[1], SLOTS[1], req_bases);
+}
+
+/** @class DeliveryPeriod <rcll_facts/facts.h>
+ * Fact of deftemplate delivery-period, generated from facts.clp.
+ */
+
+const char *const DeliveryPeriod::TEMPLATE = "delivery-period";
+const char *const DeliveryPeriod::SLOTS[DeliveryPeriod::NUM_SLOTS] = {
+  "delivery-gates",
+  "period"};
+
+/** Constructor. */
+DeliveryPeriod::DeliveryPeriod()
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a delivery-period fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+DeliveryPeriod::DeliveryPeriod(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], delivery_gates);
+	clips_replica::convert_slot(v[1], SLOTS[1], period);
+}
+
+/** @class RefereeConfirmation <rcll_facts/facts.h>
+ * Fact of deftemplate referee-confirmation, generated from facts.clp.
+ */
+
+const char *const RefereeConfirmation::TEMPLATE = "referee-confirmation";
+const char *const RefereeConfirmation::SLOTS[RefereeConfirmation::NUM_SLOTS] = {
+  "process-id",
+  "state"};
+
+/** Constructor. */
+RefereeConfirmation::RefereeConfirmation()
+: process_id(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a referee-confirmation fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+RefereeConfirmation::RefereeConfirmation(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], process_id);
+	clips_replica::convert_slot(v[1], SLOTS[1], state);
+}
+
+/** @class ProductProcessed <rcll_facts/facts.h>
+ * Fact of deftemplate product-processed, generated from facts.clp.
+ */
+
+const char *const ProductProcessed::TEMPLATE = "product-processed";
+const char *const ProductProcessed::SLOTS[ProductProcessed::NUM_SLOTS] = {
+  "id",
+  "workpiece",
+  "game-time",
+  "team",
+  "mtype",
+  "at-machine",
+  "delivery-gate",
+  "confirmed",
+  "base-color",
+  "ring-color",
+  "cap-color",
+  "scored",
+  "order"};
+
+/** Constructor. */
+ProductProcessed::ProductProcessed()
+: id(0), workpiece(0), game_time(0.), delivery_gate(0), confirmed(false), scored(false), order(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a product-processed fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+ProductProcessed::ProductProcessed(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], id);
+	clips_replica::convert_slot(v[1], SLOTS[1], workpiece);
+	clips_replica::convert_slot(v[2], SLOTS[2], game_time);
+	clips_replica::convert_slot(v[3], SLOTS[3], team);
+	clips_replica::convert_slot(v[4], SLOTS[4], mtype);
+	clips_replica::convert_slot(v[5], SLOTS[5], at_machine);
+	clips_replica::convert_slot(v[6], SLOTS[6], delivery_gate);
+	clips_replica::convert_slot(v[7], SLOTS[7], confirmed);
+	clips_replica::convert_slot(v[8], SLOTS[8], base_color);
+	clips_replica::convert_slot(v[9], SLOTS[9], ring_color);
+	clips_replica::convert_slot(v[10], SLOTS[10], cap_color);
+	clips_replica::convert_slot(v[11], SLOTS[11], scored);
+	clips_replica::convert_slot(v[12], SLOTS[12], order);
+}
+
+/** @class Gamestate <rcll_facts/facts.h>
+ * Fact of deftemplate gamestate, generated from facts.clp.
+ */
+
+const char *const Gamestate::TEMPLATE = "gamestate";
+const char *const Gamestate::SLOTS[Gamestate::NUM_SLOTS] = {
+  "refbox-mode",
+  "state",
+  "prev-state",
+  "phase",
+  "prev-phase",
+  "game-time",
+  "cont-time",
+  "start-time",
+  "end-time",
+  "last-time",
+  "points",
+  "teams",
+  "over-time"};
+
+/** Constructor. */
+Gamestate::Gamestate()
+: game_time(0.), cont_time(0.), over_time(false)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a gamestate fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+Gamestate::Gamestate(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], refbox_mode);
+	clips_replica::convert_slot(v[1], SLOTS[1], state);
+	clips_replica::convert_slot(v[2], SLOTS[2], prev_state);
+	clips_replica::convert_slot(v[3], SLOTS[3], phase);
+	clips_replica::convert_slot(v[4], SLOTS[4], prev_phase);
+	clips_replica::convert_slot(v[5], SLOTS[5], game_time);
+	clips_replica::convert_slot(v[6], SLOTS[6], cont_time);
+	clips_replica::convert_slot(v[7], SLOTS[7], start_time);
+	clips_replica::convert_slot(v[8], SLOTS[8], end_time);
+	clips_replica::convert_slot(v[9], SLOTS[9], last_time);
+	clips_replica::convert_slot(v[10], SLOTS[10], points);
+	clips_replica::convert_slot(v[11], SLOTS[11], teams);
+	clips_replica::convert_slot(v[12], SLOTS[12], over_time);
+}
+
+/** @class ExplorationReport <rcll_facts/facts.h>
+ * Fact of deftemplate exploration-report, generated from facts.clp.
+ */
+
+const char *const ExplorationReport::TEMPLATE = "exploration-report";
+const char *const ExplorationReport::SLOTS[ExplorationReport::NUM_SLOTS] = {
+  "rtype",
+  "name",
+  "team",
+  "zone",
+  "rotation",
+  "host",
+  "port",
+  "game-time",
+  "correctly-reported",
+  "zone-state",
+  "rotation-state"};
+
+/** Constructor. */
+ExplorationReport::ExplorationReport()
+: rotation(0), port(0), game_time(0.)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a exploration-report fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+ExplorationReport::ExplorationReport(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], rtype);
+	clips_replica::convert_slot(v[1], SLOTS[1], name);
+	clips_replica::convert_slot(v[2], SLOTS[2], team);
+	clips_replica::convert_slot(v[3], SLOTS[3], zone);
+	clips_replica::convert_slot(v[4], SLOTS[4], rotation);
+	clips_replica::convert_slot(v[5], SLOTS[5], host);
+	clips_replica::convert_slot(v[6], SLOTS[6], port);
+	clips_replica::convert_slot(v[7], SLOTS[7], game_time);
+	clips_replica::convert_slot(v[8], SLOTS[8], correctly_reported);
+	clips_replica::convert_slot(v[9], SLOTS[9], zone_state);
+	clips_replica::convert_slot(v[10], SLOTS[10], rotation_state);
+}
+
+/** @class Points <rcll_facts/facts.h>
+ * Fact of deftemplate points, generated from facts.clp.
+ */
+
+const char *const Points::TEMPLATE = "points";
+const char *const Points::SLOTS[Points::NUM_SLOTS] = {
+  "points",
+  "team",
+  "game-time",
+  "phase",
+  "reason",
+  "product-step"};
+
+/** Constructor. */
+Points::Points()
+: points(0), game_time(0.), product_step(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a points fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+Points::Points(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], points);
+	clips_replica::convert_slot(v[1], SLOTS[1], team);
+	clips_replica::convert_slot(v[2], SLOTS[2], game_time);
+	clips_replica::convert_slot(v[3], SLOTS[3], phase);
+	clips_replica::convert_slot(v[4], SLOTS[4], reason);
+	clips_replica::convert_slot(v[5], SLOTS[5], product_step);
+}
+
+/** @class PointsRegistered <rcll_facts/facts.h>
+ * Fact of deftemplate points-registered, generated from facts.clp.
+ */
+
+const char *const PointsRegistered::TEMPLATE = "points-registered";
+const char *const PointsRegistered::SLOTS[PointsRegistered::NUM_SLOTS] = {
+  "points",
+  "team",
+  "game-time",
+  "phase",
+  "reason",
+  "product-step"};
+
+/** Constructor. */
+PointsRegistered::PointsRegistered()
+: points(0), game_time(0.), product_step(0)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a points-registered fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+PointsRegistered::PointsRegistered(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], points);
+	clips_replica::convert_slot(v[1], SLOTS[1], team);
+	clips_replica::convert_slot(v[2], SLOTS[2], game_time);
+	clips_replica::convert_slot(v[3], SLOTS[3], phase);
+	clips_replica::convert_slot(v[4], SLOTS[4], reason);
+	clips_replica::convert_slot(v[5], SLOTS[5], product_step);
+}
+
+/** @class ZoneSwap <rcll_facts/facts.h>
+ * Fact of deftemplate zone-swap, generated from facts.clp.
+ */
+
+const char *const ZoneSwap::TEMPLATE = "zone-swap";
+const char *const ZoneSwap::SLOTS[ZoneSwap::NUM_SLOTS] = {
+  "m1-name",
+  "m1-new-zone",
+  "m2-name",
+  "m2-new-zone"};
+
+/** Constructor. */
+ZoneSwap::ZoneSwap()
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a zone-swap fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+ZoneSwap::ZoneSwap(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], m1_name);
+	clips_replica::convert_slot(v[1], SLOTS[1], m1_new_zone);
+	clips_replica::convert_slot(v[2], SLOTS[2], m2_name);
+	clips_replica::convert_slot(v[3], SLOTS[3], m2_new_zone);
+}
+
+/** @class SimTime <rcll_facts/facts.h>
+ * Fact of deftemplate sim-time, generated from facts.clp.
+ */
+
+const char *const SimTime::TEMPLATE = "sim-time";
+const char *const SimTime::SLOTS[SimTime::NUM_SLOTS] = {
+  "enabled",
+  "speedup",
+  "estimate",
+  "now",
+  "last-recv-time",
+  "real-time-factor"};
+
+/** Constructor. */
+SimTime::SimTime()
+: speedup(0.), real_time_factor(0.)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a sim-time fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+SimTime::SimTime(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], enabled);
+	clips_replica::convert_slot(v[1], SLOTS[1], speedup);
+	clips_replica::convert_slot(v[2], SLOTS[2], estimate);
+	clips_replica::convert_slot(v[3], SLOTS[3], now);
+	clips_replica::convert_slot(v[4], SLOTS[4], last_recv_time);
+	clips_replica::convert_slot(v[5], SLOTS[5], real_time_factor);
+}
+
+/** @class GameParameters <rcll_facts/facts.h>
+ * Fact of deftemplate game-parameters, generated from facts.clp.
+ */
+
+const char *const GameParameters::TEMPLATE = "game-parameters";
+const char *const GameParameters::SLOTS[GameParameters::NUM_SLOTS] = {
+  "is-parameterized",
+  "is-initialized",
+  "machine-positions",
+  "machine-setup",
+  "orders",
+  "gamestate",
+  "storage-status"};
+
+/** Constructor. */
+GameParameters::GameParameters()
+: is_parameterized(false), is_initialized(false)
+{
+}
+
+/** Constructor from a fact.
+ * @param fact snapshot of a game-parameters fact
+ * @exception Exception thrown if the fact is of another template, the slots
+ * do not match the deftemplate the struct was generated from, or a value
+ * cannot be converted
+ */
+GameParameters::GameParameters(const clips_replica::FactSnapshot &fact)
+{
+	const std::vector<CLIPS::Values> &v = slot_values(fact, TEMPLATE, SLOTS, NUM_SLOTS);
+	clips_replica::convert_slot(v[0], SLOTS[0], is_parameterized);
+	clips_replica::convert_slot(v[1], SLOTS[1], is_initialized);
+	clips_replica::convert_slot(v[2], SLOTS[2], machine_positions);
+	clips_replica::convert_slot(v[3], SLOTS[3], machine_setup);
+	clips_replica::convert_slot(v[4], SLOTS[4], orders);
+	clips_replica::convert_slot(v[5], SLOTS[5], gamestate);
+	clips_replica::convert_slot(v[6], SLOTS[6], storage_status);
+}
+
+} // end namespace rcll_facts
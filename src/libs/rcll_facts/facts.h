@@ -0,0 +1,573 @@
+/****************************************************************************
+ *  facts.h - structs for CLIPS deftemplates
+ *  (auto-generated by clips-factgen, do not modify directly)
+ *
+ *  Generated from: facts.clp
+ ****************************************************************************/
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+#ifndef __RCLL_FACTS_FACTS_H_
+#define __RCLL_FACTS_FACTS_H_
+
+#include <clips_replica/fact_changes.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rcll_facts {
+
+/** Fact of deftemplate machine. */
+struct Machine
+{
+	Machine();
+	explicit Machine(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 39;   ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string              name;                   ///< slot name
+	std::string              team;                   ///< slot team
+	std::string              mtype;                  ///< slot mtype
+	std::vector<std::string> actual_lights;          ///< slot actual-lights
+	std::vector<std::string> desired_lights;         ///< slot desired-lights
+	int64_t                  productions;            ///< slot productions
+	std::string              state;                  ///< slot state
+	std::string              prev_state;             ///< slot prev-state
+	std::string              task;                   ///< slot task
+	std::string              mps_busy;               ///< slot mps-busy
+	std::string              mps_ready;              ///< slot mps-ready
+	bool                     mps_connected;          ///< slot mps-connected
+	int64_t                  proc_time;              ///< slot proc-time
+	double                   proc_start;             ///< slot proc-start
+	std::vector<double>      down_period;            ///< slot down-period
+	double                   broken_since;           ///< slot broken-since
+	std::string              broken_reason;          ///< slot broken-reason
+	std::vector<double>      pose;                   ///< slot pose
+	std::vector<int64_t>     pose_time;              ///< slot pose-time
+	std::string              zone;                   ///< slot zone
+	int64_t                  rotation;               ///< slot rotation
+	double                   prep_blink_start;       ///< slot prep-blink-start
+	double                   idle_since;             ///< slot idle-since
+	double                   wait_for_product_since; ///< slot wait-for-product-since
+	int64_t                  mps_base_counter;       ///< slot mps-base-counter
+	int64_t                  bases_added;            ///< slot bases-added
+	int64_t                  bases_used;             ///< slot bases-used
+	std::string              bs_side;                ///< slot bs-side
+	std::string              bs_color;               ///< slot bs-color
+	int64_t                  ds_gate;                ///< slot ds-gate
+	int64_t                  ds_last_gate;           ///< slot ds-last-gate
+	int64_t                  ds_order;               ///< slot ds-order
+	std::string              ss_operation;           ///< slot ss-operation
+	std::vector<int64_t>     ss_shelf_slot;          ///< slot ss-shelf-slot
+	std::string              ss_wp_description;      ///< slot ss-wp-description
+	std::string              rs_ring_color;          ///< slot rs-ring-color
+	std::vector<std::string> rs_ring_colors;         ///< slot rs-ring-colors
+	std::string              cs_operation;           ///< slot cs-operation
+	bool                     cs_retrieved;           ///< slot cs-retrieved
+};
+
+/** Fact of deftemplate machine-mps-state. */
+struct MachineMpsState
+{
+	MachineMpsState();
+	explicit MachineMpsState(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 3;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string name;      ///< slot name
+	std::string state;     ///< slot state
+	int64_t     num_bases; ///< slot num-bases
+};
+
+/** Fact of deftemplate mps-status-feedback. */
+struct MpsStatusFeedback
+{
+	MpsStatusFeedback();
+	explicit MpsStatusFeedback(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 3;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string   machine; ///< slot machine
+	std::string   type;    ///< slot type
+	CLIPS::Values value;   ///< slot value
+};
+
+/** Fact of deftemplate machine-ss-shelf-slot. */
+struct MachineSsShelfSlot
+{
+	MachineSsShelfSlot();
+	explicit MachineSsShelfSlot(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 8;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string          name;          ///< slot name
+	std::vector<int64_t> position;      ///< slot position
+	bool                 is_filled;     ///< slot is-filled
+	bool                 is_accessible; ///< slot is-accessible
+	std::vector<int64_t> move_to;       ///< slot move-to
+	int64_t              num_payments;  ///< slot num-payments
+	std::string          description;   ///< slot description
+	double               last_payed;    ///< slot last-payed
+};
+
+/** Fact of deftemplate machine-light-code. */
+struct MachineLightCode
+{
+	MachineLightCode();
+	explicit MachineLightCode(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 2;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	int64_t                  id;   ///< slot id
+	std::vector<std::string> code; ///< slot code
+};
+
+/** Fact of deftemplate machine-generation. */
+struct MachineGeneration
+{
+	MachineGeneration();
+	explicit MachineGeneration(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 2;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string state;                         ///< slot state
+	double      generation_state_last_checked; ///< slot generation-state-last-checked
+};
+
+/** Fact of deftemplate mirror-orientation. */
+struct MirrorOrientation
+{
+	MirrorOrientation();
+	explicit MirrorOrientation(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 2;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	int64_t cyan;    ///< slot cyan
+	int64_t magenta; ///< slot magenta
+};
+
+/** Fact of deftemplate robot. */
+struct Robot
+{
+	Robot();
+	explicit Robot(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 17;   ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	int64_t              number;                   ///< slot number
+	std::string          state;                    ///< slot state
+	std::string          team;                     ///< slot team
+	std::string          team_color;               ///< slot team-color
+	std::string          name;                     ///< slot name
+	std::string          host;                     ///< slot host
+	int64_t              port;                     ///< slot port
+	std::vector<int64_t> last_seen;                ///< slot last-seen
+	bool                 warning_sent;             ///< slot warning-sent
+	bool                 has_pose;                 ///< slot has-pose
+	std::vector<double>  pose;                     ///< slot pose
+	std::vector<int64_t> pose_time;                ///< slot pose-time
+	std::vector<double>  vision_pose;              ///< slot vision-pose
+	std::vector<int64_t> vision_pose_time;         ///< slot vision-pose-time
+	double               maintenance_start_time;   ///< slot maintenance-start-time
+	int64_t              maintenance_cycles;       ///< slot maintenance-cycles
+	bool                 maintenance_warning_sent; ///< slot maintenance-warning-sent
+};
+
+/** Fact of deftemplate robot-beacon. */
+struct RobotBeacon
+{
+	RobotBeacon();
+	explicit RobotBeacon(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 12;   ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::vector<int64_t> rcvd_at;    ///< slot rcvd-at
+	int64_t              seq;        ///< slot seq
+	std::vector<int64_t> time;       ///< slot time
+	int64_t              number;     ///< slot number
+	std::string          team_name;  ///< slot team-name
+	std::string          team_color; ///< slot team-color
+	std::string          peer_name;  ///< slot peer-name
+	std::string          host;       ///< slot host
+	int64_t              port;       ///< slot port
+	bool                 has_pose;   ///< slot has-pose
+	std::vector<double>  pose;       ///< slot pose
+	std::vector<int64_t> pose_time;  ///< slot pose-time
+};
+
+/** Fact of deftemplate signal. */
+struct Signal
+{
+	Signal();
+	explicit Signal(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 4;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	CLIPS::Values        type;  ///< slot type
+	std::vector<int64_t> time;  ///< slot time
+	int64_t              seq;   ///< slot seq
+	int64_t              count; ///< slot count
+};
+
+/** Fact of deftemplate network-client. */
+struct NetworkClient
+{
+	NetworkClient();
+	explicit NetworkClient(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 4;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	int64_t     id;       ///< slot id
+	std::string host;     ///< slot host
+	int64_t     port;     ///< slot port
+	bool        is_slave; ///< slot is-slave
+};
+
+/** Fact of deftemplate network-peer. */
+struct NetworkPeer
+{
+	NetworkPeer();
+	explicit NetworkPeer(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 3;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string group;          ///< slot group
+	int64_t     id;             ///< slot id
+	std::string network_prefix; ///< slot network-prefix
+};
+
+/** Fact of deftemplate attention-message. */
+struct AttentionMessage
+{
+	AttentionMessage();
+	explicit AttentionMessage(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 3;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string team; ///< slot team
+	std::string text; ///< slot text
+	int64_t     time; ///< slot time
+};
+
+/** Fact of deftemplate send-mps-positions. */
+struct SendMpsPositions
+{
+	SendMpsPositions();
+	explicit SendMpsPositions(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 1;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::vector<std::string> phases; ///< slot phases
+};
+
+/** Fact of deftemplate order. */
+struct Order
+{
+	Order();
+	explicit Order(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 16;   ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	int64_t                  id;                 ///< slot id
+	std::string              complexity;         ///< slot complexity
+	bool                     competitive;        ///< slot competitive
+	std::string              base_color;         ///< slot base-color
+	std::vector<std::string> ring_colors;        ///< slot ring-colors
+	std::string              cap_color;          ///< slot cap-color
+	int64_t                  quantity_requested; ///< slot quantity-requested
+	std::vector<int64_t>     quantity_delivered; ///< slot quantity-delivered
+	std::vector<int64_t>     start_range;        ///< slot start-range
+	std::vector<int64_t>     duration_range;     ///< slot duration-range
+	std::vector<int64_t>     delivery_period;    ///< slot delivery-period
+	int64_t                  delivery_gate;      ///< slot delivery-gate
+	bool                     active;             ///< slot active
+	int64_t                  activate_at;        ///< slot activate-at
+	std::vector<int64_t>     activation_range;   ///< slot activation-range
+	bool                     allow_overtime;     ///< slot allow-overtime
+};
+
+/** Fact of deftemplate workpiece-tracking. */
+struct WorkpieceTracking
+{
+	WorkpieceTracking();
+	explicit WorkpieceTracking(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 4;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	bool        enabled;   ///< slot enabled
+	bool        fail_safe; ///< slot fail-safe
+	std::string reason;    ///< slot reason
+	bool        broadcast; ///< slot broadcast
+};
+
+/** Fact of deftemplate workpiece. */
+struct Workpiece
+{
+	Workpiece();
+	explicit Workpiece(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 9;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	int64_t                  id;          ///< slot id
+	int64_t                  order;       ///< slot order
+	std::string              at_machine;  ///< slot at-machine
+	std::string              state;       ///< slot state
+	std::string              base_color;  ///< slot base-color
+	std::vector<std::string> ring_colors; ///< slot ring-colors
+	std::string              cap_color;   ///< slot cap-color
+	std::string              team;        ///< slot team
+	double                   visible;     ///< slot visible
+};
+
+/** Fact of deftemplate ring-spec. */
+struct RingSpec
+{
+	RingSpec();
+	explicit RingSpec(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 2;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string color;     ///< slot color
+	int64_t     req_bases; ///< slot req-bases
+};
+
+/** Fact of deftemplate delivery-period. */
+struct DeliveryPeriod
+{
+	DeliveryPeriod();
+	explicit DeliveryPeriod(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 2;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::vector<std::string> delivery_gates; ///< slot delivery-gates
+	std::vector<int64_t>     period;         ///< slot period
+};
+
+/** Fact of deftemplate referee-confirmation. */
+struct RefereeConfirmation
+{
+	RefereeConfirmation();
+	explicit RefereeConfirmation(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 2;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	int64_t     process_id; ///< slot process-id
+	std::string state;      ///< slot state
+};
+
+/** Fact of deftemplate product-processed. */
+struct ProductProcessed
+{
+	ProductProcessed();
+	explicit ProductProcessed(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 13;   ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	int64_t     id;            ///< slot id
+	int64_t     workpiece;     ///< slot workpiece
+	double      game_time;     ///< slot game-time
+	std::string team;          ///< slot team
+	std::string mtype;         ///< slot mtype
+	std::string at_machine;    ///< slot at-machine
+	int64_t     delivery_gate; ///< slot delivery-gate
+	bool        confirmed;     ///< slot confirmed
+	std::string base_color;    ///< slot base-color
+	std::string ring_color;    ///< slot ring-color
+	std::string cap_color;     ///< slot cap-color
+	bool        scored;        ///< slot scored
+	int64_t     order;         ///< slot order
+};
+
+/** Fact of deftemplate gamestate. */
+struct Gamestate
+{
+	Gamestate();
+	explicit Gamestate(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 13;   ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string              refbox_mode; ///< slot refbox-mode
+	std::string              state;       ///< slot state
+	std::string              prev_state;  ///< slot prev-state
+	std::string              phase;       ///< slot phase
+	std::string              prev_phase;  ///< slot prev-phase
+	double                   game_time;   ///< slot game-time
+	double                   cont_time;   ///< slot cont-time
+	std::vector<int64_t>     start_time;  ///< slot start-time
+	std::vector<int64_t>     end_time;    ///< slot end-time
+	std::vector<int64_t>     last_time;   ///< slot last-time
+	std::vector<int64_t>     points;      ///< slot points
+	std::vector<std::string> teams;       ///< slot teams
+	bool                     over_time;   ///< slot over-time
+};
+
+/** Fact of deftemplate exploration-report. */
+struct ExplorationReport
+{
+	ExplorationReport();
+	explicit ExplorationReport(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 11;   ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string rtype;              ///< slot rtype
+	std::string name;               ///< slot name
+	std::string team;               ///< slot team
+	std::string zone;               ///< slot zone
+	int64_t     rotation;           ///< slot rotation
+	std::string host;               ///< slot host
+	int64_t     port;               ///< slot port
+	double      game_time;          ///< slot game-time
+	std::string correctly_reported; ///< slot correctly-reported
+	std::string zone_state;         ///< slot zone-state
+	std::string rotation_state;     ///< slot rotation-state
+};
+
+/** Fact of deftemplate points. */
+struct Points
+{
+	Points();
+	explicit Points(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 6;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	int64_t     points;       ///< slot points
+	std::string team;         ///< slot team
+	double      game_time;    ///< slot game-time
+	std::string phase;        ///< slot phase
+	std::string reason;       ///< slot reason
+	int64_t     product_step; ///< slot product-step
+};
+
+/** Fact of deftemplate points-registered. */
+struct PointsRegistered
+{
+	PointsRegistered();
+	explicit PointsRegistered(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 6;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	int64_t     points;       ///< slot points
+	std::string team;         ///< slot team
+	double      game_time;    ///< slot game-time
+	std::string phase;        ///< slot phase
+	std::string reason;       ///< slot reason
+	int64_t     product_step; ///< slot product-step
+};
+
+/** Fact of deftemplate zone-swap. */
+struct ZoneSwap
+{
+	ZoneSwap();
+	explicit ZoneSwap(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 4;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string m1_name;     ///< slot m1-name
+	std::string m1_new_zone; ///< slot m1-new-zone
+	std::string m2_name;     ///< slot m2-name
+	std::string m2_new_zone; ///< slot m2-new-zone
+};
+
+/** Fact of deftemplate sim-time. */
+struct SimTime
+{
+	SimTime();
+	explicit SimTime(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 6;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	std::string          enabled;          ///< slot enabled
+	double               speedup;          ///< slot speedup
+	std::string          estimate;         ///< slot estimate
+	std::vector<int64_t> now;              ///< slot now
+	std::vector<int64_t> last_recv_time;   ///< slot last-recv-time
+	double               real_time_factor; ///< slot real-time-factor
+};
+
+/** Fact of deftemplate game-parameters. */
+struct GameParameters
+{
+	GameParameters();
+	explicit GameParameters(const clips_replica::FactSnapshot &fact);
+
+	static const char *const  TEMPLATE;         ///< name of the deftemplate
+	static const unsigned int NUM_SLOTS = 7;    ///< number of slots
+	static const char *const  SLOTS[NUM_SLOTS]; ///< names of the slots in deftemplate order
+
+	bool        is_parameterized;  ///< slot is-parameterized
+	bool        is_initialized;    ///< slot is-initialized
+	std::string machine_positions; ///< slot machine-positions
+	std::string machine_setup;     ///< slot machine-setup
+	std::string orders;            ///< slot orders
+	std::string gamestate;         ///< slot gamestate
+	std::string storage_status;    ///< slot storage-status
+};
+
+} // end namespace rcll_facts
+
+#endif
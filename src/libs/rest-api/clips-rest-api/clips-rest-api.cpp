@@ -22,9 +22,13 @@
 
 #include "clips-rest-api.h"
 
-#include <clips/clips.h>
-#include <core/threading/mutex_locker.h>
+#include "fact_stream_reply.h"
 
+#include <rcll_facts/facts.h>
+#include <utils/misc/string_split.h>
+
+#include <limits>
+#include <stdexcept>
 #include <type_traits>
 using namespace fawkes;
 
@@ -34,23 +38,28 @@ using namespace fawkes;
  */
 
 namespace llsfrb {
-/** Constructor. */
-ClipsRestApi::ClipsRestApi(CLIPS::Environment *env, fawkes::Mutex &env_mutex, Logger *logger)
-: WebviewRestApi("clips", logger), env_(env), env_mutex_(env_mutex), logger_(logger)
+/** Constructor.
+ * The API serves the facts from a replica of the environment, requests
+ * never lock the environment and thus do not delay the game rules.
+ * @param replica replica of the facts of the game environment
+ * @param logger logger
+ */
+ClipsRestApi::ClipsRestApi(clips_replica::FactReplica *replica, Logger *logger)
+: WebviewRestApi("clips", logger), replica_(replica), logger_(logger)
 {
 	add_handler<WebviewRestArray<Environment>>(WebRequest::METHOD_GET,
 	                                           "/",
 	                                           std::bind(&ClipsRestApi::cb_list_environments, this));
-	add_handler<WebviewRestArray<Fact>>(WebRequest::METHOD_GET,
-	                                    "/facts",
-	                                    std::bind(&ClipsRestApi::cb_get_facts,
-	                                              this,
-	                                              std::placeholders::_1));
-	add_handler<WebviewRestArray<Fact>>(WebRequest::METHOD_GET,
-	                                    "/facts/{tmpl-name}",
-	                                    std::bind(&ClipsRestApi::cb_get_facts_by_tmpl_and_slots,
-	                                              this,
-	                                              std::placeholders::_1));
+	add_handler(WebRequest::METHOD_GET,
+	            "/facts",
+	            std::function<std::unique_ptr<WebReply>(WebviewRestParams &)>(
+	              std::bind(&ClipsRestApi::cb_get_facts, this, std::placeholders::_1)));
+	add_handler(WebRequest::METHOD_GET,
+	            "/facts/{tmpl-name}",
+	            std::function<std::unique_ptr<WebReply>(WebviewRestParams &)>(
+	              std::bind(&ClipsRestApi::cb_get_facts_by_tmpl_and_slots,
+	                        this,
+	                        std::placeholders::_1)));
 
 	add_handler<WebviewRestArray<Machine>>(WebRequest::METHOD_GET,
 	                                       "/machines",
@@ -89,56 +98,18 @@ ClipsRestApi::~ClipsRestApi()
 {
 }
 
-/** Get a value from a fact.
- * @param fact pointer to CLIPS fact
- * @param slot_name name of field to retrieve
- * @return template-specific return value
- */
-template <typename T>
-T
-get_value(const CLIPS::Fact::pointer &fact, const std::string &slot_name)
-{
-	CLIPS::Values v = fact->slot_value(slot_name);
-	if (v.empty()) {
-		throw Exception("No value for slot '%s'", slot_name.c_str());
-	}
-	if (v[0].type() == CLIPS::TYPE_SYMBOL && v[0].as_string() == "nil") {
-		return T();
-	}
-	return v[0];
-}
-
-/** Specialization for bool.
- * @param fact pointer to CLIPS fact
- * @param slot_name name of field to retrieve
- * @return boolean value
- */
-template <>
-bool
-get_value(const CLIPS::Fact::pointer &fact, const std::string &slot_name)
-{
-	CLIPS::Values v = fact->slot_value(slot_name);
-	if (v.empty()) {
-		throw Exception("No value for slot '%s'", slot_name.c_str());
-	}
-	if (v[0].type() != CLIPS::TYPE_SYMBOL) {
-		throw Exception("Value for slot '%s' is not a boolean", slot_name.c_str());
-	}
-	return (v[0].as_string() == "TRUE");
-}
-
 /** Get value array.
  * This is not a template because the overly verbose operator API
  * of CLIPS::Value can lead to ambiguous overloads, e.g., resolving
  * std::string to std::string or const char * operators.
- * @param fact pointer to CLIPS fact
+ * @param fact snapshot of CLIPS fact
  * @param slot_name name of field to retrieve
  * @return vector of strings from multislot
  */
 static std::vector<std::string>
-get_values(const CLIPS::Fact::pointer &fact, const std::string &slot_name)
+get_values(const clips_replica::FactSnapshot &fact, const std::string &slot_name)
 {
-	CLIPS::Values            v = fact->slot_value(slot_name);
+	const CLIPS::Values &    v = fact.slot_value(slot_name);
 	std::vector<std::string> rv(v.size());
 	for (size_t i = 0; i < v.size(); ++i) {
 		switch (v[i].type()) {
@@ -153,179 +124,151 @@ get_values(const CLIPS::Fact::pointer &fact, const std::string &slot_name)
 	return rv;
 }
 
-Fact
-ClipsRestApi::gen_fact(CLIPS::Fact::pointer &fact, bool formatted)
+/// @cond INTERNALS
+template <typename T>
+static std::vector<std::string>
+to_strings(const std::vector<T> &values)
 {
-	Fact retf;
-	retf.set_kind("Fact");
-	retf.set_apiVersion(Fact::api_version());
-	retf.set_index(fact->index());
-	CLIPS::Template::pointer fact_template = fact->get_template();
-	if (fact_template) {
-		retf.set_template_name(fact_template->name());
-	} else {
-		retf.set_template_name("implied");
+	std::vector<std::string> rv;
+	rv.reserve(values.size());
+	for (const T &v : values) {
+		rv.push_back(std::to_string(v));
 	}
-
-	if (formatted) {
-		char tmp[16384];
-		tmp[16383] = 0;
-		OpenStringDestination(env_->cobj(), (char *)"ProcPPForm", tmp, 16383);
-		PrintFact(env_->cobj(), (char *)"ProcPPForm", (struct fact *)fact->cobj(), FALSE, FALSE);
-		CloseStringDestination(env_->cobj(), (char *)"ProcPPForm");
-		retf.set_formatted(tmp);
-	} else {
-		std::vector<std::string> slots = fact->slot_names();
-		for (const auto &s : slots) {
-			CLIPS::Values fval = fact->slot_value(s);
-			SlotValue     sval;
-			sval.set_name(s);
-			sval.set_is_multifield(fact_template ? fact_template->is_multifield_slot(s)
-			                                     : (fval.size() > 1));
-			for (const auto &v : fval) {
-				switch (v.type()) {
-				case CLIPS::TYPE_FLOAT: sval.addto_values(std::to_string(v.as_float())); break;
-				case CLIPS::TYPE_INTEGER: sval.addto_values(std::to_string(v.as_integer())); break;
-				case CLIPS::TYPE_SYMBOL:
-				case CLIPS::TYPE_STRING:
-				case CLIPS::TYPE_INSTANCE_NAME: sval.addto_values(v.as_string()); break;
-				default: sval.addto_values("ADDR"); break;
-				}
-			}
-			retf.addto_slots(std::move(sval));
-		}
-	}
-
-	return retf;
+	return rv;
 }
+/// @endcond
 
 Machine
-ClipsRestApi::gen_machine(CLIPS::Fact::pointer &fact)
+ClipsRestApi::gen_machine(const clips_replica::FactSnapshot &fact)
 {
-	Machine m;
-	m.set_name(get_value<std::string>(fact, "name"));
-	m.set_team(get_value<std::string>(fact, "team"));
-	m.set_mtype(get_value<std::string>(fact, "mtype"));
-	m.set_actual_lights(get_values(fact, "actual-lights"));
-	m.set_state(get_value<std::string>(fact, "state"));
-	m.set_zone(get_value<std::string>(fact, "zone"));
-	m.set_rotation(get_value<int64_t>(fact, "rotation"));
-	m.set_bases_added(get_value<int64_t>(fact, "bases-added"));
-	m.set_bases_used(get_value<int64_t>(fact, "bases-used"));
-	m.set_bs_side(get_value<std::string>(fact, "bs-side"));
-	m.set_bs_color(get_value<std::string>(fact, "bs-color"));
-	m.set_ds_order(get_value<int64_t>(fact, "ds-order"));
-	m.set_rs_ring_color(get_value<std::string>(fact, "rs-ring-color"));
-	m.set_rs_ring_colors(get_values(fact, "rs-ring-colors"));
-	m.set_cs_operation(get_value<std::string>(fact, "cs-operation"));
-	m.set_cs_retrieved(get_value<bool>(fact, "cs-retrieved"));
+	rcll_facts::Machine f(fact);
+	Machine             m;
+	m.set_name(f.name);
+	m.set_team(f.team);
+	m.set_mtype(f.mtype);
+	m.set_actual_lights(f.actual_lights);
+	m.set_state(f.state);
+	m.set_zone(f.zone);
+	m.set_rotation(f.rotation);
+	m.set_bases_added(f.bases_added);
+	m.set_bases_used(f.bases_used);
+	m.set_bs_side(f.bs_side);
+	m.set_bs_color(f.bs_color);
+	m.set_ds_order(f.ds_order);
+	m.set_rs_ring_color(f.rs_ring_color);
+	m.set_rs_ring_colors(f.rs_ring_colors);
+	m.set_cs_operation(f.cs_operation);
+	m.set_cs_retrieved(f.cs_retrieved);
 	return m;
 }
 
 Order
-ClipsRestApi::gen_order(CLIPS::Fact::pointer &fact)
+ClipsRestApi::gen_order(const clips_replica::FactSnapshot &fact)
 {
-	Order o;
+	rcll_facts::Order f(fact);
+	Order             o;
 	o.set_kind("Order");
 	o.set_apiVersion(Environment::api_version());
-	o.set_id(get_value<int64_t>(fact, "id"));
-	o.set_complexity(get_value<std::string>(fact, "complexity"));
-	o.set_competitive(get_value<bool>(fact, "competitive"));
-	o.set_base_color(get_value<std::string>(fact, "base-color"));
-	o.set_cap_color(get_value<std::string>(fact, "cap-color"));
-	o.set_ring_colors(get_values(fact, "ring-colors"));
-	o.set_quantity_requested(get_value<int64_t>(fact, "quantity-requested"));
-	o.set_quantity_delivered(get_values(fact, "quantity-delivered"));
-	o.set_delivery_period(get_values(fact, "delivery-period"));
-	o.set_delivery_gate(get_value<int64_t>(fact, "delivery-gate"));
-	o.set_active(get_value<bool>(fact, "active"));
+	o.set_id(f.id);
+	o.set_complexity(f.complexity);
+	o.set_competitive(f.competitive);
+	o.set_base_color(f.base_color);
+	o.set_cap_color(f.cap_color);
+	o.set_ring_colors(f.ring_colors);
+	o.set_quantity_requested(f.quantity_requested);
+	o.set_quantity_delivered(to_strings(f.quantity_delivered));
+	o.set_delivery_period(to_strings(f.delivery_period));
+	o.set_delivery_gate(f.delivery_gate);
+	o.set_active(f.active);
 	return o;
 }
 
 Robot
-ClipsRestApi::gen_robot(CLIPS::Fact::pointer &fact)
+ClipsRestApi::gen_robot(const clips_replica::FactSnapshot &fact)
 {
-	Robot o;
+	rcll_facts::Robot f(fact);
+	Robot             o;
 	o.set_kind("Robot");
 	o.set_apiVersion(Environment::api_version());
-	o.set_number(get_value<int64_t>(fact, "number"));
-	o.set_state(get_value<std::string>(fact, "state"));
-	o.set_team(get_value<std::string>(fact, "team"));
-	o.set_team_color(get_value<std::string>(fact, "team-color"));
-	o.set_name(get_value<std::string>(fact, "name"));
-	o.set_host(get_value<std::string>(fact, "host"));
-	o.set_port(get_value<int64_t>(fact, "port"));
-	o.set_last_seen(get_values(fact, "last-seen"));
-	o.set_has_pose(get_value<bool>(fact, "has-pose"));
-	o.set_pose(get_values(fact, "pose"));
-	o.set_maintenance_start_time(get_value<int64_t>(fact, "maintenance-start-time"));
-	o.set_maintenance_cycles(get_value<int64_t>(fact, "maintenance-cycles"));
-	o.set_maintenance_warning_sent(get_value<bool>(fact, "maintenance-warning-sent"));
+	o.set_number(f.number);
+	o.set_state(f.state);
+	o.set_team(f.team);
+	o.set_team_color(f.team_color);
+	o.set_name(f.name);
+	o.set_host(f.host);
+	o.set_port(f.port);
+	o.set_last_seen(to_strings(f.last_seen));
+	o.set_has_pose(f.has_pose);
+	o.set_pose(to_strings(f.pose));
+	o.set_maintenance_start_time(static_cast<int64_t>(f.maintenance_start_time));
+	o.set_maintenance_cycles(f.maintenance_cycles);
+	o.set_maintenance_warning_sent(f.maintenance_warning_sent);
 	return o;
 }
 
 GameState
-ClipsRestApi::gen_game_state(CLIPS::Fact::pointer &fact)
+ClipsRestApi::gen_game_state(const clips_replica::FactSnapshot &fact)
 {
-	GameState o;
+	rcll_facts::Gamestate f(fact);
+	GameState             o;
 	o.set_kind("GameState");
 	o.set_apiVersion(Environment::api_version());
-	o.set_state(get_value<std::string>(fact, "state"));
-	o.set_phase(get_value<std::string>(fact, "phase"));
-	o.set_game_time(get_value<float>(fact, "game-time"));
-	o.set_points(get_values(fact, "points"));
-	o.set_teams(get_values(fact, "teams"));
-	o.set_over_time(get_value<bool>(fact, "over-time"));
+	o.set_state(f.state);
+	o.set_phase(f.phase);
+	o.set_game_time(f.game_time);
+	o.set_points(to_strings(f.points));
+	o.set_teams(f.teams);
+	o.set_over_time(f.over_time);
 	return o;
 }
 
 RingSpec
-ClipsRestApi::gen_ring_spec(CLIPS::Fact::pointer &fact)
+ClipsRestApi::gen_ring_spec(const clips_replica::FactSnapshot &fact)
 {
-	RingSpec o;
+	rcll_facts::RingSpec f(fact);
+	RingSpec             o;
 	o.set_kind("RingSpec");
 	o.set_apiVersion(Environment::api_version());
-	o.set_color(get_value<std::string>(fact, "color"));
-	o.set_req_bases(get_value<int64_t>(fact, "req-bases"));
+	o.set_color(f.color);
+	o.set_req_bases(f.req_bases);
 	return o;
 }
 
 Points
-ClipsRestApi::gen_points(CLIPS::Fact::pointer &fact)
+ClipsRestApi::gen_points(const clips_replica::FactSnapshot &fact)
 {
-	Points o;
+	rcll_facts::Points f(fact);
+	Points             o;
 	o.set_kind("Points");
 	o.set_apiVersion(Environment::api_version());
-	o.set_points(get_value<int64_t>(fact, "points"));
-	o.set_team(get_value<std::string>(fact, "team"));
-	o.set_game_time(get_value<float>(fact, "game-time"));
-	o.set_phase(get_value<std::string>(fact, "phase"));
-	o.set_reason(get_value<std::string>(fact, "reason"));
+	o.set_points(f.points);
+	o.set_team(f.team);
+	o.set_game_time(f.game_time);
+	o.set_phase(f.phase);
+	o.set_reason(f.reason);
 	return o;
 }
 
 bool
-ClipsRestApi::match(CLIPS::Fact::pointer &fact, std::string tmpl_name, WebviewRestParams &params)
+ClipsRestApi::match(const clips_replica::FactSnapshot &fact, WebviewRestParams &params)
 
 {
 	std::map<std::string, std::string> slots_to_match = params.get_query_args();
-	CLIPS::Template::pointer           tmpl           = fact->get_template();
-	if (tmpl->name() != tmpl_name)
-		return false;
 	if (slots_to_match.size() == 0)
 		return true;
 
-	std::vector<std::string> slots = fact->slot_names();
 	for (auto &si : slots_to_match) {
-		if (std::find(slots.begin(), slots.end(), si.first) == slots.end())
-			throw Exception("No slot named %s for template %s", si.first.c_str(), tmpl->name().c_str());
+		if (!fact.has_slot(si.first))
+			throw Exception("No slot named %s for template %s",
+			                si.first.c_str(),
+			                fact.template_name().c_str());
 		else {
 			std::vector<std::string> v = get_values(fact, si.first);
 			// for now only single values are allowed as param
 			if (v.size() > 1)
 				throw Exception("Slot %s for template %s is multifield (not supported)",
 				                si.first.c_str(),
-				                tmpl->name().c_str());
+				                fact.template_name().c_str());
 
 			if (v.size() > 0 && v[0] != si.second)
 				return false;
@@ -348,34 +291,90 @@ ClipsRestApi::cb_list_environments()
 	return rv;
 }
 
-WebviewRestArray<Fact>
-ClipsRestApi::cb_get_facts(WebviewRestParams &params)
+/** Parse a non-negative integer query argument.
+ * @param params REST parameters to consume the argument from
+ * @param name name of the query argument
+ * @param default_value value to return if the argument is not set
+ * @return parsed value
+ * @exception WebviewRestException thrown if the value is not a number
+ */
+static size_t
+consume_size_arg(WebviewRestParams &params, const std::string &name, size_t default_value)
 {
-	bool formatted = (params.query_arg("formatted") == "true");
+	std::string value = params.consum_query_arg(name);
+	if (value.empty()) {
+		return default_value;
+	}
+	try {
+		size_t    idx = 0;
+		long long v   = std::stoll(value, &idx);
+		if (idx != value.length() || v < 0) {
+			throw std::invalid_argument(value);
+		}
+		return static_cast<size_t>(v);
+	} catch (std::logic_error &e) {
+		throw WebviewRestException(WebReply::HTTP_BAD_REQUEST,
+		                           "Invalid value '%s' for '%s'",
+		                           value.c_str(),
+		                           name.c_str());
+	}
+}
+
+/** Stream facts as chunked JSON array.
+ * The matching facts are taken from the replica, they are rendered chunk
+ * by chunk while sending the reply.
+ * Supports the query arguments "formatted", "offset" and "limit" for
+ * pagination, and "fields" as a comma-separated list for projection. The
+ * total number of matching facts is sent in the X-Total-Count header.
+ * The reply carries a weak ETag based on the replica revision, unchanged
+ * conditional requests are answered before this is called.
+ * @param params REST parameters, for templates other query arguments are
+ * slot values to match
+ * @param tmpl_name name of the template facts must have, empty for all facts
+ * @return reply streaming the facts
+ */
+std::unique_ptr<WebReply>
+ClipsRestApi::stream_facts(WebviewRestParams &params, const std::string &tmpl_name)
+{
+	bool                     formatted = (params.consum_query_arg("formatted") == "true");
+	std::vector<std::string> fields    = str_split(params.consum_query_arg("fields"), ',');
+	size_t                   offset    = consume_size_arg(params, "offset", 0);
 
-	WebviewRestArray<Fact> rv;
+	size_t limit = consume_size_arg(params, "limit", std::numeric_limits<size_t>::max());
+	// JSON is streamed compact, do not mistake the flag for a slot
+	params.consum_query_arg("pretty");
 
-	MutexLocker          lock(&env_mutex_);
-	CLIPS::Fact::pointer fact = env_->get_facts();
-	while (fact) {
-		rv.push_back(std::move(gen_fact(fact, formatted)));
-		fact = fact->next();
+	std::vector<std::shared_ptr<const clips_replica::FactSnapshot>> facts;
+	size_t                                                          total = 0;
+
+	for (auto &fact : tmpl_name.empty() ? replica_->facts() : replica_->facts(tmpl_name)) {
+		if (!tmpl_name.empty() && !match(*fact, params)) {
+			continue;
+		}
+		if (total >= offset && facts.size() < limit) {
+			facts.push_back(std::move(fact));
+		}
+		total += 1;
 	}
 
-	return rv;
+	auto reply = std::make_unique<ClipsFactStreamReply>(std::move(facts), formatted, fields);
+	reply->add_header("X-Total-Count", std::to_string(total));
+	return reply;
+}
+
+std::unique_ptr<WebReply>
+ClipsRestApi::cb_get_facts(WebviewRestParams &params)
+{
+	return stream_facts(params, "");
 }
 
 WebviewRestArray<Machine>
 ClipsRestApi::cb_get_machines(WebviewRestParams &params)
 {
-	MutexLocker               lock(&env_mutex_);
 	WebviewRestArray<Machine> rv;
-
-	CLIPS::Fact::pointer fact = env_->get_facts();
-	while (fact) {
-		if (match(fact, "machine", params))
-			rv.push_back(std::move(gen_machine(fact)));
-		fact = fact->next();
+	for (const auto &fact : replica_->facts("machine")) {
+		if (match(*fact, params))
+			rv.push_back(std::move(gen_machine(*fact)));
 	}
 	return rv;
 }
@@ -383,14 +382,10 @@ ClipsRestApi::cb_get_machines(WebviewRestParams &params)
 WebviewRestArray<Order>
 ClipsRestApi::cb_get_orders(WebviewRestParams &params)
 {
-	MutexLocker             lock(&env_mutex_);
 	WebviewRestArray<Order> rv;
-
-	CLIPS::Fact::pointer fact = env_->get_facts();
-	while (fact) {
-		if (match(fact, "order", params))
-			rv.push_back(std::move(gen_order(fact)));
-		fact = fact->next();
+	for (const auto &fact : replica_->facts("order")) {
+		if (match(*fact, params))
+			rv.push_back(std::move(gen_order(*fact)));
 	}
 	return rv;
 }
@@ -398,14 +393,10 @@ ClipsRestApi::cb_get_orders(WebviewRestParams &params)
 WebviewRestArray<Robot>
 ClipsRestApi::cb_get_robots(WebviewRestParams &params)
 {
-	MutexLocker             lock(&env_mutex_);
 	WebviewRestArray<Robot> rv;
-
-	CLIPS::Fact::pointer fact = env_->get_facts();
-	while (fact) {
-		if (match(fact, "robot", params))
-			rv.push_back(std::move(gen_robot(fact)));
-		fact = fact->next();
+	for (const auto &fact : replica_->facts("robot")) {
+		if (match(*fact, params))
+			rv.push_back(std::move(gen_robot(*fact)));
 	}
 	return rv;
 }
@@ -413,14 +404,10 @@ ClipsRestApi::cb_get_robots(WebviewRestParams &params)
 WebviewRestArray<GameState>
 ClipsRestApi::cb_get_game_state(WebviewRestParams &params)
 {
-	MutexLocker                 lock(&env_mutex_);
 	WebviewRestArray<GameState> rv;
-
-	CLIPS::Fact::pointer fact = env_->get_facts();
-	while (fact) {
-		if (match(fact, "gamestate", params))
-			rv.push_back(std::move(gen_game_state(fact)));
-		fact = fact->next();
+	for (const auto &fact : replica_->facts("gamestate")) {
+		if (match(*fact, params))
+			rv.push_back(std::move(gen_game_state(*fact)));
 	}
 	return rv;
 }
@@ -428,14 +415,10 @@ ClipsRestApi::cb_get_game_state(WebviewRestParams &params)
 WebviewRestArray<RingSpec>
 ClipsRestApi::cb_get_ring_spec(WebviewRestParams &params)
 {
-	MutexLocker                lock(&env_mutex_);
 	WebviewRestArray<RingSpec> rv;
-
-	CLIPS::Fact::pointer fact = env_->get_facts();
-	while (fact) {
-		if (match(fact, "ring-spec", params))
-			rv.push_back(std::move(gen_ring_spec(fact)));
-		fact = fact->next();
+	for (const auto &fact : replica_->facts("ring-spec")) {
+		if (match(*fact, params))
+			rv.push_back(std::move(gen_ring_spec(*fact)));
 	}
 	return rv;
 }
@@ -443,34 +426,18 @@ ClipsRestApi::cb_get_ring_spec(WebviewRestParams &params)
 WebviewRestArray<Points>
 ClipsRestApi::cb_get_points(fawkes::WebviewRestParams &params)
 {
-	MutexLocker              lock(&env_mutex_);
 	WebviewRestArray<Points> rv;
-
-	CLIPS::Fact::pointer fact = env_->get_facts();
-	while (fact) {
-		if (match(fact, "points", params))
-			rv.push_back(std::move(gen_points(fact)));
-		fact = fact->next();
+	for (const auto &fact : replica_->facts("points")) {
+		if (match(*fact, params))
+			rv.push_back(std::move(gen_points(*fact)));
 	}
 	return rv;
 }
 
-WebviewRestArray<Fact>
+std::unique_ptr<WebReply>
 ClipsRestApi::cb_get_facts_by_tmpl_and_slots(WebviewRestParams &params)
 {
-	bool formatted = (params.consum_query_arg("formatted") == "true");
-
-	WebviewRestArray<Fact> rv;
-
-	MutexLocker          lock(&env_mutex_);
-	CLIPS::Fact::pointer fact = env_->get_facts();
-
-	while (fact) {
-		if (match(fact, params.path_arg("tmpl-name"), params))
-			rv.push_back(std::move(gen_fact(fact, formatted)));
-		fact = fact->next();
-	}
-	return rv;
+	return stream_facts(params, params.path_arg("tmpl-name"));
 }
 
 template <typename T>
@@ -31,12 +31,11 @@
 #include "model/RingSpec.h"
 #include "model/Robot.h"
 
+#include <clips_replica/replica.h>
 #include <core/utils/lockptr.h>
 #include <webview/rest_api.h>
 #include <webview/rest_array.h>
 
-#include <clipsmm.h>
-
 namespace fawkes {
 //from fawkes::WebviewAspect
 class WebviewRestApiManager;
@@ -53,13 +52,14 @@ class Logger;
 class ClipsRestApi : public WebviewRestApi
 {
 public:
-	ClipsRestApi(CLIPS::Environment *env, fawkes::Mutex &env_mutex, Logger *logger);
+	ClipsRestApi(clips_replica::FactReplica *replica, Logger *logger);
 	~ClipsRestApi();
 
 private:
 	fawkes::WebviewRestArray<Environment> cb_list_environments();
-	fawkes::WebviewRestArray<Fact>        cb_get_facts(fawkes::WebviewRestParams &params);
-	fawkes::WebviewRestArray<Fact> cb_get_facts_by_tmpl_and_slots(fawkes::WebviewRestParams &params);
+	std::unique_ptr<fawkes::WebReply>     cb_get_facts(fawkes::WebviewRestParams &params);
+	std::unique_ptr<fawkes::WebReply>
+	cb_get_facts_by_tmpl_and_slots(fawkes::WebviewRestParams &params);
 	fawkes::WebviewRestArray<Machine>   cb_get_machines(fawkes::WebviewRestParams &params);
 	fawkes::WebviewRestArray<Order>     cb_get_orders(fawkes::WebviewRestParams &params);
 	fawkes::WebviewRestArray<Robot>     cb_get_robots(fawkes::WebviewRestParams &params);
@@ -69,20 +69,20 @@ private:
 	template <typename T>
 	fawkes::WebviewRestArray<T> cb_get_tmpl(fawkes::WebviewRestParams &params, std::string tmpl_name);
 
-	Fact      gen_fact(CLIPS::Fact::pointer &fact, bool formatted);
-	Machine   gen_machine(CLIPS::Fact::pointer &fact);
-	Order     gen_order(CLIPS::Fact::pointer &fact);
-	Robot     gen_robot(CLIPS::Fact::pointer &fact);
-	GameState gen_game_state(CLIPS::Fact::pointer &fact);
-	RingSpec  gen_ring_spec(CLIPS::Fact::pointer &fact);
-	Points    gen_points(CLIPS::Fact::pointer &fact);
+	std::unique_ptr<fawkes::WebReply> stream_facts(fawkes::WebviewRestParams &params,
+	                                               const std::string &        tmpl_name);
 
-	bool match(CLIPS::Fact::pointer &fact, std::string tmpl_name, fawkes::WebviewRestParams &params);
+	Machine   gen_machine(const clips_replica::FactSnapshot &fact);
+	Order     gen_order(const clips_replica::FactSnapshot &fact);
+	Robot     gen_robot(const clips_replica::FactSnapshot &fact);
+	GameState gen_game_state(const clips_replica::FactSnapshot &fact);
+	RingSpec  gen_ring_spec(const clips_replica::FactSnapshot &fact);
+	Points    gen_points(const clips_replica::FactSnapshot &fact);
 
-private:
-	CLIPS::Environment *env_;
+	bool match(const clips_replica::FactSnapshot &fact, fawkes::WebviewRestParams &params);
 
-	fawkes::Mutex &env_mutex_;
-	Logger *       logger_;
+private:
+	clips_replica::FactReplica *replica_;
+	Logger *                    logger_;
 };
 } //end namespace llsfrb
@@ -0,0 +1,206 @@
+
+/***************************************************************************
+ *  fact_stream_reply.cpp - Streaming JSON reply for CLIPS facts
+ *
+ *  Created: Mon Oct 19 15:14:02 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+#include "fact_stream_reply.h"
+
+#include "model/Fact.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <cstring>
+
+using namespace fawkes;
+
+namespace llsfrb {
+
+/** @class ClipsFactStreamReply "fact_stream_reply.h"
+ * Chunked JSON reply for a list of CLIPS facts.
+ * The reply is created from snapshots of the facts taken from a replica.
+ * The facts are only rendered to JSON when libmicrohttpd requests the
+ * next chunk, a few at a time. This bounds the memory required for large
+ * fact bases to about one chunk. The output is the same compact JSON
+ * array as produced by the generated Fact model.
+ * @author agent
+ */
+
+/** Constructor.
+ * @param facts snapshots of the facts to send
+ * @param formatted true to send formatted fact strings instead of slots
+ * @param fields fields of the Fact model to send, empty to send all. An
+ * entry of the form "slots.NAME" restricts the slots to the named ones.
+ */
+ClipsFactStreamReply::ClipsFactStreamReply(
+  std::vector<std::shared_ptr<const clips_replica::FactSnapshot>> &&facts,
+  bool                                                              formatted,
+  const std::vector<std::string> &                                  fields)
+: DynamicWebReply(WebReply::HTTP_OK),
+  facts_(std::move(facts)),
+  next_fact_(0),
+  formatted_(formatted),
+  buffer_("["),
+  buffer_pos_(0),
+  finished_(false)
+{
+	for (const auto &f : fields) {
+		if (f.compare(0, 6, "slots.") == 0) {
+			slot_fields_.insert(f.substr(6));
+			fields_.insert("slots");
+		} else if (!f.empty()) {
+			fields_.insert(f);
+		}
+	}
+	add_header("Content-type", "application/json");
+}
+
+/** Destructor. */
+ClipsFactStreamReply::~ClipsFactStreamReply()
+{
+}
+
+size_t
+ClipsFactStreamReply::size()
+{
+	// unknown, sent with chunked transfer encoding
+	return (size_t)-1;
+}
+
+size_t
+ClipsFactStreamReply::next_chunk(size_t pos, char *buffer, size_t buf_max_size)
+{
+	if (pos < buffer_pos_ || pos > buffer_pos_ + buffer_.size()) {
+		// cannot seek in the stream
+		return (size_t)-2;
+	}
+	buffer_.erase(0, pos - buffer_pos_);
+	buffer_pos_ = pos;
+
+	if (buffer_.size() < buf_max_size && !finished_) {
+		fill(buf_max_size);
+	}
+	if (buffer_.empty()) {
+		return (size_t)-1;
+	}
+
+	size_t bytes = std::min(buffer_.size(), buf_max_size);
+	memcpy(buffer, buffer_.data(), bytes);
+	return bytes;
+}
+
+/** Render facts until the buffer holds at least the given size.
+ * @param min_size minimum number of bytes to have buffered if possible
+ */
+void
+ClipsFactStreamReply::fill(size_t min_size)
+{
+	while (buffer_.size() < min_size && next_fact_ < facts_.size()) {
+		if (next_fact_ > 0) {
+			buffer_ += ",";
+		}
+		write_fact(*facts_[next_fact_]);
+		// release fact early, it is no longer needed
+		facts_[next_fact_].reset();
+		next_fact_ += 1;
+	}
+	if (next_fact_ == facts_.size()) {
+		buffer_ += "]";
+		finished_ = true;
+	}
+}
+
+/** Check if a field has been requested.
+ * @param field field name of the Fact model
+ * @return true if the field shall be sent
+ */
+bool
+ClipsFactStreamReply::has_field(const char *field) const
+{
+	return fields_.empty() || (fields_.find(field) != fields_.end());
+}
+
+/** Render a fact to JSON and append it to the buffer.
+ * @param fact fact to render
+ */
+void
+ClipsFactStreamReply::write_fact(const clips_replica::FactSnapshot &fact)
+{
+	rapidjson::StringBuffer                    sb;
+	rapidjson::Writer<rapidjson::StringBuffer> w(sb);
+
+	w.StartObject();
+	if (has_field("kind")) {
+		w.Key("kind");
+		w.String("Fact");
+	}
+	if (has_field("apiVersion")) {
+		w.Key("apiVersion");
+		w.String(Fact::api_version().c_str());
+	}
+	if (has_field("index")) {
+		w.Key("index");
+		w.Int64(fact.index());
+	}
+	if (has_field("template_name")) {
+		w.Key("template_name");
+		w.String(fact.template_name().c_str());
+	}
+	if (formatted_ && has_field("formatted")) {
+		w.Key("formatted");
+		w.String(fact.to_string().c_str());
+	}
+	if (has_field("slots")) {
+		w.Key("slots");
+		w.StartArray();
+		if (!formatted_) {
+			for (const auto &s : fact.slot_names()) {
+				if (!slot_fields_.empty() && slot_fields_.find(s) == slot_fields_.end()) {
+					continue;
+				}
+				const CLIPS::Values &fval = fact.slot_value(s);
+				w.StartObject();
+				w.Key("name");
+				w.String(s.c_str());
+				w.Key("is-multifield");
+				w.Bool(fact.is_multifield_slot(s));
+				w.Key("values");
+				w.StartArray();
+				for (const auto &v : fval) {
+					switch (v.type()) {
+					case CLIPS::TYPE_FLOAT: w.String(std::to_string(v.as_float()).c_str()); break;
+					case CLIPS::TYPE_INTEGER: w.String(std::to_string(v.as_integer()).c_str()); break;
+					case CLIPS::TYPE_SYMBOL:
+					case CLIPS::TYPE_STRING:
+					case CLIPS::TYPE_INSTANCE_NAME: w.String(v.as_string().c_str()); break;
+					default: w.String("ADDR"); break;
+					}
+				}
+				w.EndArray();
+				w.EndObject();
+			}
+		}
+		w.EndArray();
+	}
+	w.EndObject();
+
+	buffer_.append(sb.GetString(), sb.GetSize());
+}
+
+} // end namespace llsfrb
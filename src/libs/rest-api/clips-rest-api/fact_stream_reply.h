@@ -0,0 +1,62 @@
+
+/***************************************************************************
+ *  fact_stream_reply.h - Streaming JSON reply for CLIPS facts
+ *
+ *  Created: Mon Oct 19 15:12:40 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+#pragma once
+
+#include <clips_replica/fact_changes.h>
+#include <webview/reply.h>
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace llsfrb {
+
+class ClipsFactStreamReply : public fawkes::DynamicWebReply
+{
+public:
+	ClipsFactStreamReply(std::vector<std::shared_ptr<const clips_replica::FactSnapshot>> &&facts,
+	                     bool                                                              formatted,
+	                     const std::vector<std::string> &                                  fields);
+	virtual ~ClipsFactStreamReply();
+
+	virtual size_t size();
+	virtual size_t next_chunk(size_t pos, char *buffer, size_t buf_max_size);
+
+private:
+	void fill(size_t min_size);
+	void write_fact(const clips_replica::FactSnapshot &fact);
+	bool has_field(const char *field) const;
+
+private:
+	std::vector<std::shared_ptr<const clips_replica::FactSnapshot>> facts_;
+	size_t                                                          next_fact_;
+	bool                                                            formatted_;
+	std::set<std::string>                                           fields_;
+	std::set<std::string>                                           slot_fields_;
+
+	std::string buffer_;
+	size_t      buffer_pos_;
+	bool        finished_;
+};
+
+} // end namespace llsfrb
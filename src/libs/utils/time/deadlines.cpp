@@ -0,0 +1,169 @@
+/***************************************************************************
+ *  deadlines.cpp - Keyed one-shot deadlines
+ *
+ *  Created: Tue Oct 20 09:12:31 2026
+ *  Copyright  2026  agent <agent@local>
+ *
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version. A runtime exception applies to
+ *  this software (see LICENSE.GPL_WRE file mentioned below for details).
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL_WRE file in the doc directory.
+ */
+
+#include <utils/time/deadlines.h>
+
+#include <algorithm>
+
+namespace fawkes {
+
+/** @class DeadlineQueue <utils/time/deadlines.h>
+ * Keyed one-shot deadlines.
+ * Each key has at most one pending deadline, setting it again replaces the
+ * previous one. This makes it cheap to push a deadline back every time
+ * something is observed, e.g., a timeout after the last message of a peer.
+ * The queue does not run a timer itself. The owner calls expire()
+ * periodically, for example once per main loop iteration, which reports
+ * the keys of all deadlines that have passed.
+ *
+ * Replaced and cancelled deadlines are removed lazily, when they reach the
+ * front of the queue or when they make up most of it.
+ * @author agent
+ */
+
+/** Constructor. */
+DeadlineQueue::DeadlineQueue() : next_seq_(0)
+{
+}
+
+/** Set deadline.
+ * @param key key of the deadline, replaces a pending deadline with the same key
+ * @param deadline point in time at which the deadline expires
+ */
+void
+DeadlineQueue::set(const std::string &key, const Time &deadline)
+{
+	uint64_t seq = next_seq_++;
+	armed_[key]  = seq;
+	heap_.push_back(Entry{deadline, seq, key});
+	std::push_heap(heap_.begin(), heap_.end(), Later());
+	if (heap_.size() > 64 && heap_.size() > 4 * armed_.size()) {
+		compact();
+	}
+}
+
+/** Cancel deadline.
+ * @param key key of the deadline
+ * @return true if a deadline was pending for the key, false otherwise
+ */
+bool
+DeadlineQueue::cancel(const std::string &key)
+{
+	return armed_.erase(key) > 0;
+}
+
+/** Check if a deadline is pending.
+ * @param key key of the deadline
+ * @return true if a deadline is pending for the key, false otherwise
+ */
+bool
+DeadlineQueue::pending(const std::string &key) const
+{
+	return armed_.find(key) != armed_.end();
+}
+
+/** Cancel all deadlines. */
+void
+DeadlineQueue::clear()
+{
+	heap_.clear();
+	armed_.clear();
+}
+
+/** Get number of pending deadlines.
+ * @return number of pending deadlines
+ */
+size_t
+DeadlineQueue::size() const
+{
+	return armed_.size();
+}
+
+/** Get earliest pending deadline.
+ * @param deadline upon return contains the earliest deadline
+ * @return true if a deadline is pending, false otherwise
+ */
+bool
+DeadlineQueue::next(Time &deadline)
+{
+	drop_stale();
+	if (heap_.empty()) {
+		return false;
+	}
+	deadline = heap_.front().deadline;
+	return true;
+}
+
+/** Expire deadlines.
+ * Removes all deadlines which are not later than the given time and calls
+ * the handler for each of them, in the order of their deadlines. The
+ * handler may set new deadlines, they are not expired before the next call,
+ * even if they already passed.
+ * @param now current time
+ * @param handler handler to call for each expired deadline
+ * @return number of expired deadlines
+ */
+size_t
+DeadlineQueue::expire(const Time &now, const ExpiryHandler &handler)
+{
+	std::vector<std::string> expired;
+	drop_stale();
+	while (!heap_.empty() && heap_.front().deadline <= now) {
+		std::pop_heap(heap_.begin(), heap_.end(), Later());
+		armed_.erase(heap_.back().key);
+		expired.push_back(std::move(heap_.back().key));
+		heap_.pop_back();
+		drop_stale();
+	}
+	for (const std::string &key : expired) {
+		handler(key);
+	}
+	return expired.size();
+}
+
+void
+DeadlineQueue::drop_stale()
+{
+	while (!heap_.empty()) {
+		auto a = armed_.find(heap_.front().key);
+		if (a != armed_.end() && a->second == heap_.front().seq) {
+			break;
+		}
+		std::pop_heap(heap_.begin(), heap_.end(), Later());
+		heap_.pop_back();
+	}
+}
+
+void
+DeadlineQueue::compact()
+{
+	heap_.erase(std::remove_if(heap_.begin(),
+	                           heap_.end(),
+	                           [this](const Entry &e) {
+		                           auto a = armed_.find(e.key);
+		                           return a == armed_.end() || a->second != e.seq;
+	                           }),
+	            heap_.end());
+	std::make_heap(heap_.begin(), heap_.end(), Later());
+}
+
+} // end namespace fawkes
@@ -0,0 +1,79 @@
+/***************************************************************************
+ *  deadlines.h - Keyed one-shot deadlines
+ *
+ *  Created: Tue Oct 20 09:12:31 2026
+ *  Copyright  2026  agent <agent@local>
+ *
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version. A runtime exception applies to
+ *  this software (see LICENSE.GPL_WRE file mentioned below for details).
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL_WRE file in the doc directory.
+ */
+
+#ifndef _UTILS_TIME_DEADLINES_H_
+#define _UTILS_TIME_DEADLINES_H_
+
+#include <utils/time/time.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fawkes {
+
+class DeadlineQueue
+{
+public:
+	/** Called with the key of each expired deadline. */
+	typedef std::function<void(const std::string &)> ExpiryHandler;
+
+	DeadlineQueue();
+
+	void set(const std::string &key, const Time &deadline);
+	bool cancel(const std::string &key);
+	bool pending(const std::string &key) const;
+	void clear();
+
+	size_t size() const;
+	bool   next(Time &deadline);
+	size_t expire(const Time &now, const ExpiryHandler &handler);
+
+private:
+	struct Entry
+	{
+		Time        deadline;
+		uint64_t    seq;
+		std::string key;
+	};
+	struct Later
+	{
+		bool
+		operator()(const Entry &a, const Entry &b) const
+		{
+			return (a.deadline > b.deadline) || (a.deadline == b.deadline && a.seq > b.seq);
+		}
+	};
+
+	void drop_stale();
+	void compact();
+
+	std::vector<Entry>                        heap_;
+	std::unordered_map<std::string, uint64_t> armed_;
+	uint64_t                                  next_seq_;
+};
+
+} // end namespace fawkes
+
+#endif
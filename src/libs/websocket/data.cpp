@@ -266,16 +266,15 @@ Data::log_push_attention_message(std::string text, std::string team, std::string
 	log_push(d);
 }
 
-/** Get a value from a fact.
- * @param fact pointer to CLIPS fact
- * @param slot_name name of field to retrieve
+/** Get the first value of a slot.
+ * @param v values of the slot
+ * @param slot_name name of the slot, used in error messages
  * @return template-specific return value
  */
 template <typename T>
 T
-get_value(const CLIPS::Fact::pointer &fact, const std::string &slot_name)
+value_of(CLIPS::Values v, const std::string &slot_name)
 {
-	CLIPS::Values v = fact->slot_value(slot_name);
 	if (v.empty()) {
 		throw Exception("No value for slot '%s'", slot_name.c_str());
 	}
@@ -286,15 +285,14 @@ get_value(const CLIPS::Fact::pointer &fact, const std::string &slot_name)
 }
 
 /** Specialization for bool.
- * @param fact pointer to CLIPS fact
- * @param slot_name name of field to retrieve
+ * @param v values of the slot
+ * @param slot_name name of the slot, used in error messages
  * @return boolean value
  */
 template <>
 bool
-get_value(const CLIPS::Fact::pointer &fact, const std::string &slot_name)
+value_of(CLIPS::Values v, const std::string &slot_name)
 {
-	CLIPS::Values v = fact->slot_value(slot_name);
 	if (v.empty()) {
 		throw Exception("No value for slot '%s'", slot_name.c_str());
 	}
@@ -304,16 +302,29 @@ get_value(const CLIPS::Fact::pointer &fact, const std::string &slot_name)
 	return (v[0].as_string() == "TRUE");
 }
 
+/** Get value.
+ * @param fact pointer to CLIPS fact or to a replicated fact
+ * @param slot_name name of field to retrieve
+ * @return template-specific return value
+ */
+template <typename T, typename F>
+T
+get_value(const F &fact, const std::string &slot_name)
+{
+	return value_of<T>(fact->slot_value(slot_name), slot_name);
+}
+
 /** Get value array.
- * This is not a template because the overly verbose operator API
- * of CLIPS::Value can lead to ambiguous overloads, e.g., resolving
- * std::string to std::string or const char * operators.
- * @param fact pointer to CLIPS fact
+ * This does not return a template type because the overly verbose
+ * operator API of CLIPS::Value can lead to ambiguous overloads, e.g.,
+ * resolving std::string to std::string or const char * operators.
+ * @param fact pointer to CLIPS fact or to a replicated fact
  * @param slot_name name of field to retrieve
  * @return vector of strings from multislot
  */
+template <typename F>
 static std::vector<std::string>
-get_values(const CLIPS::Fact::pointer &fact, const std::string &slot_name)
+get_values(const F &fact, const std::string &slot_name)
 {
 	CLIPS::Values            v = fact->slot_value(slot_name);
 	std::vector<std::string> rv(v.size());
@@ -330,6 +341,26 @@ get_values(const CLIPS::Fact::pointer &fact, const std::string &slot_name)
 	return rv;
 }
 
+/** Get the template name of a CLIPS fact.
+ * @param fact pointer to CLIPS fact
+ * @return name of the deftemplate
+ */
+static std::string
+template_name(const CLIPS::Fact::pointer &fact)
+{
+	return fact->get_template()->name();
+}
+
+/** Get the template name of a replicated fact.
+ * @param fact replicated fact
+ * @return name of the deftemplate
+ */
+static std::string
+template_name(const Data::FactSnapshotPtr &fact)
+{
+	return fact->template_name();
+}
+
 /**
  * @brief Check if the given fact pointer is an instance of the given template
  *
@@ -392,7 +423,7 @@ Data::log_push_order_info(int id)
 					rapidjson::Document d;
 					d.SetObject();
 					rapidjson::Document::AllocatorType &alloc = d.GetAllocator();
-					get_order_info_fact(&d, alloc, fact);
+					get_order_info_env_fact(&d, alloc, fact);
 					//send it off
 					log_push(d);
 				}
@@ -426,7 +457,7 @@ Data::log_push_order_info_via_delivery(int delivery_id)
 								rapidjson::Document d;
 								d.SetObject();
 								rapidjson::Document::AllocatorType &alloc = d.GetAllocator();
-								get_order_info_fact(&d, alloc, order);
+								get_order_info_env_fact(&d, alloc, order);
 								//send it off
 								log_push(d);
 							}
@@ -549,6 +580,104 @@ Data::log_push_workpiece_info(int id)
 	}
 }
 
+/**
+ * @brief Pushes the game state of a replicated gamestate fact to the send queue
+ *
+ * @param gamestate replicated gamestate fact
+ */
+void
+Data::log_push_game_state_fact(const FactSnapshotPtr &gamestate)
+{
+	rapidjson::Document d;
+	d.SetObject();
+	get_game_state_fact(&d, d.GetAllocator(), gamestate);
+	log_push(d);
+}
+
+/**
+ * @brief Pushes the robot info of a replicated robot fact to the send queue
+ *
+ * @param robot replicated robot fact
+ */
+void
+Data::log_push_robot_info_fact(const FactSnapshotPtr &robot)
+{
+	rapidjson::Document d;
+	d.SetObject();
+	get_robot_info_fact(&d, d.GetAllocator(), robot);
+	log_push(d);
+}
+
+/**
+ * @brief Pushes the machine info of a replicated machine fact to the send queue
+ *
+ * @param machine replicated machine fact
+ */
+void
+Data::log_push_machine_info_fact(const FactSnapshotPtr &machine)
+{
+	rapidjson::Document d;
+	d.SetObject();
+	get_machine_info_fact(&d, d.GetAllocator(), machine);
+	log_push(d);
+}
+
+/**
+ * @brief Pushes the workpiece info of a replicated workpiece fact to the send queue
+ *
+ * @param workpiece replicated workpiece fact
+ */
+void
+Data::log_push_workpiece_info_fact(const FactSnapshotPtr &workpiece)
+{
+	rapidjson::Document d;
+	d.SetObject();
+	get_workpiece_info_fact(&d, d.GetAllocator(), workpiece);
+	log_push(d);
+}
+
+/**
+ * @brief Pushes the order info of a replicated order fact to the send queue
+ *
+ * @param order replicated order fact
+ * @param facts replicated facts to search for unconfirmed deliveries of the order
+ */
+void
+Data::log_push_order_info_fact(const FactSnapshotPtr &             order,
+                               const std::vector<FactSnapshotPtr> &facts)
+{
+	rapidjson::Document d;
+	d.SetObject();
+	rapidjson::Document::AllocatorType &alloc = d.GetAllocator();
+	get_order_info_fact(&d, alloc, order);
+	d.AddMember("unconfirmed_deliveries",
+	            get_unconfirmed_delivery_fact(alloc, get_value<int64_t>(order, "id"), facts),
+	            alloc);
+	log_push(d);
+}
+
+/**
+ * @brief Pushes replicated points facts to the send queue as an array
+ *
+ * @param points all replicated points facts
+ */
+void
+Data::log_push_points_facts(const std::vector<FactSnapshotPtr> &points)
+{
+	log_push(info_array(points, &Data::get_points_fact<rapidjson::Value, FactSnapshotPtr>));
+}
+
+/**
+ * @brief Pushes replicated ring-spec facts to the send queue as an array
+ *
+ * @param ring_specs all replicated ring-spec facts
+ */
+void
+Data::log_push_ring_spec_facts(const std::vector<FactSnapshotPtr> &ring_specs)
+{
+	log_push(info_array(ring_specs, &Data::get_ring_spec_fact<rapidjson::Value, FactSnapshotPtr>));
+}
+
 /**
  * @brief Create a string of a JSON array containing the data of all current known teams facts
  *
@@ -557,7 +686,8 @@ Data::log_push_workpiece_info(int id)
 std::string
 Data::on_connect_known_teams()
 {
-	return on_connect_info("known-teams", &Data::get_known_teams_fact<rapidjson::Value>);
+	return on_connect_info("known-teams",
+	                       &Data::get_known_teams_fact<rapidjson::Value, CLIPS::Fact::pointer>);
 }
 
 /**
@@ -568,7 +698,8 @@ Data::on_connect_known_teams()
 std::string
 Data::on_connect_workpiece_info()
 {
-	return on_connect_info("workpiece", &Data::get_workpiece_info_fact<rapidjson::Value>);
+	return on_connect_info("workpiece",
+	                       &Data::get_workpiece_info_fact<rapidjson::Value, CLIPS::Fact::pointer>);
 }
 
 /**
@@ -579,7 +710,8 @@ Data::on_connect_workpiece_info()
 std::string
 Data::on_connect_robot_info()
 {
-	return on_connect_info("robot", &Data::get_robot_info_fact<rapidjson::Value>);
+	return on_connect_info("robot",
+	                       &Data::get_robot_info_fact<rapidjson::Value, CLIPS::Fact::pointer>);
 }
 
 /**
@@ -590,7 +722,8 @@ Data::on_connect_robot_info()
 std::string
 Data::on_connect_ring_spec()
 {
-	return on_connect_info("ring-spec", &Data::get_ring_spec_fact<rapidjson::Value>);
+	return on_connect_info("ring-spec",
+	                       &Data::get_ring_spec_fact<rapidjson::Value, CLIPS::Fact::pointer>);
 }
 
 /**
@@ -601,7 +734,7 @@ Data::on_connect_ring_spec()
 std::string
 Data::on_connect_points()
 {
-	return on_connect_info("points", &Data::get_points_fact<rapidjson::Value>);
+	return on_connect_info("points", &Data::get_points_fact<rapidjson::Value, CLIPS::Fact::pointer>);
 }
 
 /**
@@ -612,7 +745,7 @@ Data::on_connect_points()
 std::string
 Data::on_connect_order_info()
 {
-	return on_connect_info("order", &Data::get_order_info_fact<rapidjson::Value>);
+	return on_connect_info("order", &Data::get_order_info_env_fact<rapidjson::Value>);
 }
 
 /**
@@ -663,7 +796,8 @@ Data::on_connect_order_count()
 std::string
 Data::on_connect_machine_info()
 {
-	return on_connect_info("machine", &Data::get_machine_info_fact<rapidjson::Value>);
+	return on_connect_info("machine",
+	                       &Data::get_machine_info_fact<rapidjson::Value, CLIPS::Fact::pointer>);
 }
 
 /**
@@ -677,13 +811,10 @@ std::string
 Data::on_connect_info(std::string tmpl_name,
                       void (Data::*get_info_fact)(rapidjson::Value *,
                                                   rapidjson::Document::AllocatorType &,
-                                                  CLIPS::Fact::pointer))
+                                                  const CLIPS::Fact::pointer &))
 {
-	MutexLocker         lock(&env_mutex_);
-	rapidjson::Document d;
-	d.SetArray();
-	rapidjson::Document::AllocatorType &alloc = d.GetAllocator();
-	std::vector<CLIPS::Fact::pointer>   facts = {};
+	MutexLocker                       lock(&env_mutex_);
+	std::vector<CLIPS::Fact::pointer> facts = {};
 
 	//get machine facts pointers
 	CLIPS::Fact::pointer fact = env_->get_facts();
@@ -693,10 +824,31 @@ Data::on_connect_info(std::string tmpl_name,
 		}
 		fact = fact->next();
 	}
+	return info_array(facts, get_info_fact);
+}
+
+/**
+ * @brief Prepare a message that contains the given facts
+ *
+ * @tparam F
+ * @param facts facts of one template
+ * @param get_info_fact function to pack one fact into a rapidjson object
+ * @return std::string
+ */
+template <class F>
+std::string
+Data::info_array(const std::vector<F> &facts,
+                 void (Data::*get_info_fact)(rapidjson::Value *,
+                                             rapidjson::Document::AllocatorType &,
+                                             const F &))
+{
+	rapidjson::Document d;
+	d.SetArray();
+	rapidjson::Document::AllocatorType &alloc = d.GetAllocator();
 	d.Reserve(facts.size(), alloc);
 
 	//get facts and pack into json array
-	for (CLIPS::Fact::pointer fact : facts) {
+	for (const F &fact : facts) {
 		try {
 			rapidjson::Value o;
 			o.SetObject();
@@ -719,15 +871,14 @@ Data::on_connect_info(std::string tmpl_name,
  * @brief Gets data of the saved known-teams on the refbox side to support user input
  * 
  * @tparam T 
+ * @tparam F 
  * @param o 
  * @param alloc 
  * @param fact 
  */
-template <class T>
+template <class T, class F>
 void
-Data::get_known_teams_fact(T *                                 o,
-                           rapidjson::Document::AllocatorType &alloc,
-                           CLIPS::Fact::pointer                fact)
+Data::get_known_teams_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact)
 {
 	//generic type information
 	rapidjson::Value json_string;
@@ -751,15 +902,14 @@ Data::get_known_teams_fact(T *                                 o,
  * @brief Gets data of a machine-info fact and packs into into a rapidjson object
  *
  * @tparam T
+ * @tparam F
  * @param o
  * @param alloc
  * @param fact
  */
-template <class T>
+template <class T, class F>
 void
-Data::get_machine_info_fact(T *                                 o,
-                            rapidjson::Document::AllocatorType &alloc,
-                            CLIPS::Fact::pointer                fact)
+Data::get_machine_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact)
 {
 	//generic type information
 	rapidjson::Value json_string;
@@ -820,15 +970,14 @@ Data::get_machine_info_fact(T *                                 o,
  * @brief Gets data of a order-info fact and packs into into a rapidjson object
  *
  * @tparam T
+ * @tparam F
  * @param o
  * @param alloc
  * @param fact
  */
-template <class T>
+template <class T, class F>
 void
-Data::get_order_info_fact(T *                                 o,
-                          rapidjson::Document::AllocatorType &alloc,
-                          CLIPS::Fact::pointer                fact)
+Data::get_order_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact)
 {
 	//generic type information
 	rapidjson::Value json_string;
@@ -877,7 +1026,23 @@ Data::get_order_info_fact(T *                                 o,
 		ring_array.PushBack(v, alloc);
 	}
 	(*o).AddMember("ring_colors", ring_array, alloc);
+}
 
+/**
+ * @brief Gets data of an order-info fact including the unconfirmed deliveries from CLIPS
+ *
+ * @tparam T
+ * @param o
+ * @param alloc
+ * @param fact
+ */
+template <class T>
+void
+Data::get_order_info_env_fact(T *                                 o,
+                              rapidjson::Document::AllocatorType &alloc,
+                              const CLIPS::Fact::pointer &        fact)
+{
+	get_order_info_fact(o, alloc, fact);
 	(*o).AddMember("unconfirmed_deliveries",
 	               get_unconfirmed_delivery_fact(alloc, get_value<int64_t>(fact, "id")),
 	               alloc);
@@ -892,19 +1057,42 @@ Data::get_order_info_fact(T *                                 o,
  */
 rapidjson::Value
 Data::get_unconfirmed_delivery_fact(rapidjson::Document::AllocatorType &alloc, int64_t id)
+{
+	std::vector<CLIPS::Fact::pointer> facts;
+
+	CLIPS::Fact::pointer fact = env_->get_facts();
+	while (fact) {
+		facts.push_back(fact);
+		fact = fact->next();
+	}
+	return get_unconfirmed_delivery_fact(alloc, id, facts);
+}
+
+/**
+ * @brief Creates a rapidjson array of unconfirmed delivery objects for the given order id
+ *
+ * @tparam F
+ * @param alloc
+ * @param id order id to get the correct unconfirmed delivery
+ * @param facts facts to search for product-processed and referee-confirmation facts
+ * @return rapidjson::Value
+ */
+template <class F>
+rapidjson::Value
+Data::get_unconfirmed_delivery_fact(rapidjson::Document::AllocatorType &alloc,
+                                    int64_t                             id,
+                                    const std::vector<F> &              facts)
 {
 	rapidjson::Value unconfirmed_delivery(rapidjson::kArrayType);
 	rapidjson::Value json_string;
 
-	CLIPS::Fact::pointer delivery = env_->get_facts();
-	while (delivery) {
-		if (match(delivery, "product-processed")) {
+	for (const F &delivery : facts) {
+		if (template_name(delivery) == "product-processed") {
 			if (get_value<std::string>(delivery, "confirmed") == "FALSE"
 			    && get_value<int64_t>(delivery, "order") == id
 			    && get_value<std::string>(delivery, "mtype") == "DS") {
-				CLIPS::Fact::pointer referee_confirmation = env_->get_facts();
-				while (referee_confirmation) {
-					if (match(referee_confirmation, "referee-confirmation")
+				for (const F &referee_confirmation : facts) {
+					if (template_name(referee_confirmation) == "referee-confirmation"
 					    && get_value<int64_t>(delivery, "id")
 					         == get_value<int64_t>(referee_confirmation, "process-id")
 					    && get_value<std::string>(referee_confirmation, "state") == "REQUIRED") {
@@ -919,11 +1107,9 @@ Data::get_unconfirmed_delivery_fact(rapidjson::Document::AllocatorType &alloc, i
 
 						unconfirmed_delivery.PushBack(o, alloc);
 					}
-					referee_confirmation = referee_confirmation->next();
 				}
 			}
 		}
-		delivery = delivery->next();
 	}
 
 	return unconfirmed_delivery;
@@ -933,15 +1119,14 @@ Data::get_unconfirmed_delivery_fact(rapidjson::Document::AllocatorType &alloc, i
  * @brief Gets data of a robot-info fact and packs into into a rapidjson object
  *
  * @tparam T
+ * @tparam F
  * @param o
  * @param alloc
  * @param fact
  */
-template <class T>
+template <class T, class F>
 void
-Data::get_robot_info_fact(T *                                 o,
-                          rapidjson::Document::AllocatorType &alloc,
-                          CLIPS::Fact::pointer                fact)
+Data::get_robot_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact)
 {
 	//generic type information
 	rapidjson::Value json_string;
@@ -996,15 +1181,14 @@ Data::get_robot_info_fact(T *                                 o,
  * @brief Gets data of a gamestate fact and packs into into a rapidjson object
  *
  * @tparam T
+ * @tparam F
  * @param o
  * @param alloc
  * @param fact
  */
-template <class T>
+template <class T, class F>
 void
-Data::get_game_state_fact(T *                                 o,
-                          rapidjson::Document::AllocatorType &alloc,
-                          CLIPS::Fact::pointer                fact)
+Data::get_game_state_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact)
 {
 	//generic type information
 	rapidjson::Value json_string;
@@ -1037,13 +1221,14 @@ Data::get_game_state_fact(T *                                 o,
  * @brief Gets data of a ring-spec fact and packs into into a rapidjson object
  *
  * @tparam T
+ * @tparam F
  * @param o
  * @param alloc
  * @param fact
  */
-template <class T>
+template <class T, class F>
 void
-Data::get_ring_spec_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS::Fact::pointer fact)
+Data::get_ring_spec_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact)
 {
 	//generic type information
 	rapidjson::Value json_string;
@@ -1062,13 +1247,14 @@ Data::get_ring_spec_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS:
  * @brief Gets data of a points fact and packs into into a rapidjson object
  *
  * @tparam T
+ * @tparam F
  * @param o
  * @param alloc
  * @param fact
  */
-template <class T>
+template <class T, class F>
 void
-Data::get_points_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS::Fact::pointer fact)
+Data::get_points_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact)
 {
 	//generic type information
 	rapidjson::Value json_string;
@@ -1093,15 +1279,14 @@ Data::get_points_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS::Fa
  * @brief Gets data of a workpiece-info fact and packs into into a rapidjson object
  *
  * @tparam T
+ * @tparam F
  * @param o
  * @param alloc
  * @param fact
  */
-template <class T>
+template <class T, class F>
 void
-Data::get_workpiece_info_fact(T *                                 o,
-                              rapidjson::Document::AllocatorType &alloc,
-                              CLIPS::Fact::pointer                fact)
+Data::get_workpiece_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact)
 {
 	//generic type information
 	rapidjson::Value json_string;
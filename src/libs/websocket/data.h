@@ -24,6 +24,7 @@
 #include "client.h"
 #include "logging/logger.h"
 
+#include <clips_replica/fact_changes.h>
 #include <clipsmm.h>
 
 #define RAPIDJSON_HAS_STDSTRING 1
@@ -44,6 +45,9 @@ class Client; // forward declaration
 class Data
 {
 public:
+	/** Shared pointer to a fact replicated from the refbox environment. */
+	typedef std::shared_ptr<const clips_replica::FactSnapshot> FactSnapshotPtr;
+
 	Data(std::shared_ptr<Logger> logger, CLIPS::Environment *env, fawkes::Mutex &env_mutex);
 	std::string log_pop();
 	void        log_push(std::string log);
@@ -74,6 +78,14 @@ public:
 	void        log_push_machine_info(std::string name);
 	void        log_push_workpiece_info(int id);
 	void        log_push_order_info_via_delivery(int delivery_id);
+	void        log_push_game_state_fact(const FactSnapshotPtr &gamestate);
+	void        log_push_robot_info_fact(const FactSnapshotPtr &robot);
+	void        log_push_machine_info_fact(const FactSnapshotPtr &machine);
+	void        log_push_workpiece_info_fact(const FactSnapshotPtr &workpiece);
+	void        log_push_order_info_fact(const FactSnapshotPtr &             order,
+	                                     const std::vector<FactSnapshotPtr> &facts);
+	void        log_push_points_facts(const std::vector<FactSnapshotPtr> &points);
+	void        log_push_ring_spec_facts(const std::vector<FactSnapshotPtr> &ring_specs);
 	std::string on_connect_known_teams();
 	std::string on_connect_machine_info();
 	std::string on_connect_order_info();
@@ -85,37 +97,42 @@ public:
 	std::string get_gamestate();
 	std::string get_gamephase();
 	std::map<std::string, std::shared_ptr<rapidjson::SchemaDocument>> command_schema_map;
+	template <class T, class F>
+	void get_known_teams_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact);
+	template <class T, class F>
+	void get_machine_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact);
+	template <class T, class F>
+	void get_order_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact);
 	template <class T>
-	void
-	get_known_teams_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS::Fact::pointer fact);
-	template <class T>
-	void
-	get_machine_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS::Fact::pointer fact);
-	template <class T>
-	void
-	get_order_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS::Fact::pointer fact);
-	template <class T>
-	void
-	get_robot_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS::Fact::pointer fact);
-	template <class T>
-	void
-	get_game_state_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS::Fact::pointer fact);
-	template <class T>
-	void
-	get_ring_spec_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS::Fact::pointer fact);
-	template <class T>
-	void get_points_fact(T *o, rapidjson::Document::AllocatorType &alloc, CLIPS::Fact::pointer fact);
-	template <class T>
-	void get_workpiece_info_fact(T *                                 o,
+	void get_order_info_env_fact(T *                                 o,
 	                             rapidjson::Document::AllocatorType &alloc,
-	                             CLIPS::Fact::pointer                fact);
+	                             const CLIPS::Fact::pointer &        fact);
+	template <class T, class F>
+	void get_robot_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact);
+	template <class T, class F>
+	void get_game_state_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact);
+	template <class T, class F>
+	void get_ring_spec_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact);
+	template <class T, class F>
+	void get_points_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact);
+	template <class T, class F>
+	void get_workpiece_info_fact(T *o, rapidjson::Document::AllocatorType &alloc, const F &fact);
 
 	rapidjson::Value get_unconfirmed_delivery_fact(rapidjson::Document::AllocatorType &alloc,
 	                                               int64_t                             id);
+	template <class F>
+	rapidjson::Value get_unconfirmed_delivery_fact(rapidjson::Document::AllocatorType &alloc,
+	                                               int64_t                             id,
+	                                               const std::vector<F> &              facts);
 	std::string      on_connect_info(std::string tmpl_name,
 	                                 void (Data::*get_info_fact)(rapidjson::Value *,
                                                           rapidjson::Document::AllocatorType &,
-                                                          CLIPS::Fact::pointer));
+                                                          const CLIPS::Fact::pointer &));
+	template <class F>
+	std::string info_array(const std::vector<F> &facts,
+	                       void (Data::*get_info_fact)(rapidjson::Value *,
+	                                                   rapidjson::Document::AllocatorType &,
+	                                                   const F &));
 
 private:
 	std::shared_ptr<Logger>                    logger_;
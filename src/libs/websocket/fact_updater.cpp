@@ -0,0 +1,194 @@
+/***************************************************************************
+ *  fact_updater.cpp - push updates to clients when facts change
+ *
+ *  Created: Wed Oct 21 11:05:37 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+#include "fact_updater.h"
+
+#include <core/exception.h>
+
+#include <set>
+
+namespace llsfrb::websocket {
+
+/// @cond INTERNALS
+static const CLIPS::Value &
+slot_value(const clips_replica::FactSnapshot &fact, const char *slot)
+{
+	const CLIPS::Values &v = fact.slot_value(slot);
+	if (v.empty()) {
+		throw Exception("No value for slot '%s'", slot);
+	}
+	return v[0];
+}
+/// @endcond
+
+/** @class FactUpdater "fact_updater.h"
+ * @brief Push updates to the clients whenever a fact of interest changes.
+ *
+ *  The updater replaces the CLIPS rules which matched every fact sent to
+ *  the clients only to call the matching ws-create function. It receives
+ *  the fact events in its own thread, modifications that do not change
+ *  any slot are skipped. Game state, points and ring specifications are
+ *  pushed at most once per batch of events.
+ *
+ *  The messages are created from the replicated facts of the events, the
+ *  updater keeps the facts it subscribed to. It never locks or reads the
+ *  refbox environment.
+ */
+
+/**
+ * @brief Construct a new FactUpdater and start it.
+ *
+ * @param data data object used to create and queue the messages
+ * @param publisher publisher of the fact changes of the refbox environment
+ * @param logger logger for errors
+ */
+FactUpdater::FactUpdater(std::shared_ptr<Data>               data,
+                         clips_replica::FactChangePublisher *publisher,
+                         Logger *                            logger)
+: clips_replica::FactEventSubscriber(publisher), data_(data), logger_(logger)
+{
+	add_template("gamestate", {});
+	add_template("order", {"id"});
+	add_template("product-processed", {"id"});
+	add_template("referee-confirmation", {"process-id"});
+	add_template("robot", {"team-color", "number"});
+	add_template("workpiece", {"id"});
+	add_template("machine", {"name"});
+	add_template("points");
+	add_template("ring-spec", {"color"});
+	start();
+}
+
+/** Destructor. */
+FactUpdater::~FactUpdater()
+{
+	stop();
+}
+
+/**
+ * @brief Queue the messages for the changed facts.
+ *
+ * @param events fact events of one batch
+ */
+void
+FactUpdater::fact_events(const std::vector<clips_replica::FactEvent> &events)
+{
+	Data::FactSnapshotPtr game_state;
+	bool                  points    = false;
+	bool                  ring_spec = false;
+	std::set<int64_t>     orders;
+	std::set<int64_t>     confirmations;
+
+	for (const clips_replica::FactEvent &e : events) {
+		switch (e.kind) {
+		case clips_replica::FactEvent::CLEAR: facts_.clear(); continue;
+		case clips_replica::FactEvent::RETRACT: facts_.erase(e.fact->index()); break;
+		case clips_replica::FactEvent::MODIFY:
+			facts_.erase(e.old_fact->index());
+			facts_[e.fact->index()] = e.fact;
+			break;
+		case clips_replica::FactEvent::ASSERT: facts_[e.fact->index()] = e.fact; break;
+		}
+		if (e.kind == clips_replica::FactEvent::MODIFY && e.changed_slots.empty()) {
+			continue;
+		}
+		const clips_replica::FactSnapshot &fact = *e.fact;
+		const std::string &                tmpl = fact.template_name();
+		if (tmpl == "points") {
+			// a retracted points fact changes the total as well
+			points = true;
+			continue;
+		}
+		if (e.kind == clips_replica::FactEvent::RETRACT) {
+			continue;
+		}
+		try {
+			if (tmpl == "gamestate") {
+				game_state = e.fact;
+			} else if (tmpl == "ring-spec") {
+				ring_spec = true;
+			} else if (tmpl == "order") {
+				orders.insert(slot_value(fact, "id").as_integer());
+			} else if (tmpl == "product-processed") {
+				orders.insert(slot_value(fact, "order").as_integer());
+			} else if (tmpl == "referee-confirmation") {
+				confirmations.insert(slot_value(fact, "process-id").as_integer());
+			} else if (tmpl == "robot") {
+				data_->log_push_robot_info_fact(e.fact);
+			} else if (tmpl == "workpiece") {
+				data_->log_push_workpiece_info_fact(e.fact);
+			} else if (tmpl == "machine") {
+				data_->log_push_machine_info_fact(e.fact);
+			}
+		} catch (Exception &) {
+			logger_->log_error("Websocket", "can't access value(s) of fact of type %s", tmpl.c_str());
+		}
+	}
+
+	try {
+		if (game_state) {
+			data_->log_push_game_state_fact(game_state);
+		}
+		if (!orders.empty() || !confirmations.empty()) {
+			std::vector<Data::FactSnapshotPtr> products = facts_of("product-processed");
+			for (const Data::FactSnapshotPtr &p : products) {
+				// a confirmation changes the unconfirmed deliveries of the order
+				if (confirmations.count(slot_value(*p, "id").as_integer()) > 0) {
+					orders.insert(slot_value(*p, "order").as_integer());
+				}
+			}
+			std::vector<Data::FactSnapshotPtr> deliveries = facts_of("referee-confirmation");
+			deliveries.insert(deliveries.end(), products.begin(), products.end());
+			for (const Data::FactSnapshotPtr &o : facts_of("order")) {
+				if (orders.count(slot_value(*o, "id").as_integer()) > 0) {
+					data_->log_push_order_info_fact(o, deliveries);
+				}
+			}
+		}
+		if (points) {
+			data_->log_push_points_facts(facts_of("points"));
+		}
+		if (ring_spec) {
+			data_->log_push_ring_spec_facts(facts_of("ring-spec"));
+		}
+	} catch (Exception &e) {
+		logger_->log_error("Websocket", "can't access value(s) of fact: %s", e.what_no_backtrace());
+	}
+}
+
+/**
+ * @brief Get the kept facts of a template.
+ *
+ * @param tmpl name of the template
+ * @return facts of the template, ordered by fact index
+ */
+std::vector<Data::FactSnapshotPtr>
+FactUpdater::facts_of(const std::string &tmpl) const
+{
+	std::vector<Data::FactSnapshotPtr> rv;
+	for (const auto &f : facts_) {
+		if (f.second->template_name() == tmpl) {
+			rv.push_back(f.second);
+		}
+	}
+	return rv;
+}
+
+} // namespace llsfrb::websocket
@@ -0,0 +1,57 @@
+/***************************************************************************
+ *  fact_updater.h - push updates to clients when facts change
+ *
+ *  Created: Wed Oct 21 11:05:37 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+#ifndef _PLUGINS_WEBSOCKET_FACT_UPDATER_H_
+#define _PLUGINS_WEBSOCKET_FACT_UPDATER_H_
+
+#include "data.h"
+#include "logging/logger.h"
+
+#include <clips_replica/events.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace llsfrb::websocket {
+
+class FactUpdater : public clips_replica::FactEventSubscriber
+{
+public:
+	FactUpdater(std::shared_ptr<Data>               data,
+	            clips_replica::FactChangePublisher *publisher,
+	            Logger *                            logger);
+	~FactUpdater();
+
+protected:
+	void fact_events(const std::vector<clips_replica::FactEvent> &events) override;
+
+private:
+	std::vector<Data::FactSnapshotPtr> facts_of(const std::string &tmpl) const;
+
+	std::shared_ptr<Data> data_;
+	Logger *              logger_;
+
+	std::map<long int, Data::FactSnapshotPtr> facts_;
+};
+
+} // namespace llsfrb::websocket
+
+#endif
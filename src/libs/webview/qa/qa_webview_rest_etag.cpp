@@ -0,0 +1,152 @@
+
+/***************************************************************************
+ *  qa_webview_rest_etag.cpp - Webview REST API conditional requests
+ *
+ *  Created: Mon Oct 19 16:21:08 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+/// @cond QA
+
+#include <logging/console.h>
+#include <webview/reply.h>
+#include <webview/request.h>
+#include <webview/rest_api.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+using namespace fawkes;
+
+class StreamReply : public DynamicWebReply
+{
+public:
+	StreamReply() : DynamicWebReply(WebReply::HTTP_OK), body_("[]")
+	{
+	}
+
+	virtual size_t
+	size()
+	{
+		return body_.length();
+	}
+
+	virtual size_t
+	next_chunk(size_t pos, char *buffer, size_t buf_max_size)
+	{
+		if (pos >= body_.length()) {
+			return -1;
+		}
+		size_t n = std::min(buf_max_size, body_.length() - pos);
+		memcpy(buffer, body_.data() + pos, n);
+		return n;
+	}
+
+private:
+	std::string body_;
+};
+
+static unsigned int num_calls = 0;
+static uint64_t     revision  = 1;
+
+static std::string
+header(const WebReply *reply, const std::string &key)
+{
+	auto h = reply->headers().find(key);
+	return (h != reply->headers().end()) ? h->second : "";
+}
+
+static std::unique_ptr<WebReply>
+request(WebviewRestApi &   api,
+        const std::string &url,
+        const std::string &tmpl,
+        const std::string &if_none_match = "")
+{
+	WebRequest request(url.c_str());
+	request.set_method(WebRequest::METHOD_GET);
+	request.set_get_value("template", tmpl);
+	if (!if_none_match.empty()) {
+		request.set_header("If-None-Match", if_none_match);
+	}
+	return std::unique_ptr<WebReply>(api.process_request(&request, url));
+}
+
+static void
+expect(const std::unique_ptr<WebReply> &reply,
+       WebReply::Code                   code,
+       unsigned int                     calls,
+       const char *                     what)
+{
+	if (!reply || reply->code() != code || num_calls != calls) {
+		printf("FAILED: %s: code %i (expected %i), %u handler calls (expected %u)\n",
+		       what,
+		       reply ? (int)reply->code() : -1,
+		       (int)code,
+		       num_calls,
+		       calls);
+		exit(1);
+	}
+	printf("OK: %s\n", what);
+}
+
+int
+main(int argc, char **argv)
+{
+	llsfrb::ConsoleLogger logger;
+	WebviewRestApi        api("qa", &logger);
+	api.add_handler(WebRequest::METHOD_GET,
+	                "/facts",
+	                [](WebviewRestParams &params) -> std::unique_ptr<WebReply> {
+		                num_calls += 1;
+		                return std::make_unique<StreamReply>();
+	                });
+	api.set_cache_revision_provider([]() { return revision; });
+
+	auto reply = request(api, "/facts", "machine");
+	expect(reply, WebReply::HTTP_OK, 1, "streamed reply");
+	std::string etag = header(reply.get(), "ETag");
+	if (etag.compare(0, 3, "W/\"") != 0) {
+		printf("FAILED: streamed reply has no weak ETag: '%s'\n", etag.c_str());
+		exit(1);
+	}
+
+	reply = request(api, "/facts", "machine", etag);
+	expect(reply, WebReply::HTTP_NOT_MODIFIED, 1, "unchanged poll");
+	if (header(reply.get(), "ETag") != etag) {
+		printf("FAILED: 304 reply ETag '%s' (expected '%s')\n",
+		       header(reply.get(), "ETag").c_str(),
+		       etag.c_str());
+		exit(1);
+	}
+
+	reply = request(api, "/facts", "order", etag);
+	expect(reply, WebReply::HTTP_OK, 2, "other query");
+
+	revision += 1;
+	reply = request(api, "/facts", "machine", etag);
+	expect(reply, WebReply::HTTP_OK, 3, "changed revision");
+	if (header(reply.get(), "ETag") == etag) {
+		printf("FAILED: ETag did not change with the revision\n");
+		exit(1);
+	}
+
+	return 0;
+}
+
+/// @endcond
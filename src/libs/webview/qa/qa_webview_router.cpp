@@ -0,0 +1,142 @@
+
+/***************************************************************************
+ *  qa_webview_router.cpp - Webview router benchmark
+ *
+ *  Created: Mon Oct 19 14:05:37 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  Read the full text in the LICENSE.GPL file in the doc directory.
+ */
+
+/// @cond QA
+
+#include <webview/router.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace fawkes;
+
+static void
+expect(WebviewRouter<int> &              router,
+       WebRequest::Method                method,
+       const std::string &               url,
+       int                               handler,
+       const std::string &               arg   = "",
+       const std::string &               value = "")
+{
+	std::map<std::string, std::string> args;
+	int                                h = -1;
+	try {
+		h = router.find_handler(method, url, args);
+	} catch (NullPointerException &e) {
+	}
+	if (h != handler || (!arg.empty() && args[arg] != value)) {
+		printf("FAILED: %s -> %i (expected %i), %s='%s' (expected '%s')\n",
+		       url.c_str(),
+		       h,
+		       handler,
+		       arg.c_str(),
+		       args[arg].c_str(),
+		       value.c_str());
+		exit(1);
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	unsigned int num_apis    = (argc > 1) ? atoi(argv[1]) : 40;
+	unsigned int num_lookups = (argc > 2) ? atoi(argv[2]) : 1000000;
+
+	WebviewRouter<int> router;
+
+	// catch-all with lowest priority, like the REST request processor
+	router.add(WebRequest::METHOD_GET, "/api/{rest_url*}", 0, 10);
+	router.add(WebRequest::METHOD_GET, "/static/{file+}", 1);
+
+	std::vector<std::string> urls;
+	int                      handler = 100;
+	for (unsigned int i = 0; i < num_apis; ++i) {
+		std::string base = "/api/component" + std::to_string(i);
+		router.add(WebRequest::METHOD_GET, base + "/version", handler++);
+		router.add(WebRequest::METHOD_GET, base + "/facts", handler++);
+		router.add(WebRequest::METHOD_GET, base + "/facts/{tmpl-name}", handler++);
+		router.add(WebRequest::METHOD_GET, base + "/machines/{name}/state", handler++);
+		router.add(WebRequest::METHOD_GET, base + "/machines/{name}/slots/{slot}", handler++);
+		router.add(WebRequest::METHOD_PUT, base + "/machines/{name}", handler++);
+		router.add(WebRequest::METHOD_GET, base + "/files/{path+}", handler++);
+		router.add(WebRequest::METHOD_DELETE, base + "/items/{id}", handler++);
+
+		urls.push_back(base + "/version");
+		urls.push_back(base + "/facts/order");
+		urls.push_back(base + "/machines/C-CS1/state");
+		urls.push_back(base + "/machines/C-RS2/slots/3");
+		urls.push_back(base + "/files/js/app/main.js");
+		urls.push_back(base + "/unknown/endpoint");
+	}
+	printf("Registered %zu routes\n", (size_t)(handler - 100 + 2));
+
+	// sanity checks for matching semantics and priorities
+	expect(router, WebRequest::METHOD_GET, "/api/component0/version", 100);
+	expect(router, WebRequest::METHOD_GET, "/api/component0/facts/order", 102, "tmpl-name", "order");
+	expect(router, WebRequest::METHOD_GET, "/api/component1/machines/C-CS1/slots/2", 112, "slot", "2");
+	expect(router, WebRequest::METHOD_GET, "/api/component0/files/a/b.js", 106, "path", "a/b.js");
+	expect(router, WebRequest::METHOD_GET, "/api/component0/facts/", 0, "rest_url", "component0/facts/");
+	expect(router, WebRequest::METHOD_GET, "/api/", 0, "rest_url", "");
+	expect(router, WebRequest::METHOD_GET, "/api", -1);
+	expect(router, WebRequest::METHOD_GET, "/static/", -1);
+	expect(router, WebRequest::METHOD_GET, "/static/css/x.css", 1, "file", "css/x.css");
+	expect(router, WebRequest::METHOD_POST, "/api/component0/version", -1);
+	// wildcards followed by more segments, "+" is lazy and "*" greedy
+	router.add(WebRequest::METHOD_GET, "/lazy/{a+}/x/{b+}", 2);
+	router.add(WebRequest::METHOD_GET, "/greedy/{a*}/x/{b}", 3);
+	expect(router, WebRequest::METHOD_GET, "/lazy/p/x/q/x/r", 2, "a", "p");
+	expect(router, WebRequest::METHOD_GET, "/lazy/p/x/q/x/r", 2, "b", "q/x/r");
+	expect(router, WebRequest::METHOD_GET, "/greedy/p/x/q/x/r", 3, "a", "p/x/q");
+	expect(router, WebRequest::METHOD_GET, "/greedy/p/x/q/x/r", 3, "b", "r");
+	expect(router, WebRequest::METHOD_GET, "/greedy/x/x/x/r", 3, "a", "x/x");
+	router.add(WebRequest::METHOD_GET, "/api/component0/version", 42, -1);
+	expect(router, WebRequest::METHOD_GET, "/api/component0/version", 42);
+	router.remove(WebRequest::METHOD_GET, "/api/component0/version");
+	expect(router, WebRequest::METHOD_GET, "/api/component0/version", 100);
+
+	std::map<std::string, std::string> args;
+	size_t                             found = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < num_lookups; ++i) {
+		args.clear();
+		try {
+			found += router.find_handler(WebRequest::METHOD_GET, urls[i % urls.size()], args);
+		} catch (NullPointerException &e) {
+		}
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	double total_ms = std::chrono::duration<double, std::milli>(end - start).count();
+	printf("%u lookups over %zu URLs in %.1f ms (%.0f ns/lookup, checksum %zu)\n",
+	       num_lookups,
+	       urls.size(),
+	       total_ms,
+	       total_ms * 1e6 / num_lookups,
+	       found);
+
+	return 0;
+}
+
+/// @endcond
@@ -175,14 +175,19 @@ WebReply::set_request(WebRequest *request)
 }
 
 /** Called just before the reply is sent.
- * Sets no-caching flags if caching has been disabled. 
+ * Sets no-caching flags if caching has been disabled. If the reply carries
+ * an entity tag, clients may still store it but must revalidate it.
  */
 void
 WebReply::pack_caching()
 {
 	if (!caching_) {
 		// Headers to disable caching
-		headers_["Cache-Control"] = "no-cache, no-store, must-revalidate, max-age=0";
+		if (headers_.find("ETag") != headers_.end()) {
+			headers_["Cache-Control"] = "no-cache, must-revalidate, max-age=0";
+		} else {
+			headers_["Cache-Control"] = "no-cache, no-store, must-revalidate, max-age=0";
+		}
 	}
 }
 
@@ -310,4 +315,48 @@ StaticWebReply::pack()
 {
 }
 
+/** @class SharedStaticWebReply <webview/reply.h>
+ * Static web reply with a shared, immutable body.
+ * The body is reference counted and handed to libmicrohttpd without copying
+ * it, which makes it possible to send the same pre-rendered document to many
+ * clients, e.g., from a response cache. The body cannot be appended to.
+ * @author agent
+ */
+
+/** Constructor.
+ * @param code HTTP response code
+ * @param body shared body, the pointer may be empty for an empty reply
+ */
+SharedStaticWebReply::SharedStaticWebReply(Code code, std::shared_ptr<const std::string> body)
+: StaticWebReply(code), shared_body_(std::move(body))
+{
+}
+
+/** Get body.
+ * @return reference to shared body.
+ */
+const std::string &
+SharedStaticWebReply::body()
+{
+	return shared_body_ ? *shared_body_ : _body;
+}
+
+/** Get length of body.
+ * @return body length
+ */
+std::string::size_type
+SharedStaticWebReply::body_length()
+{
+	return shared_body_ ? shared_body_->length() : _body.length();
+}
+
+/** Get shared body.
+ * @return reference-counted body, may be empty
+ */
+std::shared_ptr<const std::string>
+SharedStaticWebReply::shared_body() const
+{
+	return shared_body_;
+}
+
 } // end namespace fawkes
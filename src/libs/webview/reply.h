@@ -24,6 +24,7 @@
 #define _LIBS_WEBVIEW_REPLY_H_
 
 #include <map>
+#include <memory>
 #include <string>
 
 namespace fawkes {
@@ -151,6 +152,20 @@ protected:
 	std::string _body;
 };
 
+class SharedStaticWebReply : public StaticWebReply
+{
+public:
+	SharedStaticWebReply(Code code, std::shared_ptr<const std::string> body);
+
+	virtual const std::string &    body();
+	virtual std::string::size_type body_length();
+
+	std::shared_ptr<const std::string> shared_body() const;
+
+private:
+	std::shared_ptr<const std::string> shared_body_;
+};
+
 extern WebReply *no_caching(WebReply *reply);
 
 } // end namespace fawkes
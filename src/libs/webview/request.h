@@ -280,6 +280,16 @@ public:
 		get_values_[key] = value;
 	}
 
+	/** Set the HTTP transfer method.
+	 * The method is usually determined when setting up the request.
+	 * @param method HTTP transfer method
+	 */
+	void
+	set_method(Method method)
+	{
+		method_ = method;
+	}
+
 	/** Set a header value.
    * @param key key of the cookie
    * @param value value of the header argument
@@ -224,6 +224,17 @@ dynamic_reply_free_cb(void *reply)
 	delete dreply;
 }
 
+#if MHD_VERSION >= 0x00097202
+/** Callback to release a shared reply body.
+ * @param holder heap-allocated shared pointer that kept the body alive
+ */
+static void
+shared_body_free_cb(void *holder)
+{
+	delete static_cast<std::shared_ptr<const std::string> *>(holder);
+}
+#endif
+
 /** Prepare response from static reply.
  * @param sreply static reply
  * @return response struct ready to be enqueued
@@ -239,7 +250,19 @@ WebRequestDispatcher::prepare_static_response(StaticWebReply *sreply)
 		sreply->pack_caching();
 		sreply->pack();
 	}
-	if (sreply->body_length() > 0) {
+	SharedStaticWebReply *shreply = dynamic_cast<SharedStaticWebReply *>(sreply);
+	if (shreply && shreply->body_length() > 0) {
+#if MHD_VERSION >= 0x00097202
+		// keep the body alive until libmicrohttpd is done with it, no copy
+		auto holder = new std::shared_ptr<const std::string>(shreply->shared_body());
+		response    = MHD_create_response_from_buffer_with_free_callback_cls(
+		  (*holder)->length(), (void *)(*holder)->data(), shared_body_free_cb, holder);
+#else
+		response = MHD_create_response_from_buffer(shreply->body_length(),
+		                                           (void *)shreply->body().c_str(),
+		                                           MHD_RESPMEM_MUST_COPY);
+#endif
+	} else if (sreply->body_length() > 0) {
 		response = MHD_create_response_from_buffer(sreply->body_length(),
 		                                           (void *)sreply->body().c_str(),
 		                                           MHD_RESPMEM_MUST_COPY);
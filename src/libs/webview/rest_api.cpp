@@ -21,13 +21,112 @@
  */
 
 #include <core/exception.h>
+#include <core/threading/mutex_locker.h>
 #include <webview/rest_api.h>
 #include <webview/router.h>
 
+#include <cstdio>
+
 using namespace llsfrb;
 
 namespace fawkes {
 
+/// Maximum number of cached responses per revision and API
+#define REST_CACHE_MAX_ENTRIES 256
+
+/** Compute the FNV-1a hash of a string.
+ * @param s string to hash
+ * @return 64 bit hash value
+ */
+static uint64_t
+fnv1a(const std::string &s)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for (const char c : s) {
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+/** Compute a strong entity tag for a reply body.
+ * @param body body to compute tag for
+ * @return quoted entity tag based on the body's length and FNV-1a hash
+ */
+static std::string
+compute_etag(const std::string &body)
+{
+	char tmp[48];
+	snprintf(tmp,
+	         sizeof(tmp),
+	         "\"%zx-%016llx\"",
+	         body.length(),
+	         static_cast<unsigned long long>(fnv1a(body)));
+	return tmp;
+}
+
+/** Compute a weak entity tag for a streamed reply.
+ * Streamed replies are not rendered in advance, hence the tag cannot be
+ * based on the body. It is based on the data revision and on the request,
+ * which together determine the body.
+ * @param revision data revision the reply is created for
+ * @param cache_key request URL with normalized query arguments
+ * @return quoted entity tag, without the W/ weakness indicator
+ */
+static std::string
+compute_weak_etag(uint64_t revision, const std::string &cache_key)
+{
+	char tmp[48];
+	snprintf(tmp,
+	         sizeof(tmp),
+	         "\"%llx-%016llx\"",
+	         static_cast<unsigned long long>(revision),
+	         static_cast<unsigned long long>(fnv1a(cache_key)));
+	return tmp;
+}
+
+/** Check if an If-None-Match header matches an entity tag.
+ * Uses the weak comparison mandated for If-None-Match by RFC 7232.
+ * @param if_none_match value of the If-None-Match header
+ * @param etag entity tag of the current representation
+ * @return true if the client's copy is still valid, false otherwise
+ */
+static bool
+etag_matches(const std::string &if_none_match, const std::string &etag)
+{
+	for (std::string tag : str_split(if_none_match, ',')) {
+		tag.erase(0, tag.find_first_not_of(" \t"));
+		tag.erase(tag.find_last_not_of(" \t") + 1);
+		if (tag == "*") {
+			return true;
+		}
+		if (tag.compare(0, 2, "W/") == 0) {
+			tag.erase(0, 2);
+		}
+		if (tag == etag) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/** Check if the If-None-Match header of a request matches an entity tag.
+ * @param request incoming request
+ * @param etag entity tag of the current representation
+ * @return true if the client's copy is still valid, false otherwise
+ */
+static bool
+if_none_match(const WebRequest *request, const std::string &etag)
+{
+	const std::map<std::string, std::string> &headers = request->headers();
+
+	auto inm = headers.find("If-None-Match");
+	if (inm == headers.end()) {
+		inm = headers.find("if-none-match");
+	}
+	return inm != headers.end() && etag_matches(inm->second, etag);
+}
+
 /** @class WebviewRestApi <webview/rest_api.h>
  * Webview REST API component.
  * This class represents a specific REST API available through Webview.
@@ -45,7 +144,8 @@ WebviewRestApi::WebviewRestApi(const std::string &name, llsfrb::Logger *logger)
 : name_(name),
   logger_(logger),
   pretty_json_(false),
-  router_{std::make_shared<WebviewRouter<Handler>>()}
+  router_{std::make_shared<WebviewRouter<Handler>>()},
+  cache_revision_(0)
 {
 }
 
@@ -68,17 +168,99 @@ WebviewRestApi::process_request(const WebRequest *request, const std::string &re
 {
 	try {
 		std::map<std::string, std::string> path_args;
-		Handler           handler = router_->find_handler(request->method(), rest_url, path_args);
+		Handler handler = router_->find_handler(request->method(), rest_url, path_args);
+
+		bool        cacheable = (request->method() == WebRequest::METHOD_GET);
+		bool        use_cache = cacheable && revision_provider_;
+		uint64_t    revision  = 0;
+		std::string cache_key;
+		std::string weak_etag;
+		if (use_cache) {
+			revision  = revision_provider_();
+			cache_key = rest_url;
+			char sep  = '?';
+			for (const auto &q : request->get_values()) {
+				cache_key += sep + q.first + "=" + q.second;
+				sep = '&';
+			}
+			weak_etag = compute_weak_etag(revision, cache_key);
+			if (if_none_match(request, weak_etag)) {
+				// the client's copy of a streamed reply is still current
+				StaticWebReply *reply = new StaticWebReply(WebReply::HTTP_NOT_MODIFIED);
+				reply->add_header("ETag", "W/" + weak_etag);
+				return reply;
+			}
+			MutexLocker lock(&cache_mutex_);
+			if (revision == cache_revision_) {
+				auto c = cache_.find(cache_key);
+				if (c != cache_.end()) {
+					std::shared_ptr<const CacheEntry> entry = c->second;
+					lock.unlock();
+					return cached_reply(request, *entry);
+				}
+			}
+		}
+
 		WebviewRestParams params;
 		params.set_path_args(std::move(path_args));
 		params.set_query_args(request->get_values());
 		std::unique_ptr<WebReply> reply = handler(request->body(), params);
+
+		StaticWebReply *sreply = dynamic_cast<StaticWebReply *>(reply.get());
+		if (cacheable && sreply && sreply->code() == WebReply::HTTP_OK
+		    && !dynamic_cast<SharedStaticWebReply *>(sreply)) {
+			sreply->pack();
+			auto entry     = std::make_shared<CacheEntry>();
+			entry->body    = std::make_shared<const std::string>(sreply->body());
+			entry->etag    = compute_etag(*entry->body);
+			entry->headers = sreply->headers();
+			if (use_cache) {
+				// the revision was read before running the handler, hence the
+				// stored body is at least as recent as the revision it is stored for
+				MutexLocker lock(&cache_mutex_);
+				if (revision != cache_revision_ || cache_.size() >= REST_CACHE_MAX_ENTRIES) {
+					cache_.clear();
+					cache_revision_ = revision;
+				}
+				cache_[cache_key] = entry;
+			}
+			return cached_reply(request, *entry);
+		}
+		if (use_cache && reply->code() == WebReply::HTTP_OK
+		    && dynamic_cast<DynamicWebReply *>(reply.get())) {
+			reply->add_header("ETag", "W/" + weak_etag);
+		}
 		return reply.release();
 	} catch (NullPointerException &e) {
 		return NULL;
 	}
 }
 
+/** Create a reply for a cached response.
+ * If the request carries an If-None-Match header matching the entity tag
+ * of the cached response a body-less 304 Not Modified reply is created.
+ * Otherwise, the shared body is passed on without copying it.
+ * @param request incoming request
+ * @param entry cached response
+ * @return reply
+ */
+WebReply *
+WebviewRestApi::cached_reply(const WebRequest *request, const CacheEntry &entry) const
+{
+	if (if_none_match(request, entry.etag)) {
+		StaticWebReply *reply = new StaticWebReply(WebReply::HTTP_NOT_MODIFIED);
+		reply->add_header("ETag", entry.etag);
+		return reply;
+	}
+
+	SharedStaticWebReply *reply = new SharedStaticWebReply(WebReply::HTTP_OK, entry.body);
+	for (const auto &h : entry.headers) {
+		reply->add_header(h.first, h.second);
+	}
+	reply->add_header("ETag", entry.etag);
+	return reply;
+}
+
 /** Add handler function.
  * @param method HTTP method to react to
  * @param path path (after component base path) to react to
@@ -99,4 +281,23 @@ WebviewRestApi::set_pretty_json(bool pretty)
 	pretty_json_ = pretty;
 }
 
+/** Enable the response cache.
+ * GET responses are then cached per route and query arguments as long as
+ * the revision returned by the provider does not change. The provider must
+ * return a new value whenever the data served by the API may have changed.
+ * Independent of the cache, successful GET responses carry a strong ETag
+ * and conditional requests are answered with 304 Not Modified. Streamed
+ * replies are neither rendered in advance nor cached. They carry a weak
+ * ETag built from the revision and the query, a matching conditional
+ * request is answered with 304 Not Modified without running the handler.
+ * @param provider revision provider, pass an empty function to disable
+ */
+void
+WebviewRestApi::set_cache_revision_provider(RevisionProvider provider)
+{
+	MutexLocker lock(&cache_mutex_);
+	revision_provider_ = std::move(provider);
+	cache_.clear();
+}
+
 } // end of namespace fawkes
@@ -24,12 +24,14 @@
 #define _LIBS_WEBVIEW_REST_API_H_
 
 #include <core/exception.h>
+#include <core/threading/mutex.h>
 #include <logging/logger.h>
 #include <utils/misc/string_split.h>
 #include <webview/reply.h>
 #include <webview/request.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -247,9 +249,13 @@ public:
 	/** REST API call handler function type. */
 	typedef std::function<std::unique_ptr<WebReply>(std::string, WebviewRestParams &)> Handler;
 
+	/** Revision provider function type for the response cache. */
+	typedef std::function<uint64_t()> RevisionProvider;
+
 	const std::string &name() const;
 	void               add_handler(WebRequest::Method method, std::string path, Handler handler);
 	void               set_pretty_json(bool pretty);
+	void               set_cache_revision_provider(RevisionProvider provider);
 
 	/** Add simple handler.
 	 * For a handler that does not require input parameters and that outputs
@@ -404,11 +410,28 @@ public:
 
 	WebReply *process_request(const WebRequest *request, const std::string &rest_url);
 
+private:
+	/// @cond INTERNALS
+	struct CacheEntry
+	{
+		std::shared_ptr<const std::string> body;
+		std::string                        etag;
+		WebReply::HeaderMap                headers;
+	};
+	/// @endcond
+
+	WebReply *cached_reply(const WebRequest *request, const CacheEntry &entry) const;
+
 private:
 	std::string                             name_;
 	llsfrb::Logger *                        logger_;
 	bool                                    pretty_json_;
 	std::shared_ptr<WebviewRouter<Handler>> router_;
+
+	RevisionProvider                                          revision_provider_;
+	fawkes::Mutex                                             cache_mutex_;
+	uint64_t                                                  cache_revision_;
+	std::map<std::string, std::shared_ptr<const CacheEntry>> cache_;
 };
 
 } // namespace fawkes
@@ -26,10 +26,13 @@
 #include <webview/request.h>
 
 #include <algorithm>
+#include <limits>
 #include <list>
 #include <map>
-#include <regex>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace fawkes {
 
@@ -37,6 +40,15 @@ namespace fawkes {
  * Register URL path patterns and some handler or item. Then match it
  * later to request URLs to retrieve this very handler or item if the
  * pattern matches the URL.
+ *
+ * Patterns are compiled into a trie of path segments per HTTP method.
+ * A segment is either static, a parameter "{var}" matching exactly one
+ * non-empty segment, or a wildcard "{var+}" or "{var*}" matching one or
+ * more segments. Matching walks the trie without regular expressions.
+ * If a wildcard is followed by more segments, "{var+}" captures as few
+ * and "{var*}" as many segments as possible.
+ * If multiple patterns match an URL, the one with the lowest weight wins,
+ * and among equal weights the one added first.
  * @author Tim Niemueller
  */
 template <typename T>
@@ -53,16 +65,7 @@ public:
 	T &
 	find_handler(const WebRequest *request, std::map<std::string, std::string> &path_args)
 	{
-		auto ri =
-		  std::find_if(routes_.begin(), routes_.end(), [this, &path_args, request](auto &r) -> bool {
-			  //printf("Comparing %s to %s\n", request->url().c_str(), std::get<2>(r).c_str());
-			  return (std::get<1>(r) == request->method()
-			          && this->path_match(request->url(), std::get<3>(r), path_args));
-		  });
-		if (ri == routes_.end()) {
-			throw NullPointerException("No handler found");
-		}
-		return std::get<4>(*ri);
+		return find_handler(request->method(), request->url(), path_args);
 	}
 
 	/** Find a handler.
@@ -78,14 +81,29 @@ public:
 	             const std::string &                 path,
 	             std::map<std::string, std::string> &path_args)
 	{
-		auto ri = std::find_if(
-		  routes_.begin(), routes_.end(), [this, &path_args, &method, &path](auto &r) -> bool {
-			  return (std::get<1>(r) == method && this->path_match(path, std::get<3>(r), path_args));
-		  });
-		if (ri == routes_.end()) {
+		auto t = tries_.find(method);
+		if (t == tries_.end() || path.empty() || path[0] != '/') {
+			throw NullPointerException("No handler found");
+		}
+
+		std::vector<std::string> segments = split_path(path);
+		std::vector<Capture>     captures;
+		std::vector<Capture>     best_captures;
+		size_t                   best = std::numeric_limits<size_t>::max();
+		match(t->second.get(), segments, 0, captures, best, best_captures);
+		if (best == std::numeric_limits<size_t>::max()) {
 			throw NullPointerException("No handler found");
 		}
-		return std::get<4>(*ri);
+
+		Route *route = ranked_[best];
+		for (size_t i = 0; i < route->arg_names.size(); ++i) {
+			std::string value = segments[best_captures[i].begin];
+			for (size_t s = best_captures[i].begin + 1; s < best_captures[i].end; ++s) {
+				value += "/" + segments[s];
+			}
+			path_args[route->arg_names[i]] = value;
+		}
+		return route->handler;
 	}
 
 	/** Add a handler with weight.
@@ -93,8 +111,9 @@ public:
 	 * @param path path pattern. A pattern may contain "{var}" segments
 	 * for a URL. These will match an element of the path, i.e., a string not
 	 * containing a slash. If a pattern has the form {var+} then it may contain
-	 * a slash and therefore match multiple path segments. The handler would
-	 * receive an entry named "var" in the parameters path arguments.
+	 * a slash and therefore match multiple path segments, {var*} may in
+	 * addition be empty. The handler would receive an entry named "var" in
+	 * the parameters path arguments. Variables must span a whole segment.
 	 * @param handler handler to store
 	 * @param weight higher weight means the handler is tried later by
 	 * the router. The default is 0.
@@ -102,16 +121,24 @@ public:
 	void
 	add(WebRequest::Method method, const std::string &path, T handler, int weight)
 	{
-		auto ri =
-		  std::find_if(routes_.begin(), routes_.end(), [method, &path, &weight](auto &r) -> bool {
-			  return (std::get<0>(r) == weight && std::get<1>(r) == method && std::get<2>(r) == path);
-		  });
+		auto ri = std::find_if(routes_.begin(), routes_.end(), [method, &path, &weight](auto &r) {
+			return (r.weight == weight && r.method == method && r.path == path);
+		});
 		if (ri != routes_.end()) {
 			throw Exception("URL handler already registered for %s", path.c_str());
 		}
-		routes_.push_back(std::make_tuple(weight, method, path, gen_regex(path), handler));
-		routes_.sort(
-		  [](const auto &a, const auto &b) -> bool { return (std::get<0>(a) < std::get<0>(b)); });
+		Route route{weight, method, path, parse_path(path), {}, handler};
+		for (const auto &s : route.segments) {
+			if (s.first != SEGMENT_STATIC) {
+				route.arg_names.push_back(s.second);
+			}
+		}
+		// insert after all routes of lower or equal weight, i.e., keep order of addition
+		auto pos = std::find_if(routes_.begin(), routes_.end(), [weight](auto &r) {
+			return r.weight > weight;
+		});
+		routes_.insert(pos, std::move(route));
+		compile();
 	}
 
 	/** Add a handler.
@@ -136,23 +163,74 @@ public:
 	void
 	remove(WebRequest::Method method, const std::string &path)
 	{
-		auto ri = std::find_if(routes_.begin(), routes_.end(), [method, &path](auto &r) -> bool {
-			return (std::get<1>(r) == method && std::get<2>(r) == path);
+		auto ri = std::find_if(routes_.begin(), routes_.end(), [method, &path](auto &r) {
+			return (r.method == method && r.path == path);
 		});
 		if (ri != routes_.end()) {
 			routes_.erase(ri);
+			compile();
 		}
 	}
 
 private:
-	typedef std::pair<std::regex, std::vector<std::string>> path_regex;
+	/// @cond INTERNALS
+	typedef enum {
+		SEGMENT_STATIC,
+		SEGMENT_PARAM,
+		SEGMENT_WILDCARD_STAR,
+		SEGMENT_WILDCARD_PLUS
+	} SegmentKind;
+
+	typedef std::vector<std::pair<SegmentKind, std::string>> Segments;
+
+	struct Route
+	{
+		int                      weight;
+		WebRequest::Method       method;
+		std::string              path;
+		Segments                 segments;
+		std::vector<std::string> arg_names;
+		T                        handler;
+	};
+
+	struct Node
+	{
+		std::unordered_map<std::string, std::unique_ptr<Node>> statics;
+		std::unique_ptr<Node>                                  param;
+		std::unique_ptr<Node>                                  wildcard_star;
+		std::unique_ptr<Node>                                  wildcard_plus;
+		// rank of the first route ending in this node
+		size_t end_rank = std::numeric_limits<size_t>::max();
+		// lowest rank of any route ending in this node or below
+		size_t min_rank = std::numeric_limits<size_t>::max();
+	};
+
+	struct Capture
+	{
+		size_t begin;
+		size_t end;
+	};
+	/// @endcond
 
-	std::pair<std::regex, std::vector<std::string>>
-	gen_regex(const std::string &path)
+	static std::vector<std::string>
+	split_path(const std::string &path)
+	{
+		std::vector<std::string> segments;
+		std::string::size_type   begin = 1, end;
+		while ((end = path.find('/', begin)) != std::string::npos) {
+			segments.push_back(path.substr(begin, end - begin));
+			begin = end + 1;
+		}
+		segments.push_back(path.substr(begin));
+		return segments;
+	}
+
+	static Segments
+	parse_path(const std::string &path)
 	{
 		std::string::size_type pos = 0;
 
-		if (path[0] != '/') {
+		if (path.empty() || path[0] != '/') {
 			throw Exception("Path '%s' must start with /", path.c_str());
 		}
 		if ((pos = path.find_first_of("[]()^$")) != std::string::npos) {
@@ -162,73 +240,127 @@ private:
 			                path.c_str());
 		}
 
-		std::regex  to_re("\\{([^+*\\}]+?)[+*]?\\}");
-		std::string m_path = path;
-		// escape special characters for regex
-		pos = 0;
-		while ((pos = m_path.find_first_of(".", pos)) != std::string::npos) {
-			m_path.replace(pos, 1, "\\.");
-			pos += 2;
-		}
-		pos = 0;
-		while ((pos = m_path.find_first_of("+*", pos)) != std::string::npos) {
-			if (pos < m_path.length() - 1 && m_path[pos + 1] != '}') {
-				m_path.replace(pos, 1, std::string("\\") + m_path[pos]);
-				pos += 2;
-			} else {
-				pos += 1;
+		Segments segments;
+		for (const std::string &s : split_path(path)) {
+			if (s.find_first_of("{}") == std::string::npos) {
+				segments.push_back(std::make_pair(SEGMENT_STATIC, s));
+				continue;
 			}
-		}
-		std::string              re_url;
-		std::smatch              match;
-		std::vector<std::string> match_indexes;
-		while (regex_search(m_path, match, to_re)) {
-			std::string full_match = match[0];
-			re_url += match.prefix();
-			if (full_match[full_match.length() - 2] == '+') {
-				re_url += "(.+?)";
-			} else if (full_match[full_match.length() - 2] == '*') {
-				re_url += "(.*)";
-			} else {
-				re_url += "([^/]+?)";
+			if (s.length() < 3 || s.front() != '{' || s.back() != '}') {
+				throw Exception("Variable in '%s' must span a whole path segment", path.c_str());
+			}
+			std::string name = s.substr(1, s.length() - 2);
+			SegmentKind kind = SEGMENT_PARAM;
+			if (name.back() == '+') {
+				kind = SEGMENT_WILDCARD_PLUS;
+				name.pop_back();
+			} else if (name.back() == '*') {
+				kind = SEGMENT_WILDCARD_STAR;
+				name.pop_back();
 			}
-			match_indexes.push_back(match[1]);
-			m_path = match.suffix();
+			if (name.empty() || name.find_first_of("{}+*") != std::string::npos) {
+				throw Exception("Invalid variable '%s' in '%s'", s.c_str(), path.c_str());
+			}
+			segments.push_back(std::make_pair(kind, name));
 		}
-		re_url += m_path;
-		//printf("Regex: %s -> %s\n", path.c_str(), re_url.c_str());
+		return segments;
+	}
+
+	void
+	compile()
+	{
+		tries_.clear();
+		ranked_.clear();
+		for (auto &r : routes_) {
+			size_t rank = ranked_.size();
+			ranked_.push_back(&r);
 
-		return std::make_pair(std::regex(re_url), match_indexes);
+			std::unique_ptr<Node> &root = tries_[r.method];
+			if (!root) {
+				root = std::make_unique<Node>();
+			}
+			Node *n = root.get();
+			for (const auto &s : r.segments) {
+				n->min_rank                 = std::min(n->min_rank, rank);
+				std::unique_ptr<Node> *next = nullptr;
+				switch (s.first) {
+				case SEGMENT_STATIC: next = &n->statics[s.second]; break;
+				case SEGMENT_PARAM: next = &n->param; break;
+				case SEGMENT_WILDCARD_STAR: next = &n->wildcard_star; break;
+				case SEGMENT_WILDCARD_PLUS: next = &n->wildcard_plus; break;
+				}
+				if (!*next) {
+					*next = std::make_unique<Node>();
+				}
+				n = next->get();
+			}
+			n->min_rank = std::min(n->min_rank, rank);
+			n->end_rank = std::min(n->end_rank, rank);
+		}
 	}
 
-	/** Check if an actual path matches an API path pattern.
-	 * @param url requested
-	 * @param api_path configured API path to check
-	 * @param params object to set argument mappings
-	 * @return true if the path cold be matched, false otherwise.
+	/** Recursively match path segments against the trie.
+	 * @param n node to match from
+	 * @param segments path segments of the URL
+	 * @param i index of the next segment to match
+	 * @param captures captures of the variables on the current trie path
+	 * @param best rank of the best route found so far, updated on a better match
+	 * @param best_captures captures of the best match
 	 */
-	bool
-	path_match(const std::string &                 url,
-	           const path_regex &                  path_re,
-	           std::map<std::string, std::string> &path_args)
+	void
+	match(const Node *                    n,
+	      const std::vector<std::string> &segments,
+	      size_t                          i,
+	      std::vector<Capture> &          captures,
+	      size_t &                        best,
+	      std::vector<Capture> &          best_captures) const
 	{
-		std::smatch matches;
-		if (std::regex_match(url, matches, path_re.first)) {
-			if (matches.size() != path_re.second.size() + 1) {
-				return false;
+		if (n->min_rank >= best) {
+			return;
+		}
+		if (i == segments.size()) {
+			if (n->end_rank < best) {
+				best          = n->end_rank;
+				best_captures = captures;
 			}
-			for (size_t i = 0; i < path_re.second.size(); ++i) {
-				//printf("arg %s = %s\n", path_re.second[i].c_str(), matches[i+1].str().c_str());
-				path_args[path_re.second[i]] = matches[i + 1].str();
+			return;
+		}
+
+		auto s = n->statics.find(segments[i]);
+		if (s != n->statics.end()) {
+			match(s->second.get(), segments, i + 1, captures, best, best_captures);
+		}
+		if (n->param && !segments[i].empty()) {
+			captures.push_back(Capture{i, i + 1});
+			match(n->param.get(), segments, i + 1, captures, best, best_captures);
+			captures.pop_back();
+		}
+		// among matches of the same route the first one found is kept, hence
+		// "{var+}" tries as few segments as possible first and "{var*}" as
+		// many as possible, like the regular expressions (.+?) and (.*)
+		if (n->wildcard_plus) {
+			for (size_t e = i + 1; e <= segments.size(); ++e) {
+				if (e == i + 1 && segments[i].empty()) {
+					continue;
+				}
+				captures.push_back(Capture{i, e});
+				match(n->wildcard_plus.get(), segments, e, captures, best, best_captures);
+				captures.pop_back();
+			}
+		}
+		if (n->wildcard_star) {
+			for (size_t e = segments.size(); e > i; --e) {
+				captures.push_back(Capture{i, e});
+				match(n->wildcard_star.get(), segments, e, captures, best, best_captures);
+				captures.pop_back();
 			}
-			return true;
-		} else {
-			return false;
 		}
 	}
 
 private:
-	std::list<std::tuple<int, WebRequest::Method, std::string, path_regex, T>> routes_;
+	std::list<Route>                                    routes_;
+	std::vector<Route *>                                ranked_;
+	std::map<WebRequest::Method, std::unique_ptr<Node>> tries_;
 };
 
 } // end of namespace fawkes
@@ -0,0 +1,432 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: AttentionMessage.proto
+
+#include "AttentionMessage.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR AttentionMessage::AttentionMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_to_show_)*/0
+  , /*decltype(_impl_.team_color_)*/0} {}
+struct AttentionMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AttentionMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AttentionMessageDefaultTypeInternal() {}
+  union {
+    AttentionMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AttentionMessageDefaultTypeInternal _AttentionMessage_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_AttentionMessage_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_AttentionMessage_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_AttentionMessage_2eproto = nullptr;
+
+const uint32_t TableStruct_AttentionMessage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::AttentionMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::AttentionMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::AttentionMessage, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::AttentionMessage, _impl_.time_to_show_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::AttentionMessage, _impl_.team_color_),
+  0,
+  1,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::llsf_msgs::AttentionMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_AttentionMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_AttentionMessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026AttentionMessage.proto\022\tllsf_msgs\032\nTea"
+  "m.proto\"\206\001\n\020AttentionMessage\022\017\n\007message\030"
+  "\001 \002(\t\022\024\n\014time_to_show\030\002 \001(\002\022#\n\nteam_colo"
+  "r\030\003 \001(\0162\017.llsf_msgs.Team\"&\n\010CompType\022\014\n\007"
+  "COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020\002B9\n\037org.robocup_"
+  "logistics.llsf_msgsB\026AttentionMessagePro"
+  "tos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_AttentionMessage_2eproto_deps[1] = {
+  &::descriptor_table_Team_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_AttentionMessage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_AttentionMessage_2eproto = {
+    false, false, 243, descriptor_table_protodef_AttentionMessage_2eproto,
+    "AttentionMessage.proto",
+    &descriptor_table_AttentionMessage_2eproto_once, descriptor_table_AttentionMessage_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_AttentionMessage_2eproto::offsets,
+    file_level_metadata_AttentionMessage_2eproto, file_level_enum_descriptors_AttentionMessage_2eproto,
+    file_level_service_descriptors_AttentionMessage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_AttentionMessage_2eproto_getter() {
+  return &descriptor_table_AttentionMessage_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_AttentionMessage_2eproto(&descriptor_table_AttentionMessage_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* AttentionMessage_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_AttentionMessage_2eproto);
+  return file_level_enum_descriptors_AttentionMessage_2eproto[0];
+}
+bool AttentionMessage_CompType_IsValid(int value) {
+  switch (value) {
+    case 2:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr AttentionMessage_CompType AttentionMessage::COMP_ID;
+constexpr AttentionMessage_CompType AttentionMessage::MSG_TYPE;
+constexpr AttentionMessage_CompType AttentionMessage::CompType_MIN;
+constexpr AttentionMessage_CompType AttentionMessage::CompType_MAX;
+constexpr int AttentionMessage::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class AttentionMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<AttentionMessage>()._impl_._has_bits_);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_time_to_show(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+AttentionMessage::AttentionMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.AttentionMessage)
+}
+AttentionMessage::AttentionMessage(const AttentionMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AttentionMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.time_to_show_){}
+    , decltype(_impl_.team_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.time_to_show_, &from._impl_.time_to_show_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.team_color_) -
+    reinterpret_cast<char*>(&_impl_.time_to_show_)) + sizeof(_impl_.team_color_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.AttentionMessage)
+}
+
+inline void AttentionMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.time_to_show_){0}
+    , decltype(_impl_.team_color_){0}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AttentionMessage::~AttentionMessage() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.AttentionMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AttentionMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+}
+
+void AttentionMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AttentionMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.AttentionMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.message_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.time_to_show_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.team_color_) -
+        reinterpret_cast<char*>(&_impl_.time_to_show_)) + sizeof(_impl_.team_color_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AttentionMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.AttentionMessage.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float time_to_show = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_time_to_show(&has_bits);
+          _impl_.time_to_show_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Team team_color = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AttentionMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.AttentionMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.AttentionMessage.message");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_message(), target);
+  }
+
+  // optional float time_to_show = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_time_to_show(), target);
+  }
+
+  // optional .llsf_msgs.Team team_color = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_team_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.AttentionMessage)
+  return target;
+}
+
+size_t AttentionMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.AttentionMessage)
+  size_t total_size = 0;
+
+  // required string message = 1;
+  if (_internal_has_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional float time_to_show = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional .llsf_msgs.Team team_color = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AttentionMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AttentionMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AttentionMessage::GetClassData() const { return &_class_data_; }
+
+
+void AttentionMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AttentionMessage*>(&to_msg);
+  auto& from = static_cast<const AttentionMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.AttentionMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_message(from._internal_message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.time_to_show_ = from._impl_.time_to_show_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AttentionMessage::CopyFrom(const AttentionMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.AttentionMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AttentionMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void AttentionMessage::InternalSwap(AttentionMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AttentionMessage, _impl_.team_color_)
+      + sizeof(AttentionMessage::_impl_.team_color_)
+      - PROTOBUF_FIELD_OFFSET(AttentionMessage, _impl_.time_to_show_)>(
+          reinterpret_cast<char*>(&_impl_.time_to_show_),
+          reinterpret_cast<char*>(&other->_impl_.time_to_show_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AttentionMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_AttentionMessage_2eproto_getter, &descriptor_table_AttentionMessage_2eproto_once,
+      file_level_metadata_AttentionMessage_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::AttentionMessage*
+Arena::CreateMaybeMessage< ::llsf_msgs::AttentionMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::AttentionMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,464 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: AttentionMessage.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_AttentionMessage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_AttentionMessage_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Team.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_AttentionMessage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_AttentionMessage_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_AttentionMessage_2eproto;
+namespace llsf_msgs {
+class AttentionMessage;
+struct AttentionMessageDefaultTypeInternal;
+extern AttentionMessageDefaultTypeInternal _AttentionMessage_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::AttentionMessage* Arena::CreateMaybeMessage<::llsf_msgs::AttentionMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum AttentionMessage_CompType : int {
+  AttentionMessage_CompType_COMP_ID = 2000,
+  AttentionMessage_CompType_MSG_TYPE = 2
+};
+bool AttentionMessage_CompType_IsValid(int value);
+constexpr AttentionMessage_CompType AttentionMessage_CompType_CompType_MIN = AttentionMessage_CompType_MSG_TYPE;
+constexpr AttentionMessage_CompType AttentionMessage_CompType_CompType_MAX = AttentionMessage_CompType_COMP_ID;
+constexpr int AttentionMessage_CompType_CompType_ARRAYSIZE = AttentionMessage_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* AttentionMessage_CompType_descriptor();
+template<typename T>
+inline const std::string& AttentionMessage_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, AttentionMessage_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function AttentionMessage_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    AttentionMessage_CompType_descriptor(), enum_t_value);
+}
+inline bool AttentionMessage_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, AttentionMessage_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<AttentionMessage_CompType>(
+    AttentionMessage_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class AttentionMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.AttentionMessage) */ {
+ public:
+  inline AttentionMessage() : AttentionMessage(nullptr) {}
+  ~AttentionMessage() override;
+  explicit PROTOBUF_CONSTEXPR AttentionMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AttentionMessage(const AttentionMessage& from);
+  AttentionMessage(AttentionMessage&& from) noexcept
+    : AttentionMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline AttentionMessage& operator=(const AttentionMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AttentionMessage& operator=(AttentionMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AttentionMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AttentionMessage* internal_default_instance() {
+    return reinterpret_cast<const AttentionMessage*>(
+               &_AttentionMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(AttentionMessage& a, AttentionMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AttentionMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AttentionMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AttentionMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AttentionMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AttentionMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AttentionMessage& from) {
+    AttentionMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AttentionMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.AttentionMessage";
+  }
+  protected:
+  explicit AttentionMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef AttentionMessage_CompType CompType;
+  static constexpr CompType COMP_ID =
+    AttentionMessage_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    AttentionMessage_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return AttentionMessage_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    AttentionMessage_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    AttentionMessage_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    AttentionMessage_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return AttentionMessage_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return AttentionMessage_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return AttentionMessage_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+    kTimeToShowFieldNumber = 2,
+    kTeamColorFieldNumber = 3,
+  };
+  // required string message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // optional float time_to_show = 2;
+  bool has_time_to_show() const;
+  private:
+  bool _internal_has_time_to_show() const;
+  public:
+  void clear_time_to_show();
+  float time_to_show() const;
+  void set_time_to_show(float value);
+  private:
+  float _internal_time_to_show() const;
+  void _internal_set_time_to_show(float value);
+  public:
+
+  // optional .llsf_msgs.Team team_color = 3;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.AttentionMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    float time_to_show_;
+    int team_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_AttentionMessage_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// AttentionMessage
+
+// required string message = 1;
+inline bool AttentionMessage::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool AttentionMessage::has_message() const {
+  return _internal_has_message();
+}
+inline void AttentionMessage::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& AttentionMessage::message() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.AttentionMessage.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AttentionMessage::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.AttentionMessage.message)
+}
+inline std::string* AttentionMessage::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.AttentionMessage.message)
+  return _s;
+}
+inline const std::string& AttentionMessage::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void AttentionMessage::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AttentionMessage::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AttentionMessage::release_message() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.AttentionMessage.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void AttentionMessage::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.AttentionMessage.message)
+}
+
+// optional float time_to_show = 2;
+inline bool AttentionMessage::_internal_has_time_to_show() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool AttentionMessage::has_time_to_show() const {
+  return _internal_has_time_to_show();
+}
+inline void AttentionMessage::clear_time_to_show() {
+  _impl_.time_to_show_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float AttentionMessage::_internal_time_to_show() const {
+  return _impl_.time_to_show_;
+}
+inline float AttentionMessage::time_to_show() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.AttentionMessage.time_to_show)
+  return _internal_time_to_show();
+}
+inline void AttentionMessage::_internal_set_time_to_show(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.time_to_show_ = value;
+}
+inline void AttentionMessage::set_time_to_show(float value) {
+  _internal_set_time_to_show(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.AttentionMessage.time_to_show)
+}
+
+// optional .llsf_msgs.Team team_color = 3;
+inline bool AttentionMessage::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool AttentionMessage::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void AttentionMessage::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::llsf_msgs::Team AttentionMessage::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team AttentionMessage::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.AttentionMessage.team_color)
+  return _internal_team_color();
+}
+inline void AttentionMessage::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.team_color_ = value;
+}
+inline void AttentionMessage::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.AttentionMessage.team_color)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::AttentionMessage_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::AttentionMessage_CompType>() {
+  return ::llsf_msgs::AttentionMessage_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_AttentionMessage_2eproto
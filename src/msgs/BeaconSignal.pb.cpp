@@ -0,0 +1,667 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: BeaconSignal.proto
+
+#include "BeaconSignal.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR BeaconSignal::BeaconSignal(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.team_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.peer_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_)*/nullptr
+  , /*decltype(_impl_.pose_)*/nullptr
+  , /*decltype(_impl_.seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.team_color_)*/0
+  , /*decltype(_impl_.number_)*/0u} {}
+struct BeaconSignalDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BeaconSignalDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BeaconSignalDefaultTypeInternal() {}
+  union {
+    BeaconSignal _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BeaconSignalDefaultTypeInternal _BeaconSignal_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_BeaconSignal_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_BeaconSignal_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_BeaconSignal_2eproto = nullptr;
+
+const uint32_t TableStruct_BeaconSignal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::BeaconSignal, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::BeaconSignal, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::BeaconSignal, _impl_.time_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::BeaconSignal, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::BeaconSignal, _impl_.number_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::BeaconSignal, _impl_.team_name_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::BeaconSignal, _impl_.peer_name_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::BeaconSignal, _impl_.team_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::BeaconSignal, _impl_.pose_),
+  2,
+  4,
+  6,
+  0,
+  1,
+  5,
+  3,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::llsf_msgs::BeaconSignal)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_BeaconSignal_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_BeaconSignal_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022BeaconSignal.proto\022\tllsf_msgs\032\nTime.pr"
+  "oto\032\nTeam.proto\032\014Pose2D.proto\"\336\001\n\014Beacon"
+  "Signal\022\035\n\004time\030\001 \002(\0132\017.llsf_msgs.Time\022\013\n"
+  "\003seq\030\002 \002(\004\022\016\n\006number\030\010 \002(\r\022\021\n\tteam_name\030"
+  "\004 \002(\t\022\021\n\tpeer_name\030\005 \002(\t\022#\n\nteam_color\030\006"
+  " \001(\0162\017.llsf_msgs.Team\022\037\n\004pose\030\007 \001(\0132\021.ll"
+  "sf_msgs.Pose2D\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017"
+  "\022\014\n\010MSG_TYPE\020\001B5\n\037org.robocup_logistics."
+  "llsf_msgsB\022BeaconSignalProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_BeaconSignal_2eproto_deps[3] = {
+  &::descriptor_table_Pose2D_2eproto,
+  &::descriptor_table_Team_2eproto,
+  &::descriptor_table_Time_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_BeaconSignal_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_BeaconSignal_2eproto = {
+    false, false, 349, descriptor_table_protodef_BeaconSignal_2eproto,
+    "BeaconSignal.proto",
+    &descriptor_table_BeaconSignal_2eproto_once, descriptor_table_BeaconSignal_2eproto_deps, 3, 1,
+    schemas, file_default_instances, TableStruct_BeaconSignal_2eproto::offsets,
+    file_level_metadata_BeaconSignal_2eproto, file_level_enum_descriptors_BeaconSignal_2eproto,
+    file_level_service_descriptors_BeaconSignal_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_BeaconSignal_2eproto_getter() {
+  return &descriptor_table_BeaconSignal_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_BeaconSignal_2eproto(&descriptor_table_BeaconSignal_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* BeaconSignal_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_BeaconSignal_2eproto);
+  return file_level_enum_descriptors_BeaconSignal_2eproto[0];
+}
+bool BeaconSignal_CompType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr BeaconSignal_CompType BeaconSignal::COMP_ID;
+constexpr BeaconSignal_CompType BeaconSignal::MSG_TYPE;
+constexpr BeaconSignal_CompType BeaconSignal::CompType_MIN;
+constexpr BeaconSignal_CompType BeaconSignal::CompType_MAX;
+constexpr int BeaconSignal::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class BeaconSignal::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BeaconSignal>()._impl_._has_bits_);
+  static const ::llsf_msgs::Time& time(const BeaconSignal* msg);
+  static void set_has_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_seq(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_team_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_peer_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::llsf_msgs::Pose2D& pose(const BeaconSignal* msg);
+  static void set_has_pose(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000057) ^ 0x00000057) != 0;
+  }
+};
+
+const ::llsf_msgs::Time&
+BeaconSignal::_Internal::time(const BeaconSignal* msg) {
+  return *msg->_impl_.time_;
+}
+const ::llsf_msgs::Pose2D&
+BeaconSignal::_Internal::pose(const BeaconSignal* msg) {
+  return *msg->_impl_.pose_;
+}
+void BeaconSignal::clear_time() {
+  if (_impl_.time_ != nullptr) _impl_.time_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+void BeaconSignal::clear_pose() {
+  if (_impl_.pose_ != nullptr) _impl_.pose_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+BeaconSignal::BeaconSignal(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.BeaconSignal)
+}
+BeaconSignal::BeaconSignal(const BeaconSignal& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BeaconSignal* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.team_name_){}
+    , decltype(_impl_.peer_name_){}
+    , decltype(_impl_.time_){nullptr}
+    , decltype(_impl_.pose_){nullptr}
+    , decltype(_impl_.seq_){}
+    , decltype(_impl_.team_color_){}
+    , decltype(_impl_.number_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.team_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.team_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_team_name()) {
+    _this->_impl_.team_name_.Set(from._internal_team_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.peer_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.peer_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_peer_name()) {
+    _this->_impl_.peer_name_.Set(from._internal_peer_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_time()) {
+    _this->_impl_.time_ = new ::llsf_msgs::Time(*from._impl_.time_);
+  }
+  if (from._internal_has_pose()) {
+    _this->_impl_.pose_ = new ::llsf_msgs::Pose2D(*from._impl_.pose_);
+  }
+  ::memcpy(&_impl_.seq_, &from._impl_.seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.number_) -
+    reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.number_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.BeaconSignal)
+}
+
+inline void BeaconSignal::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.team_name_){}
+    , decltype(_impl_.peer_name_){}
+    , decltype(_impl_.time_){nullptr}
+    , decltype(_impl_.pose_){nullptr}
+    , decltype(_impl_.seq_){uint64_t{0u}}
+    , decltype(_impl_.team_color_){0}
+    , decltype(_impl_.number_){0u}
+  };
+  _impl_.team_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.team_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.peer_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.peer_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BeaconSignal::~BeaconSignal() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.BeaconSignal)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BeaconSignal::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.team_name_.Destroy();
+  _impl_.peer_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.time_;
+  if (this != internal_default_instance()) delete _impl_.pose_;
+}
+
+void BeaconSignal::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BeaconSignal::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.BeaconSignal)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.team_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.peer_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.time_ != nullptr);
+      _impl_.time_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.pose_ != nullptr);
+      _impl_.pose_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000070u) {
+    ::memset(&_impl_.seq_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.number_) -
+        reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.number_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BeaconSignal::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.Time time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 seq = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_seq(&has_bits);
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string team_name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_team_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.BeaconSignal.team_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string peer_name = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_peer_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.BeaconSignal.peer_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Team team_color = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Pose2D pose = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pose(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 number = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_number(&has_bits);
+          _impl_.number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BeaconSignal::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.BeaconSignal)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Time time = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::time(this),
+        _Internal::time(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint64 seq = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_seq(), target);
+  }
+
+  // required string team_name = 4;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_team_name().data(), static_cast<int>(this->_internal_team_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.BeaconSignal.team_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_team_name(), target);
+  }
+
+  // required string peer_name = 5;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_peer_name().data(), static_cast<int>(this->_internal_peer_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.BeaconSignal.peer_name");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_peer_name(), target);
+  }
+
+  // optional .llsf_msgs.Team team_color = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_team_color(), target);
+  }
+
+  // optional .llsf_msgs.Pose2D pose = 7;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::pose(this),
+        _Internal::pose(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint32 number = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_number(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.BeaconSignal)
+  return target;
+}
+
+size_t BeaconSignal::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.BeaconSignal)
+  size_t total_size = 0;
+
+  if (_internal_has_team_name()) {
+    // required string team_name = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_team_name());
+  }
+
+  if (_internal_has_peer_name()) {
+    // required string peer_name = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_peer_name());
+  }
+
+  if (_internal_has_time()) {
+    // required .llsf_msgs.Time time = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.time_);
+  }
+
+  if (_internal_has_seq()) {
+    // required uint64 seq = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
+  }
+
+  if (_internal_has_number()) {
+    // required uint32 number = 8;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_number());
+  }
+
+  return total_size;
+}
+size_t BeaconSignal::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.BeaconSignal)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000057) ^ 0x00000057) == 0) {  // All required fields are present.
+    // required string team_name = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_team_name());
+
+    // required string peer_name = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_peer_name());
+
+    // required .llsf_msgs.Time time = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.time_);
+
+    // required uint64 seq = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
+
+    // required uint32 number = 8;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_number());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .llsf_msgs.Pose2D pose = 7;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000008u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pose_);
+  }
+
+  // optional .llsf_msgs.Team team_color = 6;
+  if (cached_has_bits & 0x00000020u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BeaconSignal::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BeaconSignal::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BeaconSignal::GetClassData() const { return &_class_data_; }
+
+
+void BeaconSignal::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BeaconSignal*>(&to_msg);
+  auto& from = static_cast<const BeaconSignal&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.BeaconSignal)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_team_name(from._internal_team_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_peer_name(from._internal_peer_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_time()->::llsf_msgs::Time::MergeFrom(
+          from._internal_time());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_pose()->::llsf_msgs::Pose2D::MergeFrom(
+          from._internal_pose());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.seq_ = from._impl_.seq_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.number_ = from._impl_.number_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BeaconSignal::CopyFrom(const BeaconSignal& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.BeaconSignal)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BeaconSignal::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_time()) {
+    if (!_impl_.time_->IsInitialized()) return false;
+  }
+  if (_internal_has_pose()) {
+    if (!_impl_.pose_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void BeaconSignal::InternalSwap(BeaconSignal* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.team_name_, lhs_arena,
+      &other->_impl_.team_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.peer_name_, lhs_arena,
+      &other->_impl_.peer_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BeaconSignal, _impl_.number_)
+      + sizeof(BeaconSignal::_impl_.number_)
+      - PROTOBUF_FIELD_OFFSET(BeaconSignal, _impl_.time_)>(
+          reinterpret_cast<char*>(&_impl_.time_),
+          reinterpret_cast<char*>(&other->_impl_.time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BeaconSignal::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_BeaconSignal_2eproto_getter, &descriptor_table_BeaconSignal_2eproto_once,
+      file_level_metadata_BeaconSignal_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::BeaconSignal*
+Arena::CreateMaybeMessage< ::llsf_msgs::BeaconSignal >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::BeaconSignal >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
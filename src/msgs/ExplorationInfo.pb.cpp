@@ -0,0 +1,981 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ExplorationInfo.proto
+
+#include "ExplorationInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR ExplorationSignal::ExplorationSignal(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.lights_)*/{}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ExplorationSignalDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExplorationSignalDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExplorationSignalDefaultTypeInternal() {}
+  union {
+    ExplorationSignal _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExplorationSignalDefaultTypeInternal _ExplorationSignal_default_instance_;
+PROTOBUF_CONSTEXPR ExplorationZone::ExplorationZone(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.team_color_)*/0
+  , /*decltype(_impl_.zone_)*/18} {}
+struct ExplorationZoneDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExplorationZoneDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExplorationZoneDefaultTypeInternal() {}
+  union {
+    ExplorationZone _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExplorationZoneDefaultTypeInternal _ExplorationZone_default_instance_;
+PROTOBUF_CONSTEXPR ExplorationInfo::ExplorationInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.signals_)*/{}
+  , /*decltype(_impl_.zones_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExplorationInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExplorationInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExplorationInfoDefaultTypeInternal() {}
+  union {
+    ExplorationInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExplorationInfoDefaultTypeInternal _ExplorationInfo_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_ExplorationInfo_2eproto[3];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_ExplorationInfo_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ExplorationInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_ExplorationInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationSignal, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationSignal, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationSignal, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationSignal, _impl_.lights_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationZone, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationZone, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationZone, _impl_.zone_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationZone, _impl_.team_color_),
+  1,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationInfo, _impl_.signals_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ExplorationInfo, _impl_.zones_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::llsf_msgs::ExplorationSignal)},
+  { 10, 18, -1, sizeof(::llsf_msgs::ExplorationZone)},
+  { 20, -1, -1, sizeof(::llsf_msgs::ExplorationInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_ExplorationSignal_default_instance_._instance,
+  &::llsf_msgs::_ExplorationZone_default_instance_._instance,
+  &::llsf_msgs::_ExplorationInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ExplorationInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\025ExplorationInfo.proto\022\tllsf_msgs\032\021Mach"
+  "ineInfo.proto\032\nTeam.proto\032\nZone.proto\"o\n"
+  "\021ExplorationSignal\022\014\n\004type\030\001 \002(\t\022$\n\006ligh"
+  "ts\030\002 \003(\0132\024.llsf_msgs.LightSpec\"&\n\010CompTy"
+  "pe\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020F\"}\n\017Explor"
+  "ationZone\022\035\n\004zone\030\002 \002(\0162\017.llsf_msgs.Zone"
+  "\022#\n\nteam_color\030\003 \002(\0162\017.llsf_msgs.Team\"&\n"
+  "\010CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020G\"\223\001"
+  "\n\017ExplorationInfo\022-\n\007signals\030\001 \003(\0132\034.lls"
+  "f_msgs.ExplorationSignal\022)\n\005zones\030\002 \003(\0132"
+  "\032.llsf_msgs.ExplorationZone\"&\n\010CompType\022"
+  "\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020HB8\n\037org.roboc"
+  "up_logistics.llsf_msgsB\025ExplorationInfoP"
+  "rotos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_ExplorationInfo_2eproto_deps[3] = {
+  &::descriptor_table_MachineInfo_2eproto,
+  &::descriptor_table_Team_2eproto,
+  &::descriptor_table_Zone_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_ExplorationInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ExplorationInfo_2eproto = {
+    false, false, 525, descriptor_table_protodef_ExplorationInfo_2eproto,
+    "ExplorationInfo.proto",
+    &descriptor_table_ExplorationInfo_2eproto_once, descriptor_table_ExplorationInfo_2eproto_deps, 3, 3,
+    schemas, file_default_instances, TableStruct_ExplorationInfo_2eproto::offsets,
+    file_level_metadata_ExplorationInfo_2eproto, file_level_enum_descriptors_ExplorationInfo_2eproto,
+    file_level_service_descriptors_ExplorationInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ExplorationInfo_2eproto_getter() {
+  return &descriptor_table_ExplorationInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ExplorationInfo_2eproto(&descriptor_table_ExplorationInfo_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExplorationSignal_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ExplorationInfo_2eproto);
+  return file_level_enum_descriptors_ExplorationInfo_2eproto[0];
+}
+bool ExplorationSignal_CompType_IsValid(int value) {
+  switch (value) {
+    case 70:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ExplorationSignal_CompType ExplorationSignal::COMP_ID;
+constexpr ExplorationSignal_CompType ExplorationSignal::MSG_TYPE;
+constexpr ExplorationSignal_CompType ExplorationSignal::CompType_MIN;
+constexpr ExplorationSignal_CompType ExplorationSignal::CompType_MAX;
+constexpr int ExplorationSignal::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExplorationZone_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ExplorationInfo_2eproto);
+  return file_level_enum_descriptors_ExplorationInfo_2eproto[1];
+}
+bool ExplorationZone_CompType_IsValid(int value) {
+  switch (value) {
+    case 71:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ExplorationZone_CompType ExplorationZone::COMP_ID;
+constexpr ExplorationZone_CompType ExplorationZone::MSG_TYPE;
+constexpr ExplorationZone_CompType ExplorationZone::CompType_MIN;
+constexpr ExplorationZone_CompType ExplorationZone::CompType_MAX;
+constexpr int ExplorationZone::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExplorationInfo_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ExplorationInfo_2eproto);
+  return file_level_enum_descriptors_ExplorationInfo_2eproto[2];
+}
+bool ExplorationInfo_CompType_IsValid(int value) {
+  switch (value) {
+    case 72:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ExplorationInfo_CompType ExplorationInfo::COMP_ID;
+constexpr ExplorationInfo_CompType ExplorationInfo::MSG_TYPE;
+constexpr ExplorationInfo_CompType ExplorationInfo::CompType_MIN;
+constexpr ExplorationInfo_CompType ExplorationInfo::CompType_MAX;
+constexpr int ExplorationInfo::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class ExplorationSignal::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ExplorationSignal>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+void ExplorationSignal::clear_lights() {
+  _impl_.lights_.Clear();
+}
+ExplorationSignal::ExplorationSignal(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.ExplorationSignal)
+}
+ExplorationSignal::ExplorationSignal(const ExplorationSignal& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExplorationSignal* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lights_){from._impl_.lights_}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_type()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.ExplorationSignal)
+}
+
+inline void ExplorationSignal::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lights_){arena}
+    , decltype(_impl_.type_){}
+  };
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ExplorationSignal::~ExplorationSignal() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.ExplorationSignal)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExplorationSignal::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lights_.~RepeatedPtrField();
+  _impl_.type_.Destroy();
+}
+
+void ExplorationSignal::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExplorationSignal::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.ExplorationSignal)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.lights_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.type_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExplorationSignal::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.ExplorationSignal.type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.LightSpec lights = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_lights(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExplorationSignal::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.ExplorationSignal)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string type = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.ExplorationSignal.type");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_type(), target);
+  }
+
+  // repeated .llsf_msgs.LightSpec lights = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_lights_size()); i < n; i++) {
+    const auto& repfield = this->_internal_lights(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.ExplorationSignal)
+  return target;
+}
+
+size_t ExplorationSignal::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.ExplorationSignal)
+  size_t total_size = 0;
+
+  // required string type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.LightSpec lights = 2;
+  total_size += 1UL * this->_internal_lights_size();
+  for (const auto& msg : this->_impl_.lights_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExplorationSignal::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExplorationSignal::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExplorationSignal::GetClassData() const { return &_class_data_; }
+
+
+void ExplorationSignal::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExplorationSignal*>(&to_msg);
+  auto& from = static_cast<const ExplorationSignal&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.ExplorationSignal)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.lights_.MergeFrom(from._impl_.lights_);
+  if (from._internal_has_type()) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExplorationSignal::CopyFrom(const ExplorationSignal& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.ExplorationSignal)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExplorationSignal::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.lights_))
+    return false;
+  return true;
+}
+
+void ExplorationSignal::InternalSwap(ExplorationSignal* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.lights_.InternalSwap(&other->_impl_.lights_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExplorationSignal::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ExplorationInfo_2eproto_getter, &descriptor_table_ExplorationInfo_2eproto_once,
+      file_level_metadata_ExplorationInfo_2eproto[0]);
+}
+
+// ===================================================================
+
+class ExplorationZone::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ExplorationZone>()._impl_._has_bits_);
+  static void set_has_zone(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ExplorationZone::ExplorationZone(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.ExplorationZone)
+}
+ExplorationZone::ExplorationZone(const ExplorationZone& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExplorationZone* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.team_color_){}
+    , decltype(_impl_.zone_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.team_color_, &from._impl_.team_color_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.zone_) -
+    reinterpret_cast<char*>(&_impl_.team_color_)) + sizeof(_impl_.zone_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.ExplorationZone)
+}
+
+inline void ExplorationZone::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.team_color_){0}
+    , decltype(_impl_.zone_){18}
+  };
+}
+
+ExplorationZone::~ExplorationZone() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.ExplorationZone)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExplorationZone::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ExplorationZone::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExplorationZone::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.ExplorationZone)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.team_color_ = 0;
+    _impl_.zone_ = 18;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExplorationZone::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.Zone zone = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Zone_IsValid(val))) {
+            _internal_set_zone(static_cast<::llsf_msgs::Zone>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.Team team_color = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExplorationZone::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.ExplorationZone)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Zone zone = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_zone(), target);
+  }
+
+  // required .llsf_msgs.Team team_color = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_team_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.ExplorationZone)
+  return target;
+}
+
+size_t ExplorationZone::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.ExplorationZone)
+  size_t total_size = 0;
+
+  if (_internal_has_team_color()) {
+    // required .llsf_msgs.Team team_color = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+
+  if (_internal_has_zone()) {
+    // required .llsf_msgs.Zone zone = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_zone());
+  }
+
+  return total_size;
+}
+size_t ExplorationZone::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.ExplorationZone)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .llsf_msgs.Team team_color = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+
+    // required .llsf_msgs.Zone zone = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_zone());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExplorationZone::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExplorationZone::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExplorationZone::GetClassData() const { return &_class_data_; }
+
+
+void ExplorationZone::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExplorationZone*>(&to_msg);
+  auto& from = static_cast<const ExplorationZone&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.ExplorationZone)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.zone_ = from._impl_.zone_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExplorationZone::CopyFrom(const ExplorationZone& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.ExplorationZone)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExplorationZone::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ExplorationZone::InternalSwap(ExplorationZone* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.team_color_, other->_impl_.team_color_);
+  swap(_impl_.zone_, other->_impl_.zone_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExplorationZone::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ExplorationInfo_2eproto_getter, &descriptor_table_ExplorationInfo_2eproto_once,
+      file_level_metadata_ExplorationInfo_2eproto[1]);
+}
+
+// ===================================================================
+
+class ExplorationInfo::_Internal {
+ public:
+};
+
+ExplorationInfo::ExplorationInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.ExplorationInfo)
+}
+ExplorationInfo::ExplorationInfo(const ExplorationInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExplorationInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signals_){from._impl_.signals_}
+    , decltype(_impl_.zones_){from._impl_.zones_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.ExplorationInfo)
+}
+
+inline void ExplorationInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signals_){arena}
+    , decltype(_impl_.zones_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ExplorationInfo::~ExplorationInfo() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.ExplorationInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExplorationInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.signals_.~RepeatedPtrField();
+  _impl_.zones_.~RepeatedPtrField();
+}
+
+void ExplorationInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExplorationInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.ExplorationInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.signals_.Clear();
+  _impl_.zones_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExplorationInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .llsf_msgs.ExplorationSignal signals = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_signals(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.ExplorationZone zones = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_zones(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExplorationInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.ExplorationInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.ExplorationSignal signals = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_signals_size()); i < n; i++) {
+    const auto& repfield = this->_internal_signals(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .llsf_msgs.ExplorationZone zones = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_zones_size()); i < n; i++) {
+    const auto& repfield = this->_internal_zones(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.ExplorationInfo)
+  return target;
+}
+
+size_t ExplorationInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.ExplorationInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.ExplorationSignal signals = 1;
+  total_size += 1UL * this->_internal_signals_size();
+  for (const auto& msg : this->_impl_.signals_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .llsf_msgs.ExplorationZone zones = 2;
+  total_size += 1UL * this->_internal_zones_size();
+  for (const auto& msg : this->_impl_.zones_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExplorationInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExplorationInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExplorationInfo::GetClassData() const { return &_class_data_; }
+
+
+void ExplorationInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExplorationInfo*>(&to_msg);
+  auto& from = static_cast<const ExplorationInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.ExplorationInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.signals_.MergeFrom(from._impl_.signals_);
+  _this->_impl_.zones_.MergeFrom(from._impl_.zones_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExplorationInfo::CopyFrom(const ExplorationInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.ExplorationInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExplorationInfo::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.signals_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.zones_))
+    return false;
+  return true;
+}
+
+void ExplorationInfo::InternalSwap(ExplorationInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.signals_.InternalSwap(&other->_impl_.signals_);
+  _impl_.zones_.InternalSwap(&other->_impl_.zones_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExplorationInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ExplorationInfo_2eproto_getter, &descriptor_table_ExplorationInfo_2eproto_once,
+      file_level_metadata_ExplorationInfo_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::ExplorationSignal*
+Arena::CreateMaybeMessage< ::llsf_msgs::ExplorationSignal >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::ExplorationSignal >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::ExplorationZone*
+Arena::CreateMaybeMessage< ::llsf_msgs::ExplorationZone >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::ExplorationZone >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::ExplorationInfo*
+Arena::CreateMaybeMessage< ::llsf_msgs::ExplorationInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::ExplorationInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1072 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ExplorationInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ExplorationInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ExplorationInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "MachineInfo.pb.h"
+#include "Team.pb.h"
+#include "Zone.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ExplorationInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ExplorationInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ExplorationInfo_2eproto;
+namespace llsf_msgs {
+class ExplorationInfo;
+struct ExplorationInfoDefaultTypeInternal;
+extern ExplorationInfoDefaultTypeInternal _ExplorationInfo_default_instance_;
+class ExplorationSignal;
+struct ExplorationSignalDefaultTypeInternal;
+extern ExplorationSignalDefaultTypeInternal _ExplorationSignal_default_instance_;
+class ExplorationZone;
+struct ExplorationZoneDefaultTypeInternal;
+extern ExplorationZoneDefaultTypeInternal _ExplorationZone_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::ExplorationInfo* Arena::CreateMaybeMessage<::llsf_msgs::ExplorationInfo>(Arena*);
+template<> ::llsf_msgs::ExplorationSignal* Arena::CreateMaybeMessage<::llsf_msgs::ExplorationSignal>(Arena*);
+template<> ::llsf_msgs::ExplorationZone* Arena::CreateMaybeMessage<::llsf_msgs::ExplorationZone>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum ExplorationSignal_CompType : int {
+  ExplorationSignal_CompType_COMP_ID = 2000,
+  ExplorationSignal_CompType_MSG_TYPE = 70
+};
+bool ExplorationSignal_CompType_IsValid(int value);
+constexpr ExplorationSignal_CompType ExplorationSignal_CompType_CompType_MIN = ExplorationSignal_CompType_MSG_TYPE;
+constexpr ExplorationSignal_CompType ExplorationSignal_CompType_CompType_MAX = ExplorationSignal_CompType_COMP_ID;
+constexpr int ExplorationSignal_CompType_CompType_ARRAYSIZE = ExplorationSignal_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExplorationSignal_CompType_descriptor();
+template<typename T>
+inline const std::string& ExplorationSignal_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ExplorationSignal_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ExplorationSignal_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ExplorationSignal_CompType_descriptor(), enum_t_value);
+}
+inline bool ExplorationSignal_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ExplorationSignal_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ExplorationSignal_CompType>(
+    ExplorationSignal_CompType_descriptor(), name, value);
+}
+enum ExplorationZone_CompType : int {
+  ExplorationZone_CompType_COMP_ID = 2000,
+  ExplorationZone_CompType_MSG_TYPE = 71
+};
+bool ExplorationZone_CompType_IsValid(int value);
+constexpr ExplorationZone_CompType ExplorationZone_CompType_CompType_MIN = ExplorationZone_CompType_MSG_TYPE;
+constexpr ExplorationZone_CompType ExplorationZone_CompType_CompType_MAX = ExplorationZone_CompType_COMP_ID;
+constexpr int ExplorationZone_CompType_CompType_ARRAYSIZE = ExplorationZone_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExplorationZone_CompType_descriptor();
+template<typename T>
+inline const std::string& ExplorationZone_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ExplorationZone_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ExplorationZone_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ExplorationZone_CompType_descriptor(), enum_t_value);
+}
+inline bool ExplorationZone_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ExplorationZone_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ExplorationZone_CompType>(
+    ExplorationZone_CompType_descriptor(), name, value);
+}
+enum ExplorationInfo_CompType : int {
+  ExplorationInfo_CompType_COMP_ID = 2000,
+  ExplorationInfo_CompType_MSG_TYPE = 72
+};
+bool ExplorationInfo_CompType_IsValid(int value);
+constexpr ExplorationInfo_CompType ExplorationInfo_CompType_CompType_MIN = ExplorationInfo_CompType_MSG_TYPE;
+constexpr ExplorationInfo_CompType ExplorationInfo_CompType_CompType_MAX = ExplorationInfo_CompType_COMP_ID;
+constexpr int ExplorationInfo_CompType_CompType_ARRAYSIZE = ExplorationInfo_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExplorationInfo_CompType_descriptor();
+template<typename T>
+inline const std::string& ExplorationInfo_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ExplorationInfo_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ExplorationInfo_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ExplorationInfo_CompType_descriptor(), enum_t_value);
+}
+inline bool ExplorationInfo_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ExplorationInfo_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ExplorationInfo_CompType>(
+    ExplorationInfo_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class ExplorationSignal final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.ExplorationSignal) */ {
+ public:
+  inline ExplorationSignal() : ExplorationSignal(nullptr) {}
+  ~ExplorationSignal() override;
+  explicit PROTOBUF_CONSTEXPR ExplorationSignal(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExplorationSignal(const ExplorationSignal& from);
+  ExplorationSignal(ExplorationSignal&& from) noexcept
+    : ExplorationSignal() {
+    *this = ::std::move(from);
+  }
+
+  inline ExplorationSignal& operator=(const ExplorationSignal& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExplorationSignal& operator=(ExplorationSignal&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExplorationSignal& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExplorationSignal* internal_default_instance() {
+    return reinterpret_cast<const ExplorationSignal*>(
+               &_ExplorationSignal_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ExplorationSignal& a, ExplorationSignal& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExplorationSignal* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExplorationSignal* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExplorationSignal* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExplorationSignal>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExplorationSignal& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExplorationSignal& from) {
+    ExplorationSignal::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExplorationSignal* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.ExplorationSignal";
+  }
+  protected:
+  explicit ExplorationSignal(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ExplorationSignal_CompType CompType;
+  static constexpr CompType COMP_ID =
+    ExplorationSignal_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    ExplorationSignal_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return ExplorationSignal_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    ExplorationSignal_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    ExplorationSignal_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    ExplorationSignal_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return ExplorationSignal_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return ExplorationSignal_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return ExplorationSignal_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLightsFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
+  // repeated .llsf_msgs.LightSpec lights = 2;
+  int lights_size() const;
+  private:
+  int _internal_lights_size() const;
+  public:
+  void clear_lights();
+  ::llsf_msgs::LightSpec* mutable_lights(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >*
+      mutable_lights();
+  private:
+  const ::llsf_msgs::LightSpec& _internal_lights(int index) const;
+  ::llsf_msgs::LightSpec* _internal_add_lights();
+  public:
+  const ::llsf_msgs::LightSpec& lights(int index) const;
+  ::llsf_msgs::LightSpec* add_lights();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >&
+      lights() const;
+
+  // required string type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.ExplorationSignal)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec > lights_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ExplorationInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExplorationZone final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.ExplorationZone) */ {
+ public:
+  inline ExplorationZone() : ExplorationZone(nullptr) {}
+  ~ExplorationZone() override;
+  explicit PROTOBUF_CONSTEXPR ExplorationZone(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExplorationZone(const ExplorationZone& from);
+  ExplorationZone(ExplorationZone&& from) noexcept
+    : ExplorationZone() {
+    *this = ::std::move(from);
+  }
+
+  inline ExplorationZone& operator=(const ExplorationZone& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExplorationZone& operator=(ExplorationZone&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExplorationZone& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExplorationZone* internal_default_instance() {
+    return reinterpret_cast<const ExplorationZone*>(
+               &_ExplorationZone_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ExplorationZone& a, ExplorationZone& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExplorationZone* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExplorationZone* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExplorationZone* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExplorationZone>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExplorationZone& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExplorationZone& from) {
+    ExplorationZone::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExplorationZone* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.ExplorationZone";
+  }
+  protected:
+  explicit ExplorationZone(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ExplorationZone_CompType CompType;
+  static constexpr CompType COMP_ID =
+    ExplorationZone_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    ExplorationZone_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return ExplorationZone_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    ExplorationZone_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    ExplorationZone_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    ExplorationZone_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return ExplorationZone_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return ExplorationZone_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return ExplorationZone_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTeamColorFieldNumber = 3,
+    kZoneFieldNumber = 2,
+  };
+  // required .llsf_msgs.Team team_color = 3;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // required .llsf_msgs.Zone zone = 2;
+  bool has_zone() const;
+  private:
+  bool _internal_has_zone() const;
+  public:
+  void clear_zone();
+  ::llsf_msgs::Zone zone() const;
+  void set_zone(::llsf_msgs::Zone value);
+  private:
+  ::llsf_msgs::Zone _internal_zone() const;
+  void _internal_set_zone(::llsf_msgs::Zone value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.ExplorationZone)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int team_color_;
+    int zone_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ExplorationInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExplorationInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.ExplorationInfo) */ {
+ public:
+  inline ExplorationInfo() : ExplorationInfo(nullptr) {}
+  ~ExplorationInfo() override;
+  explicit PROTOBUF_CONSTEXPR ExplorationInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExplorationInfo(const ExplorationInfo& from);
+  ExplorationInfo(ExplorationInfo&& from) noexcept
+    : ExplorationInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline ExplorationInfo& operator=(const ExplorationInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExplorationInfo& operator=(ExplorationInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExplorationInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExplorationInfo* internal_default_instance() {
+    return reinterpret_cast<const ExplorationInfo*>(
+               &_ExplorationInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ExplorationInfo& a, ExplorationInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExplorationInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExplorationInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExplorationInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExplorationInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExplorationInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExplorationInfo& from) {
+    ExplorationInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExplorationInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.ExplorationInfo";
+  }
+  protected:
+  explicit ExplorationInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ExplorationInfo_CompType CompType;
+  static constexpr CompType COMP_ID =
+    ExplorationInfo_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    ExplorationInfo_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return ExplorationInfo_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    ExplorationInfo_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    ExplorationInfo_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    ExplorationInfo_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return ExplorationInfo_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return ExplorationInfo_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return ExplorationInfo_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSignalsFieldNumber = 1,
+    kZonesFieldNumber = 2,
+  };
+  // repeated .llsf_msgs.ExplorationSignal signals = 1;
+  int signals_size() const;
+  private:
+  int _internal_signals_size() const;
+  public:
+  void clear_signals();
+  ::llsf_msgs::ExplorationSignal* mutable_signals(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ExplorationSignal >*
+      mutable_signals();
+  private:
+  const ::llsf_msgs::ExplorationSignal& _internal_signals(int index) const;
+  ::llsf_msgs::ExplorationSignal* _internal_add_signals();
+  public:
+  const ::llsf_msgs::ExplorationSignal& signals(int index) const;
+  ::llsf_msgs::ExplorationSignal* add_signals();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ExplorationSignal >&
+      signals() const;
+
+  // repeated .llsf_msgs.ExplorationZone zones = 2;
+  int zones_size() const;
+  private:
+  int _internal_zones_size() const;
+  public:
+  void clear_zones();
+  ::llsf_msgs::ExplorationZone* mutable_zones(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ExplorationZone >*
+      mutable_zones();
+  private:
+  const ::llsf_msgs::ExplorationZone& _internal_zones(int index) const;
+  ::llsf_msgs::ExplorationZone* _internal_add_zones();
+  public:
+  const ::llsf_msgs::ExplorationZone& zones(int index) const;
+  ::llsf_msgs::ExplorationZone* add_zones();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ExplorationZone >&
+      zones() const;
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.ExplorationInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ExplorationSignal > signals_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ExplorationZone > zones_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ExplorationInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ExplorationSignal
+
+// required string type = 1;
+inline bool ExplorationSignal::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ExplorationSignal::has_type() const {
+  return _internal_has_type();
+}
+inline void ExplorationSignal::clear_type() {
+  _impl_.type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ExplorationSignal::type() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ExplorationSignal.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ExplorationSignal::set_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.ExplorationSignal.type)
+}
+inline std::string* ExplorationSignal::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.ExplorationSignal.type)
+  return _s;
+}
+inline const std::string& ExplorationSignal::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void ExplorationSignal::_internal_set_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ExplorationSignal::_internal_mutable_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ExplorationSignal::release_type() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.ExplorationSignal.type)
+  if (!_internal_has_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ExplorationSignal::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.ExplorationSignal.type)
+}
+
+// repeated .llsf_msgs.LightSpec lights = 2;
+inline int ExplorationSignal::_internal_lights_size() const {
+  return _impl_.lights_.size();
+}
+inline int ExplorationSignal::lights_size() const {
+  return _internal_lights_size();
+}
+inline ::llsf_msgs::LightSpec* ExplorationSignal::mutable_lights(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.ExplorationSignal.lights)
+  return _impl_.lights_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >*
+ExplorationSignal::mutable_lights() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.ExplorationSignal.lights)
+  return &_impl_.lights_;
+}
+inline const ::llsf_msgs::LightSpec& ExplorationSignal::_internal_lights(int index) const {
+  return _impl_.lights_.Get(index);
+}
+inline const ::llsf_msgs::LightSpec& ExplorationSignal::lights(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ExplorationSignal.lights)
+  return _internal_lights(index);
+}
+inline ::llsf_msgs::LightSpec* ExplorationSignal::_internal_add_lights() {
+  return _impl_.lights_.Add();
+}
+inline ::llsf_msgs::LightSpec* ExplorationSignal::add_lights() {
+  ::llsf_msgs::LightSpec* _add = _internal_add_lights();
+  // @@protoc_insertion_point(field_add:llsf_msgs.ExplorationSignal.lights)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >&
+ExplorationSignal::lights() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.ExplorationSignal.lights)
+  return _impl_.lights_;
+}
+
+// -------------------------------------------------------------------
+
+// ExplorationZone
+
+// required .llsf_msgs.Zone zone = 2;
+inline bool ExplorationZone::_internal_has_zone() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ExplorationZone::has_zone() const {
+  return _internal_has_zone();
+}
+inline void ExplorationZone::clear_zone() {
+  _impl_.zone_ = 18;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::llsf_msgs::Zone ExplorationZone::_internal_zone() const {
+  return static_cast< ::llsf_msgs::Zone >(_impl_.zone_);
+}
+inline ::llsf_msgs::Zone ExplorationZone::zone() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ExplorationZone.zone)
+  return _internal_zone();
+}
+inline void ExplorationZone::_internal_set_zone(::llsf_msgs::Zone value) {
+  assert(::llsf_msgs::Zone_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.zone_ = value;
+}
+inline void ExplorationZone::set_zone(::llsf_msgs::Zone value) {
+  _internal_set_zone(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.ExplorationZone.zone)
+}
+
+// required .llsf_msgs.Team team_color = 3;
+inline bool ExplorationZone::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ExplorationZone::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void ExplorationZone::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::Team ExplorationZone::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team ExplorationZone::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ExplorationZone.team_color)
+  return _internal_team_color();
+}
+inline void ExplorationZone::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.team_color_ = value;
+}
+inline void ExplorationZone::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.ExplorationZone.team_color)
+}
+
+// -------------------------------------------------------------------
+
+// ExplorationInfo
+
+// repeated .llsf_msgs.ExplorationSignal signals = 1;
+inline int ExplorationInfo::_internal_signals_size() const {
+  return _impl_.signals_.size();
+}
+inline int ExplorationInfo::signals_size() const {
+  return _internal_signals_size();
+}
+inline void ExplorationInfo::clear_signals() {
+  _impl_.signals_.Clear();
+}
+inline ::llsf_msgs::ExplorationSignal* ExplorationInfo::mutable_signals(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.ExplorationInfo.signals)
+  return _impl_.signals_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ExplorationSignal >*
+ExplorationInfo::mutable_signals() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.ExplorationInfo.signals)
+  return &_impl_.signals_;
+}
+inline const ::llsf_msgs::ExplorationSignal& ExplorationInfo::_internal_signals(int index) const {
+  return _impl_.signals_.Get(index);
+}
+inline const ::llsf_msgs::ExplorationSignal& ExplorationInfo::signals(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ExplorationInfo.signals)
+  return _internal_signals(index);
+}
+inline ::llsf_msgs::ExplorationSignal* ExplorationInfo::_internal_add_signals() {
+  return _impl_.signals_.Add();
+}
+inline ::llsf_msgs::ExplorationSignal* ExplorationInfo::add_signals() {
+  ::llsf_msgs::ExplorationSignal* _add = _internal_add_signals();
+  // @@protoc_insertion_point(field_add:llsf_msgs.ExplorationInfo.signals)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ExplorationSignal >&
+ExplorationInfo::signals() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.ExplorationInfo.signals)
+  return _impl_.signals_;
+}
+
+// repeated .llsf_msgs.ExplorationZone zones = 2;
+inline int ExplorationInfo::_internal_zones_size() const {
+  return _impl_.zones_.size();
+}
+inline int ExplorationInfo::zones_size() const {
+  return _internal_zones_size();
+}
+inline void ExplorationInfo::clear_zones() {
+  _impl_.zones_.Clear();
+}
+inline ::llsf_msgs::ExplorationZone* ExplorationInfo::mutable_zones(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.ExplorationInfo.zones)
+  return _impl_.zones_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ExplorationZone >*
+ExplorationInfo::mutable_zones() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.ExplorationInfo.zones)
+  return &_impl_.zones_;
+}
+inline const ::llsf_msgs::ExplorationZone& ExplorationInfo::_internal_zones(int index) const {
+  return _impl_.zones_.Get(index);
+}
+inline const ::llsf_msgs::ExplorationZone& ExplorationInfo::zones(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ExplorationInfo.zones)
+  return _internal_zones(index);
+}
+inline ::llsf_msgs::ExplorationZone* ExplorationInfo::_internal_add_zones() {
+  return _impl_.zones_.Add();
+}
+inline ::llsf_msgs::ExplorationZone* ExplorationInfo::add_zones() {
+  ::llsf_msgs::ExplorationZone* _add = _internal_add_zones();
+  // @@protoc_insertion_point(field_add:llsf_msgs.ExplorationInfo.zones)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ExplorationZone >&
+ExplorationInfo::zones() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.ExplorationInfo.zones)
+  return _impl_.zones_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::ExplorationSignal_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::ExplorationSignal_CompType>() {
+  return ::llsf_msgs::ExplorationSignal_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::ExplorationZone_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::ExplorationZone_CompType>() {
+  return ::llsf_msgs::ExplorationZone_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::ExplorationInfo_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::ExplorationInfo_CompType>() {
+  return ::llsf_msgs::ExplorationInfo_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ExplorationInfo_2eproto
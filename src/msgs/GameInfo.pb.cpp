@@ -0,0 +1,646 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: GameInfo.proto
+
+#include "GameInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR GameInfo::GameInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.known_teams_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameInfoDefaultTypeInternal() {}
+  union {
+    GameInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameInfoDefaultTypeInternal _GameInfo_default_instance_;
+PROTOBUF_CONSTEXPR SetTeamName::SetTeamName(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.team_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.team_color_)*/0} {}
+struct SetTeamNameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetTeamNameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetTeamNameDefaultTypeInternal() {}
+  union {
+    SetTeamName _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetTeamNameDefaultTypeInternal _SetTeamName_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_GameInfo_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_GameInfo_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_GameInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_GameInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameInfo, _impl_.known_teams_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetTeamName, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetTeamName, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetTeamName, _impl_.team_name_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetTeamName, _impl_.team_color_),
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::llsf_msgs::GameInfo)},
+  { 7, 15, -1, sizeof(::llsf_msgs::SetTeamName)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_GameInfo_default_instance_._instance,
+  &::llsf_msgs::_SetTeamName_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_GameInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016GameInfo.proto\022\tllsf_msgs\032\nTeam.proto\""
+  "G\n\010GameInfo\022\023\n\013known_teams\030\001 \003(\t\"&\n\010Comp"
+  "Type\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020Q\"m\n\013SetT"
+  "eamName\022\021\n\tteam_name\030\001 \002(\t\022#\n\nteam_color"
+  "\030\002 \002(\0162\017.llsf_msgs.Team\"&\n\010CompType\022\014\n\007C"
+  "OMP_ID\020\320\017\022\014\n\010MSG_TYPE\020RB1\n\037org.robocup_l"
+  "ogistics.llsf_msgsB\016GameInfoProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_GameInfo_2eproto_deps[1] = {
+  &::descriptor_table_Team_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_GameInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_GameInfo_2eproto = {
+    false, false, 274, descriptor_table_protodef_GameInfo_2eproto,
+    "GameInfo.proto",
+    &descriptor_table_GameInfo_2eproto_once, descriptor_table_GameInfo_2eproto_deps, 1, 2,
+    schemas, file_default_instances, TableStruct_GameInfo_2eproto::offsets,
+    file_level_metadata_GameInfo_2eproto, file_level_enum_descriptors_GameInfo_2eproto,
+    file_level_service_descriptors_GameInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_GameInfo_2eproto_getter() {
+  return &descriptor_table_GameInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_GameInfo_2eproto(&descriptor_table_GameInfo_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GameInfo_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_GameInfo_2eproto);
+  return file_level_enum_descriptors_GameInfo_2eproto[0];
+}
+bool GameInfo_CompType_IsValid(int value) {
+  switch (value) {
+    case 81:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr GameInfo_CompType GameInfo::COMP_ID;
+constexpr GameInfo_CompType GameInfo::MSG_TYPE;
+constexpr GameInfo_CompType GameInfo::CompType_MIN;
+constexpr GameInfo_CompType GameInfo::CompType_MAX;
+constexpr int GameInfo::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetTeamName_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_GameInfo_2eproto);
+  return file_level_enum_descriptors_GameInfo_2eproto[1];
+}
+bool SetTeamName_CompType_IsValid(int value) {
+  switch (value) {
+    case 82:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SetTeamName_CompType SetTeamName::COMP_ID;
+constexpr SetTeamName_CompType SetTeamName::MSG_TYPE;
+constexpr SetTeamName_CompType SetTeamName::CompType_MIN;
+constexpr SetTeamName_CompType SetTeamName::CompType_MAX;
+constexpr int SetTeamName::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class GameInfo::_Internal {
+ public:
+};
+
+GameInfo::GameInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.GameInfo)
+}
+GameInfo::GameInfo(const GameInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.known_teams_){from._impl_.known_teams_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.GameInfo)
+}
+
+inline void GameInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.known_teams_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GameInfo::~GameInfo() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.GameInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GameInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.known_teams_.~RepeatedPtrField();
+}
+
+void GameInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GameInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.GameInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.known_teams_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string known_teams = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_known_teams();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "llsf_msgs.GameInfo.known_teams");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GameInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.GameInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string known_teams = 1;
+  for (int i = 0, n = this->_internal_known_teams_size(); i < n; i++) {
+    const auto& s = this->_internal_known_teams(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.GameInfo.known_teams");
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.GameInfo)
+  return target;
+}
+
+size_t GameInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.GameInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string known_teams = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.known_teams_.size());
+  for (int i = 0, n = _impl_.known_teams_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.known_teams_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameInfo::GetClassData() const { return &_class_data_; }
+
+
+void GameInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameInfo*>(&to_msg);
+  auto& from = static_cast<const GameInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.GameInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.known_teams_.MergeFrom(from._impl_.known_teams_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GameInfo::CopyFrom(const GameInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.GameInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GameInfo::IsInitialized() const {
+  return true;
+}
+
+void GameInfo::InternalSwap(GameInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.known_teams_.InternalSwap(&other->_impl_.known_teams_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GameInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GameInfo_2eproto_getter, &descriptor_table_GameInfo_2eproto_once,
+      file_level_metadata_GameInfo_2eproto[0]);
+}
+
+// ===================================================================
+
+class SetTeamName::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SetTeamName>()._impl_._has_bits_);
+  static void set_has_team_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+SetTeamName::SetTeamName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.SetTeamName)
+}
+SetTeamName::SetTeamName(const SetTeamName& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetTeamName* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.team_name_){}
+    , decltype(_impl_.team_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.team_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.team_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_team_name()) {
+    _this->_impl_.team_name_.Set(from._internal_team_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.team_color_ = from._impl_.team_color_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.SetTeamName)
+}
+
+inline void SetTeamName::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.team_name_){}
+    , decltype(_impl_.team_color_){0}
+  };
+  _impl_.team_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.team_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SetTeamName::~SetTeamName() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.SetTeamName)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetTeamName::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.team_name_.Destroy();
+}
+
+void SetTeamName::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetTeamName::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.SetTeamName)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.team_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetTeamName::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string team_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_team_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.SetTeamName.team_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.Team team_color = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetTeamName::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.SetTeamName)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string team_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_team_name().data(), static_cast<int>(this->_internal_team_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.SetTeamName.team_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_team_name(), target);
+  }
+
+  // required .llsf_msgs.Team team_color = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_team_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.SetTeamName)
+  return target;
+}
+
+size_t SetTeamName::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.SetTeamName)
+  size_t total_size = 0;
+
+  if (_internal_has_team_name()) {
+    // required string team_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_team_name());
+  }
+
+  if (_internal_has_team_color()) {
+    // required .llsf_msgs.Team team_color = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+
+  return total_size;
+}
+size_t SetTeamName::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.SetTeamName)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string team_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_team_name());
+
+    // required .llsf_msgs.Team team_color = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetTeamName::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetTeamName::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetTeamName::GetClassData() const { return &_class_data_; }
+
+
+void SetTeamName::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetTeamName*>(&to_msg);
+  auto& from = static_cast<const SetTeamName&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.SetTeamName)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_team_name(from._internal_team_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetTeamName::CopyFrom(const SetTeamName& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.SetTeamName)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetTeamName::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SetTeamName::InternalSwap(SetTeamName* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.team_name_, lhs_arena,
+      &other->_impl_.team_name_, rhs_arena
+  );
+  swap(_impl_.team_color_, other->_impl_.team_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetTeamName::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GameInfo_2eproto_getter, &descriptor_table_GameInfo_2eproto_once,
+      file_level_metadata_GameInfo_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::GameInfo*
+Arena::CreateMaybeMessage< ::llsf_msgs::GameInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::GameInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::SetTeamName*
+Arena::CreateMaybeMessage< ::llsf_msgs::SetTeamName >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::SetTeamName >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,737 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: GameInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_GameInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_GameInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Team.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_GameInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_GameInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_GameInfo_2eproto;
+namespace llsf_msgs {
+class GameInfo;
+struct GameInfoDefaultTypeInternal;
+extern GameInfoDefaultTypeInternal _GameInfo_default_instance_;
+class SetTeamName;
+struct SetTeamNameDefaultTypeInternal;
+extern SetTeamNameDefaultTypeInternal _SetTeamName_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::GameInfo* Arena::CreateMaybeMessage<::llsf_msgs::GameInfo>(Arena*);
+template<> ::llsf_msgs::SetTeamName* Arena::CreateMaybeMessage<::llsf_msgs::SetTeamName>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum GameInfo_CompType : int {
+  GameInfo_CompType_COMP_ID = 2000,
+  GameInfo_CompType_MSG_TYPE = 81
+};
+bool GameInfo_CompType_IsValid(int value);
+constexpr GameInfo_CompType GameInfo_CompType_CompType_MIN = GameInfo_CompType_MSG_TYPE;
+constexpr GameInfo_CompType GameInfo_CompType_CompType_MAX = GameInfo_CompType_COMP_ID;
+constexpr int GameInfo_CompType_CompType_ARRAYSIZE = GameInfo_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GameInfo_CompType_descriptor();
+template<typename T>
+inline const std::string& GameInfo_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, GameInfo_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function GameInfo_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    GameInfo_CompType_descriptor(), enum_t_value);
+}
+inline bool GameInfo_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, GameInfo_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<GameInfo_CompType>(
+    GameInfo_CompType_descriptor(), name, value);
+}
+enum SetTeamName_CompType : int {
+  SetTeamName_CompType_COMP_ID = 2000,
+  SetTeamName_CompType_MSG_TYPE = 82
+};
+bool SetTeamName_CompType_IsValid(int value);
+constexpr SetTeamName_CompType SetTeamName_CompType_CompType_MIN = SetTeamName_CompType_MSG_TYPE;
+constexpr SetTeamName_CompType SetTeamName_CompType_CompType_MAX = SetTeamName_CompType_COMP_ID;
+constexpr int SetTeamName_CompType_CompType_ARRAYSIZE = SetTeamName_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetTeamName_CompType_descriptor();
+template<typename T>
+inline const std::string& SetTeamName_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SetTeamName_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SetTeamName_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SetTeamName_CompType_descriptor(), enum_t_value);
+}
+inline bool SetTeamName_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SetTeamName_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SetTeamName_CompType>(
+    SetTeamName_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class GameInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.GameInfo) */ {
+ public:
+  inline GameInfo() : GameInfo(nullptr) {}
+  ~GameInfo() override;
+  explicit PROTOBUF_CONSTEXPR GameInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameInfo(const GameInfo& from);
+  GameInfo(GameInfo&& from) noexcept
+    : GameInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline GameInfo& operator=(const GameInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameInfo& operator=(GameInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameInfo* internal_default_instance() {
+    return reinterpret_cast<const GameInfo*>(
+               &_GameInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(GameInfo& a, GameInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameInfo& from) {
+    GameInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.GameInfo";
+  }
+  protected:
+  explicit GameInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef GameInfo_CompType CompType;
+  static constexpr CompType COMP_ID =
+    GameInfo_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    GameInfo_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return GameInfo_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    GameInfo_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    GameInfo_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    GameInfo_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return GameInfo_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return GameInfo_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return GameInfo_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKnownTeamsFieldNumber = 1,
+  };
+  // repeated string known_teams = 1;
+  int known_teams_size() const;
+  private:
+  int _internal_known_teams_size() const;
+  public:
+  void clear_known_teams();
+  const std::string& known_teams(int index) const;
+  std::string* mutable_known_teams(int index);
+  void set_known_teams(int index, const std::string& value);
+  void set_known_teams(int index, std::string&& value);
+  void set_known_teams(int index, const char* value);
+  void set_known_teams(int index, const char* value, size_t size);
+  std::string* add_known_teams();
+  void add_known_teams(const std::string& value);
+  void add_known_teams(std::string&& value);
+  void add_known_teams(const char* value);
+  void add_known_teams(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& known_teams() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_known_teams();
+  private:
+  const std::string& _internal_known_teams(int index) const;
+  std::string* _internal_add_known_teams();
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.GameInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> known_teams_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GameInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetTeamName final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.SetTeamName) */ {
+ public:
+  inline SetTeamName() : SetTeamName(nullptr) {}
+  ~SetTeamName() override;
+  explicit PROTOBUF_CONSTEXPR SetTeamName(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetTeamName(const SetTeamName& from);
+  SetTeamName(SetTeamName&& from) noexcept
+    : SetTeamName() {
+    *this = ::std::move(from);
+  }
+
+  inline SetTeamName& operator=(const SetTeamName& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetTeamName& operator=(SetTeamName&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetTeamName& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetTeamName* internal_default_instance() {
+    return reinterpret_cast<const SetTeamName*>(
+               &_SetTeamName_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(SetTeamName& a, SetTeamName& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetTeamName* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetTeamName* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetTeamName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetTeamName>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetTeamName& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetTeamName& from) {
+    SetTeamName::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetTeamName* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.SetTeamName";
+  }
+  protected:
+  explicit SetTeamName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SetTeamName_CompType CompType;
+  static constexpr CompType COMP_ID =
+    SetTeamName_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    SetTeamName_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return SetTeamName_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    SetTeamName_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    SetTeamName_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    SetTeamName_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return SetTeamName_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return SetTeamName_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return SetTeamName_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTeamNameFieldNumber = 1,
+    kTeamColorFieldNumber = 2,
+  };
+  // required string team_name = 1;
+  bool has_team_name() const;
+  private:
+  bool _internal_has_team_name() const;
+  public:
+  void clear_team_name();
+  const std::string& team_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_team_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_team_name();
+  PROTOBUF_NODISCARD std::string* release_team_name();
+  void set_allocated_team_name(std::string* team_name);
+  private:
+  const std::string& _internal_team_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_team_name(const std::string& value);
+  std::string* _internal_mutable_team_name();
+  public:
+
+  // required .llsf_msgs.Team team_color = 2;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.SetTeamName)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr team_name_;
+    int team_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GameInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// GameInfo
+
+// repeated string known_teams = 1;
+inline int GameInfo::_internal_known_teams_size() const {
+  return _impl_.known_teams_.size();
+}
+inline int GameInfo::known_teams_size() const {
+  return _internal_known_teams_size();
+}
+inline void GameInfo::clear_known_teams() {
+  _impl_.known_teams_.Clear();
+}
+inline std::string* GameInfo::add_known_teams() {
+  std::string* _s = _internal_add_known_teams();
+  // @@protoc_insertion_point(field_add_mutable:llsf_msgs.GameInfo.known_teams)
+  return _s;
+}
+inline const std::string& GameInfo::_internal_known_teams(int index) const {
+  return _impl_.known_teams_.Get(index);
+}
+inline const std::string& GameInfo::known_teams(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.GameInfo.known_teams)
+  return _internal_known_teams(index);
+}
+inline std::string* GameInfo::mutable_known_teams(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.GameInfo.known_teams)
+  return _impl_.known_teams_.Mutable(index);
+}
+inline void GameInfo::set_known_teams(int index, const std::string& value) {
+  _impl_.known_teams_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.GameInfo.known_teams)
+}
+inline void GameInfo::set_known_teams(int index, std::string&& value) {
+  _impl_.known_teams_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:llsf_msgs.GameInfo.known_teams)
+}
+inline void GameInfo::set_known_teams(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.known_teams_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:llsf_msgs.GameInfo.known_teams)
+}
+inline void GameInfo::set_known_teams(int index, const char* value, size_t size) {
+  _impl_.known_teams_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:llsf_msgs.GameInfo.known_teams)
+}
+inline std::string* GameInfo::_internal_add_known_teams() {
+  return _impl_.known_teams_.Add();
+}
+inline void GameInfo::add_known_teams(const std::string& value) {
+  _impl_.known_teams_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:llsf_msgs.GameInfo.known_teams)
+}
+inline void GameInfo::add_known_teams(std::string&& value) {
+  _impl_.known_teams_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:llsf_msgs.GameInfo.known_teams)
+}
+inline void GameInfo::add_known_teams(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.known_teams_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:llsf_msgs.GameInfo.known_teams)
+}
+inline void GameInfo::add_known_teams(const char* value, size_t size) {
+  _impl_.known_teams_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:llsf_msgs.GameInfo.known_teams)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+GameInfo::known_teams() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.GameInfo.known_teams)
+  return _impl_.known_teams_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+GameInfo::mutable_known_teams() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.GameInfo.known_teams)
+  return &_impl_.known_teams_;
+}
+
+// -------------------------------------------------------------------
+
+// SetTeamName
+
+// required string team_name = 1;
+inline bool SetTeamName::_internal_has_team_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SetTeamName::has_team_name() const {
+  return _internal_has_team_name();
+}
+inline void SetTeamName::clear_team_name() {
+  _impl_.team_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SetTeamName::team_name() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetTeamName.team_name)
+  return _internal_team_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetTeamName::set_team_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.team_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetTeamName.team_name)
+}
+inline std::string* SetTeamName::mutable_team_name() {
+  std::string* _s = _internal_mutable_team_name();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.SetTeamName.team_name)
+  return _s;
+}
+inline const std::string& SetTeamName::_internal_team_name() const {
+  return _impl_.team_name_.Get();
+}
+inline void SetTeamName::_internal_set_team_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.team_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetTeamName::_internal_mutable_team_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.team_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SetTeamName::release_team_name() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.SetTeamName.team_name)
+  if (!_internal_has_team_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.team_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.team_name_.IsDefault()) {
+    _impl_.team_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SetTeamName::set_allocated_team_name(std::string* team_name) {
+  if (team_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.team_name_.SetAllocated(team_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.team_name_.IsDefault()) {
+    _impl_.team_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.SetTeamName.team_name)
+}
+
+// required .llsf_msgs.Team team_color = 2;
+inline bool SetTeamName::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SetTeamName::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void SetTeamName::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::llsf_msgs::Team SetTeamName::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team SetTeamName::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetTeamName.team_color)
+  return _internal_team_color();
+}
+inline void SetTeamName::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.team_color_ = value;
+}
+inline void SetTeamName::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetTeamName.team_color)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::GameInfo_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::GameInfo_CompType>() {
+  return ::llsf_msgs::GameInfo_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::SetTeamName_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::SetTeamName_CompType>() {
+  return ::llsf_msgs::SetTeamName_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_GameInfo_2eproto
@@ -0,0 +1,1286 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: GameState.proto
+
+#include "GameState.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR GameState::GameState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.team_cyan_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.team_magenta_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.game_time_)*/nullptr
+  , /*decltype(_impl_.state_)*/0
+  , /*decltype(_impl_.phase_)*/0
+  , /*decltype(_impl_.points_cyan_)*/0u
+  , /*decltype(_impl_.points_magenta_)*/0u} {}
+struct GameStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameStateDefaultTypeInternal() {}
+  union {
+    GameState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameStateDefaultTypeInternal _GameState_default_instance_;
+PROTOBUF_CONSTEXPR SetGameState::SetGameState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.state_)*/0} {}
+struct SetGameStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetGameStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetGameStateDefaultTypeInternal() {}
+  union {
+    SetGameState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetGameStateDefaultTypeInternal _SetGameState_default_instance_;
+PROTOBUF_CONSTEXPR SetGamePhase::SetGamePhase(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.phase_)*/0} {}
+struct SetGamePhaseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetGamePhaseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetGamePhaseDefaultTypeInternal() {}
+  union {
+    SetGamePhase _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetGamePhaseDefaultTypeInternal _SetGamePhase_default_instance_;
+PROTOBUF_CONSTEXPR RandomizeField::RandomizeField(
+    ::_pbi::ConstantInitialized) {}
+struct RandomizeFieldDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RandomizeFieldDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RandomizeFieldDefaultTypeInternal() {}
+  union {
+    RandomizeField _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RandomizeFieldDefaultTypeInternal _RandomizeField_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_GameState_2eproto[4];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_GameState_2eproto[6];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_GameState_2eproto = nullptr;
+
+const uint32_t TableStruct_GameState_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameState, _impl_.game_time_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameState, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameState, _impl_.phase_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameState, _impl_.points_cyan_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameState, _impl_.team_cyan_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameState, _impl_.points_magenta_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::GameState, _impl_.team_magenta_),
+  2,
+  3,
+  4,
+  5,
+  0,
+  6,
+  1,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetGameState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetGameState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetGameState, _impl_.state_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetGamePhase, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetGamePhase, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetGamePhase, _impl_.phase_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::RandomizeField, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::llsf_msgs::GameState)},
+  { 20, 27, -1, sizeof(::llsf_msgs::SetGameState)},
+  { 28, 35, -1, sizeof(::llsf_msgs::SetGamePhase)},
+  { 36, -1, -1, sizeof(::llsf_msgs::RandomizeField)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_GameState_default_instance_._instance,
+  &::llsf_msgs::_SetGameState_default_instance_._instance,
+  &::llsf_msgs::_SetGamePhase_default_instance_._instance,
+  &::llsf_msgs::_RandomizeField_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_GameState_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017GameState.proto\022\tllsf_msgs\032\nTime.proto"
+  "\"\221\003\n\tGameState\022\"\n\tgame_time\030\001 \002(\0132\017.llsf"
+  "_msgs.Time\022)\n\005state\030\003 \002(\0162\032.llsf_msgs.Ga"
+  "meState.State\022)\n\005phase\030\004 \002(\0162\032.llsf_msgs"
+  ".GameState.Phase\022\023\n\013points_cyan\030\005 \001(\r\022\021\n"
+  "\tteam_cyan\030\006 \001(\t\022\026\n\016points_magenta\030\010 \001(\r"
+  "\022\024\n\014team_magenta\030\t \001(\t\"&\n\010CompType\022\014\n\007CO"
+  "MP_ID\020\320\017\022\014\n\010MSG_TYPE\020\024\":\n\005State\022\010\n\004INIT\020"
+  "\000\022\016\n\nWAIT_START\020\001\022\013\n\007RUNNING\020\002\022\n\n\006PAUSED"
+  "\020\003\"P\n\005Phase\022\014\n\010PRE_GAME\020\000\022\t\n\005SETUP\020\n\022\017\n\013"
+  "EXPLORATION\020\024\022\016\n\nPRODUCTION\020\036\022\r\n\tPOST_GA"
+  "ME\020(\"a\n\014SetGameState\022)\n\005state\030\001 \002(\0162\032.ll"
+  "sf_msgs.GameState.State\"&\n\010CompType\022\014\n\007C"
+  "OMP_ID\020\320\017\022\014\n\010MSG_TYPE\020\025\"a\n\014SetGamePhase\022"
+  ")\n\005phase\030\001 \002(\0162\032.llsf_msgs.GameState.Pha"
+  "se\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE"
+  "\020\026\"8\n\016RandomizeField\"&\n\010CompType\022\014\n\007COMP"
+  "_ID\020\320\017\022\014\n\010MSG_TYPE\020\027B2\n\037org.robocup_logi"
+  "stics.llsf_msgsB\017GameStateProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_GameState_2eproto_deps[1] = {
+  &::descriptor_table_Time_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_GameState_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_GameState_2eproto = {
+    false, false, 752, descriptor_table_protodef_GameState_2eproto,
+    "GameState.proto",
+    &descriptor_table_GameState_2eproto_once, descriptor_table_GameState_2eproto_deps, 1, 4,
+    schemas, file_default_instances, TableStruct_GameState_2eproto::offsets,
+    file_level_metadata_GameState_2eproto, file_level_enum_descriptors_GameState_2eproto,
+    file_level_service_descriptors_GameState_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_GameState_2eproto_getter() {
+  return &descriptor_table_GameState_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_GameState_2eproto(&descriptor_table_GameState_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GameState_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_GameState_2eproto);
+  return file_level_enum_descriptors_GameState_2eproto[0];
+}
+bool GameState_CompType_IsValid(int value) {
+  switch (value) {
+    case 20:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr GameState_CompType GameState::COMP_ID;
+constexpr GameState_CompType GameState::MSG_TYPE;
+constexpr GameState_CompType GameState::CompType_MIN;
+constexpr GameState_CompType GameState::CompType_MAX;
+constexpr int GameState::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GameState_State_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_GameState_2eproto);
+  return file_level_enum_descriptors_GameState_2eproto[1];
+}
+bool GameState_State_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr GameState_State GameState::INIT;
+constexpr GameState_State GameState::WAIT_START;
+constexpr GameState_State GameState::RUNNING;
+constexpr GameState_State GameState::PAUSED;
+constexpr GameState_State GameState::State_MIN;
+constexpr GameState_State GameState::State_MAX;
+constexpr int GameState::State_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GameState_Phase_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_GameState_2eproto);
+  return file_level_enum_descriptors_GameState_2eproto[2];
+}
+bool GameState_Phase_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 10:
+    case 20:
+    case 30:
+    case 40:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr GameState_Phase GameState::PRE_GAME;
+constexpr GameState_Phase GameState::SETUP;
+constexpr GameState_Phase GameState::EXPLORATION;
+constexpr GameState_Phase GameState::PRODUCTION;
+constexpr GameState_Phase GameState::POST_GAME;
+constexpr GameState_Phase GameState::Phase_MIN;
+constexpr GameState_Phase GameState::Phase_MAX;
+constexpr int GameState::Phase_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetGameState_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_GameState_2eproto);
+  return file_level_enum_descriptors_GameState_2eproto[3];
+}
+bool SetGameState_CompType_IsValid(int value) {
+  switch (value) {
+    case 21:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SetGameState_CompType SetGameState::COMP_ID;
+constexpr SetGameState_CompType SetGameState::MSG_TYPE;
+constexpr SetGameState_CompType SetGameState::CompType_MIN;
+constexpr SetGameState_CompType SetGameState::CompType_MAX;
+constexpr int SetGameState::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetGamePhase_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_GameState_2eproto);
+  return file_level_enum_descriptors_GameState_2eproto[4];
+}
+bool SetGamePhase_CompType_IsValid(int value) {
+  switch (value) {
+    case 22:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SetGamePhase_CompType SetGamePhase::COMP_ID;
+constexpr SetGamePhase_CompType SetGamePhase::MSG_TYPE;
+constexpr SetGamePhase_CompType SetGamePhase::CompType_MIN;
+constexpr SetGamePhase_CompType SetGamePhase::CompType_MAX;
+constexpr int SetGamePhase::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RandomizeField_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_GameState_2eproto);
+  return file_level_enum_descriptors_GameState_2eproto[5];
+}
+bool RandomizeField_CompType_IsValid(int value) {
+  switch (value) {
+    case 23:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr RandomizeField_CompType RandomizeField::COMP_ID;
+constexpr RandomizeField_CompType RandomizeField::MSG_TYPE;
+constexpr RandomizeField_CompType RandomizeField::CompType_MIN;
+constexpr RandomizeField_CompType RandomizeField::CompType_MAX;
+constexpr int RandomizeField::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class GameState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GameState>()._impl_._has_bits_);
+  static const ::llsf_msgs::Time& game_time(const GameState* msg);
+  static void set_has_game_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_phase(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_points_cyan(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_team_cyan(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_points_magenta(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_team_magenta(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001c) ^ 0x0000001c) != 0;
+  }
+};
+
+const ::llsf_msgs::Time&
+GameState::_Internal::game_time(const GameState* msg) {
+  return *msg->_impl_.game_time_;
+}
+void GameState::clear_game_time() {
+  if (_impl_.game_time_ != nullptr) _impl_.game_time_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+GameState::GameState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.GameState)
+}
+GameState::GameState(const GameState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.team_cyan_){}
+    , decltype(_impl_.team_magenta_){}
+    , decltype(_impl_.game_time_){nullptr}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.phase_){}
+    , decltype(_impl_.points_cyan_){}
+    , decltype(_impl_.points_magenta_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.team_cyan_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.team_cyan_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_team_cyan()) {
+    _this->_impl_.team_cyan_.Set(from._internal_team_cyan(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.team_magenta_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.team_magenta_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_team_magenta()) {
+    _this->_impl_.team_magenta_.Set(from._internal_team_magenta(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_game_time()) {
+    _this->_impl_.game_time_ = new ::llsf_msgs::Time(*from._impl_.game_time_);
+  }
+  ::memcpy(&_impl_.state_, &from._impl_.state_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.points_magenta_) -
+    reinterpret_cast<char*>(&_impl_.state_)) + sizeof(_impl_.points_magenta_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.GameState)
+}
+
+inline void GameState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.team_cyan_){}
+    , decltype(_impl_.team_magenta_){}
+    , decltype(_impl_.game_time_){nullptr}
+    , decltype(_impl_.state_){0}
+    , decltype(_impl_.phase_){0}
+    , decltype(_impl_.points_cyan_){0u}
+    , decltype(_impl_.points_magenta_){0u}
+  };
+  _impl_.team_cyan_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.team_cyan_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.team_magenta_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.team_magenta_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GameState::~GameState() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.GameState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GameState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.team_cyan_.Destroy();
+  _impl_.team_magenta_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.game_time_;
+}
+
+void GameState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GameState::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.GameState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.team_cyan_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.team_magenta_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.game_time_ != nullptr);
+      _impl_.game_time_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000078u) {
+    ::memset(&_impl_.state_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.points_magenta_) -
+        reinterpret_cast<char*>(&_impl_.state_)) + sizeof(_impl_.points_magenta_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.Time game_time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_game_time(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.GameState.State state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::GameState_State_IsValid(val))) {
+            _internal_set_state(static_cast<::llsf_msgs::GameState_State>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.GameState.Phase phase = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::GameState_Phase_IsValid(val))) {
+            _internal_set_phase(static_cast<::llsf_msgs::GameState_Phase>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 points_cyan = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_points_cyan(&has_bits);
+          _impl_.points_cyan_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string team_cyan = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_team_cyan();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.GameState.team_cyan");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 points_magenta = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_points_magenta(&has_bits);
+          _impl_.points_magenta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string team_magenta = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_team_magenta();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.GameState.team_magenta");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GameState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.GameState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Time game_time = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::game_time(this),
+        _Internal::game_time(this).GetCachedSize(), target, stream);
+  }
+
+  // required .llsf_msgs.GameState.State state = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_state(), target);
+  }
+
+  // required .llsf_msgs.GameState.Phase phase = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_phase(), target);
+  }
+
+  // optional uint32 points_cyan = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_points_cyan(), target);
+  }
+
+  // optional string team_cyan = 6;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_team_cyan().data(), static_cast<int>(this->_internal_team_cyan().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.GameState.team_cyan");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_team_cyan(), target);
+  }
+
+  // optional uint32 points_magenta = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_points_magenta(), target);
+  }
+
+  // optional string team_magenta = 9;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_team_magenta().data(), static_cast<int>(this->_internal_team_magenta().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.GameState.team_magenta");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_team_magenta(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.GameState)
+  return target;
+}
+
+size_t GameState::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.GameState)
+  size_t total_size = 0;
+
+  if (_internal_has_game_time()) {
+    // required .llsf_msgs.Time game_time = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.game_time_);
+  }
+
+  if (_internal_has_state()) {
+    // required .llsf_msgs.GameState.State state = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+  }
+
+  if (_internal_has_phase()) {
+    // required .llsf_msgs.GameState.Phase phase = 4;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_phase());
+  }
+
+  return total_size;
+}
+size_t GameState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.GameState)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001c) ^ 0x0000001c) == 0) {  // All required fields are present.
+    // required .llsf_msgs.Time game_time = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.game_time_);
+
+    // required .llsf_msgs.GameState.State state = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+
+    // required .llsf_msgs.GameState.Phase phase = 4;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_phase());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string team_cyan = 6;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_team_cyan());
+    }
+
+    // optional string team_magenta = 9;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_team_magenta());
+    }
+
+  }
+  if (cached_has_bits & 0x00000060u) {
+    // optional uint32 points_cyan = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_points_cyan());
+    }
+
+    // optional uint32 points_magenta = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_points_magenta());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameState::GetClassData() const { return &_class_data_; }
+
+
+void GameState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameState*>(&to_msg);
+  auto& from = static_cast<const GameState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.GameState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_team_cyan(from._internal_team_cyan());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_team_magenta(from._internal_team_magenta());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_game_time()->::llsf_msgs::Time::MergeFrom(
+          from._internal_game_time());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.state_ = from._impl_.state_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.phase_ = from._impl_.phase_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.points_cyan_ = from._impl_.points_cyan_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.points_magenta_ = from._impl_.points_magenta_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GameState::CopyFrom(const GameState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.GameState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GameState::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_game_time()) {
+    if (!_impl_.game_time_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void GameState::InternalSwap(GameState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.team_cyan_, lhs_arena,
+      &other->_impl_.team_cyan_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.team_magenta_, lhs_arena,
+      &other->_impl_.team_magenta_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameState, _impl_.points_magenta_)
+      + sizeof(GameState::_impl_.points_magenta_)
+      - PROTOBUF_FIELD_OFFSET(GameState, _impl_.game_time_)>(
+          reinterpret_cast<char*>(&_impl_.game_time_),
+          reinterpret_cast<char*>(&other->_impl_.game_time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GameState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GameState_2eproto_getter, &descriptor_table_GameState_2eproto_once,
+      file_level_metadata_GameState_2eproto[0]);
+}
+
+// ===================================================================
+
+class SetGameState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SetGameState>()._impl_._has_bits_);
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+SetGameState::SetGameState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.SetGameState)
+}
+SetGameState::SetGameState(const SetGameState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetGameState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.state_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.state_ = from._impl_.state_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.SetGameState)
+}
+
+inline void SetGameState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.state_){0}
+  };
+}
+
+SetGameState::~SetGameState() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.SetGameState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetGameState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SetGameState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetGameState::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.SetGameState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.state_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetGameState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.GameState.State state = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::GameState_State_IsValid(val))) {
+            _internal_set_state(static_cast<::llsf_msgs::GameState_State>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetGameState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.SetGameState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.GameState.State state = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_state(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.SetGameState)
+  return target;
+}
+
+size_t SetGameState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.SetGameState)
+  size_t total_size = 0;
+
+  // required .llsf_msgs.GameState.State state = 1;
+  if (_internal_has_state()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetGameState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetGameState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetGameState::GetClassData() const { return &_class_data_; }
+
+
+void SetGameState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetGameState*>(&to_msg);
+  auto& from = static_cast<const SetGameState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.SetGameState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_state()) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetGameState::CopyFrom(const SetGameState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.SetGameState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetGameState::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SetGameState::InternalSwap(SetGameState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.state_, other->_impl_.state_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetGameState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GameState_2eproto_getter, &descriptor_table_GameState_2eproto_once,
+      file_level_metadata_GameState_2eproto[1]);
+}
+
+// ===================================================================
+
+class SetGamePhase::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SetGamePhase>()._impl_._has_bits_);
+  static void set_has_phase(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+SetGamePhase::SetGamePhase(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.SetGamePhase)
+}
+SetGamePhase::SetGamePhase(const SetGamePhase& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetGamePhase* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.phase_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.phase_ = from._impl_.phase_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.SetGamePhase)
+}
+
+inline void SetGamePhase::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.phase_){0}
+  };
+}
+
+SetGamePhase::~SetGamePhase() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.SetGamePhase)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetGamePhase::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SetGamePhase::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetGamePhase::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.SetGamePhase)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.phase_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetGamePhase::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.GameState.Phase phase = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::GameState_Phase_IsValid(val))) {
+            _internal_set_phase(static_cast<::llsf_msgs::GameState_Phase>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetGamePhase::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.SetGamePhase)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.GameState.Phase phase = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_phase(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.SetGamePhase)
+  return target;
+}
+
+size_t SetGamePhase::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.SetGamePhase)
+  size_t total_size = 0;
+
+  // required .llsf_msgs.GameState.Phase phase = 1;
+  if (_internal_has_phase()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_phase());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetGamePhase::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetGamePhase::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetGamePhase::GetClassData() const { return &_class_data_; }
+
+
+void SetGamePhase::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetGamePhase*>(&to_msg);
+  auto& from = static_cast<const SetGamePhase&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.SetGamePhase)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_phase()) {
+    _this->_internal_set_phase(from._internal_phase());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetGamePhase::CopyFrom(const SetGamePhase& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.SetGamePhase)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetGamePhase::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SetGamePhase::InternalSwap(SetGamePhase* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.phase_, other->_impl_.phase_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetGamePhase::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GameState_2eproto_getter, &descriptor_table_GameState_2eproto_once,
+      file_level_metadata_GameState_2eproto[2]);
+}
+
+// ===================================================================
+
+class RandomizeField::_Internal {
+ public:
+};
+
+RandomizeField::RandomizeField(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.RandomizeField)
+}
+RandomizeField::RandomizeField(const RandomizeField& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  RandomizeField* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.RandomizeField)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RandomizeField::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RandomizeField::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata RandomizeField::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GameState_2eproto_getter, &descriptor_table_GameState_2eproto_once,
+      file_level_metadata_GameState_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::GameState*
+Arena::CreateMaybeMessage< ::llsf_msgs::GameState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::GameState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::SetGameState*
+Arena::CreateMaybeMessage< ::llsf_msgs::SetGameState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::SetGameState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::SetGamePhase*
+Arena::CreateMaybeMessage< ::llsf_msgs::SetGamePhase >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::SetGamePhase >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::RandomizeField*
+Arena::CreateMaybeMessage< ::llsf_msgs::RandomizeField >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::RandomizeField >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
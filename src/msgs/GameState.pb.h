@@ -0,0 +1,1588 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: GameState.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_GameState_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_GameState_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Time.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_GameState_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_GameState_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_GameState_2eproto;
+namespace llsf_msgs {
+class GameState;
+struct GameStateDefaultTypeInternal;
+extern GameStateDefaultTypeInternal _GameState_default_instance_;
+class RandomizeField;
+struct RandomizeFieldDefaultTypeInternal;
+extern RandomizeFieldDefaultTypeInternal _RandomizeField_default_instance_;
+class SetGamePhase;
+struct SetGamePhaseDefaultTypeInternal;
+extern SetGamePhaseDefaultTypeInternal _SetGamePhase_default_instance_;
+class SetGameState;
+struct SetGameStateDefaultTypeInternal;
+extern SetGameStateDefaultTypeInternal _SetGameState_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::GameState* Arena::CreateMaybeMessage<::llsf_msgs::GameState>(Arena*);
+template<> ::llsf_msgs::RandomizeField* Arena::CreateMaybeMessage<::llsf_msgs::RandomizeField>(Arena*);
+template<> ::llsf_msgs::SetGamePhase* Arena::CreateMaybeMessage<::llsf_msgs::SetGamePhase>(Arena*);
+template<> ::llsf_msgs::SetGameState* Arena::CreateMaybeMessage<::llsf_msgs::SetGameState>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum GameState_CompType : int {
+  GameState_CompType_COMP_ID = 2000,
+  GameState_CompType_MSG_TYPE = 20
+};
+bool GameState_CompType_IsValid(int value);
+constexpr GameState_CompType GameState_CompType_CompType_MIN = GameState_CompType_MSG_TYPE;
+constexpr GameState_CompType GameState_CompType_CompType_MAX = GameState_CompType_COMP_ID;
+constexpr int GameState_CompType_CompType_ARRAYSIZE = GameState_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GameState_CompType_descriptor();
+template<typename T>
+inline const std::string& GameState_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, GameState_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function GameState_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    GameState_CompType_descriptor(), enum_t_value);
+}
+inline bool GameState_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, GameState_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<GameState_CompType>(
+    GameState_CompType_descriptor(), name, value);
+}
+enum GameState_State : int {
+  GameState_State_INIT = 0,
+  GameState_State_WAIT_START = 1,
+  GameState_State_RUNNING = 2,
+  GameState_State_PAUSED = 3
+};
+bool GameState_State_IsValid(int value);
+constexpr GameState_State GameState_State_State_MIN = GameState_State_INIT;
+constexpr GameState_State GameState_State_State_MAX = GameState_State_PAUSED;
+constexpr int GameState_State_State_ARRAYSIZE = GameState_State_State_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GameState_State_descriptor();
+template<typename T>
+inline const std::string& GameState_State_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, GameState_State>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function GameState_State_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    GameState_State_descriptor(), enum_t_value);
+}
+inline bool GameState_State_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, GameState_State* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<GameState_State>(
+    GameState_State_descriptor(), name, value);
+}
+enum GameState_Phase : int {
+  GameState_Phase_PRE_GAME = 0,
+  GameState_Phase_SETUP = 10,
+  GameState_Phase_EXPLORATION = 20,
+  GameState_Phase_PRODUCTION = 30,
+  GameState_Phase_POST_GAME = 40
+};
+bool GameState_Phase_IsValid(int value);
+constexpr GameState_Phase GameState_Phase_Phase_MIN = GameState_Phase_PRE_GAME;
+constexpr GameState_Phase GameState_Phase_Phase_MAX = GameState_Phase_POST_GAME;
+constexpr int GameState_Phase_Phase_ARRAYSIZE = GameState_Phase_Phase_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GameState_Phase_descriptor();
+template<typename T>
+inline const std::string& GameState_Phase_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, GameState_Phase>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function GameState_Phase_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    GameState_Phase_descriptor(), enum_t_value);
+}
+inline bool GameState_Phase_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, GameState_Phase* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<GameState_Phase>(
+    GameState_Phase_descriptor(), name, value);
+}
+enum SetGameState_CompType : int {
+  SetGameState_CompType_COMP_ID = 2000,
+  SetGameState_CompType_MSG_TYPE = 21
+};
+bool SetGameState_CompType_IsValid(int value);
+constexpr SetGameState_CompType SetGameState_CompType_CompType_MIN = SetGameState_CompType_MSG_TYPE;
+constexpr SetGameState_CompType SetGameState_CompType_CompType_MAX = SetGameState_CompType_COMP_ID;
+constexpr int SetGameState_CompType_CompType_ARRAYSIZE = SetGameState_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetGameState_CompType_descriptor();
+template<typename T>
+inline const std::string& SetGameState_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SetGameState_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SetGameState_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SetGameState_CompType_descriptor(), enum_t_value);
+}
+inline bool SetGameState_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SetGameState_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SetGameState_CompType>(
+    SetGameState_CompType_descriptor(), name, value);
+}
+enum SetGamePhase_CompType : int {
+  SetGamePhase_CompType_COMP_ID = 2000,
+  SetGamePhase_CompType_MSG_TYPE = 22
+};
+bool SetGamePhase_CompType_IsValid(int value);
+constexpr SetGamePhase_CompType SetGamePhase_CompType_CompType_MIN = SetGamePhase_CompType_MSG_TYPE;
+constexpr SetGamePhase_CompType SetGamePhase_CompType_CompType_MAX = SetGamePhase_CompType_COMP_ID;
+constexpr int SetGamePhase_CompType_CompType_ARRAYSIZE = SetGamePhase_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetGamePhase_CompType_descriptor();
+template<typename T>
+inline const std::string& SetGamePhase_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SetGamePhase_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SetGamePhase_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SetGamePhase_CompType_descriptor(), enum_t_value);
+}
+inline bool SetGamePhase_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SetGamePhase_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SetGamePhase_CompType>(
+    SetGamePhase_CompType_descriptor(), name, value);
+}
+enum RandomizeField_CompType : int {
+  RandomizeField_CompType_COMP_ID = 2000,
+  RandomizeField_CompType_MSG_TYPE = 23
+};
+bool RandomizeField_CompType_IsValid(int value);
+constexpr RandomizeField_CompType RandomizeField_CompType_CompType_MIN = RandomizeField_CompType_MSG_TYPE;
+constexpr RandomizeField_CompType RandomizeField_CompType_CompType_MAX = RandomizeField_CompType_COMP_ID;
+constexpr int RandomizeField_CompType_CompType_ARRAYSIZE = RandomizeField_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RandomizeField_CompType_descriptor();
+template<typename T>
+inline const std::string& RandomizeField_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RandomizeField_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RandomizeField_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RandomizeField_CompType_descriptor(), enum_t_value);
+}
+inline bool RandomizeField_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RandomizeField_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RandomizeField_CompType>(
+    RandomizeField_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class GameState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.GameState) */ {
+ public:
+  inline GameState() : GameState(nullptr) {}
+  ~GameState() override;
+  explicit PROTOBUF_CONSTEXPR GameState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameState(const GameState& from);
+  GameState(GameState&& from) noexcept
+    : GameState() {
+    *this = ::std::move(from);
+  }
+
+  inline GameState& operator=(const GameState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameState& operator=(GameState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameState* internal_default_instance() {
+    return reinterpret_cast<const GameState*>(
+               &_GameState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(GameState& a, GameState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameState& from) {
+    GameState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.GameState";
+  }
+  protected:
+  explicit GameState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef GameState_CompType CompType;
+  static constexpr CompType COMP_ID =
+    GameState_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    GameState_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return GameState_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    GameState_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    GameState_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    GameState_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return GameState_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return GameState_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return GameState_CompType_Parse(name, value);
+  }
+
+  typedef GameState_State State;
+  static constexpr State INIT =
+    GameState_State_INIT;
+  static constexpr State WAIT_START =
+    GameState_State_WAIT_START;
+  static constexpr State RUNNING =
+    GameState_State_RUNNING;
+  static constexpr State PAUSED =
+    GameState_State_PAUSED;
+  static inline bool State_IsValid(int value) {
+    return GameState_State_IsValid(value);
+  }
+  static constexpr State State_MIN =
+    GameState_State_State_MIN;
+  static constexpr State State_MAX =
+    GameState_State_State_MAX;
+  static constexpr int State_ARRAYSIZE =
+    GameState_State_State_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  State_descriptor() {
+    return GameState_State_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& State_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, State>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function State_Name.");
+    return GameState_State_Name(enum_t_value);
+  }
+  static inline bool State_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      State* value) {
+    return GameState_State_Parse(name, value);
+  }
+
+  typedef GameState_Phase Phase;
+  static constexpr Phase PRE_GAME =
+    GameState_Phase_PRE_GAME;
+  static constexpr Phase SETUP =
+    GameState_Phase_SETUP;
+  static constexpr Phase EXPLORATION =
+    GameState_Phase_EXPLORATION;
+  static constexpr Phase PRODUCTION =
+    GameState_Phase_PRODUCTION;
+  static constexpr Phase POST_GAME =
+    GameState_Phase_POST_GAME;
+  static inline bool Phase_IsValid(int value) {
+    return GameState_Phase_IsValid(value);
+  }
+  static constexpr Phase Phase_MIN =
+    GameState_Phase_Phase_MIN;
+  static constexpr Phase Phase_MAX =
+    GameState_Phase_Phase_MAX;
+  static constexpr int Phase_ARRAYSIZE =
+    GameState_Phase_Phase_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Phase_descriptor() {
+    return GameState_Phase_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Phase_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Phase>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Phase_Name.");
+    return GameState_Phase_Name(enum_t_value);
+  }
+  static inline bool Phase_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Phase* value) {
+    return GameState_Phase_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTeamCyanFieldNumber = 6,
+    kTeamMagentaFieldNumber = 9,
+    kGameTimeFieldNumber = 1,
+    kStateFieldNumber = 3,
+    kPhaseFieldNumber = 4,
+    kPointsCyanFieldNumber = 5,
+    kPointsMagentaFieldNumber = 8,
+  };
+  // optional string team_cyan = 6;
+  bool has_team_cyan() const;
+  private:
+  bool _internal_has_team_cyan() const;
+  public:
+  void clear_team_cyan();
+  const std::string& team_cyan() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_team_cyan(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_team_cyan();
+  PROTOBUF_NODISCARD std::string* release_team_cyan();
+  void set_allocated_team_cyan(std::string* team_cyan);
+  private:
+  const std::string& _internal_team_cyan() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_team_cyan(const std::string& value);
+  std::string* _internal_mutable_team_cyan();
+  public:
+
+  // optional string team_magenta = 9;
+  bool has_team_magenta() const;
+  private:
+  bool _internal_has_team_magenta() const;
+  public:
+  void clear_team_magenta();
+  const std::string& team_magenta() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_team_magenta(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_team_magenta();
+  PROTOBUF_NODISCARD std::string* release_team_magenta();
+  void set_allocated_team_magenta(std::string* team_magenta);
+  private:
+  const std::string& _internal_team_magenta() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_team_magenta(const std::string& value);
+  std::string* _internal_mutable_team_magenta();
+  public:
+
+  // required .llsf_msgs.Time game_time = 1;
+  bool has_game_time() const;
+  private:
+  bool _internal_has_game_time() const;
+  public:
+  void clear_game_time();
+  const ::llsf_msgs::Time& game_time() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::Time* release_game_time();
+  ::llsf_msgs::Time* mutable_game_time();
+  void set_allocated_game_time(::llsf_msgs::Time* game_time);
+  private:
+  const ::llsf_msgs::Time& _internal_game_time() const;
+  ::llsf_msgs::Time* _internal_mutable_game_time();
+  public:
+  void unsafe_arena_set_allocated_game_time(
+      ::llsf_msgs::Time* game_time);
+  ::llsf_msgs::Time* unsafe_arena_release_game_time();
+
+  // required .llsf_msgs.GameState.State state = 3;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  ::llsf_msgs::GameState_State state() const;
+  void set_state(::llsf_msgs::GameState_State value);
+  private:
+  ::llsf_msgs::GameState_State _internal_state() const;
+  void _internal_set_state(::llsf_msgs::GameState_State value);
+  public:
+
+  // required .llsf_msgs.GameState.Phase phase = 4;
+  bool has_phase() const;
+  private:
+  bool _internal_has_phase() const;
+  public:
+  void clear_phase();
+  ::llsf_msgs::GameState_Phase phase() const;
+  void set_phase(::llsf_msgs::GameState_Phase value);
+  private:
+  ::llsf_msgs::GameState_Phase _internal_phase() const;
+  void _internal_set_phase(::llsf_msgs::GameState_Phase value);
+  public:
+
+  // optional uint32 points_cyan = 5;
+  bool has_points_cyan() const;
+  private:
+  bool _internal_has_points_cyan() const;
+  public:
+  void clear_points_cyan();
+  uint32_t points_cyan() const;
+  void set_points_cyan(uint32_t value);
+  private:
+  uint32_t _internal_points_cyan() const;
+  void _internal_set_points_cyan(uint32_t value);
+  public:
+
+  // optional uint32 points_magenta = 8;
+  bool has_points_magenta() const;
+  private:
+  bool _internal_has_points_magenta() const;
+  public:
+  void clear_points_magenta();
+  uint32_t points_magenta() const;
+  void set_points_magenta(uint32_t value);
+  private:
+  uint32_t _internal_points_magenta() const;
+  void _internal_set_points_magenta(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.GameState)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr team_cyan_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr team_magenta_;
+    ::llsf_msgs::Time* game_time_;
+    int state_;
+    int phase_;
+    uint32_t points_cyan_;
+    uint32_t points_magenta_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GameState_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetGameState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.SetGameState) */ {
+ public:
+  inline SetGameState() : SetGameState(nullptr) {}
+  ~SetGameState() override;
+  explicit PROTOBUF_CONSTEXPR SetGameState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetGameState(const SetGameState& from);
+  SetGameState(SetGameState&& from) noexcept
+    : SetGameState() {
+    *this = ::std::move(from);
+  }
+
+  inline SetGameState& operator=(const SetGameState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetGameState& operator=(SetGameState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetGameState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetGameState* internal_default_instance() {
+    return reinterpret_cast<const SetGameState*>(
+               &_SetGameState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(SetGameState& a, SetGameState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetGameState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetGameState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetGameState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetGameState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetGameState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetGameState& from) {
+    SetGameState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetGameState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.SetGameState";
+  }
+  protected:
+  explicit SetGameState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SetGameState_CompType CompType;
+  static constexpr CompType COMP_ID =
+    SetGameState_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    SetGameState_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return SetGameState_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    SetGameState_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    SetGameState_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    SetGameState_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return SetGameState_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return SetGameState_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return SetGameState_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStateFieldNumber = 1,
+  };
+  // required .llsf_msgs.GameState.State state = 1;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  ::llsf_msgs::GameState_State state() const;
+  void set_state(::llsf_msgs::GameState_State value);
+  private:
+  ::llsf_msgs::GameState_State _internal_state() const;
+  void _internal_set_state(::llsf_msgs::GameState_State value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.SetGameState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int state_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GameState_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetGamePhase final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.SetGamePhase) */ {
+ public:
+  inline SetGamePhase() : SetGamePhase(nullptr) {}
+  ~SetGamePhase() override;
+  explicit PROTOBUF_CONSTEXPR SetGamePhase(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetGamePhase(const SetGamePhase& from);
+  SetGamePhase(SetGamePhase&& from) noexcept
+    : SetGamePhase() {
+    *this = ::std::move(from);
+  }
+
+  inline SetGamePhase& operator=(const SetGamePhase& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetGamePhase& operator=(SetGamePhase&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetGamePhase& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetGamePhase* internal_default_instance() {
+    return reinterpret_cast<const SetGamePhase*>(
+               &_SetGamePhase_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SetGamePhase& a, SetGamePhase& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetGamePhase* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetGamePhase* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetGamePhase* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetGamePhase>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetGamePhase& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetGamePhase& from) {
+    SetGamePhase::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetGamePhase* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.SetGamePhase";
+  }
+  protected:
+  explicit SetGamePhase(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SetGamePhase_CompType CompType;
+  static constexpr CompType COMP_ID =
+    SetGamePhase_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    SetGamePhase_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return SetGamePhase_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    SetGamePhase_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    SetGamePhase_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    SetGamePhase_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return SetGamePhase_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return SetGamePhase_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return SetGamePhase_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPhaseFieldNumber = 1,
+  };
+  // required .llsf_msgs.GameState.Phase phase = 1;
+  bool has_phase() const;
+  private:
+  bool _internal_has_phase() const;
+  public:
+  void clear_phase();
+  ::llsf_msgs::GameState_Phase phase() const;
+  void set_phase(::llsf_msgs::GameState_Phase value);
+  private:
+  ::llsf_msgs::GameState_Phase _internal_phase() const;
+  void _internal_set_phase(::llsf_msgs::GameState_Phase value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.SetGamePhase)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int phase_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GameState_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RandomizeField final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:llsf_msgs.RandomizeField) */ {
+ public:
+  inline RandomizeField() : RandomizeField(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR RandomizeField(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RandomizeField(const RandomizeField& from);
+  RandomizeField(RandomizeField&& from) noexcept
+    : RandomizeField() {
+    *this = ::std::move(from);
+  }
+
+  inline RandomizeField& operator=(const RandomizeField& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RandomizeField& operator=(RandomizeField&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RandomizeField& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RandomizeField* internal_default_instance() {
+    return reinterpret_cast<const RandomizeField*>(
+               &_RandomizeField_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RandomizeField& a, RandomizeField& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RandomizeField* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RandomizeField* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RandomizeField* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RandomizeField>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const RandomizeField& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const RandomizeField& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.RandomizeField";
+  }
+  protected:
+  explicit RandomizeField(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef RandomizeField_CompType CompType;
+  static constexpr CompType COMP_ID =
+    RandomizeField_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    RandomizeField_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return RandomizeField_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    RandomizeField_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    RandomizeField_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    RandomizeField_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return RandomizeField_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return RandomizeField_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return RandomizeField_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.RandomizeField)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_GameState_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// GameState
+
+// required .llsf_msgs.Time game_time = 1;
+inline bool GameState::_internal_has_game_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.game_time_ != nullptr);
+  return value;
+}
+inline bool GameState::has_game_time() const {
+  return _internal_has_game_time();
+}
+inline const ::llsf_msgs::Time& GameState::_internal_game_time() const {
+  const ::llsf_msgs::Time* p = _impl_.game_time_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::Time&>(
+      ::llsf_msgs::_Time_default_instance_);
+}
+inline const ::llsf_msgs::Time& GameState::game_time() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.GameState.game_time)
+  return _internal_game_time();
+}
+inline void GameState::unsafe_arena_set_allocated_game_time(
+    ::llsf_msgs::Time* game_time) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.game_time_);
+  }
+  _impl_.game_time_ = game_time;
+  if (game_time) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.GameState.game_time)
+}
+inline ::llsf_msgs::Time* GameState::release_game_time() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::llsf_msgs::Time* temp = _impl_.game_time_;
+  _impl_.game_time_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::Time* GameState::unsafe_arena_release_game_time() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.GameState.game_time)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::llsf_msgs::Time* temp = _impl_.game_time_;
+  _impl_.game_time_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::Time* GameState::_internal_mutable_game_time() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.game_time_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::Time>(GetArenaForAllocation());
+    _impl_.game_time_ = p;
+  }
+  return _impl_.game_time_;
+}
+inline ::llsf_msgs::Time* GameState::mutable_game_time() {
+  ::llsf_msgs::Time* _msg = _internal_mutable_game_time();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.GameState.game_time)
+  return _msg;
+}
+inline void GameState::set_allocated_game_time(::llsf_msgs::Time* game_time) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.game_time_);
+  }
+  if (game_time) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(game_time));
+    if (message_arena != submessage_arena) {
+      game_time = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, game_time, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.game_time_ = game_time;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.GameState.game_time)
+}
+
+// required .llsf_msgs.GameState.State state = 3;
+inline bool GameState::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool GameState::has_state() const {
+  return _internal_has_state();
+}
+inline void GameState::clear_state() {
+  _impl_.state_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::llsf_msgs::GameState_State GameState::_internal_state() const {
+  return static_cast< ::llsf_msgs::GameState_State >(_impl_.state_);
+}
+inline ::llsf_msgs::GameState_State GameState::state() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.GameState.state)
+  return _internal_state();
+}
+inline void GameState::_internal_set_state(::llsf_msgs::GameState_State value) {
+  assert(::llsf_msgs::GameState_State_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.state_ = value;
+}
+inline void GameState::set_state(::llsf_msgs::GameState_State value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.GameState.state)
+}
+
+// required .llsf_msgs.GameState.Phase phase = 4;
+inline bool GameState::_internal_has_phase() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool GameState::has_phase() const {
+  return _internal_has_phase();
+}
+inline void GameState::clear_phase() {
+  _impl_.phase_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::llsf_msgs::GameState_Phase GameState::_internal_phase() const {
+  return static_cast< ::llsf_msgs::GameState_Phase >(_impl_.phase_);
+}
+inline ::llsf_msgs::GameState_Phase GameState::phase() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.GameState.phase)
+  return _internal_phase();
+}
+inline void GameState::_internal_set_phase(::llsf_msgs::GameState_Phase value) {
+  assert(::llsf_msgs::GameState_Phase_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.phase_ = value;
+}
+inline void GameState::set_phase(::llsf_msgs::GameState_Phase value) {
+  _internal_set_phase(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.GameState.phase)
+}
+
+// optional uint32 points_cyan = 5;
+inline bool GameState::_internal_has_points_cyan() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool GameState::has_points_cyan() const {
+  return _internal_has_points_cyan();
+}
+inline void GameState::clear_points_cyan() {
+  _impl_.points_cyan_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t GameState::_internal_points_cyan() const {
+  return _impl_.points_cyan_;
+}
+inline uint32_t GameState::points_cyan() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.GameState.points_cyan)
+  return _internal_points_cyan();
+}
+inline void GameState::_internal_set_points_cyan(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.points_cyan_ = value;
+}
+inline void GameState::set_points_cyan(uint32_t value) {
+  _internal_set_points_cyan(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.GameState.points_cyan)
+}
+
+// optional string team_cyan = 6;
+inline bool GameState::_internal_has_team_cyan() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GameState::has_team_cyan() const {
+  return _internal_has_team_cyan();
+}
+inline void GameState::clear_team_cyan() {
+  _impl_.team_cyan_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GameState::team_cyan() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.GameState.team_cyan)
+  return _internal_team_cyan();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameState::set_team_cyan(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.team_cyan_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.GameState.team_cyan)
+}
+inline std::string* GameState::mutable_team_cyan() {
+  std::string* _s = _internal_mutable_team_cyan();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.GameState.team_cyan)
+  return _s;
+}
+inline const std::string& GameState::_internal_team_cyan() const {
+  return _impl_.team_cyan_.Get();
+}
+inline void GameState::_internal_set_team_cyan(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.team_cyan_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GameState::_internal_mutable_team_cyan() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.team_cyan_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameState::release_team_cyan() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.GameState.team_cyan)
+  if (!_internal_has_team_cyan()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.team_cyan_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.team_cyan_.IsDefault()) {
+    _impl_.team_cyan_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GameState::set_allocated_team_cyan(std::string* team_cyan) {
+  if (team_cyan != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.team_cyan_.SetAllocated(team_cyan, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.team_cyan_.IsDefault()) {
+    _impl_.team_cyan_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.GameState.team_cyan)
+}
+
+// optional uint32 points_magenta = 8;
+inline bool GameState::_internal_has_points_magenta() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool GameState::has_points_magenta() const {
+  return _internal_has_points_magenta();
+}
+inline void GameState::clear_points_magenta() {
+  _impl_.points_magenta_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t GameState::_internal_points_magenta() const {
+  return _impl_.points_magenta_;
+}
+inline uint32_t GameState::points_magenta() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.GameState.points_magenta)
+  return _internal_points_magenta();
+}
+inline void GameState::_internal_set_points_magenta(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.points_magenta_ = value;
+}
+inline void GameState::set_points_magenta(uint32_t value) {
+  _internal_set_points_magenta(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.GameState.points_magenta)
+}
+
+// optional string team_magenta = 9;
+inline bool GameState::_internal_has_team_magenta() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GameState::has_team_magenta() const {
+  return _internal_has_team_magenta();
+}
+inline void GameState::clear_team_magenta() {
+  _impl_.team_magenta_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GameState::team_magenta() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.GameState.team_magenta)
+  return _internal_team_magenta();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameState::set_team_magenta(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.team_magenta_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.GameState.team_magenta)
+}
+inline std::string* GameState::mutable_team_magenta() {
+  std::string* _s = _internal_mutable_team_magenta();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.GameState.team_magenta)
+  return _s;
+}
+inline const std::string& GameState::_internal_team_magenta() const {
+  return _impl_.team_magenta_.Get();
+}
+inline void GameState::_internal_set_team_magenta(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.team_magenta_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GameState::_internal_mutable_team_magenta() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.team_magenta_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameState::release_team_magenta() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.GameState.team_magenta)
+  if (!_internal_has_team_magenta()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.team_magenta_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.team_magenta_.IsDefault()) {
+    _impl_.team_magenta_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GameState::set_allocated_team_magenta(std::string* team_magenta) {
+  if (team_magenta != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.team_magenta_.SetAllocated(team_magenta, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.team_magenta_.IsDefault()) {
+    _impl_.team_magenta_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.GameState.team_magenta)
+}
+
+// -------------------------------------------------------------------
+
+// SetGameState
+
+// required .llsf_msgs.GameState.State state = 1;
+inline bool SetGameState::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SetGameState::has_state() const {
+  return _internal_has_state();
+}
+inline void SetGameState::clear_state() {
+  _impl_.state_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::GameState_State SetGameState::_internal_state() const {
+  return static_cast< ::llsf_msgs::GameState_State >(_impl_.state_);
+}
+inline ::llsf_msgs::GameState_State SetGameState::state() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetGameState.state)
+  return _internal_state();
+}
+inline void SetGameState::_internal_set_state(::llsf_msgs::GameState_State value) {
+  assert(::llsf_msgs::GameState_State_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.state_ = value;
+}
+inline void SetGameState::set_state(::llsf_msgs::GameState_State value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetGameState.state)
+}
+
+// -------------------------------------------------------------------
+
+// SetGamePhase
+
+// required .llsf_msgs.GameState.Phase phase = 1;
+inline bool SetGamePhase::_internal_has_phase() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SetGamePhase::has_phase() const {
+  return _internal_has_phase();
+}
+inline void SetGamePhase::clear_phase() {
+  _impl_.phase_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::GameState_Phase SetGamePhase::_internal_phase() const {
+  return static_cast< ::llsf_msgs::GameState_Phase >(_impl_.phase_);
+}
+inline ::llsf_msgs::GameState_Phase SetGamePhase::phase() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetGamePhase.phase)
+  return _internal_phase();
+}
+inline void SetGamePhase::_internal_set_phase(::llsf_msgs::GameState_Phase value) {
+  assert(::llsf_msgs::GameState_Phase_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.phase_ = value;
+}
+inline void SetGamePhase::set_phase(::llsf_msgs::GameState_Phase value) {
+  _internal_set_phase(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetGamePhase.phase)
+}
+
+// -------------------------------------------------------------------
+
+// RandomizeField
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::GameState_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::GameState_CompType>() {
+  return ::llsf_msgs::GameState_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::GameState_State> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::GameState_State>() {
+  return ::llsf_msgs::GameState_State_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::GameState_Phase> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::GameState_Phase>() {
+  return ::llsf_msgs::GameState_Phase_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::SetGameState_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::SetGameState_CompType>() {
+  return ::llsf_msgs::SetGameState_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::SetGamePhase_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::SetGamePhase_CompType>() {
+  return ::llsf_msgs::SetGamePhase_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::RandomizeField_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::RandomizeField_CompType>() {
+  return ::llsf_msgs::RandomizeField_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_GameState_2eproto
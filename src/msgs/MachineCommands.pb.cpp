@@ -0,0 +1,1018 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MachineCommands.proto
+
+#include "MachineCommands.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR SetMachineState::SetMachineState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.machine_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.state_)*/1} {}
+struct SetMachineStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetMachineStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetMachineStateDefaultTypeInternal() {}
+  union {
+    SetMachineState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetMachineStateDefaultTypeInternal _SetMachineState_default_instance_;
+PROTOBUF_CONSTEXPR MachineAddBase::MachineAddBase(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.machine_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct MachineAddBaseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MachineAddBaseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MachineAddBaseDefaultTypeInternal() {}
+  union {
+    MachineAddBase _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MachineAddBaseDefaultTypeInternal _MachineAddBase_default_instance_;
+PROTOBUF_CONSTEXPR SetMachineLights::SetMachineLights(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.lights_)*/{}
+  , /*decltype(_impl_.machine_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct SetMachineLightsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetMachineLightsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetMachineLightsDefaultTypeInternal() {}
+  union {
+    SetMachineLights _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetMachineLightsDefaultTypeInternal _SetMachineLights_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_MachineCommands_2eproto[3];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_MachineCommands_2eproto[4];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_MachineCommands_2eproto = nullptr;
+
+const uint32_t TableStruct_MachineCommands_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetMachineState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetMachineState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetMachineState, _impl_.machine_name_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetMachineState, _impl_.state_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineAddBase, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineAddBase, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineAddBase, _impl_.machine_name_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetMachineLights, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetMachineLights, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetMachineLights, _impl_.machine_name_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetMachineLights, _impl_.lights_),
+  0,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::llsf_msgs::SetMachineState)},
+  { 10, 17, -1, sizeof(::llsf_msgs::MachineAddBase)},
+  { 18, 26, -1, sizeof(::llsf_msgs::SetMachineLights)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_SetMachineState_default_instance_._instance,
+  &::llsf_msgs::_MachineAddBase_default_instance_._instance,
+  &::llsf_msgs::_SetMachineLights_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_MachineCommands_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\025MachineCommands.proto\022\tllsf_msgs\032\021Mach"
+  "ineInfo.proto\"w\n\017SetMachineState\022\024\n\014mach"
+  "ine_name\030\001 \002(\t\022&\n\005state\030\002 \002(\0162\027.llsf_msg"
+  "s.MachineState\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017"
+  "\022\014\n\010MSG_TYPE\020\021\"N\n\016MachineAddBase\022\024\n\014mach"
+  "ine_name\030\001 \002(\t\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017"
+  "\022\014\n\010MSG_TYPE\020\022\"v\n\020SetMachineLights\022\024\n\014ma"
+  "chine_name\030\001 \002(\t\022$\n\006lights\030\002 \003(\0132\024.llsf_"
+  "msgs.LightSpec\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017"
+  "\022\014\n\010MSG_TYPE\020\023*_\n\014MachineState\022\010\n\004IDLE\020\001"
+  "\022\r\n\tAVAILABLE\020\002\022\r\n\tPROCESSED\020\003\022\r\n\tDELIVE"
+  "RED\020\004\022\r\n\tRETRIEVED\020\005\022\t\n\005RESET\020\017B8\n\037org.r"
+  "obocup_logistics.llsf_msgsB\025MachineComma"
+  "ndsProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_MachineCommands_2eproto_deps[1] = {
+  &::descriptor_table_MachineInfo_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_MachineCommands_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_MachineCommands_2eproto = {
+    false, false, 529, descriptor_table_protodef_MachineCommands_2eproto,
+    "MachineCommands.proto",
+    &descriptor_table_MachineCommands_2eproto_once, descriptor_table_MachineCommands_2eproto_deps, 1, 3,
+    schemas, file_default_instances, TableStruct_MachineCommands_2eproto::offsets,
+    file_level_metadata_MachineCommands_2eproto, file_level_enum_descriptors_MachineCommands_2eproto,
+    file_level_service_descriptors_MachineCommands_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_MachineCommands_2eproto_getter() {
+  return &descriptor_table_MachineCommands_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_MachineCommands_2eproto(&descriptor_table_MachineCommands_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetMachineState_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineCommands_2eproto);
+  return file_level_enum_descriptors_MachineCommands_2eproto[0];
+}
+bool SetMachineState_CompType_IsValid(int value) {
+  switch (value) {
+    case 17:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SetMachineState_CompType SetMachineState::COMP_ID;
+constexpr SetMachineState_CompType SetMachineState::MSG_TYPE;
+constexpr SetMachineState_CompType SetMachineState::CompType_MIN;
+constexpr SetMachineState_CompType SetMachineState::CompType_MAX;
+constexpr int SetMachineState::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineAddBase_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineCommands_2eproto);
+  return file_level_enum_descriptors_MachineCommands_2eproto[1];
+}
+bool MachineAddBase_CompType_IsValid(int value) {
+  switch (value) {
+    case 18:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr MachineAddBase_CompType MachineAddBase::COMP_ID;
+constexpr MachineAddBase_CompType MachineAddBase::MSG_TYPE;
+constexpr MachineAddBase_CompType MachineAddBase::CompType_MIN;
+constexpr MachineAddBase_CompType MachineAddBase::CompType_MAX;
+constexpr int MachineAddBase::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetMachineLights_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineCommands_2eproto);
+  return file_level_enum_descriptors_MachineCommands_2eproto[2];
+}
+bool SetMachineLights_CompType_IsValid(int value) {
+  switch (value) {
+    case 19:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SetMachineLights_CompType SetMachineLights::COMP_ID;
+constexpr SetMachineLights_CompType SetMachineLights::MSG_TYPE;
+constexpr SetMachineLights_CompType SetMachineLights::CompType_MIN;
+constexpr SetMachineLights_CompType SetMachineLights::CompType_MAX;
+constexpr int SetMachineLights::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineState_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineCommands_2eproto);
+  return file_level_enum_descriptors_MachineCommands_2eproto[3];
+}
+bool MachineState_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 15:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class SetMachineState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SetMachineState>()._impl_._has_bits_);
+  static void set_has_machine_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+SetMachineState::SetMachineState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.SetMachineState)
+}
+SetMachineState::SetMachineState(const SetMachineState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetMachineState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machine_name_){}
+    , decltype(_impl_.state_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.machine_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_machine_name()) {
+    _this->_impl_.machine_name_.Set(from._internal_machine_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.state_ = from._impl_.state_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.SetMachineState)
+}
+
+inline void SetMachineState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machine_name_){}
+    , decltype(_impl_.state_){1}
+  };
+  _impl_.machine_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SetMachineState::~SetMachineState() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.SetMachineState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetMachineState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.machine_name_.Destroy();
+}
+
+void SetMachineState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetMachineState::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.SetMachineState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.machine_name_.ClearNonDefaultToEmpty();
+    }
+    _impl_.state_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetMachineState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string machine_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_machine_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.SetMachineState.machine_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.MachineState state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::MachineState_IsValid(val))) {
+            _internal_set_state(static_cast<::llsf_msgs::MachineState>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetMachineState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.SetMachineState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string machine_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_machine_name().data(), static_cast<int>(this->_internal_machine_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.SetMachineState.machine_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_machine_name(), target);
+  }
+
+  // required .llsf_msgs.MachineState state = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_state(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.SetMachineState)
+  return target;
+}
+
+size_t SetMachineState::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.SetMachineState)
+  size_t total_size = 0;
+
+  if (_internal_has_machine_name()) {
+    // required string machine_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_machine_name());
+  }
+
+  if (_internal_has_state()) {
+    // required .llsf_msgs.MachineState state = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+  }
+
+  return total_size;
+}
+size_t SetMachineState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.SetMachineState)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string machine_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_machine_name());
+
+    // required .llsf_msgs.MachineState state = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetMachineState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetMachineState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetMachineState::GetClassData() const { return &_class_data_; }
+
+
+void SetMachineState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetMachineState*>(&to_msg);
+  auto& from = static_cast<const SetMachineState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.SetMachineState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_machine_name(from._internal_machine_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.state_ = from._impl_.state_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetMachineState::CopyFrom(const SetMachineState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.SetMachineState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetMachineState::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SetMachineState::InternalSwap(SetMachineState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.machine_name_, lhs_arena,
+      &other->_impl_.machine_name_, rhs_arena
+  );
+  swap(_impl_.state_, other->_impl_.state_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetMachineState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineCommands_2eproto_getter, &descriptor_table_MachineCommands_2eproto_once,
+      file_level_metadata_MachineCommands_2eproto[0]);
+}
+
+// ===================================================================
+
+class MachineAddBase::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MachineAddBase>()._impl_._has_bits_);
+  static void set_has_machine_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+MachineAddBase::MachineAddBase(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.MachineAddBase)
+}
+MachineAddBase::MachineAddBase(const MachineAddBase& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MachineAddBase* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machine_name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.machine_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_machine_name()) {
+    _this->_impl_.machine_name_.Set(from._internal_machine_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.MachineAddBase)
+}
+
+inline void MachineAddBase::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machine_name_){}
+  };
+  _impl_.machine_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MachineAddBase::~MachineAddBase() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.MachineAddBase)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MachineAddBase::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.machine_name_.Destroy();
+}
+
+void MachineAddBase::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MachineAddBase::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.MachineAddBase)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.machine_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MachineAddBase::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string machine_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_machine_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.MachineAddBase.machine_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MachineAddBase::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.MachineAddBase)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string machine_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_machine_name().data(), static_cast<int>(this->_internal_machine_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.MachineAddBase.machine_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_machine_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.MachineAddBase)
+  return target;
+}
+
+size_t MachineAddBase::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.MachineAddBase)
+  size_t total_size = 0;
+
+  // required string machine_name = 1;
+  if (_internal_has_machine_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_machine_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MachineAddBase::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MachineAddBase::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MachineAddBase::GetClassData() const { return &_class_data_; }
+
+
+void MachineAddBase::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MachineAddBase*>(&to_msg);
+  auto& from = static_cast<const MachineAddBase&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.MachineAddBase)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_machine_name()) {
+    _this->_internal_set_machine_name(from._internal_machine_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MachineAddBase::CopyFrom(const MachineAddBase& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.MachineAddBase)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MachineAddBase::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void MachineAddBase::InternalSwap(MachineAddBase* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.machine_name_, lhs_arena,
+      &other->_impl_.machine_name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MachineAddBase::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineCommands_2eproto_getter, &descriptor_table_MachineCommands_2eproto_once,
+      file_level_metadata_MachineCommands_2eproto[1]);
+}
+
+// ===================================================================
+
+class SetMachineLights::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SetMachineLights>()._impl_._has_bits_);
+  static void set_has_machine_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+void SetMachineLights::clear_lights() {
+  _impl_.lights_.Clear();
+}
+SetMachineLights::SetMachineLights(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.SetMachineLights)
+}
+SetMachineLights::SetMachineLights(const SetMachineLights& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetMachineLights* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lights_){from._impl_.lights_}
+    , decltype(_impl_.machine_name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.machine_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_machine_name()) {
+    _this->_impl_.machine_name_.Set(from._internal_machine_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.SetMachineLights)
+}
+
+inline void SetMachineLights::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lights_){arena}
+    , decltype(_impl_.machine_name_){}
+  };
+  _impl_.machine_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SetMachineLights::~SetMachineLights() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.SetMachineLights)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetMachineLights::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lights_.~RepeatedPtrField();
+  _impl_.machine_name_.Destroy();
+}
+
+void SetMachineLights::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetMachineLights::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.SetMachineLights)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.lights_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.machine_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetMachineLights::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string machine_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_machine_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.SetMachineLights.machine_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.LightSpec lights = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_lights(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetMachineLights::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.SetMachineLights)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string machine_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_machine_name().data(), static_cast<int>(this->_internal_machine_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.SetMachineLights.machine_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_machine_name(), target);
+  }
+
+  // repeated .llsf_msgs.LightSpec lights = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_lights_size()); i < n; i++) {
+    const auto& repfield = this->_internal_lights(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.SetMachineLights)
+  return target;
+}
+
+size_t SetMachineLights::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.SetMachineLights)
+  size_t total_size = 0;
+
+  // required string machine_name = 1;
+  if (_internal_has_machine_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_machine_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.LightSpec lights = 2;
+  total_size += 1UL * this->_internal_lights_size();
+  for (const auto& msg : this->_impl_.lights_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetMachineLights::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetMachineLights::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetMachineLights::GetClassData() const { return &_class_data_; }
+
+
+void SetMachineLights::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetMachineLights*>(&to_msg);
+  auto& from = static_cast<const SetMachineLights&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.SetMachineLights)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.lights_.MergeFrom(from._impl_.lights_);
+  if (from._internal_has_machine_name()) {
+    _this->_internal_set_machine_name(from._internal_machine_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetMachineLights::CopyFrom(const SetMachineLights& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.SetMachineLights)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetMachineLights::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.lights_))
+    return false;
+  return true;
+}
+
+void SetMachineLights::InternalSwap(SetMachineLights* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.lights_.InternalSwap(&other->_impl_.lights_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.machine_name_, lhs_arena,
+      &other->_impl_.machine_name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetMachineLights::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineCommands_2eproto_getter, &descriptor_table_MachineCommands_2eproto_once,
+      file_level_metadata_MachineCommands_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::SetMachineState*
+Arena::CreateMaybeMessage< ::llsf_msgs::SetMachineState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::SetMachineState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::MachineAddBase*
+Arena::CreateMaybeMessage< ::llsf_msgs::MachineAddBase >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::MachineAddBase >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::SetMachineLights*
+Arena::CreateMaybeMessage< ::llsf_msgs::SetMachineLights >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::SetMachineLights >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1115 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MachineCommands.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_MachineCommands_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_MachineCommands_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "MachineInfo.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_MachineCommands_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_MachineCommands_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_MachineCommands_2eproto;
+namespace llsf_msgs {
+class MachineAddBase;
+struct MachineAddBaseDefaultTypeInternal;
+extern MachineAddBaseDefaultTypeInternal _MachineAddBase_default_instance_;
+class SetMachineLights;
+struct SetMachineLightsDefaultTypeInternal;
+extern SetMachineLightsDefaultTypeInternal _SetMachineLights_default_instance_;
+class SetMachineState;
+struct SetMachineStateDefaultTypeInternal;
+extern SetMachineStateDefaultTypeInternal _SetMachineState_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::MachineAddBase* Arena::CreateMaybeMessage<::llsf_msgs::MachineAddBase>(Arena*);
+template<> ::llsf_msgs::SetMachineLights* Arena::CreateMaybeMessage<::llsf_msgs::SetMachineLights>(Arena*);
+template<> ::llsf_msgs::SetMachineState* Arena::CreateMaybeMessage<::llsf_msgs::SetMachineState>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum SetMachineState_CompType : int {
+  SetMachineState_CompType_COMP_ID = 2000,
+  SetMachineState_CompType_MSG_TYPE = 17
+};
+bool SetMachineState_CompType_IsValid(int value);
+constexpr SetMachineState_CompType SetMachineState_CompType_CompType_MIN = SetMachineState_CompType_MSG_TYPE;
+constexpr SetMachineState_CompType SetMachineState_CompType_CompType_MAX = SetMachineState_CompType_COMP_ID;
+constexpr int SetMachineState_CompType_CompType_ARRAYSIZE = SetMachineState_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetMachineState_CompType_descriptor();
+template<typename T>
+inline const std::string& SetMachineState_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SetMachineState_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SetMachineState_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SetMachineState_CompType_descriptor(), enum_t_value);
+}
+inline bool SetMachineState_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SetMachineState_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SetMachineState_CompType>(
+    SetMachineState_CompType_descriptor(), name, value);
+}
+enum MachineAddBase_CompType : int {
+  MachineAddBase_CompType_COMP_ID = 2000,
+  MachineAddBase_CompType_MSG_TYPE = 18
+};
+bool MachineAddBase_CompType_IsValid(int value);
+constexpr MachineAddBase_CompType MachineAddBase_CompType_CompType_MIN = MachineAddBase_CompType_MSG_TYPE;
+constexpr MachineAddBase_CompType MachineAddBase_CompType_CompType_MAX = MachineAddBase_CompType_COMP_ID;
+constexpr int MachineAddBase_CompType_CompType_ARRAYSIZE = MachineAddBase_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineAddBase_CompType_descriptor();
+template<typename T>
+inline const std::string& MachineAddBase_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MachineAddBase_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MachineAddBase_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MachineAddBase_CompType_descriptor(), enum_t_value);
+}
+inline bool MachineAddBase_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MachineAddBase_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MachineAddBase_CompType>(
+    MachineAddBase_CompType_descriptor(), name, value);
+}
+enum SetMachineLights_CompType : int {
+  SetMachineLights_CompType_COMP_ID = 2000,
+  SetMachineLights_CompType_MSG_TYPE = 19
+};
+bool SetMachineLights_CompType_IsValid(int value);
+constexpr SetMachineLights_CompType SetMachineLights_CompType_CompType_MIN = SetMachineLights_CompType_MSG_TYPE;
+constexpr SetMachineLights_CompType SetMachineLights_CompType_CompType_MAX = SetMachineLights_CompType_COMP_ID;
+constexpr int SetMachineLights_CompType_CompType_ARRAYSIZE = SetMachineLights_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetMachineLights_CompType_descriptor();
+template<typename T>
+inline const std::string& SetMachineLights_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SetMachineLights_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SetMachineLights_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SetMachineLights_CompType_descriptor(), enum_t_value);
+}
+inline bool SetMachineLights_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SetMachineLights_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SetMachineLights_CompType>(
+    SetMachineLights_CompType_descriptor(), name, value);
+}
+enum MachineState : int {
+  IDLE = 1,
+  AVAILABLE = 2,
+  PROCESSED = 3,
+  DELIVERED = 4,
+  RETRIEVED = 5,
+  RESET = 15
+};
+bool MachineState_IsValid(int value);
+constexpr MachineState MachineState_MIN = IDLE;
+constexpr MachineState MachineState_MAX = RESET;
+constexpr int MachineState_ARRAYSIZE = MachineState_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineState_descriptor();
+template<typename T>
+inline const std::string& MachineState_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MachineState>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MachineState_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MachineState_descriptor(), enum_t_value);
+}
+inline bool MachineState_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MachineState* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MachineState>(
+    MachineState_descriptor(), name, value);
+}
+// ===================================================================
+
+class SetMachineState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.SetMachineState) */ {
+ public:
+  inline SetMachineState() : SetMachineState(nullptr) {}
+  ~SetMachineState() override;
+  explicit PROTOBUF_CONSTEXPR SetMachineState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetMachineState(const SetMachineState& from);
+  SetMachineState(SetMachineState&& from) noexcept
+    : SetMachineState() {
+    *this = ::std::move(from);
+  }
+
+  inline SetMachineState& operator=(const SetMachineState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetMachineState& operator=(SetMachineState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetMachineState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetMachineState* internal_default_instance() {
+    return reinterpret_cast<const SetMachineState*>(
+               &_SetMachineState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SetMachineState& a, SetMachineState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetMachineState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetMachineState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetMachineState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetMachineState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetMachineState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetMachineState& from) {
+    SetMachineState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetMachineState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.SetMachineState";
+  }
+  protected:
+  explicit SetMachineState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SetMachineState_CompType CompType;
+  static constexpr CompType COMP_ID =
+    SetMachineState_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    SetMachineState_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return SetMachineState_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    SetMachineState_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    SetMachineState_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    SetMachineState_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return SetMachineState_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return SetMachineState_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return SetMachineState_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMachineNameFieldNumber = 1,
+    kStateFieldNumber = 2,
+  };
+  // required string machine_name = 1;
+  bool has_machine_name() const;
+  private:
+  bool _internal_has_machine_name() const;
+  public:
+  void clear_machine_name();
+  const std::string& machine_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_machine_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_machine_name();
+  PROTOBUF_NODISCARD std::string* release_machine_name();
+  void set_allocated_machine_name(std::string* machine_name);
+  private:
+  const std::string& _internal_machine_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_machine_name(const std::string& value);
+  std::string* _internal_mutable_machine_name();
+  public:
+
+  // required .llsf_msgs.MachineState state = 2;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  ::llsf_msgs::MachineState state() const;
+  void set_state(::llsf_msgs::MachineState value);
+  private:
+  ::llsf_msgs::MachineState _internal_state() const;
+  void _internal_set_state(::llsf_msgs::MachineState value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.SetMachineState)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr machine_name_;
+    int state_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineCommands_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MachineAddBase final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.MachineAddBase) */ {
+ public:
+  inline MachineAddBase() : MachineAddBase(nullptr) {}
+  ~MachineAddBase() override;
+  explicit PROTOBUF_CONSTEXPR MachineAddBase(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MachineAddBase(const MachineAddBase& from);
+  MachineAddBase(MachineAddBase&& from) noexcept
+    : MachineAddBase() {
+    *this = ::std::move(from);
+  }
+
+  inline MachineAddBase& operator=(const MachineAddBase& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MachineAddBase& operator=(MachineAddBase&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MachineAddBase& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MachineAddBase* internal_default_instance() {
+    return reinterpret_cast<const MachineAddBase*>(
+               &_MachineAddBase_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(MachineAddBase& a, MachineAddBase& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MachineAddBase* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MachineAddBase* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MachineAddBase* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MachineAddBase>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MachineAddBase& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MachineAddBase& from) {
+    MachineAddBase::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MachineAddBase* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.MachineAddBase";
+  }
+  protected:
+  explicit MachineAddBase(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MachineAddBase_CompType CompType;
+  static constexpr CompType COMP_ID =
+    MachineAddBase_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    MachineAddBase_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return MachineAddBase_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    MachineAddBase_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    MachineAddBase_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    MachineAddBase_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return MachineAddBase_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return MachineAddBase_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return MachineAddBase_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMachineNameFieldNumber = 1,
+  };
+  // required string machine_name = 1;
+  bool has_machine_name() const;
+  private:
+  bool _internal_has_machine_name() const;
+  public:
+  void clear_machine_name();
+  const std::string& machine_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_machine_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_machine_name();
+  PROTOBUF_NODISCARD std::string* release_machine_name();
+  void set_allocated_machine_name(std::string* machine_name);
+  private:
+  const std::string& _internal_machine_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_machine_name(const std::string& value);
+  std::string* _internal_mutable_machine_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.MachineAddBase)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr machine_name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineCommands_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetMachineLights final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.SetMachineLights) */ {
+ public:
+  inline SetMachineLights() : SetMachineLights(nullptr) {}
+  ~SetMachineLights() override;
+  explicit PROTOBUF_CONSTEXPR SetMachineLights(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetMachineLights(const SetMachineLights& from);
+  SetMachineLights(SetMachineLights&& from) noexcept
+    : SetMachineLights() {
+    *this = ::std::move(from);
+  }
+
+  inline SetMachineLights& operator=(const SetMachineLights& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetMachineLights& operator=(SetMachineLights&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetMachineLights& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetMachineLights* internal_default_instance() {
+    return reinterpret_cast<const SetMachineLights*>(
+               &_SetMachineLights_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SetMachineLights& a, SetMachineLights& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetMachineLights* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetMachineLights* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetMachineLights* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetMachineLights>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetMachineLights& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetMachineLights& from) {
+    SetMachineLights::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetMachineLights* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.SetMachineLights";
+  }
+  protected:
+  explicit SetMachineLights(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SetMachineLights_CompType CompType;
+  static constexpr CompType COMP_ID =
+    SetMachineLights_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    SetMachineLights_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return SetMachineLights_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    SetMachineLights_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    SetMachineLights_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    SetMachineLights_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return SetMachineLights_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return SetMachineLights_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return SetMachineLights_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLightsFieldNumber = 2,
+    kMachineNameFieldNumber = 1,
+  };
+  // repeated .llsf_msgs.LightSpec lights = 2;
+  int lights_size() const;
+  private:
+  int _internal_lights_size() const;
+  public:
+  void clear_lights();
+  ::llsf_msgs::LightSpec* mutable_lights(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >*
+      mutable_lights();
+  private:
+  const ::llsf_msgs::LightSpec& _internal_lights(int index) const;
+  ::llsf_msgs::LightSpec* _internal_add_lights();
+  public:
+  const ::llsf_msgs::LightSpec& lights(int index) const;
+  ::llsf_msgs::LightSpec* add_lights();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >&
+      lights() const;
+
+  // required string machine_name = 1;
+  bool has_machine_name() const;
+  private:
+  bool _internal_has_machine_name() const;
+  public:
+  void clear_machine_name();
+  const std::string& machine_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_machine_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_machine_name();
+  PROTOBUF_NODISCARD std::string* release_machine_name();
+  void set_allocated_machine_name(std::string* machine_name);
+  private:
+  const std::string& _internal_machine_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_machine_name(const std::string& value);
+  std::string* _internal_mutable_machine_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.SetMachineLights)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec > lights_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr machine_name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineCommands_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SetMachineState
+
+// required string machine_name = 1;
+inline bool SetMachineState::_internal_has_machine_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SetMachineState::has_machine_name() const {
+  return _internal_has_machine_name();
+}
+inline void SetMachineState::clear_machine_name() {
+  _impl_.machine_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SetMachineState::machine_name() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetMachineState.machine_name)
+  return _internal_machine_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetMachineState::set_machine_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.machine_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetMachineState.machine_name)
+}
+inline std::string* SetMachineState::mutable_machine_name() {
+  std::string* _s = _internal_mutable_machine_name();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.SetMachineState.machine_name)
+  return _s;
+}
+inline const std::string& SetMachineState::_internal_machine_name() const {
+  return _impl_.machine_name_.Get();
+}
+inline void SetMachineState::_internal_set_machine_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.machine_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetMachineState::_internal_mutable_machine_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.machine_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SetMachineState::release_machine_name() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.SetMachineState.machine_name)
+  if (!_internal_has_machine_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.machine_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_name_.IsDefault()) {
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SetMachineState::set_allocated_machine_name(std::string* machine_name) {
+  if (machine_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.machine_name_.SetAllocated(machine_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_name_.IsDefault()) {
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.SetMachineState.machine_name)
+}
+
+// required .llsf_msgs.MachineState state = 2;
+inline bool SetMachineState::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SetMachineState::has_state() const {
+  return _internal_has_state();
+}
+inline void SetMachineState::clear_state() {
+  _impl_.state_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::llsf_msgs::MachineState SetMachineState::_internal_state() const {
+  return static_cast< ::llsf_msgs::MachineState >(_impl_.state_);
+}
+inline ::llsf_msgs::MachineState SetMachineState::state() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetMachineState.state)
+  return _internal_state();
+}
+inline void SetMachineState::_internal_set_state(::llsf_msgs::MachineState value) {
+  assert(::llsf_msgs::MachineState_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.state_ = value;
+}
+inline void SetMachineState::set_state(::llsf_msgs::MachineState value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetMachineState.state)
+}
+
+// -------------------------------------------------------------------
+
+// MachineAddBase
+
+// required string machine_name = 1;
+inline bool MachineAddBase::_internal_has_machine_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MachineAddBase::has_machine_name() const {
+  return _internal_has_machine_name();
+}
+inline void MachineAddBase::clear_machine_name() {
+  _impl_.machine_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MachineAddBase::machine_name() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.MachineAddBase.machine_name)
+  return _internal_machine_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MachineAddBase::set_machine_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.machine_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.MachineAddBase.machine_name)
+}
+inline std::string* MachineAddBase::mutable_machine_name() {
+  std::string* _s = _internal_mutable_machine_name();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.MachineAddBase.machine_name)
+  return _s;
+}
+inline const std::string& MachineAddBase::_internal_machine_name() const {
+  return _impl_.machine_name_.Get();
+}
+inline void MachineAddBase::_internal_set_machine_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.machine_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MachineAddBase::_internal_mutable_machine_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.machine_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MachineAddBase::release_machine_name() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.MachineAddBase.machine_name)
+  if (!_internal_has_machine_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.machine_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_name_.IsDefault()) {
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MachineAddBase::set_allocated_machine_name(std::string* machine_name) {
+  if (machine_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.machine_name_.SetAllocated(machine_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_name_.IsDefault()) {
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.MachineAddBase.machine_name)
+}
+
+// -------------------------------------------------------------------
+
+// SetMachineLights
+
+// required string machine_name = 1;
+inline bool SetMachineLights::_internal_has_machine_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SetMachineLights::has_machine_name() const {
+  return _internal_has_machine_name();
+}
+inline void SetMachineLights::clear_machine_name() {
+  _impl_.machine_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SetMachineLights::machine_name() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetMachineLights.machine_name)
+  return _internal_machine_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetMachineLights::set_machine_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.machine_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetMachineLights.machine_name)
+}
+inline std::string* SetMachineLights::mutable_machine_name() {
+  std::string* _s = _internal_mutable_machine_name();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.SetMachineLights.machine_name)
+  return _s;
+}
+inline const std::string& SetMachineLights::_internal_machine_name() const {
+  return _impl_.machine_name_.Get();
+}
+inline void SetMachineLights::_internal_set_machine_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.machine_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetMachineLights::_internal_mutable_machine_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.machine_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SetMachineLights::release_machine_name() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.SetMachineLights.machine_name)
+  if (!_internal_has_machine_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.machine_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_name_.IsDefault()) {
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SetMachineLights::set_allocated_machine_name(std::string* machine_name) {
+  if (machine_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.machine_name_.SetAllocated(machine_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_name_.IsDefault()) {
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.SetMachineLights.machine_name)
+}
+
+// repeated .llsf_msgs.LightSpec lights = 2;
+inline int SetMachineLights::_internal_lights_size() const {
+  return _impl_.lights_.size();
+}
+inline int SetMachineLights::lights_size() const {
+  return _internal_lights_size();
+}
+inline ::llsf_msgs::LightSpec* SetMachineLights::mutable_lights(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.SetMachineLights.lights)
+  return _impl_.lights_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >*
+SetMachineLights::mutable_lights() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.SetMachineLights.lights)
+  return &_impl_.lights_;
+}
+inline const ::llsf_msgs::LightSpec& SetMachineLights::_internal_lights(int index) const {
+  return _impl_.lights_.Get(index);
+}
+inline const ::llsf_msgs::LightSpec& SetMachineLights::lights(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetMachineLights.lights)
+  return _internal_lights(index);
+}
+inline ::llsf_msgs::LightSpec* SetMachineLights::_internal_add_lights() {
+  return _impl_.lights_.Add();
+}
+inline ::llsf_msgs::LightSpec* SetMachineLights::add_lights() {
+  ::llsf_msgs::LightSpec* _add = _internal_add_lights();
+  // @@protoc_insertion_point(field_add:llsf_msgs.SetMachineLights.lights)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >&
+SetMachineLights::lights() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.SetMachineLights.lights)
+  return _impl_.lights_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::SetMachineState_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::SetMachineState_CompType>() {
+  return ::llsf_msgs::SetMachineState_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::MachineAddBase_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::MachineAddBase_CompType>() {
+  return ::llsf_msgs::MachineAddBase_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::SetMachineLights_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::SetMachineLights_CompType>() {
+  return ::llsf_msgs::SetMachineLights_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::MachineState> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::MachineState>() {
+  return ::llsf_msgs::MachineState_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_MachineCommands_2eproto
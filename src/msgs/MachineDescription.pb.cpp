@@ -0,0 +1,122 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MachineDescription.proto
+
+#include "MachineDescription.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+}  // namespace llsf_msgs
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_MachineDescription_2eproto[4];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_MachineDescription_2eproto = nullptr;
+const uint32_t TableStruct_MachineDescription_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
+
+const char descriptor_table_protodef_MachineDescription_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\030MachineDescription.proto\022\tllsf_msgs*,\n"
+  "\nLightColor\022\007\n\003RED\020\000\022\n\n\006YELLOW\020\001\022\t\n\005GREE"
+  "N\020\002*(\n\nLightState\022\007\n\003OFF\020\000\022\006\n\002ON\020\001\022\t\n\005BL"
+  "INK\020\002*0\n\004SSOp\022\t\n\005STORE\020\001\022\014\n\010RETRIEVE\020\002\022\017"
+  "\n\013CHANGE_INFO\020\003*\'\n\004CSOp\022\020\n\014RETRIEVE_CAP\020"
+  "\001\022\r\n\tMOUNT_CAP\020\002B;\n\037org.robocup_logistic"
+  "s.llsf_msgsB\030MachineDescriptionProtos"
+  ;
+static ::_pbi::once_flag descriptor_table_MachineDescription_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_MachineDescription_2eproto = {
+    false, false, 277, descriptor_table_protodef_MachineDescription_2eproto,
+    "MachineDescription.proto",
+    &descriptor_table_MachineDescription_2eproto_once, nullptr, 0, 0,
+    schemas, file_default_instances, TableStruct_MachineDescription_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_MachineDescription_2eproto,
+    file_level_service_descriptors_MachineDescription_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_MachineDescription_2eproto_getter() {
+  return &descriptor_table_MachineDescription_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_MachineDescription_2eproto(&descriptor_table_MachineDescription_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LightColor_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineDescription_2eproto);
+  return file_level_enum_descriptors_MachineDescription_2eproto[0];
+}
+bool LightColor_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LightState_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineDescription_2eproto);
+  return file_level_enum_descriptors_MachineDescription_2eproto[1];
+}
+bool LightState_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SSOp_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineDescription_2eproto);
+  return file_level_enum_descriptors_MachineDescription_2eproto[2];
+}
+bool SSOp_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CSOp_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineDescription_2eproto);
+  return file_level_enum_descriptors_MachineDescription_2eproto[3];
+}
+bool CSOp_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
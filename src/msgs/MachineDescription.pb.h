@@ -0,0 +1,193 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MachineDescription.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_MachineDescription_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_MachineDescription_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_MachineDescription_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_MachineDescription_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_MachineDescription_2eproto;
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum LightColor : int {
+  RED = 0,
+  YELLOW = 1,
+  GREEN = 2
+};
+bool LightColor_IsValid(int value);
+constexpr LightColor LightColor_MIN = RED;
+constexpr LightColor LightColor_MAX = GREEN;
+constexpr int LightColor_ARRAYSIZE = LightColor_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LightColor_descriptor();
+template<typename T>
+inline const std::string& LightColor_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, LightColor>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function LightColor_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    LightColor_descriptor(), enum_t_value);
+}
+inline bool LightColor_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, LightColor* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<LightColor>(
+    LightColor_descriptor(), name, value);
+}
+enum LightState : int {
+  OFF = 0,
+  ON = 1,
+  BLINK = 2
+};
+bool LightState_IsValid(int value);
+constexpr LightState LightState_MIN = OFF;
+constexpr LightState LightState_MAX = BLINK;
+constexpr int LightState_ARRAYSIZE = LightState_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LightState_descriptor();
+template<typename T>
+inline const std::string& LightState_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, LightState>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function LightState_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    LightState_descriptor(), enum_t_value);
+}
+inline bool LightState_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, LightState* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<LightState>(
+    LightState_descriptor(), name, value);
+}
+enum SSOp : int {
+  STORE = 1,
+  RETRIEVE = 2,
+  CHANGE_INFO = 3
+};
+bool SSOp_IsValid(int value);
+constexpr SSOp SSOp_MIN = STORE;
+constexpr SSOp SSOp_MAX = CHANGE_INFO;
+constexpr int SSOp_ARRAYSIZE = SSOp_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SSOp_descriptor();
+template<typename T>
+inline const std::string& SSOp_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SSOp>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SSOp_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SSOp_descriptor(), enum_t_value);
+}
+inline bool SSOp_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SSOp* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SSOp>(
+    SSOp_descriptor(), name, value);
+}
+enum CSOp : int {
+  RETRIEVE_CAP = 1,
+  MOUNT_CAP = 2
+};
+bool CSOp_IsValid(int value);
+constexpr CSOp CSOp_MIN = RETRIEVE_CAP;
+constexpr CSOp CSOp_MAX = MOUNT_CAP;
+constexpr int CSOp_ARRAYSIZE = CSOp_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CSOp_descriptor();
+template<typename T>
+inline const std::string& CSOp_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CSOp>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CSOp_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CSOp_descriptor(), enum_t_value);
+}
+inline bool CSOp_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CSOp* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CSOp>(
+    CSOp_descriptor(), name, value);
+}
+// ===================================================================
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::LightColor> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::LightColor>() {
+  return ::llsf_msgs::LightColor_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::LightState> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::LightState>() {
+  return ::llsf_msgs::LightState_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::SSOp> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::SSOp>() {
+  return ::llsf_msgs::SSOp_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::CSOp> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::CSOp>() {
+  return ::llsf_msgs::CSOp_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_MachineDescription_2eproto
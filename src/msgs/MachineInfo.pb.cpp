@@ -0,0 +1,2240 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MachineInfo.proto
+
+#include "MachineInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR LightSpec::LightSpec(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.color_)*/0
+  , /*decltype(_impl_.state_)*/0} {}
+struct LightSpecDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LightSpecDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LightSpecDefaultTypeInternal() {}
+  union {
+    LightSpec _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LightSpecDefaultTypeInternal _LightSpec_default_instance_;
+PROTOBUF_CONSTEXPR ShelfSlotInfo::ShelfSlotInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shelf_)*/0u
+  , /*decltype(_impl_.slot_)*/0u
+  , /*decltype(_impl_.is_filled_)*/false} {}
+struct ShelfSlotInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ShelfSlotInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ShelfSlotInfoDefaultTypeInternal() {}
+  union {
+    ShelfSlotInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ShelfSlotInfoDefaultTypeInternal _ShelfSlotInfo_default_instance_;
+PROTOBUF_CONSTEXPR Machine::Machine(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.lights_)*/{}
+  , /*decltype(_impl_.ring_colors_)*/{}
+  , /*decltype(_impl_.status_ss_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.state_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.pose_)*/nullptr
+  , /*decltype(_impl_.instruction_bs_)*/nullptr
+  , /*decltype(_impl_.instruction_ds_)*/nullptr
+  , /*decltype(_impl_.instruction_rs_)*/nullptr
+  , /*decltype(_impl_.instruction_cs_)*/nullptr
+  , /*decltype(_impl_.instruction_ss_)*/nullptr
+  , /*decltype(_impl_.correctly_reported_)*/false
+  , /*decltype(_impl_.team_color_)*/0
+  , /*decltype(_impl_.rotation_)*/0u
+  , /*decltype(_impl_.loaded_with_)*/0u
+  , /*decltype(_impl_.exploration_rotation_state_)*/0
+  , /*decltype(_impl_.exploration_zone_state_)*/0
+  , /*decltype(_impl_.zone_)*/18} {}
+struct MachineDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MachineDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MachineDefaultTypeInternal() {}
+  union {
+    Machine _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MachineDefaultTypeInternal _Machine_default_instance_;
+PROTOBUF_CONSTEXPR MachineInfo::MachineInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.machines_)*/{}
+  , /*decltype(_impl_.team_color_)*/0} {}
+struct MachineInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MachineInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MachineInfoDefaultTypeInternal() {}
+  union {
+    MachineInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MachineInfoDefaultTypeInternal _MachineInfo_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_MachineInfo_2eproto[4];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_MachineInfo_2eproto[5];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_MachineInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_MachineInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::LightSpec, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::LightSpec, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::LightSpec, _impl_.color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::LightSpec, _impl_.state_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ShelfSlotInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ShelfSlotInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ShelfSlotInfo, _impl_.shelf_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ShelfSlotInfo, _impl_.slot_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ShelfSlotInfo, _impl_.is_filled_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ShelfSlotInfo, _impl_.description_),
+  1,
+  2,
+  3,
+  0,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.team_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.lights_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.pose_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.zone_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.rotation_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.correctly_reported_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.loaded_with_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.ring_colors_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.instruction_bs_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.instruction_ds_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.instruction_ss_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.instruction_rs_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.instruction_cs_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.exploration_rotation_state_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.exploration_zone_state_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Machine, _impl_.status_ss_),
+  0,
+  1,
+  2,
+  10,
+  ~0u,
+  3,
+  15,
+  11,
+  9,
+  12,
+  ~0u,
+  4,
+  5,
+  8,
+  6,
+  7,
+  13,
+  14,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineInfo, _impl_.machines_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineInfo, _impl_.team_color_),
+  ~0u,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::llsf_msgs::LightSpec)},
+  { 10, 20, -1, sizeof(::llsf_msgs::ShelfSlotInfo)},
+  { 24, 49, -1, sizeof(::llsf_msgs::Machine)},
+  { 68, 76, -1, sizeof(::llsf_msgs::MachineInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_LightSpec_default_instance_._instance,
+  &::llsf_msgs::_ShelfSlotInfo_default_instance_._instance,
+  &::llsf_msgs::_Machine_default_instance_._instance,
+  &::llsf_msgs::_MachineInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_MachineInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021MachineInfo.proto\022\tllsf_msgs\032\014Pose2D.p"
+  "roto\032\022ProductColor.proto\032\nTeam.proto\032\nZo"
+  "ne.proto\032\031MachineInstructions.proto\032\030Mac"
+  "hineDescription.proto\"\177\n\tLightSpec\022$\n\005co"
+  "lor\030\001 \002(\0162\025.llsf_msgs.LightColor\022$\n\005stat"
+  "e\030\002 \002(\0162\025.llsf_msgs.LightState\"&\n\010CompTy"
+  "pe\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020\n\"|\n\rShelfS"
+  "lotInfo\022\r\n\005shelf\030\001 \002(\r\022\014\n\004slot\030\002 \002(\r\022\021\n\t"
+  "is_filled\030\003 \002(\010\022\023\n\013description\030\005 \001(\t\"&\n\010"
+  "CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020y\"\240\006\n"
+  "\007Machine\022\014\n\004name\030\001 \002(\t\022\014\n\004type\030\002 \001(\t\022\r\n\005"
+  "state\030\003 \001(\t\022#\n\nteam_color\030\n \001(\0162\017.llsf_m"
+  "sgs.Team\022$\n\006lights\030\007 \003(\0132\024.llsf_msgs.Lig"
+  "htSpec\022\037\n\004pose\030\010 \001(\0132\021.llsf_msgs.Pose2D\022"
+  "\035\n\004zone\030\013 \001(\0162\017.llsf_msgs.Zone\022\020\n\010rotati"
+  "on\030\014 \001(\r\022\032\n\022correctly_reported\030\t \001(\010\022\026\n\013"
+  "loaded_with\030\r \001(\r:\0010\022)\n\013ring_colors\030\016 \003("
+  "\0162\024.llsf_msgs.RingColor\0227\n\016instruction_b"
+  "s\030\020 \001(\0132\037.llsf_msgs.PrepareInstructionBS"
+  "\0227\n\016instruction_ds\030\021 \001(\0132\037.llsf_msgs.Pre"
+  "pareInstructionDS\0227\n\016instruction_ss\030\024 \001("
+  "\0132\037.llsf_msgs.PrepareInstructionSS\0227\n\016in"
+  "struction_rs\030\022 \001(\0132\037.llsf_msgs.PrepareIn"
+  "structionRS\0227\n\016instruction_cs\030\023 \001(\0132\037.ll"
+  "sf_msgs.PrepareInstructionCS\022\?\n\032explorat"
+  "ion_rotation_state\030\025 \001(\0162\033.llsf_msgs.Exp"
+  "lorationState\022;\n\026exploration_zone_state\030"
+  "\026 \001(\0162\033.llsf_msgs.ExplorationState\022+\n\tst"
+  "atus_ss\030\031 \003(\0132\030.llsf_msgs.ShelfSlotInfo\""
+  "&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020\014\""
+  "\200\001\n\013MachineInfo\022$\n\010machines\030\001 \003(\0132\022.llsf"
+  "_msgs.Machine\022#\n\nteam_color\030\002 \001(\0162\017.llsf"
+  "_msgs.Team\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010"
+  "MSG_TYPE\020\r*G\n\020ExplorationState\022\r\n\tNO_REP"
+  "ORT\020\000\022\022\n\016CORRECT_REPORT\020\001\022\020\n\014WRONG_REPOR"
+  "T\020\002B4\n\037org.robocup_logistics.llsf_msgsB\021"
+  "MachineInfoProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_MachineInfo_2eproto_deps[6] = {
+  &::descriptor_table_MachineDescription_2eproto,
+  &::descriptor_table_MachineInstructions_2eproto,
+  &::descriptor_table_Pose2D_2eproto,
+  &::descriptor_table_ProductColor_2eproto,
+  &::descriptor_table_Team_2eproto,
+  &::descriptor_table_Zone_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_MachineInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_MachineInfo_2eproto = {
+    false, false, 1457, descriptor_table_protodef_MachineInfo_2eproto,
+    "MachineInfo.proto",
+    &descriptor_table_MachineInfo_2eproto_once, descriptor_table_MachineInfo_2eproto_deps, 6, 4,
+    schemas, file_default_instances, TableStruct_MachineInfo_2eproto::offsets,
+    file_level_metadata_MachineInfo_2eproto, file_level_enum_descriptors_MachineInfo_2eproto,
+    file_level_service_descriptors_MachineInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_MachineInfo_2eproto_getter() {
+  return &descriptor_table_MachineInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_MachineInfo_2eproto(&descriptor_table_MachineInfo_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LightSpec_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineInfo_2eproto);
+  return file_level_enum_descriptors_MachineInfo_2eproto[0];
+}
+bool LightSpec_CompType_IsValid(int value) {
+  switch (value) {
+    case 10:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr LightSpec_CompType LightSpec::COMP_ID;
+constexpr LightSpec_CompType LightSpec::MSG_TYPE;
+constexpr LightSpec_CompType LightSpec::CompType_MIN;
+constexpr LightSpec_CompType LightSpec::CompType_MAX;
+constexpr int LightSpec::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ShelfSlotInfo_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineInfo_2eproto);
+  return file_level_enum_descriptors_MachineInfo_2eproto[1];
+}
+bool ShelfSlotInfo_CompType_IsValid(int value) {
+  switch (value) {
+    case 121:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ShelfSlotInfo_CompType ShelfSlotInfo::COMP_ID;
+constexpr ShelfSlotInfo_CompType ShelfSlotInfo::MSG_TYPE;
+constexpr ShelfSlotInfo_CompType ShelfSlotInfo::CompType_MIN;
+constexpr ShelfSlotInfo_CompType ShelfSlotInfo::CompType_MAX;
+constexpr int ShelfSlotInfo::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Machine_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineInfo_2eproto);
+  return file_level_enum_descriptors_MachineInfo_2eproto[2];
+}
+bool Machine_CompType_IsValid(int value) {
+  switch (value) {
+    case 12:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Machine_CompType Machine::COMP_ID;
+constexpr Machine_CompType Machine::MSG_TYPE;
+constexpr Machine_CompType Machine::CompType_MIN;
+constexpr Machine_CompType Machine::CompType_MAX;
+constexpr int Machine::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineInfo_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineInfo_2eproto);
+  return file_level_enum_descriptors_MachineInfo_2eproto[3];
+}
+bool MachineInfo_CompType_IsValid(int value) {
+  switch (value) {
+    case 13:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr MachineInfo_CompType MachineInfo::COMP_ID;
+constexpr MachineInfo_CompType MachineInfo::MSG_TYPE;
+constexpr MachineInfo_CompType MachineInfo::CompType_MIN;
+constexpr MachineInfo_CompType MachineInfo::CompType_MAX;
+constexpr int MachineInfo::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExplorationState_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineInfo_2eproto);
+  return file_level_enum_descriptors_MachineInfo_2eproto[4];
+}
+bool ExplorationState_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class LightSpec::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LightSpec>()._impl_._has_bits_);
+  static void set_has_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+LightSpec::LightSpec(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.LightSpec)
+}
+LightSpec::LightSpec(const LightSpec& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LightSpec* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.color_){}
+    , decltype(_impl_.state_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.color_, &from._impl_.color_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.state_) -
+    reinterpret_cast<char*>(&_impl_.color_)) + sizeof(_impl_.state_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.LightSpec)
+}
+
+inline void LightSpec::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.color_){0}
+    , decltype(_impl_.state_){0}
+  };
+}
+
+LightSpec::~LightSpec() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.LightSpec)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LightSpec::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LightSpec::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LightSpec::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.LightSpec)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.color_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.state_) -
+        reinterpret_cast<char*>(&_impl_.color_)) + sizeof(_impl_.state_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LightSpec::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.LightColor color = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::LightColor_IsValid(val))) {
+            _internal_set_color(static_cast<::llsf_msgs::LightColor>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.LightState state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::LightState_IsValid(val))) {
+            _internal_set_state(static_cast<::llsf_msgs::LightState>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LightSpec::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.LightSpec)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.LightColor color = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_color(), target);
+  }
+
+  // required .llsf_msgs.LightState state = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_state(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.LightSpec)
+  return target;
+}
+
+size_t LightSpec::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.LightSpec)
+  size_t total_size = 0;
+
+  if (_internal_has_color()) {
+    // required .llsf_msgs.LightColor color = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_color());
+  }
+
+  if (_internal_has_state()) {
+    // required .llsf_msgs.LightState state = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+  }
+
+  return total_size;
+}
+size_t LightSpec::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.LightSpec)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .llsf_msgs.LightColor color = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_color());
+
+    // required .llsf_msgs.LightState state = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LightSpec::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LightSpec::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LightSpec::GetClassData() const { return &_class_data_; }
+
+
+void LightSpec::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LightSpec*>(&to_msg);
+  auto& from = static_cast<const LightSpec&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.LightSpec)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.color_ = from._impl_.color_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.state_ = from._impl_.state_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LightSpec::CopyFrom(const LightSpec& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.LightSpec)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LightSpec::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void LightSpec::InternalSwap(LightSpec* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LightSpec, _impl_.state_)
+      + sizeof(LightSpec::_impl_.state_)
+      - PROTOBUF_FIELD_OFFSET(LightSpec, _impl_.color_)>(
+          reinterpret_cast<char*>(&_impl_.color_),
+          reinterpret_cast<char*>(&other->_impl_.color_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LightSpec::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInfo_2eproto_getter, &descriptor_table_MachineInfo_2eproto_once,
+      file_level_metadata_MachineInfo_2eproto[0]);
+}
+
+// ===================================================================
+
+class ShelfSlotInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ShelfSlotInfo>()._impl_._has_bits_);
+  static void set_has_shelf(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_slot(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_is_filled(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_description(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000e) ^ 0x0000000e) != 0;
+  }
+};
+
+ShelfSlotInfo::ShelfSlotInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.ShelfSlotInfo)
+}
+ShelfSlotInfo::ShelfSlotInfo(const ShelfSlotInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ShelfSlotInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.shelf_){}
+    , decltype(_impl_.slot_){}
+    , decltype(_impl_.is_filled_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_description()) {
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.shelf_, &from._impl_.shelf_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_filled_) -
+    reinterpret_cast<char*>(&_impl_.shelf_)) + sizeof(_impl_.is_filled_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.ShelfSlotInfo)
+}
+
+inline void ShelfSlotInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.shelf_){0u}
+    , decltype(_impl_.slot_){0u}
+    , decltype(_impl_.is_filled_){false}
+  };
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ShelfSlotInfo::~ShelfSlotInfo() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.ShelfSlotInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ShelfSlotInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.description_.Destroy();
+}
+
+void ShelfSlotInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ShelfSlotInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.ShelfSlotInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.description_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.shelf_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.is_filled_) -
+        reinterpret_cast<char*>(&_impl_.shelf_)) + sizeof(_impl_.is_filled_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ShelfSlotInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 shelf = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_shelf(&has_bits);
+          _impl_.shelf_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 slot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_slot(&has_bits);
+          _impl_.slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool is_filled = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_is_filled(&has_bits);
+          _impl_.is_filled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string description = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.ShelfSlotInfo.description");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ShelfSlotInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.ShelfSlotInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 shelf = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_shelf(), target);
+  }
+
+  // required uint32 slot = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_slot(), target);
+  }
+
+  // required bool is_filled = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_filled(), target);
+  }
+
+  // optional string description = 5;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.ShelfSlotInfo.description");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_description(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.ShelfSlotInfo)
+  return target;
+}
+
+size_t ShelfSlotInfo::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.ShelfSlotInfo)
+  size_t total_size = 0;
+
+  if (_internal_has_shelf()) {
+    // required uint32 shelf = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shelf());
+  }
+
+  if (_internal_has_slot()) {
+    // required uint32 slot = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_slot());
+  }
+
+  if (_internal_has_is_filled()) {
+    // required bool is_filled = 3;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t ShelfSlotInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.ShelfSlotInfo)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000e) ^ 0x0000000e) == 0) {  // All required fields are present.
+    // required uint32 shelf = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shelf());
+
+    // required uint32 slot = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_slot());
+
+    // required bool is_filled = 3;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string description = 5;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_description());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ShelfSlotInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ShelfSlotInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ShelfSlotInfo::GetClassData() const { return &_class_data_; }
+
+
+void ShelfSlotInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ShelfSlotInfo*>(&to_msg);
+  auto& from = static_cast<const ShelfSlotInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.ShelfSlotInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_description(from._internal_description());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.shelf_ = from._impl_.shelf_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.slot_ = from._impl_.slot_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.is_filled_ = from._impl_.is_filled_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ShelfSlotInfo::CopyFrom(const ShelfSlotInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.ShelfSlotInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ShelfSlotInfo::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ShelfSlotInfo::InternalSwap(ShelfSlotInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ShelfSlotInfo, _impl_.is_filled_)
+      + sizeof(ShelfSlotInfo::_impl_.is_filled_)
+      - PROTOBUF_FIELD_OFFSET(ShelfSlotInfo, _impl_.shelf_)>(
+          reinterpret_cast<char*>(&_impl_.shelf_),
+          reinterpret_cast<char*>(&other->_impl_.shelf_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ShelfSlotInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInfo_2eproto_getter, &descriptor_table_MachineInfo_2eproto_once,
+      file_level_metadata_MachineInfo_2eproto[1]);
+}
+
+// ===================================================================
+
+class Machine::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Machine>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::llsf_msgs::Pose2D& pose(const Machine* msg);
+  static void set_has_pose(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_zone(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_rotation(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_correctly_reported(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_loaded_with(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static const ::llsf_msgs::PrepareInstructionBS& instruction_bs(const Machine* msg);
+  static void set_has_instruction_bs(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::llsf_msgs::PrepareInstructionDS& instruction_ds(const Machine* msg);
+  static void set_has_instruction_ds(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::llsf_msgs::PrepareInstructionSS& instruction_ss(const Machine* msg);
+  static void set_has_instruction_ss(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::llsf_msgs::PrepareInstructionRS& instruction_rs(const Machine* msg);
+  static void set_has_instruction_rs(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::llsf_msgs::PrepareInstructionCS& instruction_cs(const Machine* msg);
+  static void set_has_instruction_cs(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_exploration_rotation_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_exploration_zone_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::llsf_msgs::Pose2D&
+Machine::_Internal::pose(const Machine* msg) {
+  return *msg->_impl_.pose_;
+}
+const ::llsf_msgs::PrepareInstructionBS&
+Machine::_Internal::instruction_bs(const Machine* msg) {
+  return *msg->_impl_.instruction_bs_;
+}
+const ::llsf_msgs::PrepareInstructionDS&
+Machine::_Internal::instruction_ds(const Machine* msg) {
+  return *msg->_impl_.instruction_ds_;
+}
+const ::llsf_msgs::PrepareInstructionSS&
+Machine::_Internal::instruction_ss(const Machine* msg) {
+  return *msg->_impl_.instruction_ss_;
+}
+const ::llsf_msgs::PrepareInstructionRS&
+Machine::_Internal::instruction_rs(const Machine* msg) {
+  return *msg->_impl_.instruction_rs_;
+}
+const ::llsf_msgs::PrepareInstructionCS&
+Machine::_Internal::instruction_cs(const Machine* msg) {
+  return *msg->_impl_.instruction_cs_;
+}
+void Machine::clear_pose() {
+  if (_impl_.pose_ != nullptr) _impl_.pose_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+void Machine::clear_instruction_bs() {
+  if (_impl_.instruction_bs_ != nullptr) _impl_.instruction_bs_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+void Machine::clear_instruction_ds() {
+  if (_impl_.instruction_ds_ != nullptr) _impl_.instruction_ds_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+void Machine::clear_instruction_ss() {
+  if (_impl_.instruction_ss_ != nullptr) _impl_.instruction_ss_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+void Machine::clear_instruction_rs() {
+  if (_impl_.instruction_rs_ != nullptr) _impl_.instruction_rs_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+void Machine::clear_instruction_cs() {
+  if (_impl_.instruction_cs_ != nullptr) _impl_.instruction_cs_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+Machine::Machine(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.Machine)
+}
+Machine::Machine(const Machine& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Machine* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lights_){from._impl_.lights_}
+    , decltype(_impl_.ring_colors_){from._impl_.ring_colors_}
+    , decltype(_impl_.status_ss_){from._impl_.status_ss_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.pose_){nullptr}
+    , decltype(_impl_.instruction_bs_){nullptr}
+    , decltype(_impl_.instruction_ds_){nullptr}
+    , decltype(_impl_.instruction_rs_){nullptr}
+    , decltype(_impl_.instruction_cs_){nullptr}
+    , decltype(_impl_.instruction_ss_){nullptr}
+    , decltype(_impl_.correctly_reported_){}
+    , decltype(_impl_.team_color_){}
+    , decltype(_impl_.rotation_){}
+    , decltype(_impl_.loaded_with_){}
+    , decltype(_impl_.exploration_rotation_state_){}
+    , decltype(_impl_.exploration_zone_state_){}
+    , decltype(_impl_.zone_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_type()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_state()) {
+    _this->_impl_.state_.Set(from._internal_state(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_pose()) {
+    _this->_impl_.pose_ = new ::llsf_msgs::Pose2D(*from._impl_.pose_);
+  }
+  if (from._internal_has_instruction_bs()) {
+    _this->_impl_.instruction_bs_ = new ::llsf_msgs::PrepareInstructionBS(*from._impl_.instruction_bs_);
+  }
+  if (from._internal_has_instruction_ds()) {
+    _this->_impl_.instruction_ds_ = new ::llsf_msgs::PrepareInstructionDS(*from._impl_.instruction_ds_);
+  }
+  if (from._internal_has_instruction_rs()) {
+    _this->_impl_.instruction_rs_ = new ::llsf_msgs::PrepareInstructionRS(*from._impl_.instruction_rs_);
+  }
+  if (from._internal_has_instruction_cs()) {
+    _this->_impl_.instruction_cs_ = new ::llsf_msgs::PrepareInstructionCS(*from._impl_.instruction_cs_);
+  }
+  if (from._internal_has_instruction_ss()) {
+    _this->_impl_.instruction_ss_ = new ::llsf_msgs::PrepareInstructionSS(*from._impl_.instruction_ss_);
+  }
+  ::memcpy(&_impl_.correctly_reported_, &from._impl_.correctly_reported_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.zone_) -
+    reinterpret_cast<char*>(&_impl_.correctly_reported_)) + sizeof(_impl_.zone_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.Machine)
+}
+
+inline void Machine::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lights_){arena}
+    , decltype(_impl_.ring_colors_){arena}
+    , decltype(_impl_.status_ss_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.pose_){nullptr}
+    , decltype(_impl_.instruction_bs_){nullptr}
+    , decltype(_impl_.instruction_ds_){nullptr}
+    , decltype(_impl_.instruction_rs_){nullptr}
+    , decltype(_impl_.instruction_cs_){nullptr}
+    , decltype(_impl_.instruction_ss_){nullptr}
+    , decltype(_impl_.correctly_reported_){false}
+    , decltype(_impl_.team_color_){0}
+    , decltype(_impl_.rotation_){0u}
+    , decltype(_impl_.loaded_with_){0u}
+    , decltype(_impl_.exploration_rotation_state_){0}
+    , decltype(_impl_.exploration_zone_state_){0}
+    , decltype(_impl_.zone_){18}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Machine::~Machine() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.Machine)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Machine::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lights_.~RepeatedPtrField();
+  _impl_.ring_colors_.~RepeatedField();
+  _impl_.status_ss_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.type_.Destroy();
+  _impl_.state_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.pose_;
+  if (this != internal_default_instance()) delete _impl_.instruction_bs_;
+  if (this != internal_default_instance()) delete _impl_.instruction_ds_;
+  if (this != internal_default_instance()) delete _impl_.instruction_rs_;
+  if (this != internal_default_instance()) delete _impl_.instruction_cs_;
+  if (this != internal_default_instance()) delete _impl_.instruction_ss_;
+}
+
+void Machine::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Machine::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.Machine)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.lights_.Clear();
+  _impl_.ring_colors_.Clear();
+  _impl_.status_ss_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.state_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.pose_ != nullptr);
+      _impl_.pose_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.instruction_bs_ != nullptr);
+      _impl_.instruction_bs_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.instruction_ds_ != nullptr);
+      _impl_.instruction_ds_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.instruction_rs_ != nullptr);
+      _impl_.instruction_rs_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.instruction_cs_ != nullptr);
+      _impl_.instruction_cs_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000100u) {
+    GOOGLE_DCHECK(_impl_.instruction_ss_ != nullptr);
+    _impl_.instruction_ss_->Clear();
+  }
+  if (cached_has_bits & 0x0000fe00u) {
+    ::memset(&_impl_.correctly_reported_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.exploration_zone_state_) -
+        reinterpret_cast<char*>(&_impl_.correctly_reported_)) + sizeof(_impl_.exploration_zone_state_));
+    _impl_.zone_ = 18;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Machine::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.Machine.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.Machine.type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_state();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.Machine.state");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.LightSpec lights = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_lights(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Pose2D pose = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pose(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool correctly_reported = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_correctly_reported(&has_bits);
+          _impl_.correctly_reported_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Team team_color = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(10, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Zone zone = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Zone_IsValid(val))) {
+            _internal_set_zone(static_cast<::llsf_msgs::Zone>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(11, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 rotation = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_rotation(&has_bits);
+          _impl_.rotation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 loaded_with = 13 [default = 0];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_loaded_with(&has_bits);
+          _impl_.loaded_with_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.RingColor ring_colors = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::RingColor_IsValid(val))) {
+              _internal_add_ring_colors(static_cast<::llsf_msgs::RingColor>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(14, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<112>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 114) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_ring_colors(), ptr, ctx, ::llsf_msgs::RingColor_IsValid, &_internal_metadata_, 14);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.PrepareInstructionBS instruction_bs = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_instruction_bs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.PrepareInstructionDS instruction_ds = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_instruction_ds(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.PrepareInstructionRS instruction_rs = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_instruction_rs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.PrepareInstructionCS instruction_cs = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_instruction_cs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.PrepareInstructionSS instruction_ss = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_instruction_ss(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.ExplorationState exploration_rotation_state = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::ExplorationState_IsValid(val))) {
+            _internal_set_exploration_rotation_state(static_cast<::llsf_msgs::ExplorationState>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(21, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.ExplorationState exploration_zone_state = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 176)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::ExplorationState_IsValid(val))) {
+            _internal_set_exploration_zone_state(static_cast<::llsf_msgs::ExplorationState>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(22, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.ShelfSlotInfo status_ss = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 202)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_status_ss(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<202>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Machine::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.Machine)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.Machine.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional string type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.Machine.type");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_type(), target);
+  }
+
+  // optional string state = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_state().data(), static_cast<int>(this->_internal_state().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.Machine.state");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_state(), target);
+  }
+
+  // repeated .llsf_msgs.LightSpec lights = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_lights_size()); i < n; i++) {
+    const auto& repfield = this->_internal_lights(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.Pose2D pose = 8;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::pose(this),
+        _Internal::pose(this).GetCachedSize(), target, stream);
+  }
+
+  // optional bool correctly_reported = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_correctly_reported(), target);
+  }
+
+  // optional .llsf_msgs.Team team_color = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      10, this->_internal_team_color(), target);
+  }
+
+  // optional .llsf_msgs.Zone zone = 11;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      11, this->_internal_zone(), target);
+  }
+
+  // optional uint32 rotation = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_rotation(), target);
+  }
+
+  // optional uint32 loaded_with = 13 [default = 0];
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_loaded_with(), target);
+  }
+
+  // repeated .llsf_msgs.RingColor ring_colors = 14;
+  for (int i = 0, n = this->_internal_ring_colors_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        14, this->_internal_ring_colors(i), target);
+  }
+
+  // optional .llsf_msgs.PrepareInstructionBS instruction_bs = 16;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(16, _Internal::instruction_bs(this),
+        _Internal::instruction_bs(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.PrepareInstructionDS instruction_ds = 17;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(17, _Internal::instruction_ds(this),
+        _Internal::instruction_ds(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.PrepareInstructionRS instruction_rs = 18;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, _Internal::instruction_rs(this),
+        _Internal::instruction_rs(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.PrepareInstructionCS instruction_cs = 19;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(19, _Internal::instruction_cs(this),
+        _Internal::instruction_cs(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.PrepareInstructionSS instruction_ss = 20;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(20, _Internal::instruction_ss(this),
+        _Internal::instruction_ss(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.ExplorationState exploration_rotation_state = 21;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      21, this->_internal_exploration_rotation_state(), target);
+  }
+
+  // optional .llsf_msgs.ExplorationState exploration_zone_state = 22;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      22, this->_internal_exploration_zone_state(), target);
+  }
+
+  // repeated .llsf_msgs.ShelfSlotInfo status_ss = 25;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_status_ss_size()); i < n; i++) {
+    const auto& repfield = this->_internal_status_ss(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(25, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.Machine)
+  return target;
+}
+
+size_t Machine::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.Machine)
+  size_t total_size = 0;
+
+  // required string name = 1;
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.LightSpec lights = 7;
+  total_size += 1UL * this->_internal_lights_size();
+  for (const auto& msg : this->_impl_.lights_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .llsf_msgs.RingColor ring_colors = 14;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_ring_colors_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_ring_colors(static_cast<int>(i)));
+    }
+    total_size += (1UL * count) + data_size;
+  }
+
+  // repeated .llsf_msgs.ShelfSlotInfo status_ss = 25;
+  total_size += 2UL * this->_internal_status_ss_size();
+  for (const auto& msg : this->_impl_.status_ss_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000feu) {
+    // optional string type = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_type());
+    }
+
+    // optional string state = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_state());
+    }
+
+    // optional .llsf_msgs.Pose2D pose = 8;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pose_);
+    }
+
+    // optional .llsf_msgs.PrepareInstructionBS instruction_bs = 16;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.instruction_bs_);
+    }
+
+    // optional .llsf_msgs.PrepareInstructionDS instruction_ds = 17;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.instruction_ds_);
+    }
+
+    // optional .llsf_msgs.PrepareInstructionRS instruction_rs = 18;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.instruction_rs_);
+    }
+
+    // optional .llsf_msgs.PrepareInstructionCS instruction_cs = 19;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.instruction_cs_);
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional .llsf_msgs.PrepareInstructionSS instruction_ss = 20;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.instruction_ss_);
+    }
+
+    // optional bool correctly_reported = 9;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 1;
+    }
+
+    // optional .llsf_msgs.Team team_color = 10;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+    }
+
+    // optional uint32 rotation = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_rotation());
+    }
+
+    // optional uint32 loaded_with = 13 [default = 0];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_loaded_with());
+    }
+
+    // optional .llsf_msgs.ExplorationState exploration_rotation_state = 21;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_exploration_rotation_state());
+    }
+
+    // optional .llsf_msgs.ExplorationState exploration_zone_state = 22;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_exploration_zone_state());
+    }
+
+    // optional .llsf_msgs.Zone zone = 11;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_zone());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Machine::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Machine::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Machine::GetClassData() const { return &_class_data_; }
+
+
+void Machine::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Machine*>(&to_msg);
+  auto& from = static_cast<const Machine&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.Machine)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.lights_.MergeFrom(from._impl_.lights_);
+  _this->_impl_.ring_colors_.MergeFrom(from._impl_.ring_colors_);
+  _this->_impl_.status_ss_.MergeFrom(from._impl_.status_ss_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_type(from._internal_type());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_state(from._internal_state());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_pose()->::llsf_msgs::Pose2D::MergeFrom(
+          from._internal_pose());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_instruction_bs()->::llsf_msgs::PrepareInstructionBS::MergeFrom(
+          from._internal_instruction_bs());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_instruction_ds()->::llsf_msgs::PrepareInstructionDS::MergeFrom(
+          from._internal_instruction_ds());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_instruction_rs()->::llsf_msgs::PrepareInstructionRS::MergeFrom(
+          from._internal_instruction_rs());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_instruction_cs()->::llsf_msgs::PrepareInstructionCS::MergeFrom(
+          from._internal_instruction_cs());
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_instruction_ss()->::llsf_msgs::PrepareInstructionSS::MergeFrom(
+          from._internal_instruction_ss());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.correctly_reported_ = from._impl_.correctly_reported_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.rotation_ = from._impl_.rotation_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.loaded_with_ = from._impl_.loaded_with_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.exploration_rotation_state_ = from._impl_.exploration_rotation_state_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.exploration_zone_state_ = from._impl_.exploration_zone_state_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.zone_ = from._impl_.zone_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Machine::CopyFrom(const Machine& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.Machine)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Machine::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.lights_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.status_ss_))
+    return false;
+  if (_internal_has_pose()) {
+    if (!_impl_.pose_->IsInitialized()) return false;
+  }
+  if (_internal_has_instruction_bs()) {
+    if (!_impl_.instruction_bs_->IsInitialized()) return false;
+  }
+  if (_internal_has_instruction_ds()) {
+    if (!_impl_.instruction_ds_->IsInitialized()) return false;
+  }
+  if (_internal_has_instruction_rs()) {
+    if (!_impl_.instruction_rs_->IsInitialized()) return false;
+  }
+  if (_internal_has_instruction_cs()) {
+    if (!_impl_.instruction_cs_->IsInitialized()) return false;
+  }
+  if (_internal_has_instruction_ss()) {
+    if (!_impl_.instruction_ss_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Machine::InternalSwap(Machine* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.lights_.InternalSwap(&other->_impl_.lights_);
+  _impl_.ring_colors_.InternalSwap(&other->_impl_.ring_colors_);
+  _impl_.status_ss_.InternalSwap(&other->_impl_.status_ss_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.state_, lhs_arena,
+      &other->_impl_.state_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Machine, _impl_.exploration_zone_state_)
+      + sizeof(Machine::_impl_.exploration_zone_state_)
+      - PROTOBUF_FIELD_OFFSET(Machine, _impl_.pose_)>(
+          reinterpret_cast<char*>(&_impl_.pose_),
+          reinterpret_cast<char*>(&other->_impl_.pose_));
+  swap(_impl_.zone_, other->_impl_.zone_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Machine::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInfo_2eproto_getter, &descriptor_table_MachineInfo_2eproto_once,
+      file_level_metadata_MachineInfo_2eproto[2]);
+}
+
+// ===================================================================
+
+class MachineInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MachineInfo>()._impl_._has_bits_);
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+MachineInfo::MachineInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.MachineInfo)
+}
+MachineInfo::MachineInfo(const MachineInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MachineInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machines_){from._impl_.machines_}
+    , decltype(_impl_.team_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.team_color_ = from._impl_.team_color_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.MachineInfo)
+}
+
+inline void MachineInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machines_){arena}
+    , decltype(_impl_.team_color_){0}
+  };
+}
+
+MachineInfo::~MachineInfo() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.MachineInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MachineInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.machines_.~RepeatedPtrField();
+}
+
+void MachineInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MachineInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.MachineInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.machines_.Clear();
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MachineInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .llsf_msgs.Machine machines = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_machines(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Team team_color = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MachineInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.MachineInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Machine machines = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_machines_size()); i < n; i++) {
+    const auto& repfield = this->_internal_machines(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .llsf_msgs.Team team_color = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_team_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.MachineInfo)
+  return target;
+}
+
+size_t MachineInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.MachineInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Machine machines = 1;
+  total_size += 1UL * this->_internal_machines_size();
+  for (const auto& msg : this->_impl_.machines_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional .llsf_msgs.Team team_color = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MachineInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MachineInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MachineInfo::GetClassData() const { return &_class_data_; }
+
+
+void MachineInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MachineInfo*>(&to_msg);
+  auto& from = static_cast<const MachineInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.MachineInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.machines_.MergeFrom(from._impl_.machines_);
+  if (from._internal_has_team_color()) {
+    _this->_internal_set_team_color(from._internal_team_color());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MachineInfo::CopyFrom(const MachineInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.MachineInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MachineInfo::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.machines_))
+    return false;
+  return true;
+}
+
+void MachineInfo::InternalSwap(MachineInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.machines_.InternalSwap(&other->_impl_.machines_);
+  swap(_impl_.team_color_, other->_impl_.team_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MachineInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInfo_2eproto_getter, &descriptor_table_MachineInfo_2eproto_once,
+      file_level_metadata_MachineInfo_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::LightSpec*
+Arena::CreateMaybeMessage< ::llsf_msgs::LightSpec >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::LightSpec >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::ShelfSlotInfo*
+Arena::CreateMaybeMessage< ::llsf_msgs::ShelfSlotInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::ShelfSlotInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::Machine*
+Arena::CreateMaybeMessage< ::llsf_msgs::Machine >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::Machine >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::MachineInfo*
+Arena::CreateMaybeMessage< ::llsf_msgs::MachineInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::MachineInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
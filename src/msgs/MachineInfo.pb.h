@@ -0,0 +1,2772 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MachineInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_MachineInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_MachineInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Pose2D.pb.h"
+#include "ProductColor.pb.h"
+#include "Team.pb.h"
+#include "Zone.pb.h"
+#include "MachineInstructions.pb.h"
+#include "MachineDescription.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_MachineInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_MachineInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_MachineInfo_2eproto;
+namespace llsf_msgs {
+class LightSpec;
+struct LightSpecDefaultTypeInternal;
+extern LightSpecDefaultTypeInternal _LightSpec_default_instance_;
+class Machine;
+struct MachineDefaultTypeInternal;
+extern MachineDefaultTypeInternal _Machine_default_instance_;
+class MachineInfo;
+struct MachineInfoDefaultTypeInternal;
+extern MachineInfoDefaultTypeInternal _MachineInfo_default_instance_;
+class ShelfSlotInfo;
+struct ShelfSlotInfoDefaultTypeInternal;
+extern ShelfSlotInfoDefaultTypeInternal _ShelfSlotInfo_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::LightSpec* Arena::CreateMaybeMessage<::llsf_msgs::LightSpec>(Arena*);
+template<> ::llsf_msgs::Machine* Arena::CreateMaybeMessage<::llsf_msgs::Machine>(Arena*);
+template<> ::llsf_msgs::MachineInfo* Arena::CreateMaybeMessage<::llsf_msgs::MachineInfo>(Arena*);
+template<> ::llsf_msgs::ShelfSlotInfo* Arena::CreateMaybeMessage<::llsf_msgs::ShelfSlotInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum LightSpec_CompType : int {
+  LightSpec_CompType_COMP_ID = 2000,
+  LightSpec_CompType_MSG_TYPE = 10
+};
+bool LightSpec_CompType_IsValid(int value);
+constexpr LightSpec_CompType LightSpec_CompType_CompType_MIN = LightSpec_CompType_MSG_TYPE;
+constexpr LightSpec_CompType LightSpec_CompType_CompType_MAX = LightSpec_CompType_COMP_ID;
+constexpr int LightSpec_CompType_CompType_ARRAYSIZE = LightSpec_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LightSpec_CompType_descriptor();
+template<typename T>
+inline const std::string& LightSpec_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, LightSpec_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function LightSpec_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    LightSpec_CompType_descriptor(), enum_t_value);
+}
+inline bool LightSpec_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, LightSpec_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<LightSpec_CompType>(
+    LightSpec_CompType_descriptor(), name, value);
+}
+enum ShelfSlotInfo_CompType : int {
+  ShelfSlotInfo_CompType_COMP_ID = 2000,
+  ShelfSlotInfo_CompType_MSG_TYPE = 121
+};
+bool ShelfSlotInfo_CompType_IsValid(int value);
+constexpr ShelfSlotInfo_CompType ShelfSlotInfo_CompType_CompType_MIN = ShelfSlotInfo_CompType_MSG_TYPE;
+constexpr ShelfSlotInfo_CompType ShelfSlotInfo_CompType_CompType_MAX = ShelfSlotInfo_CompType_COMP_ID;
+constexpr int ShelfSlotInfo_CompType_CompType_ARRAYSIZE = ShelfSlotInfo_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ShelfSlotInfo_CompType_descriptor();
+template<typename T>
+inline const std::string& ShelfSlotInfo_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ShelfSlotInfo_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ShelfSlotInfo_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ShelfSlotInfo_CompType_descriptor(), enum_t_value);
+}
+inline bool ShelfSlotInfo_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ShelfSlotInfo_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ShelfSlotInfo_CompType>(
+    ShelfSlotInfo_CompType_descriptor(), name, value);
+}
+enum Machine_CompType : int {
+  Machine_CompType_COMP_ID = 2000,
+  Machine_CompType_MSG_TYPE = 12
+};
+bool Machine_CompType_IsValid(int value);
+constexpr Machine_CompType Machine_CompType_CompType_MIN = Machine_CompType_MSG_TYPE;
+constexpr Machine_CompType Machine_CompType_CompType_MAX = Machine_CompType_COMP_ID;
+constexpr int Machine_CompType_CompType_ARRAYSIZE = Machine_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Machine_CompType_descriptor();
+template<typename T>
+inline const std::string& Machine_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Machine_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Machine_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Machine_CompType_descriptor(), enum_t_value);
+}
+inline bool Machine_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Machine_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Machine_CompType>(
+    Machine_CompType_descriptor(), name, value);
+}
+enum MachineInfo_CompType : int {
+  MachineInfo_CompType_COMP_ID = 2000,
+  MachineInfo_CompType_MSG_TYPE = 13
+};
+bool MachineInfo_CompType_IsValid(int value);
+constexpr MachineInfo_CompType MachineInfo_CompType_CompType_MIN = MachineInfo_CompType_MSG_TYPE;
+constexpr MachineInfo_CompType MachineInfo_CompType_CompType_MAX = MachineInfo_CompType_COMP_ID;
+constexpr int MachineInfo_CompType_CompType_ARRAYSIZE = MachineInfo_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineInfo_CompType_descriptor();
+template<typename T>
+inline const std::string& MachineInfo_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MachineInfo_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MachineInfo_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MachineInfo_CompType_descriptor(), enum_t_value);
+}
+inline bool MachineInfo_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MachineInfo_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MachineInfo_CompType>(
+    MachineInfo_CompType_descriptor(), name, value);
+}
+enum ExplorationState : int {
+  NO_REPORT = 0,
+  CORRECT_REPORT = 1,
+  WRONG_REPORT = 2
+};
+bool ExplorationState_IsValid(int value);
+constexpr ExplorationState ExplorationState_MIN = NO_REPORT;
+constexpr ExplorationState ExplorationState_MAX = WRONG_REPORT;
+constexpr int ExplorationState_ARRAYSIZE = ExplorationState_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExplorationState_descriptor();
+template<typename T>
+inline const std::string& ExplorationState_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ExplorationState>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ExplorationState_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ExplorationState_descriptor(), enum_t_value);
+}
+inline bool ExplorationState_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ExplorationState* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ExplorationState>(
+    ExplorationState_descriptor(), name, value);
+}
+// ===================================================================
+
+class LightSpec final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.LightSpec) */ {
+ public:
+  inline LightSpec() : LightSpec(nullptr) {}
+  ~LightSpec() override;
+  explicit PROTOBUF_CONSTEXPR LightSpec(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LightSpec(const LightSpec& from);
+  LightSpec(LightSpec&& from) noexcept
+    : LightSpec() {
+    *this = ::std::move(from);
+  }
+
+  inline LightSpec& operator=(const LightSpec& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LightSpec& operator=(LightSpec&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LightSpec& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LightSpec* internal_default_instance() {
+    return reinterpret_cast<const LightSpec*>(
+               &_LightSpec_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(LightSpec& a, LightSpec& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LightSpec* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LightSpec* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LightSpec* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LightSpec>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LightSpec& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LightSpec& from) {
+    LightSpec::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LightSpec* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.LightSpec";
+  }
+  protected:
+  explicit LightSpec(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef LightSpec_CompType CompType;
+  static constexpr CompType COMP_ID =
+    LightSpec_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    LightSpec_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return LightSpec_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    LightSpec_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    LightSpec_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    LightSpec_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return LightSpec_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return LightSpec_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return LightSpec_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kColorFieldNumber = 1,
+    kStateFieldNumber = 2,
+  };
+  // required .llsf_msgs.LightColor color = 1;
+  bool has_color() const;
+  private:
+  bool _internal_has_color() const;
+  public:
+  void clear_color();
+  ::llsf_msgs::LightColor color() const;
+  void set_color(::llsf_msgs::LightColor value);
+  private:
+  ::llsf_msgs::LightColor _internal_color() const;
+  void _internal_set_color(::llsf_msgs::LightColor value);
+  public:
+
+  // required .llsf_msgs.LightState state = 2;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  ::llsf_msgs::LightState state() const;
+  void set_state(::llsf_msgs::LightState value);
+  private:
+  ::llsf_msgs::LightState _internal_state() const;
+  void _internal_set_state(::llsf_msgs::LightState value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.LightSpec)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int color_;
+    int state_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ShelfSlotInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.ShelfSlotInfo) */ {
+ public:
+  inline ShelfSlotInfo() : ShelfSlotInfo(nullptr) {}
+  ~ShelfSlotInfo() override;
+  explicit PROTOBUF_CONSTEXPR ShelfSlotInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ShelfSlotInfo(const ShelfSlotInfo& from);
+  ShelfSlotInfo(ShelfSlotInfo&& from) noexcept
+    : ShelfSlotInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline ShelfSlotInfo& operator=(const ShelfSlotInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShelfSlotInfo& operator=(ShelfSlotInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ShelfSlotInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ShelfSlotInfo* internal_default_instance() {
+    return reinterpret_cast<const ShelfSlotInfo*>(
+               &_ShelfSlotInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ShelfSlotInfo& a, ShelfSlotInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ShelfSlotInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ShelfSlotInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ShelfSlotInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShelfSlotInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ShelfSlotInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ShelfSlotInfo& from) {
+    ShelfSlotInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ShelfSlotInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.ShelfSlotInfo";
+  }
+  protected:
+  explicit ShelfSlotInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ShelfSlotInfo_CompType CompType;
+  static constexpr CompType COMP_ID =
+    ShelfSlotInfo_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    ShelfSlotInfo_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return ShelfSlotInfo_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    ShelfSlotInfo_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    ShelfSlotInfo_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    ShelfSlotInfo_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return ShelfSlotInfo_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return ShelfSlotInfo_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return ShelfSlotInfo_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDescriptionFieldNumber = 5,
+    kShelfFieldNumber = 1,
+    kSlotFieldNumber = 2,
+    kIsFilledFieldNumber = 3,
+  };
+  // optional string description = 5;
+  bool has_description() const;
+  private:
+  bool _internal_has_description() const;
+  public:
+  void clear_description();
+  const std::string& description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_description();
+  PROTOBUF_NODISCARD std::string* release_description();
+  void set_allocated_description(std::string* description);
+  private:
+  const std::string& _internal_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
+  std::string* _internal_mutable_description();
+  public:
+
+  // required uint32 shelf = 1;
+  bool has_shelf() const;
+  private:
+  bool _internal_has_shelf() const;
+  public:
+  void clear_shelf();
+  uint32_t shelf() const;
+  void set_shelf(uint32_t value);
+  private:
+  uint32_t _internal_shelf() const;
+  void _internal_set_shelf(uint32_t value);
+  public:
+
+  // required uint32 slot = 2;
+  bool has_slot() const;
+  private:
+  bool _internal_has_slot() const;
+  public:
+  void clear_slot();
+  uint32_t slot() const;
+  void set_slot(uint32_t value);
+  private:
+  uint32_t _internal_slot() const;
+  void _internal_set_slot(uint32_t value);
+  public:
+
+  // required bool is_filled = 3;
+  bool has_is_filled() const;
+  private:
+  bool _internal_has_is_filled() const;
+  public:
+  void clear_is_filled();
+  bool is_filled() const;
+  void set_is_filled(bool value);
+  private:
+  bool _internal_is_filled() const;
+  void _internal_set_is_filled(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.ShelfSlotInfo)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    uint32_t shelf_;
+    uint32_t slot_;
+    bool is_filled_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Machine final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.Machine) */ {
+ public:
+  inline Machine() : Machine(nullptr) {}
+  ~Machine() override;
+  explicit PROTOBUF_CONSTEXPR Machine(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Machine(const Machine& from);
+  Machine(Machine&& from) noexcept
+    : Machine() {
+    *this = ::std::move(from);
+  }
+
+  inline Machine& operator=(const Machine& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Machine& operator=(Machine&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Machine& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Machine* internal_default_instance() {
+    return reinterpret_cast<const Machine*>(
+               &_Machine_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Machine& a, Machine& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Machine* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Machine* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Machine* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Machine>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Machine& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Machine& from) {
+    Machine::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Machine* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.Machine";
+  }
+  protected:
+  explicit Machine(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Machine_CompType CompType;
+  static constexpr CompType COMP_ID =
+    Machine_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    Machine_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return Machine_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    Machine_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    Machine_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    Machine_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return Machine_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return Machine_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return Machine_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLightsFieldNumber = 7,
+    kRingColorsFieldNumber = 14,
+    kStatusSsFieldNumber = 25,
+    kNameFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kStateFieldNumber = 3,
+    kPoseFieldNumber = 8,
+    kInstructionBsFieldNumber = 16,
+    kInstructionDsFieldNumber = 17,
+    kInstructionRsFieldNumber = 18,
+    kInstructionCsFieldNumber = 19,
+    kInstructionSsFieldNumber = 20,
+    kCorrectlyReportedFieldNumber = 9,
+    kTeamColorFieldNumber = 10,
+    kRotationFieldNumber = 12,
+    kLoadedWithFieldNumber = 13,
+    kExplorationRotationStateFieldNumber = 21,
+    kExplorationZoneStateFieldNumber = 22,
+    kZoneFieldNumber = 11,
+  };
+  // repeated .llsf_msgs.LightSpec lights = 7;
+  int lights_size() const;
+  private:
+  int _internal_lights_size() const;
+  public:
+  void clear_lights();
+  ::llsf_msgs::LightSpec* mutable_lights(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >*
+      mutable_lights();
+  private:
+  const ::llsf_msgs::LightSpec& _internal_lights(int index) const;
+  ::llsf_msgs::LightSpec* _internal_add_lights();
+  public:
+  const ::llsf_msgs::LightSpec& lights(int index) const;
+  ::llsf_msgs::LightSpec* add_lights();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >&
+      lights() const;
+
+  // repeated .llsf_msgs.RingColor ring_colors = 14;
+  int ring_colors_size() const;
+  private:
+  int _internal_ring_colors_size() const;
+  public:
+  void clear_ring_colors();
+  private:
+  ::llsf_msgs::RingColor _internal_ring_colors(int index) const;
+  void _internal_add_ring_colors(::llsf_msgs::RingColor value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_ring_colors();
+  public:
+  ::llsf_msgs::RingColor ring_colors(int index) const;
+  void set_ring_colors(int index, ::llsf_msgs::RingColor value);
+  void add_ring_colors(::llsf_msgs::RingColor value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& ring_colors() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_ring_colors();
+
+  // repeated .llsf_msgs.ShelfSlotInfo status_ss = 25;
+  int status_ss_size() const;
+  private:
+  int _internal_status_ss_size() const;
+  public:
+  void clear_status_ss();
+  ::llsf_msgs::ShelfSlotInfo* mutable_status_ss(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ShelfSlotInfo >*
+      mutable_status_ss();
+  private:
+  const ::llsf_msgs::ShelfSlotInfo& _internal_status_ss(int index) const;
+  ::llsf_msgs::ShelfSlotInfo* _internal_add_status_ss();
+  public:
+  const ::llsf_msgs::ShelfSlotInfo& status_ss(int index) const;
+  ::llsf_msgs::ShelfSlotInfo* add_status_ss();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ShelfSlotInfo >&
+      status_ss() const;
+
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string type = 2;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
+
+  // optional string state = 3;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  const std::string& state() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_state(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_state();
+  PROTOBUF_NODISCARD std::string* release_state();
+  void set_allocated_state(std::string* state);
+  private:
+  const std::string& _internal_state() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_state(const std::string& value);
+  std::string* _internal_mutable_state();
+  public:
+
+  // optional .llsf_msgs.Pose2D pose = 8;
+  bool has_pose() const;
+  private:
+  bool _internal_has_pose() const;
+  public:
+  void clear_pose();
+  const ::llsf_msgs::Pose2D& pose() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::Pose2D* release_pose();
+  ::llsf_msgs::Pose2D* mutable_pose();
+  void set_allocated_pose(::llsf_msgs::Pose2D* pose);
+  private:
+  const ::llsf_msgs::Pose2D& _internal_pose() const;
+  ::llsf_msgs::Pose2D* _internal_mutable_pose();
+  public:
+  void unsafe_arena_set_allocated_pose(
+      ::llsf_msgs::Pose2D* pose);
+  ::llsf_msgs::Pose2D* unsafe_arena_release_pose();
+
+  // optional .llsf_msgs.PrepareInstructionBS instruction_bs = 16;
+  bool has_instruction_bs() const;
+  private:
+  bool _internal_has_instruction_bs() const;
+  public:
+  void clear_instruction_bs();
+  const ::llsf_msgs::PrepareInstructionBS& instruction_bs() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::PrepareInstructionBS* release_instruction_bs();
+  ::llsf_msgs::PrepareInstructionBS* mutable_instruction_bs();
+  void set_allocated_instruction_bs(::llsf_msgs::PrepareInstructionBS* instruction_bs);
+  private:
+  const ::llsf_msgs::PrepareInstructionBS& _internal_instruction_bs() const;
+  ::llsf_msgs::PrepareInstructionBS* _internal_mutable_instruction_bs();
+  public:
+  void unsafe_arena_set_allocated_instruction_bs(
+      ::llsf_msgs::PrepareInstructionBS* instruction_bs);
+  ::llsf_msgs::PrepareInstructionBS* unsafe_arena_release_instruction_bs();
+
+  // optional .llsf_msgs.PrepareInstructionDS instruction_ds = 17;
+  bool has_instruction_ds() const;
+  private:
+  bool _internal_has_instruction_ds() const;
+  public:
+  void clear_instruction_ds();
+  const ::llsf_msgs::PrepareInstructionDS& instruction_ds() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::PrepareInstructionDS* release_instruction_ds();
+  ::llsf_msgs::PrepareInstructionDS* mutable_instruction_ds();
+  void set_allocated_instruction_ds(::llsf_msgs::PrepareInstructionDS* instruction_ds);
+  private:
+  const ::llsf_msgs::PrepareInstructionDS& _internal_instruction_ds() const;
+  ::llsf_msgs::PrepareInstructionDS* _internal_mutable_instruction_ds();
+  public:
+  void unsafe_arena_set_allocated_instruction_ds(
+      ::llsf_msgs::PrepareInstructionDS* instruction_ds);
+  ::llsf_msgs::PrepareInstructionDS* unsafe_arena_release_instruction_ds();
+
+  // optional .llsf_msgs.PrepareInstructionRS instruction_rs = 18;
+  bool has_instruction_rs() const;
+  private:
+  bool _internal_has_instruction_rs() const;
+  public:
+  void clear_instruction_rs();
+  const ::llsf_msgs::PrepareInstructionRS& instruction_rs() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::PrepareInstructionRS* release_instruction_rs();
+  ::llsf_msgs::PrepareInstructionRS* mutable_instruction_rs();
+  void set_allocated_instruction_rs(::llsf_msgs::PrepareInstructionRS* instruction_rs);
+  private:
+  const ::llsf_msgs::PrepareInstructionRS& _internal_instruction_rs() const;
+  ::llsf_msgs::PrepareInstructionRS* _internal_mutable_instruction_rs();
+  public:
+  void unsafe_arena_set_allocated_instruction_rs(
+      ::llsf_msgs::PrepareInstructionRS* instruction_rs);
+  ::llsf_msgs::PrepareInstructionRS* unsafe_arena_release_instruction_rs();
+
+  // optional .llsf_msgs.PrepareInstructionCS instruction_cs = 19;
+  bool has_instruction_cs() const;
+  private:
+  bool _internal_has_instruction_cs() const;
+  public:
+  void clear_instruction_cs();
+  const ::llsf_msgs::PrepareInstructionCS& instruction_cs() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::PrepareInstructionCS* release_instruction_cs();
+  ::llsf_msgs::PrepareInstructionCS* mutable_instruction_cs();
+  void set_allocated_instruction_cs(::llsf_msgs::PrepareInstructionCS* instruction_cs);
+  private:
+  const ::llsf_msgs::PrepareInstructionCS& _internal_instruction_cs() const;
+  ::llsf_msgs::PrepareInstructionCS* _internal_mutable_instruction_cs();
+  public:
+  void unsafe_arena_set_allocated_instruction_cs(
+      ::llsf_msgs::PrepareInstructionCS* instruction_cs);
+  ::llsf_msgs::PrepareInstructionCS* unsafe_arena_release_instruction_cs();
+
+  // optional .llsf_msgs.PrepareInstructionSS instruction_ss = 20;
+  bool has_instruction_ss() const;
+  private:
+  bool _internal_has_instruction_ss() const;
+  public:
+  void clear_instruction_ss();
+  const ::llsf_msgs::PrepareInstructionSS& instruction_ss() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::PrepareInstructionSS* release_instruction_ss();
+  ::llsf_msgs::PrepareInstructionSS* mutable_instruction_ss();
+  void set_allocated_instruction_ss(::llsf_msgs::PrepareInstructionSS* instruction_ss);
+  private:
+  const ::llsf_msgs::PrepareInstructionSS& _internal_instruction_ss() const;
+  ::llsf_msgs::PrepareInstructionSS* _internal_mutable_instruction_ss();
+  public:
+  void unsafe_arena_set_allocated_instruction_ss(
+      ::llsf_msgs::PrepareInstructionSS* instruction_ss);
+  ::llsf_msgs::PrepareInstructionSS* unsafe_arena_release_instruction_ss();
+
+  // optional bool correctly_reported = 9;
+  bool has_correctly_reported() const;
+  private:
+  bool _internal_has_correctly_reported() const;
+  public:
+  void clear_correctly_reported();
+  bool correctly_reported() const;
+  void set_correctly_reported(bool value);
+  private:
+  bool _internal_correctly_reported() const;
+  void _internal_set_correctly_reported(bool value);
+  public:
+
+  // optional .llsf_msgs.Team team_color = 10;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // optional uint32 rotation = 12;
+  bool has_rotation() const;
+  private:
+  bool _internal_has_rotation() const;
+  public:
+  void clear_rotation();
+  uint32_t rotation() const;
+  void set_rotation(uint32_t value);
+  private:
+  uint32_t _internal_rotation() const;
+  void _internal_set_rotation(uint32_t value);
+  public:
+
+  // optional uint32 loaded_with = 13 [default = 0];
+  bool has_loaded_with() const;
+  private:
+  bool _internal_has_loaded_with() const;
+  public:
+  void clear_loaded_with();
+  uint32_t loaded_with() const;
+  void set_loaded_with(uint32_t value);
+  private:
+  uint32_t _internal_loaded_with() const;
+  void _internal_set_loaded_with(uint32_t value);
+  public:
+
+  // optional .llsf_msgs.ExplorationState exploration_rotation_state = 21;
+  bool has_exploration_rotation_state() const;
+  private:
+  bool _internal_has_exploration_rotation_state() const;
+  public:
+  void clear_exploration_rotation_state();
+  ::llsf_msgs::ExplorationState exploration_rotation_state() const;
+  void set_exploration_rotation_state(::llsf_msgs::ExplorationState value);
+  private:
+  ::llsf_msgs::ExplorationState _internal_exploration_rotation_state() const;
+  void _internal_set_exploration_rotation_state(::llsf_msgs::ExplorationState value);
+  public:
+
+  // optional .llsf_msgs.ExplorationState exploration_zone_state = 22;
+  bool has_exploration_zone_state() const;
+  private:
+  bool _internal_has_exploration_zone_state() const;
+  public:
+  void clear_exploration_zone_state();
+  ::llsf_msgs::ExplorationState exploration_zone_state() const;
+  void set_exploration_zone_state(::llsf_msgs::ExplorationState value);
+  private:
+  ::llsf_msgs::ExplorationState _internal_exploration_zone_state() const;
+  void _internal_set_exploration_zone_state(::llsf_msgs::ExplorationState value);
+  public:
+
+  // optional .llsf_msgs.Zone zone = 11;
+  bool has_zone() const;
+  private:
+  bool _internal_has_zone() const;
+  public:
+  void clear_zone();
+  ::llsf_msgs::Zone zone() const;
+  void set_zone(::llsf_msgs::Zone value);
+  private:
+  ::llsf_msgs::Zone _internal_zone() const;
+  void _internal_set_zone(::llsf_msgs::Zone value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.Machine)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec > lights_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> ring_colors_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ShelfSlotInfo > status_ss_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr state_;
+    ::llsf_msgs::Pose2D* pose_;
+    ::llsf_msgs::PrepareInstructionBS* instruction_bs_;
+    ::llsf_msgs::PrepareInstructionDS* instruction_ds_;
+    ::llsf_msgs::PrepareInstructionRS* instruction_rs_;
+    ::llsf_msgs::PrepareInstructionCS* instruction_cs_;
+    ::llsf_msgs::PrepareInstructionSS* instruction_ss_;
+    bool correctly_reported_;
+    int team_color_;
+    uint32_t rotation_;
+    uint32_t loaded_with_;
+    int exploration_rotation_state_;
+    int exploration_zone_state_;
+    int zone_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MachineInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.MachineInfo) */ {
+ public:
+  inline MachineInfo() : MachineInfo(nullptr) {}
+  ~MachineInfo() override;
+  explicit PROTOBUF_CONSTEXPR MachineInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MachineInfo(const MachineInfo& from);
+  MachineInfo(MachineInfo&& from) noexcept
+    : MachineInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline MachineInfo& operator=(const MachineInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MachineInfo& operator=(MachineInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MachineInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MachineInfo* internal_default_instance() {
+    return reinterpret_cast<const MachineInfo*>(
+               &_MachineInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(MachineInfo& a, MachineInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MachineInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MachineInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MachineInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MachineInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MachineInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MachineInfo& from) {
+    MachineInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MachineInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.MachineInfo";
+  }
+  protected:
+  explicit MachineInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MachineInfo_CompType CompType;
+  static constexpr CompType COMP_ID =
+    MachineInfo_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    MachineInfo_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return MachineInfo_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    MachineInfo_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    MachineInfo_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    MachineInfo_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return MachineInfo_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return MachineInfo_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return MachineInfo_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMachinesFieldNumber = 1,
+    kTeamColorFieldNumber = 2,
+  };
+  // repeated .llsf_msgs.Machine machines = 1;
+  int machines_size() const;
+  private:
+  int _internal_machines_size() const;
+  public:
+  void clear_machines();
+  ::llsf_msgs::Machine* mutable_machines(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Machine >*
+      mutable_machines();
+  private:
+  const ::llsf_msgs::Machine& _internal_machines(int index) const;
+  ::llsf_msgs::Machine* _internal_add_machines();
+  public:
+  const ::llsf_msgs::Machine& machines(int index) const;
+  ::llsf_msgs::Machine* add_machines();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Machine >&
+      machines() const;
+
+  // optional .llsf_msgs.Team team_color = 2;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.MachineInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Machine > machines_;
+    int team_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LightSpec
+
+// required .llsf_msgs.LightColor color = 1;
+inline bool LightSpec::_internal_has_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LightSpec::has_color() const {
+  return _internal_has_color();
+}
+inline void LightSpec::clear_color() {
+  _impl_.color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::LightColor LightSpec::_internal_color() const {
+  return static_cast< ::llsf_msgs::LightColor >(_impl_.color_);
+}
+inline ::llsf_msgs::LightColor LightSpec::color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.LightSpec.color)
+  return _internal_color();
+}
+inline void LightSpec::_internal_set_color(::llsf_msgs::LightColor value) {
+  assert(::llsf_msgs::LightColor_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.color_ = value;
+}
+inline void LightSpec::set_color(::llsf_msgs::LightColor value) {
+  _internal_set_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.LightSpec.color)
+}
+
+// required .llsf_msgs.LightState state = 2;
+inline bool LightSpec::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LightSpec::has_state() const {
+  return _internal_has_state();
+}
+inline void LightSpec::clear_state() {
+  _impl_.state_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::llsf_msgs::LightState LightSpec::_internal_state() const {
+  return static_cast< ::llsf_msgs::LightState >(_impl_.state_);
+}
+inline ::llsf_msgs::LightState LightSpec::state() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.LightSpec.state)
+  return _internal_state();
+}
+inline void LightSpec::_internal_set_state(::llsf_msgs::LightState value) {
+  assert(::llsf_msgs::LightState_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.state_ = value;
+}
+inline void LightSpec::set_state(::llsf_msgs::LightState value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.LightSpec.state)
+}
+
+// -------------------------------------------------------------------
+
+// ShelfSlotInfo
+
+// required uint32 shelf = 1;
+inline bool ShelfSlotInfo::_internal_has_shelf() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ShelfSlotInfo::has_shelf() const {
+  return _internal_has_shelf();
+}
+inline void ShelfSlotInfo::clear_shelf() {
+  _impl_.shelf_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t ShelfSlotInfo::_internal_shelf() const {
+  return _impl_.shelf_;
+}
+inline uint32_t ShelfSlotInfo::shelf() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ShelfSlotInfo.shelf)
+  return _internal_shelf();
+}
+inline void ShelfSlotInfo::_internal_set_shelf(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shelf_ = value;
+}
+inline void ShelfSlotInfo::set_shelf(uint32_t value) {
+  _internal_set_shelf(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.ShelfSlotInfo.shelf)
+}
+
+// required uint32 slot = 2;
+inline bool ShelfSlotInfo::_internal_has_slot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ShelfSlotInfo::has_slot() const {
+  return _internal_has_slot();
+}
+inline void ShelfSlotInfo::clear_slot() {
+  _impl_.slot_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ShelfSlotInfo::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline uint32_t ShelfSlotInfo::slot() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ShelfSlotInfo.slot)
+  return _internal_slot();
+}
+inline void ShelfSlotInfo::_internal_set_slot(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.slot_ = value;
+}
+inline void ShelfSlotInfo::set_slot(uint32_t value) {
+  _internal_set_slot(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.ShelfSlotInfo.slot)
+}
+
+// required bool is_filled = 3;
+inline bool ShelfSlotInfo::_internal_has_is_filled() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ShelfSlotInfo::has_is_filled() const {
+  return _internal_has_is_filled();
+}
+inline void ShelfSlotInfo::clear_is_filled() {
+  _impl_.is_filled_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool ShelfSlotInfo::_internal_is_filled() const {
+  return _impl_.is_filled_;
+}
+inline bool ShelfSlotInfo::is_filled() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ShelfSlotInfo.is_filled)
+  return _internal_is_filled();
+}
+inline void ShelfSlotInfo::_internal_set_is_filled(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.is_filled_ = value;
+}
+inline void ShelfSlotInfo::set_is_filled(bool value) {
+  _internal_set_is_filled(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.ShelfSlotInfo.is_filled)
+}
+
+// optional string description = 5;
+inline bool ShelfSlotInfo::_internal_has_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ShelfSlotInfo::has_description() const {
+  return _internal_has_description();
+}
+inline void ShelfSlotInfo::clear_description() {
+  _impl_.description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ShelfSlotInfo::description() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ShelfSlotInfo.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ShelfSlotInfo::set_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.ShelfSlotInfo.description)
+}
+inline std::string* ShelfSlotInfo::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.ShelfSlotInfo.description)
+  return _s;
+}
+inline const std::string& ShelfSlotInfo::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void ShelfSlotInfo::_internal_set_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ShelfSlotInfo::_internal_mutable_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ShelfSlotInfo::release_description() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.ShelfSlotInfo.description)
+  if (!_internal_has_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ShelfSlotInfo::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.ShelfSlotInfo.description)
+}
+
+// -------------------------------------------------------------------
+
+// Machine
+
+// required string name = 1;
+inline bool Machine::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Machine::has_name() const {
+  return _internal_has_name();
+}
+inline void Machine::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Machine::name() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Machine::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.name)
+}
+inline std::string* Machine::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.name)
+  return _s;
+}
+inline const std::string& Machine::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Machine::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Machine::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Machine::release_name() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Machine.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Machine::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Machine.name)
+}
+
+// optional string type = 2;
+inline bool Machine::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Machine::has_type() const {
+  return _internal_has_type();
+}
+inline void Machine::clear_type() {
+  _impl_.type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Machine::type() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Machine::set_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.type)
+}
+inline std::string* Machine::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.type)
+  return _s;
+}
+inline const std::string& Machine::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void Machine::_internal_set_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Machine::_internal_mutable_type() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Machine::release_type() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Machine.type)
+  if (!_internal_has_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Machine::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Machine.type)
+}
+
+// optional string state = 3;
+inline bool Machine::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Machine::has_state() const {
+  return _internal_has_state();
+}
+inline void Machine::clear_state() {
+  _impl_.state_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Machine::state() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.state)
+  return _internal_state();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Machine::set_state(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.state_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.state)
+}
+inline std::string* Machine::mutable_state() {
+  std::string* _s = _internal_mutable_state();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.state)
+  return _s;
+}
+inline const std::string& Machine::_internal_state() const {
+  return _impl_.state_.Get();
+}
+inline void Machine::_internal_set_state(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.state_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Machine::_internal_mutable_state() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.state_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Machine::release_state() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Machine.state)
+  if (!_internal_has_state()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.state_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.state_.IsDefault()) {
+    _impl_.state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Machine::set_allocated_state(std::string* state) {
+  if (state != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.state_.SetAllocated(state, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.state_.IsDefault()) {
+    _impl_.state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Machine.state)
+}
+
+// optional .llsf_msgs.Team team_color = 10;
+inline bool Machine::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Machine::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void Machine::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline ::llsf_msgs::Team Machine::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team Machine::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.team_color)
+  return _internal_team_color();
+}
+inline void Machine::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.team_color_ = value;
+}
+inline void Machine::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.team_color)
+}
+
+// repeated .llsf_msgs.LightSpec lights = 7;
+inline int Machine::_internal_lights_size() const {
+  return _impl_.lights_.size();
+}
+inline int Machine::lights_size() const {
+  return _internal_lights_size();
+}
+inline void Machine::clear_lights() {
+  _impl_.lights_.Clear();
+}
+inline ::llsf_msgs::LightSpec* Machine::mutable_lights(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.lights)
+  return _impl_.lights_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >*
+Machine::mutable_lights() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.Machine.lights)
+  return &_impl_.lights_;
+}
+inline const ::llsf_msgs::LightSpec& Machine::_internal_lights(int index) const {
+  return _impl_.lights_.Get(index);
+}
+inline const ::llsf_msgs::LightSpec& Machine::lights(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.lights)
+  return _internal_lights(index);
+}
+inline ::llsf_msgs::LightSpec* Machine::_internal_add_lights() {
+  return _impl_.lights_.Add();
+}
+inline ::llsf_msgs::LightSpec* Machine::add_lights() {
+  ::llsf_msgs::LightSpec* _add = _internal_add_lights();
+  // @@protoc_insertion_point(field_add:llsf_msgs.Machine.lights)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::LightSpec >&
+Machine::lights() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.Machine.lights)
+  return _impl_.lights_;
+}
+
+// optional .llsf_msgs.Pose2D pose = 8;
+inline bool Machine::_internal_has_pose() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pose_ != nullptr);
+  return value;
+}
+inline bool Machine::has_pose() const {
+  return _internal_has_pose();
+}
+inline const ::llsf_msgs::Pose2D& Machine::_internal_pose() const {
+  const ::llsf_msgs::Pose2D* p = _impl_.pose_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::Pose2D&>(
+      ::llsf_msgs::_Pose2D_default_instance_);
+}
+inline const ::llsf_msgs::Pose2D& Machine::pose() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.pose)
+  return _internal_pose();
+}
+inline void Machine::unsafe_arena_set_allocated_pose(
+    ::llsf_msgs::Pose2D* pose) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pose_);
+  }
+  _impl_.pose_ = pose;
+  if (pose) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.Machine.pose)
+}
+inline ::llsf_msgs::Pose2D* Machine::release_pose() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::llsf_msgs::Pose2D* temp = _impl_.pose_;
+  _impl_.pose_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::Pose2D* Machine::unsafe_arena_release_pose() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Machine.pose)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::llsf_msgs::Pose2D* temp = _impl_.pose_;
+  _impl_.pose_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::Pose2D* Machine::_internal_mutable_pose() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.pose_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::Pose2D>(GetArenaForAllocation());
+    _impl_.pose_ = p;
+  }
+  return _impl_.pose_;
+}
+inline ::llsf_msgs::Pose2D* Machine::mutable_pose() {
+  ::llsf_msgs::Pose2D* _msg = _internal_mutable_pose();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.pose)
+  return _msg;
+}
+inline void Machine::set_allocated_pose(::llsf_msgs::Pose2D* pose) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pose_);
+  }
+  if (pose) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pose));
+    if (message_arena != submessage_arena) {
+      pose = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pose, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.pose_ = pose;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Machine.pose)
+}
+
+// optional .llsf_msgs.Zone zone = 11;
+inline bool Machine::_internal_has_zone() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool Machine::has_zone() const {
+  return _internal_has_zone();
+}
+inline void Machine::clear_zone() {
+  _impl_.zone_ = 18;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline ::llsf_msgs::Zone Machine::_internal_zone() const {
+  return static_cast< ::llsf_msgs::Zone >(_impl_.zone_);
+}
+inline ::llsf_msgs::Zone Machine::zone() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.zone)
+  return _internal_zone();
+}
+inline void Machine::_internal_set_zone(::llsf_msgs::Zone value) {
+  assert(::llsf_msgs::Zone_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.zone_ = value;
+}
+inline void Machine::set_zone(::llsf_msgs::Zone value) {
+  _internal_set_zone(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.zone)
+}
+
+// optional uint32 rotation = 12;
+inline bool Machine::_internal_has_rotation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Machine::has_rotation() const {
+  return _internal_has_rotation();
+}
+inline void Machine::clear_rotation() {
+  _impl_.rotation_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint32_t Machine::_internal_rotation() const {
+  return _impl_.rotation_;
+}
+inline uint32_t Machine::rotation() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.rotation)
+  return _internal_rotation();
+}
+inline void Machine::_internal_set_rotation(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.rotation_ = value;
+}
+inline void Machine::set_rotation(uint32_t value) {
+  _internal_set_rotation(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.rotation)
+}
+
+// optional bool correctly_reported = 9;
+inline bool Machine::_internal_has_correctly_reported() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Machine::has_correctly_reported() const {
+  return _internal_has_correctly_reported();
+}
+inline void Machine::clear_correctly_reported() {
+  _impl_.correctly_reported_ = false;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline bool Machine::_internal_correctly_reported() const {
+  return _impl_.correctly_reported_;
+}
+inline bool Machine::correctly_reported() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.correctly_reported)
+  return _internal_correctly_reported();
+}
+inline void Machine::_internal_set_correctly_reported(bool value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.correctly_reported_ = value;
+}
+inline void Machine::set_correctly_reported(bool value) {
+  _internal_set_correctly_reported(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.correctly_reported)
+}
+
+// optional uint32 loaded_with = 13 [default = 0];
+inline bool Machine::_internal_has_loaded_with() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Machine::has_loaded_with() const {
+  return _internal_has_loaded_with();
+}
+inline void Machine::clear_loaded_with() {
+  _impl_.loaded_with_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint32_t Machine::_internal_loaded_with() const {
+  return _impl_.loaded_with_;
+}
+inline uint32_t Machine::loaded_with() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.loaded_with)
+  return _internal_loaded_with();
+}
+inline void Machine::_internal_set_loaded_with(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.loaded_with_ = value;
+}
+inline void Machine::set_loaded_with(uint32_t value) {
+  _internal_set_loaded_with(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.loaded_with)
+}
+
+// repeated .llsf_msgs.RingColor ring_colors = 14;
+inline int Machine::_internal_ring_colors_size() const {
+  return _impl_.ring_colors_.size();
+}
+inline int Machine::ring_colors_size() const {
+  return _internal_ring_colors_size();
+}
+inline void Machine::clear_ring_colors() {
+  _impl_.ring_colors_.Clear();
+}
+inline ::llsf_msgs::RingColor Machine::_internal_ring_colors(int index) const {
+  return static_cast< ::llsf_msgs::RingColor >(_impl_.ring_colors_.Get(index));
+}
+inline ::llsf_msgs::RingColor Machine::ring_colors(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.ring_colors)
+  return _internal_ring_colors(index);
+}
+inline void Machine::set_ring_colors(int index, ::llsf_msgs::RingColor value) {
+  assert(::llsf_msgs::RingColor_IsValid(value));
+  _impl_.ring_colors_.Set(index, value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.ring_colors)
+}
+inline void Machine::_internal_add_ring_colors(::llsf_msgs::RingColor value) {
+  assert(::llsf_msgs::RingColor_IsValid(value));
+  _impl_.ring_colors_.Add(value);
+}
+inline void Machine::add_ring_colors(::llsf_msgs::RingColor value) {
+  _internal_add_ring_colors(value);
+  // @@protoc_insertion_point(field_add:llsf_msgs.Machine.ring_colors)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+Machine::ring_colors() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.Machine.ring_colors)
+  return _impl_.ring_colors_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Machine::_internal_mutable_ring_colors() {
+  return &_impl_.ring_colors_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Machine::mutable_ring_colors() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.Machine.ring_colors)
+  return _internal_mutable_ring_colors();
+}
+
+// optional .llsf_msgs.PrepareInstructionBS instruction_bs = 16;
+inline bool Machine::_internal_has_instruction_bs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.instruction_bs_ != nullptr);
+  return value;
+}
+inline bool Machine::has_instruction_bs() const {
+  return _internal_has_instruction_bs();
+}
+inline const ::llsf_msgs::PrepareInstructionBS& Machine::_internal_instruction_bs() const {
+  const ::llsf_msgs::PrepareInstructionBS* p = _impl_.instruction_bs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::PrepareInstructionBS&>(
+      ::llsf_msgs::_PrepareInstructionBS_default_instance_);
+}
+inline const ::llsf_msgs::PrepareInstructionBS& Machine::instruction_bs() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.instruction_bs)
+  return _internal_instruction_bs();
+}
+inline void Machine::unsafe_arena_set_allocated_instruction_bs(
+    ::llsf_msgs::PrepareInstructionBS* instruction_bs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_bs_);
+  }
+  _impl_.instruction_bs_ = instruction_bs;
+  if (instruction_bs) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.Machine.instruction_bs)
+}
+inline ::llsf_msgs::PrepareInstructionBS* Machine::release_instruction_bs() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::llsf_msgs::PrepareInstructionBS* temp = _impl_.instruction_bs_;
+  _impl_.instruction_bs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionBS* Machine::unsafe_arena_release_instruction_bs() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Machine.instruction_bs)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::llsf_msgs::PrepareInstructionBS* temp = _impl_.instruction_bs_;
+  _impl_.instruction_bs_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionBS* Machine::_internal_mutable_instruction_bs() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.instruction_bs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::PrepareInstructionBS>(GetArenaForAllocation());
+    _impl_.instruction_bs_ = p;
+  }
+  return _impl_.instruction_bs_;
+}
+inline ::llsf_msgs::PrepareInstructionBS* Machine::mutable_instruction_bs() {
+  ::llsf_msgs::PrepareInstructionBS* _msg = _internal_mutable_instruction_bs();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.instruction_bs)
+  return _msg;
+}
+inline void Machine::set_allocated_instruction_bs(::llsf_msgs::PrepareInstructionBS* instruction_bs) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_bs_);
+  }
+  if (instruction_bs) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(instruction_bs));
+    if (message_arena != submessage_arena) {
+      instruction_bs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, instruction_bs, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.instruction_bs_ = instruction_bs;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Machine.instruction_bs)
+}
+
+// optional .llsf_msgs.PrepareInstructionDS instruction_ds = 17;
+inline bool Machine::_internal_has_instruction_ds() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.instruction_ds_ != nullptr);
+  return value;
+}
+inline bool Machine::has_instruction_ds() const {
+  return _internal_has_instruction_ds();
+}
+inline const ::llsf_msgs::PrepareInstructionDS& Machine::_internal_instruction_ds() const {
+  const ::llsf_msgs::PrepareInstructionDS* p = _impl_.instruction_ds_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::PrepareInstructionDS&>(
+      ::llsf_msgs::_PrepareInstructionDS_default_instance_);
+}
+inline const ::llsf_msgs::PrepareInstructionDS& Machine::instruction_ds() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.instruction_ds)
+  return _internal_instruction_ds();
+}
+inline void Machine::unsafe_arena_set_allocated_instruction_ds(
+    ::llsf_msgs::PrepareInstructionDS* instruction_ds) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_ds_);
+  }
+  _impl_.instruction_ds_ = instruction_ds;
+  if (instruction_ds) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.Machine.instruction_ds)
+}
+inline ::llsf_msgs::PrepareInstructionDS* Machine::release_instruction_ds() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::llsf_msgs::PrepareInstructionDS* temp = _impl_.instruction_ds_;
+  _impl_.instruction_ds_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionDS* Machine::unsafe_arena_release_instruction_ds() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Machine.instruction_ds)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::llsf_msgs::PrepareInstructionDS* temp = _impl_.instruction_ds_;
+  _impl_.instruction_ds_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionDS* Machine::_internal_mutable_instruction_ds() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.instruction_ds_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::PrepareInstructionDS>(GetArenaForAllocation());
+    _impl_.instruction_ds_ = p;
+  }
+  return _impl_.instruction_ds_;
+}
+inline ::llsf_msgs::PrepareInstructionDS* Machine::mutable_instruction_ds() {
+  ::llsf_msgs::PrepareInstructionDS* _msg = _internal_mutable_instruction_ds();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.instruction_ds)
+  return _msg;
+}
+inline void Machine::set_allocated_instruction_ds(::llsf_msgs::PrepareInstructionDS* instruction_ds) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_ds_);
+  }
+  if (instruction_ds) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(instruction_ds));
+    if (message_arena != submessage_arena) {
+      instruction_ds = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, instruction_ds, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.instruction_ds_ = instruction_ds;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Machine.instruction_ds)
+}
+
+// optional .llsf_msgs.PrepareInstructionSS instruction_ss = 20;
+inline bool Machine::_internal_has_instruction_ss() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.instruction_ss_ != nullptr);
+  return value;
+}
+inline bool Machine::has_instruction_ss() const {
+  return _internal_has_instruction_ss();
+}
+inline const ::llsf_msgs::PrepareInstructionSS& Machine::_internal_instruction_ss() const {
+  const ::llsf_msgs::PrepareInstructionSS* p = _impl_.instruction_ss_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::PrepareInstructionSS&>(
+      ::llsf_msgs::_PrepareInstructionSS_default_instance_);
+}
+inline const ::llsf_msgs::PrepareInstructionSS& Machine::instruction_ss() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.instruction_ss)
+  return _internal_instruction_ss();
+}
+inline void Machine::unsafe_arena_set_allocated_instruction_ss(
+    ::llsf_msgs::PrepareInstructionSS* instruction_ss) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_ss_);
+  }
+  _impl_.instruction_ss_ = instruction_ss;
+  if (instruction_ss) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.Machine.instruction_ss)
+}
+inline ::llsf_msgs::PrepareInstructionSS* Machine::release_instruction_ss() {
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::llsf_msgs::PrepareInstructionSS* temp = _impl_.instruction_ss_;
+  _impl_.instruction_ss_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionSS* Machine::unsafe_arena_release_instruction_ss() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Machine.instruction_ss)
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::llsf_msgs::PrepareInstructionSS* temp = _impl_.instruction_ss_;
+  _impl_.instruction_ss_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionSS* Machine::_internal_mutable_instruction_ss() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.instruction_ss_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::PrepareInstructionSS>(GetArenaForAllocation());
+    _impl_.instruction_ss_ = p;
+  }
+  return _impl_.instruction_ss_;
+}
+inline ::llsf_msgs::PrepareInstructionSS* Machine::mutable_instruction_ss() {
+  ::llsf_msgs::PrepareInstructionSS* _msg = _internal_mutable_instruction_ss();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.instruction_ss)
+  return _msg;
+}
+inline void Machine::set_allocated_instruction_ss(::llsf_msgs::PrepareInstructionSS* instruction_ss) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_ss_);
+  }
+  if (instruction_ss) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(instruction_ss));
+    if (message_arena != submessage_arena) {
+      instruction_ss = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, instruction_ss, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  _impl_.instruction_ss_ = instruction_ss;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Machine.instruction_ss)
+}
+
+// optional .llsf_msgs.PrepareInstructionRS instruction_rs = 18;
+inline bool Machine::_internal_has_instruction_rs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.instruction_rs_ != nullptr);
+  return value;
+}
+inline bool Machine::has_instruction_rs() const {
+  return _internal_has_instruction_rs();
+}
+inline const ::llsf_msgs::PrepareInstructionRS& Machine::_internal_instruction_rs() const {
+  const ::llsf_msgs::PrepareInstructionRS* p = _impl_.instruction_rs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::PrepareInstructionRS&>(
+      ::llsf_msgs::_PrepareInstructionRS_default_instance_);
+}
+inline const ::llsf_msgs::PrepareInstructionRS& Machine::instruction_rs() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.instruction_rs)
+  return _internal_instruction_rs();
+}
+inline void Machine::unsafe_arena_set_allocated_instruction_rs(
+    ::llsf_msgs::PrepareInstructionRS* instruction_rs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_rs_);
+  }
+  _impl_.instruction_rs_ = instruction_rs;
+  if (instruction_rs) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.Machine.instruction_rs)
+}
+inline ::llsf_msgs::PrepareInstructionRS* Machine::release_instruction_rs() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::llsf_msgs::PrepareInstructionRS* temp = _impl_.instruction_rs_;
+  _impl_.instruction_rs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionRS* Machine::unsafe_arena_release_instruction_rs() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Machine.instruction_rs)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::llsf_msgs::PrepareInstructionRS* temp = _impl_.instruction_rs_;
+  _impl_.instruction_rs_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionRS* Machine::_internal_mutable_instruction_rs() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.instruction_rs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::PrepareInstructionRS>(GetArenaForAllocation());
+    _impl_.instruction_rs_ = p;
+  }
+  return _impl_.instruction_rs_;
+}
+inline ::llsf_msgs::PrepareInstructionRS* Machine::mutable_instruction_rs() {
+  ::llsf_msgs::PrepareInstructionRS* _msg = _internal_mutable_instruction_rs();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.instruction_rs)
+  return _msg;
+}
+inline void Machine::set_allocated_instruction_rs(::llsf_msgs::PrepareInstructionRS* instruction_rs) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_rs_);
+  }
+  if (instruction_rs) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(instruction_rs));
+    if (message_arena != submessage_arena) {
+      instruction_rs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, instruction_rs, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.instruction_rs_ = instruction_rs;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Machine.instruction_rs)
+}
+
+// optional .llsf_msgs.PrepareInstructionCS instruction_cs = 19;
+inline bool Machine::_internal_has_instruction_cs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.instruction_cs_ != nullptr);
+  return value;
+}
+inline bool Machine::has_instruction_cs() const {
+  return _internal_has_instruction_cs();
+}
+inline const ::llsf_msgs::PrepareInstructionCS& Machine::_internal_instruction_cs() const {
+  const ::llsf_msgs::PrepareInstructionCS* p = _impl_.instruction_cs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::PrepareInstructionCS&>(
+      ::llsf_msgs::_PrepareInstructionCS_default_instance_);
+}
+inline const ::llsf_msgs::PrepareInstructionCS& Machine::instruction_cs() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.instruction_cs)
+  return _internal_instruction_cs();
+}
+inline void Machine::unsafe_arena_set_allocated_instruction_cs(
+    ::llsf_msgs::PrepareInstructionCS* instruction_cs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_cs_);
+  }
+  _impl_.instruction_cs_ = instruction_cs;
+  if (instruction_cs) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.Machine.instruction_cs)
+}
+inline ::llsf_msgs::PrepareInstructionCS* Machine::release_instruction_cs() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::llsf_msgs::PrepareInstructionCS* temp = _impl_.instruction_cs_;
+  _impl_.instruction_cs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionCS* Machine::unsafe_arena_release_instruction_cs() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Machine.instruction_cs)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::llsf_msgs::PrepareInstructionCS* temp = _impl_.instruction_cs_;
+  _impl_.instruction_cs_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionCS* Machine::_internal_mutable_instruction_cs() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.instruction_cs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::PrepareInstructionCS>(GetArenaForAllocation());
+    _impl_.instruction_cs_ = p;
+  }
+  return _impl_.instruction_cs_;
+}
+inline ::llsf_msgs::PrepareInstructionCS* Machine::mutable_instruction_cs() {
+  ::llsf_msgs::PrepareInstructionCS* _msg = _internal_mutable_instruction_cs();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.instruction_cs)
+  return _msg;
+}
+inline void Machine::set_allocated_instruction_cs(::llsf_msgs::PrepareInstructionCS* instruction_cs) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_cs_);
+  }
+  if (instruction_cs) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(instruction_cs));
+    if (message_arena != submessage_arena) {
+      instruction_cs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, instruction_cs, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.instruction_cs_ = instruction_cs;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Machine.instruction_cs)
+}
+
+// optional .llsf_msgs.ExplorationState exploration_rotation_state = 21;
+inline bool Machine::_internal_has_exploration_rotation_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Machine::has_exploration_rotation_state() const {
+  return _internal_has_exploration_rotation_state();
+}
+inline void Machine::clear_exploration_rotation_state() {
+  _impl_.exploration_rotation_state_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline ::llsf_msgs::ExplorationState Machine::_internal_exploration_rotation_state() const {
+  return static_cast< ::llsf_msgs::ExplorationState >(_impl_.exploration_rotation_state_);
+}
+inline ::llsf_msgs::ExplorationState Machine::exploration_rotation_state() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.exploration_rotation_state)
+  return _internal_exploration_rotation_state();
+}
+inline void Machine::_internal_set_exploration_rotation_state(::llsf_msgs::ExplorationState value) {
+  assert(::llsf_msgs::ExplorationState_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.exploration_rotation_state_ = value;
+}
+inline void Machine::set_exploration_rotation_state(::llsf_msgs::ExplorationState value) {
+  _internal_set_exploration_rotation_state(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.exploration_rotation_state)
+}
+
+// optional .llsf_msgs.ExplorationState exploration_zone_state = 22;
+inline bool Machine::_internal_has_exploration_zone_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool Machine::has_exploration_zone_state() const {
+  return _internal_has_exploration_zone_state();
+}
+inline void Machine::clear_exploration_zone_state() {
+  _impl_.exploration_zone_state_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline ::llsf_msgs::ExplorationState Machine::_internal_exploration_zone_state() const {
+  return static_cast< ::llsf_msgs::ExplorationState >(_impl_.exploration_zone_state_);
+}
+inline ::llsf_msgs::ExplorationState Machine::exploration_zone_state() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.exploration_zone_state)
+  return _internal_exploration_zone_state();
+}
+inline void Machine::_internal_set_exploration_zone_state(::llsf_msgs::ExplorationState value) {
+  assert(::llsf_msgs::ExplorationState_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.exploration_zone_state_ = value;
+}
+inline void Machine::set_exploration_zone_state(::llsf_msgs::ExplorationState value) {
+  _internal_set_exploration_zone_state(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Machine.exploration_zone_state)
+}
+
+// repeated .llsf_msgs.ShelfSlotInfo status_ss = 25;
+inline int Machine::_internal_status_ss_size() const {
+  return _impl_.status_ss_.size();
+}
+inline int Machine::status_ss_size() const {
+  return _internal_status_ss_size();
+}
+inline void Machine::clear_status_ss() {
+  _impl_.status_ss_.Clear();
+}
+inline ::llsf_msgs::ShelfSlotInfo* Machine::mutable_status_ss(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Machine.status_ss)
+  return _impl_.status_ss_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ShelfSlotInfo >*
+Machine::mutable_status_ss() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.Machine.status_ss)
+  return &_impl_.status_ss_;
+}
+inline const ::llsf_msgs::ShelfSlotInfo& Machine::_internal_status_ss(int index) const {
+  return _impl_.status_ss_.Get(index);
+}
+inline const ::llsf_msgs::ShelfSlotInfo& Machine::status_ss(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Machine.status_ss)
+  return _internal_status_ss(index);
+}
+inline ::llsf_msgs::ShelfSlotInfo* Machine::_internal_add_status_ss() {
+  return _impl_.status_ss_.Add();
+}
+inline ::llsf_msgs::ShelfSlotInfo* Machine::add_status_ss() {
+  ::llsf_msgs::ShelfSlotInfo* _add = _internal_add_status_ss();
+  // @@protoc_insertion_point(field_add:llsf_msgs.Machine.status_ss)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::ShelfSlotInfo >&
+Machine::status_ss() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.Machine.status_ss)
+  return _impl_.status_ss_;
+}
+
+// -------------------------------------------------------------------
+
+// MachineInfo
+
+// repeated .llsf_msgs.Machine machines = 1;
+inline int MachineInfo::_internal_machines_size() const {
+  return _impl_.machines_.size();
+}
+inline int MachineInfo::machines_size() const {
+  return _internal_machines_size();
+}
+inline void MachineInfo::clear_machines() {
+  _impl_.machines_.Clear();
+}
+inline ::llsf_msgs::Machine* MachineInfo::mutable_machines(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.MachineInfo.machines)
+  return _impl_.machines_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Machine >*
+MachineInfo::mutable_machines() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.MachineInfo.machines)
+  return &_impl_.machines_;
+}
+inline const ::llsf_msgs::Machine& MachineInfo::_internal_machines(int index) const {
+  return _impl_.machines_.Get(index);
+}
+inline const ::llsf_msgs::Machine& MachineInfo::machines(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.MachineInfo.machines)
+  return _internal_machines(index);
+}
+inline ::llsf_msgs::Machine* MachineInfo::_internal_add_machines() {
+  return _impl_.machines_.Add();
+}
+inline ::llsf_msgs::Machine* MachineInfo::add_machines() {
+  ::llsf_msgs::Machine* _add = _internal_add_machines();
+  // @@protoc_insertion_point(field_add:llsf_msgs.MachineInfo.machines)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Machine >&
+MachineInfo::machines() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.MachineInfo.machines)
+  return _impl_.machines_;
+}
+
+// optional .llsf_msgs.Team team_color = 2;
+inline bool MachineInfo::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MachineInfo::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void MachineInfo::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::Team MachineInfo::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team MachineInfo::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.MachineInfo.team_color)
+  return _internal_team_color();
+}
+inline void MachineInfo::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.team_color_ = value;
+}
+inline void MachineInfo::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.MachineInfo.team_color)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::LightSpec_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::LightSpec_CompType>() {
+  return ::llsf_msgs::LightSpec_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::ShelfSlotInfo_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::ShelfSlotInfo_CompType>() {
+  return ::llsf_msgs::ShelfSlotInfo_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::Machine_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::Machine_CompType>() {
+  return ::llsf_msgs::Machine_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::MachineInfo_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::MachineInfo_CompType>() {
+  return ::llsf_msgs::MachineInfo_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::ExplorationState> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::ExplorationState>() {
+  return ::llsf_msgs::ExplorationState_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_MachineInfo_2eproto
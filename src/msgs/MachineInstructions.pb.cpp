@@ -0,0 +1,2436 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MachineInstructions.proto
+
+#include "MachineInstructions.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR PrepareInstructionBS::PrepareInstructionBS(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.side_)*/1
+  , /*decltype(_impl_.color_)*/1} {}
+struct PrepareInstructionBSDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareInstructionBSDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareInstructionBSDefaultTypeInternal() {}
+  union {
+    PrepareInstructionBS _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareInstructionBSDefaultTypeInternal _PrepareInstructionBS_default_instance_;
+PROTOBUF_CONSTEXPR PrepareInstructionDS::PrepareInstructionDS(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.order_id_)*/0u} {}
+struct PrepareInstructionDSDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareInstructionDSDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareInstructionDSDefaultTypeInternal() {}
+  union {
+    PrepareInstructionDS _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareInstructionDSDefaultTypeInternal _PrepareInstructionDS_default_instance_;
+PROTOBUF_CONSTEXPR PrepareInstructionSS::PrepareInstructionSS(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.wp_description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shelf_)*/0u
+  , /*decltype(_impl_.slot_)*/0u
+  , /*decltype(_impl_.operation_)*/1} {}
+struct PrepareInstructionSSDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareInstructionSSDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareInstructionSSDefaultTypeInternal() {}
+  union {
+    PrepareInstructionSS _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareInstructionSSDefaultTypeInternal _PrepareInstructionSS_default_instance_;
+PROTOBUF_CONSTEXPR PrepareInstructionRS::PrepareInstructionRS(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ring_color_)*/1} {}
+struct PrepareInstructionRSDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareInstructionRSDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareInstructionRSDefaultTypeInternal() {}
+  union {
+    PrepareInstructionRS _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareInstructionRSDefaultTypeInternal _PrepareInstructionRS_default_instance_;
+PROTOBUF_CONSTEXPR PrepareInstructionCS::PrepareInstructionCS(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.operation_)*/1} {}
+struct PrepareInstructionCSDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareInstructionCSDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareInstructionCSDefaultTypeInternal() {}
+  union {
+    PrepareInstructionCS _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareInstructionCSDefaultTypeInternal _PrepareInstructionCS_default_instance_;
+PROTOBUF_CONSTEXPR PrepareMachine::PrepareMachine(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.machine_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.instruction_bs_)*/nullptr
+  , /*decltype(_impl_.instruction_ds_)*/nullptr
+  , /*decltype(_impl_.instruction_rs_)*/nullptr
+  , /*decltype(_impl_.instruction_cs_)*/nullptr
+  , /*decltype(_impl_.instruction_ss_)*/nullptr
+  , /*decltype(_impl_.sent_at_)*/uint64_t{0u}
+  , /*decltype(_impl_.team_color_)*/0} {}
+struct PrepareMachineDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareMachineDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareMachineDefaultTypeInternal() {}
+  union {
+    PrepareMachine _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareMachineDefaultTypeInternal _PrepareMachine_default_instance_;
+PROTOBUF_CONSTEXPR ResetMachine::ResetMachine(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.machine_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.team_color_)*/0} {}
+struct ResetMachineDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResetMachineDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResetMachineDefaultTypeInternal() {}
+  union {
+    ResetMachine _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResetMachineDefaultTypeInternal _ResetMachine_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_MachineInstructions_2eproto[7];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_MachineInstructions_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_MachineInstructions_2eproto = nullptr;
+
+const uint32_t TableStruct_MachineInstructions_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionBS, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionBS, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionBS, _impl_.side_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionBS, _impl_.color_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionDS, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionDS, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionDS, _impl_.order_id_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionSS, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionSS, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionSS, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionSS, _impl_.shelf_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionSS, _impl_.slot_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionSS, _impl_.wp_description_),
+  3,
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionRS, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionRS, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionRS, _impl_.ring_color_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionCS, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionCS, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareInstructionCS, _impl_.operation_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareMachine, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareMachine, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareMachine, _impl_.team_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareMachine, _impl_.machine_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareMachine, _impl_.instruction_bs_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareMachine, _impl_.instruction_ds_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareMachine, _impl_.instruction_ss_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareMachine, _impl_.instruction_rs_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareMachine, _impl_.instruction_cs_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::PrepareMachine, _impl_.sent_at_),
+  7,
+  0,
+  1,
+  2,
+  5,
+  3,
+  4,
+  6,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ResetMachine, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ResetMachine, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ResetMachine, _impl_.team_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ResetMachine, _impl_.machine_),
+  1,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::llsf_msgs::PrepareInstructionBS)},
+  { 10, 17, -1, sizeof(::llsf_msgs::PrepareInstructionDS)},
+  { 18, 28, -1, sizeof(::llsf_msgs::PrepareInstructionSS)},
+  { 32, 39, -1, sizeof(::llsf_msgs::PrepareInstructionRS)},
+  { 40, 47, -1, sizeof(::llsf_msgs::PrepareInstructionCS)},
+  { 48, 62, -1, sizeof(::llsf_msgs::PrepareMachine)},
+  { 70, 78, -1, sizeof(::llsf_msgs::ResetMachine)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_PrepareInstructionBS_default_instance_._instance,
+  &::llsf_msgs::_PrepareInstructionDS_default_instance_._instance,
+  &::llsf_msgs::_PrepareInstructionSS_default_instance_._instance,
+  &::llsf_msgs::_PrepareInstructionRS_default_instance_._instance,
+  &::llsf_msgs::_PrepareInstructionCS_default_instance_._instance,
+  &::llsf_msgs::_PrepareMachine_default_instance_._instance,
+  &::llsf_msgs::_ResetMachine_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_MachineInstructions_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\031MachineInstructions.proto\022\tllsf_msgs\032\030"
+  "MachineDescription.proto\032\022ProductColor.p"
+  "roto\032\nTeam.proto\"a\n\024PrepareInstructionBS"
+  "\022$\n\004side\030\001 \002(\0162\026.llsf_msgs.MachineSide\022#"
+  "\n\005color\030\002 \002(\0162\024.llsf_msgs.BaseColor\"4\n\024P"
+  "repareInstructionDS\022\020\n\010order_id\030\002 \002(\rJ\004\010"
+  "\001\020\002R\004gate\"o\n\024PrepareInstructionSS\022\"\n\tope"
+  "ration\030\001 \002(\0162\017.llsf_msgs.SSOp\022\r\n\005shelf\030\002"
+  " \002(\r\022\014\n\004slot\030\003 \002(\r\022\026\n\016wp_description\030\n \001"
+  "(\t\"@\n\024PrepareInstructionRS\022(\n\nring_color"
+  "\030\001 \002(\0162\024.llsf_msgs.RingColor\":\n\024PrepareI"
+  "nstructionCS\022\"\n\toperation\030\001 \002(\0162\017.llsf_m"
+  "sgs.CSOp\"\234\003\n\016PrepareMachine\022#\n\nteam_colo"
+  "r\030\001 \002(\0162\017.llsf_msgs.Team\022\017\n\007machine\030\002 \002("
+  "\t\0227\n\016instruction_bs\030\004 \001(\0132\037.llsf_msgs.Pr"
+  "epareInstructionBS\0227\n\016instruction_ds\030\005 \001"
+  "(\0132\037.llsf_msgs.PrepareInstructionDS\0227\n\016i"
+  "nstruction_ss\030\010 \001(\0132\037.llsf_msgs.PrepareI"
+  "nstructionSS\0227\n\016instruction_rs\030\006 \001(\0132\037.l"
+  "lsf_msgs.PrepareInstructionRS\0227\n\016instruc"
+  "tion_cs\030\007 \001(\0132\037.llsf_msgs.PrepareInstruc"
+  "tionCS\022\017\n\007sent_at\030\017 \001(\004\"&\n\010CompType\022\014\n\007C"
+  "OMP_ID\020\320\017\022\014\n\010MSG_TYPE\020e\"l\n\014ResetMachine\022"
+  "#\n\nteam_color\030\001 \002(\0162\017.llsf_msgs.Team\022\017\n\007"
+  "machine\030\002 \002(\t\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022"
+  "\014\n\010MSG_TYPE\020h*$\n\013MachineSide\022\t\n\005INPUT\020\001\022"
+  "\n\n\006OUTPUT\020\002B;\n\037org.robocup_logistics.lls"
+  "f_msgsB\030MachineInstructionProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_MachineInstructions_2eproto_deps[3] = {
+  &::descriptor_table_MachineDescription_2eproto,
+  &::descriptor_table_ProductColor_2eproto,
+  &::descriptor_table_Team_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_MachineInstructions_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_MachineInstructions_2eproto = {
+    false, false, 1112, descriptor_table_protodef_MachineInstructions_2eproto,
+    "MachineInstructions.proto",
+    &descriptor_table_MachineInstructions_2eproto_once, descriptor_table_MachineInstructions_2eproto_deps, 3, 7,
+    schemas, file_default_instances, TableStruct_MachineInstructions_2eproto::offsets,
+    file_level_metadata_MachineInstructions_2eproto, file_level_enum_descriptors_MachineInstructions_2eproto,
+    file_level_service_descriptors_MachineInstructions_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_MachineInstructions_2eproto_getter() {
+  return &descriptor_table_MachineInstructions_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_MachineInstructions_2eproto(&descriptor_table_MachineInstructions_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PrepareMachine_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineInstructions_2eproto);
+  return file_level_enum_descriptors_MachineInstructions_2eproto[0];
+}
+bool PrepareMachine_CompType_IsValid(int value) {
+  switch (value) {
+    case 101:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PrepareMachine_CompType PrepareMachine::COMP_ID;
+constexpr PrepareMachine_CompType PrepareMachine::MSG_TYPE;
+constexpr PrepareMachine_CompType PrepareMachine::CompType_MIN;
+constexpr PrepareMachine_CompType PrepareMachine::CompType_MAX;
+constexpr int PrepareMachine::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ResetMachine_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineInstructions_2eproto);
+  return file_level_enum_descriptors_MachineInstructions_2eproto[1];
+}
+bool ResetMachine_CompType_IsValid(int value) {
+  switch (value) {
+    case 104:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ResetMachine_CompType ResetMachine::COMP_ID;
+constexpr ResetMachine_CompType ResetMachine::MSG_TYPE;
+constexpr ResetMachine_CompType ResetMachine::CompType_MIN;
+constexpr ResetMachine_CompType ResetMachine::CompType_MAX;
+constexpr int ResetMachine::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineSide_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineInstructions_2eproto);
+  return file_level_enum_descriptors_MachineInstructions_2eproto[2];
+}
+bool MachineSide_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class PrepareInstructionBS::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareInstructionBS>()._impl_._has_bits_);
+  static void set_has_side(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+PrepareInstructionBS::PrepareInstructionBS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.PrepareInstructionBS)
+}
+PrepareInstructionBS::PrepareInstructionBS(const PrepareInstructionBS& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareInstructionBS* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.side_){}
+    , decltype(_impl_.color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.side_, &from._impl_.side_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.color_) -
+    reinterpret_cast<char*>(&_impl_.side_)) + sizeof(_impl_.color_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.PrepareInstructionBS)
+}
+
+inline void PrepareInstructionBS::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.side_){1}
+    , decltype(_impl_.color_){1}
+  };
+}
+
+PrepareInstructionBS::~PrepareInstructionBS() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.PrepareInstructionBS)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareInstructionBS::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PrepareInstructionBS::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareInstructionBS::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.PrepareInstructionBS)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.side_ = 1;
+    _impl_.color_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareInstructionBS::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.MachineSide side = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::MachineSide_IsValid(val))) {
+            _internal_set_side(static_cast<::llsf_msgs::MachineSide>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.BaseColor color = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::BaseColor_IsValid(val))) {
+            _internal_set_color(static_cast<::llsf_msgs::BaseColor>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareInstructionBS::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.PrepareInstructionBS)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.MachineSide side = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_side(), target);
+  }
+
+  // required .llsf_msgs.BaseColor color = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.PrepareInstructionBS)
+  return target;
+}
+
+size_t PrepareInstructionBS::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.PrepareInstructionBS)
+  size_t total_size = 0;
+
+  if (_internal_has_side()) {
+    // required .llsf_msgs.MachineSide side = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_side());
+  }
+
+  if (_internal_has_color()) {
+    // required .llsf_msgs.BaseColor color = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_color());
+  }
+
+  return total_size;
+}
+size_t PrepareInstructionBS::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.PrepareInstructionBS)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .llsf_msgs.MachineSide side = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_side());
+
+    // required .llsf_msgs.BaseColor color = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_color());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareInstructionBS::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareInstructionBS::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareInstructionBS::GetClassData() const { return &_class_data_; }
+
+
+void PrepareInstructionBS::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareInstructionBS*>(&to_msg);
+  auto& from = static_cast<const PrepareInstructionBS&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.PrepareInstructionBS)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.side_ = from._impl_.side_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.color_ = from._impl_.color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareInstructionBS::CopyFrom(const PrepareInstructionBS& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.PrepareInstructionBS)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareInstructionBS::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PrepareInstructionBS::InternalSwap(PrepareInstructionBS* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.side_, other->_impl_.side_);
+  swap(_impl_.color_, other->_impl_.color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareInstructionBS::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInstructions_2eproto_getter, &descriptor_table_MachineInstructions_2eproto_once,
+      file_level_metadata_MachineInstructions_2eproto[0]);
+}
+
+// ===================================================================
+
+class PrepareInstructionDS::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareInstructionDS>()._impl_._has_bits_);
+  static void set_has_order_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+PrepareInstructionDS::PrepareInstructionDS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.PrepareInstructionDS)
+}
+PrepareInstructionDS::PrepareInstructionDS(const PrepareInstructionDS& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareInstructionDS* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.order_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.order_id_ = from._impl_.order_id_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.PrepareInstructionDS)
+}
+
+inline void PrepareInstructionDS::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.order_id_){0u}
+  };
+}
+
+PrepareInstructionDS::~PrepareInstructionDS() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.PrepareInstructionDS)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareInstructionDS::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PrepareInstructionDS::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareInstructionDS::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.PrepareInstructionDS)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.order_id_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareInstructionDS::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 order_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_order_id(&has_bits);
+          _impl_.order_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareInstructionDS::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.PrepareInstructionDS)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 order_id = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_order_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.PrepareInstructionDS)
+  return target;
+}
+
+size_t PrepareInstructionDS::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.PrepareInstructionDS)
+  size_t total_size = 0;
+
+  // required uint32 order_id = 2;
+  if (_internal_has_order_id()) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_order_id());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareInstructionDS::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareInstructionDS::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareInstructionDS::GetClassData() const { return &_class_data_; }
+
+
+void PrepareInstructionDS::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareInstructionDS*>(&to_msg);
+  auto& from = static_cast<const PrepareInstructionDS&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.PrepareInstructionDS)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_order_id()) {
+    _this->_internal_set_order_id(from._internal_order_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareInstructionDS::CopyFrom(const PrepareInstructionDS& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.PrepareInstructionDS)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareInstructionDS::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PrepareInstructionDS::InternalSwap(PrepareInstructionDS* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.order_id_, other->_impl_.order_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareInstructionDS::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInstructions_2eproto_getter, &descriptor_table_MachineInstructions_2eproto_once,
+      file_level_metadata_MachineInstructions_2eproto[1]);
+}
+
+// ===================================================================
+
+class PrepareInstructionSS::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareInstructionSS>()._impl_._has_bits_);
+  static void set_has_operation(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_shelf(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_slot(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_wp_description(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000e) ^ 0x0000000e) != 0;
+  }
+};
+
+PrepareInstructionSS::PrepareInstructionSS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.PrepareInstructionSS)
+}
+PrepareInstructionSS::PrepareInstructionSS(const PrepareInstructionSS& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareInstructionSS* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.wp_description_){}
+    , decltype(_impl_.shelf_){}
+    , decltype(_impl_.slot_){}
+    , decltype(_impl_.operation_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.wp_description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.wp_description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_wp_description()) {
+    _this->_impl_.wp_description_.Set(from._internal_wp_description(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.shelf_, &from._impl_.shelf_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.operation_) -
+    reinterpret_cast<char*>(&_impl_.shelf_)) + sizeof(_impl_.operation_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.PrepareInstructionSS)
+}
+
+inline void PrepareInstructionSS::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.wp_description_){}
+    , decltype(_impl_.shelf_){0u}
+    , decltype(_impl_.slot_){0u}
+    , decltype(_impl_.operation_){1}
+  };
+  _impl_.wp_description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.wp_description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PrepareInstructionSS::~PrepareInstructionSS() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.PrepareInstructionSS)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareInstructionSS::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.wp_description_.Destroy();
+}
+
+void PrepareInstructionSS::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareInstructionSS::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.PrepareInstructionSS)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.wp_description_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.shelf_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.slot_) -
+        reinterpret_cast<char*>(&_impl_.shelf_)) + sizeof(_impl_.slot_));
+    _impl_.operation_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareInstructionSS::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.SSOp operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::SSOp_IsValid(val))) {
+            _internal_set_operation(static_cast<::llsf_msgs::SSOp>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 shelf = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_shelf(&has_bits);
+          _impl_.shelf_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 slot = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_slot(&has_bits);
+          _impl_.slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string wp_description = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_wp_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.PrepareInstructionSS.wp_description");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareInstructionSS::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.PrepareInstructionSS)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.SSOp operation = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_operation(), target);
+  }
+
+  // required uint32 shelf = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_shelf(), target);
+  }
+
+  // required uint32 slot = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_slot(), target);
+  }
+
+  // optional string wp_description = 10;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_wp_description().data(), static_cast<int>(this->_internal_wp_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.PrepareInstructionSS.wp_description");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_wp_description(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.PrepareInstructionSS)
+  return target;
+}
+
+size_t PrepareInstructionSS::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.PrepareInstructionSS)
+  size_t total_size = 0;
+
+  if (_internal_has_shelf()) {
+    // required uint32 shelf = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shelf());
+  }
+
+  if (_internal_has_slot()) {
+    // required uint32 slot = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_slot());
+  }
+
+  if (_internal_has_operation()) {
+    // required .llsf_msgs.SSOp operation = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+  }
+
+  return total_size;
+}
+size_t PrepareInstructionSS::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.PrepareInstructionSS)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000e) ^ 0x0000000e) == 0) {  // All required fields are present.
+    // required uint32 shelf = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shelf());
+
+    // required uint32 slot = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_slot());
+
+    // required .llsf_msgs.SSOp operation = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string wp_description = 10;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_wp_description());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareInstructionSS::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareInstructionSS::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareInstructionSS::GetClassData() const { return &_class_data_; }
+
+
+void PrepareInstructionSS::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareInstructionSS*>(&to_msg);
+  auto& from = static_cast<const PrepareInstructionSS&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.PrepareInstructionSS)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_wp_description(from._internal_wp_description());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.shelf_ = from._impl_.shelf_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.slot_ = from._impl_.slot_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.operation_ = from._impl_.operation_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareInstructionSS::CopyFrom(const PrepareInstructionSS& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.PrepareInstructionSS)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareInstructionSS::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PrepareInstructionSS::InternalSwap(PrepareInstructionSS* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.wp_description_, lhs_arena,
+      &other->_impl_.wp_description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrepareInstructionSS, _impl_.slot_)
+      + sizeof(PrepareInstructionSS::_impl_.slot_)
+      - PROTOBUF_FIELD_OFFSET(PrepareInstructionSS, _impl_.shelf_)>(
+          reinterpret_cast<char*>(&_impl_.shelf_),
+          reinterpret_cast<char*>(&other->_impl_.shelf_));
+  swap(_impl_.operation_, other->_impl_.operation_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareInstructionSS::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInstructions_2eproto_getter, &descriptor_table_MachineInstructions_2eproto_once,
+      file_level_metadata_MachineInstructions_2eproto[2]);
+}
+
+// ===================================================================
+
+class PrepareInstructionRS::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareInstructionRS>()._impl_._has_bits_);
+  static void set_has_ring_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+PrepareInstructionRS::PrepareInstructionRS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.PrepareInstructionRS)
+}
+PrepareInstructionRS::PrepareInstructionRS(const PrepareInstructionRS& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareInstructionRS* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ring_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.ring_color_ = from._impl_.ring_color_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.PrepareInstructionRS)
+}
+
+inline void PrepareInstructionRS::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ring_color_){1}
+  };
+}
+
+PrepareInstructionRS::~PrepareInstructionRS() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.PrepareInstructionRS)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareInstructionRS::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PrepareInstructionRS::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareInstructionRS::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.PrepareInstructionRS)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ring_color_ = 1;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareInstructionRS::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.RingColor ring_color = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::RingColor_IsValid(val))) {
+            _internal_set_ring_color(static_cast<::llsf_msgs::RingColor>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareInstructionRS::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.PrepareInstructionRS)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.RingColor ring_color = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_ring_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.PrepareInstructionRS)
+  return target;
+}
+
+size_t PrepareInstructionRS::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.PrepareInstructionRS)
+  size_t total_size = 0;
+
+  // required .llsf_msgs.RingColor ring_color = 1;
+  if (_internal_has_ring_color()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_ring_color());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareInstructionRS::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareInstructionRS::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareInstructionRS::GetClassData() const { return &_class_data_; }
+
+
+void PrepareInstructionRS::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareInstructionRS*>(&to_msg);
+  auto& from = static_cast<const PrepareInstructionRS&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.PrepareInstructionRS)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_ring_color()) {
+    _this->_internal_set_ring_color(from._internal_ring_color());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareInstructionRS::CopyFrom(const PrepareInstructionRS& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.PrepareInstructionRS)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareInstructionRS::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PrepareInstructionRS::InternalSwap(PrepareInstructionRS* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.ring_color_, other->_impl_.ring_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareInstructionRS::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInstructions_2eproto_getter, &descriptor_table_MachineInstructions_2eproto_once,
+      file_level_metadata_MachineInstructions_2eproto[3]);
+}
+
+// ===================================================================
+
+class PrepareInstructionCS::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareInstructionCS>()._impl_._has_bits_);
+  static void set_has_operation(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+PrepareInstructionCS::PrepareInstructionCS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.PrepareInstructionCS)
+}
+PrepareInstructionCS::PrepareInstructionCS(const PrepareInstructionCS& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareInstructionCS* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.operation_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.operation_ = from._impl_.operation_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.PrepareInstructionCS)
+}
+
+inline void PrepareInstructionCS::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.operation_){1}
+  };
+}
+
+PrepareInstructionCS::~PrepareInstructionCS() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.PrepareInstructionCS)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareInstructionCS::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PrepareInstructionCS::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareInstructionCS::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.PrepareInstructionCS)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operation_ = 1;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareInstructionCS::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.CSOp operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::CSOp_IsValid(val))) {
+            _internal_set_operation(static_cast<::llsf_msgs::CSOp>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareInstructionCS::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.PrepareInstructionCS)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.CSOp operation = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_operation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.PrepareInstructionCS)
+  return target;
+}
+
+size_t PrepareInstructionCS::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.PrepareInstructionCS)
+  size_t total_size = 0;
+
+  // required .llsf_msgs.CSOp operation = 1;
+  if (_internal_has_operation()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareInstructionCS::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareInstructionCS::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareInstructionCS::GetClassData() const { return &_class_data_; }
+
+
+void PrepareInstructionCS::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareInstructionCS*>(&to_msg);
+  auto& from = static_cast<const PrepareInstructionCS&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.PrepareInstructionCS)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_operation()) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareInstructionCS::CopyFrom(const PrepareInstructionCS& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.PrepareInstructionCS)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareInstructionCS::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PrepareInstructionCS::InternalSwap(PrepareInstructionCS* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.operation_, other->_impl_.operation_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareInstructionCS::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInstructions_2eproto_getter, &descriptor_table_MachineInstructions_2eproto_once,
+      file_level_metadata_MachineInstructions_2eproto[4]);
+}
+
+// ===================================================================
+
+class PrepareMachine::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PrepareMachine>()._impl_._has_bits_);
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_machine(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::llsf_msgs::PrepareInstructionBS& instruction_bs(const PrepareMachine* msg);
+  static void set_has_instruction_bs(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::llsf_msgs::PrepareInstructionDS& instruction_ds(const PrepareMachine* msg);
+  static void set_has_instruction_ds(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::llsf_msgs::PrepareInstructionSS& instruction_ss(const PrepareMachine* msg);
+  static void set_has_instruction_ss(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::llsf_msgs::PrepareInstructionRS& instruction_rs(const PrepareMachine* msg);
+  static void set_has_instruction_rs(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::llsf_msgs::PrepareInstructionCS& instruction_cs(const PrepareMachine* msg);
+  static void set_has_instruction_cs(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_sent_at(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000081) ^ 0x00000081) != 0;
+  }
+};
+
+const ::llsf_msgs::PrepareInstructionBS&
+PrepareMachine::_Internal::instruction_bs(const PrepareMachine* msg) {
+  return *msg->_impl_.instruction_bs_;
+}
+const ::llsf_msgs::PrepareInstructionDS&
+PrepareMachine::_Internal::instruction_ds(const PrepareMachine* msg) {
+  return *msg->_impl_.instruction_ds_;
+}
+const ::llsf_msgs::PrepareInstructionSS&
+PrepareMachine::_Internal::instruction_ss(const PrepareMachine* msg) {
+  return *msg->_impl_.instruction_ss_;
+}
+const ::llsf_msgs::PrepareInstructionRS&
+PrepareMachine::_Internal::instruction_rs(const PrepareMachine* msg) {
+  return *msg->_impl_.instruction_rs_;
+}
+const ::llsf_msgs::PrepareInstructionCS&
+PrepareMachine::_Internal::instruction_cs(const PrepareMachine* msg) {
+  return *msg->_impl_.instruction_cs_;
+}
+PrepareMachine::PrepareMachine(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.PrepareMachine)
+}
+PrepareMachine::PrepareMachine(const PrepareMachine& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareMachine* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machine_){}
+    , decltype(_impl_.instruction_bs_){nullptr}
+    , decltype(_impl_.instruction_ds_){nullptr}
+    , decltype(_impl_.instruction_rs_){nullptr}
+    , decltype(_impl_.instruction_cs_){nullptr}
+    , decltype(_impl_.instruction_ss_){nullptr}
+    , decltype(_impl_.sent_at_){}
+    , decltype(_impl_.team_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.machine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_machine()) {
+    _this->_impl_.machine_.Set(from._internal_machine(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_instruction_bs()) {
+    _this->_impl_.instruction_bs_ = new ::llsf_msgs::PrepareInstructionBS(*from._impl_.instruction_bs_);
+  }
+  if (from._internal_has_instruction_ds()) {
+    _this->_impl_.instruction_ds_ = new ::llsf_msgs::PrepareInstructionDS(*from._impl_.instruction_ds_);
+  }
+  if (from._internal_has_instruction_rs()) {
+    _this->_impl_.instruction_rs_ = new ::llsf_msgs::PrepareInstructionRS(*from._impl_.instruction_rs_);
+  }
+  if (from._internal_has_instruction_cs()) {
+    _this->_impl_.instruction_cs_ = new ::llsf_msgs::PrepareInstructionCS(*from._impl_.instruction_cs_);
+  }
+  if (from._internal_has_instruction_ss()) {
+    _this->_impl_.instruction_ss_ = new ::llsf_msgs::PrepareInstructionSS(*from._impl_.instruction_ss_);
+  }
+  ::memcpy(&_impl_.sent_at_, &from._impl_.sent_at_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.team_color_) -
+    reinterpret_cast<char*>(&_impl_.sent_at_)) + sizeof(_impl_.team_color_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.PrepareMachine)
+}
+
+inline void PrepareMachine::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machine_){}
+    , decltype(_impl_.instruction_bs_){nullptr}
+    , decltype(_impl_.instruction_ds_){nullptr}
+    , decltype(_impl_.instruction_rs_){nullptr}
+    , decltype(_impl_.instruction_cs_){nullptr}
+    , decltype(_impl_.instruction_ss_){nullptr}
+    , decltype(_impl_.sent_at_){uint64_t{0u}}
+    , decltype(_impl_.team_color_){0}
+  };
+  _impl_.machine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PrepareMachine::~PrepareMachine() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.PrepareMachine)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareMachine::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.machine_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.instruction_bs_;
+  if (this != internal_default_instance()) delete _impl_.instruction_ds_;
+  if (this != internal_default_instance()) delete _impl_.instruction_rs_;
+  if (this != internal_default_instance()) delete _impl_.instruction_cs_;
+  if (this != internal_default_instance()) delete _impl_.instruction_ss_;
+}
+
+void PrepareMachine::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareMachine::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.PrepareMachine)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.machine_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.instruction_bs_ != nullptr);
+      _impl_.instruction_bs_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.instruction_ds_ != nullptr);
+      _impl_.instruction_ds_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.instruction_rs_ != nullptr);
+      _impl_.instruction_rs_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.instruction_cs_ != nullptr);
+      _impl_.instruction_cs_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.instruction_ss_ != nullptr);
+      _impl_.instruction_ss_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000c0u) {
+    ::memset(&_impl_.sent_at_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.team_color_) -
+        reinterpret_cast<char*>(&_impl_.sent_at_)) + sizeof(_impl_.team_color_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareMachine::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.Team team_color = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required string machine = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_machine();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.PrepareMachine.machine");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.PrepareInstructionBS instruction_bs = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_instruction_bs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.PrepareInstructionDS instruction_ds = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_instruction_ds(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.PrepareInstructionRS instruction_rs = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_instruction_rs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.PrepareInstructionCS instruction_cs = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_instruction_cs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.PrepareInstructionSS instruction_ss = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_instruction_ss(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 sent_at = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_sent_at(&has_bits);
+          _impl_.sent_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareMachine::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.PrepareMachine)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Team team_color = 1;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_team_color(), target);
+  }
+
+  // required string machine = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_machine().data(), static_cast<int>(this->_internal_machine().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.PrepareMachine.machine");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_machine(), target);
+  }
+
+  // optional .llsf_msgs.PrepareInstructionBS instruction_bs = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::instruction_bs(this),
+        _Internal::instruction_bs(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.PrepareInstructionDS instruction_ds = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::instruction_ds(this),
+        _Internal::instruction_ds(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.PrepareInstructionRS instruction_rs = 6;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::instruction_rs(this),
+        _Internal::instruction_rs(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.PrepareInstructionCS instruction_cs = 7;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::instruction_cs(this),
+        _Internal::instruction_cs(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.PrepareInstructionSS instruction_ss = 8;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::instruction_ss(this),
+        _Internal::instruction_ss(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 sent_at = 15;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(15, this->_internal_sent_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.PrepareMachine)
+  return target;
+}
+
+size_t PrepareMachine::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.PrepareMachine)
+  size_t total_size = 0;
+
+  if (_internal_has_machine()) {
+    // required string machine = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_machine());
+  }
+
+  if (_internal_has_team_color()) {
+    // required .llsf_msgs.Team team_color = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+
+  return total_size;
+}
+size_t PrepareMachine::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.PrepareMachine)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000081) ^ 0x00000081) == 0) {  // All required fields are present.
+    // required string machine = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_machine());
+
+    // required .llsf_msgs.Team team_color = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007eu) {
+    // optional .llsf_msgs.PrepareInstructionBS instruction_bs = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.instruction_bs_);
+    }
+
+    // optional .llsf_msgs.PrepareInstructionDS instruction_ds = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.instruction_ds_);
+    }
+
+    // optional .llsf_msgs.PrepareInstructionRS instruction_rs = 6;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.instruction_rs_);
+    }
+
+    // optional .llsf_msgs.PrepareInstructionCS instruction_cs = 7;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.instruction_cs_);
+    }
+
+    // optional .llsf_msgs.PrepareInstructionSS instruction_ss = 8;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.instruction_ss_);
+    }
+
+    // optional uint64 sent_at = 15;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sent_at());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareMachine::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareMachine::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareMachine::GetClassData() const { return &_class_data_; }
+
+
+void PrepareMachine::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareMachine*>(&to_msg);
+  auto& from = static_cast<const PrepareMachine&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.PrepareMachine)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_machine(from._internal_machine());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_instruction_bs()->::llsf_msgs::PrepareInstructionBS::MergeFrom(
+          from._internal_instruction_bs());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_instruction_ds()->::llsf_msgs::PrepareInstructionDS::MergeFrom(
+          from._internal_instruction_ds());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_instruction_rs()->::llsf_msgs::PrepareInstructionRS::MergeFrom(
+          from._internal_instruction_rs());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_instruction_cs()->::llsf_msgs::PrepareInstructionCS::MergeFrom(
+          from._internal_instruction_cs());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_instruction_ss()->::llsf_msgs::PrepareInstructionSS::MergeFrom(
+          from._internal_instruction_ss());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.sent_at_ = from._impl_.sent_at_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareMachine::CopyFrom(const PrepareMachine& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.PrepareMachine)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareMachine::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_instruction_bs()) {
+    if (!_impl_.instruction_bs_->IsInitialized()) return false;
+  }
+  if (_internal_has_instruction_ds()) {
+    if (!_impl_.instruction_ds_->IsInitialized()) return false;
+  }
+  if (_internal_has_instruction_rs()) {
+    if (!_impl_.instruction_rs_->IsInitialized()) return false;
+  }
+  if (_internal_has_instruction_cs()) {
+    if (!_impl_.instruction_cs_->IsInitialized()) return false;
+  }
+  if (_internal_has_instruction_ss()) {
+    if (!_impl_.instruction_ss_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void PrepareMachine::InternalSwap(PrepareMachine* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.machine_, lhs_arena,
+      &other->_impl_.machine_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrepareMachine, _impl_.team_color_)
+      + sizeof(PrepareMachine::_impl_.team_color_)
+      - PROTOBUF_FIELD_OFFSET(PrepareMachine, _impl_.instruction_bs_)>(
+          reinterpret_cast<char*>(&_impl_.instruction_bs_),
+          reinterpret_cast<char*>(&other->_impl_.instruction_bs_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareMachine::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInstructions_2eproto_getter, &descriptor_table_MachineInstructions_2eproto_once,
+      file_level_metadata_MachineInstructions_2eproto[5]);
+}
+
+// ===================================================================
+
+class ResetMachine::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ResetMachine>()._impl_._has_bits_);
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_machine(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ResetMachine::ResetMachine(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.ResetMachine)
+}
+ResetMachine::ResetMachine(const ResetMachine& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResetMachine* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machine_){}
+    , decltype(_impl_.team_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.machine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_machine()) {
+    _this->_impl_.machine_.Set(from._internal_machine(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.team_color_ = from._impl_.team_color_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.ResetMachine)
+}
+
+inline void ResetMachine::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machine_){}
+    , decltype(_impl_.team_color_){0}
+  };
+  _impl_.machine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ResetMachine::~ResetMachine() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.ResetMachine)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResetMachine::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.machine_.Destroy();
+}
+
+void ResetMachine::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResetMachine::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.ResetMachine)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.machine_.ClearNonDefaultToEmpty();
+  }
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResetMachine::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.Team team_color = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required string machine = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_machine();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.ResetMachine.machine");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResetMachine::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.ResetMachine)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Team team_color = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_team_color(), target);
+  }
+
+  // required string machine = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_machine().data(), static_cast<int>(this->_internal_machine().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.ResetMachine.machine");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_machine(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.ResetMachine)
+  return target;
+}
+
+size_t ResetMachine::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.ResetMachine)
+  size_t total_size = 0;
+
+  if (_internal_has_machine()) {
+    // required string machine = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_machine());
+  }
+
+  if (_internal_has_team_color()) {
+    // required .llsf_msgs.Team team_color = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+
+  return total_size;
+}
+size_t ResetMachine::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.ResetMachine)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string machine = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_machine());
+
+    // required .llsf_msgs.Team team_color = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResetMachine::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResetMachine::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResetMachine::GetClassData() const { return &_class_data_; }
+
+
+void ResetMachine::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResetMachine*>(&to_msg);
+  auto& from = static_cast<const ResetMachine&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.ResetMachine)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_machine(from._internal_machine());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResetMachine::CopyFrom(const ResetMachine& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.ResetMachine)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResetMachine::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ResetMachine::InternalSwap(ResetMachine* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.machine_, lhs_arena,
+      &other->_impl_.machine_, rhs_arena
+  );
+  swap(_impl_.team_color_, other->_impl_.team_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResetMachine::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineInstructions_2eproto_getter, &descriptor_table_MachineInstructions_2eproto_once,
+      file_level_metadata_MachineInstructions_2eproto[6]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::PrepareInstructionBS*
+Arena::CreateMaybeMessage< ::llsf_msgs::PrepareInstructionBS >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::PrepareInstructionBS >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::PrepareInstructionDS*
+Arena::CreateMaybeMessage< ::llsf_msgs::PrepareInstructionDS >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::PrepareInstructionDS >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::PrepareInstructionSS*
+Arena::CreateMaybeMessage< ::llsf_msgs::PrepareInstructionSS >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::PrepareInstructionSS >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::PrepareInstructionRS*
+Arena::CreateMaybeMessage< ::llsf_msgs::PrepareInstructionRS >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::PrepareInstructionRS >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::PrepareInstructionCS*
+Arena::CreateMaybeMessage< ::llsf_msgs::PrepareInstructionCS >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::PrepareInstructionCS >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::PrepareMachine*
+Arena::CreateMaybeMessage< ::llsf_msgs::PrepareMachine >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::PrepareMachine >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::ResetMachine*
+Arena::CreateMaybeMessage< ::llsf_msgs::ResetMachine >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::ResetMachine >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
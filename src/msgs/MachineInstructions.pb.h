@@ -0,0 +1,2613 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MachineInstructions.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_MachineInstructions_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_MachineInstructions_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "MachineDescription.pb.h"
+#include "ProductColor.pb.h"
+#include "Team.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_MachineInstructions_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_MachineInstructions_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_MachineInstructions_2eproto;
+namespace llsf_msgs {
+class PrepareInstructionBS;
+struct PrepareInstructionBSDefaultTypeInternal;
+extern PrepareInstructionBSDefaultTypeInternal _PrepareInstructionBS_default_instance_;
+class PrepareInstructionCS;
+struct PrepareInstructionCSDefaultTypeInternal;
+extern PrepareInstructionCSDefaultTypeInternal _PrepareInstructionCS_default_instance_;
+class PrepareInstructionDS;
+struct PrepareInstructionDSDefaultTypeInternal;
+extern PrepareInstructionDSDefaultTypeInternal _PrepareInstructionDS_default_instance_;
+class PrepareInstructionRS;
+struct PrepareInstructionRSDefaultTypeInternal;
+extern PrepareInstructionRSDefaultTypeInternal _PrepareInstructionRS_default_instance_;
+class PrepareInstructionSS;
+struct PrepareInstructionSSDefaultTypeInternal;
+extern PrepareInstructionSSDefaultTypeInternal _PrepareInstructionSS_default_instance_;
+class PrepareMachine;
+struct PrepareMachineDefaultTypeInternal;
+extern PrepareMachineDefaultTypeInternal _PrepareMachine_default_instance_;
+class ResetMachine;
+struct ResetMachineDefaultTypeInternal;
+extern ResetMachineDefaultTypeInternal _ResetMachine_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::PrepareInstructionBS* Arena::CreateMaybeMessage<::llsf_msgs::PrepareInstructionBS>(Arena*);
+template<> ::llsf_msgs::PrepareInstructionCS* Arena::CreateMaybeMessage<::llsf_msgs::PrepareInstructionCS>(Arena*);
+template<> ::llsf_msgs::PrepareInstructionDS* Arena::CreateMaybeMessage<::llsf_msgs::PrepareInstructionDS>(Arena*);
+template<> ::llsf_msgs::PrepareInstructionRS* Arena::CreateMaybeMessage<::llsf_msgs::PrepareInstructionRS>(Arena*);
+template<> ::llsf_msgs::PrepareInstructionSS* Arena::CreateMaybeMessage<::llsf_msgs::PrepareInstructionSS>(Arena*);
+template<> ::llsf_msgs::PrepareMachine* Arena::CreateMaybeMessage<::llsf_msgs::PrepareMachine>(Arena*);
+template<> ::llsf_msgs::ResetMachine* Arena::CreateMaybeMessage<::llsf_msgs::ResetMachine>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum PrepareMachine_CompType : int {
+  PrepareMachine_CompType_COMP_ID = 2000,
+  PrepareMachine_CompType_MSG_TYPE = 101
+};
+bool PrepareMachine_CompType_IsValid(int value);
+constexpr PrepareMachine_CompType PrepareMachine_CompType_CompType_MIN = PrepareMachine_CompType_MSG_TYPE;
+constexpr PrepareMachine_CompType PrepareMachine_CompType_CompType_MAX = PrepareMachine_CompType_COMP_ID;
+constexpr int PrepareMachine_CompType_CompType_ARRAYSIZE = PrepareMachine_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PrepareMachine_CompType_descriptor();
+template<typename T>
+inline const std::string& PrepareMachine_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PrepareMachine_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PrepareMachine_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PrepareMachine_CompType_descriptor(), enum_t_value);
+}
+inline bool PrepareMachine_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PrepareMachine_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PrepareMachine_CompType>(
+    PrepareMachine_CompType_descriptor(), name, value);
+}
+enum ResetMachine_CompType : int {
+  ResetMachine_CompType_COMP_ID = 2000,
+  ResetMachine_CompType_MSG_TYPE = 104
+};
+bool ResetMachine_CompType_IsValid(int value);
+constexpr ResetMachine_CompType ResetMachine_CompType_CompType_MIN = ResetMachine_CompType_MSG_TYPE;
+constexpr ResetMachine_CompType ResetMachine_CompType_CompType_MAX = ResetMachine_CompType_COMP_ID;
+constexpr int ResetMachine_CompType_CompType_ARRAYSIZE = ResetMachine_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ResetMachine_CompType_descriptor();
+template<typename T>
+inline const std::string& ResetMachine_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ResetMachine_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ResetMachine_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ResetMachine_CompType_descriptor(), enum_t_value);
+}
+inline bool ResetMachine_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ResetMachine_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ResetMachine_CompType>(
+    ResetMachine_CompType_descriptor(), name, value);
+}
+enum MachineSide : int {
+  INPUT = 1,
+  OUTPUT = 2
+};
+bool MachineSide_IsValid(int value);
+constexpr MachineSide MachineSide_MIN = INPUT;
+constexpr MachineSide MachineSide_MAX = OUTPUT;
+constexpr int MachineSide_ARRAYSIZE = MachineSide_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineSide_descriptor();
+template<typename T>
+inline const std::string& MachineSide_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MachineSide>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MachineSide_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MachineSide_descriptor(), enum_t_value);
+}
+inline bool MachineSide_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MachineSide* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MachineSide>(
+    MachineSide_descriptor(), name, value);
+}
+// ===================================================================
+
+class PrepareInstructionBS final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.PrepareInstructionBS) */ {
+ public:
+  inline PrepareInstructionBS() : PrepareInstructionBS(nullptr) {}
+  ~PrepareInstructionBS() override;
+  explicit PROTOBUF_CONSTEXPR PrepareInstructionBS(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareInstructionBS(const PrepareInstructionBS& from);
+  PrepareInstructionBS(PrepareInstructionBS&& from) noexcept
+    : PrepareInstructionBS() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareInstructionBS& operator=(const PrepareInstructionBS& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareInstructionBS& operator=(PrepareInstructionBS&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareInstructionBS& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareInstructionBS* internal_default_instance() {
+    return reinterpret_cast<const PrepareInstructionBS*>(
+               &_PrepareInstructionBS_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PrepareInstructionBS& a, PrepareInstructionBS& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareInstructionBS* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareInstructionBS* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareInstructionBS* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareInstructionBS>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareInstructionBS& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareInstructionBS& from) {
+    PrepareInstructionBS::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareInstructionBS* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.PrepareInstructionBS";
+  }
+  protected:
+  explicit PrepareInstructionBS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSideFieldNumber = 1,
+    kColorFieldNumber = 2,
+  };
+  // required .llsf_msgs.MachineSide side = 1;
+  bool has_side() const;
+  private:
+  bool _internal_has_side() const;
+  public:
+  void clear_side();
+  ::llsf_msgs::MachineSide side() const;
+  void set_side(::llsf_msgs::MachineSide value);
+  private:
+  ::llsf_msgs::MachineSide _internal_side() const;
+  void _internal_set_side(::llsf_msgs::MachineSide value);
+  public:
+
+  // required .llsf_msgs.BaseColor color = 2;
+  bool has_color() const;
+  private:
+  bool _internal_has_color() const;
+  public:
+  void clear_color();
+  ::llsf_msgs::BaseColor color() const;
+  void set_color(::llsf_msgs::BaseColor value);
+  private:
+  ::llsf_msgs::BaseColor _internal_color() const;
+  void _internal_set_color(::llsf_msgs::BaseColor value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.PrepareInstructionBS)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int side_;
+    int color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInstructions_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareInstructionDS final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.PrepareInstructionDS) */ {
+ public:
+  inline PrepareInstructionDS() : PrepareInstructionDS(nullptr) {}
+  ~PrepareInstructionDS() override;
+  explicit PROTOBUF_CONSTEXPR PrepareInstructionDS(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareInstructionDS(const PrepareInstructionDS& from);
+  PrepareInstructionDS(PrepareInstructionDS&& from) noexcept
+    : PrepareInstructionDS() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareInstructionDS& operator=(const PrepareInstructionDS& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareInstructionDS& operator=(PrepareInstructionDS&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareInstructionDS& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareInstructionDS* internal_default_instance() {
+    return reinterpret_cast<const PrepareInstructionDS*>(
+               &_PrepareInstructionDS_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(PrepareInstructionDS& a, PrepareInstructionDS& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareInstructionDS* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareInstructionDS* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareInstructionDS* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareInstructionDS>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareInstructionDS& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareInstructionDS& from) {
+    PrepareInstructionDS::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareInstructionDS* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.PrepareInstructionDS";
+  }
+  protected:
+  explicit PrepareInstructionDS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOrderIdFieldNumber = 2,
+  };
+  // required uint32 order_id = 2;
+  bool has_order_id() const;
+  private:
+  bool _internal_has_order_id() const;
+  public:
+  void clear_order_id();
+  uint32_t order_id() const;
+  void set_order_id(uint32_t value);
+  private:
+  uint32_t _internal_order_id() const;
+  void _internal_set_order_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.PrepareInstructionDS)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t order_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInstructions_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareInstructionSS final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.PrepareInstructionSS) */ {
+ public:
+  inline PrepareInstructionSS() : PrepareInstructionSS(nullptr) {}
+  ~PrepareInstructionSS() override;
+  explicit PROTOBUF_CONSTEXPR PrepareInstructionSS(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareInstructionSS(const PrepareInstructionSS& from);
+  PrepareInstructionSS(PrepareInstructionSS&& from) noexcept
+    : PrepareInstructionSS() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareInstructionSS& operator=(const PrepareInstructionSS& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareInstructionSS& operator=(PrepareInstructionSS&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareInstructionSS& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareInstructionSS* internal_default_instance() {
+    return reinterpret_cast<const PrepareInstructionSS*>(
+               &_PrepareInstructionSS_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(PrepareInstructionSS& a, PrepareInstructionSS& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareInstructionSS* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareInstructionSS* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareInstructionSS* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareInstructionSS>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareInstructionSS& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareInstructionSS& from) {
+    PrepareInstructionSS::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareInstructionSS* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.PrepareInstructionSS";
+  }
+  protected:
+  explicit PrepareInstructionSS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWpDescriptionFieldNumber = 10,
+    kShelfFieldNumber = 2,
+    kSlotFieldNumber = 3,
+    kOperationFieldNumber = 1,
+  };
+  // optional string wp_description = 10;
+  bool has_wp_description() const;
+  private:
+  bool _internal_has_wp_description() const;
+  public:
+  void clear_wp_description();
+  const std::string& wp_description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_wp_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_wp_description();
+  PROTOBUF_NODISCARD std::string* release_wp_description();
+  void set_allocated_wp_description(std::string* wp_description);
+  private:
+  const std::string& _internal_wp_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_wp_description(const std::string& value);
+  std::string* _internal_mutable_wp_description();
+  public:
+
+  // required uint32 shelf = 2;
+  bool has_shelf() const;
+  private:
+  bool _internal_has_shelf() const;
+  public:
+  void clear_shelf();
+  uint32_t shelf() const;
+  void set_shelf(uint32_t value);
+  private:
+  uint32_t _internal_shelf() const;
+  void _internal_set_shelf(uint32_t value);
+  public:
+
+  // required uint32 slot = 3;
+  bool has_slot() const;
+  private:
+  bool _internal_has_slot() const;
+  public:
+  void clear_slot();
+  uint32_t slot() const;
+  void set_slot(uint32_t value);
+  private:
+  uint32_t _internal_slot() const;
+  void _internal_set_slot(uint32_t value);
+  public:
+
+  // required .llsf_msgs.SSOp operation = 1;
+  bool has_operation() const;
+  private:
+  bool _internal_has_operation() const;
+  public:
+  void clear_operation();
+  ::llsf_msgs::SSOp operation() const;
+  void set_operation(::llsf_msgs::SSOp value);
+  private:
+  ::llsf_msgs::SSOp _internal_operation() const;
+  void _internal_set_operation(::llsf_msgs::SSOp value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.PrepareInstructionSS)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr wp_description_;
+    uint32_t shelf_;
+    uint32_t slot_;
+    int operation_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInstructions_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareInstructionRS final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.PrepareInstructionRS) */ {
+ public:
+  inline PrepareInstructionRS() : PrepareInstructionRS(nullptr) {}
+  ~PrepareInstructionRS() override;
+  explicit PROTOBUF_CONSTEXPR PrepareInstructionRS(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareInstructionRS(const PrepareInstructionRS& from);
+  PrepareInstructionRS(PrepareInstructionRS&& from) noexcept
+    : PrepareInstructionRS() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareInstructionRS& operator=(const PrepareInstructionRS& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareInstructionRS& operator=(PrepareInstructionRS&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareInstructionRS& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareInstructionRS* internal_default_instance() {
+    return reinterpret_cast<const PrepareInstructionRS*>(
+               &_PrepareInstructionRS_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(PrepareInstructionRS& a, PrepareInstructionRS& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareInstructionRS* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareInstructionRS* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareInstructionRS* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareInstructionRS>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareInstructionRS& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareInstructionRS& from) {
+    PrepareInstructionRS::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareInstructionRS* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.PrepareInstructionRS";
+  }
+  protected:
+  explicit PrepareInstructionRS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRingColorFieldNumber = 1,
+  };
+  // required .llsf_msgs.RingColor ring_color = 1;
+  bool has_ring_color() const;
+  private:
+  bool _internal_has_ring_color() const;
+  public:
+  void clear_ring_color();
+  ::llsf_msgs::RingColor ring_color() const;
+  void set_ring_color(::llsf_msgs::RingColor value);
+  private:
+  ::llsf_msgs::RingColor _internal_ring_color() const;
+  void _internal_set_ring_color(::llsf_msgs::RingColor value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.PrepareInstructionRS)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int ring_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInstructions_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareInstructionCS final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.PrepareInstructionCS) */ {
+ public:
+  inline PrepareInstructionCS() : PrepareInstructionCS(nullptr) {}
+  ~PrepareInstructionCS() override;
+  explicit PROTOBUF_CONSTEXPR PrepareInstructionCS(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareInstructionCS(const PrepareInstructionCS& from);
+  PrepareInstructionCS(PrepareInstructionCS&& from) noexcept
+    : PrepareInstructionCS() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareInstructionCS& operator=(const PrepareInstructionCS& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareInstructionCS& operator=(PrepareInstructionCS&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareInstructionCS& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareInstructionCS* internal_default_instance() {
+    return reinterpret_cast<const PrepareInstructionCS*>(
+               &_PrepareInstructionCS_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(PrepareInstructionCS& a, PrepareInstructionCS& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareInstructionCS* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareInstructionCS* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareInstructionCS* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareInstructionCS>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareInstructionCS& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareInstructionCS& from) {
+    PrepareInstructionCS::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareInstructionCS* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.PrepareInstructionCS";
+  }
+  protected:
+  explicit PrepareInstructionCS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationFieldNumber = 1,
+  };
+  // required .llsf_msgs.CSOp operation = 1;
+  bool has_operation() const;
+  private:
+  bool _internal_has_operation() const;
+  public:
+  void clear_operation();
+  ::llsf_msgs::CSOp operation() const;
+  void set_operation(::llsf_msgs::CSOp value);
+  private:
+  ::llsf_msgs::CSOp _internal_operation() const;
+  void _internal_set_operation(::llsf_msgs::CSOp value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.PrepareInstructionCS)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int operation_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInstructions_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareMachine final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.PrepareMachine) */ {
+ public:
+  inline PrepareMachine() : PrepareMachine(nullptr) {}
+  ~PrepareMachine() override;
+  explicit PROTOBUF_CONSTEXPR PrepareMachine(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareMachine(const PrepareMachine& from);
+  PrepareMachine(PrepareMachine&& from) noexcept
+    : PrepareMachine() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareMachine& operator=(const PrepareMachine& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareMachine& operator=(PrepareMachine&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareMachine& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareMachine* internal_default_instance() {
+    return reinterpret_cast<const PrepareMachine*>(
+               &_PrepareMachine_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(PrepareMachine& a, PrepareMachine& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareMachine* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareMachine* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareMachine* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareMachine>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareMachine& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareMachine& from) {
+    PrepareMachine::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareMachine* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.PrepareMachine";
+  }
+  protected:
+  explicit PrepareMachine(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef PrepareMachine_CompType CompType;
+  static constexpr CompType COMP_ID =
+    PrepareMachine_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    PrepareMachine_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return PrepareMachine_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    PrepareMachine_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    PrepareMachine_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    PrepareMachine_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return PrepareMachine_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return PrepareMachine_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return PrepareMachine_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMachineFieldNumber = 2,
+    kInstructionBsFieldNumber = 4,
+    kInstructionDsFieldNumber = 5,
+    kInstructionRsFieldNumber = 6,
+    kInstructionCsFieldNumber = 7,
+    kInstructionSsFieldNumber = 8,
+    kSentAtFieldNumber = 15,
+    kTeamColorFieldNumber = 1,
+  };
+  // required string machine = 2;
+  bool has_machine() const;
+  private:
+  bool _internal_has_machine() const;
+  public:
+  void clear_machine();
+  const std::string& machine() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_machine(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_machine();
+  PROTOBUF_NODISCARD std::string* release_machine();
+  void set_allocated_machine(std::string* machine);
+  private:
+  const std::string& _internal_machine() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_machine(const std::string& value);
+  std::string* _internal_mutable_machine();
+  public:
+
+  // optional .llsf_msgs.PrepareInstructionBS instruction_bs = 4;
+  bool has_instruction_bs() const;
+  private:
+  bool _internal_has_instruction_bs() const;
+  public:
+  void clear_instruction_bs();
+  const ::llsf_msgs::PrepareInstructionBS& instruction_bs() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::PrepareInstructionBS* release_instruction_bs();
+  ::llsf_msgs::PrepareInstructionBS* mutable_instruction_bs();
+  void set_allocated_instruction_bs(::llsf_msgs::PrepareInstructionBS* instruction_bs);
+  private:
+  const ::llsf_msgs::PrepareInstructionBS& _internal_instruction_bs() const;
+  ::llsf_msgs::PrepareInstructionBS* _internal_mutable_instruction_bs();
+  public:
+  void unsafe_arena_set_allocated_instruction_bs(
+      ::llsf_msgs::PrepareInstructionBS* instruction_bs);
+  ::llsf_msgs::PrepareInstructionBS* unsafe_arena_release_instruction_bs();
+
+  // optional .llsf_msgs.PrepareInstructionDS instruction_ds = 5;
+  bool has_instruction_ds() const;
+  private:
+  bool _internal_has_instruction_ds() const;
+  public:
+  void clear_instruction_ds();
+  const ::llsf_msgs::PrepareInstructionDS& instruction_ds() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::PrepareInstructionDS* release_instruction_ds();
+  ::llsf_msgs::PrepareInstructionDS* mutable_instruction_ds();
+  void set_allocated_instruction_ds(::llsf_msgs::PrepareInstructionDS* instruction_ds);
+  private:
+  const ::llsf_msgs::PrepareInstructionDS& _internal_instruction_ds() const;
+  ::llsf_msgs::PrepareInstructionDS* _internal_mutable_instruction_ds();
+  public:
+  void unsafe_arena_set_allocated_instruction_ds(
+      ::llsf_msgs::PrepareInstructionDS* instruction_ds);
+  ::llsf_msgs::PrepareInstructionDS* unsafe_arena_release_instruction_ds();
+
+  // optional .llsf_msgs.PrepareInstructionRS instruction_rs = 6;
+  bool has_instruction_rs() const;
+  private:
+  bool _internal_has_instruction_rs() const;
+  public:
+  void clear_instruction_rs();
+  const ::llsf_msgs::PrepareInstructionRS& instruction_rs() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::PrepareInstructionRS* release_instruction_rs();
+  ::llsf_msgs::PrepareInstructionRS* mutable_instruction_rs();
+  void set_allocated_instruction_rs(::llsf_msgs::PrepareInstructionRS* instruction_rs);
+  private:
+  const ::llsf_msgs::PrepareInstructionRS& _internal_instruction_rs() const;
+  ::llsf_msgs::PrepareInstructionRS* _internal_mutable_instruction_rs();
+  public:
+  void unsafe_arena_set_allocated_instruction_rs(
+      ::llsf_msgs::PrepareInstructionRS* instruction_rs);
+  ::llsf_msgs::PrepareInstructionRS* unsafe_arena_release_instruction_rs();
+
+  // optional .llsf_msgs.PrepareInstructionCS instruction_cs = 7;
+  bool has_instruction_cs() const;
+  private:
+  bool _internal_has_instruction_cs() const;
+  public:
+  void clear_instruction_cs();
+  const ::llsf_msgs::PrepareInstructionCS& instruction_cs() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::PrepareInstructionCS* release_instruction_cs();
+  ::llsf_msgs::PrepareInstructionCS* mutable_instruction_cs();
+  void set_allocated_instruction_cs(::llsf_msgs::PrepareInstructionCS* instruction_cs);
+  private:
+  const ::llsf_msgs::PrepareInstructionCS& _internal_instruction_cs() const;
+  ::llsf_msgs::PrepareInstructionCS* _internal_mutable_instruction_cs();
+  public:
+  void unsafe_arena_set_allocated_instruction_cs(
+      ::llsf_msgs::PrepareInstructionCS* instruction_cs);
+  ::llsf_msgs::PrepareInstructionCS* unsafe_arena_release_instruction_cs();
+
+  // optional .llsf_msgs.PrepareInstructionSS instruction_ss = 8;
+  bool has_instruction_ss() const;
+  private:
+  bool _internal_has_instruction_ss() const;
+  public:
+  void clear_instruction_ss();
+  const ::llsf_msgs::PrepareInstructionSS& instruction_ss() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::PrepareInstructionSS* release_instruction_ss();
+  ::llsf_msgs::PrepareInstructionSS* mutable_instruction_ss();
+  void set_allocated_instruction_ss(::llsf_msgs::PrepareInstructionSS* instruction_ss);
+  private:
+  const ::llsf_msgs::PrepareInstructionSS& _internal_instruction_ss() const;
+  ::llsf_msgs::PrepareInstructionSS* _internal_mutable_instruction_ss();
+  public:
+  void unsafe_arena_set_allocated_instruction_ss(
+      ::llsf_msgs::PrepareInstructionSS* instruction_ss);
+  ::llsf_msgs::PrepareInstructionSS* unsafe_arena_release_instruction_ss();
+
+  // optional uint64 sent_at = 15;
+  bool has_sent_at() const;
+  private:
+  bool _internal_has_sent_at() const;
+  public:
+  void clear_sent_at();
+  uint64_t sent_at() const;
+  void set_sent_at(uint64_t value);
+  private:
+  uint64_t _internal_sent_at() const;
+  void _internal_set_sent_at(uint64_t value);
+  public:
+
+  // required .llsf_msgs.Team team_color = 1;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.PrepareMachine)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr machine_;
+    ::llsf_msgs::PrepareInstructionBS* instruction_bs_;
+    ::llsf_msgs::PrepareInstructionDS* instruction_ds_;
+    ::llsf_msgs::PrepareInstructionRS* instruction_rs_;
+    ::llsf_msgs::PrepareInstructionCS* instruction_cs_;
+    ::llsf_msgs::PrepareInstructionSS* instruction_ss_;
+    uint64_t sent_at_;
+    int team_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInstructions_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResetMachine final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.ResetMachine) */ {
+ public:
+  inline ResetMachine() : ResetMachine(nullptr) {}
+  ~ResetMachine() override;
+  explicit PROTOBUF_CONSTEXPR ResetMachine(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResetMachine(const ResetMachine& from);
+  ResetMachine(ResetMachine&& from) noexcept
+    : ResetMachine() {
+    *this = ::std::move(from);
+  }
+
+  inline ResetMachine& operator=(const ResetMachine& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResetMachine& operator=(ResetMachine&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResetMachine& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResetMachine* internal_default_instance() {
+    return reinterpret_cast<const ResetMachine*>(
+               &_ResetMachine_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ResetMachine& a, ResetMachine& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResetMachine* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResetMachine* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResetMachine* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResetMachine>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResetMachine& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResetMachine& from) {
+    ResetMachine::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResetMachine* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.ResetMachine";
+  }
+  protected:
+  explicit ResetMachine(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ResetMachine_CompType CompType;
+  static constexpr CompType COMP_ID =
+    ResetMachine_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    ResetMachine_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return ResetMachine_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    ResetMachine_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    ResetMachine_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    ResetMachine_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return ResetMachine_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return ResetMachine_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return ResetMachine_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMachineFieldNumber = 2,
+    kTeamColorFieldNumber = 1,
+  };
+  // required string machine = 2;
+  bool has_machine() const;
+  private:
+  bool _internal_has_machine() const;
+  public:
+  void clear_machine();
+  const std::string& machine() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_machine(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_machine();
+  PROTOBUF_NODISCARD std::string* release_machine();
+  void set_allocated_machine(std::string* machine);
+  private:
+  const std::string& _internal_machine() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_machine(const std::string& value);
+  std::string* _internal_mutable_machine();
+  public:
+
+  // required .llsf_msgs.Team team_color = 1;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.ResetMachine)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr machine_;
+    int team_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineInstructions_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PrepareInstructionBS
+
+// required .llsf_msgs.MachineSide side = 1;
+inline bool PrepareInstructionBS::_internal_has_side() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrepareInstructionBS::has_side() const {
+  return _internal_has_side();
+}
+inline void PrepareInstructionBS::clear_side() {
+  _impl_.side_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::MachineSide PrepareInstructionBS::_internal_side() const {
+  return static_cast< ::llsf_msgs::MachineSide >(_impl_.side_);
+}
+inline ::llsf_msgs::MachineSide PrepareInstructionBS::side() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareInstructionBS.side)
+  return _internal_side();
+}
+inline void PrepareInstructionBS::_internal_set_side(::llsf_msgs::MachineSide value) {
+  assert(::llsf_msgs::MachineSide_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.side_ = value;
+}
+inline void PrepareInstructionBS::set_side(::llsf_msgs::MachineSide value) {
+  _internal_set_side(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareInstructionBS.side)
+}
+
+// required .llsf_msgs.BaseColor color = 2;
+inline bool PrepareInstructionBS::_internal_has_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrepareInstructionBS::has_color() const {
+  return _internal_has_color();
+}
+inline void PrepareInstructionBS::clear_color() {
+  _impl_.color_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::llsf_msgs::BaseColor PrepareInstructionBS::_internal_color() const {
+  return static_cast< ::llsf_msgs::BaseColor >(_impl_.color_);
+}
+inline ::llsf_msgs::BaseColor PrepareInstructionBS::color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareInstructionBS.color)
+  return _internal_color();
+}
+inline void PrepareInstructionBS::_internal_set_color(::llsf_msgs::BaseColor value) {
+  assert(::llsf_msgs::BaseColor_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.color_ = value;
+}
+inline void PrepareInstructionBS::set_color(::llsf_msgs::BaseColor value) {
+  _internal_set_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareInstructionBS.color)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareInstructionDS
+
+// required uint32 order_id = 2;
+inline bool PrepareInstructionDS::_internal_has_order_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrepareInstructionDS::has_order_id() const {
+  return _internal_has_order_id();
+}
+inline void PrepareInstructionDS::clear_order_id() {
+  _impl_.order_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t PrepareInstructionDS::_internal_order_id() const {
+  return _impl_.order_id_;
+}
+inline uint32_t PrepareInstructionDS::order_id() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareInstructionDS.order_id)
+  return _internal_order_id();
+}
+inline void PrepareInstructionDS::_internal_set_order_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.order_id_ = value;
+}
+inline void PrepareInstructionDS::set_order_id(uint32_t value) {
+  _internal_set_order_id(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareInstructionDS.order_id)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareInstructionSS
+
+// required .llsf_msgs.SSOp operation = 1;
+inline bool PrepareInstructionSS::_internal_has_operation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PrepareInstructionSS::has_operation() const {
+  return _internal_has_operation();
+}
+inline void PrepareInstructionSS::clear_operation() {
+  _impl_.operation_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::llsf_msgs::SSOp PrepareInstructionSS::_internal_operation() const {
+  return static_cast< ::llsf_msgs::SSOp >(_impl_.operation_);
+}
+inline ::llsf_msgs::SSOp PrepareInstructionSS::operation() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareInstructionSS.operation)
+  return _internal_operation();
+}
+inline void PrepareInstructionSS::_internal_set_operation(::llsf_msgs::SSOp value) {
+  assert(::llsf_msgs::SSOp_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.operation_ = value;
+}
+inline void PrepareInstructionSS::set_operation(::llsf_msgs::SSOp value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareInstructionSS.operation)
+}
+
+// required uint32 shelf = 2;
+inline bool PrepareInstructionSS::_internal_has_shelf() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PrepareInstructionSS::has_shelf() const {
+  return _internal_has_shelf();
+}
+inline void PrepareInstructionSS::clear_shelf() {
+  _impl_.shelf_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t PrepareInstructionSS::_internal_shelf() const {
+  return _impl_.shelf_;
+}
+inline uint32_t PrepareInstructionSS::shelf() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareInstructionSS.shelf)
+  return _internal_shelf();
+}
+inline void PrepareInstructionSS::_internal_set_shelf(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shelf_ = value;
+}
+inline void PrepareInstructionSS::set_shelf(uint32_t value) {
+  _internal_set_shelf(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareInstructionSS.shelf)
+}
+
+// required uint32 slot = 3;
+inline bool PrepareInstructionSS::_internal_has_slot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PrepareInstructionSS::has_slot() const {
+  return _internal_has_slot();
+}
+inline void PrepareInstructionSS::clear_slot() {
+  _impl_.slot_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t PrepareInstructionSS::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline uint32_t PrepareInstructionSS::slot() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareInstructionSS.slot)
+  return _internal_slot();
+}
+inline void PrepareInstructionSS::_internal_set_slot(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.slot_ = value;
+}
+inline void PrepareInstructionSS::set_slot(uint32_t value) {
+  _internal_set_slot(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareInstructionSS.slot)
+}
+
+// optional string wp_description = 10;
+inline bool PrepareInstructionSS::_internal_has_wp_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrepareInstructionSS::has_wp_description() const {
+  return _internal_has_wp_description();
+}
+inline void PrepareInstructionSS::clear_wp_description() {
+  _impl_.wp_description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PrepareInstructionSS::wp_description() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareInstructionSS.wp_description)
+  return _internal_wp_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrepareInstructionSS::set_wp_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.wp_description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareInstructionSS.wp_description)
+}
+inline std::string* PrepareInstructionSS::mutable_wp_description() {
+  std::string* _s = _internal_mutable_wp_description();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.PrepareInstructionSS.wp_description)
+  return _s;
+}
+inline const std::string& PrepareInstructionSS::_internal_wp_description() const {
+  return _impl_.wp_description_.Get();
+}
+inline void PrepareInstructionSS::_internal_set_wp_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.wp_description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrepareInstructionSS::_internal_mutable_wp_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.wp_description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrepareInstructionSS::release_wp_description() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.PrepareInstructionSS.wp_description)
+  if (!_internal_has_wp_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.wp_description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.wp_description_.IsDefault()) {
+    _impl_.wp_description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PrepareInstructionSS::set_allocated_wp_description(std::string* wp_description) {
+  if (wp_description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.wp_description_.SetAllocated(wp_description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.wp_description_.IsDefault()) {
+    _impl_.wp_description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.PrepareInstructionSS.wp_description)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareInstructionRS
+
+// required .llsf_msgs.RingColor ring_color = 1;
+inline bool PrepareInstructionRS::_internal_has_ring_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrepareInstructionRS::has_ring_color() const {
+  return _internal_has_ring_color();
+}
+inline void PrepareInstructionRS::clear_ring_color() {
+  _impl_.ring_color_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::RingColor PrepareInstructionRS::_internal_ring_color() const {
+  return static_cast< ::llsf_msgs::RingColor >(_impl_.ring_color_);
+}
+inline ::llsf_msgs::RingColor PrepareInstructionRS::ring_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareInstructionRS.ring_color)
+  return _internal_ring_color();
+}
+inline void PrepareInstructionRS::_internal_set_ring_color(::llsf_msgs::RingColor value) {
+  assert(::llsf_msgs::RingColor_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ring_color_ = value;
+}
+inline void PrepareInstructionRS::set_ring_color(::llsf_msgs::RingColor value) {
+  _internal_set_ring_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareInstructionRS.ring_color)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareInstructionCS
+
+// required .llsf_msgs.CSOp operation = 1;
+inline bool PrepareInstructionCS::_internal_has_operation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrepareInstructionCS::has_operation() const {
+  return _internal_has_operation();
+}
+inline void PrepareInstructionCS::clear_operation() {
+  _impl_.operation_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::CSOp PrepareInstructionCS::_internal_operation() const {
+  return static_cast< ::llsf_msgs::CSOp >(_impl_.operation_);
+}
+inline ::llsf_msgs::CSOp PrepareInstructionCS::operation() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareInstructionCS.operation)
+  return _internal_operation();
+}
+inline void PrepareInstructionCS::_internal_set_operation(::llsf_msgs::CSOp value) {
+  assert(::llsf_msgs::CSOp_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.operation_ = value;
+}
+inline void PrepareInstructionCS::set_operation(::llsf_msgs::CSOp value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareInstructionCS.operation)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareMachine
+
+// required .llsf_msgs.Team team_color = 1;
+inline bool PrepareMachine::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool PrepareMachine::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void PrepareMachine::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline ::llsf_msgs::Team PrepareMachine::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team PrepareMachine::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareMachine.team_color)
+  return _internal_team_color();
+}
+inline void PrepareMachine::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.team_color_ = value;
+}
+inline void PrepareMachine::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareMachine.team_color)
+}
+
+// required string machine = 2;
+inline bool PrepareMachine::_internal_has_machine() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PrepareMachine::has_machine() const {
+  return _internal_has_machine();
+}
+inline void PrepareMachine::clear_machine() {
+  _impl_.machine_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PrepareMachine::machine() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareMachine.machine)
+  return _internal_machine();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrepareMachine::set_machine(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.machine_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareMachine.machine)
+}
+inline std::string* PrepareMachine::mutable_machine() {
+  std::string* _s = _internal_mutable_machine();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.PrepareMachine.machine)
+  return _s;
+}
+inline const std::string& PrepareMachine::_internal_machine() const {
+  return _impl_.machine_.Get();
+}
+inline void PrepareMachine::_internal_set_machine(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.machine_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrepareMachine::_internal_mutable_machine() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.machine_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrepareMachine::release_machine() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.PrepareMachine.machine)
+  if (!_internal_has_machine()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.machine_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_.IsDefault()) {
+    _impl_.machine_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PrepareMachine::set_allocated_machine(std::string* machine) {
+  if (machine != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.machine_.SetAllocated(machine, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_.IsDefault()) {
+    _impl_.machine_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.PrepareMachine.machine)
+}
+
+// optional .llsf_msgs.PrepareInstructionBS instruction_bs = 4;
+inline bool PrepareMachine::_internal_has_instruction_bs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.instruction_bs_ != nullptr);
+  return value;
+}
+inline bool PrepareMachine::has_instruction_bs() const {
+  return _internal_has_instruction_bs();
+}
+inline void PrepareMachine::clear_instruction_bs() {
+  if (_impl_.instruction_bs_ != nullptr) _impl_.instruction_bs_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::llsf_msgs::PrepareInstructionBS& PrepareMachine::_internal_instruction_bs() const {
+  const ::llsf_msgs::PrepareInstructionBS* p = _impl_.instruction_bs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::PrepareInstructionBS&>(
+      ::llsf_msgs::_PrepareInstructionBS_default_instance_);
+}
+inline const ::llsf_msgs::PrepareInstructionBS& PrepareMachine::instruction_bs() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareMachine.instruction_bs)
+  return _internal_instruction_bs();
+}
+inline void PrepareMachine::unsafe_arena_set_allocated_instruction_bs(
+    ::llsf_msgs::PrepareInstructionBS* instruction_bs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_bs_);
+  }
+  _impl_.instruction_bs_ = instruction_bs;
+  if (instruction_bs) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.PrepareMachine.instruction_bs)
+}
+inline ::llsf_msgs::PrepareInstructionBS* PrepareMachine::release_instruction_bs() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::llsf_msgs::PrepareInstructionBS* temp = _impl_.instruction_bs_;
+  _impl_.instruction_bs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionBS* PrepareMachine::unsafe_arena_release_instruction_bs() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.PrepareMachine.instruction_bs)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::llsf_msgs::PrepareInstructionBS* temp = _impl_.instruction_bs_;
+  _impl_.instruction_bs_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionBS* PrepareMachine::_internal_mutable_instruction_bs() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.instruction_bs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::PrepareInstructionBS>(GetArenaForAllocation());
+    _impl_.instruction_bs_ = p;
+  }
+  return _impl_.instruction_bs_;
+}
+inline ::llsf_msgs::PrepareInstructionBS* PrepareMachine::mutable_instruction_bs() {
+  ::llsf_msgs::PrepareInstructionBS* _msg = _internal_mutable_instruction_bs();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.PrepareMachine.instruction_bs)
+  return _msg;
+}
+inline void PrepareMachine::set_allocated_instruction_bs(::llsf_msgs::PrepareInstructionBS* instruction_bs) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.instruction_bs_;
+  }
+  if (instruction_bs) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(instruction_bs);
+    if (message_arena != submessage_arena) {
+      instruction_bs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, instruction_bs, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.instruction_bs_ = instruction_bs;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.PrepareMachine.instruction_bs)
+}
+
+// optional .llsf_msgs.PrepareInstructionDS instruction_ds = 5;
+inline bool PrepareMachine::_internal_has_instruction_ds() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.instruction_ds_ != nullptr);
+  return value;
+}
+inline bool PrepareMachine::has_instruction_ds() const {
+  return _internal_has_instruction_ds();
+}
+inline void PrepareMachine::clear_instruction_ds() {
+  if (_impl_.instruction_ds_ != nullptr) _impl_.instruction_ds_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::llsf_msgs::PrepareInstructionDS& PrepareMachine::_internal_instruction_ds() const {
+  const ::llsf_msgs::PrepareInstructionDS* p = _impl_.instruction_ds_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::PrepareInstructionDS&>(
+      ::llsf_msgs::_PrepareInstructionDS_default_instance_);
+}
+inline const ::llsf_msgs::PrepareInstructionDS& PrepareMachine::instruction_ds() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareMachine.instruction_ds)
+  return _internal_instruction_ds();
+}
+inline void PrepareMachine::unsafe_arena_set_allocated_instruction_ds(
+    ::llsf_msgs::PrepareInstructionDS* instruction_ds) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_ds_);
+  }
+  _impl_.instruction_ds_ = instruction_ds;
+  if (instruction_ds) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.PrepareMachine.instruction_ds)
+}
+inline ::llsf_msgs::PrepareInstructionDS* PrepareMachine::release_instruction_ds() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::llsf_msgs::PrepareInstructionDS* temp = _impl_.instruction_ds_;
+  _impl_.instruction_ds_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionDS* PrepareMachine::unsafe_arena_release_instruction_ds() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.PrepareMachine.instruction_ds)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::llsf_msgs::PrepareInstructionDS* temp = _impl_.instruction_ds_;
+  _impl_.instruction_ds_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionDS* PrepareMachine::_internal_mutable_instruction_ds() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.instruction_ds_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::PrepareInstructionDS>(GetArenaForAllocation());
+    _impl_.instruction_ds_ = p;
+  }
+  return _impl_.instruction_ds_;
+}
+inline ::llsf_msgs::PrepareInstructionDS* PrepareMachine::mutable_instruction_ds() {
+  ::llsf_msgs::PrepareInstructionDS* _msg = _internal_mutable_instruction_ds();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.PrepareMachine.instruction_ds)
+  return _msg;
+}
+inline void PrepareMachine::set_allocated_instruction_ds(::llsf_msgs::PrepareInstructionDS* instruction_ds) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.instruction_ds_;
+  }
+  if (instruction_ds) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(instruction_ds);
+    if (message_arena != submessage_arena) {
+      instruction_ds = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, instruction_ds, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.instruction_ds_ = instruction_ds;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.PrepareMachine.instruction_ds)
+}
+
+// optional .llsf_msgs.PrepareInstructionSS instruction_ss = 8;
+inline bool PrepareMachine::_internal_has_instruction_ss() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.instruction_ss_ != nullptr);
+  return value;
+}
+inline bool PrepareMachine::has_instruction_ss() const {
+  return _internal_has_instruction_ss();
+}
+inline void PrepareMachine::clear_instruction_ss() {
+  if (_impl_.instruction_ss_ != nullptr) _impl_.instruction_ss_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::llsf_msgs::PrepareInstructionSS& PrepareMachine::_internal_instruction_ss() const {
+  const ::llsf_msgs::PrepareInstructionSS* p = _impl_.instruction_ss_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::PrepareInstructionSS&>(
+      ::llsf_msgs::_PrepareInstructionSS_default_instance_);
+}
+inline const ::llsf_msgs::PrepareInstructionSS& PrepareMachine::instruction_ss() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareMachine.instruction_ss)
+  return _internal_instruction_ss();
+}
+inline void PrepareMachine::unsafe_arena_set_allocated_instruction_ss(
+    ::llsf_msgs::PrepareInstructionSS* instruction_ss) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_ss_);
+  }
+  _impl_.instruction_ss_ = instruction_ss;
+  if (instruction_ss) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.PrepareMachine.instruction_ss)
+}
+inline ::llsf_msgs::PrepareInstructionSS* PrepareMachine::release_instruction_ss() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::llsf_msgs::PrepareInstructionSS* temp = _impl_.instruction_ss_;
+  _impl_.instruction_ss_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionSS* PrepareMachine::unsafe_arena_release_instruction_ss() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.PrepareMachine.instruction_ss)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::llsf_msgs::PrepareInstructionSS* temp = _impl_.instruction_ss_;
+  _impl_.instruction_ss_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionSS* PrepareMachine::_internal_mutable_instruction_ss() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.instruction_ss_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::PrepareInstructionSS>(GetArenaForAllocation());
+    _impl_.instruction_ss_ = p;
+  }
+  return _impl_.instruction_ss_;
+}
+inline ::llsf_msgs::PrepareInstructionSS* PrepareMachine::mutable_instruction_ss() {
+  ::llsf_msgs::PrepareInstructionSS* _msg = _internal_mutable_instruction_ss();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.PrepareMachine.instruction_ss)
+  return _msg;
+}
+inline void PrepareMachine::set_allocated_instruction_ss(::llsf_msgs::PrepareInstructionSS* instruction_ss) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.instruction_ss_;
+  }
+  if (instruction_ss) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(instruction_ss);
+    if (message_arena != submessage_arena) {
+      instruction_ss = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, instruction_ss, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.instruction_ss_ = instruction_ss;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.PrepareMachine.instruction_ss)
+}
+
+// optional .llsf_msgs.PrepareInstructionRS instruction_rs = 6;
+inline bool PrepareMachine::_internal_has_instruction_rs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.instruction_rs_ != nullptr);
+  return value;
+}
+inline bool PrepareMachine::has_instruction_rs() const {
+  return _internal_has_instruction_rs();
+}
+inline void PrepareMachine::clear_instruction_rs() {
+  if (_impl_.instruction_rs_ != nullptr) _impl_.instruction_rs_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::llsf_msgs::PrepareInstructionRS& PrepareMachine::_internal_instruction_rs() const {
+  const ::llsf_msgs::PrepareInstructionRS* p = _impl_.instruction_rs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::PrepareInstructionRS&>(
+      ::llsf_msgs::_PrepareInstructionRS_default_instance_);
+}
+inline const ::llsf_msgs::PrepareInstructionRS& PrepareMachine::instruction_rs() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareMachine.instruction_rs)
+  return _internal_instruction_rs();
+}
+inline void PrepareMachine::unsafe_arena_set_allocated_instruction_rs(
+    ::llsf_msgs::PrepareInstructionRS* instruction_rs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_rs_);
+  }
+  _impl_.instruction_rs_ = instruction_rs;
+  if (instruction_rs) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.PrepareMachine.instruction_rs)
+}
+inline ::llsf_msgs::PrepareInstructionRS* PrepareMachine::release_instruction_rs() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::llsf_msgs::PrepareInstructionRS* temp = _impl_.instruction_rs_;
+  _impl_.instruction_rs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionRS* PrepareMachine::unsafe_arena_release_instruction_rs() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.PrepareMachine.instruction_rs)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::llsf_msgs::PrepareInstructionRS* temp = _impl_.instruction_rs_;
+  _impl_.instruction_rs_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionRS* PrepareMachine::_internal_mutable_instruction_rs() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.instruction_rs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::PrepareInstructionRS>(GetArenaForAllocation());
+    _impl_.instruction_rs_ = p;
+  }
+  return _impl_.instruction_rs_;
+}
+inline ::llsf_msgs::PrepareInstructionRS* PrepareMachine::mutable_instruction_rs() {
+  ::llsf_msgs::PrepareInstructionRS* _msg = _internal_mutable_instruction_rs();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.PrepareMachine.instruction_rs)
+  return _msg;
+}
+inline void PrepareMachine::set_allocated_instruction_rs(::llsf_msgs::PrepareInstructionRS* instruction_rs) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.instruction_rs_;
+  }
+  if (instruction_rs) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(instruction_rs);
+    if (message_arena != submessage_arena) {
+      instruction_rs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, instruction_rs, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.instruction_rs_ = instruction_rs;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.PrepareMachine.instruction_rs)
+}
+
+// optional .llsf_msgs.PrepareInstructionCS instruction_cs = 7;
+inline bool PrepareMachine::_internal_has_instruction_cs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.instruction_cs_ != nullptr);
+  return value;
+}
+inline bool PrepareMachine::has_instruction_cs() const {
+  return _internal_has_instruction_cs();
+}
+inline void PrepareMachine::clear_instruction_cs() {
+  if (_impl_.instruction_cs_ != nullptr) _impl_.instruction_cs_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::llsf_msgs::PrepareInstructionCS& PrepareMachine::_internal_instruction_cs() const {
+  const ::llsf_msgs::PrepareInstructionCS* p = _impl_.instruction_cs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::PrepareInstructionCS&>(
+      ::llsf_msgs::_PrepareInstructionCS_default_instance_);
+}
+inline const ::llsf_msgs::PrepareInstructionCS& PrepareMachine::instruction_cs() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareMachine.instruction_cs)
+  return _internal_instruction_cs();
+}
+inline void PrepareMachine::unsafe_arena_set_allocated_instruction_cs(
+    ::llsf_msgs::PrepareInstructionCS* instruction_cs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.instruction_cs_);
+  }
+  _impl_.instruction_cs_ = instruction_cs;
+  if (instruction_cs) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.PrepareMachine.instruction_cs)
+}
+inline ::llsf_msgs::PrepareInstructionCS* PrepareMachine::release_instruction_cs() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::llsf_msgs::PrepareInstructionCS* temp = _impl_.instruction_cs_;
+  _impl_.instruction_cs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionCS* PrepareMachine::unsafe_arena_release_instruction_cs() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.PrepareMachine.instruction_cs)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::llsf_msgs::PrepareInstructionCS* temp = _impl_.instruction_cs_;
+  _impl_.instruction_cs_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::PrepareInstructionCS* PrepareMachine::_internal_mutable_instruction_cs() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.instruction_cs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::PrepareInstructionCS>(GetArenaForAllocation());
+    _impl_.instruction_cs_ = p;
+  }
+  return _impl_.instruction_cs_;
+}
+inline ::llsf_msgs::PrepareInstructionCS* PrepareMachine::mutable_instruction_cs() {
+  ::llsf_msgs::PrepareInstructionCS* _msg = _internal_mutable_instruction_cs();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.PrepareMachine.instruction_cs)
+  return _msg;
+}
+inline void PrepareMachine::set_allocated_instruction_cs(::llsf_msgs::PrepareInstructionCS* instruction_cs) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.instruction_cs_;
+  }
+  if (instruction_cs) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(instruction_cs);
+    if (message_arena != submessage_arena) {
+      instruction_cs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, instruction_cs, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.instruction_cs_ = instruction_cs;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.PrepareMachine.instruction_cs)
+}
+
+// optional uint64 sent_at = 15;
+inline bool PrepareMachine::_internal_has_sent_at() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool PrepareMachine::has_sent_at() const {
+  return _internal_has_sent_at();
+}
+inline void PrepareMachine::clear_sent_at() {
+  _impl_.sent_at_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t PrepareMachine::_internal_sent_at() const {
+  return _impl_.sent_at_;
+}
+inline uint64_t PrepareMachine::sent_at() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.PrepareMachine.sent_at)
+  return _internal_sent_at();
+}
+inline void PrepareMachine::_internal_set_sent_at(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.sent_at_ = value;
+}
+inline void PrepareMachine::set_sent_at(uint64_t value) {
+  _internal_set_sent_at(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.PrepareMachine.sent_at)
+}
+
+// -------------------------------------------------------------------
+
+// ResetMachine
+
+// required .llsf_msgs.Team team_color = 1;
+inline bool ResetMachine::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ResetMachine::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void ResetMachine::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::llsf_msgs::Team ResetMachine::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team ResetMachine::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ResetMachine.team_color)
+  return _internal_team_color();
+}
+inline void ResetMachine::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.team_color_ = value;
+}
+inline void ResetMachine::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.ResetMachine.team_color)
+}
+
+// required string machine = 2;
+inline bool ResetMachine::_internal_has_machine() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResetMachine::has_machine() const {
+  return _internal_has_machine();
+}
+inline void ResetMachine::clear_machine() {
+  _impl_.machine_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ResetMachine::machine() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ResetMachine.machine)
+  return _internal_machine();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResetMachine::set_machine(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.machine_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.ResetMachine.machine)
+}
+inline std::string* ResetMachine::mutable_machine() {
+  std::string* _s = _internal_mutable_machine();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.ResetMachine.machine)
+  return _s;
+}
+inline const std::string& ResetMachine::_internal_machine() const {
+  return _impl_.machine_.Get();
+}
+inline void ResetMachine::_internal_set_machine(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.machine_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResetMachine::_internal_mutable_machine() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.machine_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResetMachine::release_machine() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.ResetMachine.machine)
+  if (!_internal_has_machine()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.machine_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_.IsDefault()) {
+    _impl_.machine_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResetMachine::set_allocated_machine(std::string* machine) {
+  if (machine != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.machine_.SetAllocated(machine, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_.IsDefault()) {
+    _impl_.machine_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.ResetMachine.machine)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::PrepareMachine_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::PrepareMachine_CompType>() {
+  return ::llsf_msgs::PrepareMachine_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::ResetMachine_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::ResetMachine_CompType>() {
+  return ::llsf_msgs::ResetMachine_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::MachineSide> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::MachineSide>() {
+  return ::llsf_msgs::MachineSide_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_MachineInstructions_2eproto
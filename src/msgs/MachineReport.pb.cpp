@@ -0,0 +1,1013 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MachineReport.proto
+
+#include "MachineReport.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR MachineReportEntry::MachineReportEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.rotation_)*/0u
+  , /*decltype(_impl_.zone_)*/18} {}
+struct MachineReportEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MachineReportEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MachineReportEntryDefaultTypeInternal() {}
+  union {
+    MachineReportEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MachineReportEntryDefaultTypeInternal _MachineReportEntry_default_instance_;
+PROTOBUF_CONSTEXPR MachineReport::MachineReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.machines_)*/{}
+  , /*decltype(_impl_.team_color_)*/0} {}
+struct MachineReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MachineReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MachineReportDefaultTypeInternal() {}
+  union {
+    MachineReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MachineReportDefaultTypeInternal _MachineReport_default_instance_;
+PROTOBUF_CONSTEXPR MachineReportInfo::MachineReportInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reported_machines_)*/{}
+  , /*decltype(_impl_.team_color_)*/0} {}
+struct MachineReportInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MachineReportInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MachineReportInfoDefaultTypeInternal() {}
+  union {
+    MachineReportInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MachineReportInfoDefaultTypeInternal _MachineReportInfo_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_MachineReport_2eproto[3];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_MachineReport_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_MachineReport_2eproto = nullptr;
+
+const uint32_t TableStruct_MachineReport_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReportEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReportEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReportEntry, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReportEntry, _impl_.zone_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReportEntry, _impl_.rotation_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReport, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReport, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReport, _impl_.team_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReport, _impl_.machines_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReportInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReportInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReportInfo, _impl_.reported_machines_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::MachineReportInfo, _impl_.team_color_),
+  ~0u,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::llsf_msgs::MachineReportEntry)},
+  { 12, 20, -1, sizeof(::llsf_msgs::MachineReport)},
+  { 22, 30, -1, sizeof(::llsf_msgs::MachineReportInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_MachineReportEntry_default_instance_._instance,
+  &::llsf_msgs::_MachineReport_default_instance_._instance,
+  &::llsf_msgs::_MachineReportInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_MachineReport_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\023MachineReport.proto\022\tllsf_msgs\032\nTeam.p"
+  "roto\032\nZone.proto\"{\n\022MachineReportEntry\022\014"
+  "\n\004name\030\001 \002(\t\022\035\n\004zone\030\003 \001(\0162\017.llsf_msgs.Z"
+  "one\022\020\n\010rotation\030\004 \001(\r\"&\n\010CompType\022\014\n\007COM"
+  "P_ID\020\320\017\022\014\n\010MSG_TYPE\020<\"\215\001\n\rMachineReport\022"
+  "#\n\nteam_color\030\002 \002(\0162\017.llsf_msgs.Team\022/\n\010"
+  "machines\030\001 \003(\0132\035.llsf_msgs.MachineReport"
+  "Entry\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_T"
+  "YPE\020=\"{\n\021MachineReportInfo\022\031\n\021reported_m"
+  "achines\030\001 \003(\t\022#\n\nteam_color\030\002 \002(\0162\017.llsf"
+  "_msgs.Team\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010"
+  "MSG_TYPE\020>B6\n\037org.robocup_logistics.llsf"
+  "_msgsB\023MachineReportProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_MachineReport_2eproto_deps[2] = {
+  &::descriptor_table_Team_2eproto,
+  &::descriptor_table_Zone_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_MachineReport_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_MachineReport_2eproto = {
+    false, false, 506, descriptor_table_protodef_MachineReport_2eproto,
+    "MachineReport.proto",
+    &descriptor_table_MachineReport_2eproto_once, descriptor_table_MachineReport_2eproto_deps, 2, 3,
+    schemas, file_default_instances, TableStruct_MachineReport_2eproto::offsets,
+    file_level_metadata_MachineReport_2eproto, file_level_enum_descriptors_MachineReport_2eproto,
+    file_level_service_descriptors_MachineReport_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_MachineReport_2eproto_getter() {
+  return &descriptor_table_MachineReport_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_MachineReport_2eproto(&descriptor_table_MachineReport_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineReportEntry_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineReport_2eproto);
+  return file_level_enum_descriptors_MachineReport_2eproto[0];
+}
+bool MachineReportEntry_CompType_IsValid(int value) {
+  switch (value) {
+    case 60:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr MachineReportEntry_CompType MachineReportEntry::COMP_ID;
+constexpr MachineReportEntry_CompType MachineReportEntry::MSG_TYPE;
+constexpr MachineReportEntry_CompType MachineReportEntry::CompType_MIN;
+constexpr MachineReportEntry_CompType MachineReportEntry::CompType_MAX;
+constexpr int MachineReportEntry::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineReport_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineReport_2eproto);
+  return file_level_enum_descriptors_MachineReport_2eproto[1];
+}
+bool MachineReport_CompType_IsValid(int value) {
+  switch (value) {
+    case 61:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr MachineReport_CompType MachineReport::COMP_ID;
+constexpr MachineReport_CompType MachineReport::MSG_TYPE;
+constexpr MachineReport_CompType MachineReport::CompType_MIN;
+constexpr MachineReport_CompType MachineReport::CompType_MAX;
+constexpr int MachineReport::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineReportInfo_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_MachineReport_2eproto);
+  return file_level_enum_descriptors_MachineReport_2eproto[2];
+}
+bool MachineReportInfo_CompType_IsValid(int value) {
+  switch (value) {
+    case 62:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr MachineReportInfo_CompType MachineReportInfo::COMP_ID;
+constexpr MachineReportInfo_CompType MachineReportInfo::MSG_TYPE;
+constexpr MachineReportInfo_CompType MachineReportInfo::CompType_MIN;
+constexpr MachineReportInfo_CompType MachineReportInfo::CompType_MAX;
+constexpr int MachineReportInfo::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class MachineReportEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MachineReportEntry>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_zone(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_rotation(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+MachineReportEntry::MachineReportEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.MachineReportEntry)
+}
+MachineReportEntry::MachineReportEntry(const MachineReportEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MachineReportEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.rotation_){}
+    , decltype(_impl_.zone_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.rotation_, &from._impl_.rotation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.zone_) -
+    reinterpret_cast<char*>(&_impl_.rotation_)) + sizeof(_impl_.zone_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.MachineReportEntry)
+}
+
+inline void MachineReportEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.rotation_){0u}
+    , decltype(_impl_.zone_){18}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MachineReportEntry::~MachineReportEntry() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.MachineReportEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MachineReportEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void MachineReportEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MachineReportEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.MachineReportEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    _impl_.rotation_ = 0u;
+    _impl_.zone_ = 18;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MachineReportEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.MachineReportEntry.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Zone zone = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Zone_IsValid(val))) {
+            _internal_set_zone(static_cast<::llsf_msgs::Zone>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 rotation = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_rotation(&has_bits);
+          _impl_.rotation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MachineReportEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.MachineReportEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.MachineReportEntry.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional .llsf_msgs.Zone zone = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_zone(), target);
+  }
+
+  // optional uint32 rotation = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_rotation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.MachineReportEntry)
+  return target;
+}
+
+size_t MachineReportEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.MachineReportEntry)
+  size_t total_size = 0;
+
+  // required string name = 1;
+  if (_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional uint32 rotation = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_rotation());
+    }
+
+    // optional .llsf_msgs.Zone zone = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_zone());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MachineReportEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MachineReportEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MachineReportEntry::GetClassData() const { return &_class_data_; }
+
+
+void MachineReportEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MachineReportEntry*>(&to_msg);
+  auto& from = static_cast<const MachineReportEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.MachineReportEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.rotation_ = from._impl_.rotation_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.zone_ = from._impl_.zone_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MachineReportEntry::CopyFrom(const MachineReportEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.MachineReportEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MachineReportEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void MachineReportEntry::InternalSwap(MachineReportEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.rotation_, other->_impl_.rotation_);
+  swap(_impl_.zone_, other->_impl_.zone_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MachineReportEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineReport_2eproto_getter, &descriptor_table_MachineReport_2eproto_once,
+      file_level_metadata_MachineReport_2eproto[0]);
+}
+
+// ===================================================================
+
+class MachineReport::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MachineReport>()._impl_._has_bits_);
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+MachineReport::MachineReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.MachineReport)
+}
+MachineReport::MachineReport(const MachineReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MachineReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machines_){from._impl_.machines_}
+    , decltype(_impl_.team_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.team_color_ = from._impl_.team_color_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.MachineReport)
+}
+
+inline void MachineReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machines_){arena}
+    , decltype(_impl_.team_color_){0}
+  };
+}
+
+MachineReport::~MachineReport() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.MachineReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MachineReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.machines_.~RepeatedPtrField();
+}
+
+void MachineReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MachineReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.MachineReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.machines_.Clear();
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MachineReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .llsf_msgs.MachineReportEntry machines = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_machines(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.Team team_color = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MachineReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.MachineReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.MachineReportEntry machines = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_machines_size()); i < n; i++) {
+    const auto& repfield = this->_internal_machines(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Team team_color = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_team_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.MachineReport)
+  return target;
+}
+
+size_t MachineReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.MachineReport)
+  size_t total_size = 0;
+
+  // required .llsf_msgs.Team team_color = 2;
+  if (_internal_has_team_color()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.MachineReportEntry machines = 1;
+  total_size += 1UL * this->_internal_machines_size();
+  for (const auto& msg : this->_impl_.machines_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MachineReport::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MachineReport::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MachineReport::GetClassData() const { return &_class_data_; }
+
+
+void MachineReport::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MachineReport*>(&to_msg);
+  auto& from = static_cast<const MachineReport&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.MachineReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.machines_.MergeFrom(from._impl_.machines_);
+  if (from._internal_has_team_color()) {
+    _this->_internal_set_team_color(from._internal_team_color());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MachineReport::CopyFrom(const MachineReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.MachineReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MachineReport::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.machines_))
+    return false;
+  return true;
+}
+
+void MachineReport::InternalSwap(MachineReport* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.machines_.InternalSwap(&other->_impl_.machines_);
+  swap(_impl_.team_color_, other->_impl_.team_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MachineReport::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineReport_2eproto_getter, &descriptor_table_MachineReport_2eproto_once,
+      file_level_metadata_MachineReport_2eproto[1]);
+}
+
+// ===================================================================
+
+class MachineReportInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MachineReportInfo>()._impl_._has_bits_);
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+MachineReportInfo::MachineReportInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.MachineReportInfo)
+}
+MachineReportInfo::MachineReportInfo(const MachineReportInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MachineReportInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reported_machines_){from._impl_.reported_machines_}
+    , decltype(_impl_.team_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.team_color_ = from._impl_.team_color_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.MachineReportInfo)
+}
+
+inline void MachineReportInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reported_machines_){arena}
+    , decltype(_impl_.team_color_){0}
+  };
+}
+
+MachineReportInfo::~MachineReportInfo() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.MachineReportInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MachineReportInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reported_machines_.~RepeatedPtrField();
+}
+
+void MachineReportInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MachineReportInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.MachineReportInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.reported_machines_.Clear();
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MachineReportInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string reported_machines = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_reported_machines();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "llsf_msgs.MachineReportInfo.reported_machines");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.Team team_color = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MachineReportInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.MachineReportInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string reported_machines = 1;
+  for (int i = 0, n = this->_internal_reported_machines_size(); i < n; i++) {
+    const auto& s = this->_internal_reported_machines(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.MachineReportInfo.reported_machines");
+    target = stream->WriteString(1, s, target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Team team_color = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_team_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.MachineReportInfo)
+  return target;
+}
+
+size_t MachineReportInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.MachineReportInfo)
+  size_t total_size = 0;
+
+  // required .llsf_msgs.Team team_color = 2;
+  if (_internal_has_team_color()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string reported_machines = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.reported_machines_.size());
+  for (int i = 0, n = _impl_.reported_machines_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.reported_machines_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MachineReportInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MachineReportInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MachineReportInfo::GetClassData() const { return &_class_data_; }
+
+
+void MachineReportInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MachineReportInfo*>(&to_msg);
+  auto& from = static_cast<const MachineReportInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.MachineReportInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.reported_machines_.MergeFrom(from._impl_.reported_machines_);
+  if (from._internal_has_team_color()) {
+    _this->_internal_set_team_color(from._internal_team_color());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MachineReportInfo::CopyFrom(const MachineReportInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.MachineReportInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MachineReportInfo::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void MachineReportInfo::InternalSwap(MachineReportInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.reported_machines_.InternalSwap(&other->_impl_.reported_machines_);
+  swap(_impl_.team_color_, other->_impl_.team_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MachineReportInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MachineReport_2eproto_getter, &descriptor_table_MachineReport_2eproto_once,
+      file_level_metadata_MachineReport_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::MachineReportEntry*
+Arena::CreateMaybeMessage< ::llsf_msgs::MachineReportEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::MachineReportEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::MachineReport*
+Arena::CreateMaybeMessage< ::llsf_msgs::MachineReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::MachineReport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::MachineReportInfo*
+Arena::CreateMaybeMessage< ::llsf_msgs::MachineReportInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::MachineReportInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
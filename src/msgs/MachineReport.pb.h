@@ -0,0 +1,1140 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MachineReport.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_MachineReport_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_MachineReport_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Team.pb.h"
+#include "Zone.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_MachineReport_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_MachineReport_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_MachineReport_2eproto;
+namespace llsf_msgs {
+class MachineReport;
+struct MachineReportDefaultTypeInternal;
+extern MachineReportDefaultTypeInternal _MachineReport_default_instance_;
+class MachineReportEntry;
+struct MachineReportEntryDefaultTypeInternal;
+extern MachineReportEntryDefaultTypeInternal _MachineReportEntry_default_instance_;
+class MachineReportInfo;
+struct MachineReportInfoDefaultTypeInternal;
+extern MachineReportInfoDefaultTypeInternal _MachineReportInfo_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::MachineReport* Arena::CreateMaybeMessage<::llsf_msgs::MachineReport>(Arena*);
+template<> ::llsf_msgs::MachineReportEntry* Arena::CreateMaybeMessage<::llsf_msgs::MachineReportEntry>(Arena*);
+template<> ::llsf_msgs::MachineReportInfo* Arena::CreateMaybeMessage<::llsf_msgs::MachineReportInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum MachineReportEntry_CompType : int {
+  MachineReportEntry_CompType_COMP_ID = 2000,
+  MachineReportEntry_CompType_MSG_TYPE = 60
+};
+bool MachineReportEntry_CompType_IsValid(int value);
+constexpr MachineReportEntry_CompType MachineReportEntry_CompType_CompType_MIN = MachineReportEntry_CompType_MSG_TYPE;
+constexpr MachineReportEntry_CompType MachineReportEntry_CompType_CompType_MAX = MachineReportEntry_CompType_COMP_ID;
+constexpr int MachineReportEntry_CompType_CompType_ARRAYSIZE = MachineReportEntry_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineReportEntry_CompType_descriptor();
+template<typename T>
+inline const std::string& MachineReportEntry_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MachineReportEntry_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MachineReportEntry_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MachineReportEntry_CompType_descriptor(), enum_t_value);
+}
+inline bool MachineReportEntry_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MachineReportEntry_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MachineReportEntry_CompType>(
+    MachineReportEntry_CompType_descriptor(), name, value);
+}
+enum MachineReport_CompType : int {
+  MachineReport_CompType_COMP_ID = 2000,
+  MachineReport_CompType_MSG_TYPE = 61
+};
+bool MachineReport_CompType_IsValid(int value);
+constexpr MachineReport_CompType MachineReport_CompType_CompType_MIN = MachineReport_CompType_MSG_TYPE;
+constexpr MachineReport_CompType MachineReport_CompType_CompType_MAX = MachineReport_CompType_COMP_ID;
+constexpr int MachineReport_CompType_CompType_ARRAYSIZE = MachineReport_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineReport_CompType_descriptor();
+template<typename T>
+inline const std::string& MachineReport_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MachineReport_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MachineReport_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MachineReport_CompType_descriptor(), enum_t_value);
+}
+inline bool MachineReport_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MachineReport_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MachineReport_CompType>(
+    MachineReport_CompType_descriptor(), name, value);
+}
+enum MachineReportInfo_CompType : int {
+  MachineReportInfo_CompType_COMP_ID = 2000,
+  MachineReportInfo_CompType_MSG_TYPE = 62
+};
+bool MachineReportInfo_CompType_IsValid(int value);
+constexpr MachineReportInfo_CompType MachineReportInfo_CompType_CompType_MIN = MachineReportInfo_CompType_MSG_TYPE;
+constexpr MachineReportInfo_CompType MachineReportInfo_CompType_CompType_MAX = MachineReportInfo_CompType_COMP_ID;
+constexpr int MachineReportInfo_CompType_CompType_ARRAYSIZE = MachineReportInfo_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MachineReportInfo_CompType_descriptor();
+template<typename T>
+inline const std::string& MachineReportInfo_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MachineReportInfo_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MachineReportInfo_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MachineReportInfo_CompType_descriptor(), enum_t_value);
+}
+inline bool MachineReportInfo_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MachineReportInfo_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MachineReportInfo_CompType>(
+    MachineReportInfo_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class MachineReportEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.MachineReportEntry) */ {
+ public:
+  inline MachineReportEntry() : MachineReportEntry(nullptr) {}
+  ~MachineReportEntry() override;
+  explicit PROTOBUF_CONSTEXPR MachineReportEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MachineReportEntry(const MachineReportEntry& from);
+  MachineReportEntry(MachineReportEntry&& from) noexcept
+    : MachineReportEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline MachineReportEntry& operator=(const MachineReportEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MachineReportEntry& operator=(MachineReportEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MachineReportEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MachineReportEntry* internal_default_instance() {
+    return reinterpret_cast<const MachineReportEntry*>(
+               &_MachineReportEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(MachineReportEntry& a, MachineReportEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MachineReportEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MachineReportEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MachineReportEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MachineReportEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MachineReportEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MachineReportEntry& from) {
+    MachineReportEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MachineReportEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.MachineReportEntry";
+  }
+  protected:
+  explicit MachineReportEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MachineReportEntry_CompType CompType;
+  static constexpr CompType COMP_ID =
+    MachineReportEntry_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    MachineReportEntry_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return MachineReportEntry_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    MachineReportEntry_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    MachineReportEntry_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    MachineReportEntry_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return MachineReportEntry_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return MachineReportEntry_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return MachineReportEntry_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kRotationFieldNumber = 4,
+    kZoneFieldNumber = 3,
+  };
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional uint32 rotation = 4;
+  bool has_rotation() const;
+  private:
+  bool _internal_has_rotation() const;
+  public:
+  void clear_rotation();
+  uint32_t rotation() const;
+  void set_rotation(uint32_t value);
+  private:
+  uint32_t _internal_rotation() const;
+  void _internal_set_rotation(uint32_t value);
+  public:
+
+  // optional .llsf_msgs.Zone zone = 3;
+  bool has_zone() const;
+  private:
+  bool _internal_has_zone() const;
+  public:
+  void clear_zone();
+  ::llsf_msgs::Zone zone() const;
+  void set_zone(::llsf_msgs::Zone value);
+  private:
+  ::llsf_msgs::Zone _internal_zone() const;
+  void _internal_set_zone(::llsf_msgs::Zone value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.MachineReportEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t rotation_;
+    int zone_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineReport_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MachineReport final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.MachineReport) */ {
+ public:
+  inline MachineReport() : MachineReport(nullptr) {}
+  ~MachineReport() override;
+  explicit PROTOBUF_CONSTEXPR MachineReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MachineReport(const MachineReport& from);
+  MachineReport(MachineReport&& from) noexcept
+    : MachineReport() {
+    *this = ::std::move(from);
+  }
+
+  inline MachineReport& operator=(const MachineReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MachineReport& operator=(MachineReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MachineReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MachineReport* internal_default_instance() {
+    return reinterpret_cast<const MachineReport*>(
+               &_MachineReport_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(MachineReport& a, MachineReport& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MachineReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MachineReport* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MachineReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MachineReport>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MachineReport& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MachineReport& from) {
+    MachineReport::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MachineReport* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.MachineReport";
+  }
+  protected:
+  explicit MachineReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MachineReport_CompType CompType;
+  static constexpr CompType COMP_ID =
+    MachineReport_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    MachineReport_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return MachineReport_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    MachineReport_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    MachineReport_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    MachineReport_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return MachineReport_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return MachineReport_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return MachineReport_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMachinesFieldNumber = 1,
+    kTeamColorFieldNumber = 2,
+  };
+  // repeated .llsf_msgs.MachineReportEntry machines = 1;
+  int machines_size() const;
+  private:
+  int _internal_machines_size() const;
+  public:
+  void clear_machines();
+  ::llsf_msgs::MachineReportEntry* mutable_machines(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::MachineReportEntry >*
+      mutable_machines();
+  private:
+  const ::llsf_msgs::MachineReportEntry& _internal_machines(int index) const;
+  ::llsf_msgs::MachineReportEntry* _internal_add_machines();
+  public:
+  const ::llsf_msgs::MachineReportEntry& machines(int index) const;
+  ::llsf_msgs::MachineReportEntry* add_machines();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::MachineReportEntry >&
+      machines() const;
+
+  // required .llsf_msgs.Team team_color = 2;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.MachineReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::MachineReportEntry > machines_;
+    int team_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineReport_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MachineReportInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.MachineReportInfo) */ {
+ public:
+  inline MachineReportInfo() : MachineReportInfo(nullptr) {}
+  ~MachineReportInfo() override;
+  explicit PROTOBUF_CONSTEXPR MachineReportInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MachineReportInfo(const MachineReportInfo& from);
+  MachineReportInfo(MachineReportInfo&& from) noexcept
+    : MachineReportInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline MachineReportInfo& operator=(const MachineReportInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MachineReportInfo& operator=(MachineReportInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MachineReportInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MachineReportInfo* internal_default_instance() {
+    return reinterpret_cast<const MachineReportInfo*>(
+               &_MachineReportInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(MachineReportInfo& a, MachineReportInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MachineReportInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MachineReportInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MachineReportInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MachineReportInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MachineReportInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MachineReportInfo& from) {
+    MachineReportInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MachineReportInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.MachineReportInfo";
+  }
+  protected:
+  explicit MachineReportInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MachineReportInfo_CompType CompType;
+  static constexpr CompType COMP_ID =
+    MachineReportInfo_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    MachineReportInfo_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return MachineReportInfo_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    MachineReportInfo_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    MachineReportInfo_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    MachineReportInfo_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return MachineReportInfo_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return MachineReportInfo_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return MachineReportInfo_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReportedMachinesFieldNumber = 1,
+    kTeamColorFieldNumber = 2,
+  };
+  // repeated string reported_machines = 1;
+  int reported_machines_size() const;
+  private:
+  int _internal_reported_machines_size() const;
+  public:
+  void clear_reported_machines();
+  const std::string& reported_machines(int index) const;
+  std::string* mutable_reported_machines(int index);
+  void set_reported_machines(int index, const std::string& value);
+  void set_reported_machines(int index, std::string&& value);
+  void set_reported_machines(int index, const char* value);
+  void set_reported_machines(int index, const char* value, size_t size);
+  std::string* add_reported_machines();
+  void add_reported_machines(const std::string& value);
+  void add_reported_machines(std::string&& value);
+  void add_reported_machines(const char* value);
+  void add_reported_machines(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& reported_machines() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_reported_machines();
+  private:
+  const std::string& _internal_reported_machines(int index) const;
+  std::string* _internal_add_reported_machines();
+  public:
+
+  // required .llsf_msgs.Team team_color = 2;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.MachineReportInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> reported_machines_;
+    int team_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_MachineReport_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// MachineReportEntry
+
+// required string name = 1;
+inline bool MachineReportEntry::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MachineReportEntry::has_name() const {
+  return _internal_has_name();
+}
+inline void MachineReportEntry::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MachineReportEntry::name() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.MachineReportEntry.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MachineReportEntry::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.MachineReportEntry.name)
+}
+inline std::string* MachineReportEntry::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.MachineReportEntry.name)
+  return _s;
+}
+inline const std::string& MachineReportEntry::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MachineReportEntry::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MachineReportEntry::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MachineReportEntry::release_name() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.MachineReportEntry.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MachineReportEntry::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.MachineReportEntry.name)
+}
+
+// optional .llsf_msgs.Zone zone = 3;
+inline bool MachineReportEntry::_internal_has_zone() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MachineReportEntry::has_zone() const {
+  return _internal_has_zone();
+}
+inline void MachineReportEntry::clear_zone() {
+  _impl_.zone_ = 18;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::llsf_msgs::Zone MachineReportEntry::_internal_zone() const {
+  return static_cast< ::llsf_msgs::Zone >(_impl_.zone_);
+}
+inline ::llsf_msgs::Zone MachineReportEntry::zone() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.MachineReportEntry.zone)
+  return _internal_zone();
+}
+inline void MachineReportEntry::_internal_set_zone(::llsf_msgs::Zone value) {
+  assert(::llsf_msgs::Zone_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.zone_ = value;
+}
+inline void MachineReportEntry::set_zone(::llsf_msgs::Zone value) {
+  _internal_set_zone(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.MachineReportEntry.zone)
+}
+
+// optional uint32 rotation = 4;
+inline bool MachineReportEntry::_internal_has_rotation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MachineReportEntry::has_rotation() const {
+  return _internal_has_rotation();
+}
+inline void MachineReportEntry::clear_rotation() {
+  _impl_.rotation_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t MachineReportEntry::_internal_rotation() const {
+  return _impl_.rotation_;
+}
+inline uint32_t MachineReportEntry::rotation() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.MachineReportEntry.rotation)
+  return _internal_rotation();
+}
+inline void MachineReportEntry::_internal_set_rotation(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.rotation_ = value;
+}
+inline void MachineReportEntry::set_rotation(uint32_t value) {
+  _internal_set_rotation(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.MachineReportEntry.rotation)
+}
+
+// -------------------------------------------------------------------
+
+// MachineReport
+
+// required .llsf_msgs.Team team_color = 2;
+inline bool MachineReport::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MachineReport::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void MachineReport::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::Team MachineReport::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team MachineReport::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.MachineReport.team_color)
+  return _internal_team_color();
+}
+inline void MachineReport::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.team_color_ = value;
+}
+inline void MachineReport::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.MachineReport.team_color)
+}
+
+// repeated .llsf_msgs.MachineReportEntry machines = 1;
+inline int MachineReport::_internal_machines_size() const {
+  return _impl_.machines_.size();
+}
+inline int MachineReport::machines_size() const {
+  return _internal_machines_size();
+}
+inline void MachineReport::clear_machines() {
+  _impl_.machines_.Clear();
+}
+inline ::llsf_msgs::MachineReportEntry* MachineReport::mutable_machines(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.MachineReport.machines)
+  return _impl_.machines_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::MachineReportEntry >*
+MachineReport::mutable_machines() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.MachineReport.machines)
+  return &_impl_.machines_;
+}
+inline const ::llsf_msgs::MachineReportEntry& MachineReport::_internal_machines(int index) const {
+  return _impl_.machines_.Get(index);
+}
+inline const ::llsf_msgs::MachineReportEntry& MachineReport::machines(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.MachineReport.machines)
+  return _internal_machines(index);
+}
+inline ::llsf_msgs::MachineReportEntry* MachineReport::_internal_add_machines() {
+  return _impl_.machines_.Add();
+}
+inline ::llsf_msgs::MachineReportEntry* MachineReport::add_machines() {
+  ::llsf_msgs::MachineReportEntry* _add = _internal_add_machines();
+  // @@protoc_insertion_point(field_add:llsf_msgs.MachineReport.machines)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::MachineReportEntry >&
+MachineReport::machines() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.MachineReport.machines)
+  return _impl_.machines_;
+}
+
+// -------------------------------------------------------------------
+
+// MachineReportInfo
+
+// repeated string reported_machines = 1;
+inline int MachineReportInfo::_internal_reported_machines_size() const {
+  return _impl_.reported_machines_.size();
+}
+inline int MachineReportInfo::reported_machines_size() const {
+  return _internal_reported_machines_size();
+}
+inline void MachineReportInfo::clear_reported_machines() {
+  _impl_.reported_machines_.Clear();
+}
+inline std::string* MachineReportInfo::add_reported_machines() {
+  std::string* _s = _internal_add_reported_machines();
+  // @@protoc_insertion_point(field_add_mutable:llsf_msgs.MachineReportInfo.reported_machines)
+  return _s;
+}
+inline const std::string& MachineReportInfo::_internal_reported_machines(int index) const {
+  return _impl_.reported_machines_.Get(index);
+}
+inline const std::string& MachineReportInfo::reported_machines(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.MachineReportInfo.reported_machines)
+  return _internal_reported_machines(index);
+}
+inline std::string* MachineReportInfo::mutable_reported_machines(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.MachineReportInfo.reported_machines)
+  return _impl_.reported_machines_.Mutable(index);
+}
+inline void MachineReportInfo::set_reported_machines(int index, const std::string& value) {
+  _impl_.reported_machines_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.MachineReportInfo.reported_machines)
+}
+inline void MachineReportInfo::set_reported_machines(int index, std::string&& value) {
+  _impl_.reported_machines_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:llsf_msgs.MachineReportInfo.reported_machines)
+}
+inline void MachineReportInfo::set_reported_machines(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.reported_machines_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:llsf_msgs.MachineReportInfo.reported_machines)
+}
+inline void MachineReportInfo::set_reported_machines(int index, const char* value, size_t size) {
+  _impl_.reported_machines_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:llsf_msgs.MachineReportInfo.reported_machines)
+}
+inline std::string* MachineReportInfo::_internal_add_reported_machines() {
+  return _impl_.reported_machines_.Add();
+}
+inline void MachineReportInfo::add_reported_machines(const std::string& value) {
+  _impl_.reported_machines_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:llsf_msgs.MachineReportInfo.reported_machines)
+}
+inline void MachineReportInfo::add_reported_machines(std::string&& value) {
+  _impl_.reported_machines_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:llsf_msgs.MachineReportInfo.reported_machines)
+}
+inline void MachineReportInfo::add_reported_machines(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.reported_machines_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:llsf_msgs.MachineReportInfo.reported_machines)
+}
+inline void MachineReportInfo::add_reported_machines(const char* value, size_t size) {
+  _impl_.reported_machines_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:llsf_msgs.MachineReportInfo.reported_machines)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MachineReportInfo::reported_machines() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.MachineReportInfo.reported_machines)
+  return _impl_.reported_machines_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MachineReportInfo::mutable_reported_machines() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.MachineReportInfo.reported_machines)
+  return &_impl_.reported_machines_;
+}
+
+// required .llsf_msgs.Team team_color = 2;
+inline bool MachineReportInfo::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MachineReportInfo::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void MachineReportInfo::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::Team MachineReportInfo::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team MachineReportInfo::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.MachineReportInfo.team_color)
+  return _internal_team_color();
+}
+inline void MachineReportInfo::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.team_color_ = value;
+}
+inline void MachineReportInfo::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.MachineReportInfo.team_color)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::MachineReportEntry_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::MachineReportEntry_CompType>() {
+  return ::llsf_msgs::MachineReportEntry_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::MachineReport_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::MachineReport_CompType>() {
+  return ::llsf_msgs::MachineReport_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::MachineReportInfo_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::MachineReportInfo_CompType>() {
+  return ::llsf_msgs::MachineReportInfo_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_MachineReport_2eproto
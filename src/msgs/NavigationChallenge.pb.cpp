@@ -0,0 +1,725 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: NavigationChallenge.proto
+
+#include "NavigationChallenge.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR Route::Route(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.route_)*/{}
+  , /*decltype(_impl_.reached_)*/{}
+  , /*decltype(_impl_.remaining_)*/{}
+  , /*decltype(_impl_.id_)*/0u} {}
+struct RouteDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RouteDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RouteDefaultTypeInternal() {}
+  union {
+    Route _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouteDefaultTypeInternal _Route_default_instance_;
+PROTOBUF_CONSTEXPR NavigationRoutes::NavigationRoutes(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.routes_)*/{}
+  , /*decltype(_impl_.team_color_)*/0} {}
+struct NavigationRoutesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NavigationRoutesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NavigationRoutesDefaultTypeInternal() {}
+  union {
+    NavigationRoutes _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NavigationRoutesDefaultTypeInternal _NavigationRoutes_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_NavigationChallenge_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_NavigationChallenge_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_NavigationChallenge_2eproto = nullptr;
+
+const uint32_t TableStruct_NavigationChallenge_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Route, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Route, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Route, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Route, _impl_.route_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Route, _impl_.reached_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Route, _impl_.remaining_),
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::NavigationRoutes, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::NavigationRoutes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::NavigationRoutes, _impl_.team_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::NavigationRoutes, _impl_.routes_),
+  0,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::llsf_msgs::Route)},
+  { 14, 22, -1, sizeof(::llsf_msgs::NavigationRoutes)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_Route_default_instance_._instance,
+  &::llsf_msgs::_NavigationRoutes_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_NavigationChallenge_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\031NavigationChallenge.proto\022\tllsf_msgs\032\n"
+  "Team.proto\032\nZone.proto\"y\n\005Route\022\n\n\002id\030\001 "
+  "\002(\r\022\036\n\005route\030\002 \003(\0162\017.llsf_msgs.Zone\022 \n\007r"
+  "eached\030\003 \003(\0162\017.llsf_msgs.Zone\022\"\n\tremaini"
+  "ng\030\004 \003(\0162\017.llsf_msgs.Zone\"\202\001\n\020Navigation"
+  "Routes\022#\n\nteam_color\030\001 \002(\0162\017.llsf_msgs.T"
+  "eam\022 \n\006routes\030\005 \003(\0132\020.llsf_msgs.Route\"\'\n"
+  "\010CompType\022\014\n\007COMP_ID\020\320\017\022\r\n\010MSG_TYPE\020\372\001B<"
+  "\n\037org.robocup_logistics.llsf_msgsB\031Navig"
+  "ationChallengeProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_NavigationChallenge_2eproto_deps[2] = {
+  &::descriptor_table_Team_2eproto,
+  &::descriptor_table_Zone_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_NavigationChallenge_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_NavigationChallenge_2eproto = {
+    false, false, 380, descriptor_table_protodef_NavigationChallenge_2eproto,
+    "NavigationChallenge.proto",
+    &descriptor_table_NavigationChallenge_2eproto_once, descriptor_table_NavigationChallenge_2eproto_deps, 2, 2,
+    schemas, file_default_instances, TableStruct_NavigationChallenge_2eproto::offsets,
+    file_level_metadata_NavigationChallenge_2eproto, file_level_enum_descriptors_NavigationChallenge_2eproto,
+    file_level_service_descriptors_NavigationChallenge_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_NavigationChallenge_2eproto_getter() {
+  return &descriptor_table_NavigationChallenge_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_NavigationChallenge_2eproto(&descriptor_table_NavigationChallenge_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NavigationRoutes_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_NavigationChallenge_2eproto);
+  return file_level_enum_descriptors_NavigationChallenge_2eproto[0];
+}
+bool NavigationRoutes_CompType_IsValid(int value) {
+  switch (value) {
+    case 250:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr NavigationRoutes_CompType NavigationRoutes::COMP_ID;
+constexpr NavigationRoutes_CompType NavigationRoutes::MSG_TYPE;
+constexpr NavigationRoutes_CompType NavigationRoutes::CompType_MIN;
+constexpr NavigationRoutes_CompType NavigationRoutes::CompType_MAX;
+constexpr int NavigationRoutes::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Route::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Route>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+Route::Route(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.Route)
+}
+Route::Route(const Route& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Route* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.route_){from._impl_.route_}
+    , decltype(_impl_.reached_){from._impl_.reached_}
+    , decltype(_impl_.remaining_){from._impl_.remaining_}
+    , decltype(_impl_.id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.Route)
+}
+
+inline void Route::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.route_){arena}
+    , decltype(_impl_.reached_){arena}
+    , decltype(_impl_.remaining_){arena}
+    , decltype(_impl_.id_){0u}
+  };
+}
+
+Route::~Route() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.Route)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Route::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.route_.~RepeatedField();
+  _impl_.reached_.~RepeatedField();
+  _impl_.remaining_.~RepeatedField();
+}
+
+void Route::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Route::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.Route)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.route_.Clear();
+  _impl_.reached_.Clear();
+  _impl_.remaining_.Clear();
+  _impl_.id_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Route::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.Zone route = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Zone_IsValid(val))) {
+              _internal_add_route(static_cast<::llsf_msgs::Zone>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<16>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_route(), ptr, ctx, ::llsf_msgs::Zone_IsValid, &_internal_metadata_, 2);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.Zone reached = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Zone_IsValid(val))) {
+              _internal_add_reached(static_cast<::llsf_msgs::Zone>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_reached(), ptr, ctx, ::llsf_msgs::Zone_IsValid, &_internal_metadata_, 3);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.Zone remaining = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Zone_IsValid(val))) {
+              _internal_add_remaining(static_cast<::llsf_msgs::Zone>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<32>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_remaining(), ptr, ctx, ::llsf_msgs::Zone_IsValid, &_internal_metadata_, 4);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Route::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.Route)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // repeated .llsf_msgs.Zone route = 2;
+  for (int i = 0, n = this->_internal_route_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        2, this->_internal_route(i), target);
+  }
+
+  // repeated .llsf_msgs.Zone reached = 3;
+  for (int i = 0, n = this->_internal_reached_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        3, this->_internal_reached(i), target);
+  }
+
+  // repeated .llsf_msgs.Zone remaining = 4;
+  for (int i = 0, n = this->_internal_remaining_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        4, this->_internal_remaining(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.Route)
+  return target;
+}
+
+size_t Route::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.Route)
+  size_t total_size = 0;
+
+  // required uint32 id = 1;
+  if (_internal_has_id()) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Zone route = 2;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_route_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_route(static_cast<int>(i)));
+    }
+    total_size += (1UL * count) + data_size;
+  }
+
+  // repeated .llsf_msgs.Zone reached = 3;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_reached_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_reached(static_cast<int>(i)));
+    }
+    total_size += (1UL * count) + data_size;
+  }
+
+  // repeated .llsf_msgs.Zone remaining = 4;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_remaining_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_remaining(static_cast<int>(i)));
+    }
+    total_size += (1UL * count) + data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Route::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Route::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Route::GetClassData() const { return &_class_data_; }
+
+
+void Route::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Route*>(&to_msg);
+  auto& from = static_cast<const Route&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.Route)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.route_.MergeFrom(from._impl_.route_);
+  _this->_impl_.reached_.MergeFrom(from._impl_.reached_);
+  _this->_impl_.remaining_.MergeFrom(from._impl_.remaining_);
+  if (from._internal_has_id()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Route::CopyFrom(const Route& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.Route)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Route::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Route::InternalSwap(Route* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.route_.InternalSwap(&other->_impl_.route_);
+  _impl_.reached_.InternalSwap(&other->_impl_.reached_);
+  _impl_.remaining_.InternalSwap(&other->_impl_.remaining_);
+  swap(_impl_.id_, other->_impl_.id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Route::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NavigationChallenge_2eproto_getter, &descriptor_table_NavigationChallenge_2eproto_once,
+      file_level_metadata_NavigationChallenge_2eproto[0]);
+}
+
+// ===================================================================
+
+class NavigationRoutes::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NavigationRoutes>()._impl_._has_bits_);
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+NavigationRoutes::NavigationRoutes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.NavigationRoutes)
+}
+NavigationRoutes::NavigationRoutes(const NavigationRoutes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NavigationRoutes* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.routes_){from._impl_.routes_}
+    , decltype(_impl_.team_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.team_color_ = from._impl_.team_color_;
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.NavigationRoutes)
+}
+
+inline void NavigationRoutes::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.routes_){arena}
+    , decltype(_impl_.team_color_){0}
+  };
+}
+
+NavigationRoutes::~NavigationRoutes() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.NavigationRoutes)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NavigationRoutes::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.routes_.~RepeatedPtrField();
+}
+
+void NavigationRoutes::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NavigationRoutes::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.NavigationRoutes)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.routes_.Clear();
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NavigationRoutes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.Team team_color = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.Route routes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_routes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NavigationRoutes::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.NavigationRoutes)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Team team_color = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_team_color(), target);
+  }
+
+  // repeated .llsf_msgs.Route routes = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_routes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_routes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.NavigationRoutes)
+  return target;
+}
+
+size_t NavigationRoutes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.NavigationRoutes)
+  size_t total_size = 0;
+
+  // required .llsf_msgs.Team team_color = 1;
+  if (_internal_has_team_color()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Route routes = 5;
+  total_size += 1UL * this->_internal_routes_size();
+  for (const auto& msg : this->_impl_.routes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NavigationRoutes::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NavigationRoutes::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NavigationRoutes::GetClassData() const { return &_class_data_; }
+
+
+void NavigationRoutes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NavigationRoutes*>(&to_msg);
+  auto& from = static_cast<const NavigationRoutes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.NavigationRoutes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.routes_.MergeFrom(from._impl_.routes_);
+  if (from._internal_has_team_color()) {
+    _this->_internal_set_team_color(from._internal_team_color());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NavigationRoutes::CopyFrom(const NavigationRoutes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.NavigationRoutes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NavigationRoutes::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.routes_))
+    return false;
+  return true;
+}
+
+void NavigationRoutes::InternalSwap(NavigationRoutes* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.routes_.InternalSwap(&other->_impl_.routes_);
+  swap(_impl_.team_color_, other->_impl_.team_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NavigationRoutes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NavigationChallenge_2eproto_getter, &descriptor_table_NavigationChallenge_2eproto_once,
+      file_level_metadata_NavigationChallenge_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::Route*
+Arena::CreateMaybeMessage< ::llsf_msgs::Route >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::Route >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::NavigationRoutes*
+Arena::CreateMaybeMessage< ::llsf_msgs::NavigationRoutes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::NavigationRoutes >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
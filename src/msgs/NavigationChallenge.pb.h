@@ -0,0 +1,784 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: NavigationChallenge.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_NavigationChallenge_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_NavigationChallenge_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Team.pb.h"
+#include "Zone.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_NavigationChallenge_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_NavigationChallenge_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_NavigationChallenge_2eproto;
+namespace llsf_msgs {
+class NavigationRoutes;
+struct NavigationRoutesDefaultTypeInternal;
+extern NavigationRoutesDefaultTypeInternal _NavigationRoutes_default_instance_;
+class Route;
+struct RouteDefaultTypeInternal;
+extern RouteDefaultTypeInternal _Route_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::NavigationRoutes* Arena::CreateMaybeMessage<::llsf_msgs::NavigationRoutes>(Arena*);
+template<> ::llsf_msgs::Route* Arena::CreateMaybeMessage<::llsf_msgs::Route>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum NavigationRoutes_CompType : int {
+  NavigationRoutes_CompType_COMP_ID = 2000,
+  NavigationRoutes_CompType_MSG_TYPE = 250
+};
+bool NavigationRoutes_CompType_IsValid(int value);
+constexpr NavigationRoutes_CompType NavigationRoutes_CompType_CompType_MIN = NavigationRoutes_CompType_MSG_TYPE;
+constexpr NavigationRoutes_CompType NavigationRoutes_CompType_CompType_MAX = NavigationRoutes_CompType_COMP_ID;
+constexpr int NavigationRoutes_CompType_CompType_ARRAYSIZE = NavigationRoutes_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NavigationRoutes_CompType_descriptor();
+template<typename T>
+inline const std::string& NavigationRoutes_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, NavigationRoutes_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function NavigationRoutes_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    NavigationRoutes_CompType_descriptor(), enum_t_value);
+}
+inline bool NavigationRoutes_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, NavigationRoutes_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<NavigationRoutes_CompType>(
+    NavigationRoutes_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class Route final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.Route) */ {
+ public:
+  inline Route() : Route(nullptr) {}
+  ~Route() override;
+  explicit PROTOBUF_CONSTEXPR Route(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Route(const Route& from);
+  Route(Route&& from) noexcept
+    : Route() {
+    *this = ::std::move(from);
+  }
+
+  inline Route& operator=(const Route& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Route& operator=(Route&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Route& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Route* internal_default_instance() {
+    return reinterpret_cast<const Route*>(
+               &_Route_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Route& a, Route& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Route* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Route* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Route* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Route>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Route& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Route& from) {
+    Route::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Route* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.Route";
+  }
+  protected:
+  explicit Route(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRouteFieldNumber = 2,
+    kReachedFieldNumber = 3,
+    kRemainingFieldNumber = 4,
+    kIdFieldNumber = 1,
+  };
+  // repeated .llsf_msgs.Zone route = 2;
+  int route_size() const;
+  private:
+  int _internal_route_size() const;
+  public:
+  void clear_route();
+  private:
+  ::llsf_msgs::Zone _internal_route(int index) const;
+  void _internal_add_route(::llsf_msgs::Zone value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_route();
+  public:
+  ::llsf_msgs::Zone route(int index) const;
+  void set_route(int index, ::llsf_msgs::Zone value);
+  void add_route(::llsf_msgs::Zone value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& route() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_route();
+
+  // repeated .llsf_msgs.Zone reached = 3;
+  int reached_size() const;
+  private:
+  int _internal_reached_size() const;
+  public:
+  void clear_reached();
+  private:
+  ::llsf_msgs::Zone _internal_reached(int index) const;
+  void _internal_add_reached(::llsf_msgs::Zone value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_reached();
+  public:
+  ::llsf_msgs::Zone reached(int index) const;
+  void set_reached(int index, ::llsf_msgs::Zone value);
+  void add_reached(::llsf_msgs::Zone value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& reached() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_reached();
+
+  // repeated .llsf_msgs.Zone remaining = 4;
+  int remaining_size() const;
+  private:
+  int _internal_remaining_size() const;
+  public:
+  void clear_remaining();
+  private:
+  ::llsf_msgs::Zone _internal_remaining(int index) const;
+  void _internal_add_remaining(::llsf_msgs::Zone value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_remaining();
+  public:
+  ::llsf_msgs::Zone remaining(int index) const;
+  void set_remaining(int index, ::llsf_msgs::Zone value);
+  void add_remaining(::llsf_msgs::Zone value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& remaining() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_remaining();
+
+  // required uint32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.Route)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> route_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> reached_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> remaining_;
+    uint32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NavigationChallenge_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NavigationRoutes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.NavigationRoutes) */ {
+ public:
+  inline NavigationRoutes() : NavigationRoutes(nullptr) {}
+  ~NavigationRoutes() override;
+  explicit PROTOBUF_CONSTEXPR NavigationRoutes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NavigationRoutes(const NavigationRoutes& from);
+  NavigationRoutes(NavigationRoutes&& from) noexcept
+    : NavigationRoutes() {
+    *this = ::std::move(from);
+  }
+
+  inline NavigationRoutes& operator=(const NavigationRoutes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NavigationRoutes& operator=(NavigationRoutes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NavigationRoutes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NavigationRoutes* internal_default_instance() {
+    return reinterpret_cast<const NavigationRoutes*>(
+               &_NavigationRoutes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(NavigationRoutes& a, NavigationRoutes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NavigationRoutes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NavigationRoutes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NavigationRoutes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NavigationRoutes>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NavigationRoutes& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NavigationRoutes& from) {
+    NavigationRoutes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NavigationRoutes* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.NavigationRoutes";
+  }
+  protected:
+  explicit NavigationRoutes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef NavigationRoutes_CompType CompType;
+  static constexpr CompType COMP_ID =
+    NavigationRoutes_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    NavigationRoutes_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return NavigationRoutes_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    NavigationRoutes_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    NavigationRoutes_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    NavigationRoutes_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return NavigationRoutes_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return NavigationRoutes_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return NavigationRoutes_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoutesFieldNumber = 5,
+    kTeamColorFieldNumber = 1,
+  };
+  // repeated .llsf_msgs.Route routes = 5;
+  int routes_size() const;
+  private:
+  int _internal_routes_size() const;
+  public:
+  void clear_routes();
+  ::llsf_msgs::Route* mutable_routes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Route >*
+      mutable_routes();
+  private:
+  const ::llsf_msgs::Route& _internal_routes(int index) const;
+  ::llsf_msgs::Route* _internal_add_routes();
+  public:
+  const ::llsf_msgs::Route& routes(int index) const;
+  ::llsf_msgs::Route* add_routes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Route >&
+      routes() const;
+
+  // required .llsf_msgs.Team team_color = 1;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.NavigationRoutes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Route > routes_;
+    int team_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NavigationChallenge_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Route
+
+// required uint32 id = 1;
+inline bool Route::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Route::has_id() const {
+  return _internal_has_id();
+}
+inline void Route::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t Route::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Route::id() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Route.id)
+  return _internal_id();
+}
+inline void Route::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void Route::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Route.id)
+}
+
+// repeated .llsf_msgs.Zone route = 2;
+inline int Route::_internal_route_size() const {
+  return _impl_.route_.size();
+}
+inline int Route::route_size() const {
+  return _internal_route_size();
+}
+inline void Route::clear_route() {
+  _impl_.route_.Clear();
+}
+inline ::llsf_msgs::Zone Route::_internal_route(int index) const {
+  return static_cast< ::llsf_msgs::Zone >(_impl_.route_.Get(index));
+}
+inline ::llsf_msgs::Zone Route::route(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Route.route)
+  return _internal_route(index);
+}
+inline void Route::set_route(int index, ::llsf_msgs::Zone value) {
+  assert(::llsf_msgs::Zone_IsValid(value));
+  _impl_.route_.Set(index, value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Route.route)
+}
+inline void Route::_internal_add_route(::llsf_msgs::Zone value) {
+  assert(::llsf_msgs::Zone_IsValid(value));
+  _impl_.route_.Add(value);
+}
+inline void Route::add_route(::llsf_msgs::Zone value) {
+  _internal_add_route(value);
+  // @@protoc_insertion_point(field_add:llsf_msgs.Route.route)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+Route::route() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.Route.route)
+  return _impl_.route_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Route::_internal_mutable_route() {
+  return &_impl_.route_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Route::mutable_route() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.Route.route)
+  return _internal_mutable_route();
+}
+
+// repeated .llsf_msgs.Zone reached = 3;
+inline int Route::_internal_reached_size() const {
+  return _impl_.reached_.size();
+}
+inline int Route::reached_size() const {
+  return _internal_reached_size();
+}
+inline void Route::clear_reached() {
+  _impl_.reached_.Clear();
+}
+inline ::llsf_msgs::Zone Route::_internal_reached(int index) const {
+  return static_cast< ::llsf_msgs::Zone >(_impl_.reached_.Get(index));
+}
+inline ::llsf_msgs::Zone Route::reached(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Route.reached)
+  return _internal_reached(index);
+}
+inline void Route::set_reached(int index, ::llsf_msgs::Zone value) {
+  assert(::llsf_msgs::Zone_IsValid(value));
+  _impl_.reached_.Set(index, value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Route.reached)
+}
+inline void Route::_internal_add_reached(::llsf_msgs::Zone value) {
+  assert(::llsf_msgs::Zone_IsValid(value));
+  _impl_.reached_.Add(value);
+}
+inline void Route::add_reached(::llsf_msgs::Zone value) {
+  _internal_add_reached(value);
+  // @@protoc_insertion_point(field_add:llsf_msgs.Route.reached)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+Route::reached() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.Route.reached)
+  return _impl_.reached_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Route::_internal_mutable_reached() {
+  return &_impl_.reached_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Route::mutable_reached() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.Route.reached)
+  return _internal_mutable_reached();
+}
+
+// repeated .llsf_msgs.Zone remaining = 4;
+inline int Route::_internal_remaining_size() const {
+  return _impl_.remaining_.size();
+}
+inline int Route::remaining_size() const {
+  return _internal_remaining_size();
+}
+inline void Route::clear_remaining() {
+  _impl_.remaining_.Clear();
+}
+inline ::llsf_msgs::Zone Route::_internal_remaining(int index) const {
+  return static_cast< ::llsf_msgs::Zone >(_impl_.remaining_.Get(index));
+}
+inline ::llsf_msgs::Zone Route::remaining(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Route.remaining)
+  return _internal_remaining(index);
+}
+inline void Route::set_remaining(int index, ::llsf_msgs::Zone value) {
+  assert(::llsf_msgs::Zone_IsValid(value));
+  _impl_.remaining_.Set(index, value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Route.remaining)
+}
+inline void Route::_internal_add_remaining(::llsf_msgs::Zone value) {
+  assert(::llsf_msgs::Zone_IsValid(value));
+  _impl_.remaining_.Add(value);
+}
+inline void Route::add_remaining(::llsf_msgs::Zone value) {
+  _internal_add_remaining(value);
+  // @@protoc_insertion_point(field_add:llsf_msgs.Route.remaining)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+Route::remaining() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.Route.remaining)
+  return _impl_.remaining_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Route::_internal_mutable_remaining() {
+  return &_impl_.remaining_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Route::mutable_remaining() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.Route.remaining)
+  return _internal_mutable_remaining();
+}
+
+// -------------------------------------------------------------------
+
+// NavigationRoutes
+
+// required .llsf_msgs.Team team_color = 1;
+inline bool NavigationRoutes::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool NavigationRoutes::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void NavigationRoutes::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::Team NavigationRoutes::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team NavigationRoutes::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.NavigationRoutes.team_color)
+  return _internal_team_color();
+}
+inline void NavigationRoutes::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.team_color_ = value;
+}
+inline void NavigationRoutes::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.NavigationRoutes.team_color)
+}
+
+// repeated .llsf_msgs.Route routes = 5;
+inline int NavigationRoutes::_internal_routes_size() const {
+  return _impl_.routes_.size();
+}
+inline int NavigationRoutes::routes_size() const {
+  return _internal_routes_size();
+}
+inline void NavigationRoutes::clear_routes() {
+  _impl_.routes_.Clear();
+}
+inline ::llsf_msgs::Route* NavigationRoutes::mutable_routes(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.NavigationRoutes.routes)
+  return _impl_.routes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Route >*
+NavigationRoutes::mutable_routes() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.NavigationRoutes.routes)
+  return &_impl_.routes_;
+}
+inline const ::llsf_msgs::Route& NavigationRoutes::_internal_routes(int index) const {
+  return _impl_.routes_.Get(index);
+}
+inline const ::llsf_msgs::Route& NavigationRoutes::routes(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.NavigationRoutes.routes)
+  return _internal_routes(index);
+}
+inline ::llsf_msgs::Route* NavigationRoutes::_internal_add_routes() {
+  return _impl_.routes_.Add();
+}
+inline ::llsf_msgs::Route* NavigationRoutes::add_routes() {
+  ::llsf_msgs::Route* _add = _internal_add_routes();
+  // @@protoc_insertion_point(field_add:llsf_msgs.NavigationRoutes.routes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Route >&
+NavigationRoutes::routes() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.NavigationRoutes.routes)
+  return _impl_.routes_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::NavigationRoutes_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::NavigationRoutes_CompType>() {
+  return ::llsf_msgs::NavigationRoutes_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_NavigationChallenge_2eproto
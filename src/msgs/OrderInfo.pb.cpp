@@ -0,0 +1,2074 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: OrderInfo.proto
+
+#include "OrderInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR UnconfirmedDelivery::UnconfirmedDelivery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.delivery_time_)*/nullptr
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.team_)*/0} {}
+struct UnconfirmedDeliveryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnconfirmedDeliveryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnconfirmedDeliveryDefaultTypeInternal() {}
+  union {
+    UnconfirmedDelivery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnconfirmedDeliveryDefaultTypeInternal _UnconfirmedDelivery_default_instance_;
+PROTOBUF_CONSTEXPR Order::Order(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ring_colors_)*/{}
+  , /*decltype(_impl_.unconfirmed_deliveries_)*/{}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.complexity_)*/0
+  , /*decltype(_impl_.quantity_requested_)*/0u
+  , /*decltype(_impl_.quantity_delivered_cyan_)*/0u
+  , /*decltype(_impl_.quantity_delivered_magenta_)*/0u
+  , /*decltype(_impl_.delivery_period_begin_)*/0u
+  , /*decltype(_impl_.delivery_period_end_)*/0u
+  , /*decltype(_impl_.delivery_gate_)*/0u
+  , /*decltype(_impl_.competitive_)*/false
+  , /*decltype(_impl_.base_color_)*/1
+  , /*decltype(_impl_.cap_color_)*/1} {}
+struct OrderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OrderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OrderDefaultTypeInternal() {}
+  union {
+    Order _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderDefaultTypeInternal _Order_default_instance_;
+PROTOBUF_CONSTEXPR OrderInfo::OrderInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.orders_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OrderInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OrderInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OrderInfoDefaultTypeInternal() {}
+  union {
+    OrderInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrderInfoDefaultTypeInternal _OrderInfo_default_instance_;
+PROTOBUF_CONSTEXPR SetOrderDelivered::SetOrderDelivered(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.team_color_)*/0
+  , /*decltype(_impl_.order_id_)*/0u} {}
+struct SetOrderDeliveredDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetOrderDeliveredDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetOrderDeliveredDefaultTypeInternal() {}
+  union {
+    SetOrderDelivered _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetOrderDeliveredDefaultTypeInternal _SetOrderDelivered_default_instance_;
+PROTOBUF_CONSTEXPR ConfirmDelivery::ConfirmDelivery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.delivery_id_)*/0u
+  , /*decltype(_impl_.correct_)*/false} {}
+struct ConfirmDeliveryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfirmDeliveryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfirmDeliveryDefaultTypeInternal() {}
+  union {
+    ConfirmDelivery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfirmDeliveryDefaultTypeInternal _ConfirmDelivery_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_OrderInfo_2eproto[5];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_OrderInfo_2eproto[6];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_OrderInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_OrderInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::UnconfirmedDelivery, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::UnconfirmedDelivery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::UnconfirmedDelivery, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::UnconfirmedDelivery, _impl_.team_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::UnconfirmedDelivery, _impl_.delivery_time_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.complexity_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.base_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.ring_colors_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.cap_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.quantity_requested_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.quantity_delivered_cyan_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.quantity_delivered_magenta_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.delivery_period_begin_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.delivery_period_end_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.delivery_gate_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.unconfirmed_deliveries_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Order, _impl_.competitive_),
+  0,
+  1,
+  9,
+  ~0u,
+  10,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  ~0u,
+  8,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::OrderInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::OrderInfo, _impl_.orders_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetOrderDelivered, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetOrderDelivered, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetOrderDelivered, _impl_.team_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetOrderDelivered, _impl_.order_id_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ConfirmDelivery, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ConfirmDelivery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ConfirmDelivery, _impl_.delivery_id_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::ConfirmDelivery, _impl_.correct_),
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::llsf_msgs::UnconfirmedDelivery)},
+  { 12, 31, -1, sizeof(::llsf_msgs::Order)},
+  { 44, -1, -1, sizeof(::llsf_msgs::OrderInfo)},
+  { 51, 59, -1, sizeof(::llsf_msgs::SetOrderDelivered)},
+  { 61, 69, -1, sizeof(::llsf_msgs::ConfirmDelivery)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_UnconfirmedDelivery_default_instance_._instance,
+  &::llsf_msgs::_Order_default_instance_._instance,
+  &::llsf_msgs::_OrderInfo_default_instance_._instance,
+  &::llsf_msgs::_SetOrderDelivered_default_instance_._instance,
+  &::llsf_msgs::_ConfirmDelivery_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_OrderInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017OrderInfo.proto\022\tllsf_msgs\032\nTeam.proto"
+  "\032\nTime.proto\032\022ProductColor.proto\"\220\001\n\023Unc"
+  "onfirmedDelivery\022\n\n\002id\030\001 \002(\r\022\035\n\004team\030\002 \002"
+  "(\0162\017.llsf_msgs.Team\022&\n\rdelivery_time\030\003 \002"
+  "(\0132\017.llsf_msgs.Time\"&\n\010CompType\022\014\n\007COMP_"
+  "ID\020\320\017\022\014\n\010MSG_TYPE\020-\"\240\004\n\005Order\022\n\n\002id\030\001 \002("
+  "\r\022/\n\ncomplexity\030\002 \002(\0162\033.llsf_msgs.Order."
+  "Complexity\022(\n\nbase_color\030\003 \002(\0162\024.llsf_ms"
+  "gs.BaseColor\022)\n\013ring_colors\030\004 \003(\0162\024.llsf"
+  "_msgs.RingColor\022&\n\tcap_color\030\005 \002(\0162\023.lls"
+  "f_msgs.CapColor\022\032\n\022quantity_requested\030\006 "
+  "\002(\r\022\037\n\027quantity_delivered_cyan\030\007 \002(\r\022\"\n\032"
+  "quantity_delivered_magenta\030\010 \002(\r\022\035\n\025deli"
+  "very_period_begin\030\t \002(\r\022\033\n\023delivery_peri"
+  "od_end\030\n \002(\r\022\025\n\rdelivery_gate\030\013 \002(\r\022>\n\026u"
+  "nconfirmed_deliveries\030\014 \003(\0132\036.llsf_msgs."
+  "UnconfirmedDelivery\022\023\n\013competitive\030\r \002(\010"
+  "\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020*"
+  "\",\n\nComplexity\022\006\n\002C0\020\000\022\006\n\002C1\020\001\022\006\n\002C2\020\002\022\006"
+  "\n\002C3\020\003\"U\n\tOrderInfo\022 \n\006orders\030\001 \003(\0132\020.ll"
+  "sf_msgs.Order\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022"
+  "\014\n\010MSG_TYPE\020)\"r\n\021SetOrderDelivered\022#\n\nte"
+  "am_color\030\001 \002(\0162\017.llsf_msgs.Team\022\020\n\010order"
+  "_id\030\002 \002(\r\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010M"
+  "SG_TYPE\020+\"_\n\017ConfirmDelivery\022\023\n\013delivery"
+  "_id\030\001 \002(\r\022\017\n\007correct\030\002 \002(\010\"&\n\010CompType\022\014"
+  "\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020.B2\n\037org.robocu"
+  "p_logistics.llsf_msgsB\017OrderInfoProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_OrderInfo_2eproto_deps[3] = {
+  &::descriptor_table_ProductColor_2eproto,
+  &::descriptor_table_Team_2eproto,
+  &::descriptor_table_Time_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_OrderInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_OrderInfo_2eproto = {
+    false, false, 1118, descriptor_table_protodef_OrderInfo_2eproto,
+    "OrderInfo.proto",
+    &descriptor_table_OrderInfo_2eproto_once, descriptor_table_OrderInfo_2eproto_deps, 3, 5,
+    schemas, file_default_instances, TableStruct_OrderInfo_2eproto::offsets,
+    file_level_metadata_OrderInfo_2eproto, file_level_enum_descriptors_OrderInfo_2eproto,
+    file_level_service_descriptors_OrderInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_OrderInfo_2eproto_getter() {
+  return &descriptor_table_OrderInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_OrderInfo_2eproto(&descriptor_table_OrderInfo_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UnconfirmedDelivery_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_OrderInfo_2eproto);
+  return file_level_enum_descriptors_OrderInfo_2eproto[0];
+}
+bool UnconfirmedDelivery_CompType_IsValid(int value) {
+  switch (value) {
+    case 45:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr UnconfirmedDelivery_CompType UnconfirmedDelivery::COMP_ID;
+constexpr UnconfirmedDelivery_CompType UnconfirmedDelivery::MSG_TYPE;
+constexpr UnconfirmedDelivery_CompType UnconfirmedDelivery::CompType_MIN;
+constexpr UnconfirmedDelivery_CompType UnconfirmedDelivery::CompType_MAX;
+constexpr int UnconfirmedDelivery::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Order_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_OrderInfo_2eproto);
+  return file_level_enum_descriptors_OrderInfo_2eproto[1];
+}
+bool Order_CompType_IsValid(int value) {
+  switch (value) {
+    case 42:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Order_CompType Order::COMP_ID;
+constexpr Order_CompType Order::MSG_TYPE;
+constexpr Order_CompType Order::CompType_MIN;
+constexpr Order_CompType Order::CompType_MAX;
+constexpr int Order::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Order_Complexity_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_OrderInfo_2eproto);
+  return file_level_enum_descriptors_OrderInfo_2eproto[2];
+}
+bool Order_Complexity_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Order_Complexity Order::C0;
+constexpr Order_Complexity Order::C1;
+constexpr Order_Complexity Order::C2;
+constexpr Order_Complexity Order::C3;
+constexpr Order_Complexity Order::Complexity_MIN;
+constexpr Order_Complexity Order::Complexity_MAX;
+constexpr int Order::Complexity_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* OrderInfo_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_OrderInfo_2eproto);
+  return file_level_enum_descriptors_OrderInfo_2eproto[3];
+}
+bool OrderInfo_CompType_IsValid(int value) {
+  switch (value) {
+    case 41:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr OrderInfo_CompType OrderInfo::COMP_ID;
+constexpr OrderInfo_CompType OrderInfo::MSG_TYPE;
+constexpr OrderInfo_CompType OrderInfo::CompType_MIN;
+constexpr OrderInfo_CompType OrderInfo::CompType_MAX;
+constexpr int OrderInfo::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetOrderDelivered_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_OrderInfo_2eproto);
+  return file_level_enum_descriptors_OrderInfo_2eproto[4];
+}
+bool SetOrderDelivered_CompType_IsValid(int value) {
+  switch (value) {
+    case 43:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SetOrderDelivered_CompType SetOrderDelivered::COMP_ID;
+constexpr SetOrderDelivered_CompType SetOrderDelivered::MSG_TYPE;
+constexpr SetOrderDelivered_CompType SetOrderDelivered::CompType_MIN;
+constexpr SetOrderDelivered_CompType SetOrderDelivered::CompType_MAX;
+constexpr int SetOrderDelivered::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ConfirmDelivery_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_OrderInfo_2eproto);
+  return file_level_enum_descriptors_OrderInfo_2eproto[5];
+}
+bool ConfirmDelivery_CompType_IsValid(int value) {
+  switch (value) {
+    case 46:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ConfirmDelivery_CompType ConfirmDelivery::COMP_ID;
+constexpr ConfirmDelivery_CompType ConfirmDelivery::MSG_TYPE;
+constexpr ConfirmDelivery_CompType ConfirmDelivery::CompType_MIN;
+constexpr ConfirmDelivery_CompType ConfirmDelivery::CompType_MAX;
+constexpr int ConfirmDelivery::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class UnconfirmedDelivery::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UnconfirmedDelivery>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_team(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::llsf_msgs::Time& delivery_time(const UnconfirmedDelivery* msg);
+  static void set_has_delivery_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::llsf_msgs::Time&
+UnconfirmedDelivery::_Internal::delivery_time(const UnconfirmedDelivery* msg) {
+  return *msg->_impl_.delivery_time_;
+}
+void UnconfirmedDelivery::clear_delivery_time() {
+  if (_impl_.delivery_time_ != nullptr) _impl_.delivery_time_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+UnconfirmedDelivery::UnconfirmedDelivery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.UnconfirmedDelivery)
+}
+UnconfirmedDelivery::UnconfirmedDelivery(const UnconfirmedDelivery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnconfirmedDelivery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.delivery_time_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.team_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_delivery_time()) {
+    _this->_impl_.delivery_time_ = new ::llsf_msgs::Time(*from._impl_.delivery_time_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.team_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.team_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.UnconfirmedDelivery)
+}
+
+inline void UnconfirmedDelivery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.delivery_time_){nullptr}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.team_){0}
+  };
+}
+
+UnconfirmedDelivery::~UnconfirmedDelivery() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.UnconfirmedDelivery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnconfirmedDelivery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.delivery_time_;
+}
+
+void UnconfirmedDelivery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnconfirmedDelivery::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.UnconfirmedDelivery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.delivery_time_ != nullptr);
+    _impl_.delivery_time_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.team_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.team_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnconfirmedDelivery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.Team team = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.Time delivery_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_delivery_time(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UnconfirmedDelivery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.UnconfirmedDelivery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // required .llsf_msgs.Team team = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_team(), target);
+  }
+
+  // required .llsf_msgs.Time delivery_time = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::delivery_time(this),
+        _Internal::delivery_time(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.UnconfirmedDelivery)
+  return target;
+}
+
+size_t UnconfirmedDelivery::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.UnconfirmedDelivery)
+  size_t total_size = 0;
+
+  if (_internal_has_delivery_time()) {
+    // required .llsf_msgs.Time delivery_time = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.delivery_time_);
+  }
+
+  if (_internal_has_id()) {
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  if (_internal_has_team()) {
+    // required .llsf_msgs.Team team = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team());
+  }
+
+  return total_size;
+}
+size_t UnconfirmedDelivery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.UnconfirmedDelivery)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .llsf_msgs.Time delivery_time = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.delivery_time_);
+
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+
+    // required .llsf_msgs.Team team = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnconfirmedDelivery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnconfirmedDelivery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnconfirmedDelivery::GetClassData() const { return &_class_data_; }
+
+
+void UnconfirmedDelivery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnconfirmedDelivery*>(&to_msg);
+  auto& from = static_cast<const UnconfirmedDelivery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.UnconfirmedDelivery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_delivery_time()->::llsf_msgs::Time::MergeFrom(
+          from._internal_delivery_time());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.team_ = from._impl_.team_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnconfirmedDelivery::CopyFrom(const UnconfirmedDelivery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.UnconfirmedDelivery)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnconfirmedDelivery::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_delivery_time()) {
+    if (!_impl_.delivery_time_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void UnconfirmedDelivery::InternalSwap(UnconfirmedDelivery* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UnconfirmedDelivery, _impl_.team_)
+      + sizeof(UnconfirmedDelivery::_impl_.team_)
+      - PROTOBUF_FIELD_OFFSET(UnconfirmedDelivery, _impl_.delivery_time_)>(
+          reinterpret_cast<char*>(&_impl_.delivery_time_),
+          reinterpret_cast<char*>(&other->_impl_.delivery_time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnconfirmedDelivery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_OrderInfo_2eproto_getter, &descriptor_table_OrderInfo_2eproto_once,
+      file_level_metadata_OrderInfo_2eproto[0]);
+}
+
+// ===================================================================
+
+class Order::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Order>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_complexity(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_base_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_cap_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_quantity_requested(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_quantity_delivered_cyan(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_quantity_delivered_magenta(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_delivery_period_begin(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_delivery_period_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_delivery_gate(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_competitive(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000007ff) ^ 0x000007ff) != 0;
+  }
+};
+
+Order::Order(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.Order)
+}
+Order::Order(const Order& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Order* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ring_colors_){from._impl_.ring_colors_}
+    , decltype(_impl_.unconfirmed_deliveries_){from._impl_.unconfirmed_deliveries_}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.complexity_){}
+    , decltype(_impl_.quantity_requested_){}
+    , decltype(_impl_.quantity_delivered_cyan_){}
+    , decltype(_impl_.quantity_delivered_magenta_){}
+    , decltype(_impl_.delivery_period_begin_){}
+    , decltype(_impl_.delivery_period_end_){}
+    , decltype(_impl_.delivery_gate_){}
+    , decltype(_impl_.competitive_){}
+    , decltype(_impl_.base_color_){}
+    , decltype(_impl_.cap_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cap_color_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.cap_color_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.Order)
+}
+
+inline void Order::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ring_colors_){arena}
+    , decltype(_impl_.unconfirmed_deliveries_){arena}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.complexity_){0}
+    , decltype(_impl_.quantity_requested_){0u}
+    , decltype(_impl_.quantity_delivered_cyan_){0u}
+    , decltype(_impl_.quantity_delivered_magenta_){0u}
+    , decltype(_impl_.delivery_period_begin_){0u}
+    , decltype(_impl_.delivery_period_end_){0u}
+    , decltype(_impl_.delivery_gate_){0u}
+    , decltype(_impl_.competitive_){false}
+    , decltype(_impl_.base_color_){1}
+    , decltype(_impl_.cap_color_){1}
+  };
+}
+
+Order::~Order() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.Order)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Order::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ring_colors_.~RepeatedField();
+  _impl_.unconfirmed_deliveries_.~RepeatedPtrField();
+}
+
+void Order::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Order::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.Order)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ring_colors_.Clear();
+  _impl_.unconfirmed_deliveries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.delivery_gate_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.delivery_gate_));
+  }
+  if (cached_has_bits & 0x00000700u) {
+    _impl_.competitive_ = false;
+    _impl_.base_color_ = 1;
+    _impl_.cap_color_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Order::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.Order.Complexity complexity = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Order_Complexity_IsValid(val))) {
+            _internal_set_complexity(static_cast<::llsf_msgs::Order_Complexity>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.BaseColor base_color = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::BaseColor_IsValid(val))) {
+            _internal_set_base_color(static_cast<::llsf_msgs::BaseColor>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.RingColor ring_colors = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::RingColor_IsValid(val))) {
+              _internal_add_ring_colors(static_cast<::llsf_msgs::RingColor>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<32>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_ring_colors(), ptr, ctx, ::llsf_msgs::RingColor_IsValid, &_internal_metadata_, 4);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.CapColor cap_color = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::CapColor_IsValid(val))) {
+            _internal_set_cap_color(static_cast<::llsf_msgs::CapColor>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(5, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 quantity_requested = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_quantity_requested(&has_bits);
+          _impl_.quantity_requested_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 quantity_delivered_cyan = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_quantity_delivered_cyan(&has_bits);
+          _impl_.quantity_delivered_cyan_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 quantity_delivered_magenta = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_quantity_delivered_magenta(&has_bits);
+          _impl_.quantity_delivered_magenta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 delivery_period_begin = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_delivery_period_begin(&has_bits);
+          _impl_.delivery_period_begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 delivery_period_end = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_delivery_period_end(&has_bits);
+          _impl_.delivery_period_end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 delivery_gate = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_delivery_gate(&has_bits);
+          _impl_.delivery_gate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.UnconfirmedDelivery unconfirmed_deliveries = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_unconfirmed_deliveries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool competitive = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_competitive(&has_bits);
+          _impl_.competitive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Order::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.Order)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // required .llsf_msgs.Order.Complexity complexity = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_complexity(), target);
+  }
+
+  // required .llsf_msgs.BaseColor base_color = 3;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_base_color(), target);
+  }
+
+  // repeated .llsf_msgs.RingColor ring_colors = 4;
+  for (int i = 0, n = this->_internal_ring_colors_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        4, this->_internal_ring_colors(i), target);
+  }
+
+  // required .llsf_msgs.CapColor cap_color = 5;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_cap_color(), target);
+  }
+
+  // required uint32 quantity_requested = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_quantity_requested(), target);
+  }
+
+  // required uint32 quantity_delivered_cyan = 7;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_quantity_delivered_cyan(), target);
+  }
+
+  // required uint32 quantity_delivered_magenta = 8;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_quantity_delivered_magenta(), target);
+  }
+
+  // required uint32 delivery_period_begin = 9;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_delivery_period_begin(), target);
+  }
+
+  // required uint32 delivery_period_end = 10;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_delivery_period_end(), target);
+  }
+
+  // required uint32 delivery_gate = 11;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_delivery_gate(), target);
+  }
+
+  // repeated .llsf_msgs.UnconfirmedDelivery unconfirmed_deliveries = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_unconfirmed_deliveries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_unconfirmed_deliveries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // required bool competitive = 13;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_competitive(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.Order)
+  return target;
+}
+
+size_t Order::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.Order)
+  size_t total_size = 0;
+
+  if (_internal_has_id()) {
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  if (_internal_has_complexity()) {
+    // required .llsf_msgs.Order.Complexity complexity = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_complexity());
+  }
+
+  if (_internal_has_quantity_requested()) {
+    // required uint32 quantity_requested = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_quantity_requested());
+  }
+
+  if (_internal_has_quantity_delivered_cyan()) {
+    // required uint32 quantity_delivered_cyan = 7;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_quantity_delivered_cyan());
+  }
+
+  if (_internal_has_quantity_delivered_magenta()) {
+    // required uint32 quantity_delivered_magenta = 8;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_quantity_delivered_magenta());
+  }
+
+  if (_internal_has_delivery_period_begin()) {
+    // required uint32 delivery_period_begin = 9;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_delivery_period_begin());
+  }
+
+  if (_internal_has_delivery_period_end()) {
+    // required uint32 delivery_period_end = 10;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_delivery_period_end());
+  }
+
+  if (_internal_has_delivery_gate()) {
+    // required uint32 delivery_gate = 11;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_delivery_gate());
+  }
+
+  if (_internal_has_competitive()) {
+    // required bool competitive = 13;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_base_color()) {
+    // required .llsf_msgs.BaseColor base_color = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_base_color());
+  }
+
+  if (_internal_has_cap_color()) {
+    // required .llsf_msgs.CapColor cap_color = 5;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_cap_color());
+  }
+
+  return total_size;
+}
+size_t Order::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.Order)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x000007ff) ^ 0x000007ff) == 0) {  // All required fields are present.
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+
+    // required .llsf_msgs.Order.Complexity complexity = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_complexity());
+
+    // required uint32 quantity_requested = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_quantity_requested());
+
+    // required uint32 quantity_delivered_cyan = 7;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_quantity_delivered_cyan());
+
+    // required uint32 quantity_delivered_magenta = 8;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_quantity_delivered_magenta());
+
+    // required uint32 delivery_period_begin = 9;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_delivery_period_begin());
+
+    // required uint32 delivery_period_end = 10;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_delivery_period_end());
+
+    // required uint32 delivery_gate = 11;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_delivery_gate());
+
+    // required bool competitive = 13;
+    total_size += 1 + 1;
+
+    // required .llsf_msgs.BaseColor base_color = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_base_color());
+
+    // required .llsf_msgs.CapColor cap_color = 5;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_cap_color());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.RingColor ring_colors = 4;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_ring_colors_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_ring_colors(static_cast<int>(i)));
+    }
+    total_size += (1UL * count) + data_size;
+  }
+
+  // repeated .llsf_msgs.UnconfirmedDelivery unconfirmed_deliveries = 12;
+  total_size += 1UL * this->_internal_unconfirmed_deliveries_size();
+  for (const auto& msg : this->_impl_.unconfirmed_deliveries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Order::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Order::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Order::GetClassData() const { return &_class_data_; }
+
+
+void Order::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Order*>(&to_msg);
+  auto& from = static_cast<const Order&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.Order)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ring_colors_.MergeFrom(from._impl_.ring_colors_);
+  _this->_impl_.unconfirmed_deliveries_.MergeFrom(from._impl_.unconfirmed_deliveries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.complexity_ = from._impl_.complexity_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.quantity_requested_ = from._impl_.quantity_requested_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.quantity_delivered_cyan_ = from._impl_.quantity_delivered_cyan_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.quantity_delivered_magenta_ = from._impl_.quantity_delivered_magenta_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.delivery_period_begin_ = from._impl_.delivery_period_begin_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.delivery_period_end_ = from._impl_.delivery_period_end_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.delivery_gate_ = from._impl_.delivery_gate_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.competitive_ = from._impl_.competitive_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.base_color_ = from._impl_.base_color_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.cap_color_ = from._impl_.cap_color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Order::CopyFrom(const Order& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.Order)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Order::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.unconfirmed_deliveries_))
+    return false;
+  return true;
+}
+
+void Order::InternalSwap(Order* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.ring_colors_.InternalSwap(&other->_impl_.ring_colors_);
+  _impl_.unconfirmed_deliveries_.InternalSwap(&other->_impl_.unconfirmed_deliveries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Order, _impl_.competitive_)
+      + sizeof(Order::_impl_.competitive_)
+      - PROTOBUF_FIELD_OFFSET(Order, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+  swap(_impl_.base_color_, other->_impl_.base_color_);
+  swap(_impl_.cap_color_, other->_impl_.cap_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Order::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_OrderInfo_2eproto_getter, &descriptor_table_OrderInfo_2eproto_once,
+      file_level_metadata_OrderInfo_2eproto[1]);
+}
+
+// ===================================================================
+
+class OrderInfo::_Internal {
+ public:
+};
+
+OrderInfo::OrderInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.OrderInfo)
+}
+OrderInfo::OrderInfo(const OrderInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OrderInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.orders_){from._impl_.orders_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.OrderInfo)
+}
+
+inline void OrderInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.orders_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+OrderInfo::~OrderInfo() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.OrderInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OrderInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.orders_.~RepeatedPtrField();
+}
+
+void OrderInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OrderInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.OrderInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.orders_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OrderInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .llsf_msgs.Order orders = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_orders(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OrderInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.OrderInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Order orders = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_orders_size()); i < n; i++) {
+    const auto& repfield = this->_internal_orders(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.OrderInfo)
+  return target;
+}
+
+size_t OrderInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.OrderInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Order orders = 1;
+  total_size += 1UL * this->_internal_orders_size();
+  for (const auto& msg : this->_impl_.orders_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OrderInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OrderInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OrderInfo::GetClassData() const { return &_class_data_; }
+
+
+void OrderInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OrderInfo*>(&to_msg);
+  auto& from = static_cast<const OrderInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.OrderInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.orders_.MergeFrom(from._impl_.orders_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OrderInfo::CopyFrom(const OrderInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.OrderInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OrderInfo::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.orders_))
+    return false;
+  return true;
+}
+
+void OrderInfo::InternalSwap(OrderInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.orders_.InternalSwap(&other->_impl_.orders_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OrderInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_OrderInfo_2eproto_getter, &descriptor_table_OrderInfo_2eproto_once,
+      file_level_metadata_OrderInfo_2eproto[2]);
+}
+
+// ===================================================================
+
+class SetOrderDelivered::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SetOrderDelivered>()._impl_._has_bits_);
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_order_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+SetOrderDelivered::SetOrderDelivered(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.SetOrderDelivered)
+}
+SetOrderDelivered::SetOrderDelivered(const SetOrderDelivered& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetOrderDelivered* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.team_color_){}
+    , decltype(_impl_.order_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.team_color_, &from._impl_.team_color_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.order_id_) -
+    reinterpret_cast<char*>(&_impl_.team_color_)) + sizeof(_impl_.order_id_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.SetOrderDelivered)
+}
+
+inline void SetOrderDelivered::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.team_color_){0}
+    , decltype(_impl_.order_id_){0u}
+  };
+}
+
+SetOrderDelivered::~SetOrderDelivered() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.SetOrderDelivered)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetOrderDelivered::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SetOrderDelivered::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetOrderDelivered::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.SetOrderDelivered)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.team_color_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.order_id_) -
+        reinterpret_cast<char*>(&_impl_.team_color_)) + sizeof(_impl_.order_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetOrderDelivered::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.Team team_color = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 order_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_order_id(&has_bits);
+          _impl_.order_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetOrderDelivered::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.SetOrderDelivered)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Team team_color = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_team_color(), target);
+  }
+
+  // required uint32 order_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_order_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.SetOrderDelivered)
+  return target;
+}
+
+size_t SetOrderDelivered::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.SetOrderDelivered)
+  size_t total_size = 0;
+
+  if (_internal_has_team_color()) {
+    // required .llsf_msgs.Team team_color = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+
+  if (_internal_has_order_id()) {
+    // required uint32 order_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_order_id());
+  }
+
+  return total_size;
+}
+size_t SetOrderDelivered::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.SetOrderDelivered)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .llsf_msgs.Team team_color = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+
+    // required uint32 order_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_order_id());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetOrderDelivered::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetOrderDelivered::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetOrderDelivered::GetClassData() const { return &_class_data_; }
+
+
+void SetOrderDelivered::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetOrderDelivered*>(&to_msg);
+  auto& from = static_cast<const SetOrderDelivered&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.SetOrderDelivered)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.order_id_ = from._impl_.order_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetOrderDelivered::CopyFrom(const SetOrderDelivered& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.SetOrderDelivered)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetOrderDelivered::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SetOrderDelivered::InternalSwap(SetOrderDelivered* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetOrderDelivered, _impl_.order_id_)
+      + sizeof(SetOrderDelivered::_impl_.order_id_)
+      - PROTOBUF_FIELD_OFFSET(SetOrderDelivered, _impl_.team_color_)>(
+          reinterpret_cast<char*>(&_impl_.team_color_),
+          reinterpret_cast<char*>(&other->_impl_.team_color_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetOrderDelivered::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_OrderInfo_2eproto_getter, &descriptor_table_OrderInfo_2eproto_once,
+      file_level_metadata_OrderInfo_2eproto[3]);
+}
+
+// ===================================================================
+
+class ConfirmDelivery::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ConfirmDelivery>()._impl_._has_bits_);
+  static void set_has_delivery_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_correct(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ConfirmDelivery::ConfirmDelivery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.ConfirmDelivery)
+}
+ConfirmDelivery::ConfirmDelivery(const ConfirmDelivery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConfirmDelivery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.delivery_id_){}
+    , decltype(_impl_.correct_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.delivery_id_, &from._impl_.delivery_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.correct_) -
+    reinterpret_cast<char*>(&_impl_.delivery_id_)) + sizeof(_impl_.correct_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.ConfirmDelivery)
+}
+
+inline void ConfirmDelivery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.delivery_id_){0u}
+    , decltype(_impl_.correct_){false}
+  };
+}
+
+ConfirmDelivery::~ConfirmDelivery() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.ConfirmDelivery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConfirmDelivery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ConfirmDelivery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConfirmDelivery::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.ConfirmDelivery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.delivery_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.correct_) -
+        reinterpret_cast<char*>(&_impl_.delivery_id_)) + sizeof(_impl_.correct_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConfirmDelivery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 delivery_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_delivery_id(&has_bits);
+          _impl_.delivery_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool correct = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_correct(&has_bits);
+          _impl_.correct_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConfirmDelivery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.ConfirmDelivery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 delivery_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_delivery_id(), target);
+  }
+
+  // required bool correct = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_correct(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.ConfirmDelivery)
+  return target;
+}
+
+size_t ConfirmDelivery::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.ConfirmDelivery)
+  size_t total_size = 0;
+
+  if (_internal_has_delivery_id()) {
+    // required uint32 delivery_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_delivery_id());
+  }
+
+  if (_internal_has_correct()) {
+    // required bool correct = 2;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t ConfirmDelivery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.ConfirmDelivery)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint32 delivery_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_delivery_id());
+
+    // required bool correct = 2;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfirmDelivery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConfirmDelivery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfirmDelivery::GetClassData() const { return &_class_data_; }
+
+
+void ConfirmDelivery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfirmDelivery*>(&to_msg);
+  auto& from = static_cast<const ConfirmDelivery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.ConfirmDelivery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.delivery_id_ = from._impl_.delivery_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.correct_ = from._impl_.correct_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConfirmDelivery::CopyFrom(const ConfirmDelivery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.ConfirmDelivery)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConfirmDelivery::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ConfirmDelivery::InternalSwap(ConfirmDelivery* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConfirmDelivery, _impl_.correct_)
+      + sizeof(ConfirmDelivery::_impl_.correct_)
+      - PROTOBUF_FIELD_OFFSET(ConfirmDelivery, _impl_.delivery_id_)>(
+          reinterpret_cast<char*>(&_impl_.delivery_id_),
+          reinterpret_cast<char*>(&other->_impl_.delivery_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConfirmDelivery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_OrderInfo_2eproto_getter, &descriptor_table_OrderInfo_2eproto_once,
+      file_level_metadata_OrderInfo_2eproto[4]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::UnconfirmedDelivery*
+Arena::CreateMaybeMessage< ::llsf_msgs::UnconfirmedDelivery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::UnconfirmedDelivery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::Order*
+Arena::CreateMaybeMessage< ::llsf_msgs::Order >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::Order >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::OrderInfo*
+Arena::CreateMaybeMessage< ::llsf_msgs::OrderInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::OrderInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::SetOrderDelivered*
+Arena::CreateMaybeMessage< ::llsf_msgs::SetOrderDelivered >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::SetOrderDelivered >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::ConfirmDelivery*
+Arena::CreateMaybeMessage< ::llsf_msgs::ConfirmDelivery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::ConfirmDelivery >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
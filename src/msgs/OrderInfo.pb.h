@@ -0,0 +1,2245 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: OrderInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_OrderInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_OrderInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Team.pb.h"
+#include "Time.pb.h"
+#include "ProductColor.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_OrderInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_OrderInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_OrderInfo_2eproto;
+namespace llsf_msgs {
+class ConfirmDelivery;
+struct ConfirmDeliveryDefaultTypeInternal;
+extern ConfirmDeliveryDefaultTypeInternal _ConfirmDelivery_default_instance_;
+class Order;
+struct OrderDefaultTypeInternal;
+extern OrderDefaultTypeInternal _Order_default_instance_;
+class OrderInfo;
+struct OrderInfoDefaultTypeInternal;
+extern OrderInfoDefaultTypeInternal _OrderInfo_default_instance_;
+class SetOrderDelivered;
+struct SetOrderDeliveredDefaultTypeInternal;
+extern SetOrderDeliveredDefaultTypeInternal _SetOrderDelivered_default_instance_;
+class UnconfirmedDelivery;
+struct UnconfirmedDeliveryDefaultTypeInternal;
+extern UnconfirmedDeliveryDefaultTypeInternal _UnconfirmedDelivery_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::ConfirmDelivery* Arena::CreateMaybeMessage<::llsf_msgs::ConfirmDelivery>(Arena*);
+template<> ::llsf_msgs::Order* Arena::CreateMaybeMessage<::llsf_msgs::Order>(Arena*);
+template<> ::llsf_msgs::OrderInfo* Arena::CreateMaybeMessage<::llsf_msgs::OrderInfo>(Arena*);
+template<> ::llsf_msgs::SetOrderDelivered* Arena::CreateMaybeMessage<::llsf_msgs::SetOrderDelivered>(Arena*);
+template<> ::llsf_msgs::UnconfirmedDelivery* Arena::CreateMaybeMessage<::llsf_msgs::UnconfirmedDelivery>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum UnconfirmedDelivery_CompType : int {
+  UnconfirmedDelivery_CompType_COMP_ID = 2000,
+  UnconfirmedDelivery_CompType_MSG_TYPE = 45
+};
+bool UnconfirmedDelivery_CompType_IsValid(int value);
+constexpr UnconfirmedDelivery_CompType UnconfirmedDelivery_CompType_CompType_MIN = UnconfirmedDelivery_CompType_MSG_TYPE;
+constexpr UnconfirmedDelivery_CompType UnconfirmedDelivery_CompType_CompType_MAX = UnconfirmedDelivery_CompType_COMP_ID;
+constexpr int UnconfirmedDelivery_CompType_CompType_ARRAYSIZE = UnconfirmedDelivery_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UnconfirmedDelivery_CompType_descriptor();
+template<typename T>
+inline const std::string& UnconfirmedDelivery_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, UnconfirmedDelivery_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function UnconfirmedDelivery_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    UnconfirmedDelivery_CompType_descriptor(), enum_t_value);
+}
+inline bool UnconfirmedDelivery_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UnconfirmedDelivery_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UnconfirmedDelivery_CompType>(
+    UnconfirmedDelivery_CompType_descriptor(), name, value);
+}
+enum Order_CompType : int {
+  Order_CompType_COMP_ID = 2000,
+  Order_CompType_MSG_TYPE = 42
+};
+bool Order_CompType_IsValid(int value);
+constexpr Order_CompType Order_CompType_CompType_MIN = Order_CompType_MSG_TYPE;
+constexpr Order_CompType Order_CompType_CompType_MAX = Order_CompType_COMP_ID;
+constexpr int Order_CompType_CompType_ARRAYSIZE = Order_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Order_CompType_descriptor();
+template<typename T>
+inline const std::string& Order_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Order_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Order_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Order_CompType_descriptor(), enum_t_value);
+}
+inline bool Order_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Order_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Order_CompType>(
+    Order_CompType_descriptor(), name, value);
+}
+enum Order_Complexity : int {
+  Order_Complexity_C0 = 0,
+  Order_Complexity_C1 = 1,
+  Order_Complexity_C2 = 2,
+  Order_Complexity_C3 = 3
+};
+bool Order_Complexity_IsValid(int value);
+constexpr Order_Complexity Order_Complexity_Complexity_MIN = Order_Complexity_C0;
+constexpr Order_Complexity Order_Complexity_Complexity_MAX = Order_Complexity_C3;
+constexpr int Order_Complexity_Complexity_ARRAYSIZE = Order_Complexity_Complexity_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Order_Complexity_descriptor();
+template<typename T>
+inline const std::string& Order_Complexity_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Order_Complexity>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Order_Complexity_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Order_Complexity_descriptor(), enum_t_value);
+}
+inline bool Order_Complexity_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Order_Complexity* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Order_Complexity>(
+    Order_Complexity_descriptor(), name, value);
+}
+enum OrderInfo_CompType : int {
+  OrderInfo_CompType_COMP_ID = 2000,
+  OrderInfo_CompType_MSG_TYPE = 41
+};
+bool OrderInfo_CompType_IsValid(int value);
+constexpr OrderInfo_CompType OrderInfo_CompType_CompType_MIN = OrderInfo_CompType_MSG_TYPE;
+constexpr OrderInfo_CompType OrderInfo_CompType_CompType_MAX = OrderInfo_CompType_COMP_ID;
+constexpr int OrderInfo_CompType_CompType_ARRAYSIZE = OrderInfo_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* OrderInfo_CompType_descriptor();
+template<typename T>
+inline const std::string& OrderInfo_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, OrderInfo_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function OrderInfo_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    OrderInfo_CompType_descriptor(), enum_t_value);
+}
+inline bool OrderInfo_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, OrderInfo_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<OrderInfo_CompType>(
+    OrderInfo_CompType_descriptor(), name, value);
+}
+enum SetOrderDelivered_CompType : int {
+  SetOrderDelivered_CompType_COMP_ID = 2000,
+  SetOrderDelivered_CompType_MSG_TYPE = 43
+};
+bool SetOrderDelivered_CompType_IsValid(int value);
+constexpr SetOrderDelivered_CompType SetOrderDelivered_CompType_CompType_MIN = SetOrderDelivered_CompType_MSG_TYPE;
+constexpr SetOrderDelivered_CompType SetOrderDelivered_CompType_CompType_MAX = SetOrderDelivered_CompType_COMP_ID;
+constexpr int SetOrderDelivered_CompType_CompType_ARRAYSIZE = SetOrderDelivered_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetOrderDelivered_CompType_descriptor();
+template<typename T>
+inline const std::string& SetOrderDelivered_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SetOrderDelivered_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SetOrderDelivered_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SetOrderDelivered_CompType_descriptor(), enum_t_value);
+}
+inline bool SetOrderDelivered_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SetOrderDelivered_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SetOrderDelivered_CompType>(
+    SetOrderDelivered_CompType_descriptor(), name, value);
+}
+enum ConfirmDelivery_CompType : int {
+  ConfirmDelivery_CompType_COMP_ID = 2000,
+  ConfirmDelivery_CompType_MSG_TYPE = 46
+};
+bool ConfirmDelivery_CompType_IsValid(int value);
+constexpr ConfirmDelivery_CompType ConfirmDelivery_CompType_CompType_MIN = ConfirmDelivery_CompType_MSG_TYPE;
+constexpr ConfirmDelivery_CompType ConfirmDelivery_CompType_CompType_MAX = ConfirmDelivery_CompType_COMP_ID;
+constexpr int ConfirmDelivery_CompType_CompType_ARRAYSIZE = ConfirmDelivery_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ConfirmDelivery_CompType_descriptor();
+template<typename T>
+inline const std::string& ConfirmDelivery_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ConfirmDelivery_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ConfirmDelivery_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ConfirmDelivery_CompType_descriptor(), enum_t_value);
+}
+inline bool ConfirmDelivery_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ConfirmDelivery_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ConfirmDelivery_CompType>(
+    ConfirmDelivery_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class UnconfirmedDelivery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.UnconfirmedDelivery) */ {
+ public:
+  inline UnconfirmedDelivery() : UnconfirmedDelivery(nullptr) {}
+  ~UnconfirmedDelivery() override;
+  explicit PROTOBUF_CONSTEXPR UnconfirmedDelivery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnconfirmedDelivery(const UnconfirmedDelivery& from);
+  UnconfirmedDelivery(UnconfirmedDelivery&& from) noexcept
+    : UnconfirmedDelivery() {
+    *this = ::std::move(from);
+  }
+
+  inline UnconfirmedDelivery& operator=(const UnconfirmedDelivery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnconfirmedDelivery& operator=(UnconfirmedDelivery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnconfirmedDelivery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnconfirmedDelivery* internal_default_instance() {
+    return reinterpret_cast<const UnconfirmedDelivery*>(
+               &_UnconfirmedDelivery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(UnconfirmedDelivery& a, UnconfirmedDelivery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnconfirmedDelivery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnconfirmedDelivery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnconfirmedDelivery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnconfirmedDelivery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnconfirmedDelivery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnconfirmedDelivery& from) {
+    UnconfirmedDelivery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnconfirmedDelivery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.UnconfirmedDelivery";
+  }
+  protected:
+  explicit UnconfirmedDelivery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef UnconfirmedDelivery_CompType CompType;
+  static constexpr CompType COMP_ID =
+    UnconfirmedDelivery_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    UnconfirmedDelivery_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return UnconfirmedDelivery_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    UnconfirmedDelivery_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    UnconfirmedDelivery_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    UnconfirmedDelivery_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return UnconfirmedDelivery_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return UnconfirmedDelivery_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return UnconfirmedDelivery_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDeliveryTimeFieldNumber = 3,
+    kIdFieldNumber = 1,
+    kTeamFieldNumber = 2,
+  };
+  // required .llsf_msgs.Time delivery_time = 3;
+  bool has_delivery_time() const;
+  private:
+  bool _internal_has_delivery_time() const;
+  public:
+  void clear_delivery_time();
+  const ::llsf_msgs::Time& delivery_time() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::Time* release_delivery_time();
+  ::llsf_msgs::Time* mutable_delivery_time();
+  void set_allocated_delivery_time(::llsf_msgs::Time* delivery_time);
+  private:
+  const ::llsf_msgs::Time& _internal_delivery_time() const;
+  ::llsf_msgs::Time* _internal_mutable_delivery_time();
+  public:
+  void unsafe_arena_set_allocated_delivery_time(
+      ::llsf_msgs::Time* delivery_time);
+  ::llsf_msgs::Time* unsafe_arena_release_delivery_time();
+
+  // required uint32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // required .llsf_msgs.Team team = 2;
+  bool has_team() const;
+  private:
+  bool _internal_has_team() const;
+  public:
+  void clear_team();
+  ::llsf_msgs::Team team() const;
+  void set_team(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team() const;
+  void _internal_set_team(::llsf_msgs::Team value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.UnconfirmedDelivery)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::llsf_msgs::Time* delivery_time_;
+    uint32_t id_;
+    int team_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_OrderInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Order final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.Order) */ {
+ public:
+  inline Order() : Order(nullptr) {}
+  ~Order() override;
+  explicit PROTOBUF_CONSTEXPR Order(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Order(const Order& from);
+  Order(Order&& from) noexcept
+    : Order() {
+    *this = ::std::move(from);
+  }
+
+  inline Order& operator=(const Order& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Order& operator=(Order&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Order& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Order* internal_default_instance() {
+    return reinterpret_cast<const Order*>(
+               &_Order_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Order& a, Order& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Order* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Order* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Order* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Order>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Order& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Order& from) {
+    Order::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Order* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.Order";
+  }
+  protected:
+  explicit Order(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Order_CompType CompType;
+  static constexpr CompType COMP_ID =
+    Order_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    Order_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return Order_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    Order_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    Order_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    Order_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return Order_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return Order_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return Order_CompType_Parse(name, value);
+  }
+
+  typedef Order_Complexity Complexity;
+  static constexpr Complexity C0 =
+    Order_Complexity_C0;
+  static constexpr Complexity C1 =
+    Order_Complexity_C1;
+  static constexpr Complexity C2 =
+    Order_Complexity_C2;
+  static constexpr Complexity C3 =
+    Order_Complexity_C3;
+  static inline bool Complexity_IsValid(int value) {
+    return Order_Complexity_IsValid(value);
+  }
+  static constexpr Complexity Complexity_MIN =
+    Order_Complexity_Complexity_MIN;
+  static constexpr Complexity Complexity_MAX =
+    Order_Complexity_Complexity_MAX;
+  static constexpr int Complexity_ARRAYSIZE =
+    Order_Complexity_Complexity_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Complexity_descriptor() {
+    return Order_Complexity_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Complexity_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Complexity>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Complexity_Name.");
+    return Order_Complexity_Name(enum_t_value);
+  }
+  static inline bool Complexity_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Complexity* value) {
+    return Order_Complexity_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRingColorsFieldNumber = 4,
+    kUnconfirmedDeliveriesFieldNumber = 12,
+    kIdFieldNumber = 1,
+    kComplexityFieldNumber = 2,
+    kQuantityRequestedFieldNumber = 6,
+    kQuantityDeliveredCyanFieldNumber = 7,
+    kQuantityDeliveredMagentaFieldNumber = 8,
+    kDeliveryPeriodBeginFieldNumber = 9,
+    kDeliveryPeriodEndFieldNumber = 10,
+    kDeliveryGateFieldNumber = 11,
+    kCompetitiveFieldNumber = 13,
+    kBaseColorFieldNumber = 3,
+    kCapColorFieldNumber = 5,
+  };
+  // repeated .llsf_msgs.RingColor ring_colors = 4;
+  int ring_colors_size() const;
+  private:
+  int _internal_ring_colors_size() const;
+  public:
+  void clear_ring_colors();
+  private:
+  ::llsf_msgs::RingColor _internal_ring_colors(int index) const;
+  void _internal_add_ring_colors(::llsf_msgs::RingColor value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_ring_colors();
+  public:
+  ::llsf_msgs::RingColor ring_colors(int index) const;
+  void set_ring_colors(int index, ::llsf_msgs::RingColor value);
+  void add_ring_colors(::llsf_msgs::RingColor value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& ring_colors() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_ring_colors();
+
+  // repeated .llsf_msgs.UnconfirmedDelivery unconfirmed_deliveries = 12;
+  int unconfirmed_deliveries_size() const;
+  private:
+  int _internal_unconfirmed_deliveries_size() const;
+  public:
+  void clear_unconfirmed_deliveries();
+  ::llsf_msgs::UnconfirmedDelivery* mutable_unconfirmed_deliveries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::UnconfirmedDelivery >*
+      mutable_unconfirmed_deliveries();
+  private:
+  const ::llsf_msgs::UnconfirmedDelivery& _internal_unconfirmed_deliveries(int index) const;
+  ::llsf_msgs::UnconfirmedDelivery* _internal_add_unconfirmed_deliveries();
+  public:
+  const ::llsf_msgs::UnconfirmedDelivery& unconfirmed_deliveries(int index) const;
+  ::llsf_msgs::UnconfirmedDelivery* add_unconfirmed_deliveries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::UnconfirmedDelivery >&
+      unconfirmed_deliveries() const;
+
+  // required uint32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // required .llsf_msgs.Order.Complexity complexity = 2;
+  bool has_complexity() const;
+  private:
+  bool _internal_has_complexity() const;
+  public:
+  void clear_complexity();
+  ::llsf_msgs::Order_Complexity complexity() const;
+  void set_complexity(::llsf_msgs::Order_Complexity value);
+  private:
+  ::llsf_msgs::Order_Complexity _internal_complexity() const;
+  void _internal_set_complexity(::llsf_msgs::Order_Complexity value);
+  public:
+
+  // required uint32 quantity_requested = 6;
+  bool has_quantity_requested() const;
+  private:
+  bool _internal_has_quantity_requested() const;
+  public:
+  void clear_quantity_requested();
+  uint32_t quantity_requested() const;
+  void set_quantity_requested(uint32_t value);
+  private:
+  uint32_t _internal_quantity_requested() const;
+  void _internal_set_quantity_requested(uint32_t value);
+  public:
+
+  // required uint32 quantity_delivered_cyan = 7;
+  bool has_quantity_delivered_cyan() const;
+  private:
+  bool _internal_has_quantity_delivered_cyan() const;
+  public:
+  void clear_quantity_delivered_cyan();
+  uint32_t quantity_delivered_cyan() const;
+  void set_quantity_delivered_cyan(uint32_t value);
+  private:
+  uint32_t _internal_quantity_delivered_cyan() const;
+  void _internal_set_quantity_delivered_cyan(uint32_t value);
+  public:
+
+  // required uint32 quantity_delivered_magenta = 8;
+  bool has_quantity_delivered_magenta() const;
+  private:
+  bool _internal_has_quantity_delivered_magenta() const;
+  public:
+  void clear_quantity_delivered_magenta();
+  uint32_t quantity_delivered_magenta() const;
+  void set_quantity_delivered_magenta(uint32_t value);
+  private:
+  uint32_t _internal_quantity_delivered_magenta() const;
+  void _internal_set_quantity_delivered_magenta(uint32_t value);
+  public:
+
+  // required uint32 delivery_period_begin = 9;
+  bool has_delivery_period_begin() const;
+  private:
+  bool _internal_has_delivery_period_begin() const;
+  public:
+  void clear_delivery_period_begin();
+  uint32_t delivery_period_begin() const;
+  void set_delivery_period_begin(uint32_t value);
+  private:
+  uint32_t _internal_delivery_period_begin() const;
+  void _internal_set_delivery_period_begin(uint32_t value);
+  public:
+
+  // required uint32 delivery_period_end = 10;
+  bool has_delivery_period_end() const;
+  private:
+  bool _internal_has_delivery_period_end() const;
+  public:
+  void clear_delivery_period_end();
+  uint32_t delivery_period_end() const;
+  void set_delivery_period_end(uint32_t value);
+  private:
+  uint32_t _internal_delivery_period_end() const;
+  void _internal_set_delivery_period_end(uint32_t value);
+  public:
+
+  // required uint32 delivery_gate = 11;
+  bool has_delivery_gate() const;
+  private:
+  bool _internal_has_delivery_gate() const;
+  public:
+  void clear_delivery_gate();
+  uint32_t delivery_gate() const;
+  void set_delivery_gate(uint32_t value);
+  private:
+  uint32_t _internal_delivery_gate() const;
+  void _internal_set_delivery_gate(uint32_t value);
+  public:
+
+  // required bool competitive = 13;
+  bool has_competitive() const;
+  private:
+  bool _internal_has_competitive() const;
+  public:
+  void clear_competitive();
+  bool competitive() const;
+  void set_competitive(bool value);
+  private:
+  bool _internal_competitive() const;
+  void _internal_set_competitive(bool value);
+  public:
+
+  // required .llsf_msgs.BaseColor base_color = 3;
+  bool has_base_color() const;
+  private:
+  bool _internal_has_base_color() const;
+  public:
+  void clear_base_color();
+  ::llsf_msgs::BaseColor base_color() const;
+  void set_base_color(::llsf_msgs::BaseColor value);
+  private:
+  ::llsf_msgs::BaseColor _internal_base_color() const;
+  void _internal_set_base_color(::llsf_msgs::BaseColor value);
+  public:
+
+  // required .llsf_msgs.CapColor cap_color = 5;
+  bool has_cap_color() const;
+  private:
+  bool _internal_has_cap_color() const;
+  public:
+  void clear_cap_color();
+  ::llsf_msgs::CapColor cap_color() const;
+  void set_cap_color(::llsf_msgs::CapColor value);
+  private:
+  ::llsf_msgs::CapColor _internal_cap_color() const;
+  void _internal_set_cap_color(::llsf_msgs::CapColor value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.Order)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> ring_colors_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::UnconfirmedDelivery > unconfirmed_deliveries_;
+    uint32_t id_;
+    int complexity_;
+    uint32_t quantity_requested_;
+    uint32_t quantity_delivered_cyan_;
+    uint32_t quantity_delivered_magenta_;
+    uint32_t delivery_period_begin_;
+    uint32_t delivery_period_end_;
+    uint32_t delivery_gate_;
+    bool competitive_;
+    int base_color_;
+    int cap_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_OrderInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OrderInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.OrderInfo) */ {
+ public:
+  inline OrderInfo() : OrderInfo(nullptr) {}
+  ~OrderInfo() override;
+  explicit PROTOBUF_CONSTEXPR OrderInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OrderInfo(const OrderInfo& from);
+  OrderInfo(OrderInfo&& from) noexcept
+    : OrderInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline OrderInfo& operator=(const OrderInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OrderInfo& operator=(OrderInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OrderInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OrderInfo* internal_default_instance() {
+    return reinterpret_cast<const OrderInfo*>(
+               &_OrderInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(OrderInfo& a, OrderInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OrderInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OrderInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OrderInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OrderInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OrderInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OrderInfo& from) {
+    OrderInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OrderInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.OrderInfo";
+  }
+  protected:
+  explicit OrderInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef OrderInfo_CompType CompType;
+  static constexpr CompType COMP_ID =
+    OrderInfo_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    OrderInfo_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return OrderInfo_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    OrderInfo_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    OrderInfo_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    OrderInfo_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return OrderInfo_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return OrderInfo_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return OrderInfo_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOrdersFieldNumber = 1,
+  };
+  // repeated .llsf_msgs.Order orders = 1;
+  int orders_size() const;
+  private:
+  int _internal_orders_size() const;
+  public:
+  void clear_orders();
+  ::llsf_msgs::Order* mutable_orders(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Order >*
+      mutable_orders();
+  private:
+  const ::llsf_msgs::Order& _internal_orders(int index) const;
+  ::llsf_msgs::Order* _internal_add_orders();
+  public:
+  const ::llsf_msgs::Order& orders(int index) const;
+  ::llsf_msgs::Order* add_orders();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Order >&
+      orders() const;
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.OrderInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Order > orders_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_OrderInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetOrderDelivered final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.SetOrderDelivered) */ {
+ public:
+  inline SetOrderDelivered() : SetOrderDelivered(nullptr) {}
+  ~SetOrderDelivered() override;
+  explicit PROTOBUF_CONSTEXPR SetOrderDelivered(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetOrderDelivered(const SetOrderDelivered& from);
+  SetOrderDelivered(SetOrderDelivered&& from) noexcept
+    : SetOrderDelivered() {
+    *this = ::std::move(from);
+  }
+
+  inline SetOrderDelivered& operator=(const SetOrderDelivered& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetOrderDelivered& operator=(SetOrderDelivered&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetOrderDelivered& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetOrderDelivered* internal_default_instance() {
+    return reinterpret_cast<const SetOrderDelivered*>(
+               &_SetOrderDelivered_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SetOrderDelivered& a, SetOrderDelivered& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetOrderDelivered* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetOrderDelivered* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetOrderDelivered* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetOrderDelivered>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetOrderDelivered& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetOrderDelivered& from) {
+    SetOrderDelivered::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetOrderDelivered* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.SetOrderDelivered";
+  }
+  protected:
+  explicit SetOrderDelivered(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SetOrderDelivered_CompType CompType;
+  static constexpr CompType COMP_ID =
+    SetOrderDelivered_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    SetOrderDelivered_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return SetOrderDelivered_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    SetOrderDelivered_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    SetOrderDelivered_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    SetOrderDelivered_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return SetOrderDelivered_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return SetOrderDelivered_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return SetOrderDelivered_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTeamColorFieldNumber = 1,
+    kOrderIdFieldNumber = 2,
+  };
+  // required .llsf_msgs.Team team_color = 1;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // required uint32 order_id = 2;
+  bool has_order_id() const;
+  private:
+  bool _internal_has_order_id() const;
+  public:
+  void clear_order_id();
+  uint32_t order_id() const;
+  void set_order_id(uint32_t value);
+  private:
+  uint32_t _internal_order_id() const;
+  void _internal_set_order_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.SetOrderDelivered)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int team_color_;
+    uint32_t order_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_OrderInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ConfirmDelivery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.ConfirmDelivery) */ {
+ public:
+  inline ConfirmDelivery() : ConfirmDelivery(nullptr) {}
+  ~ConfirmDelivery() override;
+  explicit PROTOBUF_CONSTEXPR ConfirmDelivery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConfirmDelivery(const ConfirmDelivery& from);
+  ConfirmDelivery(ConfirmDelivery&& from) noexcept
+    : ConfirmDelivery() {
+    *this = ::std::move(from);
+  }
+
+  inline ConfirmDelivery& operator=(const ConfirmDelivery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConfirmDelivery& operator=(ConfirmDelivery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConfirmDelivery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConfirmDelivery* internal_default_instance() {
+    return reinterpret_cast<const ConfirmDelivery*>(
+               &_ConfirmDelivery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ConfirmDelivery& a, ConfirmDelivery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConfirmDelivery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConfirmDelivery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConfirmDelivery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfirmDelivery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConfirmDelivery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfirmDelivery& from) {
+    ConfirmDelivery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConfirmDelivery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.ConfirmDelivery";
+  }
+  protected:
+  explicit ConfirmDelivery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ConfirmDelivery_CompType CompType;
+  static constexpr CompType COMP_ID =
+    ConfirmDelivery_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    ConfirmDelivery_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return ConfirmDelivery_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    ConfirmDelivery_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    ConfirmDelivery_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    ConfirmDelivery_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return ConfirmDelivery_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return ConfirmDelivery_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return ConfirmDelivery_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDeliveryIdFieldNumber = 1,
+    kCorrectFieldNumber = 2,
+  };
+  // required uint32 delivery_id = 1;
+  bool has_delivery_id() const;
+  private:
+  bool _internal_has_delivery_id() const;
+  public:
+  void clear_delivery_id();
+  uint32_t delivery_id() const;
+  void set_delivery_id(uint32_t value);
+  private:
+  uint32_t _internal_delivery_id() const;
+  void _internal_set_delivery_id(uint32_t value);
+  public:
+
+  // required bool correct = 2;
+  bool has_correct() const;
+  private:
+  bool _internal_has_correct() const;
+  public:
+  void clear_correct();
+  bool correct() const;
+  void set_correct(bool value);
+  private:
+  bool _internal_correct() const;
+  void _internal_set_correct(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.ConfirmDelivery)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t delivery_id_;
+    bool correct_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_OrderInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// UnconfirmedDelivery
+
+// required uint32 id = 1;
+inline bool UnconfirmedDelivery::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool UnconfirmedDelivery::has_id() const {
+  return _internal_has_id();
+}
+inline void UnconfirmedDelivery::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t UnconfirmedDelivery::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t UnconfirmedDelivery::id() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.UnconfirmedDelivery.id)
+  return _internal_id();
+}
+inline void UnconfirmedDelivery::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
+}
+inline void UnconfirmedDelivery::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.UnconfirmedDelivery.id)
+}
+
+// required .llsf_msgs.Team team = 2;
+inline bool UnconfirmedDelivery::_internal_has_team() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool UnconfirmedDelivery::has_team() const {
+  return _internal_has_team();
+}
+inline void UnconfirmedDelivery::clear_team() {
+  _impl_.team_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::llsf_msgs::Team UnconfirmedDelivery::_internal_team() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_);
+}
+inline ::llsf_msgs::Team UnconfirmedDelivery::team() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.UnconfirmedDelivery.team)
+  return _internal_team();
+}
+inline void UnconfirmedDelivery::_internal_set_team(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.team_ = value;
+}
+inline void UnconfirmedDelivery::set_team(::llsf_msgs::Team value) {
+  _internal_set_team(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.UnconfirmedDelivery.team)
+}
+
+// required .llsf_msgs.Time delivery_time = 3;
+inline bool UnconfirmedDelivery::_internal_has_delivery_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.delivery_time_ != nullptr);
+  return value;
+}
+inline bool UnconfirmedDelivery::has_delivery_time() const {
+  return _internal_has_delivery_time();
+}
+inline const ::llsf_msgs::Time& UnconfirmedDelivery::_internal_delivery_time() const {
+  const ::llsf_msgs::Time* p = _impl_.delivery_time_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::Time&>(
+      ::llsf_msgs::_Time_default_instance_);
+}
+inline const ::llsf_msgs::Time& UnconfirmedDelivery::delivery_time() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.UnconfirmedDelivery.delivery_time)
+  return _internal_delivery_time();
+}
+inline void UnconfirmedDelivery::unsafe_arena_set_allocated_delivery_time(
+    ::llsf_msgs::Time* delivery_time) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.delivery_time_);
+  }
+  _impl_.delivery_time_ = delivery_time;
+  if (delivery_time) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.UnconfirmedDelivery.delivery_time)
+}
+inline ::llsf_msgs::Time* UnconfirmedDelivery::release_delivery_time() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::llsf_msgs::Time* temp = _impl_.delivery_time_;
+  _impl_.delivery_time_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::Time* UnconfirmedDelivery::unsafe_arena_release_delivery_time() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.UnconfirmedDelivery.delivery_time)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::llsf_msgs::Time* temp = _impl_.delivery_time_;
+  _impl_.delivery_time_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::Time* UnconfirmedDelivery::_internal_mutable_delivery_time() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.delivery_time_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::Time>(GetArenaForAllocation());
+    _impl_.delivery_time_ = p;
+  }
+  return _impl_.delivery_time_;
+}
+inline ::llsf_msgs::Time* UnconfirmedDelivery::mutable_delivery_time() {
+  ::llsf_msgs::Time* _msg = _internal_mutable_delivery_time();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.UnconfirmedDelivery.delivery_time)
+  return _msg;
+}
+inline void UnconfirmedDelivery::set_allocated_delivery_time(::llsf_msgs::Time* delivery_time) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.delivery_time_);
+  }
+  if (delivery_time) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(delivery_time));
+    if (message_arena != submessage_arena) {
+      delivery_time = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, delivery_time, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.delivery_time_ = delivery_time;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.UnconfirmedDelivery.delivery_time)
+}
+
+// -------------------------------------------------------------------
+
+// Order
+
+// required uint32 id = 1;
+inline bool Order::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Order::has_id() const {
+  return _internal_has_id();
+}
+inline void Order::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t Order::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Order::id() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.id)
+  return _internal_id();
+}
+inline void Order::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void Order::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.id)
+}
+
+// required .llsf_msgs.Order.Complexity complexity = 2;
+inline bool Order::_internal_has_complexity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Order::has_complexity() const {
+  return _internal_has_complexity();
+}
+inline void Order::clear_complexity() {
+  _impl_.complexity_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::llsf_msgs::Order_Complexity Order::_internal_complexity() const {
+  return static_cast< ::llsf_msgs::Order_Complexity >(_impl_.complexity_);
+}
+inline ::llsf_msgs::Order_Complexity Order::complexity() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.complexity)
+  return _internal_complexity();
+}
+inline void Order::_internal_set_complexity(::llsf_msgs::Order_Complexity value) {
+  assert(::llsf_msgs::Order_Complexity_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.complexity_ = value;
+}
+inline void Order::set_complexity(::llsf_msgs::Order_Complexity value) {
+  _internal_set_complexity(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.complexity)
+}
+
+// required .llsf_msgs.BaseColor base_color = 3;
+inline bool Order::_internal_has_base_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Order::has_base_color() const {
+  return _internal_has_base_color();
+}
+inline void Order::clear_base_color() {
+  _impl_.base_color_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline ::llsf_msgs::BaseColor Order::_internal_base_color() const {
+  return static_cast< ::llsf_msgs::BaseColor >(_impl_.base_color_);
+}
+inline ::llsf_msgs::BaseColor Order::base_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.base_color)
+  return _internal_base_color();
+}
+inline void Order::_internal_set_base_color(::llsf_msgs::BaseColor value) {
+  assert(::llsf_msgs::BaseColor_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.base_color_ = value;
+}
+inline void Order::set_base_color(::llsf_msgs::BaseColor value) {
+  _internal_set_base_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.base_color)
+}
+
+// repeated .llsf_msgs.RingColor ring_colors = 4;
+inline int Order::_internal_ring_colors_size() const {
+  return _impl_.ring_colors_.size();
+}
+inline int Order::ring_colors_size() const {
+  return _internal_ring_colors_size();
+}
+inline void Order::clear_ring_colors() {
+  _impl_.ring_colors_.Clear();
+}
+inline ::llsf_msgs::RingColor Order::_internal_ring_colors(int index) const {
+  return static_cast< ::llsf_msgs::RingColor >(_impl_.ring_colors_.Get(index));
+}
+inline ::llsf_msgs::RingColor Order::ring_colors(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.ring_colors)
+  return _internal_ring_colors(index);
+}
+inline void Order::set_ring_colors(int index, ::llsf_msgs::RingColor value) {
+  assert(::llsf_msgs::RingColor_IsValid(value));
+  _impl_.ring_colors_.Set(index, value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.ring_colors)
+}
+inline void Order::_internal_add_ring_colors(::llsf_msgs::RingColor value) {
+  assert(::llsf_msgs::RingColor_IsValid(value));
+  _impl_.ring_colors_.Add(value);
+}
+inline void Order::add_ring_colors(::llsf_msgs::RingColor value) {
+  _internal_add_ring_colors(value);
+  // @@protoc_insertion_point(field_add:llsf_msgs.Order.ring_colors)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+Order::ring_colors() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.Order.ring_colors)
+  return _impl_.ring_colors_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Order::_internal_mutable_ring_colors() {
+  return &_impl_.ring_colors_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Order::mutable_ring_colors() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.Order.ring_colors)
+  return _internal_mutable_ring_colors();
+}
+
+// required .llsf_msgs.CapColor cap_color = 5;
+inline bool Order::_internal_has_cap_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Order::has_cap_color() const {
+  return _internal_has_cap_color();
+}
+inline void Order::clear_cap_color() {
+  _impl_.cap_color_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline ::llsf_msgs::CapColor Order::_internal_cap_color() const {
+  return static_cast< ::llsf_msgs::CapColor >(_impl_.cap_color_);
+}
+inline ::llsf_msgs::CapColor Order::cap_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.cap_color)
+  return _internal_cap_color();
+}
+inline void Order::_internal_set_cap_color(::llsf_msgs::CapColor value) {
+  assert(::llsf_msgs::CapColor_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.cap_color_ = value;
+}
+inline void Order::set_cap_color(::llsf_msgs::CapColor value) {
+  _internal_set_cap_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.cap_color)
+}
+
+// required uint32 quantity_requested = 6;
+inline bool Order::_internal_has_quantity_requested() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Order::has_quantity_requested() const {
+  return _internal_has_quantity_requested();
+}
+inline void Order::clear_quantity_requested() {
+  _impl_.quantity_requested_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t Order::_internal_quantity_requested() const {
+  return _impl_.quantity_requested_;
+}
+inline uint32_t Order::quantity_requested() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.quantity_requested)
+  return _internal_quantity_requested();
+}
+inline void Order::_internal_set_quantity_requested(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.quantity_requested_ = value;
+}
+inline void Order::set_quantity_requested(uint32_t value) {
+  _internal_set_quantity_requested(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.quantity_requested)
+}
+
+// required uint32 quantity_delivered_cyan = 7;
+inline bool Order::_internal_has_quantity_delivered_cyan() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Order::has_quantity_delivered_cyan() const {
+  return _internal_has_quantity_delivered_cyan();
+}
+inline void Order::clear_quantity_delivered_cyan() {
+  _impl_.quantity_delivered_cyan_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t Order::_internal_quantity_delivered_cyan() const {
+  return _impl_.quantity_delivered_cyan_;
+}
+inline uint32_t Order::quantity_delivered_cyan() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.quantity_delivered_cyan)
+  return _internal_quantity_delivered_cyan();
+}
+inline void Order::_internal_set_quantity_delivered_cyan(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.quantity_delivered_cyan_ = value;
+}
+inline void Order::set_quantity_delivered_cyan(uint32_t value) {
+  _internal_set_quantity_delivered_cyan(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.quantity_delivered_cyan)
+}
+
+// required uint32 quantity_delivered_magenta = 8;
+inline bool Order::_internal_has_quantity_delivered_magenta() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Order::has_quantity_delivered_magenta() const {
+  return _internal_has_quantity_delivered_magenta();
+}
+inline void Order::clear_quantity_delivered_magenta() {
+  _impl_.quantity_delivered_magenta_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Order::_internal_quantity_delivered_magenta() const {
+  return _impl_.quantity_delivered_magenta_;
+}
+inline uint32_t Order::quantity_delivered_magenta() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.quantity_delivered_magenta)
+  return _internal_quantity_delivered_magenta();
+}
+inline void Order::_internal_set_quantity_delivered_magenta(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.quantity_delivered_magenta_ = value;
+}
+inline void Order::set_quantity_delivered_magenta(uint32_t value) {
+  _internal_set_quantity_delivered_magenta(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.quantity_delivered_magenta)
+}
+
+// required uint32 delivery_period_begin = 9;
+inline bool Order::_internal_has_delivery_period_begin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Order::has_delivery_period_begin() const {
+  return _internal_has_delivery_period_begin();
+}
+inline void Order::clear_delivery_period_begin() {
+  _impl_.delivery_period_begin_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t Order::_internal_delivery_period_begin() const {
+  return _impl_.delivery_period_begin_;
+}
+inline uint32_t Order::delivery_period_begin() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.delivery_period_begin)
+  return _internal_delivery_period_begin();
+}
+inline void Order::_internal_set_delivery_period_begin(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.delivery_period_begin_ = value;
+}
+inline void Order::set_delivery_period_begin(uint32_t value) {
+  _internal_set_delivery_period_begin(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.delivery_period_begin)
+}
+
+// required uint32 delivery_period_end = 10;
+inline bool Order::_internal_has_delivery_period_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Order::has_delivery_period_end() const {
+  return _internal_has_delivery_period_end();
+}
+inline void Order::clear_delivery_period_end() {
+  _impl_.delivery_period_end_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t Order::_internal_delivery_period_end() const {
+  return _impl_.delivery_period_end_;
+}
+inline uint32_t Order::delivery_period_end() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.delivery_period_end)
+  return _internal_delivery_period_end();
+}
+inline void Order::_internal_set_delivery_period_end(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.delivery_period_end_ = value;
+}
+inline void Order::set_delivery_period_end(uint32_t value) {
+  _internal_set_delivery_period_end(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.delivery_period_end)
+}
+
+// required uint32 delivery_gate = 11;
+inline bool Order::_internal_has_delivery_gate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Order::has_delivery_gate() const {
+  return _internal_has_delivery_gate();
+}
+inline void Order::clear_delivery_gate() {
+  _impl_.delivery_gate_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t Order::_internal_delivery_gate() const {
+  return _impl_.delivery_gate_;
+}
+inline uint32_t Order::delivery_gate() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.delivery_gate)
+  return _internal_delivery_gate();
+}
+inline void Order::_internal_set_delivery_gate(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.delivery_gate_ = value;
+}
+inline void Order::set_delivery_gate(uint32_t value) {
+  _internal_set_delivery_gate(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.delivery_gate)
+}
+
+// repeated .llsf_msgs.UnconfirmedDelivery unconfirmed_deliveries = 12;
+inline int Order::_internal_unconfirmed_deliveries_size() const {
+  return _impl_.unconfirmed_deliveries_.size();
+}
+inline int Order::unconfirmed_deliveries_size() const {
+  return _internal_unconfirmed_deliveries_size();
+}
+inline void Order::clear_unconfirmed_deliveries() {
+  _impl_.unconfirmed_deliveries_.Clear();
+}
+inline ::llsf_msgs::UnconfirmedDelivery* Order::mutable_unconfirmed_deliveries(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Order.unconfirmed_deliveries)
+  return _impl_.unconfirmed_deliveries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::UnconfirmedDelivery >*
+Order::mutable_unconfirmed_deliveries() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.Order.unconfirmed_deliveries)
+  return &_impl_.unconfirmed_deliveries_;
+}
+inline const ::llsf_msgs::UnconfirmedDelivery& Order::_internal_unconfirmed_deliveries(int index) const {
+  return _impl_.unconfirmed_deliveries_.Get(index);
+}
+inline const ::llsf_msgs::UnconfirmedDelivery& Order::unconfirmed_deliveries(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.unconfirmed_deliveries)
+  return _internal_unconfirmed_deliveries(index);
+}
+inline ::llsf_msgs::UnconfirmedDelivery* Order::_internal_add_unconfirmed_deliveries() {
+  return _impl_.unconfirmed_deliveries_.Add();
+}
+inline ::llsf_msgs::UnconfirmedDelivery* Order::add_unconfirmed_deliveries() {
+  ::llsf_msgs::UnconfirmedDelivery* _add = _internal_add_unconfirmed_deliveries();
+  // @@protoc_insertion_point(field_add:llsf_msgs.Order.unconfirmed_deliveries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::UnconfirmedDelivery >&
+Order::unconfirmed_deliveries() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.Order.unconfirmed_deliveries)
+  return _impl_.unconfirmed_deliveries_;
+}
+
+// required bool competitive = 13;
+inline bool Order::_internal_has_competitive() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Order::has_competitive() const {
+  return _internal_has_competitive();
+}
+inline void Order::clear_competitive() {
+  _impl_.competitive_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool Order::_internal_competitive() const {
+  return _impl_.competitive_;
+}
+inline bool Order::competitive() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Order.competitive)
+  return _internal_competitive();
+}
+inline void Order::_internal_set_competitive(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.competitive_ = value;
+}
+inline void Order::set_competitive(bool value) {
+  _internal_set_competitive(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Order.competitive)
+}
+
+// -------------------------------------------------------------------
+
+// OrderInfo
+
+// repeated .llsf_msgs.Order orders = 1;
+inline int OrderInfo::_internal_orders_size() const {
+  return _impl_.orders_.size();
+}
+inline int OrderInfo::orders_size() const {
+  return _internal_orders_size();
+}
+inline void OrderInfo::clear_orders() {
+  _impl_.orders_.Clear();
+}
+inline ::llsf_msgs::Order* OrderInfo::mutable_orders(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.OrderInfo.orders)
+  return _impl_.orders_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Order >*
+OrderInfo::mutable_orders() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.OrderInfo.orders)
+  return &_impl_.orders_;
+}
+inline const ::llsf_msgs::Order& OrderInfo::_internal_orders(int index) const {
+  return _impl_.orders_.Get(index);
+}
+inline const ::llsf_msgs::Order& OrderInfo::orders(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.OrderInfo.orders)
+  return _internal_orders(index);
+}
+inline ::llsf_msgs::Order* OrderInfo::_internal_add_orders() {
+  return _impl_.orders_.Add();
+}
+inline ::llsf_msgs::Order* OrderInfo::add_orders() {
+  ::llsf_msgs::Order* _add = _internal_add_orders();
+  // @@protoc_insertion_point(field_add:llsf_msgs.OrderInfo.orders)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Order >&
+OrderInfo::orders() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.OrderInfo.orders)
+  return _impl_.orders_;
+}
+
+// -------------------------------------------------------------------
+
+// SetOrderDelivered
+
+// required .llsf_msgs.Team team_color = 1;
+inline bool SetOrderDelivered::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SetOrderDelivered::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void SetOrderDelivered::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::llsf_msgs::Team SetOrderDelivered::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team SetOrderDelivered::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetOrderDelivered.team_color)
+  return _internal_team_color();
+}
+inline void SetOrderDelivered::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.team_color_ = value;
+}
+inline void SetOrderDelivered::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetOrderDelivered.team_color)
+}
+
+// required uint32 order_id = 2;
+inline bool SetOrderDelivered::_internal_has_order_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SetOrderDelivered::has_order_id() const {
+  return _internal_has_order_id();
+}
+inline void SetOrderDelivered::clear_order_id() {
+  _impl_.order_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t SetOrderDelivered::_internal_order_id() const {
+  return _impl_.order_id_;
+}
+inline uint32_t SetOrderDelivered::order_id() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetOrderDelivered.order_id)
+  return _internal_order_id();
+}
+inline void SetOrderDelivered::_internal_set_order_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.order_id_ = value;
+}
+inline void SetOrderDelivered::set_order_id(uint32_t value) {
+  _internal_set_order_id(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetOrderDelivered.order_id)
+}
+
+// -------------------------------------------------------------------
+
+// ConfirmDelivery
+
+// required uint32 delivery_id = 1;
+inline bool ConfirmDelivery::_internal_has_delivery_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ConfirmDelivery::has_delivery_id() const {
+  return _internal_has_delivery_id();
+}
+inline void ConfirmDelivery::clear_delivery_id() {
+  _impl_.delivery_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t ConfirmDelivery::_internal_delivery_id() const {
+  return _impl_.delivery_id_;
+}
+inline uint32_t ConfirmDelivery::delivery_id() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ConfirmDelivery.delivery_id)
+  return _internal_delivery_id();
+}
+inline void ConfirmDelivery::_internal_set_delivery_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.delivery_id_ = value;
+}
+inline void ConfirmDelivery::set_delivery_id(uint32_t value) {
+  _internal_set_delivery_id(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.ConfirmDelivery.delivery_id)
+}
+
+// required bool correct = 2;
+inline bool ConfirmDelivery::_internal_has_correct() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ConfirmDelivery::has_correct() const {
+  return _internal_has_correct();
+}
+inline void ConfirmDelivery::clear_correct() {
+  _impl_.correct_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool ConfirmDelivery::_internal_correct() const {
+  return _impl_.correct_;
+}
+inline bool ConfirmDelivery::correct() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.ConfirmDelivery.correct)
+  return _internal_correct();
+}
+inline void ConfirmDelivery::_internal_set_correct(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.correct_ = value;
+}
+inline void ConfirmDelivery::set_correct(bool value) {
+  _internal_set_correct(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.ConfirmDelivery.correct)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::UnconfirmedDelivery_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::UnconfirmedDelivery_CompType>() {
+  return ::llsf_msgs::UnconfirmedDelivery_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::Order_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::Order_CompType>() {
+  return ::llsf_msgs::Order_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::Order_Complexity> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::Order_Complexity>() {
+  return ::llsf_msgs::Order_Complexity_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::OrderInfo_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::OrderInfo_CompType>() {
+  return ::llsf_msgs::OrderInfo_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::SetOrderDelivered_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::SetOrderDelivered_CompType>() {
+  return ::llsf_msgs::SetOrderDelivered_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::ConfirmDelivery_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::ConfirmDelivery_CompType>() {
+  return ::llsf_msgs::ConfirmDelivery_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_OrderInfo_2eproto
@@ -0,0 +1,448 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Pose2D.proto
+
+#include "Pose2D.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR Pose2D::Pose2D(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.timestamp_)*/nullptr
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.ori_)*/0} {}
+struct Pose2DDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Pose2DDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Pose2DDefaultTypeInternal() {}
+  union {
+    Pose2D _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Pose2DDefaultTypeInternal _Pose2D_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_Pose2D_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Pose2D_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Pose2D_2eproto = nullptr;
+
+const uint32_t TableStruct_Pose2D_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Pose2D, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Pose2D, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Pose2D, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Pose2D, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Pose2D, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Pose2D, _impl_.ori_),
+  0,
+  1,
+  2,
+  3,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::llsf_msgs::Pose2D)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_Pose2D_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_Pose2D_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\014Pose2D.proto\022\tllsf_msgs\032\nTime.proto\"O\n"
+  "\006Pose2D\022\"\n\ttimestamp\030\001 \002(\0132\017.llsf_msgs.T"
+  "ime\022\t\n\001x\030\002 \002(\002\022\t\n\001y\030\003 \002(\002\022\013\n\003ori\030\004 \002(\002B/"
+  "\n\037org.robocup_logistics.llsf_msgsB\014Pose2"
+  "DProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_Pose2D_2eproto_deps[1] = {
+  &::descriptor_table_Time_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_Pose2D_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Pose2D_2eproto = {
+    false, false, 167, descriptor_table_protodef_Pose2D_2eproto,
+    "Pose2D.proto",
+    &descriptor_table_Pose2D_2eproto_once, descriptor_table_Pose2D_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_Pose2D_2eproto::offsets,
+    file_level_metadata_Pose2D_2eproto, file_level_enum_descriptors_Pose2D_2eproto,
+    file_level_service_descriptors_Pose2D_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Pose2D_2eproto_getter() {
+  return &descriptor_table_Pose2D_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Pose2D_2eproto(&descriptor_table_Pose2D_2eproto);
+namespace llsf_msgs {
+
+// ===================================================================
+
+class Pose2D::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Pose2D>()._impl_._has_bits_);
+  static const ::llsf_msgs::Time& timestamp(const Pose2D* msg);
+  static void set_has_timestamp(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ori(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+const ::llsf_msgs::Time&
+Pose2D::_Internal::timestamp(const Pose2D* msg) {
+  return *msg->_impl_.timestamp_;
+}
+void Pose2D::clear_timestamp() {
+  if (_impl_.timestamp_ != nullptr) _impl_.timestamp_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+Pose2D::Pose2D(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.Pose2D)
+}
+Pose2D::Pose2D(const Pose2D& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Pose2D* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.timestamp_){nullptr}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.ori_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_timestamp()) {
+    _this->_impl_.timestamp_ = new ::llsf_msgs::Time(*from._impl_.timestamp_);
+  }
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ori_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.ori_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.Pose2D)
+}
+
+inline void Pose2D::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.timestamp_){nullptr}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.ori_){0}
+  };
+}
+
+Pose2D::~Pose2D() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.Pose2D)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Pose2D::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.timestamp_;
+}
+
+void Pose2D::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Pose2D::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.Pose2D)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.timestamp_ != nullptr);
+    _impl_.timestamp_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.ori_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.ori_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Pose2D::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.Time timestamp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_timestamp(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required float x = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // required float y = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // required float ori = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_ori(&has_bits);
+          _impl_.ori_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Pose2D::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.Pose2D)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Time timestamp = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::timestamp(this),
+        _Internal::timestamp(this).GetCachedSize(), target, stream);
+  }
+
+  // required float x = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_x(), target);
+  }
+
+  // required float y = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_y(), target);
+  }
+
+  // required float ori = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_ori(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.Pose2D)
+  return target;
+}
+
+size_t Pose2D::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.Pose2D)
+  size_t total_size = 0;
+
+  if (_internal_has_timestamp()) {
+    // required .llsf_msgs.Time timestamp = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.timestamp_);
+  }
+
+  if (_internal_has_x()) {
+    // required float x = 2;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_y()) {
+    // required float y = 3;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_ori()) {
+    // required float ori = 4;
+    total_size += 1 + 4;
+  }
+
+  return total_size;
+}
+size_t Pose2D::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.Pose2D)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required .llsf_msgs.Time timestamp = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.timestamp_);
+
+    // required float x = 2;
+    total_size += 1 + 4;
+
+    // required float y = 3;
+    total_size += 1 + 4;
+
+    // required float ori = 4;
+    total_size += 1 + 4;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Pose2D::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Pose2D::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Pose2D::GetClassData() const { return &_class_data_; }
+
+
+void Pose2D::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Pose2D*>(&to_msg);
+  auto& from = static_cast<const Pose2D&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.Pose2D)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_timestamp()->::llsf_msgs::Time::MergeFrom(
+          from._internal_timestamp());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.ori_ = from._impl_.ori_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Pose2D::CopyFrom(const Pose2D& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.Pose2D)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Pose2D::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_timestamp()) {
+    if (!_impl_.timestamp_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Pose2D::InternalSwap(Pose2D* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Pose2D, _impl_.ori_)
+      + sizeof(Pose2D::_impl_.ori_)
+      - PROTOBUF_FIELD_OFFSET(Pose2D, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Pose2D::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Pose2D_2eproto_getter, &descriptor_table_Pose2D_2eproto_once,
+      file_level_metadata_Pose2D_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::Pose2D*
+Arena::CreateMaybeMessage< ::llsf_msgs::Pose2D >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::Pose2D >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
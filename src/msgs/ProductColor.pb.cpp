@@ -0,0 +1,108 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ProductColor.proto
+
+#include "ProductColor.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+}  // namespace llsf_msgs
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_ProductColor_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ProductColor_2eproto = nullptr;
+const uint32_t TableStruct_ProductColor_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
+
+const char descriptor_table_protodef_ProductColor_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022ProductColor.proto\022\tllsf_msgs*L\n\tRingC"
+  "olor\022\r\n\tRING_BLUE\020\001\022\016\n\nRING_GREEN\020\002\022\017\n\013R"
+  "ING_ORANGE\020\003\022\017\n\013RING_YELLOW\020\004*:\n\tBaseCol"
+  "or\022\014\n\010BASE_RED\020\001\022\016\n\nBASE_BLACK\020\002\022\017\n\013BASE"
+  "_SILVER\020\003*\'\n\010CapColor\022\r\n\tCAP_BLACK\020\001\022\014\n\010"
+  "CAP_GREY\020\002B5\n\037org.robocup_logistics.llsf"
+  "_msgsB\022ProductColorProtos"
+  ;
+static ::_pbi::once_flag descriptor_table_ProductColor_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ProductColor_2eproto = {
+    false, false, 265, descriptor_table_protodef_ProductColor_2eproto,
+    "ProductColor.proto",
+    &descriptor_table_ProductColor_2eproto_once, nullptr, 0, 0,
+    schemas, file_default_instances, TableStruct_ProductColor_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_ProductColor_2eproto,
+    file_level_service_descriptors_ProductColor_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ProductColor_2eproto_getter() {
+  return &descriptor_table_ProductColor_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ProductColor_2eproto(&descriptor_table_ProductColor_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RingColor_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ProductColor_2eproto);
+  return file_level_enum_descriptors_ProductColor_2eproto[0];
+}
+bool RingColor_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* BaseColor_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ProductColor_2eproto);
+  return file_level_enum_descriptors_ProductColor_2eproto[1];
+}
+bool BaseColor_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CapColor_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ProductColor_2eproto);
+  return file_level_enum_descriptors_ProductColor_2eproto[2];
+}
+bool CapColor_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
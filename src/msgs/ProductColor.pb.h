@@ -0,0 +1,165 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ProductColor.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ProductColor_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ProductColor_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ProductColor_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ProductColor_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ProductColor_2eproto;
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum RingColor : int {
+  RING_BLUE = 1,
+  RING_GREEN = 2,
+  RING_ORANGE = 3,
+  RING_YELLOW = 4
+};
+bool RingColor_IsValid(int value);
+constexpr RingColor RingColor_MIN = RING_BLUE;
+constexpr RingColor RingColor_MAX = RING_YELLOW;
+constexpr int RingColor_ARRAYSIZE = RingColor_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RingColor_descriptor();
+template<typename T>
+inline const std::string& RingColor_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RingColor>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RingColor_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RingColor_descriptor(), enum_t_value);
+}
+inline bool RingColor_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RingColor* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RingColor>(
+    RingColor_descriptor(), name, value);
+}
+enum BaseColor : int {
+  BASE_RED = 1,
+  BASE_BLACK = 2,
+  BASE_SILVER = 3
+};
+bool BaseColor_IsValid(int value);
+constexpr BaseColor BaseColor_MIN = BASE_RED;
+constexpr BaseColor BaseColor_MAX = BASE_SILVER;
+constexpr int BaseColor_ARRAYSIZE = BaseColor_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* BaseColor_descriptor();
+template<typename T>
+inline const std::string& BaseColor_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, BaseColor>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function BaseColor_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    BaseColor_descriptor(), enum_t_value);
+}
+inline bool BaseColor_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, BaseColor* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<BaseColor>(
+    BaseColor_descriptor(), name, value);
+}
+enum CapColor : int {
+  CAP_BLACK = 1,
+  CAP_GREY = 2
+};
+bool CapColor_IsValid(int value);
+constexpr CapColor CapColor_MIN = CAP_BLACK;
+constexpr CapColor CapColor_MAX = CAP_GREY;
+constexpr int CapColor_ARRAYSIZE = CapColor_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CapColor_descriptor();
+template<typename T>
+inline const std::string& CapColor_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CapColor>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CapColor_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CapColor_descriptor(), enum_t_value);
+}
+inline bool CapColor_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CapColor* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CapColor>(
+    CapColor_descriptor(), name, value);
+}
+// ===================================================================
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::RingColor> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::RingColor>() {
+  return ::llsf_msgs::RingColor_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::BaseColor> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::BaseColor>() {
+  return ::llsf_msgs::BaseColor_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::CapColor> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::CapColor>() {
+  return ::llsf_msgs::CapColor_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ProductColor_2eproto
@@ -0,0 +1,593 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: RingInfo.proto
+
+#include "RingInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR Ring::Ring(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.raw_material_)*/0u
+  , /*decltype(_impl_.ring_color_)*/1} {}
+struct RingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RingDefaultTypeInternal() {}
+  union {
+    Ring _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RingDefaultTypeInternal _Ring_default_instance_;
+PROTOBUF_CONSTEXPR RingInfo::RingInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rings_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RingInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RingInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RingInfoDefaultTypeInternal() {}
+  union {
+    RingInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RingInfoDefaultTypeInternal _RingInfo_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_RingInfo_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_RingInfo_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_RingInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_RingInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Ring, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Ring, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Ring, _impl_.ring_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Ring, _impl_.raw_material_),
+  1,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::RingInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::RingInfo, _impl_.rings_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::llsf_msgs::Ring)},
+  { 10, -1, -1, sizeof(::llsf_msgs::RingInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_Ring_default_instance_._instance,
+  &::llsf_msgs::_RingInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_RingInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016RingInfo.proto\022\tllsf_msgs\032\022ProductColo"
+  "r.proto\"F\n\004Ring\022(\n\nring_color\030\001 \002(\0162\024.ll"
+  "sf_msgs.RingColor\022\024\n\014raw_material\030\002 \002(\r\""
+  "R\n\010RingInfo\022\036\n\005rings\030\001 \003(\0132\017.llsf_msgs.R"
+  "ing\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYP"
+  "E\020nB1\n\037org.robocup_logistics.llsf_msgsB\016"
+  "RingInfoProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_RingInfo_2eproto_deps[1] = {
+  &::descriptor_table_ProductColor_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_RingInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_RingInfo_2eproto = {
+    false, false, 254, descriptor_table_protodef_RingInfo_2eproto,
+    "RingInfo.proto",
+    &descriptor_table_RingInfo_2eproto_once, descriptor_table_RingInfo_2eproto_deps, 1, 2,
+    schemas, file_default_instances, TableStruct_RingInfo_2eproto::offsets,
+    file_level_metadata_RingInfo_2eproto, file_level_enum_descriptors_RingInfo_2eproto,
+    file_level_service_descriptors_RingInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_RingInfo_2eproto_getter() {
+  return &descriptor_table_RingInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_RingInfo_2eproto(&descriptor_table_RingInfo_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RingInfo_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_RingInfo_2eproto);
+  return file_level_enum_descriptors_RingInfo_2eproto[0];
+}
+bool RingInfo_CompType_IsValid(int value) {
+  switch (value) {
+    case 110:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr RingInfo_CompType RingInfo::COMP_ID;
+constexpr RingInfo_CompType RingInfo::MSG_TYPE;
+constexpr RingInfo_CompType RingInfo::CompType_MIN;
+constexpr RingInfo_CompType RingInfo::CompType_MAX;
+constexpr int RingInfo::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Ring::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Ring>()._impl_._has_bits_);
+  static void set_has_ring_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_raw_material(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Ring::Ring(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.Ring)
+}
+Ring::Ring(const Ring& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Ring* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.raw_material_){}
+    , decltype(_impl_.ring_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.raw_material_, &from._impl_.raw_material_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ring_color_) -
+    reinterpret_cast<char*>(&_impl_.raw_material_)) + sizeof(_impl_.ring_color_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.Ring)
+}
+
+inline void Ring::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.raw_material_){0u}
+    , decltype(_impl_.ring_color_){1}
+  };
+}
+
+Ring::~Ring() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.Ring)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Ring::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Ring::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Ring::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.Ring)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.raw_material_ = 0u;
+    _impl_.ring_color_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Ring::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.RingColor ring_color = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::RingColor_IsValid(val))) {
+            _internal_set_ring_color(static_cast<::llsf_msgs::RingColor>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 raw_material = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_raw_material(&has_bits);
+          _impl_.raw_material_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Ring::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.Ring)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.RingColor ring_color = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_ring_color(), target);
+  }
+
+  // required uint32 raw_material = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_raw_material(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.Ring)
+  return target;
+}
+
+size_t Ring::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.Ring)
+  size_t total_size = 0;
+
+  if (_internal_has_raw_material()) {
+    // required uint32 raw_material = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_raw_material());
+  }
+
+  if (_internal_has_ring_color()) {
+    // required .llsf_msgs.RingColor ring_color = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_ring_color());
+  }
+
+  return total_size;
+}
+size_t Ring::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.Ring)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint32 raw_material = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_raw_material());
+
+    // required .llsf_msgs.RingColor ring_color = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_ring_color());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Ring::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Ring::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Ring::GetClassData() const { return &_class_data_; }
+
+
+void Ring::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Ring*>(&to_msg);
+  auto& from = static_cast<const Ring&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.Ring)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.raw_material_ = from._impl_.raw_material_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.ring_color_ = from._impl_.ring_color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Ring::CopyFrom(const Ring& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.Ring)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Ring::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Ring::InternalSwap(Ring* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.raw_material_, other->_impl_.raw_material_);
+  swap(_impl_.ring_color_, other->_impl_.ring_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Ring::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_RingInfo_2eproto_getter, &descriptor_table_RingInfo_2eproto_once,
+      file_level_metadata_RingInfo_2eproto[0]);
+}
+
+// ===================================================================
+
+class RingInfo::_Internal {
+ public:
+};
+
+RingInfo::RingInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.RingInfo)
+}
+RingInfo::RingInfo(const RingInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RingInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rings_){from._impl_.rings_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.RingInfo)
+}
+
+inline void RingInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rings_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RingInfo::~RingInfo() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.RingInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RingInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rings_.~RepeatedPtrField();
+}
+
+void RingInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RingInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.RingInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rings_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RingInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .llsf_msgs.Ring rings = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rings(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RingInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.RingInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Ring rings = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rings_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rings(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.RingInfo)
+  return target;
+}
+
+size_t RingInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.RingInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Ring rings = 1;
+  total_size += 1UL * this->_internal_rings_size();
+  for (const auto& msg : this->_impl_.rings_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RingInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RingInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RingInfo::GetClassData() const { return &_class_data_; }
+
+
+void RingInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RingInfo*>(&to_msg);
+  auto& from = static_cast<const RingInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.RingInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rings_.MergeFrom(from._impl_.rings_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RingInfo::CopyFrom(const RingInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.RingInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RingInfo::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.rings_))
+    return false;
+  return true;
+}
+
+void RingInfo::InternalSwap(RingInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rings_.InternalSwap(&other->_impl_.rings_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RingInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_RingInfo_2eproto_getter, &descriptor_table_RingInfo_2eproto_once,
+      file_level_metadata_RingInfo_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::Ring*
+Arena::CreateMaybeMessage< ::llsf_msgs::Ring >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::Ring >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::RingInfo*
+Arena::CreateMaybeMessage< ::llsf_msgs::RingInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::RingInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,593 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: RingInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_RingInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_RingInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "ProductColor.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_RingInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_RingInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_RingInfo_2eproto;
+namespace llsf_msgs {
+class Ring;
+struct RingDefaultTypeInternal;
+extern RingDefaultTypeInternal _Ring_default_instance_;
+class RingInfo;
+struct RingInfoDefaultTypeInternal;
+extern RingInfoDefaultTypeInternal _RingInfo_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::Ring* Arena::CreateMaybeMessage<::llsf_msgs::Ring>(Arena*);
+template<> ::llsf_msgs::RingInfo* Arena::CreateMaybeMessage<::llsf_msgs::RingInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum RingInfo_CompType : int {
+  RingInfo_CompType_COMP_ID = 2000,
+  RingInfo_CompType_MSG_TYPE = 110
+};
+bool RingInfo_CompType_IsValid(int value);
+constexpr RingInfo_CompType RingInfo_CompType_CompType_MIN = RingInfo_CompType_MSG_TYPE;
+constexpr RingInfo_CompType RingInfo_CompType_CompType_MAX = RingInfo_CompType_COMP_ID;
+constexpr int RingInfo_CompType_CompType_ARRAYSIZE = RingInfo_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RingInfo_CompType_descriptor();
+template<typename T>
+inline const std::string& RingInfo_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RingInfo_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RingInfo_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RingInfo_CompType_descriptor(), enum_t_value);
+}
+inline bool RingInfo_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RingInfo_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RingInfo_CompType>(
+    RingInfo_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class Ring final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.Ring) */ {
+ public:
+  inline Ring() : Ring(nullptr) {}
+  ~Ring() override;
+  explicit PROTOBUF_CONSTEXPR Ring(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Ring(const Ring& from);
+  Ring(Ring&& from) noexcept
+    : Ring() {
+    *this = ::std::move(from);
+  }
+
+  inline Ring& operator=(const Ring& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Ring& operator=(Ring&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Ring& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Ring* internal_default_instance() {
+    return reinterpret_cast<const Ring*>(
+               &_Ring_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Ring& a, Ring& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Ring* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Ring* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Ring* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Ring>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Ring& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Ring& from) {
+    Ring::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Ring* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.Ring";
+  }
+  protected:
+  explicit Ring(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRawMaterialFieldNumber = 2,
+    kRingColorFieldNumber = 1,
+  };
+  // required uint32 raw_material = 2;
+  bool has_raw_material() const;
+  private:
+  bool _internal_has_raw_material() const;
+  public:
+  void clear_raw_material();
+  uint32_t raw_material() const;
+  void set_raw_material(uint32_t value);
+  private:
+  uint32_t _internal_raw_material() const;
+  void _internal_set_raw_material(uint32_t value);
+  public:
+
+  // required .llsf_msgs.RingColor ring_color = 1;
+  bool has_ring_color() const;
+  private:
+  bool _internal_has_ring_color() const;
+  public:
+  void clear_ring_color();
+  ::llsf_msgs::RingColor ring_color() const;
+  void set_ring_color(::llsf_msgs::RingColor value);
+  private:
+  ::llsf_msgs::RingColor _internal_ring_color() const;
+  void _internal_set_ring_color(::llsf_msgs::RingColor value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.Ring)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t raw_material_;
+    int ring_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_RingInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RingInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.RingInfo) */ {
+ public:
+  inline RingInfo() : RingInfo(nullptr) {}
+  ~RingInfo() override;
+  explicit PROTOBUF_CONSTEXPR RingInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RingInfo(const RingInfo& from);
+  RingInfo(RingInfo&& from) noexcept
+    : RingInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline RingInfo& operator=(const RingInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RingInfo& operator=(RingInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RingInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RingInfo* internal_default_instance() {
+    return reinterpret_cast<const RingInfo*>(
+               &_RingInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RingInfo& a, RingInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RingInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RingInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RingInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RingInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RingInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RingInfo& from) {
+    RingInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RingInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.RingInfo";
+  }
+  protected:
+  explicit RingInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef RingInfo_CompType CompType;
+  static constexpr CompType COMP_ID =
+    RingInfo_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    RingInfo_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return RingInfo_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    RingInfo_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    RingInfo_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    RingInfo_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return RingInfo_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return RingInfo_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return RingInfo_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRingsFieldNumber = 1,
+  };
+  // repeated .llsf_msgs.Ring rings = 1;
+  int rings_size() const;
+  private:
+  int _internal_rings_size() const;
+  public:
+  void clear_rings();
+  ::llsf_msgs::Ring* mutable_rings(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Ring >*
+      mutable_rings();
+  private:
+  const ::llsf_msgs::Ring& _internal_rings(int index) const;
+  ::llsf_msgs::Ring* _internal_add_rings();
+  public:
+  const ::llsf_msgs::Ring& rings(int index) const;
+  ::llsf_msgs::Ring* add_rings();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Ring >&
+      rings() const;
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.RingInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Ring > rings_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_RingInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Ring
+
+// required .llsf_msgs.RingColor ring_color = 1;
+inline bool Ring::_internal_has_ring_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Ring::has_ring_color() const {
+  return _internal_has_ring_color();
+}
+inline void Ring::clear_ring_color() {
+  _impl_.ring_color_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::llsf_msgs::RingColor Ring::_internal_ring_color() const {
+  return static_cast< ::llsf_msgs::RingColor >(_impl_.ring_color_);
+}
+inline ::llsf_msgs::RingColor Ring::ring_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Ring.ring_color)
+  return _internal_ring_color();
+}
+inline void Ring::_internal_set_ring_color(::llsf_msgs::RingColor value) {
+  assert(::llsf_msgs::RingColor_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ring_color_ = value;
+}
+inline void Ring::set_ring_color(::llsf_msgs::RingColor value) {
+  _internal_set_ring_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Ring.ring_color)
+}
+
+// required uint32 raw_material = 2;
+inline bool Ring::_internal_has_raw_material() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Ring::has_raw_material() const {
+  return _internal_has_raw_material();
+}
+inline void Ring::clear_raw_material() {
+  _impl_.raw_material_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t Ring::_internal_raw_material() const {
+  return _impl_.raw_material_;
+}
+inline uint32_t Ring::raw_material() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Ring.raw_material)
+  return _internal_raw_material();
+}
+inline void Ring::_internal_set_raw_material(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.raw_material_ = value;
+}
+inline void Ring::set_raw_material(uint32_t value) {
+  _internal_set_raw_material(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Ring.raw_material)
+}
+
+// -------------------------------------------------------------------
+
+// RingInfo
+
+// repeated .llsf_msgs.Ring rings = 1;
+inline int RingInfo::_internal_rings_size() const {
+  return _impl_.rings_.size();
+}
+inline int RingInfo::rings_size() const {
+  return _internal_rings_size();
+}
+inline void RingInfo::clear_rings() {
+  _impl_.rings_.Clear();
+}
+inline ::llsf_msgs::Ring* RingInfo::mutable_rings(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.RingInfo.rings)
+  return _impl_.rings_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Ring >*
+RingInfo::mutable_rings() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.RingInfo.rings)
+  return &_impl_.rings_;
+}
+inline const ::llsf_msgs::Ring& RingInfo::_internal_rings(int index) const {
+  return _impl_.rings_.Get(index);
+}
+inline const ::llsf_msgs::Ring& RingInfo::rings(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.RingInfo.rings)
+  return _internal_rings(index);
+}
+inline ::llsf_msgs::Ring* RingInfo::_internal_add_rings() {
+  return _impl_.rings_.Add();
+}
+inline ::llsf_msgs::Ring* RingInfo::add_rings() {
+  ::llsf_msgs::Ring* _add = _internal_add_rings();
+  // @@protoc_insertion_point(field_add:llsf_msgs.RingInfo.rings)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Ring >&
+RingInfo::rings() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.RingInfo.rings)
+  return _impl_.rings_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::RingInfo_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::RingInfo_CompType>() {
+  return ::llsf_msgs::RingInfo_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_RingInfo_2eproto
@@ -0,0 +1,419 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: RobotCommands.proto
+
+#include "RobotCommands.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR SetRobotMaintenance::SetRobotMaintenance(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.robot_number_)*/0u
+  , /*decltype(_impl_.maintenance_)*/false
+  , /*decltype(_impl_.team_color_)*/0} {}
+struct SetRobotMaintenanceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetRobotMaintenanceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetRobotMaintenanceDefaultTypeInternal() {}
+  union {
+    SetRobotMaintenance _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetRobotMaintenanceDefaultTypeInternal _SetRobotMaintenance_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_RobotCommands_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_RobotCommands_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_RobotCommands_2eproto = nullptr;
+
+const uint32_t TableStruct_RobotCommands_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetRobotMaintenance, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetRobotMaintenance, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetRobotMaintenance, _impl_.robot_number_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetRobotMaintenance, _impl_.maintenance_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SetRobotMaintenance, _impl_.team_color_),
+  0,
+  1,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::llsf_msgs::SetRobotMaintenance)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_SetRobotMaintenance_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_RobotCommands_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\023RobotCommands.proto\022\tllsf_msgs\032\nTeam.p"
+  "roto\"\215\001\n\023SetRobotMaintenance\022\024\n\014robot_nu"
+  "mber\030\001 \002(\r\022\023\n\013maintenance\030\003 \002(\010\022#\n\nteam_"
+  "color\030\004 \002(\0162\017.llsf_msgs.Team\"&\n\010CompType"
+  "\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020[B6\n\037org.robo"
+  "cup_logistics.llsf_msgsB\023RobotCommandsPr"
+  "otos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_RobotCommands_2eproto_deps[1] = {
+  &::descriptor_table_Team_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_RobotCommands_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_RobotCommands_2eproto = {
+    false, false, 244, descriptor_table_protodef_RobotCommands_2eproto,
+    "RobotCommands.proto",
+    &descriptor_table_RobotCommands_2eproto_once, descriptor_table_RobotCommands_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_RobotCommands_2eproto::offsets,
+    file_level_metadata_RobotCommands_2eproto, file_level_enum_descriptors_RobotCommands_2eproto,
+    file_level_service_descriptors_RobotCommands_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_RobotCommands_2eproto_getter() {
+  return &descriptor_table_RobotCommands_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_RobotCommands_2eproto(&descriptor_table_RobotCommands_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetRobotMaintenance_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_RobotCommands_2eproto);
+  return file_level_enum_descriptors_RobotCommands_2eproto[0];
+}
+bool SetRobotMaintenance_CompType_IsValid(int value) {
+  switch (value) {
+    case 91:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SetRobotMaintenance_CompType SetRobotMaintenance::COMP_ID;
+constexpr SetRobotMaintenance_CompType SetRobotMaintenance::MSG_TYPE;
+constexpr SetRobotMaintenance_CompType SetRobotMaintenance::CompType_MIN;
+constexpr SetRobotMaintenance_CompType SetRobotMaintenance::CompType_MAX;
+constexpr int SetRobotMaintenance::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class SetRobotMaintenance::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SetRobotMaintenance>()._impl_._has_bits_);
+  static void set_has_robot_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_maintenance(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+SetRobotMaintenance::SetRobotMaintenance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.SetRobotMaintenance)
+}
+SetRobotMaintenance::SetRobotMaintenance(const SetRobotMaintenance& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetRobotMaintenance* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.robot_number_){}
+    , decltype(_impl_.maintenance_){}
+    , decltype(_impl_.team_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.robot_number_, &from._impl_.robot_number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.team_color_) -
+    reinterpret_cast<char*>(&_impl_.robot_number_)) + sizeof(_impl_.team_color_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.SetRobotMaintenance)
+}
+
+inline void SetRobotMaintenance::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.robot_number_){0u}
+    , decltype(_impl_.maintenance_){false}
+    , decltype(_impl_.team_color_){0}
+  };
+}
+
+SetRobotMaintenance::~SetRobotMaintenance() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.SetRobotMaintenance)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetRobotMaintenance::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SetRobotMaintenance::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetRobotMaintenance::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.SetRobotMaintenance)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.robot_number_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.team_color_) -
+        reinterpret_cast<char*>(&_impl_.robot_number_)) + sizeof(_impl_.team_color_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetRobotMaintenance::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 robot_number = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_robot_number(&has_bits);
+          _impl_.robot_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool maintenance = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_maintenance(&has_bits);
+          _impl_.maintenance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.Team team_color = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetRobotMaintenance::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.SetRobotMaintenance)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 robot_number = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_robot_number(), target);
+  }
+
+  // required bool maintenance = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_maintenance(), target);
+  }
+
+  // required .llsf_msgs.Team team_color = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_team_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.SetRobotMaintenance)
+  return target;
+}
+
+size_t SetRobotMaintenance::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.SetRobotMaintenance)
+  size_t total_size = 0;
+
+  if (_internal_has_robot_number()) {
+    // required uint32 robot_number = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_robot_number());
+  }
+
+  if (_internal_has_maintenance()) {
+    // required bool maintenance = 3;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_team_color()) {
+    // required .llsf_msgs.Team team_color = 4;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+
+  return total_size;
+}
+size_t SetRobotMaintenance::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.SetRobotMaintenance)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint32 robot_number = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_robot_number());
+
+    // required bool maintenance = 3;
+    total_size += 1 + 1;
+
+    // required .llsf_msgs.Team team_color = 4;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetRobotMaintenance::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetRobotMaintenance::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetRobotMaintenance::GetClassData() const { return &_class_data_; }
+
+
+void SetRobotMaintenance::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetRobotMaintenance*>(&to_msg);
+  auto& from = static_cast<const SetRobotMaintenance&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.SetRobotMaintenance)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.robot_number_ = from._impl_.robot_number_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.maintenance_ = from._impl_.maintenance_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetRobotMaintenance::CopyFrom(const SetRobotMaintenance& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.SetRobotMaintenance)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetRobotMaintenance::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SetRobotMaintenance::InternalSwap(SetRobotMaintenance* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetRobotMaintenance, _impl_.team_color_)
+      + sizeof(SetRobotMaintenance::_impl_.team_color_)
+      - PROTOBUF_FIELD_OFFSET(SetRobotMaintenance, _impl_.robot_number_)>(
+          reinterpret_cast<char*>(&_impl_.robot_number_),
+          reinterpret_cast<char*>(&other->_impl_.robot_number_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetRobotMaintenance::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_RobotCommands_2eproto_getter, &descriptor_table_RobotCommands_2eproto_once,
+      file_level_metadata_RobotCommands_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::SetRobotMaintenance*
+Arena::CreateMaybeMessage< ::llsf_msgs::SetRobotMaintenance >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::SetRobotMaintenance >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
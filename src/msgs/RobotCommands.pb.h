@@ -0,0 +1,422 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: RobotCommands.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_RobotCommands_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_RobotCommands_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Team.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_RobotCommands_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_RobotCommands_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_RobotCommands_2eproto;
+namespace llsf_msgs {
+class SetRobotMaintenance;
+struct SetRobotMaintenanceDefaultTypeInternal;
+extern SetRobotMaintenanceDefaultTypeInternal _SetRobotMaintenance_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::SetRobotMaintenance* Arena::CreateMaybeMessage<::llsf_msgs::SetRobotMaintenance>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum SetRobotMaintenance_CompType : int {
+  SetRobotMaintenance_CompType_COMP_ID = 2000,
+  SetRobotMaintenance_CompType_MSG_TYPE = 91
+};
+bool SetRobotMaintenance_CompType_IsValid(int value);
+constexpr SetRobotMaintenance_CompType SetRobotMaintenance_CompType_CompType_MIN = SetRobotMaintenance_CompType_MSG_TYPE;
+constexpr SetRobotMaintenance_CompType SetRobotMaintenance_CompType_CompType_MAX = SetRobotMaintenance_CompType_COMP_ID;
+constexpr int SetRobotMaintenance_CompType_CompType_ARRAYSIZE = SetRobotMaintenance_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetRobotMaintenance_CompType_descriptor();
+template<typename T>
+inline const std::string& SetRobotMaintenance_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SetRobotMaintenance_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SetRobotMaintenance_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SetRobotMaintenance_CompType_descriptor(), enum_t_value);
+}
+inline bool SetRobotMaintenance_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SetRobotMaintenance_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SetRobotMaintenance_CompType>(
+    SetRobotMaintenance_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class SetRobotMaintenance final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.SetRobotMaintenance) */ {
+ public:
+  inline SetRobotMaintenance() : SetRobotMaintenance(nullptr) {}
+  ~SetRobotMaintenance() override;
+  explicit PROTOBUF_CONSTEXPR SetRobotMaintenance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetRobotMaintenance(const SetRobotMaintenance& from);
+  SetRobotMaintenance(SetRobotMaintenance&& from) noexcept
+    : SetRobotMaintenance() {
+    *this = ::std::move(from);
+  }
+
+  inline SetRobotMaintenance& operator=(const SetRobotMaintenance& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetRobotMaintenance& operator=(SetRobotMaintenance&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetRobotMaintenance& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetRobotMaintenance* internal_default_instance() {
+    return reinterpret_cast<const SetRobotMaintenance*>(
+               &_SetRobotMaintenance_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SetRobotMaintenance& a, SetRobotMaintenance& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetRobotMaintenance* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetRobotMaintenance* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetRobotMaintenance* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetRobotMaintenance>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetRobotMaintenance& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetRobotMaintenance& from) {
+    SetRobotMaintenance::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetRobotMaintenance* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.SetRobotMaintenance";
+  }
+  protected:
+  explicit SetRobotMaintenance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SetRobotMaintenance_CompType CompType;
+  static constexpr CompType COMP_ID =
+    SetRobotMaintenance_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    SetRobotMaintenance_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return SetRobotMaintenance_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    SetRobotMaintenance_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    SetRobotMaintenance_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    SetRobotMaintenance_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return SetRobotMaintenance_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return SetRobotMaintenance_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return SetRobotMaintenance_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRobotNumberFieldNumber = 1,
+    kMaintenanceFieldNumber = 3,
+    kTeamColorFieldNumber = 4,
+  };
+  // required uint32 robot_number = 1;
+  bool has_robot_number() const;
+  private:
+  bool _internal_has_robot_number() const;
+  public:
+  void clear_robot_number();
+  uint32_t robot_number() const;
+  void set_robot_number(uint32_t value);
+  private:
+  uint32_t _internal_robot_number() const;
+  void _internal_set_robot_number(uint32_t value);
+  public:
+
+  // required bool maintenance = 3;
+  bool has_maintenance() const;
+  private:
+  bool _internal_has_maintenance() const;
+  public:
+  void clear_maintenance();
+  bool maintenance() const;
+  void set_maintenance(bool value);
+  private:
+  bool _internal_maintenance() const;
+  void _internal_set_maintenance(bool value);
+  public:
+
+  // required .llsf_msgs.Team team_color = 4;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.SetRobotMaintenance)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t robot_number_;
+    bool maintenance_;
+    int team_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_RobotCommands_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SetRobotMaintenance
+
+// required uint32 robot_number = 1;
+inline bool SetRobotMaintenance::_internal_has_robot_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SetRobotMaintenance::has_robot_number() const {
+  return _internal_has_robot_number();
+}
+inline void SetRobotMaintenance::clear_robot_number() {
+  _impl_.robot_number_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t SetRobotMaintenance::_internal_robot_number() const {
+  return _impl_.robot_number_;
+}
+inline uint32_t SetRobotMaintenance::robot_number() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetRobotMaintenance.robot_number)
+  return _internal_robot_number();
+}
+inline void SetRobotMaintenance::_internal_set_robot_number(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.robot_number_ = value;
+}
+inline void SetRobotMaintenance::set_robot_number(uint32_t value) {
+  _internal_set_robot_number(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetRobotMaintenance.robot_number)
+}
+
+// required bool maintenance = 3;
+inline bool SetRobotMaintenance::_internal_has_maintenance() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SetRobotMaintenance::has_maintenance() const {
+  return _internal_has_maintenance();
+}
+inline void SetRobotMaintenance::clear_maintenance() {
+  _impl_.maintenance_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool SetRobotMaintenance::_internal_maintenance() const {
+  return _impl_.maintenance_;
+}
+inline bool SetRobotMaintenance::maintenance() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetRobotMaintenance.maintenance)
+  return _internal_maintenance();
+}
+inline void SetRobotMaintenance::_internal_set_maintenance(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.maintenance_ = value;
+}
+inline void SetRobotMaintenance::set_maintenance(bool value) {
+  _internal_set_maintenance(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetRobotMaintenance.maintenance)
+}
+
+// required .llsf_msgs.Team team_color = 4;
+inline bool SetRobotMaintenance::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SetRobotMaintenance::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void SetRobotMaintenance::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::llsf_msgs::Team SetRobotMaintenance::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team SetRobotMaintenance::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SetRobotMaintenance.team_color)
+  return _internal_team_color();
+}
+inline void SetRobotMaintenance::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.team_color_ = value;
+}
+inline void SetRobotMaintenance::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SetRobotMaintenance.team_color)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::SetRobotMaintenance_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::SetRobotMaintenance_CompType>() {
+  return ::llsf_msgs::SetRobotMaintenance_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_RobotCommands_2eproto
@@ -0,0 +1,1123 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: RobotInfo.proto
+
+#include "RobotInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR Robot::Robot(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.team_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.host_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.last_seen_)*/nullptr
+  , /*decltype(_impl_.pose_)*/nullptr
+  , /*decltype(_impl_.vision_pose_)*/nullptr
+  , /*decltype(_impl_.number_)*/0u
+  , /*decltype(_impl_.maintenance_time_remaining_)*/0
+  , /*decltype(_impl_.maintenance_cycles_)*/0u
+  , /*decltype(_impl_.team_color_)*/0
+  , /*decltype(_impl_.state_)*/1} {}
+struct RobotDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RobotDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RobotDefaultTypeInternal() {}
+  union {
+    Robot _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RobotDefaultTypeInternal _Robot_default_instance_;
+PROTOBUF_CONSTEXPR RobotInfo::RobotInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.robots_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RobotInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RobotInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RobotInfoDefaultTypeInternal() {}
+  union {
+    RobotInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RobotInfoDefaultTypeInternal _RobotInfo_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_RobotInfo_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_RobotInfo_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_RobotInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_RobotInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.team_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.team_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.number_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.host_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.last_seen_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.pose_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.vision_pose_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.maintenance_time_remaining_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Robot, _impl_.maintenance_cycles_),
+  0,
+  1,
+  9,
+  6,
+  2,
+  3,
+  4,
+  5,
+  10,
+  7,
+  8,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::RobotInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::RobotInfo, _impl_.robots_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 17, -1, sizeof(::llsf_msgs::Robot)},
+  { 28, -1, -1, sizeof(::llsf_msgs::RobotInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_Robot_default_instance_._instance,
+  &::llsf_msgs::_RobotInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_RobotInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017RobotInfo.proto\022\tllsf_msgs\032\nTime.proto"
+  "\032\014Pose2D.proto\032\nTeam.proto\"\344\002\n\005Robot\022\014\n\004"
+  "name\030\001 \002(\t\022\014\n\004team\030\002 \002(\t\022#\n\nteam_color\030\014"
+  " \002(\0162\017.llsf_msgs.Team\022\016\n\006number\030\007 \002(\r\022\014\n"
+  "\004host\030\003 \002(\t\022\"\n\tlast_seen\030\004 \002(\0132\017.llsf_ms"
+  "gs.Time\022\037\n\004pose\030\006 \001(\0132\021.llsf_msgs.Pose2D"
+  "\022&\n\013vision_pose\030\013 \001(\0132\021.llsf_msgs.Pose2D"
+  "\022$\n\005state\030\010 \001(\0162\025.llsf_msgs.RobotState\022%"
+  "\n\032maintenance_time_remaining\030\t \001(\002:\0010\022\032\n"
+  "\022maintenance_cycles\030\n \001(\r\"&\n\010CompType\022\014\n"
+  "\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020\037\"U\n\tRobotInfo\022 "
+  "\n\006robots\030\001 \003(\0132\020.llsf_msgs.Robot\"&\n\010Comp"
+  "Type\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\020\036*;\n\nRobo"
+  "tState\022\n\n\006ACTIVE\020\001\022\017\n\013MAINTENANCE\020\002\022\020\n\014D"
+  "ISQUALIFIED\020\003B2\n\037org.robocup_logistics.l"
+  "lsf_msgsB\017RobotInfoProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_RobotInfo_2eproto_deps[3] = {
+  &::descriptor_table_Pose2D_2eproto,
+  &::descriptor_table_Team_2eproto,
+  &::descriptor_table_Time_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_RobotInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_RobotInfo_2eproto = {
+    false, false, 625, descriptor_table_protodef_RobotInfo_2eproto,
+    "RobotInfo.proto",
+    &descriptor_table_RobotInfo_2eproto_once, descriptor_table_RobotInfo_2eproto_deps, 3, 2,
+    schemas, file_default_instances, TableStruct_RobotInfo_2eproto::offsets,
+    file_level_metadata_RobotInfo_2eproto, file_level_enum_descriptors_RobotInfo_2eproto,
+    file_level_service_descriptors_RobotInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_RobotInfo_2eproto_getter() {
+  return &descriptor_table_RobotInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_RobotInfo_2eproto(&descriptor_table_RobotInfo_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Robot_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_RobotInfo_2eproto);
+  return file_level_enum_descriptors_RobotInfo_2eproto[0];
+}
+bool Robot_CompType_IsValid(int value) {
+  switch (value) {
+    case 31:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Robot_CompType Robot::COMP_ID;
+constexpr Robot_CompType Robot::MSG_TYPE;
+constexpr Robot_CompType Robot::CompType_MIN;
+constexpr Robot_CompType Robot::CompType_MAX;
+constexpr int Robot::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RobotInfo_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_RobotInfo_2eproto);
+  return file_level_enum_descriptors_RobotInfo_2eproto[1];
+}
+bool RobotInfo_CompType_IsValid(int value) {
+  switch (value) {
+    case 30:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr RobotInfo_CompType RobotInfo::COMP_ID;
+constexpr RobotInfo_CompType RobotInfo::MSG_TYPE;
+constexpr RobotInfo_CompType RobotInfo::CompType_MIN;
+constexpr RobotInfo_CompType RobotInfo::CompType_MAX;
+constexpr int RobotInfo::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RobotState_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_RobotInfo_2eproto);
+  return file_level_enum_descriptors_RobotInfo_2eproto[2];
+}
+bool RobotState_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class Robot::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Robot>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_team(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_host(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::llsf_msgs::Time& last_seen(const Robot* msg);
+  static void set_has_last_seen(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::llsf_msgs::Pose2D& pose(const Robot* msg);
+  static void set_has_pose(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::llsf_msgs::Pose2D& vision_pose(const Robot* msg);
+  static void set_has_vision_pose(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_maintenance_time_remaining(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_maintenance_cycles(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000024f) ^ 0x0000024f) != 0;
+  }
+};
+
+const ::llsf_msgs::Time&
+Robot::_Internal::last_seen(const Robot* msg) {
+  return *msg->_impl_.last_seen_;
+}
+const ::llsf_msgs::Pose2D&
+Robot::_Internal::pose(const Robot* msg) {
+  return *msg->_impl_.pose_;
+}
+const ::llsf_msgs::Pose2D&
+Robot::_Internal::vision_pose(const Robot* msg) {
+  return *msg->_impl_.vision_pose_;
+}
+void Robot::clear_last_seen() {
+  if (_impl_.last_seen_ != nullptr) _impl_.last_seen_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+void Robot::clear_pose() {
+  if (_impl_.pose_ != nullptr) _impl_.pose_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+void Robot::clear_vision_pose() {
+  if (_impl_.vision_pose_ != nullptr) _impl_.vision_pose_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+Robot::Robot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.Robot)
+}
+Robot::Robot(const Robot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Robot* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.team_){}
+    , decltype(_impl_.host_){}
+    , decltype(_impl_.last_seen_){nullptr}
+    , decltype(_impl_.pose_){nullptr}
+    , decltype(_impl_.vision_pose_){nullptr}
+    , decltype(_impl_.number_){}
+    , decltype(_impl_.maintenance_time_remaining_){}
+    , decltype(_impl_.maintenance_cycles_){}
+    , decltype(_impl_.team_color_){}
+    , decltype(_impl_.state_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.team_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.team_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_team()) {
+    _this->_impl_.team_.Set(from._internal_team(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.host_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.host_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_host()) {
+    _this->_impl_.host_.Set(from._internal_host(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_last_seen()) {
+    _this->_impl_.last_seen_ = new ::llsf_msgs::Time(*from._impl_.last_seen_);
+  }
+  if (from._internal_has_pose()) {
+    _this->_impl_.pose_ = new ::llsf_msgs::Pose2D(*from._impl_.pose_);
+  }
+  if (from._internal_has_vision_pose()) {
+    _this->_impl_.vision_pose_ = new ::llsf_msgs::Pose2D(*from._impl_.vision_pose_);
+  }
+  ::memcpy(&_impl_.number_, &from._impl_.number_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.state_) -
+    reinterpret_cast<char*>(&_impl_.number_)) + sizeof(_impl_.state_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.Robot)
+}
+
+inline void Robot::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.team_){}
+    , decltype(_impl_.host_){}
+    , decltype(_impl_.last_seen_){nullptr}
+    , decltype(_impl_.pose_){nullptr}
+    , decltype(_impl_.vision_pose_){nullptr}
+    , decltype(_impl_.number_){0u}
+    , decltype(_impl_.maintenance_time_remaining_){0}
+    , decltype(_impl_.maintenance_cycles_){0u}
+    , decltype(_impl_.team_color_){0}
+    , decltype(_impl_.state_){1}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.team_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.team_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.host_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.host_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Robot::~Robot() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.Robot)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Robot::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.team_.Destroy();
+  _impl_.host_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.last_seen_;
+  if (this != internal_default_instance()) delete _impl_.pose_;
+  if (this != internal_default_instance()) delete _impl_.vision_pose_;
+}
+
+void Robot::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Robot::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.Robot)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.team_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.host_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.last_seen_ != nullptr);
+      _impl_.last_seen_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.pose_ != nullptr);
+      _impl_.pose_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.vision_pose_ != nullptr);
+      _impl_.vision_pose_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000c0u) {
+    ::memset(&_impl_.number_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.maintenance_time_remaining_) -
+        reinterpret_cast<char*>(&_impl_.number_)) + sizeof(_impl_.maintenance_time_remaining_));
+  }
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.maintenance_cycles_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.team_color_) -
+        reinterpret_cast<char*>(&_impl_.maintenance_cycles_)) + sizeof(_impl_.team_color_));
+    _impl_.state_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Robot::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.Robot.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string team = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_team();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.Robot.team");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string host = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_host();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.Robot.host");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.Time last_seen = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_last_seen(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Pose2D pose = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pose(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 number = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_number(&has_bits);
+          _impl_.number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.RobotState state = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::RobotState_IsValid(val))) {
+            _internal_set_state(static_cast<::llsf_msgs::RobotState>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(8, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float maintenance_time_remaining = 9 [default = 0];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_maintenance_time_remaining(&has_bits);
+          _impl_.maintenance_time_remaining_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 maintenance_cycles = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_maintenance_cycles(&has_bits);
+          _impl_.maintenance_cycles_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Pose2D vision_pose = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_vision_pose(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.Team team_color = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(12, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Robot::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.Robot)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.Robot.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // required string team = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_team().data(), static_cast<int>(this->_internal_team().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.Robot.team");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_team(), target);
+  }
+
+  // required string host = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_host().data(), static_cast<int>(this->_internal_host().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.Robot.host");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_host(), target);
+  }
+
+  // required .llsf_msgs.Time last_seen = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::last_seen(this),
+        _Internal::last_seen(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .llsf_msgs.Pose2D pose = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::pose(this),
+        _Internal::pose(this).GetCachedSize(), target, stream);
+  }
+
+  // required uint32 number = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_number(), target);
+  }
+
+  // optional .llsf_msgs.RobotState state = 8;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_state(), target);
+  }
+
+  // optional float maintenance_time_remaining = 9 [default = 0];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_maintenance_time_remaining(), target);
+  }
+
+  // optional uint32 maintenance_cycles = 10;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_maintenance_cycles(), target);
+  }
+
+  // optional .llsf_msgs.Pose2D vision_pose = 11;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::vision_pose(this),
+        _Internal::vision_pose(this).GetCachedSize(), target, stream);
+  }
+
+  // required .llsf_msgs.Team team_color = 12;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      12, this->_internal_team_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.Robot)
+  return target;
+}
+
+size_t Robot::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.Robot)
+  size_t total_size = 0;
+
+  if (_internal_has_name()) {
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  if (_internal_has_team()) {
+    // required string team = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_team());
+  }
+
+  if (_internal_has_host()) {
+    // required string host = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_host());
+  }
+
+  if (_internal_has_last_seen()) {
+    // required .llsf_msgs.Time last_seen = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.last_seen_);
+  }
+
+  if (_internal_has_number()) {
+    // required uint32 number = 7;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_number());
+  }
+
+  if (_internal_has_team_color()) {
+    // required .llsf_msgs.Team team_color = 12;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+  }
+
+  return total_size;
+}
+size_t Robot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.Robot)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000024f) ^ 0x0000024f) == 0) {  // All required fields are present.
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required string team = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_team());
+
+    // required string host = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_host());
+
+    // required .llsf_msgs.Time last_seen = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.last_seen_);
+
+    // required uint32 number = 7;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_number());
+
+    // required .llsf_msgs.Team team_color = 12;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000030u) {
+    // optional .llsf_msgs.Pose2D pose = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pose_);
+    }
+
+    // optional .llsf_msgs.Pose2D vision_pose = 11;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.vision_pose_);
+    }
+
+  }
+  // optional float maintenance_time_remaining = 9 [default = 0];
+  if (cached_has_bits & 0x00000080u) {
+    total_size += 1 + 4;
+  }
+
+  // optional uint32 maintenance_cycles = 10;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_maintenance_cycles());
+  }
+
+  // optional .llsf_msgs.RobotState state = 8;
+  if (cached_has_bits & 0x00000400u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Robot::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Robot::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Robot::GetClassData() const { return &_class_data_; }
+
+
+void Robot::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Robot*>(&to_msg);
+  auto& from = static_cast<const Robot&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.Robot)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_team(from._internal_team());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_host(from._internal_host());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_last_seen()->::llsf_msgs::Time::MergeFrom(
+          from._internal_last_seen());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_pose()->::llsf_msgs::Pose2D::MergeFrom(
+          from._internal_pose());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_vision_pose()->::llsf_msgs::Pose2D::MergeFrom(
+          from._internal_vision_pose());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.number_ = from._impl_.number_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.maintenance_time_remaining_ = from._impl_.maintenance_time_remaining_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.maintenance_cycles_ = from._impl_.maintenance_cycles_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.state_ = from._impl_.state_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Robot::CopyFrom(const Robot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.Robot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Robot::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_last_seen()) {
+    if (!_impl_.last_seen_->IsInitialized()) return false;
+  }
+  if (_internal_has_pose()) {
+    if (!_impl_.pose_->IsInitialized()) return false;
+  }
+  if (_internal_has_vision_pose()) {
+    if (!_impl_.vision_pose_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Robot::InternalSwap(Robot* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.team_, lhs_arena,
+      &other->_impl_.team_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.host_, lhs_arena,
+      &other->_impl_.host_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Robot, _impl_.team_color_)
+      + sizeof(Robot::_impl_.team_color_)
+      - PROTOBUF_FIELD_OFFSET(Robot, _impl_.last_seen_)>(
+          reinterpret_cast<char*>(&_impl_.last_seen_),
+          reinterpret_cast<char*>(&other->_impl_.last_seen_));
+  swap(_impl_.state_, other->_impl_.state_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Robot::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_RobotInfo_2eproto_getter, &descriptor_table_RobotInfo_2eproto_once,
+      file_level_metadata_RobotInfo_2eproto[0]);
+}
+
+// ===================================================================
+
+class RobotInfo::_Internal {
+ public:
+};
+
+RobotInfo::RobotInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.RobotInfo)
+}
+RobotInfo::RobotInfo(const RobotInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RobotInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.robots_){from._impl_.robots_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.RobotInfo)
+}
+
+inline void RobotInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.robots_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RobotInfo::~RobotInfo() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.RobotInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RobotInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.robots_.~RepeatedPtrField();
+}
+
+void RobotInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RobotInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.RobotInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.robots_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RobotInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .llsf_msgs.Robot robots = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_robots(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RobotInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.RobotInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Robot robots = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_robots_size()); i < n; i++) {
+    const auto& repfield = this->_internal_robots(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.RobotInfo)
+  return target;
+}
+
+size_t RobotInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.RobotInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Robot robots = 1;
+  total_size += 1UL * this->_internal_robots_size();
+  for (const auto& msg : this->_impl_.robots_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RobotInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RobotInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RobotInfo::GetClassData() const { return &_class_data_; }
+
+
+void RobotInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RobotInfo*>(&to_msg);
+  auto& from = static_cast<const RobotInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.RobotInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.robots_.MergeFrom(from._impl_.robots_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RobotInfo::CopyFrom(const RobotInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.RobotInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RobotInfo::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.robots_))
+    return false;
+  return true;
+}
+
+void RobotInfo::InternalSwap(RobotInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.robots_.InternalSwap(&other->_impl_.robots_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RobotInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_RobotInfo_2eproto_getter, &descriptor_table_RobotInfo_2eproto_once,
+      file_level_metadata_RobotInfo_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::Robot*
+Arena::CreateMaybeMessage< ::llsf_msgs::Robot >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::Robot >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::RobotInfo*
+Arena::CreateMaybeMessage< ::llsf_msgs::RobotInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::RobotInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1397 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: RobotInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_RobotInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_RobotInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Time.pb.h"
+#include "Pose2D.pb.h"
+#include "Team.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_RobotInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_RobotInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_RobotInfo_2eproto;
+namespace llsf_msgs {
+class Robot;
+struct RobotDefaultTypeInternal;
+extern RobotDefaultTypeInternal _Robot_default_instance_;
+class RobotInfo;
+struct RobotInfoDefaultTypeInternal;
+extern RobotInfoDefaultTypeInternal _RobotInfo_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::Robot* Arena::CreateMaybeMessage<::llsf_msgs::Robot>(Arena*);
+template<> ::llsf_msgs::RobotInfo* Arena::CreateMaybeMessage<::llsf_msgs::RobotInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum Robot_CompType : int {
+  Robot_CompType_COMP_ID = 2000,
+  Robot_CompType_MSG_TYPE = 31
+};
+bool Robot_CompType_IsValid(int value);
+constexpr Robot_CompType Robot_CompType_CompType_MIN = Robot_CompType_MSG_TYPE;
+constexpr Robot_CompType Robot_CompType_CompType_MAX = Robot_CompType_COMP_ID;
+constexpr int Robot_CompType_CompType_ARRAYSIZE = Robot_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Robot_CompType_descriptor();
+template<typename T>
+inline const std::string& Robot_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Robot_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Robot_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Robot_CompType_descriptor(), enum_t_value);
+}
+inline bool Robot_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Robot_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Robot_CompType>(
+    Robot_CompType_descriptor(), name, value);
+}
+enum RobotInfo_CompType : int {
+  RobotInfo_CompType_COMP_ID = 2000,
+  RobotInfo_CompType_MSG_TYPE = 30
+};
+bool RobotInfo_CompType_IsValid(int value);
+constexpr RobotInfo_CompType RobotInfo_CompType_CompType_MIN = RobotInfo_CompType_MSG_TYPE;
+constexpr RobotInfo_CompType RobotInfo_CompType_CompType_MAX = RobotInfo_CompType_COMP_ID;
+constexpr int RobotInfo_CompType_CompType_ARRAYSIZE = RobotInfo_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RobotInfo_CompType_descriptor();
+template<typename T>
+inline const std::string& RobotInfo_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RobotInfo_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RobotInfo_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RobotInfo_CompType_descriptor(), enum_t_value);
+}
+inline bool RobotInfo_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RobotInfo_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RobotInfo_CompType>(
+    RobotInfo_CompType_descriptor(), name, value);
+}
+enum RobotState : int {
+  ACTIVE = 1,
+  MAINTENANCE = 2,
+  DISQUALIFIED = 3
+};
+bool RobotState_IsValid(int value);
+constexpr RobotState RobotState_MIN = ACTIVE;
+constexpr RobotState RobotState_MAX = DISQUALIFIED;
+constexpr int RobotState_ARRAYSIZE = RobotState_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RobotState_descriptor();
+template<typename T>
+inline const std::string& RobotState_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RobotState>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RobotState_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RobotState_descriptor(), enum_t_value);
+}
+inline bool RobotState_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RobotState* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RobotState>(
+    RobotState_descriptor(), name, value);
+}
+// ===================================================================
+
+class Robot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.Robot) */ {
+ public:
+  inline Robot() : Robot(nullptr) {}
+  ~Robot() override;
+  explicit PROTOBUF_CONSTEXPR Robot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Robot(const Robot& from);
+  Robot(Robot&& from) noexcept
+    : Robot() {
+    *this = ::std::move(from);
+  }
+
+  inline Robot& operator=(const Robot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Robot& operator=(Robot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Robot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Robot* internal_default_instance() {
+    return reinterpret_cast<const Robot*>(
+               &_Robot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Robot& a, Robot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Robot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Robot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Robot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Robot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Robot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Robot& from) {
+    Robot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Robot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.Robot";
+  }
+  protected:
+  explicit Robot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Robot_CompType CompType;
+  static constexpr CompType COMP_ID =
+    Robot_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    Robot_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return Robot_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    Robot_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    Robot_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    Robot_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return Robot_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return Robot_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return Robot_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kTeamFieldNumber = 2,
+    kHostFieldNumber = 3,
+    kLastSeenFieldNumber = 4,
+    kPoseFieldNumber = 6,
+    kVisionPoseFieldNumber = 11,
+    kNumberFieldNumber = 7,
+    kMaintenanceTimeRemainingFieldNumber = 9,
+    kMaintenanceCyclesFieldNumber = 10,
+    kTeamColorFieldNumber = 12,
+    kStateFieldNumber = 8,
+  };
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // required string team = 2;
+  bool has_team() const;
+  private:
+  bool _internal_has_team() const;
+  public:
+  void clear_team();
+  const std::string& team() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_team(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_team();
+  PROTOBUF_NODISCARD std::string* release_team();
+  void set_allocated_team(std::string* team);
+  private:
+  const std::string& _internal_team() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_team(const std::string& value);
+  std::string* _internal_mutable_team();
+  public:
+
+  // required string host = 3;
+  bool has_host() const;
+  private:
+  bool _internal_has_host() const;
+  public:
+  void clear_host();
+  const std::string& host() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_host(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_host();
+  PROTOBUF_NODISCARD std::string* release_host();
+  void set_allocated_host(std::string* host);
+  private:
+  const std::string& _internal_host() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host(const std::string& value);
+  std::string* _internal_mutable_host();
+  public:
+
+  // required .llsf_msgs.Time last_seen = 4;
+  bool has_last_seen() const;
+  private:
+  bool _internal_has_last_seen() const;
+  public:
+  void clear_last_seen();
+  const ::llsf_msgs::Time& last_seen() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::Time* release_last_seen();
+  ::llsf_msgs::Time* mutable_last_seen();
+  void set_allocated_last_seen(::llsf_msgs::Time* last_seen);
+  private:
+  const ::llsf_msgs::Time& _internal_last_seen() const;
+  ::llsf_msgs::Time* _internal_mutable_last_seen();
+  public:
+  void unsafe_arena_set_allocated_last_seen(
+      ::llsf_msgs::Time* last_seen);
+  ::llsf_msgs::Time* unsafe_arena_release_last_seen();
+
+  // optional .llsf_msgs.Pose2D pose = 6;
+  bool has_pose() const;
+  private:
+  bool _internal_has_pose() const;
+  public:
+  void clear_pose();
+  const ::llsf_msgs::Pose2D& pose() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::Pose2D* release_pose();
+  ::llsf_msgs::Pose2D* mutable_pose();
+  void set_allocated_pose(::llsf_msgs::Pose2D* pose);
+  private:
+  const ::llsf_msgs::Pose2D& _internal_pose() const;
+  ::llsf_msgs::Pose2D* _internal_mutable_pose();
+  public:
+  void unsafe_arena_set_allocated_pose(
+      ::llsf_msgs::Pose2D* pose);
+  ::llsf_msgs::Pose2D* unsafe_arena_release_pose();
+
+  // optional .llsf_msgs.Pose2D vision_pose = 11;
+  bool has_vision_pose() const;
+  private:
+  bool _internal_has_vision_pose() const;
+  public:
+  void clear_vision_pose();
+  const ::llsf_msgs::Pose2D& vision_pose() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::Pose2D* release_vision_pose();
+  ::llsf_msgs::Pose2D* mutable_vision_pose();
+  void set_allocated_vision_pose(::llsf_msgs::Pose2D* vision_pose);
+  private:
+  const ::llsf_msgs::Pose2D& _internal_vision_pose() const;
+  ::llsf_msgs::Pose2D* _internal_mutable_vision_pose();
+  public:
+  void unsafe_arena_set_allocated_vision_pose(
+      ::llsf_msgs::Pose2D* vision_pose);
+  ::llsf_msgs::Pose2D* unsafe_arena_release_vision_pose();
+
+  // required uint32 number = 7;
+  bool has_number() const;
+  private:
+  bool _internal_has_number() const;
+  public:
+  void clear_number();
+  uint32_t number() const;
+  void set_number(uint32_t value);
+  private:
+  uint32_t _internal_number() const;
+  void _internal_set_number(uint32_t value);
+  public:
+
+  // optional float maintenance_time_remaining = 9 [default = 0];
+  bool has_maintenance_time_remaining() const;
+  private:
+  bool _internal_has_maintenance_time_remaining() const;
+  public:
+  void clear_maintenance_time_remaining();
+  float maintenance_time_remaining() const;
+  void set_maintenance_time_remaining(float value);
+  private:
+  float _internal_maintenance_time_remaining() const;
+  void _internal_set_maintenance_time_remaining(float value);
+  public:
+
+  // optional uint32 maintenance_cycles = 10;
+  bool has_maintenance_cycles() const;
+  private:
+  bool _internal_has_maintenance_cycles() const;
+  public:
+  void clear_maintenance_cycles();
+  uint32_t maintenance_cycles() const;
+  void set_maintenance_cycles(uint32_t value);
+  private:
+  uint32_t _internal_maintenance_cycles() const;
+  void _internal_set_maintenance_cycles(uint32_t value);
+  public:
+
+  // required .llsf_msgs.Team team_color = 12;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // optional .llsf_msgs.RobotState state = 8;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  ::llsf_msgs::RobotState state() const;
+  void set_state(::llsf_msgs::RobotState value);
+  private:
+  ::llsf_msgs::RobotState _internal_state() const;
+  void _internal_set_state(::llsf_msgs::RobotState value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.Robot)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr team_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr host_;
+    ::llsf_msgs::Time* last_seen_;
+    ::llsf_msgs::Pose2D* pose_;
+    ::llsf_msgs::Pose2D* vision_pose_;
+    uint32_t number_;
+    float maintenance_time_remaining_;
+    uint32_t maintenance_cycles_;
+    int team_color_;
+    int state_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_RobotInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RobotInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.RobotInfo) */ {
+ public:
+  inline RobotInfo() : RobotInfo(nullptr) {}
+  ~RobotInfo() override;
+  explicit PROTOBUF_CONSTEXPR RobotInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RobotInfo(const RobotInfo& from);
+  RobotInfo(RobotInfo&& from) noexcept
+    : RobotInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline RobotInfo& operator=(const RobotInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RobotInfo& operator=(RobotInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RobotInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RobotInfo* internal_default_instance() {
+    return reinterpret_cast<const RobotInfo*>(
+               &_RobotInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RobotInfo& a, RobotInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RobotInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RobotInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RobotInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RobotInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RobotInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RobotInfo& from) {
+    RobotInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RobotInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.RobotInfo";
+  }
+  protected:
+  explicit RobotInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef RobotInfo_CompType CompType;
+  static constexpr CompType COMP_ID =
+    RobotInfo_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    RobotInfo_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return RobotInfo_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    RobotInfo_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    RobotInfo_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    RobotInfo_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return RobotInfo_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return RobotInfo_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return RobotInfo_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRobotsFieldNumber = 1,
+  };
+  // repeated .llsf_msgs.Robot robots = 1;
+  int robots_size() const;
+  private:
+  int _internal_robots_size() const;
+  public:
+  void clear_robots();
+  ::llsf_msgs::Robot* mutable_robots(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Robot >*
+      mutable_robots();
+  private:
+  const ::llsf_msgs::Robot& _internal_robots(int index) const;
+  ::llsf_msgs::Robot* _internal_add_robots();
+  public:
+  const ::llsf_msgs::Robot& robots(int index) const;
+  ::llsf_msgs::Robot* add_robots();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Robot >&
+      robots() const;
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.RobotInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Robot > robots_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_RobotInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Robot
+
+// required string name = 1;
+inline bool Robot::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Robot::has_name() const {
+  return _internal_has_name();
+}
+inline void Robot::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Robot::name() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Robot::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.Robot.name)
+}
+inline std::string* Robot::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Robot.name)
+  return _s;
+}
+inline const std::string& Robot::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Robot::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Robot::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Robot::release_name() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Robot.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Robot::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Robot.name)
+}
+
+// required string team = 2;
+inline bool Robot::_internal_has_team() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Robot::has_team() const {
+  return _internal_has_team();
+}
+inline void Robot::clear_team() {
+  _impl_.team_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Robot::team() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.team)
+  return _internal_team();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Robot::set_team(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.team_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.Robot.team)
+}
+inline std::string* Robot::mutable_team() {
+  std::string* _s = _internal_mutable_team();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Robot.team)
+  return _s;
+}
+inline const std::string& Robot::_internal_team() const {
+  return _impl_.team_.Get();
+}
+inline void Robot::_internal_set_team(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.team_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Robot::_internal_mutable_team() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.team_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Robot::release_team() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Robot.team)
+  if (!_internal_has_team()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.team_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.team_.IsDefault()) {
+    _impl_.team_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Robot::set_allocated_team(std::string* team) {
+  if (team != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.team_.SetAllocated(team, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.team_.IsDefault()) {
+    _impl_.team_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Robot.team)
+}
+
+// required .llsf_msgs.Team team_color = 12;
+inline bool Robot::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Robot::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void Robot::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline ::llsf_msgs::Team Robot::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team Robot::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.team_color)
+  return _internal_team_color();
+}
+inline void Robot::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.team_color_ = value;
+}
+inline void Robot::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Robot.team_color)
+}
+
+// required uint32 number = 7;
+inline bool Robot::_internal_has_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Robot::has_number() const {
+  return _internal_has_number();
+}
+inline void Robot::clear_number() {
+  _impl_.number_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t Robot::_internal_number() const {
+  return _impl_.number_;
+}
+inline uint32_t Robot::number() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.number)
+  return _internal_number();
+}
+inline void Robot::_internal_set_number(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.number_ = value;
+}
+inline void Robot::set_number(uint32_t value) {
+  _internal_set_number(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Robot.number)
+}
+
+// required string host = 3;
+inline bool Robot::_internal_has_host() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Robot::has_host() const {
+  return _internal_has_host();
+}
+inline void Robot::clear_host() {
+  _impl_.host_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Robot::host() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.host)
+  return _internal_host();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Robot::set_host(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.host_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.Robot.host)
+}
+inline std::string* Robot::mutable_host() {
+  std::string* _s = _internal_mutable_host();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Robot.host)
+  return _s;
+}
+inline const std::string& Robot::_internal_host() const {
+  return _impl_.host_.Get();
+}
+inline void Robot::_internal_set_host(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.host_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Robot::_internal_mutable_host() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.host_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Robot::release_host() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Robot.host)
+  if (!_internal_has_host()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.host_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.host_.IsDefault()) {
+    _impl_.host_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Robot::set_allocated_host(std::string* host) {
+  if (host != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.host_.SetAllocated(host, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.host_.IsDefault()) {
+    _impl_.host_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Robot.host)
+}
+
+// required .llsf_msgs.Time last_seen = 4;
+inline bool Robot::_internal_has_last_seen() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.last_seen_ != nullptr);
+  return value;
+}
+inline bool Robot::has_last_seen() const {
+  return _internal_has_last_seen();
+}
+inline const ::llsf_msgs::Time& Robot::_internal_last_seen() const {
+  const ::llsf_msgs::Time* p = _impl_.last_seen_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::Time&>(
+      ::llsf_msgs::_Time_default_instance_);
+}
+inline const ::llsf_msgs::Time& Robot::last_seen() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.last_seen)
+  return _internal_last_seen();
+}
+inline void Robot::unsafe_arena_set_allocated_last_seen(
+    ::llsf_msgs::Time* last_seen) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.last_seen_);
+  }
+  _impl_.last_seen_ = last_seen;
+  if (last_seen) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.Robot.last_seen)
+}
+inline ::llsf_msgs::Time* Robot::release_last_seen() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::llsf_msgs::Time* temp = _impl_.last_seen_;
+  _impl_.last_seen_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::Time* Robot::unsafe_arena_release_last_seen() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Robot.last_seen)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::llsf_msgs::Time* temp = _impl_.last_seen_;
+  _impl_.last_seen_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::Time* Robot::_internal_mutable_last_seen() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.last_seen_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::Time>(GetArenaForAllocation());
+    _impl_.last_seen_ = p;
+  }
+  return _impl_.last_seen_;
+}
+inline ::llsf_msgs::Time* Robot::mutable_last_seen() {
+  ::llsf_msgs::Time* _msg = _internal_mutable_last_seen();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Robot.last_seen)
+  return _msg;
+}
+inline void Robot::set_allocated_last_seen(::llsf_msgs::Time* last_seen) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.last_seen_);
+  }
+  if (last_seen) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(last_seen));
+    if (message_arena != submessage_arena) {
+      last_seen = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, last_seen, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.last_seen_ = last_seen;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Robot.last_seen)
+}
+
+// optional .llsf_msgs.Pose2D pose = 6;
+inline bool Robot::_internal_has_pose() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pose_ != nullptr);
+  return value;
+}
+inline bool Robot::has_pose() const {
+  return _internal_has_pose();
+}
+inline const ::llsf_msgs::Pose2D& Robot::_internal_pose() const {
+  const ::llsf_msgs::Pose2D* p = _impl_.pose_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::Pose2D&>(
+      ::llsf_msgs::_Pose2D_default_instance_);
+}
+inline const ::llsf_msgs::Pose2D& Robot::pose() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.pose)
+  return _internal_pose();
+}
+inline void Robot::unsafe_arena_set_allocated_pose(
+    ::llsf_msgs::Pose2D* pose) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pose_);
+  }
+  _impl_.pose_ = pose;
+  if (pose) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.Robot.pose)
+}
+inline ::llsf_msgs::Pose2D* Robot::release_pose() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::llsf_msgs::Pose2D* temp = _impl_.pose_;
+  _impl_.pose_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::Pose2D* Robot::unsafe_arena_release_pose() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Robot.pose)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::llsf_msgs::Pose2D* temp = _impl_.pose_;
+  _impl_.pose_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::Pose2D* Robot::_internal_mutable_pose() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.pose_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::Pose2D>(GetArenaForAllocation());
+    _impl_.pose_ = p;
+  }
+  return _impl_.pose_;
+}
+inline ::llsf_msgs::Pose2D* Robot::mutable_pose() {
+  ::llsf_msgs::Pose2D* _msg = _internal_mutable_pose();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Robot.pose)
+  return _msg;
+}
+inline void Robot::set_allocated_pose(::llsf_msgs::Pose2D* pose) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pose_);
+  }
+  if (pose) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pose));
+    if (message_arena != submessage_arena) {
+      pose = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pose, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.pose_ = pose;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Robot.pose)
+}
+
+// optional .llsf_msgs.Pose2D vision_pose = 11;
+inline bool Robot::_internal_has_vision_pose() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.vision_pose_ != nullptr);
+  return value;
+}
+inline bool Robot::has_vision_pose() const {
+  return _internal_has_vision_pose();
+}
+inline const ::llsf_msgs::Pose2D& Robot::_internal_vision_pose() const {
+  const ::llsf_msgs::Pose2D* p = _impl_.vision_pose_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::Pose2D&>(
+      ::llsf_msgs::_Pose2D_default_instance_);
+}
+inline const ::llsf_msgs::Pose2D& Robot::vision_pose() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.vision_pose)
+  return _internal_vision_pose();
+}
+inline void Robot::unsafe_arena_set_allocated_vision_pose(
+    ::llsf_msgs::Pose2D* vision_pose) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vision_pose_);
+  }
+  _impl_.vision_pose_ = vision_pose;
+  if (vision_pose) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.Robot.vision_pose)
+}
+inline ::llsf_msgs::Pose2D* Robot::release_vision_pose() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::llsf_msgs::Pose2D* temp = _impl_.vision_pose_;
+  _impl_.vision_pose_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::Pose2D* Robot::unsafe_arena_release_vision_pose() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Robot.vision_pose)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::llsf_msgs::Pose2D* temp = _impl_.vision_pose_;
+  _impl_.vision_pose_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::Pose2D* Robot::_internal_mutable_vision_pose() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.vision_pose_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::Pose2D>(GetArenaForAllocation());
+    _impl_.vision_pose_ = p;
+  }
+  return _impl_.vision_pose_;
+}
+inline ::llsf_msgs::Pose2D* Robot::mutable_vision_pose() {
+  ::llsf_msgs::Pose2D* _msg = _internal_mutable_vision_pose();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Robot.vision_pose)
+  return _msg;
+}
+inline void Robot::set_allocated_vision_pose(::llsf_msgs::Pose2D* vision_pose) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vision_pose_);
+  }
+  if (vision_pose) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(vision_pose));
+    if (message_arena != submessage_arena) {
+      vision_pose = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vision_pose, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.vision_pose_ = vision_pose;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Robot.vision_pose)
+}
+
+// optional .llsf_msgs.RobotState state = 8;
+inline bool Robot::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Robot::has_state() const {
+  return _internal_has_state();
+}
+inline void Robot::clear_state() {
+  _impl_.state_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline ::llsf_msgs::RobotState Robot::_internal_state() const {
+  return static_cast< ::llsf_msgs::RobotState >(_impl_.state_);
+}
+inline ::llsf_msgs::RobotState Robot::state() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.state)
+  return _internal_state();
+}
+inline void Robot::_internal_set_state(::llsf_msgs::RobotState value) {
+  assert(::llsf_msgs::RobotState_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.state_ = value;
+}
+inline void Robot::set_state(::llsf_msgs::RobotState value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Robot.state)
+}
+
+// optional float maintenance_time_remaining = 9 [default = 0];
+inline bool Robot::_internal_has_maintenance_time_remaining() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Robot::has_maintenance_time_remaining() const {
+  return _internal_has_maintenance_time_remaining();
+}
+inline void Robot::clear_maintenance_time_remaining() {
+  _impl_.maintenance_time_remaining_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline float Robot::_internal_maintenance_time_remaining() const {
+  return _impl_.maintenance_time_remaining_;
+}
+inline float Robot::maintenance_time_remaining() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.maintenance_time_remaining)
+  return _internal_maintenance_time_remaining();
+}
+inline void Robot::_internal_set_maintenance_time_remaining(float value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.maintenance_time_remaining_ = value;
+}
+inline void Robot::set_maintenance_time_remaining(float value) {
+  _internal_set_maintenance_time_remaining(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Robot.maintenance_time_remaining)
+}
+
+// optional uint32 maintenance_cycles = 10;
+inline bool Robot::_internal_has_maintenance_cycles() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Robot::has_maintenance_cycles() const {
+  return _internal_has_maintenance_cycles();
+}
+inline void Robot::clear_maintenance_cycles() {
+  _impl_.maintenance_cycles_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t Robot::_internal_maintenance_cycles() const {
+  return _impl_.maintenance_cycles_;
+}
+inline uint32_t Robot::maintenance_cycles() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Robot.maintenance_cycles)
+  return _internal_maintenance_cycles();
+}
+inline void Robot::_internal_set_maintenance_cycles(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.maintenance_cycles_ = value;
+}
+inline void Robot::set_maintenance_cycles(uint32_t value) {
+  _internal_set_maintenance_cycles(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Robot.maintenance_cycles)
+}
+
+// -------------------------------------------------------------------
+
+// RobotInfo
+
+// repeated .llsf_msgs.Robot robots = 1;
+inline int RobotInfo::_internal_robots_size() const {
+  return _impl_.robots_.size();
+}
+inline int RobotInfo::robots_size() const {
+  return _internal_robots_size();
+}
+inline void RobotInfo::clear_robots() {
+  _impl_.robots_.Clear();
+}
+inline ::llsf_msgs::Robot* RobotInfo::mutable_robots(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.RobotInfo.robots)
+  return _impl_.robots_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Robot >*
+RobotInfo::mutable_robots() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.RobotInfo.robots)
+  return &_impl_.robots_;
+}
+inline const ::llsf_msgs::Robot& RobotInfo::_internal_robots(int index) const {
+  return _impl_.robots_.Get(index);
+}
+inline const ::llsf_msgs::Robot& RobotInfo::robots(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.RobotInfo.robots)
+  return _internal_robots(index);
+}
+inline ::llsf_msgs::Robot* RobotInfo::_internal_add_robots() {
+  return _impl_.robots_.Add();
+}
+inline ::llsf_msgs::Robot* RobotInfo::add_robots() {
+  ::llsf_msgs::Robot* _add = _internal_add_robots();
+  // @@protoc_insertion_point(field_add:llsf_msgs.RobotInfo.robots)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Robot >&
+RobotInfo::robots() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.RobotInfo.robots)
+  return _impl_.robots_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::Robot_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::Robot_CompType>() {
+  return ::llsf_msgs::Robot_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::RobotInfo_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::RobotInfo_CompType>() {
+  return ::llsf_msgs::RobotInfo_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::RobotState> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::RobotState>() {
+  return ::llsf_msgs::RobotState_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_RobotInfo_2eproto
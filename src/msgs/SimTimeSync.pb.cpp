@@ -0,0 +1,436 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SimTimeSync.proto
+
+#include "SimTimeSync.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR SimTimeSync::SimTimeSync(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sim_time_)*/nullptr
+  , /*decltype(_impl_.real_time_factor_)*/0
+  , /*decltype(_impl_.paused_)*/false} {}
+struct SimTimeSyncDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SimTimeSyncDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SimTimeSyncDefaultTypeInternal() {}
+  union {
+    SimTimeSync _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SimTimeSyncDefaultTypeInternal _SimTimeSync_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_SimTimeSync_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_SimTimeSync_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_SimTimeSync_2eproto = nullptr;
+
+const uint32_t TableStruct_SimTimeSync_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SimTimeSync, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SimTimeSync, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SimTimeSync, _impl_.sim_time_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SimTimeSync, _impl_.real_time_factor_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::SimTimeSync, _impl_.paused_),
+  0,
+  1,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::llsf_msgs::SimTimeSync)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_SimTimeSync_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_SimTimeSync_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021SimTimeSync.proto\022\tllsf_msgs\032\nTime.pro"
+  "to\"\203\001\n\013SimTimeSync\022!\n\010sim_time\030\001 \002(\0132\017.l"
+  "lsf_msgs.Time\022\030\n\020real_time_factor\030\002 \002(\002\022"
+  "\016\n\006paused\030\003 \002(\010\"\'\n\010CompType\022\014\n\007COMP_ID\020\320"
+  "\017\022\r\n\010MSG_TYPE\020\307\002B4\n\037org.robocup_logistic"
+  "s.llsf_msgsB\021SimTimeSyncProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_SimTimeSync_2eproto_deps[1] = {
+  &::descriptor_table_Time_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_SimTimeSync_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_SimTimeSync_2eproto = {
+    false, false, 230, descriptor_table_protodef_SimTimeSync_2eproto,
+    "SimTimeSync.proto",
+    &descriptor_table_SimTimeSync_2eproto_once, descriptor_table_SimTimeSync_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_SimTimeSync_2eproto::offsets,
+    file_level_metadata_SimTimeSync_2eproto, file_level_enum_descriptors_SimTimeSync_2eproto,
+    file_level_service_descriptors_SimTimeSync_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_SimTimeSync_2eproto_getter() {
+  return &descriptor_table_SimTimeSync_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_SimTimeSync_2eproto(&descriptor_table_SimTimeSync_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SimTimeSync_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_SimTimeSync_2eproto);
+  return file_level_enum_descriptors_SimTimeSync_2eproto[0];
+}
+bool SimTimeSync_CompType_IsValid(int value) {
+  switch (value) {
+    case 327:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SimTimeSync_CompType SimTimeSync::COMP_ID;
+constexpr SimTimeSync_CompType SimTimeSync::MSG_TYPE;
+constexpr SimTimeSync_CompType SimTimeSync::CompType_MIN;
+constexpr SimTimeSync_CompType SimTimeSync::CompType_MAX;
+constexpr int SimTimeSync::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class SimTimeSync::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SimTimeSync>()._impl_._has_bits_);
+  static const ::llsf_msgs::Time& sim_time(const SimTimeSync* msg);
+  static void set_has_sim_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_real_time_factor(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_paused(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::llsf_msgs::Time&
+SimTimeSync::_Internal::sim_time(const SimTimeSync* msg) {
+  return *msg->_impl_.sim_time_;
+}
+void SimTimeSync::clear_sim_time() {
+  if (_impl_.sim_time_ != nullptr) _impl_.sim_time_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+SimTimeSync::SimTimeSync(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.SimTimeSync)
+}
+SimTimeSync::SimTimeSync(const SimTimeSync& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SimTimeSync* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sim_time_){nullptr}
+    , decltype(_impl_.real_time_factor_){}
+    , decltype(_impl_.paused_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_sim_time()) {
+    _this->_impl_.sim_time_ = new ::llsf_msgs::Time(*from._impl_.sim_time_);
+  }
+  ::memcpy(&_impl_.real_time_factor_, &from._impl_.real_time_factor_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.paused_) -
+    reinterpret_cast<char*>(&_impl_.real_time_factor_)) + sizeof(_impl_.paused_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.SimTimeSync)
+}
+
+inline void SimTimeSync::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sim_time_){nullptr}
+    , decltype(_impl_.real_time_factor_){0}
+    , decltype(_impl_.paused_){false}
+  };
+}
+
+SimTimeSync::~SimTimeSync() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.SimTimeSync)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SimTimeSync::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.sim_time_;
+}
+
+void SimTimeSync::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SimTimeSync::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.SimTimeSync)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.sim_time_ != nullptr);
+    _impl_.sim_time_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.real_time_factor_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.paused_) -
+        reinterpret_cast<char*>(&_impl_.real_time_factor_)) + sizeof(_impl_.paused_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SimTimeSync::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .llsf_msgs.Time sim_time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sim_time(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required float real_time_factor = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_real_time_factor(&has_bits);
+          _impl_.real_time_factor_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool paused = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_paused(&has_bits);
+          _impl_.paused_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SimTimeSync::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.SimTimeSync)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .llsf_msgs.Time sim_time = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::sim_time(this),
+        _Internal::sim_time(this).GetCachedSize(), target, stream);
+  }
+
+  // required float real_time_factor = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_real_time_factor(), target);
+  }
+
+  // required bool paused = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_paused(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.SimTimeSync)
+  return target;
+}
+
+size_t SimTimeSync::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.SimTimeSync)
+  size_t total_size = 0;
+
+  if (_internal_has_sim_time()) {
+    // required .llsf_msgs.Time sim_time = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sim_time_);
+  }
+
+  if (_internal_has_real_time_factor()) {
+    // required float real_time_factor = 2;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_paused()) {
+    // required bool paused = 3;
+    total_size += 1 + 1;
+  }
+
+  return total_size;
+}
+size_t SimTimeSync::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.SimTimeSync)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .llsf_msgs.Time sim_time = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sim_time_);
+
+    // required float real_time_factor = 2;
+    total_size += 1 + 4;
+
+    // required bool paused = 3;
+    total_size += 1 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SimTimeSync::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SimTimeSync::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SimTimeSync::GetClassData() const { return &_class_data_; }
+
+
+void SimTimeSync::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SimTimeSync*>(&to_msg);
+  auto& from = static_cast<const SimTimeSync&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.SimTimeSync)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_sim_time()->::llsf_msgs::Time::MergeFrom(
+          from._internal_sim_time());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.real_time_factor_ = from._impl_.real_time_factor_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.paused_ = from._impl_.paused_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SimTimeSync::CopyFrom(const SimTimeSync& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.SimTimeSync)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SimTimeSync::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_sim_time()) {
+    if (!_impl_.sim_time_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void SimTimeSync::InternalSwap(SimTimeSync* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SimTimeSync, _impl_.paused_)
+      + sizeof(SimTimeSync::_impl_.paused_)
+      - PROTOBUF_FIELD_OFFSET(SimTimeSync, _impl_.sim_time_)>(
+          reinterpret_cast<char*>(&_impl_.sim_time_),
+          reinterpret_cast<char*>(&other->_impl_.sim_time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SimTimeSync::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SimTimeSync_2eproto_getter, &descriptor_table_SimTimeSync_2eproto_once,
+      file_level_metadata_SimTimeSync_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::SimTimeSync*
+Arena::CreateMaybeMessage< ::llsf_msgs::SimTimeSync >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::SimTimeSync >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,485 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SimTimeSync.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_SimTimeSync_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_SimTimeSync_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Time.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_SimTimeSync_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_SimTimeSync_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_SimTimeSync_2eproto;
+namespace llsf_msgs {
+class SimTimeSync;
+struct SimTimeSyncDefaultTypeInternal;
+extern SimTimeSyncDefaultTypeInternal _SimTimeSync_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::SimTimeSync* Arena::CreateMaybeMessage<::llsf_msgs::SimTimeSync>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum SimTimeSync_CompType : int {
+  SimTimeSync_CompType_COMP_ID = 2000,
+  SimTimeSync_CompType_MSG_TYPE = 327
+};
+bool SimTimeSync_CompType_IsValid(int value);
+constexpr SimTimeSync_CompType SimTimeSync_CompType_CompType_MIN = SimTimeSync_CompType_MSG_TYPE;
+constexpr SimTimeSync_CompType SimTimeSync_CompType_CompType_MAX = SimTimeSync_CompType_COMP_ID;
+constexpr int SimTimeSync_CompType_CompType_ARRAYSIZE = SimTimeSync_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SimTimeSync_CompType_descriptor();
+template<typename T>
+inline const std::string& SimTimeSync_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SimTimeSync_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SimTimeSync_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SimTimeSync_CompType_descriptor(), enum_t_value);
+}
+inline bool SimTimeSync_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SimTimeSync_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SimTimeSync_CompType>(
+    SimTimeSync_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class SimTimeSync final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.SimTimeSync) */ {
+ public:
+  inline SimTimeSync() : SimTimeSync(nullptr) {}
+  ~SimTimeSync() override;
+  explicit PROTOBUF_CONSTEXPR SimTimeSync(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SimTimeSync(const SimTimeSync& from);
+  SimTimeSync(SimTimeSync&& from) noexcept
+    : SimTimeSync() {
+    *this = ::std::move(from);
+  }
+
+  inline SimTimeSync& operator=(const SimTimeSync& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SimTimeSync& operator=(SimTimeSync&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SimTimeSync& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SimTimeSync* internal_default_instance() {
+    return reinterpret_cast<const SimTimeSync*>(
+               &_SimTimeSync_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SimTimeSync& a, SimTimeSync& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SimTimeSync* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SimTimeSync* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SimTimeSync* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SimTimeSync>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SimTimeSync& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SimTimeSync& from) {
+    SimTimeSync::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SimTimeSync* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.SimTimeSync";
+  }
+  protected:
+  explicit SimTimeSync(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SimTimeSync_CompType CompType;
+  static constexpr CompType COMP_ID =
+    SimTimeSync_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    SimTimeSync_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return SimTimeSync_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    SimTimeSync_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    SimTimeSync_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    SimTimeSync_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return SimTimeSync_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return SimTimeSync_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return SimTimeSync_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSimTimeFieldNumber = 1,
+    kRealTimeFactorFieldNumber = 2,
+    kPausedFieldNumber = 3,
+  };
+  // required .llsf_msgs.Time sim_time = 1;
+  bool has_sim_time() const;
+  private:
+  bool _internal_has_sim_time() const;
+  public:
+  void clear_sim_time();
+  const ::llsf_msgs::Time& sim_time() const;
+  PROTOBUF_NODISCARD ::llsf_msgs::Time* release_sim_time();
+  ::llsf_msgs::Time* mutable_sim_time();
+  void set_allocated_sim_time(::llsf_msgs::Time* sim_time);
+  private:
+  const ::llsf_msgs::Time& _internal_sim_time() const;
+  ::llsf_msgs::Time* _internal_mutable_sim_time();
+  public:
+  void unsafe_arena_set_allocated_sim_time(
+      ::llsf_msgs::Time* sim_time);
+  ::llsf_msgs::Time* unsafe_arena_release_sim_time();
+
+  // required float real_time_factor = 2;
+  bool has_real_time_factor() const;
+  private:
+  bool _internal_has_real_time_factor() const;
+  public:
+  void clear_real_time_factor();
+  float real_time_factor() const;
+  void set_real_time_factor(float value);
+  private:
+  float _internal_real_time_factor() const;
+  void _internal_set_real_time_factor(float value);
+  public:
+
+  // required bool paused = 3;
+  bool has_paused() const;
+  private:
+  bool _internal_has_paused() const;
+  public:
+  void clear_paused();
+  bool paused() const;
+  void set_paused(bool value);
+  private:
+  bool _internal_paused() const;
+  void _internal_set_paused(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.SimTimeSync)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::llsf_msgs::Time* sim_time_;
+    float real_time_factor_;
+    bool paused_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SimTimeSync_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SimTimeSync
+
+// required .llsf_msgs.Time sim_time = 1;
+inline bool SimTimeSync::_internal_has_sim_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.sim_time_ != nullptr);
+  return value;
+}
+inline bool SimTimeSync::has_sim_time() const {
+  return _internal_has_sim_time();
+}
+inline const ::llsf_msgs::Time& SimTimeSync::_internal_sim_time() const {
+  const ::llsf_msgs::Time* p = _impl_.sim_time_;
+  return p != nullptr ? *p : reinterpret_cast<const ::llsf_msgs::Time&>(
+      ::llsf_msgs::_Time_default_instance_);
+}
+inline const ::llsf_msgs::Time& SimTimeSync::sim_time() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SimTimeSync.sim_time)
+  return _internal_sim_time();
+}
+inline void SimTimeSync::unsafe_arena_set_allocated_sim_time(
+    ::llsf_msgs::Time* sim_time) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sim_time_);
+  }
+  _impl_.sim_time_ = sim_time;
+  if (sim_time) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:llsf_msgs.SimTimeSync.sim_time)
+}
+inline ::llsf_msgs::Time* SimTimeSync::release_sim_time() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::llsf_msgs::Time* temp = _impl_.sim_time_;
+  _impl_.sim_time_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::llsf_msgs::Time* SimTimeSync::unsafe_arena_release_sim_time() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.SimTimeSync.sim_time)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::llsf_msgs::Time* temp = _impl_.sim_time_;
+  _impl_.sim_time_ = nullptr;
+  return temp;
+}
+inline ::llsf_msgs::Time* SimTimeSync::_internal_mutable_sim_time() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.sim_time_ == nullptr) {
+    auto* p = CreateMaybeMessage<::llsf_msgs::Time>(GetArenaForAllocation());
+    _impl_.sim_time_ = p;
+  }
+  return _impl_.sim_time_;
+}
+inline ::llsf_msgs::Time* SimTimeSync::mutable_sim_time() {
+  ::llsf_msgs::Time* _msg = _internal_mutable_sim_time();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.SimTimeSync.sim_time)
+  return _msg;
+}
+inline void SimTimeSync::set_allocated_sim_time(::llsf_msgs::Time* sim_time) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sim_time_);
+  }
+  if (sim_time) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(sim_time));
+    if (message_arena != submessage_arena) {
+      sim_time = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sim_time, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.sim_time_ = sim_time;
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.SimTimeSync.sim_time)
+}
+
+// required float real_time_factor = 2;
+inline bool SimTimeSync::_internal_has_real_time_factor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SimTimeSync::has_real_time_factor() const {
+  return _internal_has_real_time_factor();
+}
+inline void SimTimeSync::clear_real_time_factor() {
+  _impl_.real_time_factor_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float SimTimeSync::_internal_real_time_factor() const {
+  return _impl_.real_time_factor_;
+}
+inline float SimTimeSync::real_time_factor() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SimTimeSync.real_time_factor)
+  return _internal_real_time_factor();
+}
+inline void SimTimeSync::_internal_set_real_time_factor(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.real_time_factor_ = value;
+}
+inline void SimTimeSync::set_real_time_factor(float value) {
+  _internal_set_real_time_factor(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SimTimeSync.real_time_factor)
+}
+
+// required bool paused = 3;
+inline bool SimTimeSync::_internal_has_paused() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SimTimeSync::has_paused() const {
+  return _internal_has_paused();
+}
+inline void SimTimeSync::clear_paused() {
+  _impl_.paused_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool SimTimeSync::_internal_paused() const {
+  return _impl_.paused_;
+}
+inline bool SimTimeSync::paused() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.SimTimeSync.paused)
+  return _internal_paused();
+}
+inline void SimTimeSync::_internal_set_paused(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.paused_ = value;
+}
+inline void SimTimeSync::set_paused(bool value) {
+  _internal_set_paused(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.SimTimeSync.paused)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::SimTimeSync_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::SimTimeSync_CompType>() {
+  return ::llsf_msgs::SimTimeSync_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_SimTimeSync_2eproto
@@ -0,0 +1,73 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Team.proto
+
+#include "Team.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+}  // namespace llsf_msgs
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_Team_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Team_2eproto = nullptr;
+const uint32_t TableStruct_Team_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
+
+const char descriptor_table_protodef_Team_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\nTeam.proto\022\tllsf_msgs*\035\n\004Team\022\010\n\004CYAN\020"
+  "\000\022\013\n\007MAGENTA\020\001B-\n\037org.robocup_logistics."
+  "llsf_msgsB\nTeamProtos"
+  ;
+static ::_pbi::once_flag descriptor_table_Team_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Team_2eproto = {
+    false, false, 101, descriptor_table_protodef_Team_2eproto,
+    "Team.proto",
+    &descriptor_table_Team_2eproto_once, nullptr, 0, 0,
+    schemas, file_default_instances, TableStruct_Team_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_Team_2eproto,
+    file_level_service_descriptors_Team_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Team_2eproto_getter() {
+  return &descriptor_table_Team_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Team_2eproto(&descriptor_table_Team_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Team_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_Team_2eproto);
+  return file_level_enum_descriptors_Team_2eproto[0];
+}
+bool Team_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
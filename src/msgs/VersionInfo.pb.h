@@ -0,0 +1,508 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: VersionInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_VersionInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_VersionInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_VersionInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_VersionInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_VersionInfo_2eproto;
+namespace llsf_msgs {
+class VersionInfo;
+struct VersionInfoDefaultTypeInternal;
+extern VersionInfoDefaultTypeInternal _VersionInfo_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::VersionInfo* Arena::CreateMaybeMessage<::llsf_msgs::VersionInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum VersionInfo_CompType : int {
+  VersionInfo_CompType_COMP_ID = 2000,
+  VersionInfo_CompType_MSG_TYPE = 3
+};
+bool VersionInfo_CompType_IsValid(int value);
+constexpr VersionInfo_CompType VersionInfo_CompType_CompType_MIN = VersionInfo_CompType_MSG_TYPE;
+constexpr VersionInfo_CompType VersionInfo_CompType_CompType_MAX = VersionInfo_CompType_COMP_ID;
+constexpr int VersionInfo_CompType_CompType_ARRAYSIZE = VersionInfo_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* VersionInfo_CompType_descriptor();
+template<typename T>
+inline const std::string& VersionInfo_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, VersionInfo_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function VersionInfo_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    VersionInfo_CompType_descriptor(), enum_t_value);
+}
+inline bool VersionInfo_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, VersionInfo_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<VersionInfo_CompType>(
+    VersionInfo_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class VersionInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.VersionInfo) */ {
+ public:
+  inline VersionInfo() : VersionInfo(nullptr) {}
+  ~VersionInfo() override;
+  explicit PROTOBUF_CONSTEXPR VersionInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VersionInfo(const VersionInfo& from);
+  VersionInfo(VersionInfo&& from) noexcept
+    : VersionInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline VersionInfo& operator=(const VersionInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VersionInfo& operator=(VersionInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VersionInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VersionInfo* internal_default_instance() {
+    return reinterpret_cast<const VersionInfo*>(
+               &_VersionInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(VersionInfo& a, VersionInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VersionInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VersionInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VersionInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VersionInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VersionInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VersionInfo& from) {
+    VersionInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VersionInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.VersionInfo";
+  }
+  protected:
+  explicit VersionInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef VersionInfo_CompType CompType;
+  static constexpr CompType COMP_ID =
+    VersionInfo_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    VersionInfo_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return VersionInfo_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    VersionInfo_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    VersionInfo_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    VersionInfo_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return VersionInfo_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return VersionInfo_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return VersionInfo_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionStringFieldNumber = 4,
+    kVersionMajorFieldNumber = 1,
+    kVersionMinorFieldNumber = 2,
+    kVersionMicroFieldNumber = 3,
+  };
+  // required string version_string = 4;
+  bool has_version_string() const;
+  private:
+  bool _internal_has_version_string() const;
+  public:
+  void clear_version_string();
+  const std::string& version_string() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version_string(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version_string();
+  PROTOBUF_NODISCARD std::string* release_version_string();
+  void set_allocated_version_string(std::string* version_string);
+  private:
+  const std::string& _internal_version_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version_string(const std::string& value);
+  std::string* _internal_mutable_version_string();
+  public:
+
+  // required uint32 version_major = 1;
+  bool has_version_major() const;
+  private:
+  bool _internal_has_version_major() const;
+  public:
+  void clear_version_major();
+  uint32_t version_major() const;
+  void set_version_major(uint32_t value);
+  private:
+  uint32_t _internal_version_major() const;
+  void _internal_set_version_major(uint32_t value);
+  public:
+
+  // required uint32 version_minor = 2;
+  bool has_version_minor() const;
+  private:
+  bool _internal_has_version_minor() const;
+  public:
+  void clear_version_minor();
+  uint32_t version_minor() const;
+  void set_version_minor(uint32_t value);
+  private:
+  uint32_t _internal_version_minor() const;
+  void _internal_set_version_minor(uint32_t value);
+  public:
+
+  // required uint32 version_micro = 3;
+  bool has_version_micro() const;
+  private:
+  bool _internal_has_version_micro() const;
+  public:
+  void clear_version_micro();
+  uint32_t version_micro() const;
+  void set_version_micro(uint32_t value);
+  private:
+  uint32_t _internal_version_micro() const;
+  void _internal_set_version_micro(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.VersionInfo)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_string_;
+    uint32_t version_major_;
+    uint32_t version_minor_;
+    uint32_t version_micro_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_VersionInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// VersionInfo
+
+// required uint32 version_major = 1;
+inline bool VersionInfo::_internal_has_version_major() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool VersionInfo::has_version_major() const {
+  return _internal_has_version_major();
+}
+inline void VersionInfo::clear_version_major() {
+  _impl_.version_major_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t VersionInfo::_internal_version_major() const {
+  return _impl_.version_major_;
+}
+inline uint32_t VersionInfo::version_major() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.VersionInfo.version_major)
+  return _internal_version_major();
+}
+inline void VersionInfo::_internal_set_version_major(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_major_ = value;
+}
+inline void VersionInfo::set_version_major(uint32_t value) {
+  _internal_set_version_major(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.VersionInfo.version_major)
+}
+
+// required uint32 version_minor = 2;
+inline bool VersionInfo::_internal_has_version_minor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool VersionInfo::has_version_minor() const {
+  return _internal_has_version_minor();
+}
+inline void VersionInfo::clear_version_minor() {
+  _impl_.version_minor_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t VersionInfo::_internal_version_minor() const {
+  return _impl_.version_minor_;
+}
+inline uint32_t VersionInfo::version_minor() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.VersionInfo.version_minor)
+  return _internal_version_minor();
+}
+inline void VersionInfo::_internal_set_version_minor(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.version_minor_ = value;
+}
+inline void VersionInfo::set_version_minor(uint32_t value) {
+  _internal_set_version_minor(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.VersionInfo.version_minor)
+}
+
+// required uint32 version_micro = 3;
+inline bool VersionInfo::_internal_has_version_micro() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool VersionInfo::has_version_micro() const {
+  return _internal_has_version_micro();
+}
+inline void VersionInfo::clear_version_micro() {
+  _impl_.version_micro_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t VersionInfo::_internal_version_micro() const {
+  return _impl_.version_micro_;
+}
+inline uint32_t VersionInfo::version_micro() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.VersionInfo.version_micro)
+  return _internal_version_micro();
+}
+inline void VersionInfo::_internal_set_version_micro(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.version_micro_ = value;
+}
+inline void VersionInfo::set_version_micro(uint32_t value) {
+  _internal_set_version_micro(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.VersionInfo.version_micro)
+}
+
+// required string version_string = 4;
+inline bool VersionInfo::_internal_has_version_string() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool VersionInfo::has_version_string() const {
+  return _internal_has_version_string();
+}
+inline void VersionInfo::clear_version_string() {
+  _impl_.version_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& VersionInfo::version_string() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.VersionInfo.version_string)
+  return _internal_version_string();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VersionInfo::set_version_string(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.version_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.VersionInfo.version_string)
+}
+inline std::string* VersionInfo::mutable_version_string() {
+  std::string* _s = _internal_mutable_version_string();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.VersionInfo.version_string)
+  return _s;
+}
+inline const std::string& VersionInfo::_internal_version_string() const {
+  return _impl_.version_string_.Get();
+}
+inline void VersionInfo::_internal_set_version_string(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_string_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VersionInfo::_internal_mutable_version_string() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.version_string_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VersionInfo::release_version_string() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.VersionInfo.version_string)
+  if (!_internal_has_version_string()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.version_string_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_string_.IsDefault()) {
+    _impl_.version_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void VersionInfo::set_allocated_version_string(std::string* version_string) {
+  if (version_string != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.version_string_.SetAllocated(version_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_string_.IsDefault()) {
+    _impl_.version_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.VersionInfo.version_string)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::VersionInfo_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::VersionInfo_CompType>() {
+  return ::llsf_msgs::VersionInfo_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_VersionInfo_2eproto
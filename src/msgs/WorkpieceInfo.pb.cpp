@@ -0,0 +1,1158 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: WorkpieceInfo.proto
+
+#include "WorkpieceInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace llsf_msgs {
+PROTOBUF_CONSTEXPR Workpiece::Workpiece(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ring_colors_)*/{}
+  , /*decltype(_impl_.at_machine_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.visible_)*/0
+  , /*decltype(_impl_.team_color_)*/0
+  , /*decltype(_impl_.base_color_)*/1
+  , /*decltype(_impl_.cap_color_)*/1} {}
+struct WorkpieceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WorkpieceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WorkpieceDefaultTypeInternal() {}
+  union {
+    Workpiece _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WorkpieceDefaultTypeInternal _Workpiece_default_instance_;
+PROTOBUF_CONSTEXPR WorkpieceInfo::WorkpieceInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.workpieces_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WorkpieceInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WorkpieceInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WorkpieceInfoDefaultTypeInternal() {}
+  union {
+    WorkpieceInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WorkpieceInfoDefaultTypeInternal _WorkpieceInfo_default_instance_;
+PROTOBUF_CONSTEXPR WorkpieceAddRing::WorkpieceAddRing(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.ring_color_)*/1} {}
+struct WorkpieceAddRingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WorkpieceAddRingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WorkpieceAddRingDefaultTypeInternal() {}
+  union {
+    WorkpieceAddRing _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WorkpieceAddRingDefaultTypeInternal _WorkpieceAddRing_default_instance_;
+}  // namespace llsf_msgs
+static ::_pb::Metadata file_level_metadata_WorkpieceInfo_2eproto[3];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_WorkpieceInfo_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_WorkpieceInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_WorkpieceInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Workpiece, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Workpiece, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Workpiece, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Workpiece, _impl_.at_machine_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Workpiece, _impl_.visible_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Workpiece, _impl_.team_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Workpiece, _impl_.base_color_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Workpiece, _impl_.ring_colors_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::Workpiece, _impl_.cap_color_),
+  1,
+  0,
+  2,
+  3,
+  4,
+  ~0u,
+  5,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::WorkpieceInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::WorkpieceInfo, _impl_.workpieces_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::WorkpieceAddRing, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::WorkpieceAddRing, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::WorkpieceAddRing, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::llsf_msgs::WorkpieceAddRing, _impl_.ring_color_),
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::llsf_msgs::Workpiece)},
+  { 20, -1, -1, sizeof(::llsf_msgs::WorkpieceInfo)},
+  { 27, 35, -1, sizeof(::llsf_msgs::WorkpieceAddRing)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::llsf_msgs::_Workpiece_default_instance_._instance,
+  &::llsf_msgs::_WorkpieceInfo_default_instance_._instance,
+  &::llsf_msgs::_WorkpieceAddRing_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_WorkpieceInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\023WorkpieceInfo.proto\022\tllsf_msgs\032\nTeam.p"
+  "roto\032\022ProductColor.proto\"\206\002\n\tWorkpiece\022\n"
+  "\n\002id\030\001 \002(\r\022\022\n\nat_machine\030\002 \002(\t\022\017\n\007visibl"
+  "e\030\003 \001(\002\022#\n\nteam_color\030\004 \001(\0162\017.llsf_msgs."
+  "Team\022(\n\nbase_color\030\005 \001(\0162\024.llsf_msgs.Bas"
+  "eColor\022)\n\013ring_colors\030\006 \003(\0162\024.llsf_msgs."
+  "RingColor\022&\n\tcap_color\030\007 \001(\0162\023.llsf_msgs"
+  ".CapColor\"&\n\010CompType\022\014\n\007COMP_ID\020\320\017\022\014\n\010M"
+  "SG_TYPE\0207\"a\n\rWorkpieceInfo\022(\n\nworkpieces"
+  "\030\001 \003(\0132\024.llsf_msgs.Workpiece\"&\n\010CompType"
+  "\022\014\n\007COMP_ID\020\320\017\022\014\n\010MSG_TYPE\0208\"p\n\020Workpiec"
+  "eAddRing\022\n\n\002id\030\001 \002(\r\022(\n\nring_color\030\002 \002(\016"
+  "2\024.llsf_msgs.RingColor\"&\n\010CompType\022\014\n\007CO"
+  "MP_ID\020\320\017\022\014\n\010MSG_TYPE\0209B6\n\037org.robocup_lo"
+  "gistics.llsf_msgsB\023WorkpieceInfoProtos"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_WorkpieceInfo_2eproto_deps[2] = {
+  &::descriptor_table_ProductColor_2eproto,
+  &::descriptor_table_Team_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_WorkpieceInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_WorkpieceInfo_2eproto = {
+    false, false, 598, descriptor_table_protodef_WorkpieceInfo_2eproto,
+    "WorkpieceInfo.proto",
+    &descriptor_table_WorkpieceInfo_2eproto_once, descriptor_table_WorkpieceInfo_2eproto_deps, 2, 3,
+    schemas, file_default_instances, TableStruct_WorkpieceInfo_2eproto::offsets,
+    file_level_metadata_WorkpieceInfo_2eproto, file_level_enum_descriptors_WorkpieceInfo_2eproto,
+    file_level_service_descriptors_WorkpieceInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_WorkpieceInfo_2eproto_getter() {
+  return &descriptor_table_WorkpieceInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_WorkpieceInfo_2eproto(&descriptor_table_WorkpieceInfo_2eproto);
+namespace llsf_msgs {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Workpiece_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_WorkpieceInfo_2eproto);
+  return file_level_enum_descriptors_WorkpieceInfo_2eproto[0];
+}
+bool Workpiece_CompType_IsValid(int value) {
+  switch (value) {
+    case 55:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Workpiece_CompType Workpiece::COMP_ID;
+constexpr Workpiece_CompType Workpiece::MSG_TYPE;
+constexpr Workpiece_CompType Workpiece::CompType_MIN;
+constexpr Workpiece_CompType Workpiece::CompType_MAX;
+constexpr int Workpiece::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* WorkpieceInfo_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_WorkpieceInfo_2eproto);
+  return file_level_enum_descriptors_WorkpieceInfo_2eproto[1];
+}
+bool WorkpieceInfo_CompType_IsValid(int value) {
+  switch (value) {
+    case 56:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr WorkpieceInfo_CompType WorkpieceInfo::COMP_ID;
+constexpr WorkpieceInfo_CompType WorkpieceInfo::MSG_TYPE;
+constexpr WorkpieceInfo_CompType WorkpieceInfo::CompType_MIN;
+constexpr WorkpieceInfo_CompType WorkpieceInfo::CompType_MAX;
+constexpr int WorkpieceInfo::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* WorkpieceAddRing_CompType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_WorkpieceInfo_2eproto);
+  return file_level_enum_descriptors_WorkpieceInfo_2eproto[2];
+}
+bool WorkpieceAddRing_CompType_IsValid(int value) {
+  switch (value) {
+    case 57:
+    case 2000:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr WorkpieceAddRing_CompType WorkpieceAddRing::COMP_ID;
+constexpr WorkpieceAddRing_CompType WorkpieceAddRing::MSG_TYPE;
+constexpr WorkpieceAddRing_CompType WorkpieceAddRing::CompType_MIN;
+constexpr WorkpieceAddRing_CompType WorkpieceAddRing::CompType_MAX;
+constexpr int WorkpieceAddRing::CompType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Workpiece::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Workpiece>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_at_machine(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_visible(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_team_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_base_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cap_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Workpiece::Workpiece(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.Workpiece)
+}
+Workpiece::Workpiece(const Workpiece& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Workpiece* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ring_colors_){from._impl_.ring_colors_}
+    , decltype(_impl_.at_machine_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.visible_){}
+    , decltype(_impl_.team_color_){}
+    , decltype(_impl_.base_color_){}
+    , decltype(_impl_.cap_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.at_machine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.at_machine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_at_machine()) {
+    _this->_impl_.at_machine_.Set(from._internal_at_machine(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cap_color_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.cap_color_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.Workpiece)
+}
+
+inline void Workpiece::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ring_colors_){arena}
+    , decltype(_impl_.at_machine_){}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.visible_){0}
+    , decltype(_impl_.team_color_){0}
+    , decltype(_impl_.base_color_){1}
+    , decltype(_impl_.cap_color_){1}
+  };
+  _impl_.at_machine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.at_machine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Workpiece::~Workpiece() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.Workpiece)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Workpiece::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ring_colors_.~RepeatedField();
+  _impl_.at_machine_.Destroy();
+}
+
+void Workpiece::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Workpiece::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.Workpiece)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ring_colors_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.at_machine_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000003eu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.team_color_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.team_color_));
+    _impl_.base_color_ = 1;
+    _impl_.cap_color_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Workpiece::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string at_machine = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_at_machine();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "llsf_msgs.Workpiece.at_machine");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float visible = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_visible(&has_bits);
+          _impl_.visible_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.Team team_color = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::Team_IsValid(val))) {
+            _internal_set_team_color(static_cast<::llsf_msgs::Team>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.BaseColor base_color = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::BaseColor_IsValid(val))) {
+            _internal_set_base_color(static_cast<::llsf_msgs::BaseColor>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(5, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .llsf_msgs.RingColor ring_colors = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::RingColor_IsValid(val))) {
+              _internal_add_ring_colors(static_cast<::llsf_msgs::RingColor>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_ring_colors(), ptr, ctx, ::llsf_msgs::RingColor_IsValid, &_internal_metadata_, 6);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .llsf_msgs.CapColor cap_color = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::CapColor_IsValid(val))) {
+            _internal_set_cap_color(static_cast<::llsf_msgs::CapColor>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(7, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Workpiece::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.Workpiece)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // required string at_machine = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_at_machine().data(), static_cast<int>(this->_internal_at_machine().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "llsf_msgs.Workpiece.at_machine");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_at_machine(), target);
+  }
+
+  // optional float visible = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_visible(), target);
+  }
+
+  // optional .llsf_msgs.Team team_color = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_team_color(), target);
+  }
+
+  // optional .llsf_msgs.BaseColor base_color = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_base_color(), target);
+  }
+
+  // repeated .llsf_msgs.RingColor ring_colors = 6;
+  for (int i = 0, n = this->_internal_ring_colors_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        6, this->_internal_ring_colors(i), target);
+  }
+
+  // optional .llsf_msgs.CapColor cap_color = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_cap_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.Workpiece)
+  return target;
+}
+
+size_t Workpiece::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.Workpiece)
+  size_t total_size = 0;
+
+  if (_internal_has_at_machine()) {
+    // required string at_machine = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_at_machine());
+  }
+
+  if (_internal_has_id()) {
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  return total_size;
+}
+size_t Workpiece::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.Workpiece)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string at_machine = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_at_machine());
+
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.RingColor ring_colors = 6;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_ring_colors_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_ring_colors(static_cast<int>(i)));
+    }
+    total_size += (1UL * count) + data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003cu) {
+    // optional float visible = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional .llsf_msgs.Team team_color = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_team_color());
+    }
+
+    // optional .llsf_msgs.BaseColor base_color = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_base_color());
+    }
+
+    // optional .llsf_msgs.CapColor cap_color = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_cap_color());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Workpiece::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Workpiece::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Workpiece::GetClassData() const { return &_class_data_; }
+
+
+void Workpiece::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Workpiece*>(&to_msg);
+  auto& from = static_cast<const Workpiece&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.Workpiece)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ring_colors_.MergeFrom(from._impl_.ring_colors_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_at_machine(from._internal_at_machine());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.visible_ = from._impl_.visible_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.team_color_ = from._impl_.team_color_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.base_color_ = from._impl_.base_color_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.cap_color_ = from._impl_.cap_color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Workpiece::CopyFrom(const Workpiece& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.Workpiece)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Workpiece::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Workpiece::InternalSwap(Workpiece* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.ring_colors_.InternalSwap(&other->_impl_.ring_colors_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.at_machine_, lhs_arena,
+      &other->_impl_.at_machine_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Workpiece, _impl_.team_color_)
+      + sizeof(Workpiece::_impl_.team_color_)
+      - PROTOBUF_FIELD_OFFSET(Workpiece, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+  swap(_impl_.base_color_, other->_impl_.base_color_);
+  swap(_impl_.cap_color_, other->_impl_.cap_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Workpiece::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_WorkpieceInfo_2eproto_getter, &descriptor_table_WorkpieceInfo_2eproto_once,
+      file_level_metadata_WorkpieceInfo_2eproto[0]);
+}
+
+// ===================================================================
+
+class WorkpieceInfo::_Internal {
+ public:
+};
+
+WorkpieceInfo::WorkpieceInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.WorkpieceInfo)
+}
+WorkpieceInfo::WorkpieceInfo(const WorkpieceInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WorkpieceInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.workpieces_){from._impl_.workpieces_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.WorkpieceInfo)
+}
+
+inline void WorkpieceInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.workpieces_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WorkpieceInfo::~WorkpieceInfo() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.WorkpieceInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WorkpieceInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.workpieces_.~RepeatedPtrField();
+}
+
+void WorkpieceInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WorkpieceInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.WorkpieceInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.workpieces_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WorkpieceInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .llsf_msgs.Workpiece workpieces = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_workpieces(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WorkpieceInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.WorkpieceInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Workpiece workpieces = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_workpieces_size()); i < n; i++) {
+    const auto& repfield = this->_internal_workpieces(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.WorkpieceInfo)
+  return target;
+}
+
+size_t WorkpieceInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.WorkpieceInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .llsf_msgs.Workpiece workpieces = 1;
+  total_size += 1UL * this->_internal_workpieces_size();
+  for (const auto& msg : this->_impl_.workpieces_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WorkpieceInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WorkpieceInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WorkpieceInfo::GetClassData() const { return &_class_data_; }
+
+
+void WorkpieceInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WorkpieceInfo*>(&to_msg);
+  auto& from = static_cast<const WorkpieceInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.WorkpieceInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.workpieces_.MergeFrom(from._impl_.workpieces_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WorkpieceInfo::CopyFrom(const WorkpieceInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.WorkpieceInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WorkpieceInfo::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.workpieces_))
+    return false;
+  return true;
+}
+
+void WorkpieceInfo::InternalSwap(WorkpieceInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.workpieces_.InternalSwap(&other->_impl_.workpieces_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WorkpieceInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_WorkpieceInfo_2eproto_getter, &descriptor_table_WorkpieceInfo_2eproto_once,
+      file_level_metadata_WorkpieceInfo_2eproto[1]);
+}
+
+// ===================================================================
+
+class WorkpieceAddRing::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WorkpieceAddRing>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_ring_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+WorkpieceAddRing::WorkpieceAddRing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:llsf_msgs.WorkpieceAddRing)
+}
+WorkpieceAddRing::WorkpieceAddRing(const WorkpieceAddRing& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WorkpieceAddRing* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.ring_color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ring_color_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.ring_color_));
+  // @@protoc_insertion_point(copy_constructor:llsf_msgs.WorkpieceAddRing)
+}
+
+inline void WorkpieceAddRing::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.ring_color_){1}
+  };
+}
+
+WorkpieceAddRing::~WorkpieceAddRing() {
+  // @@protoc_insertion_point(destructor:llsf_msgs.WorkpieceAddRing)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WorkpieceAddRing::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void WorkpieceAddRing::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WorkpieceAddRing::Clear() {
+// @@protoc_insertion_point(message_clear_start:llsf_msgs.WorkpieceAddRing)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.id_ = 0u;
+    _impl_.ring_color_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WorkpieceAddRing::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .llsf_msgs.RingColor ring_color = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::llsf_msgs::RingColor_IsValid(val))) {
+            _internal_set_ring_color(static_cast<::llsf_msgs::RingColor>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WorkpieceAddRing::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:llsf_msgs.WorkpieceAddRing)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // required .llsf_msgs.RingColor ring_color = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_ring_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:llsf_msgs.WorkpieceAddRing)
+  return target;
+}
+
+size_t WorkpieceAddRing::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:llsf_msgs.WorkpieceAddRing)
+  size_t total_size = 0;
+
+  if (_internal_has_id()) {
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  if (_internal_has_ring_color()) {
+    // required .llsf_msgs.RingColor ring_color = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_ring_color());
+  }
+
+  return total_size;
+}
+size_t WorkpieceAddRing::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:llsf_msgs.WorkpieceAddRing)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+
+    // required .llsf_msgs.RingColor ring_color = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_ring_color());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WorkpieceAddRing::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WorkpieceAddRing::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WorkpieceAddRing::GetClassData() const { return &_class_data_; }
+
+
+void WorkpieceAddRing::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WorkpieceAddRing*>(&to_msg);
+  auto& from = static_cast<const WorkpieceAddRing&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:llsf_msgs.WorkpieceAddRing)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.ring_color_ = from._impl_.ring_color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WorkpieceAddRing::CopyFrom(const WorkpieceAddRing& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:llsf_msgs.WorkpieceAddRing)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WorkpieceAddRing::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void WorkpieceAddRing::InternalSwap(WorkpieceAddRing* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.id_, other->_impl_.id_);
+  swap(_impl_.ring_color_, other->_impl_.ring_color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WorkpieceAddRing::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_WorkpieceInfo_2eproto_getter, &descriptor_table_WorkpieceInfo_2eproto_once,
+      file_level_metadata_WorkpieceInfo_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::llsf_msgs::Workpiece*
+Arena::CreateMaybeMessage< ::llsf_msgs::Workpiece >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::Workpiece >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::WorkpieceInfo*
+Arena::CreateMaybeMessage< ::llsf_msgs::WorkpieceInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::WorkpieceInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::llsf_msgs::WorkpieceAddRing*
+Arena::CreateMaybeMessage< ::llsf_msgs::WorkpieceAddRing >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::llsf_msgs::WorkpieceAddRing >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
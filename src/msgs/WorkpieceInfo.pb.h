@@ -0,0 +1,1238 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: WorkpieceInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_WorkpieceInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_WorkpieceInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "Team.pb.h"
+#include "ProductColor.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_WorkpieceInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_WorkpieceInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_WorkpieceInfo_2eproto;
+namespace llsf_msgs {
+class Workpiece;
+struct WorkpieceDefaultTypeInternal;
+extern WorkpieceDefaultTypeInternal _Workpiece_default_instance_;
+class WorkpieceAddRing;
+struct WorkpieceAddRingDefaultTypeInternal;
+extern WorkpieceAddRingDefaultTypeInternal _WorkpieceAddRing_default_instance_;
+class WorkpieceInfo;
+struct WorkpieceInfoDefaultTypeInternal;
+extern WorkpieceInfoDefaultTypeInternal _WorkpieceInfo_default_instance_;
+}  // namespace llsf_msgs
+PROTOBUF_NAMESPACE_OPEN
+template<> ::llsf_msgs::Workpiece* Arena::CreateMaybeMessage<::llsf_msgs::Workpiece>(Arena*);
+template<> ::llsf_msgs::WorkpieceAddRing* Arena::CreateMaybeMessage<::llsf_msgs::WorkpieceAddRing>(Arena*);
+template<> ::llsf_msgs::WorkpieceInfo* Arena::CreateMaybeMessage<::llsf_msgs::WorkpieceInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum Workpiece_CompType : int {
+  Workpiece_CompType_COMP_ID = 2000,
+  Workpiece_CompType_MSG_TYPE = 55
+};
+bool Workpiece_CompType_IsValid(int value);
+constexpr Workpiece_CompType Workpiece_CompType_CompType_MIN = Workpiece_CompType_MSG_TYPE;
+constexpr Workpiece_CompType Workpiece_CompType_CompType_MAX = Workpiece_CompType_COMP_ID;
+constexpr int Workpiece_CompType_CompType_ARRAYSIZE = Workpiece_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Workpiece_CompType_descriptor();
+template<typename T>
+inline const std::string& Workpiece_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Workpiece_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Workpiece_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Workpiece_CompType_descriptor(), enum_t_value);
+}
+inline bool Workpiece_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Workpiece_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Workpiece_CompType>(
+    Workpiece_CompType_descriptor(), name, value);
+}
+enum WorkpieceInfo_CompType : int {
+  WorkpieceInfo_CompType_COMP_ID = 2000,
+  WorkpieceInfo_CompType_MSG_TYPE = 56
+};
+bool WorkpieceInfo_CompType_IsValid(int value);
+constexpr WorkpieceInfo_CompType WorkpieceInfo_CompType_CompType_MIN = WorkpieceInfo_CompType_MSG_TYPE;
+constexpr WorkpieceInfo_CompType WorkpieceInfo_CompType_CompType_MAX = WorkpieceInfo_CompType_COMP_ID;
+constexpr int WorkpieceInfo_CompType_CompType_ARRAYSIZE = WorkpieceInfo_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* WorkpieceInfo_CompType_descriptor();
+template<typename T>
+inline const std::string& WorkpieceInfo_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, WorkpieceInfo_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function WorkpieceInfo_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    WorkpieceInfo_CompType_descriptor(), enum_t_value);
+}
+inline bool WorkpieceInfo_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, WorkpieceInfo_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<WorkpieceInfo_CompType>(
+    WorkpieceInfo_CompType_descriptor(), name, value);
+}
+enum WorkpieceAddRing_CompType : int {
+  WorkpieceAddRing_CompType_COMP_ID = 2000,
+  WorkpieceAddRing_CompType_MSG_TYPE = 57
+};
+bool WorkpieceAddRing_CompType_IsValid(int value);
+constexpr WorkpieceAddRing_CompType WorkpieceAddRing_CompType_CompType_MIN = WorkpieceAddRing_CompType_MSG_TYPE;
+constexpr WorkpieceAddRing_CompType WorkpieceAddRing_CompType_CompType_MAX = WorkpieceAddRing_CompType_COMP_ID;
+constexpr int WorkpieceAddRing_CompType_CompType_ARRAYSIZE = WorkpieceAddRing_CompType_CompType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* WorkpieceAddRing_CompType_descriptor();
+template<typename T>
+inline const std::string& WorkpieceAddRing_CompType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, WorkpieceAddRing_CompType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function WorkpieceAddRing_CompType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    WorkpieceAddRing_CompType_descriptor(), enum_t_value);
+}
+inline bool WorkpieceAddRing_CompType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, WorkpieceAddRing_CompType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<WorkpieceAddRing_CompType>(
+    WorkpieceAddRing_CompType_descriptor(), name, value);
+}
+// ===================================================================
+
+class Workpiece final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.Workpiece) */ {
+ public:
+  inline Workpiece() : Workpiece(nullptr) {}
+  ~Workpiece() override;
+  explicit PROTOBUF_CONSTEXPR Workpiece(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Workpiece(const Workpiece& from);
+  Workpiece(Workpiece&& from) noexcept
+    : Workpiece() {
+    *this = ::std::move(from);
+  }
+
+  inline Workpiece& operator=(const Workpiece& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Workpiece& operator=(Workpiece&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Workpiece& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Workpiece* internal_default_instance() {
+    return reinterpret_cast<const Workpiece*>(
+               &_Workpiece_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Workpiece& a, Workpiece& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Workpiece* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Workpiece* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Workpiece* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Workpiece>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Workpiece& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Workpiece& from) {
+    Workpiece::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Workpiece* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.Workpiece";
+  }
+  protected:
+  explicit Workpiece(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Workpiece_CompType CompType;
+  static constexpr CompType COMP_ID =
+    Workpiece_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    Workpiece_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return Workpiece_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    Workpiece_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    Workpiece_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    Workpiece_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return Workpiece_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return Workpiece_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return Workpiece_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRingColorsFieldNumber = 6,
+    kAtMachineFieldNumber = 2,
+    kIdFieldNumber = 1,
+    kVisibleFieldNumber = 3,
+    kTeamColorFieldNumber = 4,
+    kBaseColorFieldNumber = 5,
+    kCapColorFieldNumber = 7,
+  };
+  // repeated .llsf_msgs.RingColor ring_colors = 6;
+  int ring_colors_size() const;
+  private:
+  int _internal_ring_colors_size() const;
+  public:
+  void clear_ring_colors();
+  private:
+  ::llsf_msgs::RingColor _internal_ring_colors(int index) const;
+  void _internal_add_ring_colors(::llsf_msgs::RingColor value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_ring_colors();
+  public:
+  ::llsf_msgs::RingColor ring_colors(int index) const;
+  void set_ring_colors(int index, ::llsf_msgs::RingColor value);
+  void add_ring_colors(::llsf_msgs::RingColor value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& ring_colors() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_ring_colors();
+
+  // required string at_machine = 2;
+  bool has_at_machine() const;
+  private:
+  bool _internal_has_at_machine() const;
+  public:
+  void clear_at_machine();
+  const std::string& at_machine() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_at_machine(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_at_machine();
+  PROTOBUF_NODISCARD std::string* release_at_machine();
+  void set_allocated_at_machine(std::string* at_machine);
+  private:
+  const std::string& _internal_at_machine() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_at_machine(const std::string& value);
+  std::string* _internal_mutable_at_machine();
+  public:
+
+  // required uint32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // optional float visible = 3;
+  bool has_visible() const;
+  private:
+  bool _internal_has_visible() const;
+  public:
+  void clear_visible();
+  float visible() const;
+  void set_visible(float value);
+  private:
+  float _internal_visible() const;
+  void _internal_set_visible(float value);
+  public:
+
+  // optional .llsf_msgs.Team team_color = 4;
+  bool has_team_color() const;
+  private:
+  bool _internal_has_team_color() const;
+  public:
+  void clear_team_color();
+  ::llsf_msgs::Team team_color() const;
+  void set_team_color(::llsf_msgs::Team value);
+  private:
+  ::llsf_msgs::Team _internal_team_color() const;
+  void _internal_set_team_color(::llsf_msgs::Team value);
+  public:
+
+  // optional .llsf_msgs.BaseColor base_color = 5;
+  bool has_base_color() const;
+  private:
+  bool _internal_has_base_color() const;
+  public:
+  void clear_base_color();
+  ::llsf_msgs::BaseColor base_color() const;
+  void set_base_color(::llsf_msgs::BaseColor value);
+  private:
+  ::llsf_msgs::BaseColor _internal_base_color() const;
+  void _internal_set_base_color(::llsf_msgs::BaseColor value);
+  public:
+
+  // optional .llsf_msgs.CapColor cap_color = 7;
+  bool has_cap_color() const;
+  private:
+  bool _internal_has_cap_color() const;
+  public:
+  void clear_cap_color();
+  ::llsf_msgs::CapColor cap_color() const;
+  void set_cap_color(::llsf_msgs::CapColor value);
+  private:
+  ::llsf_msgs::CapColor _internal_cap_color() const;
+  void _internal_set_cap_color(::llsf_msgs::CapColor value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.Workpiece)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> ring_colors_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr at_machine_;
+    uint32_t id_;
+    float visible_;
+    int team_color_;
+    int base_color_;
+    int cap_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_WorkpieceInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WorkpieceInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.WorkpieceInfo) */ {
+ public:
+  inline WorkpieceInfo() : WorkpieceInfo(nullptr) {}
+  ~WorkpieceInfo() override;
+  explicit PROTOBUF_CONSTEXPR WorkpieceInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WorkpieceInfo(const WorkpieceInfo& from);
+  WorkpieceInfo(WorkpieceInfo&& from) noexcept
+    : WorkpieceInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline WorkpieceInfo& operator=(const WorkpieceInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WorkpieceInfo& operator=(WorkpieceInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WorkpieceInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WorkpieceInfo* internal_default_instance() {
+    return reinterpret_cast<const WorkpieceInfo*>(
+               &_WorkpieceInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(WorkpieceInfo& a, WorkpieceInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WorkpieceInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WorkpieceInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WorkpieceInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WorkpieceInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WorkpieceInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WorkpieceInfo& from) {
+    WorkpieceInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WorkpieceInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.WorkpieceInfo";
+  }
+  protected:
+  explicit WorkpieceInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef WorkpieceInfo_CompType CompType;
+  static constexpr CompType COMP_ID =
+    WorkpieceInfo_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    WorkpieceInfo_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return WorkpieceInfo_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    WorkpieceInfo_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    WorkpieceInfo_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    WorkpieceInfo_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return WorkpieceInfo_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return WorkpieceInfo_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return WorkpieceInfo_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWorkpiecesFieldNumber = 1,
+  };
+  // repeated .llsf_msgs.Workpiece workpieces = 1;
+  int workpieces_size() const;
+  private:
+  int _internal_workpieces_size() const;
+  public:
+  void clear_workpieces();
+  ::llsf_msgs::Workpiece* mutable_workpieces(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Workpiece >*
+      mutable_workpieces();
+  private:
+  const ::llsf_msgs::Workpiece& _internal_workpieces(int index) const;
+  ::llsf_msgs::Workpiece* _internal_add_workpieces();
+  public:
+  const ::llsf_msgs::Workpiece& workpieces(int index) const;
+  ::llsf_msgs::Workpiece* add_workpieces();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Workpiece >&
+      workpieces() const;
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.WorkpieceInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Workpiece > workpieces_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_WorkpieceInfo_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WorkpieceAddRing final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:llsf_msgs.WorkpieceAddRing) */ {
+ public:
+  inline WorkpieceAddRing() : WorkpieceAddRing(nullptr) {}
+  ~WorkpieceAddRing() override;
+  explicit PROTOBUF_CONSTEXPR WorkpieceAddRing(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WorkpieceAddRing(const WorkpieceAddRing& from);
+  WorkpieceAddRing(WorkpieceAddRing&& from) noexcept
+    : WorkpieceAddRing() {
+    *this = ::std::move(from);
+  }
+
+  inline WorkpieceAddRing& operator=(const WorkpieceAddRing& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WorkpieceAddRing& operator=(WorkpieceAddRing&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WorkpieceAddRing& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WorkpieceAddRing* internal_default_instance() {
+    return reinterpret_cast<const WorkpieceAddRing*>(
+               &_WorkpieceAddRing_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(WorkpieceAddRing& a, WorkpieceAddRing& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WorkpieceAddRing* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WorkpieceAddRing* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WorkpieceAddRing* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WorkpieceAddRing>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WorkpieceAddRing& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WorkpieceAddRing& from) {
+    WorkpieceAddRing::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WorkpieceAddRing* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "llsf_msgs.WorkpieceAddRing";
+  }
+  protected:
+  explicit WorkpieceAddRing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef WorkpieceAddRing_CompType CompType;
+  static constexpr CompType COMP_ID =
+    WorkpieceAddRing_CompType_COMP_ID;
+  static constexpr CompType MSG_TYPE =
+    WorkpieceAddRing_CompType_MSG_TYPE;
+  static inline bool CompType_IsValid(int value) {
+    return WorkpieceAddRing_CompType_IsValid(value);
+  }
+  static constexpr CompType CompType_MIN =
+    WorkpieceAddRing_CompType_CompType_MIN;
+  static constexpr CompType CompType_MAX =
+    WorkpieceAddRing_CompType_CompType_MAX;
+  static constexpr int CompType_ARRAYSIZE =
+    WorkpieceAddRing_CompType_CompType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  CompType_descriptor() {
+    return WorkpieceAddRing_CompType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& CompType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, CompType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function CompType_Name.");
+    return WorkpieceAddRing_CompType_Name(enum_t_value);
+  }
+  static inline bool CompType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      CompType* value) {
+    return WorkpieceAddRing_CompType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kRingColorFieldNumber = 2,
+  };
+  // required uint32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // required .llsf_msgs.RingColor ring_color = 2;
+  bool has_ring_color() const;
+  private:
+  bool _internal_has_ring_color() const;
+  public:
+  void clear_ring_color();
+  ::llsf_msgs::RingColor ring_color() const;
+  void set_ring_color(::llsf_msgs::RingColor value);
+  private:
+  ::llsf_msgs::RingColor _internal_ring_color() const;
+  void _internal_set_ring_color(::llsf_msgs::RingColor value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:llsf_msgs.WorkpieceAddRing)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t id_;
+    int ring_color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_WorkpieceInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Workpiece
+
+// required uint32 id = 1;
+inline bool Workpiece::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Workpiece::has_id() const {
+  return _internal_has_id();
+}
+inline void Workpiece::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Workpiece::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Workpiece::id() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Workpiece.id)
+  return _internal_id();
+}
+inline void Workpiece::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
+}
+inline void Workpiece::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Workpiece.id)
+}
+
+// required string at_machine = 2;
+inline bool Workpiece::_internal_has_at_machine() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Workpiece::has_at_machine() const {
+  return _internal_has_at_machine();
+}
+inline void Workpiece::clear_at_machine() {
+  _impl_.at_machine_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Workpiece::at_machine() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Workpiece.at_machine)
+  return _internal_at_machine();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Workpiece::set_at_machine(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.at_machine_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:llsf_msgs.Workpiece.at_machine)
+}
+inline std::string* Workpiece::mutable_at_machine() {
+  std::string* _s = _internal_mutable_at_machine();
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.Workpiece.at_machine)
+  return _s;
+}
+inline const std::string& Workpiece::_internal_at_machine() const {
+  return _impl_.at_machine_.Get();
+}
+inline void Workpiece::_internal_set_at_machine(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.at_machine_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Workpiece::_internal_mutable_at_machine() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.at_machine_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Workpiece::release_at_machine() {
+  // @@protoc_insertion_point(field_release:llsf_msgs.Workpiece.at_machine)
+  if (!_internal_has_at_machine()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.at_machine_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.at_machine_.IsDefault()) {
+    _impl_.at_machine_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Workpiece::set_allocated_at_machine(std::string* at_machine) {
+  if (at_machine != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.at_machine_.SetAllocated(at_machine, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.at_machine_.IsDefault()) {
+    _impl_.at_machine_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:llsf_msgs.Workpiece.at_machine)
+}
+
+// optional float visible = 3;
+inline bool Workpiece::_internal_has_visible() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Workpiece::has_visible() const {
+  return _internal_has_visible();
+}
+inline void Workpiece::clear_visible() {
+  _impl_.visible_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float Workpiece::_internal_visible() const {
+  return _impl_.visible_;
+}
+inline float Workpiece::visible() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Workpiece.visible)
+  return _internal_visible();
+}
+inline void Workpiece::_internal_set_visible(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.visible_ = value;
+}
+inline void Workpiece::set_visible(float value) {
+  _internal_set_visible(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Workpiece.visible)
+}
+
+// optional .llsf_msgs.Team team_color = 4;
+inline bool Workpiece::_internal_has_team_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Workpiece::has_team_color() const {
+  return _internal_has_team_color();
+}
+inline void Workpiece::clear_team_color() {
+  _impl_.team_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::llsf_msgs::Team Workpiece::_internal_team_color() const {
+  return static_cast< ::llsf_msgs::Team >(_impl_.team_color_);
+}
+inline ::llsf_msgs::Team Workpiece::team_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Workpiece.team_color)
+  return _internal_team_color();
+}
+inline void Workpiece::_internal_set_team_color(::llsf_msgs::Team value) {
+  assert(::llsf_msgs::Team_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.team_color_ = value;
+}
+inline void Workpiece::set_team_color(::llsf_msgs::Team value) {
+  _internal_set_team_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Workpiece.team_color)
+}
+
+// optional .llsf_msgs.BaseColor base_color = 5;
+inline bool Workpiece::_internal_has_base_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Workpiece::has_base_color() const {
+  return _internal_has_base_color();
+}
+inline void Workpiece::clear_base_color() {
+  _impl_.base_color_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::llsf_msgs::BaseColor Workpiece::_internal_base_color() const {
+  return static_cast< ::llsf_msgs::BaseColor >(_impl_.base_color_);
+}
+inline ::llsf_msgs::BaseColor Workpiece::base_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Workpiece.base_color)
+  return _internal_base_color();
+}
+inline void Workpiece::_internal_set_base_color(::llsf_msgs::BaseColor value) {
+  assert(::llsf_msgs::BaseColor_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.base_color_ = value;
+}
+inline void Workpiece::set_base_color(::llsf_msgs::BaseColor value) {
+  _internal_set_base_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Workpiece.base_color)
+}
+
+// repeated .llsf_msgs.RingColor ring_colors = 6;
+inline int Workpiece::_internal_ring_colors_size() const {
+  return _impl_.ring_colors_.size();
+}
+inline int Workpiece::ring_colors_size() const {
+  return _internal_ring_colors_size();
+}
+inline void Workpiece::clear_ring_colors() {
+  _impl_.ring_colors_.Clear();
+}
+inline ::llsf_msgs::RingColor Workpiece::_internal_ring_colors(int index) const {
+  return static_cast< ::llsf_msgs::RingColor >(_impl_.ring_colors_.Get(index));
+}
+inline ::llsf_msgs::RingColor Workpiece::ring_colors(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Workpiece.ring_colors)
+  return _internal_ring_colors(index);
+}
+inline void Workpiece::set_ring_colors(int index, ::llsf_msgs::RingColor value) {
+  assert(::llsf_msgs::RingColor_IsValid(value));
+  _impl_.ring_colors_.Set(index, value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Workpiece.ring_colors)
+}
+inline void Workpiece::_internal_add_ring_colors(::llsf_msgs::RingColor value) {
+  assert(::llsf_msgs::RingColor_IsValid(value));
+  _impl_.ring_colors_.Add(value);
+}
+inline void Workpiece::add_ring_colors(::llsf_msgs::RingColor value) {
+  _internal_add_ring_colors(value);
+  // @@protoc_insertion_point(field_add:llsf_msgs.Workpiece.ring_colors)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+Workpiece::ring_colors() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.Workpiece.ring_colors)
+  return _impl_.ring_colors_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Workpiece::_internal_mutable_ring_colors() {
+  return &_impl_.ring_colors_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+Workpiece::mutable_ring_colors() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.Workpiece.ring_colors)
+  return _internal_mutable_ring_colors();
+}
+
+// optional .llsf_msgs.CapColor cap_color = 7;
+inline bool Workpiece::_internal_has_cap_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Workpiece::has_cap_color() const {
+  return _internal_has_cap_color();
+}
+inline void Workpiece::clear_cap_color() {
+  _impl_.cap_color_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::llsf_msgs::CapColor Workpiece::_internal_cap_color() const {
+  return static_cast< ::llsf_msgs::CapColor >(_impl_.cap_color_);
+}
+inline ::llsf_msgs::CapColor Workpiece::cap_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.Workpiece.cap_color)
+  return _internal_cap_color();
+}
+inline void Workpiece::_internal_set_cap_color(::llsf_msgs::CapColor value) {
+  assert(::llsf_msgs::CapColor_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.cap_color_ = value;
+}
+inline void Workpiece::set_cap_color(::llsf_msgs::CapColor value) {
+  _internal_set_cap_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.Workpiece.cap_color)
+}
+
+// -------------------------------------------------------------------
+
+// WorkpieceInfo
+
+// repeated .llsf_msgs.Workpiece workpieces = 1;
+inline int WorkpieceInfo::_internal_workpieces_size() const {
+  return _impl_.workpieces_.size();
+}
+inline int WorkpieceInfo::workpieces_size() const {
+  return _internal_workpieces_size();
+}
+inline void WorkpieceInfo::clear_workpieces() {
+  _impl_.workpieces_.Clear();
+}
+inline ::llsf_msgs::Workpiece* WorkpieceInfo::mutable_workpieces(int index) {
+  // @@protoc_insertion_point(field_mutable:llsf_msgs.WorkpieceInfo.workpieces)
+  return _impl_.workpieces_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Workpiece >*
+WorkpieceInfo::mutable_workpieces() {
+  // @@protoc_insertion_point(field_mutable_list:llsf_msgs.WorkpieceInfo.workpieces)
+  return &_impl_.workpieces_;
+}
+inline const ::llsf_msgs::Workpiece& WorkpieceInfo::_internal_workpieces(int index) const {
+  return _impl_.workpieces_.Get(index);
+}
+inline const ::llsf_msgs::Workpiece& WorkpieceInfo::workpieces(int index) const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.WorkpieceInfo.workpieces)
+  return _internal_workpieces(index);
+}
+inline ::llsf_msgs::Workpiece* WorkpieceInfo::_internal_add_workpieces() {
+  return _impl_.workpieces_.Add();
+}
+inline ::llsf_msgs::Workpiece* WorkpieceInfo::add_workpieces() {
+  ::llsf_msgs::Workpiece* _add = _internal_add_workpieces();
+  // @@protoc_insertion_point(field_add:llsf_msgs.WorkpieceInfo.workpieces)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::llsf_msgs::Workpiece >&
+WorkpieceInfo::workpieces() const {
+  // @@protoc_insertion_point(field_list:llsf_msgs.WorkpieceInfo.workpieces)
+  return _impl_.workpieces_;
+}
+
+// -------------------------------------------------------------------
+
+// WorkpieceAddRing
+
+// required uint32 id = 1;
+inline bool WorkpieceAddRing::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool WorkpieceAddRing::has_id() const {
+  return _internal_has_id();
+}
+inline void WorkpieceAddRing::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t WorkpieceAddRing::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t WorkpieceAddRing::id() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.WorkpieceAddRing.id)
+  return _internal_id();
+}
+inline void WorkpieceAddRing::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void WorkpieceAddRing::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.WorkpieceAddRing.id)
+}
+
+// required .llsf_msgs.RingColor ring_color = 2;
+inline bool WorkpieceAddRing::_internal_has_ring_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool WorkpieceAddRing::has_ring_color() const {
+  return _internal_has_ring_color();
+}
+inline void WorkpieceAddRing::clear_ring_color() {
+  _impl_.ring_color_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::llsf_msgs::RingColor WorkpieceAddRing::_internal_ring_color() const {
+  return static_cast< ::llsf_msgs::RingColor >(_impl_.ring_color_);
+}
+inline ::llsf_msgs::RingColor WorkpieceAddRing::ring_color() const {
+  // @@protoc_insertion_point(field_get:llsf_msgs.WorkpieceAddRing.ring_color)
+  return _internal_ring_color();
+}
+inline void WorkpieceAddRing::_internal_set_ring_color(::llsf_msgs::RingColor value) {
+  assert(::llsf_msgs::RingColor_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ring_color_ = value;
+}
+inline void WorkpieceAddRing::set_ring_color(::llsf_msgs::RingColor value) {
+  _internal_set_ring_color(value);
+  // @@protoc_insertion_point(field_set:llsf_msgs.WorkpieceAddRing.ring_color)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::Workpiece_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::Workpiece_CompType>() {
+  return ::llsf_msgs::Workpiece_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::WorkpieceInfo_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::WorkpieceInfo_CompType>() {
+  return ::llsf_msgs::WorkpieceInfo_CompType_descriptor();
+}
+template <> struct is_proto_enum< ::llsf_msgs::WorkpieceAddRing_CompType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::WorkpieceAddRing_CompType>() {
+  return ::llsf_msgs::WorkpieceAddRing_CompType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_WorkpieceInfo_2eproto
@@ -0,0 +1,210 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Zone.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_Zone_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_Zone_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_Zone_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_Zone_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Zone_2eproto;
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+namespace llsf_msgs {
+
+enum Zone : int {
+  C_Z18 = 18,
+  C_Z28 = 28,
+  C_Z38 = 38,
+  C_Z48 = 48,
+  C_Z58 = 58,
+  C_Z68 = 68,
+  C_Z78 = 78,
+  C_Z17 = 17,
+  C_Z27 = 27,
+  C_Z37 = 37,
+  C_Z47 = 47,
+  C_Z57 = 57,
+  C_Z67 = 67,
+  C_Z77 = 77,
+  C_Z16 = 16,
+  C_Z26 = 26,
+  C_Z36 = 36,
+  C_Z46 = 46,
+  C_Z56 = 56,
+  C_Z66 = 66,
+  C_Z76 = 76,
+  C_Z15 = 15,
+  C_Z25 = 25,
+  C_Z35 = 35,
+  C_Z45 = 45,
+  C_Z55 = 55,
+  C_Z65 = 65,
+  C_Z75 = 75,
+  C_Z14 = 14,
+  C_Z24 = 24,
+  C_Z34 = 34,
+  C_Z44 = 44,
+  C_Z54 = 54,
+  C_Z64 = 64,
+  C_Z74 = 74,
+  C_Z13 = 13,
+  C_Z23 = 23,
+  C_Z33 = 33,
+  C_Z43 = 43,
+  C_Z53 = 53,
+  C_Z63 = 63,
+  C_Z73 = 73,
+  C_Z12 = 12,
+  C_Z22 = 22,
+  C_Z32 = 32,
+  C_Z42 = 42,
+  C_Z52 = 52,
+  C_Z62 = 62,
+  C_Z72 = 72,
+  C_Z11 = 11,
+  C_Z21 = 21,
+  C_Z31 = 31,
+  C_Z41 = 41,
+  M_Z18 = 1018,
+  M_Z28 = 1028,
+  M_Z38 = 1038,
+  M_Z48 = 1048,
+  M_Z58 = 1058,
+  M_Z68 = 1068,
+  M_Z78 = 1078,
+  M_Z17 = 1017,
+  M_Z27 = 1027,
+  M_Z37 = 1037,
+  M_Z47 = 1047,
+  M_Z57 = 1057,
+  M_Z67 = 1067,
+  M_Z77 = 1077,
+  M_Z16 = 1016,
+  M_Z26 = 1026,
+  M_Z36 = 1036,
+  M_Z46 = 1046,
+  M_Z56 = 1056,
+  M_Z66 = 1066,
+  M_Z76 = 1076,
+  M_Z15 = 1015,
+  M_Z25 = 1025,
+  M_Z35 = 1035,
+  M_Z45 = 1045,
+  M_Z55 = 1055,
+  M_Z65 = 1065,
+  M_Z75 = 1075,
+  M_Z14 = 1014,
+  M_Z24 = 1024,
+  M_Z34 = 1034,
+  M_Z44 = 1044,
+  M_Z54 = 1054,
+  M_Z64 = 1064,
+  M_Z74 = 1074,
+  M_Z13 = 1013,
+  M_Z23 = 1023,
+  M_Z33 = 1033,
+  M_Z43 = 1043,
+  M_Z53 = 1053,
+  M_Z63 = 1063,
+  M_Z73 = 1073,
+  M_Z12 = 1012,
+  M_Z22 = 1022,
+  M_Z32 = 1032,
+  M_Z42 = 1042,
+  M_Z52 = 1052,
+  M_Z62 = 1062,
+  M_Z72 = 1072,
+  M_Z11 = 1011,
+  M_Z21 = 1021,
+  M_Z31 = 1031,
+  M_Z41 = 1041
+};
+bool Zone_IsValid(int value);
+constexpr Zone Zone_MIN = C_Z11;
+constexpr Zone Zone_MAX = M_Z78;
+constexpr int Zone_ARRAYSIZE = Zone_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Zone_descriptor();
+template<typename T>
+inline const std::string& Zone_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Zone>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Zone_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Zone_descriptor(), enum_t_value);
+}
+inline bool Zone_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Zone* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Zone>(
+    Zone_descriptor(), name, value);
+}
+// ===================================================================
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace llsf_msgs
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::llsf_msgs::Zone> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::llsf_msgs::Zone>() {
+  return ::llsf_msgs::Zone_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_Zone_2eproto
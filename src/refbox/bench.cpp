@@ -0,0 +1,544 @@
+/***************************************************************************
+ *  bench.cpp - Headless RefBox benchmark with a scripted game
+ *
+ *  Created: Tue Oct 20 09:12:37 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+// Run the RefBox rules with the full game configuration, but without
+// network and machines, for one game on a virtual clock. Robots and the
+// referee are simulated by injecting beacons, machine reports, prepare
+// commands, and deliveries at configurable rates. Reports the latency of
+// the timer cycles, the number of fired rules, and the memory growth.
+
+#include "refbox.h"
+
+#include <msgs/BeaconSignal.pb.h>
+#include <msgs/GameInfo.pb.h>
+#include <msgs/GameState.pb.h>
+#include <msgs/MachineInstructions.pb.h>
+#include <msgs/MachineReport.pb.h>
+#include <msgs/OrderInfo.pb.h>
+#include <unistd.h>
+#include <utils/system/argparser.h>
+
+#include <algorithm>
+#include <chrono>
+#include <clipsmm.h>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace llsfrb;
+using namespace llsf_msgs;
+
+typedef std::chrono::steady_clock WallClock;
+
+static const char *MACHINES[] = {"BS", "CS1", "CS2", "RS1", "RS2", "DS", "SS"};
+static const char *GAME_PHASE =
+  "(fact-slot-value (nth$ 1 (find-fact ((?g gamestate)) TRUE)) phase)";
+
+struct BenchOptions
+{
+	double       duration;
+	unsigned int robots;
+	double       beacon_rate;
+	double       report_period;
+	double       prepare_period;
+	double       delivery_period;
+	long         max_p99_us;
+	unsigned int seed;
+	std::string  team_names[2];
+};
+
+struct TickStats
+{
+	std::vector<double> latencies_us;
+	long long           rules = 0;
+};
+
+static void
+usage(const char *progname)
+{
+	printf("Usage: %s [-d SEC] [-r N] [-b HZ] [-e SEC] [-p SEC] [-D SEC] [-f USEC]\n"
+	       "          [-s SEED] [-t CYAN,MAGENTA] [-- REFBOX-OPTIONS]\n"
+	       " -d SEC        game time to run after the setup phase, default 1200\n"
+	       " -r N          robots per team, default 3\n"
+	       " -b HZ         beacons per robot and second, default 2\n"
+	       " -e SEC        period of machine reports per team in exploration, default 20\n"
+	       " -p SEC        period of prepare commands per team in production, default 10\n"
+	       " -D SEC        period of deliveries per team in production, default 60\n"
+	       " -f USEC       fail if the 99th percentile of the cycle time exceeds USEC\n"
+	       " -s SEED       seed of the random machine and order choice, default 1\n"
+	       " -t CYAN,MAG   team names, default Cyan,Magenta\n"
+	       "Options after -- are passed to the refbox, e.g., --cfg-mps <file>.\n",
+	       progname);
+}
+
+static size_t
+resident_memory()
+{
+	size_t size = 0, resident = 0;
+	FILE * f    = fopen("/proc/self/statm", "r");
+	if (f) {
+		if (fscanf(f, "%zu %zu", &size, &resident) != 2) {
+			resident = 0;
+		}
+		fclose(f);
+	}
+	return resident * sysconf(_SC_PAGESIZE);
+}
+
+static std::string
+eval_symbol(LLSFRefBox &refbox, const std::string &expression)
+{
+	CLIPS::Values rv = refbox.evaluate(expression);
+	if (rv.empty() || (rv[0].type() != CLIPS::TYPE_SYMBOL && rv[0].type() != CLIPS::TYPE_STRING)) {
+		return "";
+	}
+	return rv[0].as_string();
+}
+
+static long long
+eval_integer(LLSFRefBox &refbox, const std::string &expression)
+{
+	CLIPS::Values rv = refbox.evaluate(expression);
+	if (rv.empty() || rv[0].type() != CLIPS::TYPE_INTEGER) {
+		return -1;
+	}
+	return rv[0].as_integer();
+}
+
+static std::string
+machine_slot(const std::string &machine, const char *slot)
+{
+	return "(fact-slot-value (nth$ 1 (find-fact ((?m machine)) (eq ?m:name " + machine + "))) "
+	       + slot + ")";
+}
+
+static void
+print_stats(const char *what, const TickStats &stats)
+{
+	if (stats.latencies_us.empty()) {
+		return;
+	}
+	std::vector<double> v(stats.latencies_us);
+	std::sort(v.begin(), v.end());
+	double sum = 0;
+	for (double d : v) {
+		sum += d;
+	}
+	auto pct = [&v](double p) { return v[std::min(v.size() - 1, (size_t)(p * v.size()))]; };
+	printf("%-12s %7zu %9.1f %9.1f %9.1f %9.1f %9.1f %11.2f\n",
+	       what,
+	       v.size(),
+	       sum / v.size(),
+	       pct(0.5),
+	       pct(0.9),
+	       pct(0.99),
+	       v.back(),
+	       (double)stats.rules / v.size());
+}
+
+static double
+percentile(std::vector<double> v, double p)
+{
+	if (v.empty()) {
+		return 0.;
+	}
+	std::sort(v.begin(), v.end());
+	return v[std::min(v.size() - 1, (size_t)(p * v.size()))];
+}
+
+class BenchScenario
+{
+public:
+	BenchScenario(LLSFRefBox &refbox, const BenchOptions &opts)
+	: refbox_(refbox), opts_(opts), rng_(opts.seed), injected_(0), beacon_seq_(0)
+	{
+		for (int t = 0; t < 2; ++t) {
+			next_report_[t]   = 0.;
+			next_prepare_[t]  = opts_.prepare_period * t / 2.;
+			next_delivery_[t] = opts_.delivery_period * (t + 1) / 2.;
+		}
+	}
+
+	void
+	start()
+	{
+		for (int t = 0; t < 2; ++t) {
+			auto msg = std::make_shared<SetTeamName>();
+			msg->set_team_name(opts_.team_names[t]);
+			msg->set_team_color(t == 0 ? CYAN : MAGENTA);
+			inject(0, msg);
+		}
+		auto msg = std::make_shared<SetGameState>();
+		msg->set_state(GameState::RUNNING);
+		inject(0, msg);
+	}
+
+	void
+	skip_setup()
+	{
+		auto msg = std::make_shared<SetGamePhase>();
+		msg->set_phase(GameState::EXPLORATION);
+		inject(0, msg);
+	}
+
+	// Inject all messages which are due at the given time since the start
+	// of the game, phase is the current phase of the game.
+	void
+	inject_due(double game_sec, const std::string &phase)
+	{
+		if (peers_[0] <= 0 || peers_[1] <= 0) {
+			peers_[0] = eval_integer(refbox_, peer_expr("CYAN"));
+			peers_[1] = eval_integer(refbox_, peer_expr("MAGENTA"));
+			if (peers_[0] <= 0 || peers_[1] <= 0) {
+				return;
+			}
+		}
+		inject_beacons(game_sec);
+		for (int t = 0; t < 2; ++t) {
+			if (phase == "EXPLORATION" && game_sec >= next_report_[t]) {
+				next_report_[t] = game_sec + opts_.report_period;
+				inject_report(t);
+			} else if (phase == "PRODUCTION") {
+				if (game_sec >= next_prepare_[t]) {
+					next_prepare_[t] = game_sec + opts_.prepare_period;
+					inject_prepare(t);
+				}
+				if (game_sec >= next_delivery_[t]) {
+					next_delivery_[t] = game_sec + opts_.delivery_period;
+					inject_delivery(t);
+				}
+			}
+		}
+	}
+
+	unsigned long
+	injected() const
+	{
+		return injected_;
+	}
+
+private:
+	static std::string
+	peer_expr(const char *group)
+	{
+		return std::string("(fact-slot-value (nth$ 1 (find-fact ((?p network-peer)) (eq ?p:group ")
+		       + group + "))) id)";
+	}
+
+	static std::string
+	machine_name(int team, const char *machine)
+	{
+		return std::string(team == 0 ? "C-" : "M-") + machine;
+	}
+
+	void
+	inject(long int peer_id, std::shared_ptr<google::protobuf::Message> msg, unsigned short port = 0)
+	{
+		refbox_.inject_message(peer_id, "127.0.0.1", port > 0 ? port : 4444, msg);
+		++injected_;
+	}
+
+	void
+	inject_beacons(double game_sec)
+	{
+		if (opts_.beacon_rate <= 0.) {
+			return;
+		}
+		// robots send with the same rate, but spread over the period
+		double period = 1. / opts_.beacon_rate;
+		if (next_beacon_.empty()) {
+			for (unsigned int i = 0; i < 2 * opts_.robots; ++i) {
+				next_beacon_.push_back(game_sec + period * i / (2 * opts_.robots));
+			}
+		}
+		const fawkes::Time &now = refbox_.virtual_time();
+		for (unsigned int i = 0; i < next_beacon_.size(); ++i) {
+			if (game_sec < next_beacon_[i]) {
+				continue;
+			}
+			next_beacon_[i] += period;
+			int  team = i / opts_.robots;
+			auto msg  = std::make_shared<BeaconSignal>();
+			msg->mutable_time()->set_sec(now.get_sec());
+			msg->mutable_time()->set_nsec(now.get_nsec());
+			msg->set_seq(++beacon_seq_);
+			msg->set_number(i % opts_.robots + 1);
+			msg->set_team_name(opts_.team_names[team]);
+			msg->set_peer_name("R-" + std::to_string(i % opts_.robots + 1));
+			msg->set_team_color(team == 0 ? CYAN : MAGENTA);
+			Pose2D *pose = msg->mutable_pose();
+			pose->mutable_timestamp()->set_sec(now.get_sec());
+			pose->mutable_timestamp()->set_nsec(now.get_nsec());
+			pose->set_x(std::uniform_real_distribution<float>(-6., 6.)(rng_));
+			pose->set_y(std::uniform_real_distribution<float>(0., 8.)(rng_));
+			pose->set_ori(std::uniform_real_distribution<float>(-3.14, 3.14)(rng_));
+			inject(peers_[team], msg, 4500 + i);
+		}
+	}
+
+	void
+	inject_report(int team)
+	{
+		auto msg = std::make_shared<MachineReport>();
+		msg->set_team_color(team == 0 ? CYAN : MAGENTA);
+		for (const char *m : MACHINES) {
+			std::string name = machine_name(team, m);
+			Zone        zone;
+			if (!Zone_Parse(eval_symbol(refbox_, machine_slot(name, "zone")), &zone)) {
+				continue;
+			}
+			MachineReportEntry *entry = msg->add_machines();
+			entry->set_name(name);
+			entry->set_zone(zone);
+			long long rotation = eval_integer(refbox_, machine_slot(name, "rotation"));
+			if (rotation >= 0) {
+				entry->set_rotation(rotation);
+			}
+		}
+		inject(peers_[team], msg);
+	}
+
+	void
+	inject_prepare(int team)
+	{
+		const char *m   = MACHINES[std::uniform_int_distribution<int>(0, 6)(rng_)];
+		auto        msg = std::make_shared<PrepareMachine>();
+		msg->set_team_color(team == 0 ? CYAN : MAGENTA);
+		msg->set_machine(machine_name(team, m));
+		switch (m[0]) {
+		case 'B':
+			msg->mutable_instruction_bs()->set_side(INPUT);
+			msg->mutable_instruction_bs()->set_color(BASE_RED);
+			break;
+		case 'C': msg->mutable_instruction_cs()->set_operation(RETRIEVE_CAP); break;
+		case 'R': msg->mutable_instruction_rs()->set_ring_color(RING_BLUE); break;
+		case 'D': msg->mutable_instruction_ds()->set_order_id(random_order()); break;
+		case 'S':
+			msg->mutable_instruction_ss()->set_operation(RETRIEVE);
+			msg->mutable_instruction_ss()->set_shelf(0);
+			msg->mutable_instruction_ss()->set_slot(0);
+			break;
+		}
+		inject(peers_[team], msg);
+	}
+
+	void
+	inject_delivery(int team)
+	{
+		long long order = random_order();
+		if (order <= 0) {
+			return;
+		}
+		auto msg = std::make_shared<SetOrderDelivered>();
+		msg->set_team_color(team == 0 ? CYAN : MAGENTA);
+		msg->set_order_id(order);
+		inject(0, msg);
+	}
+
+	long long
+	random_order()
+	{
+		long long num = eval_integer(refbox_, "(length$ (find-all-facts ((?o order)) ?o:active))");
+		if (num <= 0) {
+			return 1;
+		}
+		int i = std::uniform_int_distribution<int>(1, num)(rng_);
+		return eval_integer(refbox_,
+		                    "(fact-slot-value (nth$ " + std::to_string(i)
+		                      + " (find-all-facts ((?o order)) ?o:active)) id)");
+	}
+
+private:
+	LLSFRefBox &        refbox_;
+	const BenchOptions &opts_;
+	std::mt19937        rng_;
+	long long           peers_[2] = {0, 0};
+	std::vector<double> next_beacon_;
+	double              next_report_[2];
+	double              next_prepare_[2];
+	double              next_delivery_[2];
+	unsigned long       injected_;
+	unsigned long       beacon_seq_;
+};
+
+int
+main(int argc, char **argv)
+{
+	// options after -- are for the refbox
+	int bench_argc = argc;
+	for (int i = 1; i < argc; ++i) {
+		if (std::string(argv[i]) == "--") {
+			bench_argc = i;
+			break;
+		}
+	}
+	std::vector<char *> refbox_argv = {argv[0]};
+	for (int i = bench_argc + 1; i < argc; ++i) {
+		refbox_argv.push_back(argv[i]);
+	}
+	refbox_argv.push_back(nullptr);
+
+	fawkes::ArgumentParser argp(bench_argc, argv, "hd:r:b:e:p:D:f:s:t:");
+	if (argp.has_arg("h")) {
+		usage(argv[0]);
+		exit(0);
+	}
+	BenchOptions opts;
+	opts.duration        = argp.has_arg("d") ? argp.parse_float("d") : 1200.;
+	opts.robots          = argp.has_arg("r") ? argp.parse_int("r") : 3;
+	opts.beacon_rate     = argp.has_arg("b") ? argp.parse_float("b") : 2.;
+	opts.report_period   = argp.has_arg("e") ? argp.parse_float("e") : 20.;
+	opts.prepare_period  = argp.has_arg("p") ? argp.parse_float("p") : 10.;
+	opts.delivery_period = argp.has_arg("D") ? argp.parse_float("D") : 60.;
+	opts.max_p99_us      = argp.has_arg("f") ? argp.parse_int("f") : 0;
+	opts.seed            = argp.has_arg("s") ? argp.parse_int("s") : 1;
+	opts.team_names[0]   = "Cyan";
+	opts.team_names[1]   = "Magenta";
+	if (argp.has_arg("t")) {
+		std::string teams = argp.arg("t");
+		size_t      comma = teams.find(',');
+		if (comma == std::string::npos) {
+			usage(argv[0]);
+			exit(1);
+		}
+		opts.team_names[0] = teams.substr(0, comma);
+		opts.team_names[1] = teams.substr(comma + 1);
+	}
+
+	// the refbox parses its own options
+	optind = 0;
+
+	CLIPS::init();
+	LLSFRefBox refbox(refbox_argv.size() - 1, refbox_argv.data(), true);
+	BenchScenario scenario(refbox, opts);
+
+	std::map<std::string, TickStats> phase_stats;
+	TickStats                        all;
+	long long                        max_rules   = 0;
+	size_t                           rss_start   = 0;
+	long long                        clips_start = 0;
+	long long                        facts_start = 0;
+	double                           game_start  = -1.;
+	double                           interval    = 0.;
+	fawkes::Time                     start(refbox.virtual_time());
+	std::string                      phase;
+
+	scenario.start();
+	for (;;) {
+		double elapsed = refbox.virtual_time() - &start;
+		phase          = eval_symbol(refbox, GAME_PHASE);
+		if (phase == "SETUP") {
+			scenario.skip_setup();
+		} else if (game_start < 0. && (phase == "EXPLORATION" || phase == "PRODUCTION")) {
+			game_start  = elapsed;
+			rss_start   = resident_memory();
+			clips_start = eval_integer(refbox, "(mem-used)");
+			facts_start = eval_integer(refbox, "(length$ (get-fact-list))");
+		}
+		if (game_start >= 0.) {
+			if (elapsed - game_start >= opts.duration || phase == "POST_GAME") {
+				break;
+			}
+			scenario.inject_due(elapsed - game_start, phase);
+		} else if (elapsed > 60.) {
+			printf("Game did not start within 60 s, phase %s\n", phase.c_str());
+			return 1;
+		}
+
+		WallClock::time_point t0    = WallClock::now();
+		long int              rules = refbox.tick();
+		WallClock::time_point t1    = WallClock::now();
+		double                us    = std::chrono::duration<double, std::micro>(t1 - t0).count();
+		interval                    = refbox.virtual_time() - &start - elapsed;
+
+		if (game_start >= 0.) {
+			TickStats &ps = phase_stats[phase];
+			ps.latencies_us.push_back(us);
+			ps.rules += rules;
+			all.latencies_us.push_back(us);
+			all.rules += rules;
+			max_rules = std::max(max_rules, (long long)rules);
+		}
+	}
+
+	size_t    rss_end   = resident_memory();
+	long long clips_end = eval_integer(refbox, "(mem-used)");
+	long long facts_end = eval_integer(refbox, "(length$ (get-fact-list))");
+
+	printf("\n%.0f s game time, %zu cycles of %.0f ms, ended in %s\n",
+	       opts.duration,
+	       all.latencies_us.size(),
+	       interval * 1000.,
+	       phase.c_str());
+	printf("%-12s %7s %9s %9s %9s %9s %9s %11s\n",
+	       "phase",
+	       "cycles",
+	       "avg us",
+	       "p50 us",
+	       "p90 us",
+	       "p99 us",
+	       "max us",
+	       "rules/cycle");
+	for (const char *p : {"EXPLORATION", "PRODUCTION", "POST_GAME"}) {
+		if (phase_stats.find(p) != phase_stats.end()) {
+			print_stats(p, phase_stats[p]);
+		}
+	}
+	print_stats("all", all);
+	printf("rules fired  %lld total, at most %lld in one cycle\n", all.rules, max_rules);
+	printf("messages     %lu injected, %llu sent\n",
+	       scenario.injected(),
+	       (unsigned long long)refbox.messages_sent());
+	printf("memory       RSS %.1f -> %.1f MB, CLIPS %.1f -> %.1f MB, facts %lld -> %lld\n",
+	       rss_start / 1048576.,
+	       rss_end / 1048576.,
+	       clips_start / 1048576.,
+	       clips_end / 1048576.,
+	       facts_start,
+	       facts_end);
+
+	if (opts.max_p99_us > 0) {
+		double p99 = percentile(all.latencies_us, 0.99);
+		if (p99 > opts.max_p99_us) {
+			printf("FAILED: p99 cycle time %.1f us exceeds %ld us\n", p99, opts.max_p99_us);
+			return 2;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,255 @@
+/***************************************************************************
+ *  clips_config.cpp - configuration values as CLIPS facts
+ *
+ *  Created: Mon Oct 19 16:21:48 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "clips_config.h"
+
+#include <config/yaml_node.h>
+#include <core/exception.h>
+
+#include <clipsmm.h>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+extern "C" {
+#include <clips/clips.h>
+}
+
+namespace llsfrb {
+
+/// @cond INTERNALS
+
+static const char *
+value_type(const YamlConfigurationNode &n)
+{
+	if (n.is_type<unsigned int>()) {
+		return "UINT";
+	} else if (n.is_type<int>()) {
+		return "INT";
+	} else if (n.is_type<float>()) {
+		return "FLOAT";
+	} else if (n.is_type<bool>()) {
+		return "BOOL";
+	} else if (n.is_type<std::string>()) {
+		return "STRING";
+	} else {
+		return NULL;
+	}
+}
+
+static void *
+value_atom(void *env, const std::string &type, const std::string &value, unsigned short &atom_type)
+{
+	if (type == "UINT" || type == "INT") {
+		// base 0 like the YAML integer conversion, which accepts hex values
+		atom_type = INTEGER;
+		return EnvAddLong(env, strtoll(value.c_str(), NULL, 0));
+	} else if (type == "FLOAT") {
+		atom_type = FLOAT;
+		return EnvAddDouble(env, strtod(value.c_str(), NULL));
+	} else if (type == "BOOL") {
+		bool b = false;
+		yaml_utils::convert(value, b);
+		atom_type = SYMBOL;
+		return EnvAddSymbol(env, b ? "true" : "false");
+	} else {
+		atom_type = STRING;
+		return EnvAddSymbol(env, value.c_str());
+	}
+}
+
+static void
+node_value(void *env, const YamlConfigurationNode &n, const std::string &type, DATA_OBJECT *rv)
+{
+	unsigned short atom_type;
+	if (n.is_list()) {
+		std::vector<std::string> values = n.get_list<std::string>();
+		void *                   mf     = EnvCreateMultifield(env, values.size());
+		for (size_t i = 0; i < values.size(); ++i) {
+			void *atom = value_atom(env, type, values[i], atom_type);
+			SetMFType(mf, i + 1, atom_type);
+			SetMFValue(mf, i + 1, atom);
+		}
+		SetpType(rv, MULTIFIELD);
+		SetpValue(rv, mf);
+		SetpDOBegin(rv, 1);
+		SetpDOEnd(rv, values.size());
+	} else {
+		void *atom = value_atom(env, type, n.get_value<std::string>(), atom_type);
+		SetpType(rv, atom_type);
+		SetpValue(rv, atom);
+	}
+}
+
+static void
+clips_load_config(void *env)
+{
+	ClipsConfig *config = static_cast<ClipsConfig *>(GetEnvironmentFunctionContext(env));
+	try {
+		config->load(EnvRtnLexeme(env, 1));
+	} catch (fawkes::Exception &e) {
+		EnvPrintRouter(env, WERROR, "[load-config] ");
+		EnvPrintRouter(env, WERROR, e.what_no_backtrace());
+		EnvPrintRouter(env, WERROR, "\n");
+		SetEvaluationError(env, TRUE);
+	}
+}
+
+static void
+clips_config_get(void *env, DATA_OBJECT *rv)
+{
+	ClipsConfig *config = static_cast<ClipsConfig *>(GetEnvironmentFunctionContext(env));
+	std::shared_ptr<YamlConfigurationNode> n    = config->value_node(EnvRtnLexeme(env, 1));
+	const char *                           type = n ? value_type(*n) : NULL;
+	if (type) {
+		node_value(env, *n, type, rv);
+	} else {
+		SetpType(rv, SYMBOL);
+		SetpValue(rv, EnvFalseSymbol(env));
+	}
+}
+
+/// @endcond
+
+/** @class ClipsConfig "clips_config.h"
+ * Configuration values in CLIPS.
+ * The CLIPS function (load-config <prefix>) asserts a confval fact for
+ * each value below the prefix. The slots are set from the typed values,
+ * list values are asserted as multifield of typed elements, instead of
+ * formatting a fact string for CLIPS to parse.
+ *
+ * The CLIPS function (config-get <path>) looks up a single value in the
+ * configuration tree, which takes time in the depth of the path, rather
+ * than in the number of confval facts a rule would have to match. It
+ * returns the value as integer, float, string, or the symbols true and
+ * false, a list value as multifield, and FALSE if there is no value at
+ * the path.
+ */
+
+/** Constructor.
+ * Registers the CLIPS functions.
+ * @param env CLIPS environment, must outlive the instance
+ * @param config configuration to provide, must be a YAML configuration
+ * @exception Exception thrown if the configuration is not a YAML configuration
+ */
+ClipsConfig::ClipsConfig(CLIPS::Environment *env, Configuration *config)
+: env_(env->cobj()), config_(dynamic_cast<YamlConfiguration *>(config))
+{
+	if (!config_) {
+		throw fawkes::Exception("CLIPS config requires a YAML configuration");
+	}
+	EnvDefineFunctionWithContext(
+	  env_, "load-config", 'v', PTIEF clips_load_config, "clips_load_config", "11s", this);
+	EnvDefineFunctionWithContext(
+	  env_, "config-get", 'u', PTIEF clips_config_get, "clips_config_get", "11s", this);
+}
+
+/** Assert confval facts.
+ * @param prefix path prefix of the values to assert
+ * @return number of asserted facts
+ * @exception Exception thrown if the confval template is not defined
+ */
+size_t
+ClipsConfig::load(const std::string &prefix)
+{
+	void *tmpl = EnvFindDeftemplate(env_, "confval");
+	if (!tmpl) {
+		throw fawkes::Exception("Cannot load config, confval template is not defined");
+	}
+
+	std::string path = prefix;
+	if (!path.empty() && path[path.size() - 1] == '/') {
+		path.resize(path.size() - 1);
+	}
+	std::map<std::string, std::shared_ptr<YamlConfigurationNode>> nodes;
+	try {
+		config_->query(path.c_str())->enum_leafs(nodes, path);
+	} catch (fawkes::Exception &e) {
+		return 0;
+	} // nothing to load
+
+	size_t loaded = 0;
+	for (const auto &n : nodes) {
+		const char *type = value_type(*n.second);
+		if (!type) {
+			EnvPrintRouter(env_, WERROR, "Config value at ");
+			EnvPrintRouter(env_, WERROR, n.first.c_str());
+			EnvPrintRouter(env_, WERROR, " is of unknown type\n");
+			continue;
+		}
+
+		void *      fact = EnvCreateFact(env_, tmpl);
+		DATA_OBJECT value;
+		SetType(value, STRING);
+		SetValue(value, EnvAddSymbol(env_, n.first.c_str()));
+		EnvPutFactSlot(env_, fact, "path", &value);
+		SetType(value, SYMBOL);
+		SetValue(value, EnvAddSymbol(env_, type));
+		EnvPutFactSlot(env_, fact, "type", &value);
+		node_value(env_, *n.second, type, &value);
+		if (n.second->is_list()) {
+			EnvPutFactSlot(env_, fact, "list-value", &value);
+			SetType(value, SYMBOL);
+			SetValue(value, EnvAddSymbol(env_, "TRUE"));
+			EnvPutFactSlot(env_, fact, "is-list", &value);
+		} else {
+			EnvPutFactSlot(env_, fact, "value", &value);
+		}
+		EnvAssignFactSlotDefaults(env_, fact);
+		EnvAssert(env_, fact);
+		++loaded;
+	}
+	return loaded;
+}
+
+/** Get the node of a value.
+ * @param path path of the value
+ * @return node of the single or list value at the path, NULL if there is
+ * no such value
+ */
+std::shared_ptr<YamlConfigurationNode>
+ClipsConfig::value_node(const std::string &path) const
+{
+	try {
+		std::shared_ptr<YamlConfigurationNode> n = config_->query(path.c_str());
+		if (!n->has_children()) {
+			return n;
+		}
+	} catch (fawkes::Exception &e) {
+	} // no such value
+	return std::shared_ptr<YamlConfigurationNode>();
+}
+
+} // end of namespace llsfrb
@@ -0,0 +1,268 @@
+/***************************************************************************
+ *  clips_deadlines.cpp - keyed deadlines for CLIPS rules
+ *
+ *  Created: Tue Oct 20 11:05:42 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "clips_deadlines.h"
+
+#include <cstdio>
+
+extern "C" {
+#include <clips/clips.h>
+}
+
+namespace llsfrb {
+
+/// @cond INTERNALS
+
+static CLIPS::Value
+clips_value(unsigned short type, void *value)
+{
+	switch (type) {
+	case FLOAT: return CLIPS::Value(ValueToDouble(value));
+	case INTEGER: return CLIPS::Value((long long int)ValueToLong(value));
+	case STRING: return CLIPS::Value(ValueToString(value), CLIPS::TYPE_STRING);
+	case INSTANCE_NAME: return CLIPS::Value(ValueToString(value), CLIPS::TYPE_INSTANCE_NAME);
+	default: return CLIPS::Value(ValueToString(value), CLIPS::TYPE_SYMBOL);
+	}
+}
+
+static void *
+clips_atom(void *env, const CLIPS::Value &v, unsigned short &type)
+{
+	switch (v.type()) {
+	case CLIPS::TYPE_FLOAT: type = FLOAT; return EnvAddDouble(env, v.as_float());
+	case CLIPS::TYPE_INTEGER: type = INTEGER; return EnvAddLong(env, v.as_integer());
+	case CLIPS::TYPE_STRING: type = STRING; return EnvAddSymbol(env, v.as_string().c_str());
+	case CLIPS::TYPE_INSTANCE_NAME:
+		type = INSTANCE_NAME;
+		return EnvAddSymbol(env, v.as_string().c_str());
+	default: type = SYMBOL; return EnvAddSymbol(env, v.as_string().c_str());
+	}
+}
+
+/** Get the key argument, a single value or a multifield. */
+static CLIPS::Values
+clips_key_argument(void *env)
+{
+	DATA_OBJECT   arg;
+	CLIPS::Values key;
+	EnvRtnUnknown(env, 1, &arg);
+	if (GetType(arg) == MULTIFIELD) {
+		for (long i = GetDOBegin(arg); i <= GetDOEnd(arg); ++i) {
+			key.push_back(clips_value(GetMFType(GetValue(arg), i), GetMFValue(GetValue(arg), i)));
+		}
+	} else {
+		key.push_back(clips_value(GetType(arg), GetValue(arg)));
+	}
+	return key;
+}
+
+static void
+clips_deadline_set(void *env)
+{
+	ClipsDeadlines *deadlines = static_cast<ClipsDeadlines *>(GetEnvironmentFunctionContext(env));
+	deadlines->set(clips_key_argument(env), EnvRtnDouble(env, 2));
+}
+
+static void
+clips_deadline_cancel(void *env)
+{
+	ClipsDeadlines *deadlines = static_cast<ClipsDeadlines *>(GetEnvironmentFunctionContext(env));
+	deadlines->cancel(clips_key_argument(env));
+}
+
+static int
+clips_deadline_pending(void *env)
+{
+	ClipsDeadlines *deadlines = static_cast<ClipsDeadlines *>(GetEnvironmentFunctionContext(env));
+	return deadlines->pending(clips_key_argument(env)) ? TRUE : FALSE;
+}
+
+static void
+clips_deadline_clear(void *env)
+{
+	static_cast<ClipsDeadlines *>(GetEnvironmentFunctionContext(env))->clear();
+}
+
+/// @endcond
+
+/** @class ClipsDeadlines "clips_deadlines.h"
+ * Keyed one-shot deadlines for CLIPS rules.
+ * The CLIPS function (deadline-set <key> <seconds>) sets a deadline, the
+ * key is a single value or a multifield. Once the deadline has passed,
+ * expire() asserts the fact (deadline <key...>), e.g., the key
+ * (create$ robot-lost "Carologistics" 1) results in the fact
+ * (deadline robot-lost "Carologistics" 1). The fact is built from the
+ * typed values of the key, they are never formatted into a string for
+ * CLIPS to parse, hence keys may contain arbitrary strings received from
+ * the network. Setting a deadline replaces a pending deadline with an
+ * equal key. (deadline-cancel <key>), (deadline-pending <key>), and
+ * (deadline-clear) cancel deadlines and check for a pending deadline.
+ */
+
+/** Constructor.
+ * Registers the CLIPS functions.
+ * @param env CLIPS environment, must outlive the instance
+ * @param now function returning the current time of the game
+ */
+ClipsDeadlines::ClipsDeadlines(CLIPS::Environment *env, std::function<fawkes::Time()> now)
+: env_(env->cobj()), now_(now)
+{
+	EnvDefineFunctionWithContext(
+	  env_, "deadline-set", 'v', PTIEF clips_deadline_set, "clips_deadline_set", "22uun", this);
+	EnvDefineFunctionWithContext(env_,
+	                             "deadline-cancel",
+	                             'v',
+	                             PTIEF clips_deadline_cancel,
+	                             "clips_deadline_cancel",
+	                             "11u",
+	                             this);
+	EnvDefineFunctionWithContext(env_,
+	                             "deadline-pending",
+	                             'b',
+	                             PTIEF clips_deadline_pending,
+	                             "clips_deadline_pending",
+	                             "11u",
+	                             this);
+	EnvDefineFunctionWithContext(
+	  env_, "deadline-clear", 'v', PTIEF clips_deadline_clear, "clips_deadline_clear", "00", this);
+}
+
+/** Set a deadline.
+ * @param key key of the deadline, replaces a pending deadline with an equal key
+ * @param seconds time from now until the deadline expires, deadlines of zero
+ * or less seconds expire on the next call to expire()
+ */
+void
+ClipsDeadlines::set(const CLIPS::Values &key, double seconds)
+{
+	std::string  key_id   = id(key);
+	fawkes::Time deadline = now_();
+	deadline += seconds;
+	keys_[key_id] = key;
+	queue_.set(key_id, deadline);
+}
+
+/** Cancel a deadline.
+ * @param key key of the deadline
+ * @return true if a deadline was pending for the key, false otherwise
+ */
+bool
+ClipsDeadlines::cancel(const CLIPS::Values &key)
+{
+	std::string key_id = id(key);
+	keys_.erase(key_id);
+	return queue_.cancel(key_id);
+}
+
+/** Check if a deadline is pending.
+ * @param key key of the deadline
+ * @return true if a deadline is pending for the key, false otherwise
+ */
+bool
+ClipsDeadlines::pending(const CLIPS::Values &key) const
+{
+	return queue_.pending(id(key));
+}
+
+/** Cancel all deadlines. */
+void
+ClipsDeadlines::clear()
+{
+	queue_.clear();
+	keys_.clear();
+}
+
+/** Assert the facts of all expired deadlines.
+ * Must be called from the CLIPS thread.
+ * @return number of expired deadlines
+ */
+size_t
+ClipsDeadlines::expire()
+{
+	return queue_.expire(now_(), [this](const std::string &key_id) {
+		auto k = keys_.find(key_id);
+		if (k == keys_.end()) {
+			return;
+		}
+		CLIPS::Values key = std::move(k->second);
+		keys_.erase(k);
+
+		// the implied deftemplate exists once a rule matches deadline facts
+		void *tmpl = EnvFindDeftemplate(env_, "deadline");
+		if (!tmpl) {
+			return;
+		}
+		void *fact = EnvCreateFact(env_, tmpl);
+		void *mf   = EnvCreateMultifield(env_, key.size());
+		for (size_t i = 0; i < key.size(); ++i) {
+			unsigned short type;
+			void *         atom = clips_atom(env_, key[i], type);
+			SetMFType(mf, i + 1, type);
+			SetMFValue(mf, i + 1, atom);
+		}
+		DATA_OBJECT value;
+		SetType(value, MULTIFIELD);
+		SetValue(value, mf);
+		SetDOBegin(value, 1);
+		SetDOEnd(value, key.size());
+		// ordered facts have a single implied multifield slot without name
+		EnvPutFactSlot(env_, fact, NULL, &value);
+		EnvAssert(env_, fact);
+	});
+}
+
+std::string
+ClipsDeadlines::id(const CLIPS::Values &key)
+{
+	// type-tagged and length-prefixed, such that distinct keys never collide
+	std::string rv;
+	for (const CLIPS::Value &v : key) {
+		std::string s;
+		switch (v.type()) {
+		case CLIPS::TYPE_FLOAT: {
+			char buf[32];
+			snprintf(buf, sizeof(buf), "%.17g", v.as_float());
+			s = buf;
+			break;
+		}
+		case CLIPS::TYPE_INTEGER: s = std::to_string(v.as_integer()); break;
+		default: s = v.as_string(); break;
+		}
+		rv += std::to_string((int)v.type()) + ":" + std::to_string(s.size()) + ":" + s;
+	}
+	return rv;
+}
+
+} // end of namespace llsfrb
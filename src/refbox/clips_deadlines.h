@@ -0,0 +1,70 @@
+/***************************************************************************
+ *  clips_deadlines.h - keyed deadlines for CLIPS rules
+ *
+ *  Created: Tue Oct 20 11:05:42 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LLSF_REFBOX_CLIPS_DEADLINES_H_
+#define __LLSF_REFBOX_CLIPS_DEADLINES_H_
+
+#include <utils/time/deadlines.h>
+
+#include <clipsmm.h>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+namespace llsfrb {
+
+class ClipsDeadlines
+{
+public:
+	ClipsDeadlines(CLIPS::Environment *env, std::function<fawkes::Time()> now);
+
+	void   set(const CLIPS::Values &key, double seconds);
+	bool   cancel(const CLIPS::Values &key);
+	bool   pending(const CLIPS::Values &key) const;
+	void   clear();
+	size_t expire();
+
+private:
+	static std::string id(const CLIPS::Values &key);
+
+	void *                                         env_;
+	std::function<fawkes::Time()>                  now_;
+	fawkes::DeadlineQueue                          queue_;
+	std::unordered_map<std::string, CLIPS::Values> keys_;
+};
+
+} // end of namespace llsfrb
+
+#endif
@@ -0,0 +1,194 @@
+/***************************************************************************
+ *  clips_image.cpp - binary images of the CLIPS rule base
+ *
+ *  Created: Mon Oct 19 14:02:11 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "clips_image.h"
+
+#include <config/config.h>
+#include <core/exception.h>
+#include <core/version.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <clipsmm.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <unistd.h>
+#include <vector>
+
+extern "C" {
+#include <clips/clips.h>
+}
+
+namespace llsfrb {
+
+/// @cond INTERNALS
+
+/** 64-bit FNV-1a hash over the inputs of the rule base. */
+class ImageKey
+{
+public:
+	void
+	add(const char *data, size_t size)
+	{
+		for (size_t i = 0; i < size; ++i) {
+			hash_ = (hash_ ^ (unsigned char)data[i]) * 0x100000001b3ULL;
+		}
+		// separate consecutive inputs, "ab" + "c" must differ from "a" + "bc"
+		hash_ = (hash_ ^ 0xff) * 0x100000001b3ULL;
+	}
+
+	void
+	add(const std::string &s)
+	{
+		add(s.data(), s.size());
+	}
+
+	std::string
+	str() const
+	{
+		char buf[17];
+		snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)hash_);
+		return buf;
+	}
+
+private:
+	uint64_t hash_ = 0xcbf29ce484222325ULL;
+};
+
+/// @endcond
+
+/** Compute the key of a CLIPS image.
+ * The rule base depends on the CLIPS files, on the configuration, which
+ * decides which files are loaded, and on the deffacts defined before the
+ * files are loaded, which announce the features of the refbox. The image
+ * itself depends on the CLIPS version and on the platform. An image may
+ * be loaded in place of the files if its key matches.
+ * @param clips CLIPS environment with the constructs defined before
+ * loading the CLIPS files
+ * @param clips_dir directory of the CLIPS files
+ * @param config configuration
+ * @return key as hex string
+ */
+std::string
+clips_image_key(CLIPS::Environment *clips, const std::string &clips_dir, Configuration *config)
+{
+	ImageKey key;
+	key.add(FAWKES_VERSION_STRING);
+	// the binary format depends on the CLIPS build and the platform
+	key.add(VERSION_STRING);
+	key.add(CREATION_DATE_STRING);
+	key.add(std::to_string(sizeof(void *)) + "/" + std::to_string(sizeof(long)));
+
+	std::vector<std::string> files;
+	if (DIR *dir = opendir(clips_dir.c_str())) {
+		while (struct dirent *e = readdir(dir)) {
+			std::string name = e->d_name;
+			if (name.size() > 4 && name.compare(name.size() - 4, 4, ".clp") == 0) {
+				files.push_back(name);
+			}
+		}
+		closedir(dir);
+	} else {
+		throw fawkes::Exception("Cannot read CLIPS directory %s: %s",
+		                        clips_dir.c_str(),
+		                        strerror(errno));
+	}
+	std::sort(files.begin(), files.end());
+	for (const std::string &f : files) {
+		std::ifstream     in(clips_dir + "/" + f);
+		std::stringstream content;
+		content << in.rdbuf();
+		key.add(f);
+		key.add(content.str());
+	}
+
+	std::shared_ptr<Configuration::ValueIterator> v(config->iterator());
+	while (v->next()) {
+		key.add(v->path());
+		key.add(v->type());
+		key.add(v->get_as_string());
+	}
+
+	void *env = clips->cobj();
+	for (void *d = EnvGetNextDeffacts(env, NULL); d; d = EnvGetNextDeffacts(env, d)) {
+		key.add(EnvGetDeffactsName(env, d));
+	}
+
+	return key.str();
+}
+
+/** Load a CLIPS image.
+ * This replaces all constructs of the environment by those of the
+ * image. The functions used by the constructs must have been defined.
+ * @param clips CLIPS environment to load the image into
+ * @param file image file
+ * @exception Exception thrown if the image cannot be loaded
+ */
+void
+clips_image_load(CLIPS::Environment *clips, const std::string &file)
+{
+	if (!EnvBload(clips->cobj(), file.c_str())) {
+		throw fawkes::Exception("Failed to load CLIPS image %s", file.c_str());
+	}
+}
+
+/** Save a CLIPS image.
+ * The image is written to a temporary file, which is then renamed, such
+ * that concurrently starting refboxes never load a partial image.
+ * @param clips CLIPS environment whose constructs to save
+ * @param file image file
+ * @exception Exception thrown if the image cannot be saved
+ */
+void
+clips_image_save(CLIPS::Environment *clips, const std::string &file)
+{
+	std::string tmp_file = file + ".tmp" + std::to_string(getpid());
+	if (!EnvBsave(clips->cobj(), tmp_file.c_str())) {
+		unlink(tmp_file.c_str());
+		throw fawkes::Exception("Failed to save CLIPS image %s", tmp_file.c_str());
+	}
+	if (rename(tmp_file.c_str(), file.c_str()) != 0) {
+		int err = errno;
+		unlink(tmp_file.c_str());
+		throw fawkes::Exception("Failed to rename CLIPS image to %s: %s", file.c_str(), strerror(err));
+	}
+}
+
+} // end of namespace llsfrb
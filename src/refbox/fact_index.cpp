@@ -0,0 +1,323 @@
+/***************************************************************************
+ *  fact_index.cpp - hash indexes on slots of CLIPS facts
+ *
+ *  Created: Tue Oct 20 09:12:37 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fact_index.h"
+
+#include <core/exception.h>
+
+#include <clipsmm.h>
+
+extern "C" {
+#include <clips/clips.h>
+}
+
+namespace llsfrb {
+
+/// @cond INTERNALS
+
+static void
+clips_print_error(void *env, const char *func, const fawkes::Exception &e)
+{
+	EnvPrintRouter(env, WERROR, "[");
+	EnvPrintRouter(env, WERROR, func);
+	EnvPrintRouter(env, WERROR, "] ");
+	EnvPrintRouter(env, WERROR, e.what_no_backtrace());
+	EnvPrintRouter(env, WERROR, "\n");
+	SetEvaluationError(env, TRUE);
+}
+
+static void
+clips_fact_by_key(void *env, DATA_OBJECT *rv)
+{
+	ClipsFactIndex *index = static_cast<ClipsFactIndex *>(GetEnvironmentFunctionContext(env));
+	DATA_OBJECT     value;
+	void *          fact = nullptr;
+	EnvRtnUnknown(env, 3, &value);
+	try {
+		fact = index->lookup(EnvRtnLexeme(env, 1),
+		                     EnvRtnLexeme(env, 2),
+		                     GetType(value),
+		                     GetValue(value));
+	} catch (fawkes::Exception &e) {
+		clips_print_error(env, "fact-by-key", e);
+	}
+	if (fact) {
+		SetpType(rv, FACT_ADDRESS);
+		SetpValue(rv, fact);
+	} else {
+		SetpType(rv, SYMBOL);
+		SetpValue(rv, EnvFalseSymbol(env));
+	}
+}
+
+static void
+clips_facts_by_key(void *env, DATA_OBJECT *rv)
+{
+	ClipsFactIndex *    index = static_cast<ClipsFactIndex *>(GetEnvironmentFunctionContext(env));
+	DATA_OBJECT         value;
+	std::vector<void *> facts;
+	EnvRtnUnknown(env, 3, &value);
+	try {
+		index->lookup_all(
+		  EnvRtnLexeme(env, 1), EnvRtnLexeme(env, 2), GetType(value), GetValue(value), facts);
+	} catch (fawkes::Exception &e) {
+		clips_print_error(env, "facts-by-key", e);
+	}
+	void *mf = EnvCreateMultifield(env, facts.size());
+	for (size_t i = 0; i < facts.size(); ++i) {
+		SetMFType(mf, i + 1, FACT_ADDRESS);
+		SetMFValue(mf, i + 1, facts[i]);
+	}
+	SetpType(rv, MULTIFIELD);
+	SetpValue(rv, mf);
+	SetpDOBegin(rv, 1);
+	SetpDOEnd(rv, facts.size());
+}
+
+/// @endcond
+
+/** @class ClipsFactIndex "fact_index.h"
+ * Hash indexes on single-field slots of CLIPS facts.
+ * Rules which look up a fact by a key slot, e.g., an order by its ID or a
+ * machine by its name, otherwise have to test every fact of the template
+ * in a fact set query. The index provides the CLIPS functions
+ * (fact-by-key <template> <slot> <value>), returning the first fact of
+ * the template whose slot is eq to the value or FALSE, and
+ * (facts-by-key <template> <slot> <value>), returning all such facts in
+ * fact list order as a multifield.
+ *
+ * An index is created on the first lookup of a template and slot pair.
+ * CLIPS 6.3 does not notify about single asserted or retracted facts,
+ * therefore the index is brought up to date on each lookup. Modifying a
+ * fact asserts a new fact, which is appended to the fact list of its
+ * template, hence only the facts asserted since the previous lookup need
+ * to be visited. The indexed facts are kept alive by their busy count,
+ * retracted facts are dropped when encountered during a lookup and in a
+ * sweep once the index has doubled in size. Resetting or clearing the
+ * environment drops all indexes.
+ *
+ * The index is only accessed from the CLIPS thread.
+ */
+
+/** Constructor.
+ * Registers the CLIPS functions of the index.
+ * @param env CLIPS environment to index, must outlive the index
+ */
+ClipsFactIndex::ClipsFactIndex(CLIPS::Environment *env) : env_(env->cobj())
+{
+	EnvDefineFunctionWithContext(env_,
+	                             "fact-by-key",
+	                             'u',
+	                             PTIEF clips_fact_by_key,
+	                             "clips_fact_by_key",
+	                             "33ukk",
+	                             this);
+	EnvDefineFunctionWithContext(env_,
+	                             "facts-by-key",
+	                             'm',
+	                             PTIEF clips_facts_by_key,
+	                             "clips_facts_by_key",
+	                             "33ukk",
+	                             this);
+	env->signal_reset().connect(sigc::mem_fun(*this, &ClipsFactIndex::clear));
+	env->signal_clear().connect(sigc::mem_fun(*this, &ClipsFactIndex::clear));
+}
+
+/** Destructor. */
+ClipsFactIndex::~ClipsFactIndex()
+{
+	clear();
+}
+
+/** Look up a fact by the value of a slot.
+ * @param tmpl name of the deftemplate
+ * @param slot name of a single-field slot of the deftemplate
+ * @param type CLIPS type of the value
+ * @param value CLIPS atom of the value
+ * @return oldest fact whose slot is eq to the value, NULL if there is none
+ * @exception Exception thrown if the template or slot does not exist
+ */
+void *
+ClipsFactIndex::lookup(const std::string &tmpl,
+                       const std::string &slot,
+                       unsigned short     type,
+                       void *             value)
+{
+	std::vector<void *> facts;
+	lookup_all(tmpl, slot, type, value, facts);
+	return facts.empty() ? nullptr : facts.front();
+}
+
+/** Look up all facts with a given value of a slot.
+ * @param tmpl name of the deftemplate
+ * @param slot name of a single-field slot of the deftemplate
+ * @param type CLIPS type of the value
+ * @param value CLIPS atom of the value
+ * @param facts upon return contains the facts whose slot is eq to the
+ * value, oldest first
+ * @exception Exception thrown if the template or slot does not exist
+ */
+void
+ClipsFactIndex::lookup_all(const std::string &  tmpl,
+                           const std::string &  slot,
+                           unsigned short       type,
+                           void *               value,
+                           std::vector<void *> &facts)
+{
+	Index *index = get_index(tmpl, slot);
+	update(*index);
+
+	facts.clear();
+	auto b = index->buckets.find(Key(type, value));
+	if (b == index->buckets.end()) {
+		return;
+	}
+	for (void *f : b->second) {
+		if (EnvFactExistp(env_, f)) {
+			facts.push_back(f);
+		} else {
+			EnvDecrementFactCount(env_, f);
+			index->held -= 1;
+		}
+	}
+	if (facts.empty()) {
+		index->buckets.erase(b);
+	} else if (facts.size() < b->second.size()) {
+		b->second = facts;
+	}
+}
+
+/** Drop all indexes.
+ * They are re-created on the next lookup.
+ */
+void
+ClipsFactIndex::clear()
+{
+	for (auto &i : indexes_) {
+		release(i.second);
+	}
+	indexes_.clear();
+}
+
+ClipsFactIndex::Index *
+ClipsFactIndex::get_index(const std::string &tmpl, const std::string &slot)
+{
+	auto i = indexes_.find(std::make_pair(tmpl, slot));
+	if (i != indexes_.end()) {
+		return &i->second;
+	}
+
+	void *deftemplate = EnvFindDeftemplate(env_, tmpl.c_str());
+	if (!deftemplate) {
+		throw fawkes::Exception("Cannot index unknown template %s", tmpl.c_str());
+	}
+	if (!EnvDeftemplateSlotExistP(env_, deftemplate, slot.c_str())) {
+		throw fawkes::Exception("Template %s has no slot %s", tmpl.c_str(), slot.c_str());
+	}
+	if (EnvDeftemplateSlotMultiP(env_, deftemplate, slot.c_str())) {
+		throw fawkes::Exception("Cannot index multi-field slot %s of %s", slot.c_str(), tmpl.c_str());
+	}
+
+	Index &index = indexes_[std::make_pair(tmpl, slot)];
+	index.slot   = slot;
+	index.tmpl   = deftemplate;
+	return &index;
+}
+
+void
+ClipsFactIndex::update(Index &index)
+{
+	// New facts are appended to the fact list of the template, collect
+	// those asserted since the last update from its end
+	struct fact *last = static_cast<struct deftemplate *>(index.tmpl)->lastFact;
+	if (!last || last->factIndex <= index.last_index) {
+		return;
+	}
+	std::vector<struct fact *> added;
+	for (struct fact *f = last; f && f->factIndex > index.last_index; f = f->previousTemplateFact) {
+		added.push_back(f);
+	}
+	index.last_index = last->factIndex;
+
+	for (auto f = added.rbegin(); f != added.rend(); ++f) {
+		DATA_OBJECT value;
+		EnvGetFactSlot(env_, *f, index.slot.c_str(), &value);
+		EnvIncrementFactCount(env_, *f);
+		index.buckets[Key(GetType(value), GetValue(value))].push_back(*f);
+		index.held += 1;
+	}
+	if (index.held > index.sweep_at) {
+		sweep(index);
+	}
+}
+
+void
+ClipsFactIndex::sweep(Index &index)
+{
+	for (auto b = index.buckets.begin(); b != index.buckets.end();) {
+		std::vector<void *> &facts = b->second;
+		size_t               live  = 0;
+		for (void *f : facts) {
+			if (EnvFactExistp(env_, f)) {
+				facts[live++] = f;
+			} else {
+				EnvDecrementFactCount(env_, f);
+				index.held -= 1;
+			}
+		}
+		facts.resize(live);
+		if (facts.empty()) {
+			b = index.buckets.erase(b);
+		} else {
+			++b;
+		}
+	}
+	index.sweep_at = 2 * index.held + 64;
+}
+
+void
+ClipsFactIndex::release(Index &index)
+{
+	for (auto &b : index.buckets) {
+		for (void *f : b.second) {
+			EnvDecrementFactCount(env_, f);
+		}
+	}
+	index.buckets.clear();
+	index.held = 0;
+}
+
+} // end of namespace llsfrb
@@ -0,0 +1,101 @@
+/***************************************************************************
+ *  fact_index.h - hash indexes on slots of CLIPS facts
+ *
+ *  Created: Tue Oct 20 09:12:37 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LLSF_REFBOX_FACT_INDEX_H_
+#define __LLSF_REFBOX_FACT_INDEX_H_
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CLIPS {
+class Environment;
+}
+
+namespace llsfrb {
+
+class ClipsFactIndex
+{
+public:
+	ClipsFactIndex(CLIPS::Environment *env);
+	~ClipsFactIndex();
+
+	void *lookup(const std::string &tmpl, const std::string &slot, unsigned short type, void *value);
+	void  lookup_all(const std::string &  tmpl,
+	                 const std::string &  slot,
+	                 unsigned short       type,
+	                 void *               value,
+	                 std::vector<void *> &facts);
+
+	void clear();
+
+private:
+	/// @cond INTERNALS
+	typedef std::pair<unsigned short, void *> Key;
+	struct KeyHash
+	{
+		size_t
+		operator()(const Key &k) const
+		{
+			return std::hash<void *>()(k.second) ^ k.first;
+		}
+	};
+
+	struct Index
+	{
+		std::string                                           slot;
+		void *                                                tmpl       = nullptr;
+		long long                                             last_index = -1;
+		size_t                                                held       = 0;
+		size_t                                                sweep_at   = 0;
+		std::unordered_map<Key, std::vector<void *>, KeyHash> buckets;
+	};
+	/// @endcond
+
+	Index *get_index(const std::string &tmpl, const std::string &slot);
+	void   update(Index &index);
+	void   sweep(Index &index);
+	void   release(Index &index);
+
+	void *                                               env_;
+	std::map<std::pair<std::string, std::string>, Index> indexes_;
+};
+
+} // end of namespace llsfrb
+
+#endif
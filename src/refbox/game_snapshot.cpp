@@ -0,0 +1,282 @@
+/***************************************************************************
+ *  game_snapshot.cpp - periodic snapshots of the game state
+ *
+ *  Created: Thu Oct 22 13:27:45 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "game_snapshot.h"
+
+#include <clips_replica/fact_archive.h>
+#include <core/exception.h>
+
+#include <algorithm>
+#include <clipsmm.h>
+#include <ctime>
+#include <set>
+
+extern "C" {
+#include <clips/clips.h>
+}
+
+namespace llsfrb {
+
+/// @cond INTERNALS
+static void *
+clips_atom(void *env, const CLIPS::Value &v, unsigned short &type)
+{
+	switch (v.type()) {
+	case CLIPS::TYPE_FLOAT: type = FLOAT; return EnvAddDouble(env, v.as_float());
+	case CLIPS::TYPE_INTEGER: type = INTEGER; return EnvAddLong(env, v.as_integer());
+	case CLIPS::TYPE_STRING: type = STRING; return EnvAddSymbol(env, v.as_string().c_str());
+	case CLIPS::TYPE_INSTANCE_NAME:
+		type = INSTANCE_NAME;
+		return EnvAddSymbol(env, v.as_string().c_str());
+	default: type = SYMBOL; return EnvAddSymbol(env, v.as_string().c_str());
+	}
+}
+
+static bool
+put_slot(void *env, void *tmpl, void *fact, const std::string &slot, const CLIPS::Values &values)
+{
+	DATA_OBJECT    value;
+	unsigned short type;
+	if (EnvDeftemplateSlotMultiP(env, tmpl, slot.c_str())) {
+		void *mf = EnvCreateMultifield(env, values.size());
+		for (size_t i = 0; i < values.size(); ++i) {
+			void *atom = clips_atom(env, values[i], type);
+			SetMFType(mf, i + 1, type);
+			SetMFValue(mf, i + 1, atom);
+		}
+		SetType(value, MULTIFIELD);
+		SetValue(value, mf);
+		SetDOBegin(value, 1);
+		SetDOEnd(value, values.size());
+	} else if (!values.empty()) {
+		void *atom = clips_atom(env, values[0], type);
+		SetType(value, type);
+		SetValue(value, atom);
+	} else {
+		return false;
+	}
+	return EnvPutFactSlot(env, fact, slot.c_str(), &value);
+}
+/// @endcond
+
+/** @class GameSnapshotWriter "game_snapshot.h"
+ * Periodic snapshots of the game state for a fast restart.
+ * The writer keeps a copy of the facts of the configured templates, e.g.,
+ * the game state, machines, orders, and points, from the changes
+ * published by the CLIPS environment. At most once per interval, and only
+ * if the facts have changed, it encodes them and writes them to a
+ * SnapshotFile. Copying and writing happen in the thread of the
+ * subscriber, the environment is never locked for a snapshot.
+ *
+ * A snapshot is written when a batch of changes arrives after the
+ * interval has passed. Changes within the interval are written when it
+ * has passed, even if no further changes arrive, e.g., before a game
+ * starts or while it is paused. Pending changes are written when the
+ * writer is destroyed.
+ */
+
+/** Constructor.
+ * @param publisher publisher of the fact changes of the environment
+ * @param path path of the snapshot file, created if it does not exist
+ * @param templates names of the templates whose facts are stored
+ * @param interval_ms minimum time between two snapshots in milliseconds
+ * @param logger logger for write errors
+ * @exception Exception thrown if the snapshot file cannot be opened
+ */
+GameSnapshotWriter::GameSnapshotWriter(clips_replica::FactChangePublisher *publisher,
+                                       const std::string &                 path,
+                                       const std::vector<std::string> &    templates,
+                                       unsigned int                        interval_ms,
+                                       Logger *                            logger)
+: clips_replica::FactEventSubscriber(publisher),
+  logger_(logger),
+  file_(path, true),
+  interval_(interval_ms),
+  dirty_(false)
+{
+	for (const std::string &t : templates) {
+		add_template(t);
+	}
+	start();
+}
+
+/** Destructor. */
+GameSnapshotWriter::~GameSnapshotWriter()
+{
+	stop();
+	if (dirty_) {
+		write();
+	}
+}
+
+void
+GameSnapshotWriter::fact_events(const std::vector<clips_replica::FactEvent> &events)
+{
+	for (const clips_replica::FactEvent &e : events) {
+		switch (e.kind) {
+		case clips_replica::FactEvent::CLEAR: facts_.clear(); break;
+		case clips_replica::FactEvent::RETRACT: facts_.erase(e.fact->index()); break;
+		case clips_replica::FactEvent::MODIFY:
+			facts_.erase(e.old_fact->index());
+			facts_[e.fact->index()] = e.fact;
+			break;
+		case clips_replica::FactEvent::ASSERT: facts_[e.fact->index()] = e.fact; break;
+		}
+	}
+	dirty_ = true;
+	if (std::chrono::steady_clock::now() - last_write_ >= interval_) {
+		write();
+	}
+}
+
+long int
+GameSnapshotWriter::timeout_ms()
+{
+	if (!dirty_) {
+		return -1;
+	}
+	auto remaining = interval_ - (std::chrono::steady_clock::now() - last_write_);
+	return std::max<long int>(
+	  0, std::chrono::duration_cast<std::chrono::milliseconds>(remaining).count());
+}
+
+void
+GameSnapshotWriter::timeout()
+{
+	if (dirty_) {
+		write();
+	}
+}
+
+void
+GameSnapshotWriter::write()
+{
+	// ordered by fact index, they are restored in the order of assertion
+	std::vector<std::shared_ptr<const clips_replica::FactSnapshot>> facts;
+	facts.reserve(facts_.size());
+	for (const auto &f : facts_) {
+		facts.push_back(f.second);
+	}
+	clips_replica::encode_facts(facts, data_);
+	try {
+		file_.write(data_);
+	} catch (fawkes::Exception &e) {
+		logger_->log_error("RefBox", "Failed to write game snapshot: %s", e.what_no_backtrace());
+	}
+	dirty_      = false;
+	last_write_ = std::chrono::steady_clock::now();
+}
+
+/** Restore the game state from a snapshot.
+ * Retracts all facts of the given templates and of the templates stored
+ * in the snapshot, and asserts the facts of the latest intact snapshot in
+ * their original order. Slots which no longer exist in a template are
+ * skipped, new slots get their default values. Rules are not run, which
+ * is up to the caller, who must hold the lock of the environment.
+ * @param env CLIPS environment to restore the facts to
+ * @param path path of the snapshot file
+ * @param templates names of the templates whose facts are replaced
+ * @param logger logger to report the restored snapshot to
+ * @return number of restored facts
+ * @exception Exception thrown if the file holds no intact snapshot or a
+ * template of the snapshot is unknown, the environment is not modified
+ */
+size_t
+restore_game_snapshot(CLIPS::Environment *            env,
+                      const std::string &             path,
+                      const std::vector<std::string> &templates,
+                      Logger *                        logger)
+{
+	clips_replica::SnapshotFile file(path, false);
+	std::string                 data;
+	uint64_t                    seq;
+	int64_t                     stamp_usec;
+	if (!file.read(data, &seq, &stamp_usec)) {
+		throw fawkes::Exception("Snapshot file %s holds no intact snapshot", path.c_str());
+	}
+	std::vector<std::shared_ptr<const clips_replica::FactSnapshot>> facts;
+	clips_replica::decode_facts(data, facts);
+
+	void *                        cenv = env->cobj();
+	std::map<std::string, void *> deftemplates;
+	std::set<std::string>         names(templates.begin(), templates.end());
+	for (const auto &f : facts) {
+		names.insert(f->template_name());
+	}
+	for (const std::string &name : names) {
+		void *tmpl = EnvFindDeftemplate(cenv, name.c_str());
+		if (!tmpl) {
+			throw fawkes::Exception("Cannot restore facts of unknown template %s", name.c_str());
+		}
+		deftemplates[name] = tmpl;
+	}
+
+	for (const auto &t : deftemplates) {
+		std::vector<void *> initial;
+		void *              f = NULL;
+		while ((f = EnvGetNextFactInTemplate(cenv, t.second, f))) {
+			initial.push_back(f);
+		}
+		for (void *i : initial) {
+			EnvRetract(cenv, i);
+		}
+	}
+
+	for (const auto &f : facts) {
+		void *                          tmpl  = deftemplates[f->template_name()];
+		void *                          fact  = EnvCreateFact(cenv, tmpl);
+		const std::vector<std::string> &slots = f->slot_names();
+		for (size_t i = 0; i < slots.size(); ++i) {
+			if (EnvDeftemplateSlotExistP(cenv, tmpl, slots[i].c_str())) {
+				put_slot(cenv, tmpl, fact, slots[i], f->values()[i]);
+			}
+		}
+		EnvAssignFactSlotDefaults(cenv, fact);
+		EnvAssert(cenv, fact);
+	}
+
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	int64_t age_usec = (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000 - stamp_usec;
+	logger->log_info("RefBox",
+	                 "Restored %zu facts from snapshot %lu of %s, written %.1f s ago",
+	                 facts.size(),
+	                 (unsigned long)seq,
+	                 path.c_str(),
+	                 age_usec / 1e6);
+	return facts.size();
+}
+
+} // end of namespace llsfrb
@@ -0,0 +1,90 @@
+/***************************************************************************
+ *  game_snapshot.h - periodic snapshots of the game state
+ *
+ *  Created: Thu Oct 22 13:27:45 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LLSF_REFBOX_GAME_SNAPSHOT_H_
+#define __LLSF_REFBOX_GAME_SNAPSHOT_H_
+
+#include <clips_replica/events.h>
+#include <clips_replica/snapshot_file.h>
+#include <logging/logger.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CLIPS {
+class Environment;
+}
+
+namespace llsfrb {
+
+class GameSnapshotWriter : public clips_replica::FactEventSubscriber
+{
+public:
+	GameSnapshotWriter(clips_replica::FactChangePublisher *publisher,
+	                   const std::string &                 path,
+	                   const std::vector<std::string> &    templates,
+	                   unsigned int                        interval_ms,
+	                   Logger *                            logger);
+	virtual ~GameSnapshotWriter();
+
+protected:
+	virtual void fact_events(const std::vector<clips_replica::FactEvent> &events);
+	virtual long int timeout_ms();
+	virtual void     timeout();
+
+private:
+	void write();
+
+	Logger *                              logger_;
+	clips_replica::SnapshotFile           file_;
+	std::chrono::milliseconds             interval_;
+	std::chrono::steady_clock::time_point last_write_;
+	bool                                  dirty_;
+	std::string                           data_;
+
+	std::map<long int, std::shared_ptr<const clips_replica::FactSnapshot>> facts_;
+};
+
+size_t restore_game_snapshot(CLIPS::Environment *            env,
+                             const std::string &             path,
+                             const std::vector<std::string> &templates,
+                             Logger *                        logger);
+
+} // end of namespace llsfrb
+
+#endif
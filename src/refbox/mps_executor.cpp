@@ -0,0 +1,250 @@
+/***************************************************************************
+ *  mps_executor.cpp - ordered per-station execution of MPS commands
+ *
+ *  Created: Mon Oct 19 15:21:08 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mps_executor.h"
+
+#include <exception>
+
+namespace llsfrb {
+
+/** @class MpsExecutor "mps_executor.h"
+ * Execute commands for MPS stations in order on a small thread pool.
+ * Each station has a strand, a bounded queue of commands which are
+ * executed one after another in submission order. Different stations are
+ * processed concurrently by a fixed number of worker threads, so sending a
+ * command does neither spawn a thread nor block the caller. If the queue of
+ * a station is full, the command is rejected and counted.
+ *
+ * The completion callback is called on the worker thread. It must not lock
+ * the CLIPS environment but should hand results to the CLIPS thread.
+ */
+
+/** Constructor.
+ * @param num_threads number of worker threads
+ * @param queue_capacity maximum number of pending commands per station
+ */
+MpsExecutor::MpsExecutor(unsigned int num_threads, size_t queue_capacity)
+: queue_capacity_(queue_capacity > 0 ? queue_capacity : 1), num_scheduled_(0), shutdown_(false)
+{
+	if (num_threads == 0) {
+		num_threads = 1;
+	}
+	for (unsigned int i = 0; i < num_threads; ++i) {
+		threads_.emplace_back(&MpsExecutor::worker, this);
+	}
+}
+
+/** Destructor.
+ * Executes pending commands and stops the worker threads.
+ */
+MpsExecutor::~MpsExecutor()
+{
+	shutdown();
+}
+
+/** Stop the executor.
+ * Commands which have already been submitted are still executed, new
+ * commands are rejected. Returns after all worker threads have finished.
+ */
+void
+MpsExecutor::shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		shutdown_ = true;
+	}
+	cond_.notify_all();
+	for (auto &t : threads_) {
+		if (t.joinable()) {
+			t.join();
+		}
+	}
+	threads_.clear();
+}
+
+/** Wait until all submitted commands have been executed.
+ * Used to run the stations in lock-step with the caller, e.g., when the
+ * refbox runs on a virtual clock. Commands submitted concurrently while
+ * waiting are waited for as well.
+ */
+void
+MpsExecutor::wait_idle()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	idle_cond_.wait(lock, [this] { return num_scheduled_ == 0; });
+}
+
+/** Submit a command for a station.
+ * @param station name of the station, commands for the same station are
+ * executed in submission order
+ * @param name name of the command, used for error messages
+ * @param command command to execute
+ * @param completion optional callback after the command has been executed
+ * @return true if the command has been queued, false if the queue of the
+ * station is full or the executor has been shut down
+ */
+bool
+MpsExecutor::submit(const std::string &station,
+                    const std::string &name,
+                    Command            command,
+                    Completion         completion)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	if (shutdown_) {
+		return false;
+	}
+
+	std::unique_ptr<Strand> &s = strands_[station];
+	if (!s) {
+		s.reset(new Strand());
+		s->station          = station;
+		s->scheduled        = false;
+		s->metrics          = Metrics();
+		s->total_latency_ms = 0.;
+	}
+
+	if (s->queue.size() >= queue_capacity_) {
+		s->metrics.rejected += 1;
+		return false;
+	}
+
+	s->queue.push_back(Task{name, std::move(command), std::move(completion), Clock::now()});
+	s->metrics.queue_depth = s->queue.size();
+	if (s->metrics.queue_depth > s->metrics.max_queue_depth) {
+		s->metrics.max_queue_depth = s->metrics.queue_depth;
+	}
+	if (!s->scheduled) {
+		s->scheduled = true;
+		num_scheduled_ += 1;
+		ready_.push_back(s.get());
+		lock.unlock();
+		cond_.notify_one();
+	}
+	return true;
+}
+
+/** Get metrics of a station.
+ * @param station name of the station
+ * @return metrics, all zero if no command has been submitted for the station
+ */
+MpsExecutor::Metrics
+MpsExecutor::metrics(const std::string &station) const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto                        s = strands_.find(station);
+	if (s == strands_.end()) {
+		return Metrics();
+	}
+	return s->second->metrics;
+}
+
+/** Get metrics of all stations.
+ * @return map from station name to metrics
+ */
+std::map<std::string, MpsExecutor::Metrics>
+MpsExecutor::metrics() const
+{
+	std::lock_guard<std::mutex>    lock(mutex_);
+	std::map<std::string, Metrics> rv;
+	for (const auto &s : strands_) {
+		rv[s.first] = s.second->metrics;
+	}
+	return rv;
+}
+
+void
+MpsExecutor::worker()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	for (;;) {
+		cond_.wait(lock, [this] { return shutdown_ || !ready_.empty(); });
+		if (ready_.empty()) {
+			// shut down and all pending commands executed
+			break;
+		}
+
+		// the strand stays scheduled while its command runs so that no other
+		// worker picks up the next command of the same station
+		Strand *s = ready_.front();
+		ready_.pop_front();
+		Task task = std::move(s->queue.front());
+		s->queue.pop_front();
+		s->metrics.queue_depth = s->queue.size();
+		lock.unlock();
+
+		bool        success = true;
+		std::string error;
+		try {
+			task.command();
+		} catch (std::exception &e) {
+			success = false;
+			error   = task.name + ": " + e.what();
+		} catch (...) {
+			success = false;
+			error   = task.name + ": unknown error";
+		}
+		if (task.completion) {
+			try {
+				task.completion(success, error);
+			} catch (...) {
+			}
+		}
+		double latency_ms =
+		  std::chrono::duration<double, std::milli>(Clock::now() - task.submitted).count();
+
+		lock.lock();
+		s->metrics.executed += 1;
+		if (!success) {
+			s->metrics.failed += 1;
+		}
+		s->total_latency_ms += latency_ms;
+		s->metrics.avg_latency_ms = s->total_latency_ms / s->metrics.executed;
+		if (latency_ms > s->metrics.max_latency_ms) {
+			s->metrics.max_latency_ms = latency_ms;
+		}
+		if (s->queue.empty()) {
+			s->scheduled = false;
+			if (--num_scheduled_ == 0) {
+				idle_cond_.notify_all();
+			}
+		} else {
+			ready_.push_back(s);
+			cond_.notify_one();
+		}
+	}
+}
+
+} // end of namespace llsfrb
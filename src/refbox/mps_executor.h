@@ -0,0 +1,126 @@
+/***************************************************************************
+ *  mps_executor.h - ordered per-station execution of MPS commands
+ *
+ *  Created: Mon Oct 19 15:21:08 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LLSF_REFBOX_MPS_EXECUTOR_H_
+#define __LLSF_REFBOX_MPS_EXECUTOR_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace llsfrb {
+
+class MpsExecutor
+{
+public:
+	/** A command executed on a station. Failures are reported by throwing. */
+	typedef std::function<void()> Command;
+	/** Called after a command has been executed.
+	 * The first argument is true on success, the second is the error message otherwise.
+	 */
+	typedef std::function<void(bool, const std::string &)> Completion;
+
+	/** Statistics of the commands for one station. */
+	struct Metrics
+	{
+		size_t   queue_depth;     /**< number of currently pending commands */
+		size_t   max_queue_depth; /**< maximum number of pending commands */
+		uint64_t executed;        /**< number of executed commands */
+		uint64_t failed;          /**< number of commands which threw an exception */
+		uint64_t rejected;        /**< number of commands rejected because the queue was full */
+		double   avg_latency_ms;  /**< average time from submission to completion */
+		double   max_latency_ms;  /**< maximum time from submission to completion */
+	};
+
+	MpsExecutor(unsigned int num_threads = 2, size_t queue_capacity = 32);
+	~MpsExecutor();
+
+	bool submit(const std::string &station,
+	            const std::string &name,
+	            Command            command,
+	            Completion         completion = Completion());
+	void shutdown();
+	void wait_idle();
+
+	Metrics                        metrics(const std::string &station) const;
+	std::map<std::string, Metrics> metrics() const;
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	struct Task
+	{
+		std::string       name;
+		Command           command;
+		Completion        completion;
+		Clock::time_point submitted;
+	};
+
+	struct Strand
+	{
+		std::string      station;
+		std::deque<Task> queue;
+		bool             scheduled;
+		Metrics          metrics;
+		double           total_latency_ms;
+	};
+
+	void worker();
+
+private:
+	const size_t queue_capacity_;
+
+	mutable std::mutex                             mutex_;
+	std::condition_variable                        cond_;
+	std::condition_variable                        idle_cond_;
+	size_t                                         num_scheduled_;
+	std::deque<Strand *>                           ready_;
+	std::map<std::string, std::unique_ptr<Strand>> strands_;
+	std::vector<std::thread>                       threads_;
+	bool                                           shutdown_;
+};
+
+} // end of namespace llsfrb
+
+#endif
@@ -0,0 +1,196 @@
+/***************************************************************************
+ *  mps_state.cpp - lock-free cache of the reported MPS states
+ *
+ *  Created: Mon Oct 19 19:02:37 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mps_state.h"
+
+namespace llsfrb {
+
+/** @class MpsStateCache "mps_state.h"
+ * Latest state reported by each MPS.
+ * The station callbacks are called from the OPC UA subscription threads.
+ * They only store the new value and mark it as changed, without taking a
+ * lock. The CLIPS thread collects the changes once per cycle with
+ * process_changes(). Multiple changes of a signal in between are collapsed
+ * into one, reporting the latest value.
+ *
+ * Stations must be added before any updates arrive, the set of stations is
+ * fixed afterwards.
+ */
+
+/** @class MpsStateCache::Station "mps_state.h"
+ * Cached state of one station.
+ * The values are updated lock-free and may be read from any thread.
+ */
+
+/** Constructor.
+ * @param name name of the station
+ * @param cache_changed flag of the cache which is set on updates
+ */
+MpsStateCache::Station::Station(const std::string &name, std::atomic<bool> &cache_changed)
+: name_(name), cache_changed_(cache_changed), reported_(0), changed_(0)
+{
+	for (std::atomic<uint64_t> &v : values_) {
+		v.store(0, std::memory_order_relaxed);
+	}
+}
+
+/** Get name of station.
+ * @return name of the station
+ */
+const std::string &
+MpsStateCache::Station::name() const
+{
+	return name_;
+}
+
+/** Store a value reported by the station.
+ * Boolean signals are stored as 0 or 1.
+ * @param signal the reported signal
+ * @param value new value of the signal
+ */
+void
+MpsStateCache::Station::update(Signal signal, uint64_t value)
+{
+	const uint32_t bit = 1u << signal;
+	values_[signal].store(value, std::memory_order_relaxed);
+	reported_.fetch_or(bit, std::memory_order_relaxed);
+	// release: the value is visible to whoever consumes the changed bit
+	changed_.fetch_or(bit, std::memory_order_release);
+	cache_changed_.store(true, std::memory_order_release);
+}
+
+/** Get the latest value of a signal.
+ * @param signal signal to get
+ * @param value upon return the latest value, if any
+ * @return true if the station has reported the signal, false otherwise
+ */
+bool
+MpsStateCache::Station::value(Signal signal, uint64_t &value) const
+{
+	if (!(reported_.load(std::memory_order_acquire) & (1u << signal))) {
+		return false;
+	}
+	value = values_[signal].load(std::memory_order_relaxed);
+	return true;
+}
+
+/** Constructor. */
+MpsStateCache::MpsStateCache() : changed_(false)
+{
+}
+
+/** Add a station.
+ * Must not be called while updates arrive.
+ * @param name name of the station
+ * @return station to pass updates to, valid for the lifetime of the cache
+ */
+MpsStateCache::Station *
+MpsStateCache::add_station(const std::string &name)
+{
+	std::unique_ptr<Station> &s = stations_[name];
+	if (!s) {
+		s = std::make_unique<Station>(name, changed_);
+	}
+	return s.get();
+}
+
+/** Get a station.
+ * @param name name of the station
+ * @return station or nullptr if there is no station of that name
+ */
+MpsStateCache::Station *
+MpsStateCache::station(const std::string &name) const
+{
+	auto s = stations_.find(name);
+	return s != stations_.end() ? s->second.get() : nullptr;
+}
+
+/** Process all changes since the last call.
+ * The handler is called once for each changed signal of each station with
+ * the latest value. Must be called from a single thread only.
+ * @param handler handler to call for each change
+ * @return number of changes passed to the handler
+ */
+size_t
+MpsStateCache::process_changes(const ChangeHandler &handler)
+{
+	// common case: nothing happened since the last cycle
+	if (!changed_.exchange(false, std::memory_order_acquire)) {
+		return 0;
+	}
+	size_t num_changes = 0;
+	for (const auto &s : stations_) {
+		uint32_t changed = s.second->changed_.exchange(0, std::memory_order_acquire);
+		for (unsigned int i = 0; changed != 0; ++i, changed >>= 1) {
+			if (changed & 1) {
+				handler(s.first,
+				        static_cast<Signal>(i),
+				        s.second->values_[i].load(std::memory_order_relaxed));
+				++num_changes;
+			}
+		}
+	}
+	return num_changes;
+}
+
+/** Get name of a signal as used in CLIPS.
+ * @param signal signal to get the name of
+ * @return name of the signal
+ */
+const char *
+MpsStateCache::signal_name(Signal signal)
+{
+	switch (signal) {
+	case READY: return "READY";
+	case BUSY: return "BUSY";
+	case BARCODE: return "BARCODE";
+	case SLIDE_COUNTER: return "SLIDE-COUNTER";
+	case CONNECTED: return "CONNECTED";
+	default: return "UNKNOWN";
+	}
+}
+
+/** Check if a signal is a boolean flag.
+ * @param signal signal to check
+ * @return true if the signal is either on or off, false if it is a number
+ */
+bool
+MpsStateCache::is_boolean(Signal signal)
+{
+	return signal == READY || signal == BUSY || signal == CONNECTED;
+}
+
+} // end of namespace llsfrb
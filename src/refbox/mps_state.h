@@ -0,0 +1,103 @@
+/***************************************************************************
+ *  mps_state.h - lock-free cache of the reported MPS states
+ *
+ *  Created: Mon Oct 19 19:02:37 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LLSF_REFBOX_MPS_STATE_H_
+#define __LLSF_REFBOX_MPS_STATE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace llsfrb {
+
+class MpsStateCache
+{
+public:
+	/** Signals reported by a station. */
+	typedef enum {
+		READY,         /**< workpiece ready at the output */
+		BUSY,          /**< station is executing an instruction */
+		BARCODE,       /**< barcode of the last workpiece read at the input */
+		SLIDE_COUNTER, /**< number of bases fed into the slide of a ring station */
+		CONNECTED,     /**< connection state to the PLC */
+		NUM_SIGNALS    /**< number of signals, not a signal itself */
+	} Signal;
+
+	/** Cached state of one station. */
+	class Station
+	{
+	public:
+		Station(const std::string &name, std::atomic<bool> &cache_changed);
+
+		const std::string &name() const;
+
+		void update(Signal signal, uint64_t value);
+		bool value(Signal signal, uint64_t &value) const;
+
+	private:
+		friend class MpsStateCache;
+
+		const std::string     name_;
+		std::atomic<bool> &   cache_changed_;
+		std::atomic<uint64_t> values_[NUM_SIGNALS];
+		std::atomic<uint32_t> reported_;
+		std::atomic<uint32_t> changed_;
+	};
+
+	/** Called for each changed signal with the station name and the latest value. */
+	typedef std::function<void(const std::string &, Signal, uint64_t)> ChangeHandler;
+
+	MpsStateCache();
+
+	Station *add_station(const std::string &name);
+	Station *station(const std::string &name) const;
+
+	size_t process_changes(const ChangeHandler &handler);
+
+	static const char *signal_name(Signal signal);
+	static bool        is_boolean(Signal signal);
+
+private:
+	std::map<std::string, std::unique_ptr<Station>> stations_;
+	std::atomic<bool>                               changed_;
+};
+
+} // end of namespace llsfrb
+
+#endif
@@ -0,0 +1,124 @@
+/***************************************************************************
+ *  points_registry.cpp - per-team and per-phase point sums
+ *
+ *  Created: Mon Oct 19 21:14:52 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "points_registry.h"
+
+#include <algorithm>
+
+namespace llsfrb {
+
+/** @class PointsRegistry "points_registry.h"
+ * Point sums of each team, per phase and in total.
+ * The sums are updated by CLIPS rules when a points fact is asserted or
+ * retracted, so that reading the score does not need to visit all points
+ * facts. As in the rules, the total of a team is the sum of its phase
+ * points, where each phase counts with at least zero points.
+ *
+ * The registry is only accessed from the CLIPS thread.
+ */
+
+/** Constructor. */
+PointsRegistry::PointsRegistry()
+{
+}
+
+/** Account for an asserted points fact.
+ * @param team team the points are awarded to
+ * @param phase game phase in which the points were awarded
+ * @param points number of points, may be negative
+ */
+void
+PointsRegistry::add(const std::string &team, const std::string &phase, long long points)
+{
+	update(team, phase, points);
+}
+
+/** Account for a retracted points fact.
+ * @param team team the points were awarded to
+ * @param phase game phase in which the points were awarded
+ * @param points number of points of the retracted fact
+ */
+void
+PointsRegistry::remove(const std::string &team, const std::string &phase, long long points)
+{
+	update(team, phase, -points);
+}
+
+/** Remove all points, e.g., when the CLIPS environment is reset. */
+void
+PointsRegistry::reset()
+{
+	teams_.clear();
+}
+
+/** Get points of a team in a phase.
+ * @param team team to get the points for
+ * @param phase phase to get the points for
+ * @return sum of the points awarded to the team in the phase, may be negative
+ */
+long long
+PointsRegistry::phase_points(const std::string &team, const std::string &phase) const
+{
+	auto t = teams_.find(team);
+	if (t == teams_.end()) {
+		return 0;
+	}
+	auto p = t->second.phases.find(phase);
+	return (p != t->second.phases.end()) ? p->second : 0;
+}
+
+/** Get total points of a team.
+ * @param team team to get the points for
+ * @return sum over all phases of the phase points, each at least zero
+ */
+long long
+PointsRegistry::total(const std::string &team) const
+{
+	auto t = teams_.find(team);
+	return (t != teams_.end()) ? t->second.total : 0;
+}
+
+void
+PointsRegistry::update(const std::string &team, const std::string &phase, long long delta)
+{
+	Team &     t    = teams_[team];
+	long long &sum  = t.phases[phase];
+	long long  prev = std::max(sum, 0LL);
+	sum += delta;
+	t.total += std::max(sum, 0LL) - prev;
+}
+
+} // end of namespace llsfrb
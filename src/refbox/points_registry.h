@@ -0,0 +1,71 @@
+/***************************************************************************
+ *  points_registry.h - per-team and per-phase point sums
+ *
+ *  Created: Mon Oct 19 21:14:52 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LLSF_REFBOX_POINTS_REGISTRY_H_
+#define __LLSF_REFBOX_POINTS_REGISTRY_H_
+
+#include <map>
+#include <string>
+
+namespace llsfrb {
+
+class PointsRegistry
+{
+public:
+	PointsRegistry();
+
+	void add(const std::string &team, const std::string &phase, long long points);
+	void remove(const std::string &team, const std::string &phase, long long points);
+	void reset();
+
+	long long phase_points(const std::string &team, const std::string &phase) const;
+	long long total(const std::string &team) const;
+
+private:
+	struct Team
+	{
+		std::map<std::string, long long> phases;
+		long long                        total = 0;
+	};
+
+	void update(const std::string &team, const std::string &phase, long long delta);
+
+	std::map<std::string, Team> teams_;
+};
+
+} // end of namespace llsfrb
+
+#endif
@@ -0,0 +1,241 @@
+/***************************************************************************
+ *  qa_clips_tick.cpp - cost of a CLIPS cycle of the refbox rules
+ *
+ *  Created: Tue Oct 20 10:41:07 2026
+ *  Copyright  2026  agent <agent@local>
+ *
+ ****************************************************************************/
+
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Measure the cost of a refbox cycle with the rules of the RCLL game. A
+// headless refbox runs a game on a virtual clock, robots of both teams send
+// beacons, the first robot of each team pauses for a while to be lost. The
+// periodic rules are driven by deadlines, most cycles should not fire any
+// rule. Cycles which fire rules and idle cycles are reported separately.
+// Options after -- are passed to the refbox.
+
+#include "../refbox.h"
+
+#include <msgs/BeaconSignal.pb.h>
+#include <msgs/GameInfo.pb.h>
+#include <msgs/GameState.pb.h>
+#include <unistd.h>
+#include <utils/system/argparser.h>
+
+#include <algorithm>
+#include <chrono>
+#include <clipsmm.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace llsfrb;
+using namespace llsf_msgs;
+
+/// @cond QA
+
+typedef std::chrono::steady_clock WallClock;
+
+static const char *TEAMS[] = {"Cyan", "Magenta"};
+
+static std::string
+eval_symbol(LLSFRefBox &refbox, const std::string &expression)
+{
+	CLIPS::Values rv = refbox.evaluate(expression);
+	if (rv.empty() || rv[0].type() != CLIPS::TYPE_SYMBOL) {
+		return "";
+	}
+	return rv[0].as_string();
+}
+
+static long long
+eval_integer(LLSFRefBox &refbox, const std::string &expression)
+{
+	CLIPS::Values rv = refbox.evaluate(expression);
+	if (rv.empty() || rv[0].type() != CLIPS::TYPE_INTEGER) {
+		return -1;
+	}
+	return rv[0].as_integer();
+}
+
+static void
+print_stats(const char *what, std::vector<double> &times, long long rules)
+{
+	if (times.empty()) {
+		printf("%-7s %7d cycles\n", what, 0);
+		return;
+	}
+	std::sort(times.begin(), times.end());
+	double sum = 0;
+	for (double d : times) {
+		sum += d;
+	}
+	auto pct = [&times](double p) {
+		return times[std::min(times.size() - 1, (size_t)(p * times.size()))];
+	};
+	printf("%-7s %7zu cycles  avg %.1f  p50 %.1f  p90 %.1f  p99 %.1f  max %.1f us"
+	       "  %.2f rules/cycle\n",
+	       what,
+	       times.size(),
+	       sum / times.size(),
+	       pct(0.5),
+	       pct(0.9),
+	       pct(0.99),
+	       times.back(),
+	       (double)rules / times.size());
+}
+
+static void
+usage(const char *progname)
+{
+	printf("Usage: %s [-s SEC] [-r N] [-b HZ] [-- REFBOX-OPTIONS]\n"
+	       " -s SEC   game time to run, default 600\n"
+	       " -r N     number of robots per team, default 3\n"
+	       " -b HZ    beacons per robot and second, default 1\n",
+	       progname);
+}
+
+int
+main(int argc, char **argv)
+{
+	int qa_argc = argc;
+	for (int i = 1; i < argc; ++i) {
+		if (std::string(argv[i]) == "--") {
+			qa_argc = i;
+			break;
+		}
+	}
+	std::vector<char *> refbox_argv = {argv[0]};
+	for (int i = qa_argc + 1; i < argc; ++i) {
+		refbox_argv.push_back(argv[i]);
+	}
+	refbox_argv.push_back(nullptr);
+
+	fawkes::ArgumentParser argp(qa_argc, argv, "hs:r:b:");
+	if (argp.has_arg("h")) {
+		usage(argv[0]);
+		exit(0);
+	}
+	double       seconds = argp.has_arg("s") ? argp.parse_float("s") : 600.;
+	unsigned int robots  = argp.has_arg("r") ? argp.parse_int("r") : 3;
+	double       rate    = argp.has_arg("b") ? argp.parse_float("b") : 1.;
+	if (robots == 0 || rate <= 0.) {
+		usage(argv[0]);
+		exit(1);
+	}
+
+	// the refbox parses its own options
+	optind = 0;
+
+	CLIPS::init();
+	LLSFRefBox refbox(refbox_argv.size() - 1, refbox_argv.data(), true);
+
+	for (int t = 0; t < 2; ++t) {
+		auto msg = std::make_shared<SetTeamName>();
+		msg->set_team_name(TEAMS[t]);
+		msg->set_team_color(t == 0 ? CYAN : MAGENTA);
+		refbox.inject_message(0, "127.0.0.1", 4444, msg);
+	}
+	auto state = std::make_shared<SetGameState>();
+	state->set_state(GameState::RUNNING);
+	refbox.inject_message(0, "127.0.0.1", 4444, state);
+	auto phase = std::make_shared<SetGamePhase>();
+	phase->set_phase(GameState::PRODUCTION);
+	refbox.inject_message(0, "127.0.0.1", 4444, phase);
+	refbox.tick();
+
+	long long peers[2];
+	for (int t = 0; t < 2; ++t) {
+		peers[t] = eval_integer(refbox,
+		                        std::string("(fact-slot-value (nth$ 1 (find-fact ((?p network-peer))"
+		                                    " (eq ?p:group ")
+		                          + (t == 0 ? "CYAN" : "MAGENTA") + "))) id)");
+	}
+	if (peers[0] <= 0 || peers[1] <= 0) {
+		printf("No private team peers, check the refbox configuration\n");
+		return 1;
+	}
+
+	printf("%u robots per team, %.1f beacons/s, %.0f s game time\n", robots, rate, seconds);
+
+	fawkes::Time        start(refbox.virtual_time());
+	std::vector<double> next_beacon;
+	for (unsigned int i = 0; i < 2 * robots; ++i) {
+		// spread the beacons of all robots over the period
+		next_beacon.push_back(i / rate / (2 * robots));
+	}
+	std::vector<double> idle_us, active_us;
+	long long           rules    = 0;
+	unsigned long       seq      = 0;
+	unsigned long       messages = refbox.messages_sent();
+
+	for (double elapsed = 0.; elapsed < seconds; elapsed = refbox.virtual_time() - &start) {
+		const fawkes::Time &now = refbox.virtual_time();
+		for (unsigned int i = 0; i < next_beacon.size(); ++i) {
+			if (elapsed < next_beacon[i]) {
+				continue;
+			}
+			next_beacon[i] += 1. / rate;
+			// the first robot of each team pauses long enough to be lost
+			long int game_sec = (long int)elapsed;
+			if (i % robots == 0 && game_sec % 300 >= 100 && game_sec % 300 < 120) {
+				continue;
+			}
+			int  team = i / robots;
+			auto msg  = std::make_shared<BeaconSignal>();
+			msg->mutable_time()->set_sec(now.get_sec());
+			msg->mutable_time()->set_nsec(now.get_nsec());
+			msg->set_seq(++seq);
+			msg->set_number(i % robots + 1);
+			msg->set_team_name(TEAMS[team]);
+			msg->set_peer_name("R-" + std::to_string(i % robots + 1));
+			msg->set_team_color(team == 0 ? CYAN : MAGENTA);
+			refbox.inject_message(peers[team], "127.0.0.1", 4500 + i, msg);
+		}
+
+		WallClock::time_point t0    = WallClock::now();
+		long int              fired = refbox.tick();
+		double us = std::chrono::duration<double, std::micro>(WallClock::now() - t0).count();
+		(fired > 0 ? active_us : idle_us).push_back(us);
+		rules += fired;
+	}
+
+	printf("game phase %s, %lu messages sent\n",
+	       eval_symbol(refbox, "(fact-slot-value (nth$ 1 (find-fact ((?g gamestate)) TRUE)) phase)")
+	         .c_str(),
+	       refbox.messages_sent() - messages);
+	print_stats("idle", idle_us, 0);
+	print_stats("active", active_us, rules);
+	return 0;
+}
+
+/// @endcond
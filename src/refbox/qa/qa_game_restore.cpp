@@ -0,0 +1,205 @@
+/***************************************************************************
+ *  qa_game_restore.cpp - restore a game from a snapshot
+ *
+ *  Created: Tue Oct 20 13:47:20 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Write a snapshot of a running game, start a headless refbox with
+// --restore and check that the game continues where it left off.
+
+#include "../refbox.h"
+
+#include <clips_replica/fact_archive.h>
+#include <clips_replica/snapshot_file.h>
+#include <unistd.h>
+
+#include <clipsmm.h>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace llsfrb;
+using namespace clips_replica;
+
+/// @cond QA
+
+static const long long RESTORED_ID = 41;
+
+class SnapshotBuilder
+{
+public:
+	void
+	add(const std::string &                                    tmpl,
+	    const std::vector<std::pair<std::string, CLIPS::Values>> &slots)
+	{
+		auto t  = std::make_shared<FactTemplate>();
+		t->name = tmpl;
+		std::vector<CLIPS::Values> values;
+		for (const auto &s : slots) {
+			t->slot_names.push_back(s.first);
+			t->multifield.push_back(s.second.size() != 1);
+			values.push_back(s.second);
+		}
+		facts_.push_back(std::make_shared<FactSnapshot>(facts_.size() + 1, t, std::move(values)));
+	}
+
+	void
+	write(const std::string &path)
+	{
+		std::string data;
+		encode_facts(facts_, data);
+		SnapshotFile(path, true).write(data);
+	}
+
+private:
+	std::vector<std::shared_ptr<const FactSnapshot>> facts_;
+};
+
+static CLIPS::Values
+values(std::initializer_list<CLIPS::Value> v)
+{
+	return CLIPS::Values(v);
+}
+
+static CLIPS::Value
+sym(const char *s)
+{
+	return CLIPS::Value(s, CLIPS::TYPE_SYMBOL);
+}
+
+static long long
+eval_integer(LLSFRefBox &refbox, const std::string &expression)
+{
+	CLIPS::Values rv = refbox.evaluate(expression);
+	if (rv.empty() || rv[0].type() != CLIPS::TYPE_INTEGER) {
+		return -1;
+	}
+	return rv[0].as_integer();
+}
+
+static std::string
+eval_string(LLSFRefBox &refbox, const std::string &expression)
+{
+	CLIPS::Values rv = refbox.evaluate(expression);
+	if (rv.empty() || (rv[0].type() != CLIPS::TYPE_SYMBOL && rv[0].type() != CLIPS::TYPE_STRING)) {
+		return "";
+	}
+	return rv[0].as_string();
+}
+
+static unsigned int failures = 0;
+
+static void
+check(bool ok, const char *what)
+{
+	printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+	if (!ok) {
+		++failures;
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	std::string snapshot = "/tmp/qa_game_restore_" + std::to_string(getpid()) + ".bin";
+	std::string cfg      = "/tmp/qa_game_restore_" + std::to_string(getpid()) + ".yaml";
+
+	SnapshotBuilder b;
+	b.add("gamestate",
+	      {{"state", values({sym("RUNNING")})},
+	       {"phase", values({sym("PRODUCTION")})},
+	       {"teams", values({CLIPS::Value("Cyan"), CLIPS::Value("Magenta")})}});
+	b.add("product-processed",
+	      {{"id", values({CLIPS::Value(RESTORED_ID)})},
+	       {"team", values({sym("CYAN")})},
+	       {"mtype", values({sym("DS")})},
+	       {"at-machine", values({sym("C-DS")})}});
+	b.add("referee-confirmation",
+	      {{"process-id", values({CLIPS::Value(RESTORED_ID)})},
+	       {"state", values({sym("REQUIRED")})}});
+	// last seen long ago, the robot is lost once the game continues
+	b.add("robot",
+	      {{"number", values({CLIPS::Value(1ll)})},
+	       {"team", values({CLIPS::Value("Cyan")})},
+	       {"team-color", values({sym("CYAN")})},
+	       {"name", values({CLIPS::Value("R-1")})},
+	       {"host", values({CLIPS::Value("127.0.0.1")})},
+	       {"port", values({CLIPS::Value(4444ll)})},
+	       {"last-seen", values({CLIPS::Value(1ll), CLIPS::Value(0ll)})}});
+	b.write(snapshot);
+
+	std::ofstream(cfg) << "---\nllsfrb:\n  snapshot:\n    enable: false\n    file: " << snapshot
+	                   << "\n";
+
+	// refbox options may be appended, e.g., --cfg-mps <file>
+	std::vector<char *> refbox_argv = {argv[0],
+	                                   (char *)"--cfg-custom",
+	                                   (char *)cfg.c_str(),
+	                                   (char *)"--restore"};
+	for (int i = 1; i < argc; ++i) {
+		refbox_argv.push_back(argv[i]);
+	}
+	refbox_argv.push_back(nullptr);
+
+	CLIPS::init();
+	{
+		LLSFRefBox refbox(refbox_argv.size() - 1, refbox_argv.data(), true);
+
+		check(eval_string(refbox, "(fact-slot-value (nth$ 1 (find-fact ((?g gamestate)) TRUE)) state)")
+		        == "PAUSED",
+		      "running game is paused after the restore");
+		check(eval_integer(refbox,
+		                   "(fact-slot-value (nth$ 1 (find-fact ((?p product-processed)) TRUE)) id)")
+		        == RESTORED_ID,
+		      "processed product is restored");
+		check(eval_integer(refbox, "(gen-int-id)") > RESTORED_ID,
+		      "new IDs do not collide with restored ones");
+		check(eval_integer(refbox,
+		                   "(fact-slot-value (assert (referee-confirmation (state REQUIRED)))"
+		                   " process-id)")
+		        > RESTORED_ID,
+		      "new referee confirmation gets a fresh process ID");
+		check(eval_integer(refbox, "(length$ (find-all-facts ((?r robot)) TRUE))") == 1,
+		      "robot is restored");
+		refbox.tick();
+		check(eval_integer(refbox, "(length$ (find-all-facts ((?r robot)) TRUE))") == 0,
+		      "restored robot without beacons is removed");
+	}
+
+	unlink(snapshot.c_str());
+	unlink(cfg.c_str());
+	return failures > 0 ? 1 : 0;
+}
+
+/// @endcond
@@ -37,6 +37,7 @@
 
 #include "refbox.h"
 
+#include "clips_image.h"
 #include "clips_logger.h"
 #include "msgs/ProductColor.pb.h"
 #include "rest-api/clips-rest-api/clips-rest-api.h"
@@ -44,11 +45,13 @@
 #include <config/yaml.h>
 #include <core/threading/mutex.h>
 #include <core/version.h>
+#include <logging/binary.h>
 #include <logging/console.h>
 #include <logging/file.h>
 #include <logging/multi.h>
 #include <logging/network.h>
 #include <mps_comm/machine_factory.h>
+#include <mps_comm/mockup/timer_queue.h>
 #include <mps_comm/stations.h>
 #include <mps_placing_clips/mps_placing_clips.h>
 #include <protobuf_clips/communicator.h>
@@ -79,6 +82,8 @@ namespace fs = boost::filesystem;
 
 #include <boost/bind/bind.hpp>
 #include <boost/format.hpp>
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <sstream>
 
@@ -94,6 +99,7 @@ namespace ph = boost::placeholders;
 
 #include <memory>
 #include <unordered_map>
+
 #if BOOST_ASIO_VERSION < 100601
 #	include <csignal>
 #endif
@@ -154,13 +160,23 @@ handle_signal(int signum)
  */
 
 /** Constructor.
+ * A headless refbox loads the same configuration and rules, but it opens
+ * no sockets, starts no services, uses mockup machines for all stations,
+ * and only logs warnings and errors to the console. It runs on a virtual
+ * clock which advances only by calls to tick(). Messages from robots and
+ * clients are passed in with inject_message().
  * @param argc number of arguments passed
  * @param argv array of arguments
+ * @param headless true to run without network, machines, and timer
  */
-LLSFRefBox::LLSFRefBox(int argc, char **argv)
-: clips_mutex_(fawkes::Mutex::RECURSIVE), timer_(io_service_)
+LLSFRefBox::LLSFRefBox(int argc, char **argv, bool headless)
+: clips_mutex_(fawkes::Mutex::RECURSIVE),
+  headless_(headless),
+  headless_msgs_sent_(0),
+  timer_(io_service_)
 {
 	read_config(argc, argv);
+	virtual_now_.stamp_systime();
 
 	pb_comm_ = NULL;
 
@@ -182,15 +198,30 @@ LLSFRefBox::LLSFRefBox(int argc, char **argv)
 		}
 	} catch (fawkes::Exception &e) {
 	} // ignored, use default
+	console_log_level_ = headless_ ? std::max(log_level_, Logger::LL_WARN) : log_level_;
 
 	logger_ = std::make_unique<MultiLogger>();
-	logger_->add_logger(new ConsoleLogger(log_level_));
+	logger_->add_logger(new ConsoleLogger(console_log_level_));
 	try {
 		std::string logfile = config_->get_string("/llsfrb/log/general");
 		logger_->add_logger(new FileLogger(logfile.c_str(), log_level_));
 	} catch (fawkes::Exception &e) {
 	} // ignored, use default
 
+	cfg_log_async_      = false;
+	cfg_log_queue_size_ = 4096;
+	try {
+		cfg_log_async_ = config_->get_bool("/llsfrb/log/async");
+	} catch (fawkes::Exception &e) {
+	} // ignored, use default
+	try {
+		cfg_log_queue_size_ = config_->get_uint("/llsfrb/log/async-queue-size");
+	} catch (fawkes::Exception &e) {
+	} // ignored, use default
+	if (cfg_log_async_) {
+		logger_->enable_async(cfg_log_queue_size_);
+	}
+
 	cfg_machine_assignment_ = ASSIGNMENT_2014;
 	try {
 		std::string m_ass_str = config_->get_string("/llsfrb/game/machine-assignment");
@@ -212,19 +243,61 @@ LLSFRefBox::LLSFRefBox(int argc, char **argv)
 	                  "Using %s machine assignment",
 	                  (cfg_machine_assignment_ == ASSIGNMENT_2013) ? "2013" : "2014");
 
+	unsigned int cfg_mps_executor_threads = 2;
+	unsigned int cfg_mps_queue_size       = 32;
+	try {
+		cfg_mps_executor_threads = config_->get_uint("/llsfrb/mps/executor-threads");
+	} catch (fawkes::Exception &e) {
+	} // ignored, use default
+	try {
+		cfg_mps_queue_size = config_->get_uint("/llsfrb/mps/command-queue-size");
+	} catch (fawkes::Exception &e) {
+	} // ignored, use default
+	mps_executor_ = std::make_unique<MpsExecutor>(cfg_mps_executor_threads, cfg_mps_queue_size);
+
+	try {
+		cfg_clips_image_dir_ = config_->get_string("/llsfrb/clips/image-dir");
+	} catch (fawkes::Exception &e) {
+	} // ignored, always load the CLIPS files
+
+	try {
+		cfg_snapshot_file_      = config_->get_string("/llsfrb/snapshot/file");
+		cfg_snapshot_templates_ = config_->get_strings("/llsfrb/snapshot/templates");
+		std::string::size_type pos;
+		if ((pos = cfg_snapshot_file_.find("@BASEDIR@")) != std::string::npos) {
+			cfg_snapshot_file_.replace(pos, 9, BASEDIR);
+		}
+	} catch (fawkes::Exception &e) {
+	} // ignored, no snapshots
+
 	clips_ = std::make_unique<CLIPS::Environment>();
 	setup_protobuf_comm();
 	setup_clips();
 
 #ifdef HAVE_WEBSOCKETS
 	//launch websocket backend and add websocket logger
-	backend_ = new websocket::Backend(logger_.get(), clips_.get(), clips_mutex_);
-	backend_->start(config_->get_uint("/llsfrb/websocket/port"),
-	                config_->get_bool("/llsfrb/websocket/ws-mode"),
-	                config_->get_bool("/llsfrb/websocket/allow-control-all"));
-	logger_->add_logger(new WebsocketLogger(backend_->get_data(), log_level_));
+	if (!headless_) {
+		backend_ = new websocket::Backend(logger_.get(), clips_.get(), clips_mutex_);
+		backend_->start(config_->get_uint("/llsfrb/websocket/port"),
+		                config_->get_bool("/llsfrb/websocket/ws-mode"),
+		                config_->get_bool("/llsfrb/websocket/allow-control-all"));
+		logger_->add_logger(new WebsocketLogger(backend_->get_data(), log_level_));
+	}
 #endif
 
+	cfg_mockup_clock_step_ = 0;
+	if (headless_
+	    || config_->get_bool_or_default("/llsfrb/simulation/mockup-virtual-clock", false)) {
+		// mockup machines advance by one timer interval of game time per cycle
+		float speedup = config_->get_float_or_default("/llsfrb/simulation/speedup", 1.0);
+		cfg_mockup_clock_step_ = std::lround(cfg_timer_interval_ * speedup);
+		mockup_timer_queue_    = mps_comm::MockupTimerQueue::instance();
+		mockup_timer_queue_->set_virtual_clock(true);
+		logger_->log_info("RefBox",
+		                  "Mockup machines use a virtual clock, %u ms per cycle",
+		                  cfg_mockup_clock_step_);
+	}
+
 	try {
 		if (config_->get_bool("/llsfrb/mps/enable")) {
 			std::string prefix = "/llsfrb/mps/stations/";
@@ -265,6 +338,9 @@ LLSFRefBox::LLSFRefBox(int argc, char **argv)
 							connection_string = config_->get_string((cfg_prefix + "connection").c_str());
 						} catch (Exception &e) {
 						}
+						if (headless_) {
+							connection_string = "mockup";
+						}
 
 						std::string log_path = "";
 						try {
@@ -285,34 +361,26 @@ LLSFRefBox::LLSFRefBox(int argc, char **argv)
 						MachineFactory mps_factory(config_);
 						auto           mps = mps_factory.create_machine(
               cfg_name, mpstype, mpsip, port, log_path, connection_string);
-						mps->register_ready_callback([this, cfg_name](bool ready) {
-							fawkes::MutexLocker clips_lock(&clips_mutex_);
-							clips_->assert_fact_f("(mps-status-feedback %s READY %s)",
-							                      cfg_name.c_str(),
-							                      ready ? "TRUE" : "FALSE");
+						// the callbacks run on the MPS threads, they only update the state
+						// cache which is turned into facts in the next cycle
+						MpsStateCache::Station *state = mps_state_.add_station(cfg_name);
+						mps->register_ready_callback(
+						  [state](bool ready) { state->update(MpsStateCache::READY, ready); });
+						mps->register_busy_callback(
+						  [state](bool busy) { state->update(MpsStateCache::BUSY, busy); });
+						mps->register_barcode_callback([state](unsigned long barcode) {
+							state->update(MpsStateCache::BARCODE, barcode);
 						});
-						mps->register_busy_callback([this, cfg_name](bool busy) {
-							fawkes::MutexLocker clips_lock(&clips_mutex_);
-							clips_->assert_fact_f("(mps-status-feedback %s BUSY %s)",
-							                      cfg_name.c_str(),
-							                      busy ? "TRUE" : "FALSE");
-						});
-						mps->register_barcode_callback([this, cfg_name](unsigned long barcode) {
-							fawkes::MutexLocker clips_lock(&clips_mutex_);
-							clips_->assert_fact_f("(mps-status-feedback %s BARCODE %u)",
-							                      cfg_name.c_str(),
-							                      barcode);
+						mps->register_connected_callback([state](bool connected) {
+							state->update(MpsStateCache::CONNECTED, connected);
 						});
 						if (mpstype == "RS") {
 							RingStation *rs = dynamic_cast<RingStation *>(mps.get());
 							if (!rs) {
 								throw Exception("Expected MPS %s to be of type RingStation", cfg_name.c_str());
 							}
-							rs->register_slide_callback([this, cfg_name](unsigned int counter) {
-								fawkes::MutexLocker clips_lock(&clips_mutex_);
-								clips_->assert_fact_f("(mps-status-feedback %s SLIDE-COUNTER %u)",
-								                      cfg_name.c_str(),
-								                      counter);
+							rs->register_slide_callback([state](unsigned int counter) {
+								state->update(MpsStateCache::SLIDE_COUNTER, counter);
 							});
 						}
 						mps_[cfg_name] = std::move(mps);
@@ -322,7 +390,9 @@ LLSFRefBox::LLSFRefBox(int argc, char **argv)
 					}
 				}
 			}
-			logger_->log_info("RefBox", "Connected to all machines");
+			logger_->log_info("RefBox",
+			                  "Connecting to %zu machines in the background",
+			                  mps_configs.size());
 		}
 	} catch (Exception &e) {
 		throw;
@@ -331,16 +401,23 @@ LLSFRefBox::LLSFRefBox(int argc, char **argv)
 	mps_placing_generator_ = std::shared_ptr<mps_placing_clips::MPSPlacingGenerator>(
 	  new mps_placing_clips::MPSPlacingGenerator(clips_.get(), clips_mutex_));
 
-	logger_->add_logger(new NetworkLogger(pb_comm_->server(), log_level_));
+	if (headless_) {
+		pb_comm_->signal_peer_sent().connect(
+		  [this](long int, std::shared_ptr<google::protobuf::Message>) { ++headless_msgs_sent_; });
+	} else {
+		logger_->add_logger(new NetworkLogger(pb_comm_->server(), log_level_));
+	}
 
 #ifdef HAVE_WEBSOCKETS
-	setup_clips_websocket();
+	if (!headless_) {
+		setup_clips_websocket();
+	}
 #endif
 
 #ifdef HAVE_MONGODB
 	cfg_mongodb_enabled_ = false;
 	try {
-		cfg_mongodb_enabled_ = config_->get_bool("/llsfrb/mongodb/enable");
+		cfg_mongodb_enabled_ = config_->get_bool("/llsfrb/mongodb/enable") && !headless_;
 	} catch (fawkes::Exception &e) {
 	} // ignore, use default
 
@@ -376,6 +453,48 @@ LLSFRefBox::LLSFRefBox(int argc, char **argv)
 
 	start_clips();
 
+	if (!headless_ && !cfg_save_clips_image_ && !cfg_snapshot_file_.empty()
+	    && config_->get_bool_or_default("/llsfrb/snapshot/enable", false)) {
+		bool write_snapshots = true;
+		if (!cfg_restore_ && stdfs::exists(cfg_snapshot_file_)) {
+			// the previous game may not have finished, keep the last ones for a
+			// later --restore as <file>.1 (latest) up to <file>.<keep>
+			unsigned int keep = config_->get_uint_or_default("/llsfrb/snapshot/keep", 1);
+			try {
+				std::error_code ec;
+				stdfs::remove(cfg_snapshot_file_ + "." + std::to_string(keep), ec);
+				for (unsigned int i = keep; i > 1; --i) {
+					std::string older = cfg_snapshot_file_ + "." + std::to_string(i - 1);
+					if (stdfs::exists(older)) {
+						stdfs::rename(older, cfg_snapshot_file_ + "." + std::to_string(i));
+					}
+				}
+				if (keep > 0) {
+					std::string kept_file = cfg_snapshot_file_ + ".1";
+					stdfs::rename(cfg_snapshot_file_, kept_file);
+					logger_->log_info("RefBox", "Kept previous game snapshot as %s", kept_file.c_str());
+				}
+			} catch (std::exception &e) {
+				logger_->log_error("RefBox",
+				                   "Cannot keep previous game snapshot, not writing snapshots: %s",
+				                   e.what());
+				write_snapshots = false;
+			}
+		}
+		if (write_snapshots) {
+			try {
+				snapshot_writer_ = std::make_unique<GameSnapshotWriter>(
+				  clips_publisher_.get(),
+				  cfg_snapshot_file_,
+				  cfg_snapshot_templates_,
+				  config_->get_uint_or_default("/llsfrb/snapshot/interval", 1000),
+				  logger_.get());
+			} catch (fawkes::Exception &e) {
+				logger_->log_error("RefBox", "Cannot write game snapshots: %s", e.what_no_backtrace());
+			}
+		}
+	}
+
 #ifdef HAVE_MONGODB
 	// we can do this only after CLIPS was started as it initiates the private peers
 	if (cfg_mongodb_enabled_) {
@@ -387,6 +506,11 @@ LLSFRefBox::LLSFRefBox(int argc, char **argv)
 	}
 #endif
 
+	if (headless_) {
+		// no service discovery and REST API
+		return;
+	}
+
 	std::shared_ptr<fawkes::ServicePublisher>    service_publisher;
 	std::shared_ptr<fawkes::ServiceBrowser>      service_browser;
 	std::unique_ptr<fawkes::NetworkNameResolver> nnresolver;
@@ -411,7 +535,12 @@ LLSFRefBox::LLSFRefBox(int argc, char **argv)
 #endif
 
 	try {
-		clips_rest_api_ = std::make_unique<ClipsRestApi>(clips_.get(), clips_mutex_, logger_.get());
+		// the REST API reads from a replica and never locks the environment
+		clips_replica_ = std::make_unique<clips_replica::FactReplica>();
+		clips_publisher_->subscribe(clips_replica_.get());
+		clips_rest_api_ = std::make_unique<ClipsRestApi>(clips_replica_.get(), logger_.get());
+		clips_rest_api_->set_cache_revision_provider(
+		  std::bind(&clips_replica::FactReplica::revision, clips_replica_.get()));
 
 		rest_api_manager_ = std::make_shared<WebviewRestApiManager>();
 		rest_api_manager_->register_api(clips_rest_api_.get());
@@ -436,15 +565,32 @@ LLSFRefBox::~LLSFRefBox()
 {
 	timer_.cancel();
 
-	rest_api_thread_->cancel();
-	rest_api_thread_->join();
+	if (rest_api_thread_) {
+		rest_api_thread_->cancel();
+		rest_api_thread_->join();
+	}
 
-	rest_api_manager_->unregister_api(clips_rest_api_.get());
+	if (rest_api_manager_) {
+		rest_api_manager_->unregister_api(clips_rest_api_.get());
+	}
+	if (clips_replica_) {
+		clips_publisher_->unsubscribe(clips_replica_.get());
+	}
+#ifdef HAVE_WEBSOCKETS
+	ws_fact_updater_.reset();
+#endif
+	snapshot_writer_.reset();
 #ifdef HAVE_AVAHI
-	avahi_thread_->cancel();
-	avahi_thread_->join();
+	if (avahi_thread_) {
+		avahi_thread_->cancel();
+		avahi_thread_->join();
+	}
 #endif
 
+	// wait for queued machine commands, their feedback is no longer processed
+	mps_executor_->shutdown();
+	log_mps_command_metrics();
+
 	//std::lock_guard<std::recursive_mutex> lock(clips_mutex_);
 	{
 		fawkes::MutexLocker lock(&clips_mutex_);
@@ -452,9 +598,16 @@ LLSFRefBox::~LLSFRefBox()
 		clips_->refresh_agenda();
 		clips_->run();
 
+		clips_fact_index_.reset();
+		clips_config_.reset();
+		clips_deadlines_.reset();
 		finalize_clips_logger(clips_->cobj());
 	}
 
+	// flush queued log messages while all sub-loggers are still usable
+	clips_logger_->disable_async();
+	logger_->disable_async();
+
 	mps_placing_generator_.reset();
 
 	// Delete all global objects allocated by libprotobuf
@@ -496,6 +649,8 @@ LLSFRefBox::read_config(int argc, char **argv)
 	std::vector<option> static_options = {{"no-default-cfg", 0, 0, 0},
 	                                      {"cfg-custom", 1, 0, 0},
 	                                      {"dump-cfg", 0, 0, 0},
+	                                      {"restore", 0, 0, 0},
+	                                      {"save-clips-image", 0, 0, 0},
 	                                      {0, 0, 0, 0}}; // null terminate options
 	option              options[cfg_files_to_include.size() + static_options.size()];
 	// Prepare ArgumentParser
@@ -529,9 +684,15 @@ LLSFRefBox::read_config(int argc, char **argv)
 		  "  --cfg-custom <yaml-file>     : load an additional <yaml-file> (loaded last)\n";
 		help_message += "  --dump-cfg <yaml-file>       : write the configuration file (required to "
 		                "use some of the companion tools)\n";
+		help_message += "  --restore                    : continue the game from the latest "
+		                "snapshot (see /llsfrb/snapshot)\n";
+		help_message += "  --save-clips-image           : load the CLIPS files, save them as image "
+		                "(see /llsfrb/clips/image-dir) and exit\n";
 		printf("--- RefBox customization options ---\n%s", help_message.c_str());
 		exit(1);
 	}
+	cfg_restore_          = argp.has_arg("restore");
+	cfg_save_clips_image_ = argp.has_arg("save-clips-image");
 	if (argp.has_arg("no-default-cfg")) {
 		cfg_files_to_include.clear();
 	}
@@ -612,7 +773,12 @@ LLSFRefBox::setup_protobuf_comm()
 		pb_comm_ = std::make_unique<ClipsProtobufCommunicator>(clips_.get(), clips_mutex_, proto_dirs);
 	}
 
-	pb_comm_->enable_server(config_->get_uint("/llsfrb/comm/server-port"));
+	if (headless_) {
+		pb_comm_->set_offline(true);
+		pb_comm_->set_time_source([this](struct timeval *tv) { *tv = *now().get_timeval(); });
+	} else {
+		pb_comm_->enable_server(config_->get_uint("/llsfrb/comm/server-port"));
+	}
 
 	MessageRegister &mr_server = pb_comm_->message_register();
 	if (!mr_server.load_failures().empty()) {
@@ -632,12 +798,31 @@ LLSFRefBox::setup_clips()
 
 	logger_->log_info("RefBox", "Creating CLIPS environment");
 	clips_logger_ = std::make_unique<MultiLogger>();
-	clips_logger_->add_logger(new ConsoleLogger(log_level_));
+	clips_logger_->add_logger(new ConsoleLogger(console_log_level_));
+	std::string clips_binary_log;
 	try {
-		std::string logfile = config_->get_string("/llsfrb/log/clips");
-		clips_logger_->add_logger(new FileLogger(logfile.c_str(), Logger::LL_DEBUG));
+		clips_binary_log = config_->get_string("/llsfrb/log/clips-binary");
 	} catch (fawkes::Exception &e) {
-	} // ignored, use default
+	} // ignored, use text log
+	if (!clips_binary_log.empty()) {
+		unsigned int ring_size_mb = 64;
+		try {
+			ring_size_mb = config_->get_uint("/llsfrb/log/binary-ring-size");
+		} catch (fawkes::Exception &e) {
+		} // ignored, use default
+		clips_logger_->add_logger(new BinaryLogger(clips_binary_log.c_str(),
+		                                           (size_t)ring_size_mb * 1024 * 1024,
+		                                           Logger::LL_DEBUG));
+	} else {
+		try {
+			std::string logfile = config_->get_string("/llsfrb/log/clips");
+			clips_logger_->add_logger(new FileLogger(logfile.c_str(), Logger::LL_DEBUG));
+		} catch (fawkes::Exception &e) {
+		} // ignored, use default
+	}
+	if (cfg_log_async_) {
+		clips_logger_->enable_async(cfg_log_queue_size_);
+	}
 
 	bool simulation = false;
 	try {
@@ -646,6 +831,10 @@ LLSFRefBox::setup_clips()
 	} // ignore, use default
 
 	init_clips_logger(clips_->cobj(), logger_.get(), clips_logger_.get());
+	clips_fact_index_ = std::make_unique<ClipsFactIndex>(clips_.get());
+	clips_config_     = std::make_unique<ClipsConfig>(clips_.get(), config_.get());
+	clips_deadlines_  = std::make_unique<ClipsDeadlines>(clips_.get(), [this]() { return now(); });
+	clips_publisher_  = std::make_unique<clips_replica::FactChangePublisher>(clips_.get());
 
 	std::string defglobal_ver =
 	  boost::str(boost::format("(defglobal\n"
@@ -655,16 +844,13 @@ LLSFRefBox::setup_clips()
 	                           ")")
 	             % FAWKES_VERSION_MAJOR % FAWKES_VERSION_MINOR % FAWKES_VERSION_MICRO);
 
-	clips_->build(defglobal_ver);
+	build_clips_setup(defglobal_ver);
 
 	clips_->add_function("get-clips-dirs",
 	                     sigc::slot<CLIPS::Values>(
 	                       sigc::mem_fun(*this, &LLSFRefBox::clips_get_clips_dirs)));
 	clips_->add_function("now",
 	                     sigc::slot<CLIPS::Values>(sigc::mem_fun(*this, &LLSFRefBox::clips_now)));
-	clips_->add_function("load-config",
-	                     sigc::slot<void, std::string>(
-	                       sigc::mem_fun(*this, &LLSFRefBox::clips_load_config)));
 	clips_->add_function("config-path-exists",
 	                     sigc::slot<CLIPS::Value, std::string>(
 	                       sigc::mem_fun(*this, &LLSFRefBox::clips_config_path_exists)));
@@ -677,6 +863,20 @@ LLSFRefBox::setup_clips()
 	clips_->add_function("print-fact-list",
 	                     sigc::slot<void, CLIPS::Values, CLIPS::Values>(
 	                       sigc::mem_fun(*this, &LLSFRefBox::clips_print_fact_list)));
+	clips_->add_function("points-registry-add",
+	                     sigc::slot<void, std::string, std::string, int>(
+	                       sigc::mem_fun(*this, &LLSFRefBox::clips_points_add)));
+	clips_->add_function("points-registry-remove",
+	                     sigc::slot<void, std::string, std::string, int>(
+	                       sigc::mem_fun(*this, &LLSFRefBox::clips_points_remove)));
+	clips_->add_function("points-registry-reset",
+	                     sigc::slot<void>(sigc::mem_fun(*this, &LLSFRefBox::clips_points_reset)));
+	clips_->add_function("points-registry-phase",
+	                     sigc::slot<CLIPS::Value, std::string, std::string>(
+	                       sigc::mem_fun(*this, &LLSFRefBox::clips_points_phase)));
+	clips_->add_function("points-registry-total",
+	                     sigc::slot<CLIPS::Value, std::string>(
+	                       sigc::mem_fun(*this, &LLSFRefBox::clips_points_total)));
 
 	if (!simulation) {
 		clips_->add_function("mps-move-conveyor",
@@ -725,17 +925,59 @@ LLSFRefBox::setup_clips()
 		clips_->add_function("mps-ss-relocate",
 		                     sigc::slot<void, std::string, int, int, int, int>(
 		                       sigc::mem_fun(*this, &LLSFRefBox::clips_mps_ss_relocate)));
+		clips_->add_function("mps-command-stats",
+		                     sigc::slot<CLIPS::Values, std::string>(
+		                       sigc::mem_fun(*this, &LLSFRefBox::clips_mps_command_stats)));
 	}
 
 	clips_->signal_periodic().connect(sigc::mem_fun(*this, &LLSFRefBox::handle_clips_periodic));
 }
 
+/** Build a construct while setting up the CLIPS environment.
+ * The construct is built again if the environment has to be cleared
+ * after a CLIPS image failed to load.
+ * @param construct construct to build
+ */
+void
+LLSFRefBox::build_clips_setup(const std::string &construct)
+{
+	clips_->build(construct);
+	clips_setup_constructs_.push_back(construct);
+}
+
 void
 LLSFRefBox::start_clips()
 {
 	fawkes::MutexLocker lock(&clips_mutex_);
 
-	if (!clips_->batch_evaluate(cfg_clips_dir_ + "init.clp")) {
+	auto        load_start = std::chrono::steady_clock::now();
+	std::string image_file;
+	if (!cfg_clips_image_dir_.empty()) {
+		image_file = cfg_clips_image_dir_ + "/rcll-"
+		             + clips_image_key(clips_.get(), cfg_clips_dir_, config_.get()) + ".bin";
+	} else if (cfg_save_clips_image_) {
+		throw fawkes::Exception("Cannot save CLIPS image, no image directory configured");
+	}
+
+	bool image_loaded = false;
+	if (!image_file.empty() && !cfg_save_clips_image_ && stdfs::exists(image_file)) {
+		try {
+			clips_image_load(clips_.get(), image_file);
+			clips_->reset();
+			clips_->evaluate("(seed (integer (time)))");
+			image_loaded = true;
+		} catch (fawkes::Exception &e) {
+			logger_->log_warn("RefBox", "%s, loading the CLIPS files", e.what_no_backtrace());
+			std::error_code ec;
+			stdfs::remove(image_file, ec);
+			// a failed bload may have cleared the constructs of the setup
+			clips_->clear();
+			for (const std::string &construct : clips_setup_constructs_) {
+				clips_->build(construct);
+			}
+		}
+	}
+	if (!image_loaded && !clips_->batch_evaluate(cfg_clips_dir_ + "init.clp")) {
 		logger_->log_warn("RefBox", "Failed to initialize CLIPS environment, batch file failed.");
 		throw fawkes::Exception("Failed to initialize CLIPS environment, batch file failed.");
 	}
@@ -743,6 +985,41 @@ LLSFRefBox::start_clips()
 	clips_->assert_fact("(init)");
 	clips_->refresh_agenda();
 	clips_->run();
+
+	if (!image_loaded) {
+		// the files are loaded once, resetting the game must not load them again
+		clips_->build("(deffacts rules-loaded (rules-loaded))");
+		if (!image_file.empty()) {
+			try {
+				stdfs::create_directories(cfg_clips_image_dir_);
+				clips_image_save(clips_.get(), image_file);
+				logger_->log_info("RefBox", "Saved CLIPS image %s", image_file.c_str());
+			} catch (std::exception &e) {
+				logger_->log_warn("RefBox", "Cannot save CLIPS image: %s", e.what());
+			}
+		}
+	}
+	logger_->log_info("RefBox",
+	                  "Loaded CLIPS %s in %.1f ms",
+	                  image_loaded ? image_file.c_str() : "files",
+	                  std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()
+	                                                            - load_start)
+	                    .count());
+
+	if (cfg_restore_) {
+		if (cfg_snapshot_file_.empty()) {
+			throw fawkes::Exception("Cannot restore the game, no snapshot file configured");
+		}
+		auto start = std::chrono::steady_clock::now();
+		restore_game_snapshot(clips_.get(), cfg_snapshot_file_, cfg_snapshot_templates_, logger_.get());
+		clips_->evaluate("(game-restored)");
+		clips_->refresh_agenda();
+		clips_->run();
+		logger_->log_info(
+		  "RefBox",
+		  "Restored game in %.1f ms",
+		  std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
 }
 
 void
@@ -771,14 +1048,27 @@ LLSFRefBox::handle_clips_periodic()
 CLIPS::Values
 LLSFRefBox::clips_now()
 {
-	CLIPS::Values  rv;
-	struct timeval tv;
-	gettimeofday(&tv, 0);
-	rv.push_back(tv.tv_sec);
-	rv.push_back(tv.tv_usec);
+	CLIPS::Values rv;
+	fawkes::Time  t = now();
+	rv.push_back(t.get_sec());
+	rv.push_back(t.get_usec());
 	return rv;
 }
 
+/** Get the current time.
+ * @return the virtual time when headless, the system time otherwise
+ */
+fawkes::Time
+LLSFRefBox::now() const
+{
+	if (headless_) {
+		return virtual_now_;
+	}
+	fawkes::Time t;
+	t.stamp_systime();
+	return t;
+}
+
 /** Convert a clips value into a string representation
  * @param v Value to convert
  * @return v represented as std::string
@@ -906,52 +1196,6 @@ LLSFRefBox::clips_print_fact_list(CLIPS::Values facts, CLIPS::Values fields)
 	}
 }
 
-void
-LLSFRefBox::clips_load_config(std::string cfg_prefix)
-{
-	std::shared_ptr<Configuration::ValueIterator> v(config_->search(cfg_prefix.c_str()));
-	while (v->next()) {
-		std::string type  = "";
-		std::string value = v->get_as_string();
-
-		if (v->is_uint())
-			type = "UINT";
-		else if (v->is_int())
-			type = "INT";
-		else if (v->is_float())
-			type = "FLOAT";
-		else if (v->is_bool())
-			type = "BOOL";
-		else if (v->is_string()) {
-			type = "STRING";
-			if (!v->is_list()) {
-				value = std::string("\"") + value + "\"";
-			}
-		} else {
-			logger_->log_warn("RefBox",
-			                  "Config value at '%s' of unknown type '%s'",
-			                  v->path(),
-			                  v->type());
-		}
-
-		if (v->is_list()) {
-			//logger_->log_info("RefBox", "(confval (path \"%s\") (type %s) (is-list TRUE) (list-value %s))",
-			//       v->path(), type.c_str(), value.c_str());
-			clips_->assert_fact_f("(confval (path \"%s\") (type %s) (is-list TRUE) (list-value %s))",
-			                      v->path(),
-			                      type.c_str(),
-			                      value.c_str());
-		} else {
-			//logger_->log_info("RefBox", "(confval (path \"%s\") (type %s) (value %s))",
-			//       v->path(), type.c_str(), value.c_str());
-			clips_->assert_fact_f("(confval (path \"%s\") (type %s) (value %s))",
-			                      v->path(),
-			                      type.c_str(),
-			                      value.c_str());
-		}
-	}
-}
-
 CLIPS::Value
 LLSFRefBox::clips_config_path_exists(std::string path)
 {
@@ -980,21 +1224,6 @@ LLSFRefBox::clips_config_get_int(std::string path)
 	}
 }
 
-bool
-LLSFRefBox::mutex_future_ready(const std::string &name)
-{
-	auto mf_it = mutex_futures_.find(name);
-	if (mf_it != mutex_futures_.end()) {
-		auto fut_status = mutex_futures_[name].wait_for(std::chrono::milliseconds(0));
-		if (fut_status != std::future_status::ready) {
-			return false;
-		} else {
-			mutex_futures_.erase(mf_it);
-		}
-	}
-	return true;
-}
-
 void
 LLSFRefBox::clips_mps_reset(std::string machine)
 {
@@ -1007,15 +1236,7 @@ LLSFRefBox::clips_mps_reset(std::string machine)
 		logger_->log_error("MPS", "Invalid station %s", machine.c_str());
 		return;
 	}
-	if (!mutex_future_ready(machine)) {
-		return;
-	}
-	auto fut = std::async(std::launch::async, [station, machine] {
-		station->reset();
-		return true;
-	});
-
-	mutex_futures_[machine] = std::move(fut);
+	submit_mps_command(machine, "reset", [station] { station->reset(); });
 }
 
 void
@@ -1038,18 +1259,17 @@ LLSFRefBox::clips_mps_deliver(std::string machine)
 		logger_->log_error("MPS", "Invalid station %s", machine.c_str());
 		return;
 	}
-	if (!mutex_future_ready(machine)) {
-		return;
-	}
-	auto fut = std::async(std::launch::async, [this, station, machine] {
-		station->conveyor_move(llsfrb::mps_comm::Machine::ConveyorDirection::FORWARD,
-		                       llsfrb::mps_comm::Machine::MPSSensor::OUTPUT);
-		MutexLocker lock(&clips_mutex_);
-		clips_->assert_fact_f("(mps-feedback mps-deliver success %s)", machine.c_str());
-		return true;
-	});
-
-	mutex_futures_[machine] = std::move(fut);
+	submit_mps_command(
+	  machine,
+	  "deliver",
+	  [station] {
+		  station->conveyor_move(llsfrb::mps_comm::Machine::ConveyorDirection::FORWARD,
+		                         llsfrb::mps_comm::Machine::MPSSensor::OUTPUT);
+	  },
+	  [this, machine](bool success, const std::string &) {
+		  post_clips_fact("(mps-feedback mps-deliver " + std::string(success ? "success" : "failed")
+		                  + " " + machine + ")");
+	  });
 }
 
 void
@@ -1074,7 +1294,7 @@ LLSFRefBox::clips_mps_bs_dispense(std::string machine, std::string color)
 		logger_->log_error("MPS", "Invalid color %s", color.c_str());
 		return;
 	}
-	station->get_base(color_id);
+	submit_mps_command(machine, "get-base", [station, color_id] { station->get_base(color_id); });
 }
 
 void
@@ -1088,7 +1308,9 @@ LLSFRefBox::clips_mps_ds_process(std::string machine, int slide)
 		logger_->log_error("MPS", "Invalid station %s", machine.c_str());
 		return;
 	}
-	station->deliver_product(slide);
+	submit_mps_command(machine, "deliver-product", [station, slide] {
+		station->deliver_product(slide);
+	});
 }
 
 void
@@ -1115,7 +1337,9 @@ LLSFRefBox::clips_mps_rs_mount_ring(std::string machine, int slide, std::string
 		logger_->log_info("MPS", "Unexpected ring color %s", color.c_str());
 		return;
 	}
-	station->mount_ring(slide, ring_color);
+	submit_mps_command(machine, "mount-ring", [station, slide, ring_color] {
+		station->mount_ring(slide, ring_color);
+	});
 }
 
 void
@@ -1150,7 +1374,9 @@ LLSFRefBox::clips_mps_move_conveyor(std::string machine,
 		logger_->log_error("MPS", "Unknown conveyor direction %s", conveyor_direction.c_str());
 		return;
 	}
-	station->conveyor_move(direction, goal);
+	submit_mps_command(machine, "conveyor-move", [station, direction, goal] {
+		station->conveyor_move(direction, goal);
+	});
 }
 
 void
@@ -1163,7 +1389,7 @@ LLSFRefBox::clips_mps_cs_retrieve_cap(std::string machine)
 		logger_->log_error("MPS", "Invalid station %s", machine.c_str());
 		return;
 	}
-	station->retrieve_cap();
+	submit_mps_command(machine, "retrieve-cap", [station] { station->retrieve_cap(); });
 }
 
 void
@@ -1176,7 +1402,7 @@ LLSFRefBox::clips_mps_cs_mount_cap(std::string machine)
 		logger_->log_error("MPS", "Invalid station %s", machine.c_str());
 		return;
 	}
-	station->mount_cap();
+	submit_mps_command(machine, "mount-cap", [station] { station->mount_cap(); });
 }
 
 void
@@ -1189,7 +1415,9 @@ LLSFRefBox::clips_mps_ss_retrieve(std::string machine, unsigned int shelf, unsig
 		logger_->log_error("MPS", "Invalid station %s", machine.c_str());
 		return;
 	}
-	station->retrieve(shelf, slot);
+	submit_mps_command(machine, "retrieve", [station, shelf, slot] {
+		station->retrieve(shelf, slot);
+	});
 }
 
 void
@@ -1202,7 +1430,7 @@ LLSFRefBox::clips_mps_ss_store(std::string machine, unsigned int shelf, unsigned
 		logger_->log_error("MPS", "Invalid station %s", machine.c_str());
 		return;
 	}
-	station->store(shelf, slot);
+	submit_mps_command(machine, "store", [station, shelf, slot] { station->store(shelf, slot); });
 }
 
 void
@@ -1219,7 +1447,9 @@ LLSFRefBox::clips_mps_ss_relocate(std::string  machine,
 		logger_->log_error("MPS", "Invalid station %s", machine.c_str());
 		return;
 	}
-	station->relocate(shelf, slot, target_shelf, target_slot);
+	submit_mps_command(machine, "relocate", [station, shelf, slot, target_shelf, target_slot] {
+		station->relocate(shelf, slot, target_shelf, target_slot);
+	});
 }
 
 void
@@ -1262,7 +1492,9 @@ LLSFRefBox::clips_mps_set_light(std::string machine, std::string color, std::str
 	//printf("Set light %i %i %i\n", color_id, state_id, blink_id);
 	// TODO time?
 	int time = 0;
-	station->set_light(color_id, state_id, time);
+	submit_mps_command(machine, "set-light", [station, color_id, state_id, time] {
+		station->set_light(color_id, state_id, time);
+	});
 }
 
 void
@@ -1286,7 +1518,169 @@ LLSFRefBox::clips_mps_reset_lights(std::string machine)
 		logger_->log_error("MPS", "Invalid station %s", machine.c_str());
 		return;
 	}
-	station->reset_light();
+	submit_mps_command(machine, "reset-light", [station] { station->reset_light(); });
+}
+
+CLIPS::Values
+LLSFRefBox::clips_mps_command_stats(std::string machine)
+{
+	MpsExecutor::Metrics m = mps_executor_->metrics(machine);
+
+	CLIPS::Values rv;
+	rv.push_back(CLIPS::Value("queue-depth", CLIPS::TYPE_SYMBOL));
+	rv.push_back(CLIPS::Value((long long int)m.queue_depth));
+	rv.push_back(CLIPS::Value("max-queue-depth", CLIPS::TYPE_SYMBOL));
+	rv.push_back(CLIPS::Value((long long int)m.max_queue_depth));
+	rv.push_back(CLIPS::Value("executed", CLIPS::TYPE_SYMBOL));
+	rv.push_back(CLIPS::Value((long long int)m.executed));
+	rv.push_back(CLIPS::Value("failed", CLIPS::TYPE_SYMBOL));
+	rv.push_back(CLIPS::Value((long long int)m.failed));
+	rv.push_back(CLIPS::Value("rejected", CLIPS::TYPE_SYMBOL));
+	rv.push_back(CLIPS::Value((long long int)m.rejected));
+	rv.push_back(CLIPS::Value("avg-latency", CLIPS::TYPE_SYMBOL));
+	rv.push_back(CLIPS::Value(m.avg_latency_ms));
+	rv.push_back(CLIPS::Value("max-latency", CLIPS::TYPE_SYMBOL));
+	rv.push_back(CLIPS::Value(m.max_latency_ms));
+	return rv;
+}
+
+void
+LLSFRefBox::clips_points_add(std::string team, std::string phase, int points)
+{
+	points_.add(team, phase, points);
+}
+
+void
+LLSFRefBox::clips_points_remove(std::string team, std::string phase, int points)
+{
+	points_.remove(team, phase, points);
+}
+
+void
+LLSFRefBox::clips_points_reset()
+{
+	points_.reset();
+}
+
+CLIPS::Value
+LLSFRefBox::clips_points_phase(std::string team, std::string phase)
+{
+	return CLIPS::Value((long long int)points_.phase_points(team, phase));
+}
+
+CLIPS::Value
+LLSFRefBox::clips_points_total(std::string team)
+{
+	return CLIPS::Value((long long int)points_.total(team));
+}
+
+/** Queue a command for a station.
+ * Commands for the same station are executed in order on the MPS executor,
+ * commands for different stations run concurrently. The completion is
+ * called from an executor thread, it must not touch the CLIPS environment
+ * directly but use post_clips_fact().
+ * @param machine name of the station
+ * @param name name of the command, used for logging
+ * @param command command to execute
+ * @param completion called with the result after the command has been executed
+ * @return true if the command was queued, false if the queue of the station is full
+ */
+bool
+LLSFRefBox::submit_mps_command(const std::string &     machine,
+                               const std::string &     name,
+                               MpsExecutor::Command    command,
+                               MpsExecutor::Completion completion)
+{
+	bool queued = mps_executor_->submit(
+	  machine,
+	  name,
+	  std::move(command),
+	  [this, machine, name, completion](bool success, const std::string &error) {
+		  if (!success) {
+			  logger_->log_error(
+			    "MPS", "%s on %s failed: %s", name.c_str(), machine.c_str(), error.c_str());
+		  }
+		  if (completion) {
+			  completion(success, error);
+		  }
+	  });
+	if (!queued) {
+		logger_->log_warn("MPS",
+		                  "Command queue of %s full, dropping %s",
+		                  machine.c_str(),
+		                  name.c_str());
+	}
+	return queued;
+}
+
+/** Assert a fact from another thread.
+ * The fact is asserted in the next timer cycle while holding the CLIPS mutex.
+ * @param fact fact to assert in CLIPS syntax
+ */
+void
+LLSFRefBox::post_clips_fact(const std::string &fact)
+{
+	std::lock_guard<std::mutex> lock(clips_ingress_mutex_);
+	clips_ingress_facts_.push_back(fact);
+}
+
+/** Assert all facts posted by other threads.
+ * Must be called with the CLIPS mutex locked.
+ */
+void
+LLSFRefBox::process_clips_ingress()
+{
+	std::vector<std::string> facts;
+	{
+		std::lock_guard<std::mutex> lock(clips_ingress_mutex_);
+		facts.swap(clips_ingress_facts_);
+	}
+	for (const std::string &fact : facts) {
+		clips_->assert_fact(fact);
+	}
+}
+
+/** Assert the MPS state changes since the last cycle.
+ * Each changed signal of a station results in a single mps-status-feedback
+ * fact with the latest value. Must be called with the CLIPS mutex locked.
+ */
+void
+LLSFRefBox::process_mps_state()
+{
+	CLIPS::Template::pointer tmpl = clips_->get_template("mps-status-feedback");
+	if (!tmpl) {
+		// game not loaded yet, keep the changes for later
+		return;
+	}
+	mps_state_.process_changes(
+	  [this, &tmpl](const std::string &machine, MpsStateCache::Signal signal, uint64_t value) {
+		  CLIPS::Fact::pointer fact = CLIPS::Fact::create(*clips_, tmpl);
+		  fact->set_slot("machine", CLIPS::Value(machine, CLIPS::TYPE_SYMBOL));
+		  fact->set_slot("type", CLIPS::Value(MpsStateCache::signal_name(signal), CLIPS::TYPE_SYMBOL));
+		  if (MpsStateCache::is_boolean(signal)) {
+			  fact->set_slot("value", CLIPS::Value(value ? "TRUE" : "FALSE", CLIPS::TYPE_SYMBOL));
+		  } else {
+			  fact->set_slot("value", CLIPS::Value((long long)value));
+		  }
+		  clips_->assert_fact(fact);
+	  });
+}
+
+void
+LLSFRefBox::log_mps_command_metrics()
+{
+	for (const auto &m : mps_executor_->metrics()) {
+		logger_->log_info("MPS",
+		                  "%s: %llu commands, %llu failed, %llu rejected, max queue %zu, "
+		                  "latency avg %.1f ms max %.1f ms",
+		                  m.first.c_str(),
+		                  (unsigned long long)m.second.executed,
+		                  (unsigned long long)m.second.failed,
+		                  (unsigned long long)m.second.rejected,
+		                  m.second.max_queue_depth,
+		                  m.second.avg_latency_ms,
+		                  m.second.max_latency_ms);
+	}
 }
 
 #ifdef HAVE_MONGODB
@@ -1482,7 +1876,7 @@ LLSFRefBox::setup_clips_mongodb()
 	                     sigc::slot<CLIPS::Values, void *, std::string>(
 	                       sigc::mem_fun(*this, &LLSFRefBox::clips_bson_get_time)));
 
-	clips_->build("(deffacts have-feature-mongodb (have-feature MongoDB))");
+	build_clips_setup("(deffacts have-feature-mongodb (have-feature MongoDB))");
 }
 
 /** Handle message that was sent to a server client.
@@ -2016,14 +2410,7 @@ LLSFRefBox::handle_timer(const boost::system::error_code &error)
 
 		//sps_read_rfids();
 
-		{
-			//std::lock_guard<std::recursive_mutex> lock(clips_mutex_);
-			fawkes::MutexLocker lock(&clips_mutex_);
-
-			clips_->assert_fact("(time (now))");
-			clips_->refresh_agenda();
-			clips_->run();
-		}
+		run_cycle();
 
 		timer_.expires_at(timer_.expires_at() + boost::posix_time::milliseconds(cfg_timer_interval_));
 		timer_.async_wait(
@@ -2031,6 +2418,99 @@ LLSFRefBox::handle_timer(const boost::system::error_code &error)
 	}
 }
 
+/** Run one cycle of the CLIPS environment.
+ * Feeds the results of machine commands and the expired deadlines to
+ * CLIPS and runs the agenda.
+ * @return number of rules fired
+ */
+long int
+LLSFRefBox::run_cycle()
+{
+	//std::lock_guard<std::recursive_mutex> lock(clips_mutex_);
+	fawkes::MutexLocker lock(&clips_mutex_);
+
+	if (mockup_timer_queue_) {
+		mockup_timer_queue_->advance(std::chrono::milliseconds(cfg_mockup_clock_step_));
+	}
+	process_clips_ingress();
+	process_mps_state();
+	clips_deadlines_->expire();
+	clips_->refresh_agenda();
+	long int fired = clips_->run();
+	clips_publisher_->publish();
+	return fired;
+}
+
+/** Run one cycle of a headless refbox.
+ * Advances the virtual clock by one timer interval, waits until the
+ * machine commands of the previous cycle have been executed and runs the
+ * cycle, just like the timer does for a refbox with network.
+ * @return number of rules fired
+ */
+long int
+LLSFRefBox::tick()
+{
+	if (!headless_) {
+		throw fawkes::Exception("Only a headless refbox can be ticked");
+	}
+	virtual_now_ += (long int)cfg_timer_interval_ * 1000;
+	mps_executor_->wait_idle();
+	return run_cycle();
+}
+
+/** Get the virtual time of a headless refbox.
+ * @return time advanced by tick()
+ */
+const fawkes::Time &
+LLSFRefBox::virtual_time() const
+{
+	return virtual_now_;
+}
+
+/** Pass a message to CLIPS as if it was received from the network.
+ * Only available when headless, otherwise messages come from the network.
+ * @param peer_id ID of the peer which received the message, or 0 for a
+ * message received by the stream server, e.g., from the referee frontend
+ * @param host host the message was sent from
+ * @param port port the message was sent from
+ * @param msg message
+ */
+void
+LLSFRefBox::inject_message(long int                                   peer_id,
+                           const std::string &                        host,
+                           unsigned short                             port,
+                           std::shared_ptr<google::protobuf::Message> msg)
+{
+	if (!headless_) {
+		throw fawkes::Exception("Messages can only be injected into a headless refbox");
+	}
+	if (peer_id > 0) {
+		pb_comm_->inject_peer_message(peer_id, host, port, msg);
+	} else {
+		pb_comm_->inject_stream_message(host, port, msg);
+	}
+}
+
+/** Evaluate an expression in the CLIPS environment.
+ * @param expression CLIPS expression
+ * @return result of the evaluation
+ */
+CLIPS::Values
+LLSFRefBox::evaluate(const std::string &expression)
+{
+	fawkes::MutexLocker lock(&clips_mutex_);
+	return clips_->evaluate(expression);
+}
+
+/** Get the number of messages sent by a headless refbox.
+ * @return number of messages broadcast or sent to peers
+ */
+uint64_t
+LLSFRefBox::messages_sent() const
+{
+	return headless_msgs_sent_;
+}
+
 /** Handle operating system signal.
  * @param error error code
  * @param signum signal number
@@ -2062,6 +2542,10 @@ LLSFRefBox::run()
 	signal(SIGINT, llsfrb::handle_signal);
 #endif
 
+	if (cfg_save_clips_image_) {
+		return 0;
+	}
+
 	start_timer();
 	io_service_.run();
 	return 0;
@@ -2075,7 +2559,7 @@ LLSFRefBox::setup_clips_websocket()
 	fawkes::MutexLocker lock(&clips_mutex_);
 
 	//tell CLIPS that the websocket rules should be considered
-	clips_->build("(deffacts have-feature-websocket (have-feature websocket))");
+	build_clips_setup("(deffacts have-feature-websocket (have-feature websocket))");
 
 	//define the functions called by CLIPS
 
@@ -2189,6 +2673,11 @@ LLSFRefBox::setup_clips_websocket()
 		  phase.c_str(),
 		  reason.c_str());
 	};
+
+	// updates of changed facts are pushed from the fact events, not by rules
+	ws_fact_updater_ = std::make_unique<websocket::FactUpdater>(backend_->get_data(),
+	                                                            clips_publisher_.get(),
+	                                                            logger_.get());
 }
 
 #endif
@@ -38,6 +38,8 @@
 #ifndef __LLSF_REFBOX_REFBOX_H_
 #define __LLSF_REFBOX_REFBOX_H_
 
+#include <clips_replica/publisher.h>
+#include <clips_replica/replica.h>
 #include <core/threading/mutex.h>
 #include <core/threading/mutex_locker.h>
 #include <core/threading/thread_list.h>
@@ -47,15 +49,26 @@
 #include <protobuf_comm/server.h>
 #include <utils/llsf/machines.h>
 
+#include "clips_config.h"
+#include "clips_deadlines.h"
+#include "fact_index.h"
+#include "game_snapshot.h"
+#include "mps_executor.h"
+#include "mps_state.h"
+#include "points_registry.h"
+
 #ifdef HAVE_WEBSOCKETS
 #	include <websocket/backend.h>
+#	include <websocket/fact_updater.h>
 #endif
 
+#include <atomic>
 #include <boost/asio.hpp>
 #include <clipsmm.h>
-#include <future>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace mps_placing_clips {
 class MPSPlacingGenerator;
@@ -87,38 +100,60 @@ class Configuration;
 class MultiLogger;
 class WebviewServer;
 class ClipsRestApi;
+namespace mps_comm {
+class MockupTimerQueue;
+}
 
 class LLSFRefBox
 {
 public:
-	LLSFRefBox(int argc, char **argv);
+	LLSFRefBox(int argc, char **argv, bool headless = false);
 	~LLSFRefBox();
 
 	int run();
 
+	long int            tick();
+	const fawkes::Time &virtual_time() const;
+	void                inject_message(long int                                   peer_id,
+	                                   const std::string &                        host,
+	                                   unsigned short                             port,
+	                                   std::shared_ptr<google::protobuf::Message> msg);
+	CLIPS::Values       evaluate(const std::string &expression);
+	uint64_t            messages_sent() const;
+
 	void handle_signal(const boost::system::error_code &error, int signum);
 
 private: // methods
 	void read_config(int argc, char **argv);
 
-	void start_timer();
-	void handle_timer(const boost::system::error_code &error);
+	void     start_timer();
+	void     handle_timer(const boost::system::error_code &error);
+	long int run_cycle();
+
+	fawkes::Time now() const;
 
 	void setup_protobuf_comm();
 
 	void start_clips();
 	void setup_clips();
+	void build_clips_setup(const std::string &construct);
 	void handle_clips_periodic();
 	void setup_clips_mongodb();
 
 	CLIPS::Values clips_now();
 	CLIPS::Values clips_get_clips_dirs();
-	void          clips_load_config(std::string cfg_prefix);
 	CLIPS::Value  clips_config_path_exists(std::string path);
 	CLIPS::Value  clips_config_get_bool(std::string path);
 	CLIPS::Value  clips_config_get_int(std::string path);
 
-	bool mutex_future_ready(const std::string &name);
+	bool submit_mps_command(const std::string &     machine,
+	                        const std::string &     name,
+	                        MpsExecutor::Command    command,
+	                        MpsExecutor::Completion completion = MpsExecutor::Completion());
+	void post_clips_fact(const std::string &fact);
+	void process_clips_ingress();
+	void process_mps_state();
+	void log_mps_command_metrics();
 
 #ifdef HAVE_MONGODB
 	CLIPS::Value clips_bson_create();
@@ -179,6 +214,14 @@ private: // methods
 	void clips_mps_reset_base_counter(std::string machine);
 	void clips_mps_deliver(std::string machine);
 
+	CLIPS::Values clips_mps_command_stats(std::string machine);
+
+	void         clips_points_add(std::string team, std::string phase, int points);
+	void         clips_points_remove(std::string team, std::string phase, int points);
+	void         clips_points_reset();
+	CLIPS::Value clips_points_phase(std::string team, std::string phase);
+	CLIPS::Value clips_points_total(std::string team);
+
 	std::string clips_value_to_string(const CLIPS::Value &v);
 
 	void handle_server_client_msg(protobuf_comm::ProtobufStreamServer::ClientID client,
@@ -212,15 +255,34 @@ private: // members
 	std::unique_ptr<MultiLogger>                            logger_;
 	std::unique_ptr<MultiLogger>                            clips_logger_;
 	Logger::LogLevel                                        log_level_;
+	Logger::LogLevel                                        console_log_level_;
 	std::shared_ptr<mps_placing_clips::MPSPlacingGenerator> mps_placing_generator_;
 
 	fawkes::Mutex                                                       clips_mutex_;
 	std::unique_ptr<CLIPS::Environment>                                 clips_;
+	std::unique_ptr<ClipsFactIndex>                                     clips_fact_index_;
+	std::unique_ptr<ClipsConfig>                                        clips_config_;
+	std::unique_ptr<ClipsDeadlines>                                     clips_deadlines_;
+	std::vector<std::string>                                            clips_setup_constructs_;
+	std::unique_ptr<clips_replica::FactChangePublisher>                 clips_publisher_;
+	std::unique_ptr<clips_replica::FactReplica>                         clips_replica_;
+	std::unique_ptr<GameSnapshotWriter>                                 snapshot_writer_;
 	std::unordered_map<std::string, std::unique_ptr<mps_comm::Machine>> mps_;
 	std::unique_ptr<protobuf_clips::ClipsProtobufCommunicator>          pb_comm_;
 	std::map<long int, CLIPS::Fact::pointer>                            clips_msg_facts_;
+	std::unique_ptr<MpsExecutor>                                        mps_executor_;
+	MpsStateCache                                                       mps_state_;
+	PointsRegistry                                                      points_;
+
+	std::mutex               clips_ingress_mutex_;
+	std::vector<std::string> clips_ingress_facts_;
+
+	std::shared_ptr<mps_comm::MockupTimerQueue> mockup_timer_queue_;
+	unsigned int                                cfg_mockup_clock_step_;
 
-	std::map<std::string, std::future<bool>> mutex_futures_;
+	bool                  headless_;
+	fawkes::Time          virtual_now_;
+	std::atomic<uint64_t> headless_msgs_sent_;
 
 	boost::asio::io_service     io_service_;
 	boost::asio::deadline_timer timer_;
@@ -228,11 +290,19 @@ private: // members
 
 	unsigned int                  cfg_timer_interval_;
 	std::string                   cfg_clips_dir_;
+	std::string                   cfg_clips_image_dir_;
+	bool                          cfg_save_clips_image_;
+	bool                          cfg_log_async_;
+	unsigned int                  cfg_log_queue_size_;
 	llsf_utils::MachineAssignment cfg_machine_assignment_;
+	bool                          cfg_restore_;
+	std::string                   cfg_snapshot_file_;
+	std::vector<std::string>      cfg_snapshot_templates_;
 
 #ifdef HAVE_WEBSOCKETS
-	websocket::Backend *backend_;
-	void                setup_clips_websocket();
+	websocket::Backend *                    backend_;
+	std::unique_ptr<websocket::FactUpdater> ws_fact_updater_;
+	void                                    setup_clips_websocket();
 #endif
 
 #ifdef HAVE_AVAHI
@@ -0,0 +1,155 @@
+
+/***************************************************************************
+ *  rcll-log-decode.cpp - render binary log files
+ *
+ *  Created: Mon Oct 19 14:02:17 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <logging/binary.h>
+#include <utils/system/argparser.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <regex>
+#include <string>
+
+using namespace llsfrb;
+using namespace fawkes;
+
+void
+usage(const char *progname)
+{
+	printf("Usage: %s [-l LEVEL] [-c COMPONENT] [-g REGEX] [-i] [-s] <file.blog>\n"
+	       "Render a binary log written by the refbox as text.\n"
+	       " -l LEVEL      only show messages of at least the given level,\n"
+	       "               one of debug, info, warn, or error\n"
+	       " -c COMPONENT  only show messages of the given component\n"
+	       " -g REGEX      only show messages matching the regular expression\n"
+	       " -i            match the regular expression case-insensitive\n"
+	       " -s            print information about the log file before the messages\n",
+	       progname);
+}
+
+int
+main(int argc, char **argv)
+{
+	ArgumentParser argp(argc, argv, "hl:c:g:is");
+
+	if (argp.has_arg("h") || argp.num_items() != 1) {
+		usage(argv[0]);
+		exit(argp.has_arg("h") ? 0 : 1);
+	}
+
+	Logger::LogLevel min_level = Logger::LL_DEBUG;
+	if (argp.has_arg("l")) {
+		std::string ll = argp.arg("l");
+		if (ll == "debug") {
+			min_level = Logger::LL_DEBUG;
+		} else if (ll == "info") {
+			min_level = Logger::LL_INFO;
+		} else if (ll == "warn") {
+			min_level = Logger::LL_WARN;
+		} else if (ll == "error") {
+			min_level = Logger::LL_ERROR;
+		} else {
+			printf("Invalid log level '%s'\n\n", ll.c_str());
+			usage(argv[0]);
+			exit(1);
+		}
+	}
+
+	std::string component;
+	if (argp.has_arg("c")) {
+		component = argp.arg("c");
+	}
+
+	bool       grep = argp.has_arg("g");
+	std::regex grep_re;
+	if (grep) {
+		try {
+			grep_re = std::regex(argp.arg("g"),
+			                     argp.has_arg("i") ? std::regex::extended | std::regex::icase
+			                                       : std::regex::extended);
+		} catch (std::regex_error &e) {
+			printf("Invalid regular expression '%s': %s\n", argp.arg("g"), e.what());
+			exit(1);
+		}
+	}
+
+	try {
+		BinaryLogReader reader(argp.items()[0]);
+
+		if (argp.has_arg("s")) {
+			time_t    created = reader.created();
+			struct tm created_s;
+			localtime_r(&created, &created_s);
+			char created_str[64];
+			strftime(created_str, sizeof(created_str), "%Y-%m-%d %H:%M:%S", &created_s);
+			printf("Log created: %s\n", created_str);
+			printf("Overwritten: %llu records\n", (unsigned long long)reader.overwritten());
+		}
+
+		BinaryLogReader::Entry entry;
+		while (reader.next(entry)) {
+			if (entry.level < min_level)
+				continue;
+			if (!component.empty() && entry.component != component)
+				continue;
+			if (grep && !std::regex_search(entry.message, grep_re))
+				continue;
+
+			const char *level_char;
+			switch (entry.level) {
+			case Logger::LL_DEBUG: level_char = "D"; break;
+			case Logger::LL_INFO: level_char = "I"; break;
+			case Logger::LL_WARN: level_char = "W"; break;
+			default: level_char = "E"; break;
+			}
+			struct tm now_s;
+			localtime_r(&entry.time.tv_sec, &now_s);
+			printf("%s %02d:%02d:%02d.%06ld %s%s: %s\n",
+			       level_char,
+			       now_s.tm_hour,
+			       now_s.tm_min,
+			       now_s.tm_sec,
+			       (long)entry.time.tv_usec,
+			       entry.component.c_str(),
+			       entry.exception ? " [EXCEPTION]" : "",
+			       entry.message.c_str());
+		}
+	} catch (Exception &e) {
+		printf("Failed to read log: %s\n", e.what_no_backtrace());
+		exit(2);
+	}
+
+	return 0;
+}
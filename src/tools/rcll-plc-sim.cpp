@@ -0,0 +1,367 @@
+
+/***************************************************************************
+ *  rcll-plc-sim.cpp - OPC UA stand-in for the PLCs of the MPS
+ *
+ *  Created: Mon Oct 19 19:48:05 2026
+ *  Copyright  2026  agent <agent@local>
+ ****************************************************************************/
+
+/*  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the authors nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <core/exception.h>
+#include <mps_comm/machine.h>
+#include <mps_comm/mockup/timer_queue.h>
+#include <mps_comm/opcua/mps_io_mapping.h>
+#include <mps_comm/opcua/opc_utils.h>
+#include <opc/ua/node.h>
+#include <opc/ua/protocol/string_utils.h>
+#include <opc/ua/server/server.h>
+#include <opc/ua/subscription.h>
+#include <utils/system/argparser.h>
+
+#if HAVE_SYSTEM_SPDLOG
+#	include <spdlog/sinks/stdout_sinks.h>
+#endif
+
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace llsfrb::mps_comm;
+using namespace fawkes;
+using std::chrono::milliseconds;
+
+static volatile sig_atomic_t quit = 0;
+
+static void
+handle_signal(int)
+{
+	quit = 1;
+}
+
+// Durations of the emulated station behaviour
+struct Timing
+{
+	milliseconds step;     // station operation, e.g., dispensing a base
+	milliseconds conveyor; // conveyor movement
+	milliseconds pickup;   // until a product at the input or output is taken
+	unsigned int publish;  // publishing interval in ms to notice new instructions
+};
+
+// Node paths of the connection modes plc and plc_simulation
+enum Layout { LAYOUT_PLC, LAYOUT_SIM, LAYOUT_SIM64 };
+
+// Register nodes of the in or basic set of one station
+struct RegisterSet
+{
+	OpcUa::Node action_id;
+	OpcUa::Node barcode;
+	OpcUa::Node data[2];
+	OpcUa::Node error;
+	OpcUa::Node slide_count;
+	OpcUa::Node busy;
+	OpcUa::Node enable;
+	OpcUa::Node status_error;
+	OpcUa::Node ready;
+};
+
+// One station: an OPC UA server with the register layout of the PLC which
+// executes instructions once the enable bit has been set by the client
+class SimulatedStation : public OpcUa::SubscriptionHandler
+{
+public:
+	SimulatedStation(const std::string &               name,
+	                 unsigned short                    port,
+	                 Layout                            layout,
+	                 const Timing &                    timing,
+	                 std::shared_ptr<MockupTimerQueue> timers,
+	                 std::shared_ptr<spdlog::logger>   logger)
+	: name_(name),
+	  port_(port),
+	  layout_(layout),
+	  timing_(timing),
+	  timers_(timers),
+	  logger_(logger),
+	  instructions_(0)
+	{
+	}
+
+	~SimulatedStation()
+	{
+		stop();
+	}
+
+	void
+	start()
+	{
+		server_ = std::make_unique<OpcUa::UaServer>(logger_);
+		server_->SetEndpoint("opc.tcp://0.0.0.0:" + std::to_string(port_));
+		server_->SetServerURI("urn:rcll:plc-sim:" + name_);
+		server_->SetServerName("RCLL PLC simulation " + name_);
+		server_->Start();
+
+		const std::vector<std::string> *paths[3][2] = {
+		  {&OpcUtils::IN_NODE_PATH, &OpcUtils::BASIC_NODE_PATH},
+		  {&OpcUtils::IN_NODE_PATH_SIM, &OpcUtils::BASIC_NODE_PATH_SIM},
+		  {&OpcUtils::IN_NODE_PATH_64_SIM, &OpcUtils::BASIC_NODE_PATH_64_SIM}};
+		for (unsigned int set = 0; set < 2; ++set) {
+			create_registers(*paths[layout_][set], sets_[set]);
+		}
+
+		subscription_ = server_->CreateSubscription(timing_.publish, *this);
+		for (unsigned int set = 0; set < 2; ++set) {
+			subscription_->SubscribeDataChange(sets_[set].enable);
+		}
+	}
+
+	void
+	stop()
+	{
+		if (!server_) {
+			return;
+		}
+		timers_->cancel(this);
+		subscription_.reset();
+		server_->Stop();
+		server_.reset();
+		nodes_.clear();
+	}
+
+	uint64_t
+	num_instructions() const
+	{
+		return instructions_;
+	}
+
+protected:
+	void
+	DataChange(uint32_t,
+	           const OpcUa::Node &   node,
+	           const OpcUa::Variant &val,
+	           OpcUa::AttributeId) override
+	{
+		if (val.IsNul() || !val.As<bool>()) {
+			return;
+		}
+		const unsigned int set = (node.GetId() == sets_[0].enable.GetId()) ? 0 : 1;
+		// do not write to the address space from within the notification
+		timers_->schedule(milliseconds(0), [this, set] { execute(set); }, this);
+	}
+
+private:
+	OpcUa::Node
+	child(const std::string &path, const std::string &browse_name)
+	{
+		auto n = nodes_.find(path + "/" + browse_name);
+		if (n != nodes_.end()) {
+			return n->second;
+		}
+		OpcUa::QualifiedName qn     = OpcUa::ToQualifiedName(browse_name, 0);
+		OpcUa::Node          parent = path.empty() ? server_->GetObjectsNode() : nodes_.at(path);
+		OpcUa::Node          node =
+		  parent.AddObject(OpcUa::NodeId(path + "/" + browse_name, qn.NamespaceIndex), qn);
+		nodes_[path + "/" + browse_name] = node;
+		return node;
+	}
+
+	OpcUa::Node
+	variable(const std::string &path, const std::string &browse_name, const OpcUa::Variant &value)
+	{
+		OpcUa::QualifiedName qn     = OpcUa::ToQualifiedName(browse_name, 0);
+		OpcUa::Node          parent = nodes_.at(path);
+		OpcUa::Node          node =
+		  parent.AddVariable(OpcUa::NodeId(path + "/" + browse_name, qn.NamespaceIndex), qn, value);
+		nodes_[path + "/" + browse_name] = node;
+		return node;
+	}
+
+	void
+	create_registers(const std::vector<std::string> &node_path, RegisterSet &r)
+	{
+		// the first element is the objects folder itself
+		std::string path;
+		for (size_t i = 1; i < node_path.size(); ++i) {
+			child(path, node_path[i]);
+			path += "/" + node_path[i];
+		}
+		child(path, "4:p");
+		const std::string p = path + "/4:p";
+		r.action_id         = variable(p, "4:ActionId", OpcUa::Variant((uint16_t)0));
+		r.barcode           = variable(p, "4:BarCode", OpcUa::Variant((uint32_t)0));
+		child(p, "4:Data");
+		r.data[0]     = variable(p + "/4:Data", "4:[0]", OpcUa::Variant((uint16_t)0));
+		r.data[1]     = variable(p + "/4:Data", "4:[1]", OpcUa::Variant((uint16_t)0));
+		r.error       = variable(p, "4:Error", OpcUa::Variant((uint8_t)0));
+		r.slide_count = variable(p, "4:SlideCnt", OpcUa::Variant((uint16_t)0));
+		child(p, "4:Status");
+		r.busy         = variable(p + "/4:Status", "4:Busy", OpcUa::Variant(false));
+		r.enable       = variable(p + "/4:Status", "4:Enable", OpcUa::Variant(false));
+		r.status_error = variable(p + "/4:Status", "4:Error", OpcUa::Variant((uint8_t)0));
+		r.ready        = variable(p + "/4:Status", "4:Ready", OpcUa::Variant(false));
+	}
+
+	void
+	execute(unsigned int set)
+	{
+		RegisterSet &  r        = sets_[set];
+		const uint16_t command  = r.action_id.GetValue().As<uint16_t>();
+		const uint16_t payload1 = r.data[0].GetValue().As<uint16_t>();
+		// the instruction has been taken
+		r.enable.SetValue(OpcUa::Variant(false));
+		++instructions_;
+		// basic instructions (lights, reset, heartbeat) complete immediately
+		if (set == 1 || command < STATION_BASE) {
+			return;
+		}
+		r.busy.SetValue(OpcUa::Variant(true));
+		if (command % 100 == COMMAND_MOVE_CONVEYOR) {
+			if (payload1 == Machine::MIDDLE) {
+				// the workpiece passed the barcode scanner
+				static std::atomic<uint32_t> next_barcode(1);
+				r.barcode.SetValue(OpcUa::Variant((uint32_t)next_barcode++));
+			}
+			timers_->schedule(
+			  timing_.conveyor,
+			  [this, &r, payload1] {
+				  r.busy.SetValue(OpcUa::Variant(false));
+				  if (payload1 == Machine::INPUT || payload1 == Machine::OUTPUT) {
+					  r.ready.SetValue(OpcUa::Variant(true));
+					  timers_->schedule(
+					    timing_.pickup, [&r] { r.ready.SetValue(OpcUa::Variant(false)); }, this);
+				  }
+			  },
+			  this);
+		} else {
+			timers_->schedule(
+			  timing_.step, [&r] { r.busy.SetValue(OpcUa::Variant(false)); }, this);
+		}
+	}
+
+	const std::string                  name_;
+	const unsigned short               port_;
+	const Layout                       layout_;
+	const Timing                       timing_;
+	std::shared_ptr<MockupTimerQueue>  timers_;
+	std::shared_ptr<spdlog::logger>    logger_;
+	std::atomic<uint64_t>              instructions_;
+	std::unique_ptr<OpcUa::UaServer>   server_;
+	OpcUa::Subscription::SharedPtr     subscription_;
+	std::map<std::string, OpcUa::Node> nodes_;
+	RegisterSet                        sets_[2];
+};
+
+void
+usage(const char *progname)
+{
+	printf("Usage: %s [-n NUM] [-p PORT] [-l LAYOUT] [-s MS] [-c MS] [-k MS] [-i MS]\n"
+	       "Simulate the PLCs of NUM stations, each with its own OPC UA server.\n"
+	       " -n NUM     number of stations, default 7\n"
+	       " -p PORT    port of the first station, the others use the following\n"
+	       "            ports, default 4840\n"
+	       " -l LAYOUT  node layout, plc for connection mode plc (default), sim or\n"
+	       "            sim64 for plc_simulation with a 32 or 64 bit CODESYS runtime\n"
+	       " -s MS      duration of station operations, default 1000\n"
+	       " -c MS      duration of conveyor movements, default 1000\n"
+	       " -k MS      time until a product at the input or output is taken,\n"
+	       "            default 2000\n"
+	       " -i MS      interval to check for new instructions, default 10\n",
+	       progname);
+}
+
+int
+main(int argc, char **argv)
+{
+	ArgumentParser argp(argc, argv, "hn:p:l:s:c:k:i:");
+
+	if (argp.has_arg("h") || argp.num_items() != 0) {
+		usage(argv[0]);
+		exit(argp.has_arg("h") ? 0 : 1);
+	}
+
+	unsigned int num_stations = argp.has_arg("n") ? argp.parse_int("n") : 7;
+	unsigned int port         = argp.has_arg("p") ? argp.parse_int("p") : 4840;
+	Timing       timing;
+	timing.step     = milliseconds(argp.has_arg("s") ? argp.parse_int("s") : 1000);
+	timing.conveyor = milliseconds(argp.has_arg("c") ? argp.parse_int("c") : 1000);
+	timing.pickup   = milliseconds(argp.has_arg("k") ? argp.parse_int("k") : 2000);
+	timing.publish  = argp.has_arg("i") ? argp.parse_int("i") : 10;
+
+	Layout layout = LAYOUT_PLC;
+	if (argp.has_arg("l")) {
+		std::string l = argp.arg("l");
+		if (l == "plc") {
+			layout = LAYOUT_PLC;
+		} else if (l == "sim") {
+			layout = LAYOUT_SIM;
+		} else if (l == "sim64") {
+			layout = LAYOUT_SIM64;
+		} else {
+			printf("Invalid layout '%s'\n\n", l.c_str());
+			usage(argv[0]);
+			exit(1);
+		}
+	}
+
+	signal(SIGINT, handle_signal);
+	signal(SIGTERM, handle_signal);
+
+	std::shared_ptr<spdlog::logger> logger = spdlog::stdout_logger_mt("plc-sim");
+	logger->set_level(spdlog::level::warn);
+
+	std::shared_ptr<MockupTimerQueue>              timers = MockupTimerQueue::instance();
+	std::vector<std::unique_ptr<SimulatedStation>> stations;
+	try {
+		for (unsigned int i = 0; i < num_stations; ++i) {
+			stations.push_back(std::make_unique<SimulatedStation>(
+			  "station-" + std::to_string(i + 1), port + i, layout, timing, timers, logger));
+			stations.back()->start();
+		}
+	} catch (std::exception &e) {
+		printf("Failed to start station %zu: %s\n", stations.size(), e.what());
+		exit(2);
+	}
+	printf("Simulating %u stations on ports %u to %u\n", num_stations, port, port + num_stations - 1);
+
+	while (!quit) {
+		std::this_thread::sleep_for(milliseconds(100));
+	}
+
+	uint64_t instructions = 0;
+	for (auto &s : stations) {
+		instructions += s->num_instructions();
+		s->stop();
+	}
+	printf("Executed %llu instructions\n", (unsigned long long)instructions);
+	return 0;
+}